@@ -25,6 +25,7 @@
 #include <kernel/util/simple_arg_parser.hpp>
 #include <kernel/util/time_stamp.hpp>
 #include <kernel/util/statistics.hpp>
+#include <kernel/util/region_timer.hpp>
 #include <kernel/geometry/export_vtk.hpp>
 #include <kernel/trafo/standard/mapping.hpp>
 #include <kernel/trafo/inverse_mapping.hpp>
@@ -626,6 +627,20 @@ namespace NvSCCNDQ2P1dc
     const bool defo = (args.check("defo") >= 0);
     const bool old_vanka = (args.check("old-vanka") >= 0);
     const bool testmode = (args.check("test-mode") >= 0);
+    const bool use_trafo_cache = (args.check("trafo-cache") >= 0);
+    const bool use_scatter_map = (args.check("scatter-map") >= 0);
+    const bool region_timer = (args.check("region-timer") >= 0);
+
+    // enable region timer; the optional argument is the peak memory bandwidth per process in GB/s
+    if(region_timer)
+    {
+      double peak_bw(0.0);
+      args.parse("region-timer", peak_bw);
+      RegionTimer::set_peak_bandwidth(1E+9 * peak_bw);
+      if((args.check("hw-counters") >= 0) && !RegionTimer::enable_hw_counters())
+        comm.print("WARNING: hardware counters are not available");
+      RegionTimer::enable();
+    }
 
 #ifdef FEAT_HAVE_UMFPACK
     const bool umf_cgs = (domain.back_layer().comm().size() == 1);
@@ -650,6 +665,9 @@ namespace NvSCCNDQ2P1dc
       comm.print(String("Max LinSol Iter").pad_back(pl, pc) + ": " + stringify(max_mg_steps));
       comm.print(String("Max NonLin Iter").pad_back(pl, pc) + ": " + stringify(max_nl_steps));
       comm.print(String("Vanka Type").pad_back(pl, pc) + ": " + (old_vanka ? "Old Vanka version" : "AmaVanka version"));
+      comm.print(String("Trafo Cache").pad_back(pl, pc) + ": " + (use_trafo_cache ? "yes" : "no"));
+      comm.print(String("Scatter Map").pad_back(pl, pc) + ": " + (use_scatter_map ? "yes" : "no"));
+      comm.print(String("Region Timer").pad_back(pl, pc) + ": " + (region_timer ? "yes" : "no"));
       if(umf_cgs)
         comm.print(String("Coarse Solver").pad_back(pl, pc) + ": UMFPACK");
       else
@@ -1033,6 +1051,29 @@ namespace NvSCCNDQ2P1dc
       burgers_def.nu = nu;
       burgers_def.beta = DataType(1);
 
+      // create trafo evaluation caches for the burgers assembly on all levels (if desired)
+      typedef typename Assembly::BurgersAssembler<DataType, IndexType, dim>::template TrafoEvalCache<SpaceVeloType> TrafoCacheType;
+      std::deque<std::shared_ptr<TrafoCacheType>> trafo_caches;
+      if(use_trafo_cache)
+      {
+        for(std::size_t i(0); i < system_levels.size(); ++i)
+        {
+          trafo_caches.push_back(std::make_shared<TrafoCacheType>(domain.at(i)->trafo, cubature));
+          trafo_caches.back()->compile();
+        }
+      }
+
+      // create scatter maps for the velocity matrix blocks on all levels (if desired)
+      std::deque<Assembly::ScatterMap<IndexType>> scatter_maps(system_levels.size());
+      if(use_scatter_map)
+      {
+        for(std::size_t i(0); i < system_levels.size(); ++i)
+        {
+          Assembly::SymbolicAssembler::assemble_scatter_map_std1(scatter_maps.at(i),
+            system_levels.at(i)->matrix_sys.local().block_a(), domain.at(i)->space_velo);
+        }
+      }
+
       // assemble non-linear defect
       DataType def_nl_init = DataType(0);
 
@@ -1047,8 +1088,12 @@ namespace NvSCCNDQ2P1dc
         watch_nonlin_def_asm.start();
         vec_def.format();
         // assemble burgers operator defect
-        burgers_def.assemble_vector(vec_def.local().template at<0>(), vec_sol.local().template at<0>(),
-          vec_sol.local().template at<0>(), the_domain_level.space_velo, cubature, -1.0);
+        if(use_trafo_cache)
+          burgers_def.assemble_vector(vec_def.local().template at<0>(), vec_sol.local().template at<0>(),
+            vec_sol.local().template at<0>(), the_domain_level.space_velo, *trafo_caches.front(), -1.0);
+        else
+          burgers_def.assemble_vector(vec_def.local().template at<0>(), vec_sol.local().template at<0>(),
+            vec_sol.local().template at<0>(), the_domain_level.space_velo, cubature, -1.0);
         // compute remainder of defect vector
         the_system_level.matrix_sys.local().block_b().apply(
           vec_def.local().template at<0>(), vec_sol.local().template at<1>(), vec_def.local().template at<0>(), -1.0);
@@ -1111,7 +1156,13 @@ namespace NvSCCNDQ2P1dc
             // assemble our system matrix
             auto& loc_mat_a = system_levels.at(i)->matrix_sys.local().block_a();
             loc_mat_a.format();
-            burgers_mat.assemble_matrix(loc_mat_a, vec_conv.local(), domain.at(i)->space_velo, cubature);
+            const auto* scatter_map = (use_scatter_map ? &scatter_maps.at(i) : nullptr);
+            if(use_trafo_cache)
+              burgers_mat.assemble_matrix(loc_mat_a, vec_conv.local(), domain.at(i)->space_velo,
+                *trafo_caches.at(i), DataType(1), scatter_map);
+            else
+              burgers_mat.assemble_matrix(loc_mat_a, vec_conv.local(), domain.at(i)->space_velo,
+                cubature, DataType(1), scatter_map);
             system_levels.at(i)->compile_local_matrix();
 
             // restrict our convection vector
@@ -1456,6 +1507,12 @@ namespace NvSCCNDQ2P1dc
     comm.print("\n");
     comm.print(FEAT::Statistics::get_formatted_solver_tree("default").trim());
 
+    if(region_timer)
+    {
+      comm.print("\nRegion Timings:");
+      comm.print(RegionTimer::get_formatted_regions(comm));
+    }
+
     if(testmode)
       comm.print("\nTest-Mode: PASSED");
   }
@@ -1527,6 +1584,10 @@ namespace NvSCCNDQ2P1dc
     args.support("gmresk");
     args.support("test-mode");
     args.support("old-vanka");
+    args.support("trafo-cache");
+    args.support("scatter-map");
+    args.support("region-timer");
+    args.support("hw-counters");
 
     // check for unsupported options
     auto unsupported = args.query_unsupported();
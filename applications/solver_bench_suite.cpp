@@ -0,0 +1,1364 @@
+// FEAT3: Finite Element Analysis Toolbox, Version 3
+// Copyright (C) 2010 - 2020 by Stefan Turek & the FEAT group
+// FEAT3 is released under the GNU General Public License version 3,
+// see the file 'copyright.txt' in the top level directory for details.
+
+//
+// End-to-End Solver Benchmark Suite
+// ---------------------------------
+// This application runs a set of standard solver scenarios on the unit-square domain
+// and writes the collected timings, iteration counts and memory usage into a
+// machine-readable JSON report, so that the performance of the solver components
+// can be tracked across versions.
+//
+// The following scenarios are available:
+//
+// - poisson-q1-mg:  Poisson equation with Q1 elements, solved by a multigrid-preconditioned
+//                   Richardson iteration with Jacobi smoothers
+// - poisson-q2-mg:  the same as above, but with Q2 elements
+// - stokes-q2p1dc:  Stokes equations with Q2/P1dc elements in a channel, solved by a
+//                   multigrid-preconditioned Richardson iteration with AmaVanka smoothers
+// - burgers-newton: a single Newton step for the Navier-Stokes equations based on the
+//                   solution of the stokes-q2p1dc scenario, which includes the assembly of
+//                   the non-linear defect and the Burgers matrices on all levels
+// - amg-setup:      the setup of an AMG hierarchy for the process-local Q1 Poisson matrix
+//                   followed by a solve of the process-local system
+// - assembly:       the assembly of the Q2/P1dc Burgers and gradient/divergence matrices
+//                   on all levels without any solver
+//
+// All times reported in the JSON file are maxima over all processes and all memory
+// high-water marks are reported both as maximum and as sum over all processes.
+// Note that the memory high-water marks are process-wide, i.e. each scenario reports
+// the maximum of itself and all scenarios which have been executed before.
+//
+// Usage:
+// solver_bench_suite --level <levels...> [--scenarios <names...>] [--json <filename>]
+//
+// The levels are specified in the same way as for the poisson_bench_mg application, i.e.
+// as '<fine> [<level>:<layers>]... <coarse>', and the number of processes must be a power
+// of 4. The remaining options are:
+//
+// --max-iter <n>        maximum number of multigrid iterations; defaults to 50
+// --tol <eps>           relative tolerance for all linear solvers; defaults to 1E-8
+// --smooth-steps <n>    number of pre- and post-smoothing steps; defaults to 4
+// --smooth-damp <d>     damping parameter for the smoothers; defaults to 0.7
+// --nu <nu>             viscosity parameter for the Stokes and Burgers scenarios; defaults to 1E-2
+// --asm-repeat <n>      number of repetitions for the assembly scenario; defaults to 1
+// --amg-coarse <n>      maximum number of DOFs on the coarsest AMG level; defaults to 100
+// --test-mode           run in test mode and check that all solvers converge
+//
+#include <kernel/util/runtime.hpp>
+#include <kernel/util/simple_arg_parser.hpp>
+#include <kernel/util/statistics.hpp>
+#include <kernel/util/time_stamp.hpp>
+#include <kernel/util/memory_usage.hpp>
+#include <kernel/util/dist.hpp>
+#include <kernel/geometry/conformal_mesh.hpp>
+#include <kernel/trafo/standard/mapping.hpp>
+#include <kernel/space/lagrange1/element.hpp>
+#include <kernel/space/lagrange2/element.hpp>
+#include <kernel/space/discontinuous/element.hpp>
+#include <kernel/analytic/common.hpp>
+#include <kernel/assembly/common_functionals.hpp>
+#include <kernel/assembly/common_operators.hpp>
+#include <kernel/assembly/symbolic_assembler.hpp>
+#include <kernel/assembly/bilinear_operator_assembler.hpp>
+#include <kernel/assembly/linear_functional_assembler.hpp>
+#include <kernel/assembly/unit_filter_assembler.hpp>
+#include <kernel/assembly/burgers_assembler.hpp>
+#include <kernel/lafem/transfer.hpp>
+#include <kernel/solver/multigrid.hpp>
+#include <kernel/solver/richardson.hpp>
+#include <kernel/solver/jacobi_precond.hpp>
+#include <kernel/solver/pcg.hpp>
+#include <kernel/solver/fgmres.hpp>
+#include <kernel/solver/schwarz_precond.hpp>
+#include <kernel/solver/amavanka.hpp>
+#include <kernel/solver/amg.hpp>
+
+#include <control/domain/unit_cube_domain_control.hpp>
+#include <control/scalar_basic.hpp>
+#include <control/stokes_blocked.hpp>
+
+#include <cmath>
+#include <fstream>
+#include <vector>
+
+namespace SolverBenchSuite
+{
+  using namespace FEAT;
+
+  // define our arch types
+  typedef Mem::Main MemType;
+  typedef double DataType;
+  typedef Index IndexType;
+
+  // define our mesh and trafo types
+  typedef Shape::Quadrilateral ShapeType;
+  typedef Geometry::ConformalMesh<ShapeType> MeshType;
+  typedef Trafo::Standard::Mapping<MeshType> TrafoType;
+
+  /**
+   * \brief Simple JSON object writer
+   *
+   * This class collects the members of a JSON object in the order in which they are added.
+   * Nested objects and arrays of objects are formatted upon insertion.
+   */
+  class JsonObject
+  {
+  protected:
+    /// the list of (quoted key, formatted value) pairs
+    std::vector<std::pair<String, String>> _items;
+
+    /// indents all lines except for the first one of a formatted value
+    static String _indent(const String& s)
+    {
+      String r;
+      for(char c : s)
+      {
+        r.push_back(c);
+        if(c == '\n')
+          r.append("  ");
+      }
+      return r;
+    }
+
+  public:
+    /// quotes and escapes a string
+    static String quote(const String& s)
+    {
+      String r("\"");
+      for(char c : s)
+      {
+        switch(c)
+        {
+        case '"':  r.append("\\\""); break;
+        case '\\': r.append("\\\\"); break;
+        case '\n': r.append("\\n"); break;
+        case '\t': r.append("\\t"); break;
+        default:
+          if((unsigned char)c >= 0x20u)
+            r.push_back(c);
+          break;
+        }
+      }
+      r.push_back('"');
+      return r;
+    }
+
+    void add_string(const String& key, const String& value)
+    {
+      _items.emplace_back(quote(key), quote(value));
+    }
+
+    void add_number(const String& key, double value)
+    {
+      // JSON has no representation for infinity or NaN
+      _items.emplace_back(quote(key), std::isfinite(value) ? stringify_fp_sci(value, 9) : String("null"));
+    }
+
+    void add_integer(const String& key, unsigned long long value)
+    {
+      _items.emplace_back(quote(key), stringify(value));
+    }
+
+    void add_bool(const String& key, bool value)
+    {
+      _items.emplace_back(quote(key), String(value ? "true" : "false"));
+    }
+
+    void add_object(const String& key, const JsonObject& value)
+    {
+      _items.emplace_back(quote(key), value.format());
+    }
+
+    void add_array(const String& key, const std::vector<JsonObject>& values)
+    {
+      if(values.empty())
+      {
+        _items.emplace_back(quote(key), String("[]"));
+        return;
+      }
+      String s("[");
+      for(std::size_t i(0); i < values.size(); ++i)
+        s += String(i > 0u ? ",\n  " : "\n  ") + _indent(values.at(i).format());
+      s += "\n]";
+      _items.emplace_back(quote(key), s);
+    }
+
+    /// \returns The formatted JSON object.
+    String format() const
+    {
+      if(_items.empty())
+        return String("{}");
+      String s("{");
+      for(std::size_t i(0); i < _items.size(); ++i)
+        s += String(i > 0u ? ",\n  " : "\n  ") + _items.at(i).first + ": " + _indent(_items.at(i).second);
+      s += "\n}";
+      return s;
+    }
+  }; // class JsonObject
+
+  /**
+   * \brief Named phase timings
+   *
+   * The phase names are fixed upon construction, so that all processes reduce the
+   * same list of timings, even if some processes do not participate in some phases.
+   */
+  class TimeReport
+  {
+  protected:
+    std::vector<String> _names;
+    std::vector<double> _times;
+
+  public:
+    explicit TimeReport(const std::vector<String>& names) :
+      _names(names),
+      _times(names.size(), 0.0)
+    {
+    }
+
+    void add(const String& name, double seconds)
+    {
+      for(std::size_t i(0); i < _names.size(); ++i)
+      {
+        if(_names.at(i) == name)
+        {
+          _times.at(i) += seconds;
+          return;
+        }
+      }
+      XASSERTM(false, ("unknown phase name '" + name + "'").c_str());
+    }
+
+    /// reduces the maximum timings across all processes
+    JsonObject reduce(const Dist::Comm& comm) const
+    {
+      std::vector<double> tmax(_times.size(), 0.0);
+      comm.allreduce(_times.data(), tmax.data(), _times.size(), Dist::op_max);
+      JsonObject obj;
+      for(std::size_t i(0); i < _names.size(); ++i)
+        obj.add_number(_names.at(i), tmax.at(i));
+      return obj;
+    }
+  }; // class TimeReport
+
+  /// parameters shared by all scenarios
+  struct BenchParams
+  {
+    std::deque<String> levels;
+    Index max_iter;
+    DataType tol_rel;
+    Index smooth_steps;
+    DataType smooth_damp;
+    DataType nu;
+    Index asm_repeat;
+    Index amg_coarse;
+
+    BenchParams() :
+      max_iter(50),
+      tol_rel(1E-8),
+      smooth_steps(4),
+      smooth_damp(0.7),
+      nu(1E-2),
+      asm_repeat(1),
+      amg_coarse(100)
+    {
+    }
+  };
+
+  /// reduces the FEAT::Statistics operation timings and flop counts
+  JsonObject format_statistics(const Dist::Comm& comm)
+  {
+    const std::size_t n = 13u;
+    const char* names[n] =
+    {
+      "reduction", "blas2", "blas3", "axpy", "precon",
+      "mpi_execute_reduction", "mpi_execute_blas2", "mpi_execute_blas3", "mpi_execute_collective",
+      "mpi_wait_reduction", "mpi_wait_blas2", "mpi_wait_blas3", "mpi_wait_collective"
+    };
+    const double tloc[n] =
+    {
+      FEAT::Statistics::get_time_reduction(),
+      FEAT::Statistics::get_time_blas2(),
+      FEAT::Statistics::get_time_blas3(),
+      FEAT::Statistics::get_time_axpy(),
+      FEAT::Statistics::get_time_precon(),
+      FEAT::Statistics::get_time_mpi_execute_reduction(),
+      FEAT::Statistics::get_time_mpi_execute_blas2(),
+      FEAT::Statistics::get_time_mpi_execute_blas3(),
+      FEAT::Statistics::get_time_mpi_execute_collective(),
+      FEAT::Statistics::get_time_mpi_wait_reduction(),
+      FEAT::Statistics::get_time_mpi_wait_blas2(),
+      FEAT::Statistics::get_time_mpi_wait_blas3(),
+      FEAT::Statistics::get_time_mpi_wait_collective()
+    };
+    double tmax[n];
+    comm.allreduce(tloc, tmax, n, Dist::op_max);
+
+    unsigned long long floc(FEAT::Statistics::get_flops()), fsum(0ull);
+    comm.allreduce(&floc, &fsum, std::size_t(1), Dist::op_sum);
+
+    JsonObject obj;
+    for(std::size_t i(0); i < n; ++i)
+      obj.add_number(names[i], tmax[i]);
+    obj.add_integer("flops", fsum);
+    return obj;
+  }
+
+  /// reduces the memory high-water marks
+  JsonObject format_memory(const Dist::Comm& comm)
+  {
+    MemoryUsage meminfo;
+    unsigned long long loc[2] =
+    {
+      (unsigned long long)meminfo.get_peak_physical(),
+      (unsigned long long)meminfo.get_peak_virtual()
+    };
+    unsigned long long vmax[2], vsum[2];
+    comm.allreduce(loc, vmax, std::size_t(2), Dist::op_max);
+    comm.allreduce(loc, vsum, std::size_t(2), Dist::op_sum);
+
+    JsonObject obj;
+    obj.add_integer("peak_physical_max", vmax[0]);
+    obj.add_integer("peak_physical_sum", vsum[0]);
+    obj.add_integer("peak_virtual_max", vmax[1]);
+    obj.add_integer("peak_virtual_sum", vsum[1]);
+    return obj;
+  }
+
+  /// formats the result of an iterative solver
+  template<typename Solver_>
+  JsonObject format_solver(const Solver_& solver, Solver::Status status)
+  {
+    const Index iters = solver.get_num_iter();
+    const double def_init = double(solver.get_def_initial());
+    const double def_final = double(solver.get_def_final());
+
+    JsonObject obj;
+    obj.add_string("status", stringify(status));
+    obj.add_integer("iterations", iters);
+    obj.add_number("def_initial", def_init);
+    obj.add_number("def_final", def_final);
+    obj.add_number("conv_rate", (iters > 0u) && (def_init > 0.0) ? std::pow(def_final / def_init, 1.0 / double(iters)) : 0.0);
+    return obj;
+  }
+
+  /// collects the process-local multigrid timings of all virtual levels
+  template<typename Hierarchy_>
+  std::vector<double> collect_mg_times(const Hierarchy_& hierarchy)
+  {
+    std::vector<double> t(4u * hierarchy.size_virtual(), 0.0);
+    for(int i(0); i < int(hierarchy.size_physical()); ++i)
+    {
+      t[4u*std::size_t(i) + 0u] = hierarchy.get_time_defect(i);
+      t[4u*std::size_t(i) + 1u] = hierarchy.get_time_smooth(i);
+      t[4u*std::size_t(i) + 2u] = hierarchy.get_time_transfer(i);
+      t[4u*std::size_t(i) + 3u] = hierarchy.get_time_coarse(i);
+    }
+    return t;
+  }
+
+  /// reduces the multigrid timings of all virtual levels
+  std::vector<JsonObject> format_mg_times(const Dist::Comm& comm, const std::vector<double>& tloc)
+  {
+    std::vector<double> tmax(tloc.size(), 0.0);
+    comm.allreduce(tloc.data(), tmax.data(), tloc.size(), Dist::op_max);
+
+    std::vector<JsonObject> levels;
+    for(std::size_t i(0); 4u*i < tmax.size(); ++i)
+    {
+      JsonObject obj;
+      obj.add_integer("index", i);
+      obj.add_number("defect", tmax[4u*i + 0u]);
+      obj.add_number("smooth", tmax[4u*i + 1u]);
+      obj.add_number("transfer", tmax[4u*i + 2u]);
+      obj.add_number("coarse", tmax[4u*i + 3u]);
+      levels.push_back(obj);
+    }
+    return levels;
+  }
+
+  /// formats the chosen levels of a domain control
+  template<typename DomainControl_>
+  std::vector<JsonObject> format_levels(const DomainControl_& domain)
+  {
+    std::vector<JsonObject> levels;
+    for(const auto& lv : domain.get_level_indices())
+    {
+      JsonObject obj;
+      obj.add_integer("level", (unsigned long long)lv.first);
+      obj.add_integer("ranks", (unsigned long long)lv.second);
+      levels.push_back(obj);
+    }
+    return levels;
+  }
+
+  /// sums up a process-local count over all processes
+  unsigned long long sum_count(const Dist::Comm& comm, std::size_t count)
+  {
+    unsigned long long loc(count), sum(0ull);
+    comm.allreduce(&loc, &sum, std::size_t(1), Dist::op_sum);
+    return sum;
+  }
+
+  /// assembles the unit filter on all boundary parts, which are present on a domain level
+  template<typename DomainLevel_>
+  void add_boundary_parts(Assembly::UnitFilterAssembler<MeshType>& unit_asm, const DomainLevel_& dom_level,
+    const std::vector<int>& parts)
+  {
+    for(int k : parts)
+    {
+      auto* mesh_part_node = dom_level.get_mesh_node()->find_mesh_part_node(String("bnd:") + stringify(k));
+      XASSERT(mesh_part_node != nullptr);
+
+      // if the mesh part is nullptr, then our patch is not adjacent to that boundary part
+      auto* mesh_part = mesh_part_node->get_mesh();
+      if(mesh_part != nullptr)
+        unit_asm.add_mesh_part(*mesh_part);
+    }
+  }
+
+  /**
+   * \brief Stokes System Level class with a filtered local matrix for the AmaVanka smoother
+   */
+  class StokesSystemLevel :
+    public Control::StokesBlockedUnitVeloNonePresSystemLevel<2, MemType, DataType, IndexType>
+  {
+  public:
+    typedef Control::StokesBlockedUnitVeloNonePresSystemLevel<2, MemType, DataType, IndexType> BaseClass;
+
+    // the filtered local system matrix for Vanka
+    typename BaseClass::LocalSystemMatrix local_matrix_sys;
+
+    template<typename SpaceV_, typename Cubature_>
+    void assemble_velocity_laplace_matrix(const SpaceV_& space_velo, const Cubature_& cubature, const DataType nu)
+    {
+      Assembly::BurgersAssembler<DataType, IndexType, 2> burgers_mat;
+      burgers_mat.nu = nu;
+      burgers_mat.beta = 0.0;
+      burgers_mat.theta = 0.0;
+
+      auto& loc_a = this->matrix_a.local();
+      loc_a.format();
+
+      // create dummy convection vector
+      auto vec_c = loc_a.create_vector_l();
+      vec_c.format();
+
+      burgers_mat.assemble_matrix(loc_a, vec_c, space_velo, cubature);
+    }
+
+    void compile_local_matrix()
+    {
+      // convert local matrices
+      this->local_matrix_sys.block_a() = this->matrix_a.convert_to_1();
+      this->local_matrix_sys.block_b() = this->matrix_b.local().clone(LAFEM::CloneMode::Weak);
+      this->local_matrix_sys.block_d() = this->matrix_d.local().clone(LAFEM::CloneMode::Weak);
+
+      // apply filter to A and B
+      this->filter_velo.local().filter_mat(this->local_matrix_sys.block_a());
+      this->filter_velo.local().filter_offdiag_row_mat(this->local_matrix_sys.block_b());
+    }
+  }; // class StokesSystemLevel
+
+  /* ******************************************************************************************* */
+  /* ******************************************************************************************* */
+  /* ******************************************************************************************* */
+
+  template<template<typename> class Space_>
+  bool run_poisson(const Dist::Comm& comm, const BenchParams& params, JsonObject& report)
+  {
+    typedef Space_<TrafoType> SpaceType;
+    typedef Control::Domain::SimpleDomainLevel<MeshType, TrafoType, SpaceType> DomainLevelType;
+    typedef Control::Domain::HierarchUnitCubeDomainControl2<DomainLevelType> DomainControlType;
+    typedef Control::ScalarUnitFilterSystemLevel<MemType, DataType, IndexType> SystemLevelType;
+
+    TimeReport times({"partition", "asm_gate", "asm_muxer", "asm_transfer", "asm_symbolic",
+      "asm_matrix", "asm_filter", "asm_rhs", "assembly", "solver_init", "solve"});
+
+    TimeStamp stamp_part;
+    DomainControlType domain(comm, params.levels);
+    times.add("partition", stamp_part.elapsed_now());
+
+    const Index num_levels = Index(domain.size_physical());
+
+    std::deque<std::shared_ptr<SystemLevelType>> system_levels;
+    for(Index i(0); i < num_levels; ++i)
+      system_levels.push_back(std::make_shared<SystemLevelType>());
+
+    Cubature::DynamicFactory cubature("gauss-legendre:" + stringify(SpaceType::local_degree+1));
+
+    TimeStamp stamp_asm;
+
+    for(Index i(0); i < num_levels; ++i)
+    {
+      TimeStamp ts;
+      system_levels.at(i)->assemble_gate(domain.at(i));
+      times.add("asm_gate", ts.elapsed_now());
+      if((i+1) < domain.size_virtual())
+      {
+        ts.stamp();
+        system_levels.at(i)->assemble_coarse_muxer(domain.at(i+1));
+        times.add("asm_muxer", ts.elapsed_now());
+        ts.stamp();
+        system_levels.at(i)->assemble_transfer(domain.at(i), domain.at(i+1), cubature);
+        times.add("asm_transfer", ts.elapsed_now());
+      }
+    }
+
+    for(Index i(0); i < num_levels; ++i)
+    {
+      TimeStamp ts;
+      Assembly::SymbolicAssembler::assemble_matrix_std1(system_levels.at(i)->matrix_sys.local(), domain.at(i)->space);
+      times.add("asm_symbolic", ts.elapsed_now());
+      ts.stamp();
+      system_levels.at(i)->assemble_laplace_matrix(domain.at(i)->space, cubature);
+      times.add("asm_matrix", ts.elapsed_now());
+      ts.stamp();
+      system_levels.at(i)->assemble_homogeneous_unit_filter(*domain.at(i), domain.at(i)->space);
+      system_levels.at(i)->filter_sys.local().filter_mat(system_levels.at(i)->matrix_sys.local());
+      times.add("asm_filter", ts.elapsed_now());
+    }
+
+    typedef typename SystemLevelType::GlobalSystemVector GlobalSystemVector;
+    typedef typename SystemLevelType::GlobalSystemMatrix GlobalSystemMatrix;
+    typedef typename SystemLevelType::GlobalSystemFilter GlobalSystemFilter;
+    typedef typename SystemLevelType::GlobalSystemTransfer GlobalSystemTransfer;
+
+    DomainLevelType& the_domain_level = *domain.front();
+    SystemLevelType& the_system_level = *system_levels.front();
+
+    TimeStamp stamp_rhs;
+    GlobalSystemVector vec_sol = the_system_level.matrix_sys.create_vector_r();
+    GlobalSystemVector vec_rhs = the_system_level.matrix_sys.create_vector_r();
+    vec_sol.format();
+    vec_rhs.format();
+    {
+      Analytic::Common::ExpBubbleFunction<2> sol_func;
+      Assembly::Common::LaplaceFunctional<decltype(sol_func)> force_func(sol_func);
+      Assembly::LinearFunctionalAssembler::assemble_vector(vec_rhs.local(), force_func, the_domain_level.space, cubature);
+      vec_rhs.sync_0();
+    }
+    the_system_level.filter_sys.filter_sol(vec_sol);
+    the_system_level.filter_sys.filter_rhs(vec_rhs);
+    times.add("asm_rhs", stamp_rhs.elapsed_now());
+
+    FEAT::Statistics::toe_assembly = stamp_asm.elapsed_now();
+    times.add("assembly", FEAT::Statistics::toe_assembly);
+
+    // create the multigrid solver
+    auto multigrid_hierarchy = std::make_shared<
+      Solver::MultiGridHierarchy<GlobalSystemMatrix, GlobalSystemFilter, GlobalSystemTransfer>>(domain.size_virtual());
+
+    for(Index i(0); i < num_levels; ++i)
+    {
+      const SystemLevelType& lvl = *system_levels.at(i);
+
+      if((i+1) < domain.size_virtual())
+      {
+        auto jacobi = Solver::new_jacobi_precond(lvl.matrix_sys, lvl.filter_sys, params.smooth_damp);
+        auto smoother = Solver::new_richardson(lvl.matrix_sys, lvl.filter_sys, 1.0, jacobi);
+        smoother->set_min_iter(params.smooth_steps);
+        smoother->set_max_iter(params.smooth_steps);
+        multigrid_hierarchy->push_level(lvl.matrix_sys, lvl.filter_sys, lvl.transfer_sys, smoother, smoother, smoother);
+      }
+      else
+      {
+        auto jacobi = Solver::new_jacobi_precond(lvl.matrix_sys, lvl.filter_sys);
+        auto cgsolver = Solver::new_pcg(lvl.matrix_sys, lvl.filter_sys, jacobi);
+        cgsolver->set_max_iter(1000);
+        cgsolver->set_tol_rel(1E-8);
+        multigrid_hierarchy->push_level(lvl.matrix_sys, lvl.filter_sys, cgsolver);
+      }
+    }
+
+    auto multigrid = Solver::new_multigrid(multigrid_hierarchy, Solver::MultiGridCycle::V);
+    auto solver = Solver::new_richardson(the_system_level.matrix_sys, the_system_level.filter_sys, 1.0, multigrid);
+    solver->set_plot_name("Multigrid");
+    solver->set_max_iter(params.max_iter);
+    solver->set_tol_rel(params.tol_rel);
+
+    TimeStamp stamp_init;
+    multigrid_hierarchy->init();
+    solver->init();
+    times.add("solver_init", stamp_init.elapsed_now());
+
+    FEAT::Statistics::reset();
+
+    TimeStamp stamp_solve;
+    Solver::Status status = Solver::solve(*solver, vec_sol, vec_rhs, the_system_level.matrix_sys, the_system_level.filter_sys);
+    FEAT::Statistics::toe_solve = stamp_solve.elapsed_now();
+    times.add("solve", FEAT::Statistics::toe_solve);
+
+    report.add_string("space", SpaceType::name());
+    report.add_array("levels", format_levels(domain));
+    report.add_integer("dofs", the_system_level.matrix_sys.rows());
+    report.add_integer("elements", sum_count(comm, the_domain_level.get_mesh().get_num_elements()));
+    report.add_integer("nonzeros", sum_count(comm, the_system_level.matrix_sys.local().used_elements()));
+    report.add_object("times", times.reduce(comm));
+    report.add_object("solver", format_solver(*solver, status));
+    report.add_array("multigrid", format_mg_times(comm, collect_mg_times(*multigrid_hierarchy)));
+    report.add_object("statistics", format_statistics(comm));
+
+    solver->done();
+    multigrid_hierarchy->done();
+
+    report.add_object("memory", format_memory(comm));
+
+    comm.print(String("Multigrid: ") + stringify(solver->get_num_iter()) + " iterations, " +
+      stringify_fp_fix(FEAT::Statistics::toe_solve, 3) + " seconds, status " + stringify(status));
+
+    return Solver::status_success(status);
+  }
+
+  /* ******************************************************************************************* */
+  /* ******************************************************************************************* */
+  /* ******************************************************************************************* */
+
+  bool run_stokes(const Dist::Comm& comm, const BenchParams& params, JsonObject& report, bool newton)
+  {
+    typedef Space::Lagrange2::Element<TrafoType> SpaceVeloType;
+    typedef Space::Discontinuous::Element<TrafoType, Space::Discontinuous::Variant::StdPolyP<1>> SpacePresType;
+    typedef Control::Domain::StokesDomainLevel<MeshType, TrafoType, SpaceVeloType, SpacePresType> DomainLevelType;
+    typedef Control::Domain::HierarchUnitCubeDomainControl2<DomainLevelType> DomainControlType;
+    typedef StokesSystemLevel SystemLevelType;
+
+    TimeReport times({"partition", "asm_gates", "asm_muxers", "asm_transfers", "asm_truncations",
+      "asm_symbolic", "asm_matrix", "asm_filter", "assembly", "solver_init", "solve",
+      "newton_defect", "newton_matrix", "newton_init", "newton_solve"});
+
+    TimeStamp stamp_part;
+    DomainControlType domain(comm, params.levels);
+    times.add("partition", stamp_part.elapsed_now());
+
+    const Index num_levels = Index(domain.size_physical());
+
+    std::deque<std::shared_ptr<SystemLevelType>> system_levels;
+    for(Index i(0); i < num_levels; ++i)
+      system_levels.push_back(std::make_shared<SystemLevelType>());
+
+    Cubature::DynamicFactory cubature("gauss-legendre:3");
+
+    TimeStamp stamp_asm;
+
+    for(Index i(0); i < num_levels; ++i)
+    {
+      TimeStamp ts;
+      system_levels.at(i)->assemble_gates(domain.at(i));
+      times.add("asm_gates", ts.elapsed_now());
+      if((i+1) < domain.size_virtual())
+      {
+        ts.stamp();
+        system_levels.at(i)->assemble_coarse_muxers(domain.at(i+1));
+        times.add("asm_muxers", ts.elapsed_now());
+        ts.stamp();
+        system_levels.at(i)->assemble_transfers(domain.at(i), domain.at(i+1), cubature);
+        times.add("asm_transfers", ts.elapsed_now());
+      }
+    }
+
+    // the velocity truncation is required to restrict the convection vector for the Burgers matrices
+    if(newton)
+    {
+      for(Index i(0); i < num_levels; ++i)
+      {
+        TimeStamp ts;
+        if(i+1 < num_levels)
+          system_levels.at(i)->assemble_velocity_truncation(domain.at(i), domain.at(i+1), cubature, system_levels.at(i+1).get());
+        else if(i+1 < domain.size_virtual())
+          system_levels.at(i)->assemble_velocity_truncation(domain.at(i), domain.at(i+1), cubature);
+        times.add("asm_truncations", ts.elapsed_now());
+      }
+    }
+
+    for(Index i(0); i < num_levels; ++i)
+    {
+      TimeStamp ts;
+      system_levels.at(i)->assemble_velo_struct(domain.at(i)->space_velo);
+      system_levels.at(i)->assemble_pres_struct(domain.at(i)->space_pres);
+      times.add("asm_symbolic", ts.elapsed_now());
+      ts.stamp();
+      system_levels.at(i)->assemble_velocity_laplace_matrix(domain.at(i)->space_velo, cubature, params.nu);
+      system_levels.at(i)->assemble_grad_div_matrices(domain.at(i)->space_velo, domain.at(i)->space_pres, cubature);
+      system_levels.at(i)->compile_system_matrix();
+      times.add("asm_matrix", ts.elapsed_now());
+    }
+
+    // bent channel flow: parabolic inflow on the left, no-flow on the bottom, outflow on the top and right;
+    // note that a straight channel would not do here, because the Poiseuille flow also solves the Burgers equation
+    Analytic::Common::ParProfileVector inflow_func(0.0, 0.0, 0.0, 1.0, 1.0);
+    for(Index i(0); i < num_levels; ++i)
+    {
+      TimeStamp ts;
+      Assembly::UnitFilterAssembler<MeshType> unit_asm_inflow, unit_asm_noflow;
+      add_boundary_parts(unit_asm_inflow, *domain.at(i), {2});
+      add_boundary_parts(unit_asm_noflow, *domain.at(i), {0});
+      unit_asm_inflow.assemble(system_levels.at(i)->filter_velo.local(), domain.at(i)->space_velo, inflow_func);
+      unit_asm_noflow.assemble(system_levels.at(i)->filter_velo.local(), domain.at(i)->space_velo);
+      system_levels.at(i)->compile_system_filter();
+      system_levels.at(i)->compile_local_matrix();
+      times.add("asm_filter", ts.elapsed_now());
+    }
+
+    FEAT::Statistics::toe_assembly = stamp_asm.elapsed_now();
+    times.add("assembly", FEAT::Statistics::toe_assembly);
+
+    typedef typename SystemLevelType::GlobalSystemVector GlobalSystemVector;
+    typedef typename SystemLevelType::GlobalSystemMatrix GlobalSystemMatrix;
+    typedef typename SystemLevelType::GlobalSystemFilter GlobalSystemFilter;
+    typedef typename SystemLevelType::GlobalSystemTransfer GlobalSystemTransfer;
+
+    DomainLevelType& the_domain_level = *domain.front();
+    SystemLevelType& the_system_level = *system_levels.front();
+    GlobalSystemMatrix& matrix = the_system_level.matrix_sys;
+    GlobalSystemFilter& filter = the_system_level.filter_sys;
+
+    GlobalSystemVector vec_sol = matrix.create_vector_r();
+    GlobalSystemVector vec_def = matrix.create_vector_r();
+    GlobalSystemVector vec_cor = matrix.create_vector_r();
+    vec_sol.format();
+    vec_def.format();
+    filter.filter_sol(vec_sol);
+    filter.filter_rhs(vec_def);
+
+    // count the global DOFs
+    unsigned long long num_dofs(0ull);
+    {
+      auto tv = the_system_level.gate_velo._freqs.clone(LAFEM::CloneMode::Deep);
+      tv.format(1.0);
+      const Index velo_dofs = Index(the_system_level.gate_velo.dot(tv, tv));
+      const Index locp_dofs = the_system_level.gate_pres._freqs.size();
+      const Index pres_dofs = Index(the_system_level.gate_pres.sum(DataType(locp_dofs)));
+      num_dofs = velo_dofs + pres_dofs;
+    }
+
+    // create the multigrid solver
+    auto multigrid_hierarchy = std::make_shared<
+      Solver::MultiGridHierarchy<GlobalSystemMatrix, GlobalSystemFilter, GlobalSystemTransfer>>(domain.size_virtual());
+
+    for(std::size_t i(0); i < system_levels.size(); ++i)
+    {
+      SystemLevelType& lvl = *system_levels.at(i);
+
+      auto vanka = Solver::new_amavanka(lvl.local_matrix_sys, lvl.filter_sys.local());
+      auto schwarz = Solver::new_schwarz_precond(vanka, lvl.filter_sys);
+
+      if((i+1) < domain.size_virtual())
+      {
+        auto smoother = Solver::new_richardson(lvl.matrix_sys, lvl.filter_sys, params.smooth_damp, schwarz);
+        smoother->set_min_iter(params.smooth_steps);
+        smoother->set_max_iter(params.smooth_steps);
+        smoother->skip_defect_calc(true);
+        multigrid_hierarchy->push_level(lvl.matrix_sys, lvl.filter_sys, lvl.transfer_sys, smoother, smoother, smoother);
+      }
+      else
+      {
+        auto cgsolver = Solver::new_fgmres(lvl.matrix_sys, lvl.filter_sys, 50, 0.0, schwarz);
+        cgsolver->set_max_iter(1000);
+        cgsolver->set_tol_rel(1E-3);
+        multigrid_hierarchy->push_level(lvl.matrix_sys, lvl.filter_sys, cgsolver);
+      }
+    }
+
+    auto multigrid = Solver::new_multigrid(multigrid_hierarchy, Solver::MultiGridCycle::V);
+    auto solver = Solver::new_richardson(matrix, filter, 1.0, multigrid);
+    solver->set_plot_name("Multigrid");
+    solver->set_max_iter(params.max_iter);
+    solver->set_tol_rel(params.tol_rel);
+
+    TimeStamp stamp_init;
+    multigrid_hierarchy->init();
+    solver->init();
+    times.add("solver_init", stamp_init.elapsed_now());
+
+    FEAT::Statistics::reset();
+
+    TimeStamp stamp_solve;
+    Solver::Status status = Solver::solve(*solver, vec_sol, vec_def, matrix, filter);
+    const double toe_stokes = stamp_solve.elapsed_now();
+    times.add("solve", toe_stokes);
+
+    JsonObject stokes_solver = format_solver(*solver, status);
+    std::vector<double> mg_times = collect_mg_times(*multigrid_hierarchy);
+    bool success = Solver::status_success(status);
+
+    comm.print(String("Stokes Multigrid: ") + stringify(solver->get_num_iter()) + " iterations, " +
+      stringify_fp_fix(toe_stokes, 3) + " seconds, status " + stringify(status));
+
+    solver->done_numeric();
+    multigrid_hierarchy->done_numeric();
+
+    if(newton && success)
+    {
+      // setup burgers assembler for the Newton matrix
+      Assembly::BurgersAssembler<DataType, IndexType, 2> burgers_mat;
+      burgers_mat.nu = params.nu;
+      burgers_mat.beta = DataType(1);
+      burgers_mat.frechet_beta = DataType(1);
+
+      // setup burgers assembler for the defect vector
+      Assembly::BurgersAssembler<DataType, IndexType, 2> burgers_def;
+      burgers_def.nu = params.nu;
+      burgers_def.beta = DataType(1);
+
+      // assembles the non-linear defect vector and returns its norm
+      auto assemble_defect = [&]() -> DataType
+      {
+        TimeStamp ts;
+        vec_def.format();
+        burgers_def.assemble_vector(vec_def.local().template at<0>(), vec_sol.local().template at<0>(),
+          vec_sol.local().template at<0>(), the_domain_level.space_velo, cubature, -1.0);
+        matrix.local().block_b().apply(
+          vec_def.local().template at<0>(), vec_sol.local().template at<1>(), vec_def.local().template at<0>(), -1.0);
+        matrix.local().block_d().apply(
+          vec_def.local().template at<1>(), vec_sol.local().template at<0>(), vec_def.local().template at<1>(), -1.0);
+        vec_def.sync_0();
+        filter.filter_def(vec_def);
+        times.add("newton_defect", ts.elapsed_now());
+        return vec_def.norm2();
+      };
+
+      const DataType def_nl_init = assemble_defect();
+
+      // assemble burgers matrices on all levels
+      TimeStamp stamp_mat;
+      {
+        typename SystemLevelType::GlobalVeloVector vec_conv(
+          &the_system_level.gate_velo, vec_sol.local().template at<0>().clone());
+
+        for(std::size_t i(0); i < system_levels.size(); ++i)
+        {
+          auto& loc_mat_a = system_levels.at(i)->matrix_sys.local().block_a();
+          loc_mat_a.format();
+          burgers_mat.assemble_matrix(loc_mat_a, vec_conv.local(), domain.at(i)->space_velo, cubature);
+          system_levels.at(i)->compile_local_matrix();
+
+          if((i+1) >= domain.size_virtual())
+            break;
+
+          if((i+1) < system_levels.size())
+          {
+            auto vec_crs = system_levels.at(i+1)->matrix_a.create_vector_l();
+            system_levels.at(i)->transfer_velo.trunc(vec_conv, vec_crs);
+            vec_conv = std::move(vec_crs);
+          }
+          else
+          {
+            // this process is a child, so send truncation to parent
+            system_levels.at(i)->transfer_velo.trunc_send(vec_conv);
+          }
+        }
+      }
+      times.add("newton_matrix", stamp_mat.elapsed_now());
+
+      TimeStamp stamp_ninit;
+      multigrid_hierarchy->init_numeric();
+      solver->init_numeric();
+      times.add("newton_init", stamp_ninit.elapsed_now());
+
+      // measure the statistics and multigrid timings of the Newton step only
+      FEAT::Statistics::reset();
+      const std::vector<double> mg_times_stokes = collect_mg_times(*multigrid_hierarchy);
+
+      TimeStamp stamp_nsolve;
+      status = solver->apply(vec_cor, vec_def);
+      FEAT::Statistics::toe_solve = stamp_nsolve.elapsed_now();
+      times.add("newton_solve", FEAT::Statistics::toe_solve);
+
+      mg_times = collect_mg_times(*multigrid_hierarchy);
+      for(std::size_t k(0); k < mg_times.size(); ++k)
+        mg_times[k] -= mg_times_stokes[k];
+
+      success = Solver::status_success(status);
+      report.add_object("solver", format_solver(*solver, status));
+      report.add_object("stokes_solver", stokes_solver);
+
+      solver->done_numeric();
+      multigrid_hierarchy->done_numeric();
+
+      // update solution and compute the new non-linear defect
+      vec_sol.axpy(vec_cor, vec_sol, 1.0);
+      const DataType def_nl_final = assemble_defect();
+
+      JsonObject nonlin;
+      nonlin.add_number("def_initial", def_nl_init);
+      nonlin.add_number("def_final", def_nl_final);
+      report.add_object("newton", nonlin);
+
+      comm.print(String("Newton Multigrid: ") + stringify(solver->get_num_iter()) + " iterations, " +
+        stringify_fp_fix(FEAT::Statistics::toe_solve, 3) + " seconds, status " + stringify(status) +
+        ", non-linear defect " + stringify_fp_sci(def_nl_init, 3) + " -> " + stringify_fp_sci(def_nl_final, 3));
+    }
+    else
+    {
+      FEAT::Statistics::toe_solve = toe_stokes;
+      report.add_object("solver", stokes_solver);
+    }
+
+    solver->done_symbolic();
+    multigrid_hierarchy->done_symbolic();
+
+    report.add_string("space", SpaceVeloType::name() + "/" + SpacePresType::name());
+    report.add_array("levels", format_levels(domain));
+    report.add_integer("dofs", num_dofs);
+    report.add_integer("elements", sum_count(comm, the_domain_level.get_mesh().get_num_elements()));
+    report.add_integer("nonzeros", sum_count(comm, matrix.local().template used_elements<LAFEM::Perspective::pod>()));
+    report.add_object("times", times.reduce(comm));
+    report.add_array("multigrid", format_mg_times(comm, mg_times));
+    report.add_object("statistics", format_statistics(comm));
+    report.add_object("memory", format_memory(comm));
+
+    return success;
+  }
+
+  /* ******************************************************************************************* */
+  /* ******************************************************************************************* */
+  /* ******************************************************************************************* */
+
+  bool run_amg(const Dist::Comm& comm, const BenchParams& params, JsonObject& report)
+  {
+    typedef Space::Lagrange1::Element<TrafoType> SpaceType;
+    typedef Control::Domain::SimpleDomainLevel<MeshType, TrafoType, SpaceType> DomainLevelType;
+    typedef Control::Domain::HierarchUnitCubeDomainControl2<DomainLevelType> DomainControlType;
+
+    typedef LAFEM::SparseMatrixCSR<MemType, DataType, IndexType> MatrixType;
+    typedef LAFEM::DenseVector<MemType, DataType, IndexType> VectorType;
+    typedef LAFEM::UnitFilter<MemType, DataType, IndexType> FilterType;
+    typedef LAFEM::Transfer<MatrixType> TransferType;
+    typedef Solver::AMGFactory<MatrixType, FilterType, TransferType> AMGFactoryType;
+
+    // an algebraic level; the transfer operator maps between this level and the next coarser one
+    struct AMGLevel
+    {
+      MatrixType matrix;
+      FilterType filter;
+      TransferType transfer;
+    };
+
+    TimeReport times({"partition", "assembly", "amg_coarsening", "amg_update", "solver_init", "solve"});
+
+    TimeStamp stamp_part;
+    DomainControlType domain(comm, params.levels);
+    times.add("partition", stamp_part.elapsed_now());
+
+    // assemble the process-local Poisson system on the finest level
+    std::deque<std::shared_ptr<AMGLevel>> levels;
+    levels.push_back(std::make_shared<AMGLevel>());
+
+    DomainLevelType& the_domain_level = *domain.front();
+    Cubature::DynamicFactory cubature("gauss-legendre:2");
+
+    TimeStamp stamp_asm;
+    {
+      AMGLevel& lvl = *levels.front();
+      Assembly::SymbolicAssembler::assemble_matrix_std1(lvl.matrix, the_domain_level.space);
+      lvl.matrix.format();
+      Assembly::Common::LaplaceOperator laplace_op;
+      Assembly::BilinearOperatorAssembler::assemble_matrix1(lvl.matrix, laplace_op, the_domain_level.space, cubature);
+
+      Assembly::UnitFilterAssembler<MeshType> unit_asm;
+      add_boundary_parts(unit_asm, the_domain_level, {0, 1, 2, 3});
+      unit_asm.assemble(lvl.filter, the_domain_level.space);
+      lvl.filter.filter_mat(lvl.matrix);
+    }
+    FEAT::Statistics::toe_assembly = stamp_asm.elapsed_now();
+    times.add("assembly", FEAT::Statistics::toe_assembly);
+
+    // create the AMG hierarchy
+    Dist::Comm comm_self = Dist::Comm::self();
+    TimeStamp stamp_crs;
+    while((levels.back()->matrix.rows() > params.amg_coarse) && (levels.size() < std::size_t(25)))
+    {
+      auto coarse = std::make_shared<AMGLevel>();
+      AMGFactoryType::new_coarse_level(levels.back()->matrix, levels.back()->filter, 0.8,
+        coarse->matrix, coarse->filter, levels.back()->transfer, &comm_self);
+      // stop if the coarsening stagnates
+      const bool stagnates = (coarse->matrix.rows() >= levels.back()->matrix.rows()) || (coarse->matrix.rows() == Index(0));
+      if(stagnates)
+      {
+        levels.back()->transfer = TransferType();
+        break;
+      }
+      levels.push_back(coarse);
+    }
+    times.add("amg_coarsening", stamp_crs.elapsed_now());
+
+    // update the numerical values of all coarse levels, as it is done for a new fine level matrix
+    TimeStamp stamp_upd;
+    for(std::size_t i(0); (i+1) < levels.size(); ++i)
+      AMGFactoryType::update_coarse_level(levels.at(i)->matrix, levels.at(i)->transfer, levels.at(i+1)->matrix);
+    times.add("amg_update", stamp_upd.elapsed_now());
+
+    // create the local AMG solver
+    auto multigrid_hierarchy = std::make_shared<
+      Solver::MultiGridHierarchy<MatrixType, FilterType, TransferType>>(levels.size());
+
+    for(std::size_t i(0); i < levels.size(); ++i)
+    {
+      AMGLevel& lvl = *levels.at(i);
+      if((i+1) < levels.size())
+      {
+        auto jacobi = Solver::new_jacobi_precond(lvl.matrix, lvl.filter, params.smooth_damp);
+        auto smoother = Solver::new_richardson(lvl.matrix, lvl.filter, 1.0, jacobi);
+        smoother->set_min_iter(params.smooth_steps);
+        smoother->set_max_iter(params.smooth_steps);
+        multigrid_hierarchy->push_level(lvl.matrix, lvl.filter, lvl.transfer, smoother, smoother, smoother);
+      }
+      else
+      {
+        auto cgsolver = Solver::new_pcg(lvl.matrix, lvl.filter);
+        cgsolver->set_max_iter(1000);
+        cgsolver->set_tol_rel(1E-8);
+        multigrid_hierarchy->push_level(lvl.matrix, lvl.filter, cgsolver);
+      }
+    }
+
+    AMGLevel& fine = *levels.front();
+    auto multigrid = Solver::new_multigrid(multigrid_hierarchy, Solver::MultiGridCycle::V);
+    auto solver = Solver::new_richardson(fine.matrix, fine.filter, 1.0, multigrid);
+    solver->set_plot_name("AMG");
+    solver->set_max_iter(params.max_iter);
+    solver->set_tol_rel(params.tol_rel);
+
+    TimeStamp stamp_init;
+    multigrid_hierarchy->init();
+    solver->init();
+    times.add("solver_init", stamp_init.elapsed_now());
+
+    // solve for a constant right hand side
+    VectorType vec_sol(fine.matrix.create_vector_r());
+    VectorType vec_rhs(fine.matrix.create_vector_r());
+    vec_sol.format();
+    vec_rhs.format(1.0);
+    fine.filter.filter_sol(vec_sol);
+    fine.filter.filter_rhs(vec_rhs);
+
+    FEAT::Statistics::reset();
+
+    TimeStamp stamp_solve;
+    Solver::Status status = Solver::solve(*solver, vec_sol, vec_rhs, fine.matrix, fine.filter);
+    FEAT::Statistics::toe_solve = stamp_solve.elapsed_now();
+    times.add("solve", FEAT::Statistics::toe_solve);
+
+    // the level sizes are reported as maximum over all processes
+    std::vector<JsonObject> amg_levels;
+    {
+      unsigned long long nlev_loc(levels.size()), nlev_max(0ull);
+      comm.allreduce(&nlev_loc, &nlev_max, std::size_t(1), Dist::op_max);
+      std::vector<unsigned long long> loc(2u*nlev_max, 0ull), vmax(2u*nlev_max, 0ull);
+      for(std::size_t i(0); i < levels.size(); ++i)
+      {
+        loc[2u*i + 0u] = levels.at(i)->matrix.rows();
+        loc[2u*i + 1u] = levels.at(i)->matrix.used_elements();
+      }
+      comm.allreduce(loc.data(), vmax.data(), loc.size(), Dist::op_max);
+      for(std::size_t i(0); i < std::size_t(nlev_max); ++i)
+      {
+        JsonObject obj;
+        obj.add_integer("index", i);
+        obj.add_integer("rows", vmax[2u*i + 0u]);
+        obj.add_integer("nonzeros", vmax[2u*i + 1u]);
+        amg_levels.push_back(obj);
+      }
+    }
+
+    report.add_string("space", SpaceType::name());
+    report.add_string("scope", "process-local");
+    report.add_array("levels", format_levels(domain));
+    report.add_integer("dofs", sum_count(comm, fine.matrix.rows()));
+    report.add_integer("elements", sum_count(comm, the_domain_level.get_mesh().get_num_elements()));
+    report.add_integer("nonzeros", sum_count(comm, fine.matrix.used_elements()));
+    report.add_array("amg_levels", amg_levels);
+    report.add_object("times", times.reduce(comm));
+    report.add_object("solver", format_solver(*solver, status));
+    report.add_array("multigrid", format_mg_times(comm, collect_mg_times(*multigrid_hierarchy)));
+    report.add_object("statistics", format_statistics(comm));
+
+    solver->done();
+    multigrid_hierarchy->done();
+
+    report.add_object("memory", format_memory(comm));
+
+    // all processes must agree on success
+    int ok_loc(Solver::status_success(status) ? 1 : 0), ok_min(0);
+    comm.allreduce(&ok_loc, &ok_min, std::size_t(1), Dist::op_min);
+
+    comm.print(String("AMG: ") + stringify(levels.size()) + " levels, " + stringify(solver->get_num_iter()) +
+      " iterations, " + stringify_fp_fix(FEAT::Statistics::toe_solve, 3) + " seconds, status " + stringify(status));
+
+    return ok_min > 0;
+  }
+
+  /* ******************************************************************************************* */
+  /* ******************************************************************************************* */
+  /* ******************************************************************************************* */
+
+  bool run_assembly(const Dist::Comm& comm, const BenchParams& params, JsonObject& report)
+  {
+    typedef Space::Lagrange2::Element<TrafoType> SpaceVeloType;
+    typedef Space::Discontinuous::Element<TrafoType, Space::Discontinuous::Variant::StdPolyP<1>> SpacePresType;
+    typedef Control::Domain::StokesDomainLevel<MeshType, TrafoType, SpaceVeloType, SpacePresType> DomainLevelType;
+    typedef Control::Domain::HierarchUnitCubeDomainControl2<DomainLevelType> DomainControlType;
+    typedef StokesSystemLevel SystemLevelType;
+
+    const std::vector<String> phases = {"symbolic_velo", "symbolic_pres", "burgers_matrix", "grad_div", "burgers_vector"};
+
+    TimeReport times({"partition", "symbolic_velo", "symbolic_pres", "burgers_matrix", "grad_div", "burgers_vector", "total"});
+
+    TimeStamp stamp_part;
+    DomainControlType domain(comm, params.levels);
+    times.add("partition", stamp_part.elapsed_now());
+
+    const std::size_t num_levels = domain.size_physical();
+    const std::size_t num_virt = domain.size_virtual();
+
+    std::deque<std::shared_ptr<SystemLevelType>> system_levels;
+    for(std::size_t i(0); i < num_levels; ++i)
+      system_levels.push_back(std::make_shared<SystemLevelType>());
+
+    Cubature::DynamicFactory cubature("gauss-legendre:3");
+
+    Assembly::BurgersAssembler<DataType, IndexType, 2> burgers;
+    burgers.nu = params.nu;
+    burgers.beta = DataType(1);
+    burgers.frechet_beta = DataType(1);
+
+    // process-local timings per level and phase
+    std::vector<double> level_times(num_virt * phases.size(), 0.0);
+
+    TimeStamp stamp_total;
+    for(Index rep(0); rep < params.asm_repeat; ++rep)
+    {
+      for(std::size_t i(0); i < num_levels; ++i)
+      {
+        SystemLevelType& lvl = *system_levels.at(i);
+        const DomainLevelType& dom_lvl = *domain.at(i);
+        double* lt = &level_times[i * phases.size()];
+
+        TimeStamp ts;
+        lvl.matrix_a.local().clear();
+        lvl.assemble_velo_struct(dom_lvl.space_velo);
+        lt[0] += ts.elapsed_now();
+
+        ts.stamp();
+        lvl.matrix_s.local().clear();
+        lvl.assemble_pres_struct(dom_lvl.space_pres);
+        lt[1] += ts.elapsed_now();
+
+        // use a constant convection field
+        auto vec_conv = lvl.matrix_a.local().create_vector_l();
+        vec_conv.format(1.0);
+
+        ts.stamp();
+        lvl.matrix_a.local().format();
+        burgers.assemble_matrix(lvl.matrix_a.local(), vec_conv, dom_lvl.space_velo, cubature);
+        lt[2] += ts.elapsed_now();
+
+        ts.stamp();
+        lvl.assemble_grad_div_matrices(dom_lvl.space_velo, dom_lvl.space_pres, cubature);
+        lt[3] += ts.elapsed_now();
+
+        ts.stamp();
+        auto vec_def = lvl.matrix_a.local().create_vector_l();
+        vec_def.format();
+        burgers.assemble_vector(vec_def, vec_conv, vec_conv, dom_lvl.space_velo, cubature, -1.0);
+        lt[4] += ts.elapsed_now();
+      }
+    }
+    times.add("total", stamp_total.elapsed_now());
+
+    for(std::size_t j(0); j < phases.size(); ++j)
+    {
+      double t(0.0);
+      for(std::size_t i(0); i < num_virt; ++i)
+        t += level_times[i * phases.size() + j];
+      times.add(phases.at(j), t);
+    }
+
+    std::vector<double> tmax(level_times.size(), 0.0);
+    comm.allreduce(level_times.data(), tmax.data(), level_times.size(), Dist::op_max);
+    std::vector<JsonObject> asm_levels;
+    for(std::size_t i(0); i < num_virt; ++i)
+    {
+      JsonObject obj;
+      obj.add_integer("index", i);
+      for(std::size_t j(0); j < phases.size(); ++j)
+        obj.add_number(phases.at(j), tmax[i * phases.size() + j]);
+      asm_levels.push_back(obj);
+    }
+
+    FEAT::Statistics::toe_assembly = stamp_total.elapsed_now();
+
+    report.add_string("space", SpaceVeloType::name() + "/" + SpacePresType::name());
+    report.add_array("levels", format_levels(domain));
+    report.add_integer("repetitions", params.asm_repeat);
+    report.add_integer("elements", sum_count(comm, domain.front()->get_mesh().get_num_elements()));
+    report.add_integer("nonzeros", sum_count(comm, system_levels.front()->matrix_a.local().template used_elements<LAFEM::Perspective::pod>()));
+    report.add_object("times", times.reduce(comm));
+    report.add_array("assembly_levels", asm_levels);
+    report.add_object("memory", format_memory(comm));
+
+    comm.print(String("Assembly: ") + stringify_fp_fix(FEAT::Statistics::toe_assembly, 3) + " seconds for " +
+      stringify(params.asm_repeat) + " repetition(s)");
+
+    return true;
+  }
+
+  /* ******************************************************************************************* */
+  /* ******************************************************************************************* */
+  /* ******************************************************************************************* */
+
+  void main(int argc, char* argv[])
+  {
+    // create world communicator
+    Dist::Comm comm(Dist::Comm::world());
+
+    // create arg parser
+    SimpleArgParser args(argc, argv);
+
+    args.support("level", "<levels...>\nSpecifies the refinement levels and layers; defaults to '4 0'.");
+    args.support("scenarios", "<names...>\nSpecifies the scenarios to run; defaults to all scenarios:\n"
+      "poisson-q1-mg poisson-q2-mg stokes-q2p1dc burgers-newton amg-setup assembly");
+    args.support("json", "<filename>\nSpecifies the filename of the JSON report.");
+    args.support("max-iter", "<n>\nSpecifies the maximum number of multigrid iterations.");
+    args.support("tol", "<eps>\nSpecifies the relative tolerance of the linear solvers.");
+    args.support("smooth-steps", "<n>\nSpecifies the number of smoothing steps.");
+    args.support("smooth-damp", "<d>\nSpecifies the damping parameter of the smoothers.");
+    args.support("nu", "<nu>\nSpecifies the viscosity for the Stokes and Burgers scenarios.");
+    args.support("asm-repeat", "<n>\nSpecifies the number of repetitions of the assembly scenario.");
+    args.support("amg-coarse", "<n>\nSpecifies the maximum number of DOFs on the coarsest AMG level.");
+    args.support("test-mode", "\nRuns the application in test mode.");
+
+    // check for unsupported options
+    auto unsupported = args.query_unsupported();
+    if (!unsupported.empty())
+    {
+      // print all unsupported options to cerr
+      for (auto it = unsupported.begin(); it != unsupported.end(); ++it)
+        comm.print(std::cerr, "ERROR: unknown option '--" + (*it).second + "'");
+
+      comm.print(std::cerr, "Supported Options are:");
+      comm.print(std::cerr, args.get_supported_help());
+
+      // abort
+      FEAT::Runtime::abort();
+    }
+
+    BenchParams params;
+    args.parse("max-iter", params.max_iter);
+    args.parse("tol", params.tol_rel);
+    args.parse("smooth-steps", params.smooth_steps);
+    args.parse("smooth-damp", params.smooth_damp);
+    args.parse("nu", params.nu);
+    args.parse("asm-repeat", params.asm_repeat);
+    args.parse("amg-coarse", params.amg_coarse);
+    if(args.check("level") > 0)
+      params.levels = args.query("level")->second;
+    else
+    {
+      params.levels.push_back("4");
+      params.levels.push_back("0");
+    }
+
+    const bool testmode = (args.check("test-mode") >= 0);
+
+    std::deque<String> scenarios;
+    if(args.check("scenarios") > 0)
+      scenarios = args.query("scenarios")->second;
+    else
+      scenarios = {"poisson-q1-mg", "poisson-q2-mg", "stokes-q2p1dc", "burgers-newton", "amg-setup", "assembly"};
+
+    // dump system call
+    String sargs;
+    for(int i(1); i < argc; ++i)
+      sargs.append(i > 1 ? " " : "").append(argv[i]);
+
+    comm.print("Arguments: " + sargs);
+    comm.print("Number of Processes: " + stringify(comm.size()));
+
+    TimeStamp stamp_total;
+    bool all_passed = true;
+    std::vector<JsonObject> reports;
+
+    for(const auto& name : scenarios)
+    {
+      comm.print("\nRunning scenario '" + name + "'...");
+
+      JsonObject report;
+      report.add_string("name", name);
+
+      bool passed = false;
+      if(name == "poisson-q1-mg")
+        passed = run_poisson<Space::Lagrange1::Element>(comm, params, report);
+      else if(name == "poisson-q2-mg")
+        passed = run_poisson<Space::Lagrange2::Element>(comm, params, report);
+      else if(name == "stokes-q2p1dc")
+        passed = run_stokes(comm, params, report, false);
+      else if(name == "burgers-newton")
+        passed = run_stokes(comm, params, report, true);
+      else if(name == "amg-setup")
+        passed = run_amg(comm, params, report);
+      else if(name == "assembly")
+        passed = run_assembly(comm, params, report);
+      else
+      {
+        comm.print(std::cerr, "ERROR: unknown scenario '" + name + "'");
+        FEAT::Runtime::abort();
+      }
+
+      report.add_bool("passed", passed);
+      reports.push_back(report);
+      all_passed = all_passed && passed;
+    }
+
+    // write JSON report
+    String json_name;
+    if((args.parse("json", json_name) > 0) && (comm.rank() == 0))
+    {
+      JsonObject root;
+      root.add_string("application", "solver_bench_suite");
+      root.add_string("git_sha1", FEAT_GIT_SHA1);
+      root.add_string("build_id", BUILD_ID);
+      root.add_string("arguments", sargs);
+      root.add_integer("ranks", (unsigned long long)comm.size());
+      root.add_number("total_time", stamp_total.elapsed_now());
+      root.add_array("scenarios", reports);
+
+      std::ofstream ofs(json_name.c_str());
+      if(!ofs.is_open())
+      {
+        comm.print(std::cerr, "ERROR: failed to open '" + json_name + "'");
+        FEAT::Runtime::abort();
+      }
+      ofs << root.format() << "\n";
+      ofs.close();
+      comm.print("\nJSON report written to '" + json_name + "'");
+    }
+
+    comm.print("\nRun-Time: " + stamp_total.elapsed_string_now(TimeFormat::s_m));
+
+    if(testmode)
+      comm.print(String("\nTest-Mode: ") + (all_passed ? "PASSED" : "FAILED"));
+  }
+} // namespace SolverBenchSuite
+
+int main(int argc, char* argv [])
+{
+  FEAT::Runtime::initialise(argc, argv);
+  try
+  {
+    SolverBenchSuite::main(argc, argv);
+  }
+  catch (const std::exception& exc)
+  {
+    std::cerr << "ERROR: unhandled exception: " << exc.what() << std::endl;
+    FEAT::Runtime::abort();
+  }
+  catch (...)
+  {
+    std::cerr << "ERROR: unknown exception" << std::endl;
+    FEAT::Runtime::abort();
+  }
+  return FEAT::Runtime::finalise();
+}
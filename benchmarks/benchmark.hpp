@@ -10,8 +10,10 @@
 #include <kernel/base_header.hpp>
 #include <kernel/util/time_stamp.hpp>
 #include <kernel/util/memory_pool.hpp>
+#include <kernel/util/math.hpp>
 
 #include <functional>
+#include <vector>
 
 namespace FEAT
 {
@@ -80,6 +82,93 @@ namespace FEAT
       std::cout<<"GByte/s: "<<bytes<<std::endl;
       std::cout<<"=============================================="<<std::endl;
     }
+
+    /// result of a single benchmark measurement
+    struct BenchResult
+    {
+      /// average runtime of a single function call in seconds
+      double time;
+      /// number of function calls per run
+      Index iters;
+      /// achieved flop rate in GFlop/s
+      double gflops;
+      /// achieved bandwidth in GB/s (10^9 bytes per second, as used by STREAM)
+      double gbytes;
+    };
+
+    /**
+     * Measures a given benchmark without any output
+     *
+     * In contrast to run_bench(), the number of function calls per run is chosen such that each
+     * run takes at least \p min_time seconds and the fastest run is used, which is the usual
+     * convention for bandwidth measurements.
+     *
+     * \param[in] func The function to evaluate (best given as lambda).
+     * \param[in] flops The flop count of a single function call.
+     * \param[in] bytes The amount of bytes moved by a single function call.
+     * \param[in] min_time The minimum runtime of a single run in seconds.
+     * \param[in] runs The number of runs.
+     *
+     * \returns The measurement result.
+     **/
+    template <typename Mem_>
+    BenchResult measure_bench(std::function<void (void)> func, double flops, double bytes, double min_time = 0.05, Index runs = 5)
+    {
+      //warmup
+      func();
+      MemoryPool<Mem_>::synchronise();
+
+      TimeStamp at;
+      func();
+      MemoryPool<Mem_>::synchronise();
+      const double test_run_time(at.elapsed_now());
+      Index iters(1);
+      if (test_run_time < min_time)
+        iters = Index(min_time / Math::max(test_run_time, 1E-9)) + 1;
+
+      double best(0.0);
+      for (Index i(0) ; i < runs ; ++i)
+      {
+        at.stamp();
+        for (Index j(0) ; j < iters ; ++j)
+        {
+          func();
+        }
+        MemoryPool<Mem_>::synchronise();
+        const double t(at.elapsed_now() / double(iters));
+        if ((i == 0) || (t < best))
+          best = t;
+      }
+
+      BenchResult result;
+      result.time = best;
+      result.iters = iters;
+      result.gflops = (best > 0.0 ? 1E-9 * flops / best : 0.0);
+      result.gbytes = (best > 0.0 ? 1E-9 * bytes / best : 0.0);
+      return result;
+    }
+
+    /**
+     * Measures the main memory bandwidth by the STREAM triad kernel a = b + s*c
+     *
+     * \param[in] size The length of the three arrays; should be large enough to exceed all caches.
+     *
+     * \returns The measured bandwidth in GB/s, counting 3 * size * sizeof(double) bytes per triad.
+     **/
+    inline double stream_triad(Index size = Index(1) << 23)
+    {
+      std::vector<double> a(size, 0.0), b(size, 1.0), c(size, 2.0);
+      double* pa = a.data();
+      const double* pb = b.data();
+      const double* pc = c.data();
+      const double s(3.0);
+      auto func = [&] ()
+      {
+        for (Index i(0) ; i < size ; ++i)
+          pa[i] = pb[i] + s * pc[i];
+      };
+      return measure_bench<Mem::Main>(func, 2.0 * double(size), 3.0 * double(size) * sizeof(double), 0.1, 10).gbytes;
+    }
   }
 }
 
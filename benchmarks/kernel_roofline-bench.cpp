@@ -0,0 +1,342 @@
+// FEAT3: Finite Element Analysis Toolbox, Version 3
+// Copyright (C) 2010 - 2020 by Stefan Turek & the FEAT group
+// FEAT3 is released under the GNU General Public License version 3,
+// see the file 'copyright.txt' in the top level directory for details.
+
+// This benchmark sweeps the most important LAFEM kernels over a set of problem sizes, matrix formats
+// as well as data and index types and compares the achieved memory bandwidth of each kernel to the
+// bandwidth of the STREAM triad kernel, which serves as an estimate of the attainable peak bandwidth.
+//
+// The matrices are 2D Q1 pointstar matrices on a square grid of n x n nodes, where n is specified
+// by the '--sizes' option. All vector kernels are run on vectors of length n^2, whereas the mirror
+// kernels gather/scatter every tenth entry and the filters operate on the boundary nodes of the grid.
+//
+// The byte counts are the minimal traffic of each kernel, i.e. every array is assumed to be read or
+// written exactly once, so the fraction of the STREAM bandwidth is an upper bound for the efficiency.
+//
+// Usage:
+// kernel_roofline-bench [--sizes <n...>] [--min-time <seconds>] [--csv <file>] [--json <file>]
+
+#include <kernel/base_header.hpp>
+#include <kernel/adjacency/graph.hpp>
+#include <kernel/lafem/dense_vector.hpp>
+#include <kernel/lafem/dense_vector_blocked.hpp>
+#include <kernel/lafem/sparse_matrix_csr.hpp>
+#include <kernel/lafem/sparse_matrix_cscr.hpp>
+#include <kernel/lafem/sparse_matrix_bcsr.hpp>
+#include <kernel/lafem/sparse_matrix_ell.hpp>
+#include <kernel/lafem/sparse_matrix_banded.hpp>
+#include <kernel/lafem/pointstar_structure.hpp>
+#include <kernel/lafem/vector_mirror.hpp>
+#include <kernel/lafem/unit_filter.hpp>
+#include <kernel/lafem/slip_filter.hpp>
+#include <kernel/util/type_traits.hpp>
+#include <kernel/util/simple_arg_parser.hpp>
+#include <kernel/util/string.hpp>
+#include <benchmarks/benchmark.hpp>
+#include <kernel/util/runtime.hpp>
+
+#include <iostream>
+#include <fstream>
+#include <vector>
+
+using namespace FEAT;
+using namespace FEAT::LAFEM;
+using namespace FEAT::Benchmark;
+
+/// a single line of the result table
+struct Record
+{
+  String kernel;
+  String format;
+  String data_type;
+  String index_type;
+  Index rows;
+  Index nnz;
+  BenchResult result;
+};
+
+class RooflineBench
+{
+public:
+  /// the minimum runtime of a single run
+  double min_time;
+  /// the measured STREAM triad bandwidth in GB/s
+  double stream_bw;
+  /// all results
+  std::vector<Record> records;
+
+  RooflineBench() :
+    min_time(0.05),
+    stream_bw(0.0)
+  {
+  }
+
+  template<typename DT_, typename IT_>
+  void add(const String& kernel, const String& format, Index rows, Index nnz,
+    std::function<void (void)> func, double flops, double bytes)
+  {
+    Record rec;
+    rec.kernel = kernel;
+    rec.format = format;
+    rec.data_type = Type::Traits<DT_>::name();
+    rec.index_type = Type::Traits<IT_>::name();
+    rec.rows = rows;
+    rec.nnz = nnz;
+    rec.result = measure_bench<Mem::Main>(func, flops, bytes, min_time);
+    print(rec);
+    records.push_back(rec);
+  }
+
+  static String header()
+  {
+    return String("Kernel").pad_back(20) + String("Format").pad_back(22) + String("DT").pad_back(8) +
+      String("IT").pad_back(14) + String("Rows").pad_front(10) + String("NNZ").pad_front(11) +
+      String("Time [s]").pad_front(13) + String("GFlop/s").pad_front(10) + String("GB/s").pad_front(10) +
+      String("STREAM %").pad_front(10);
+  }
+
+  void print(const Record& rec) const
+  {
+    std::cout << rec.kernel.pad_back(20) << rec.format.pad_back(22) << rec.data_type.pad_back(8)
+      << rec.index_type.pad_back(14) << stringify(rec.rows).pad_front(10) << stringify(rec.nnz).pad_front(11)
+      << stringify_fp_sci(rec.result.time, 4, 13) << stringify_fp_fix(rec.result.gflops, 3, 10)
+      << stringify_fp_fix(rec.result.gbytes, 3, 10)
+      << stringify_fp_fix(stream_bw > 0.0 ? 100.0 * rec.result.gbytes / stream_bw : 0.0, 1, 10) << std::endl;
+  }
+
+  void write_csv(const String& filename) const
+  {
+    std::ofstream ofs(filename.c_str());
+    if(!ofs.is_open())
+      throw FileError("Failed to open '" + filename + "'");
+    ofs << "kernel,format,datatype,indextype,rows,nnz,time,gflops,gbytes,stream_gbytes,stream_fraction\n";
+    for(const auto& rec : records)
+    {
+      ofs << rec.kernel << "," << rec.format << "," << rec.data_type << "," << rec.index_type << ","
+        << rec.rows << "," << rec.nnz << "," << stringify_fp_sci(rec.result.time, 6) << ","
+        << stringify_fp_sci(rec.result.gflops, 6) << "," << stringify_fp_sci(rec.result.gbytes, 6) << ","
+        << stringify_fp_sci(stream_bw, 6) << ","
+        << stringify_fp_sci(stream_bw > 0.0 ? rec.result.gbytes / stream_bw : 0.0, 6) << "\n";
+    }
+  }
+
+  void write_json(const String& filename) const
+  {
+    std::ofstream ofs(filename.c_str());
+    if(!ofs.is_open())
+      throw FileError("Failed to open '" + filename + "'");
+    ofs << "{\n  \"stream_triad_gbytes\": " << stringify_fp_sci(stream_bw, 6) << ",\n  \"results\": [\n";
+    for(std::size_t i(0); i < records.size(); ++i)
+    {
+      const Record& rec = records.at(i);
+      ofs << "    {\"kernel\": \"" << rec.kernel << "\", \"format\": \"" << rec.format
+        << "\", \"datatype\": \"" << rec.data_type << "\", \"indextype\": \"" << rec.index_type
+        << "\", \"rows\": " << rec.rows << ", \"nnz\": " << rec.nnz
+        << ", \"time\": " << stringify_fp_sci(rec.result.time, 6)
+        << ", \"gflops\": " << stringify_fp_sci(rec.result.gflops, 6)
+        << ", \"gbytes\": " << stringify_fp_sci(rec.result.gbytes, 6)
+        << ", \"stream_fraction\": " << stringify_fp_sci(stream_bw > 0.0 ? rec.result.gbytes / stream_bw : 0.0, 6)
+        << "}" << (i+1 < records.size() ? "," : "") << "\n";
+    }
+    ofs << "  ]\n}\n";
+  }
+
+  template<typename MT_>
+  void run_apply(const MT_& matrix, double flops, double bytes)
+  {
+    typedef typename MT_::DataType DT_;
+    typedef typename MT_::IndexType IT_;
+    DenseVector<Mem::Main, DT_, IT_> x(matrix.columns(), DT_(1));
+    DenseVector<Mem::Main, DT_, IT_> r(matrix.rows(), DT_(0));
+    auto func = [&] () { matrix.apply(r, x); };
+    add<DT_, IT_>("apply", MT_::name(), matrix.rows(), matrix.used_elements(), func, flops, bytes);
+  }
+
+  template<typename DT_, typename IT_>
+  void run(Index n)
+  {
+    const double dts = double(sizeof(DT_));
+    const double its = double(sizeof(IT_));
+
+    std::vector<IT_> num_of_nodes;
+    num_of_nodes.push_back(IT_(n));
+    num_of_nodes.push_back(IT_(n));
+
+    // generate FE matrix A
+    SparseMatrixBanded<Mem::Main, DT_, IT_> banded(PointstarStructureFE::template value<DT_>(1, num_of_nodes));
+    for (Index i(0) ; i < banded.get_elements_size().at(0) ; ++i)
+      banded.val()[i] = DT_((i%4) + 1);
+    SparseMatrixCSR<Mem::Main, DT_, IT_> csr;
+    csr.convert(banded);
+    SparseMatrixELL<Mem::Main, DT_, IT_> ell;
+    ell.convert(csr);
+
+    const Index rows(csr.rows());
+    const double nnz(double(csr.used_elements()));
+
+    // matrix-vector products
+    run_apply(csr, 2.0 * nnz, nnz * (dts + its) + double(rows + 1) * its + 2.0 * double(rows) * dts);
+    run_apply(ell, 2.0 * nnz, double(ell.get_elements_size().at(0)) * (dts + its) + 2.0 * double(rows) * (its + dts));
+    run_apply(banded, 2.0 * double(banded.get_elements_size().at(0)),
+      double(banded.get_elements_size().at(0)) * dts + double(banded.num_of_offsets()) * its + 2.0 * double(rows) * dts);
+
+    {
+      // CSCR matrix containing every second row
+      VectorMirror<Mem::Main, DT_, IT_> non_zero_rows(rows, (rows + 1) / 2);
+      IT_* idx = non_zero_rows.indices();
+      for(Index i(0); i < non_zero_rows.num_indices(); ++i)
+        idx[i] = IT_(2*i);
+      SparseMatrixCSCR<Mem::Main, DT_, IT_> cscr(csr, non_zero_rows);
+      const double nze(double(cscr.used_elements()));
+      const double ur(double(cscr.used_rows()));
+      run_apply(cscr, 2.0 * nze, nze * (dts + its) + (2.0 * ur + 1.0) * its + ur * dts + double(rows) * dts);
+    }
+
+    {
+      // BCSR matrix with 2x2 blocks on the same sparsity pattern
+      Adjacency::Graph graph(Adjacency::RenderType::as_is, csr);
+      SparseMatrixBCSR<Mem::Main, DT_, IT_, 2, 2> bcsr(graph);
+      bcsr.format(DT_(1));
+      const double nzb(double(bcsr.used_elements()));
+      DenseVectorBlocked<Mem::Main, DT_, IT_, 2> x(bcsr.columns(), DT_(1));
+      DenseVectorBlocked<Mem::Main, DT_, IT_, 2> r(bcsr.rows(), DT_(0));
+      auto func = [&] () { bcsr.apply(r, x); };
+      add<DT_, IT_>("apply", bcsr.name(), bcsr.rows(), bcsr.used_elements(), func,
+        8.0 * nzb, nzb * (4.0 * dts + its) + double(rows + 1) * its + 4.0 * double(rows) * dts);
+    }
+
+    // vector kernels
+    DenseVector<Mem::Main, DT_, IT_> x(rows, DT_(1.234));
+    DenseVector<Mem::Main, DT_, IT_> y(rows, DT_(0.5));
+    DenseVector<Mem::Main, DT_, IT_> r(rows, DT_(0));
+    const String dvn(x.name());
+    const double nv = double(rows);
+    DT_ control(0);
+
+    add<DT_, IT_>("axpy", dvn, rows, rows, [&] () { r.axpy(x, y, DT_(0.75)); }, 2.0 * nv, 3.0 * nv * dts);
+    add<DT_, IT_>("dot", dvn, rows, rows, [&] () { control += x.dot(y); }, 2.0 * nv, 2.0 * nv * dts);
+    add<DT_, IT_>("norm2", dvn, rows, rows, [&] () { control += x.norm2(); }, 2.0 * nv, nv * dts);
+    add<DT_, IT_>("scale", dvn, rows, rows, [&] () { r.scale(x, DT_(0.75)); }, nv, 2.0 * nv * dts);
+    add<DT_, IT_>("component_product", dvn, rows, rows, [&] () { r.component_product(x, y); }, nv, 3.0 * nv * dts);
+
+    // mirror gather/scatter of every tenth entry
+    {
+      VectorMirror<Mem::Main, DT_, IT_> mirror(rows, (rows + 9) / 10);
+      IT_* idx = mirror.indices();
+      for(Index i(0); i < mirror.num_indices(); ++i)
+        idx[i] = IT_(10*i);
+      DenseVector<Mem::Main, DT_, IT_> buffer(mirror.num_indices(), DT_(0));
+      const Index m(mirror.num_indices());
+      const double nm = double(m);
+      add<DT_, IT_>("mirror_gather", "VectorMirror", rows, m, [&] () { mirror.gather(buffer, x); },
+        0.0, nm * (its + 2.0 * dts));
+      add<DT_, IT_>("mirror_scatter_axpy", "VectorMirror", rows, m, [&] () { mirror.scatter_axpy(r, buffer); },
+        2.0 * nm, nm * (its + 3.0 * dts));
+    }
+
+    // filters on the boundary nodes of the grid
+    std::vector<Index> boundary;
+    for(Index i(0); i < n; ++i)
+    {
+      boundary.push_back(i);
+      boundary.push_back(rows - n + i);
+    }
+    for(Index i(1); i + 1 < n; ++i)
+    {
+      boundary.push_back(i*n);
+      boundary.push_back(i*n + n - 1);
+    }
+    const double nb(double(boundary.size()));
+
+    {
+      UnitFilter<Mem::Main, DT_, IT_> unit_filter(rows);
+      for(auto i : boundary)
+        unit_filter.add(IT_(i), DT_(0));
+      add<DT_, IT_>("unit_filter_def", "UnitFilter", rows, Index(boundary.size()),
+        [&] () { unit_filter.filter_def(r); }, 0.0, nb * (its + dts));
+    }
+
+    {
+      SlipFilter<Mem::Main, DT_, IT_, 2> slip_filter(rows, rows);
+      Tiny::Vector<DT_, 2> nu;
+      nu[0] = DT_(0.6);
+      nu[1] = DT_(0.8);
+      for(auto i : boundary)
+        slip_filter.add(IT_(i), nu);
+      DenseVectorBlocked<Mem::Main, DT_, IT_, 2> v(rows, DT_(1));
+      add<DT_, IT_>("slip_filter_def", "SlipFilter", rows, Index(boundary.size()),
+        [&] () { slip_filter.filter_def(v); }, 6.0 * nb, nb * (its + 6.0 * dts));
+    }
+
+    if(control < DT_(0))
+      std::cout << "control: " << control << std::endl;
+  }
+};
+
+int main(int argc, char ** argv)
+{
+  Runtime::initialise(argc, argv);
+#ifdef FEAT_DEBUG_MODE
+  std::cout << "WARNING: You are running a benchmark in DEBUG mode!" << std::endl;
+#endif
+
+  SimpleArgParser args(argc, argv);
+  args.support("sizes", "<n...>\nSpecifies the numbers of grid nodes per dimension; default: 128 512 1024");
+  args.support("min-time", "<seconds>\nSpecifies the minimum runtime of a single measurement run; default: 0.05");
+  args.support("csv", "<filename>\nWrites the results to a CSV file.");
+  args.support("json", "<filename>\nWrites the results to a JSON file.");
+
+  std::deque<std::pair<int,String> > unsupported = args.query_unsupported();
+  if(!unsupported.empty())
+  {
+    for(auto it = unsupported.begin(); it != unsupported.end(); ++it)
+      std::cerr << "ERROR: unsupported option #" << (*it).first << " '--" << (*it).second << "'" << std::endl;
+    std::cerr << "Supported options:" << std::endl << args.get_supported_help();
+    Runtime::abort();
+  }
+
+  RooflineBench bench;
+  args.parse("min-time", bench.min_time);
+
+  std::vector<Index> sizes;
+  if(args.check("sizes") > 0)
+  {
+    for(const auto& s : args.query("sizes")->second)
+    {
+      Index n(0);
+      if(!s.parse(n) || (n < Index(3)))
+      {
+        std::cerr << "ERROR: Failed to parse size '" << s << "'" << std::endl;
+        Runtime::abort();
+      }
+      sizes.push_back(n);
+    }
+  }
+  else
+  {
+    sizes.push_back(128);
+    sizes.push_back(512);
+    sizes.push_back(1024);
+  }
+
+  bench.stream_bw = stream_triad();
+  std::cout << "STREAM triad bandwidth: " << stringify_fp_fix(bench.stream_bw, 3) << " GB/s" << std::endl;
+  std::cout << RooflineBench::header() << std::endl;
+
+  for(auto n : sizes)
+  {
+    bench.run<float, unsigned int>(n);
+    bench.run<double, unsigned int>(n);
+    bench.run<double, unsigned long>(n);
+  }
+
+  String csv_file, json_file;
+  if(args.parse("csv", csv_file) > 0)
+    bench.write_csv(csv_file);
+  if(args.parse("json", json_file) > 0)
+    bench.write_json(json_file);
+
+  Runtime::finalise();
+  return 0;
+}
@@ -0,0 +1,136 @@
+// FEAT3: Finite Element Analysis Toolbox, Version 3
+// Copyright (C) 2010 - 2020 by Stefan Turek & the FEAT group
+// FEAT3 is released under the GNU General Public License version 3,
+// see the file 'copyright.txt' in the top level directory for details.
+
+#include <kernel/base_header.hpp>
+#include <control/domain/agglomeration_policy.hpp>
+#include <test_system/test_system.hpp>
+
+using namespace FEAT;
+using namespace FEAT::TestSystem;
+
+/**
+ * \brief Test class for the automatic coarse-level agglomeration policy.
+ *
+ * \test Checks the desired levels computed by the AgglomerationPolicy for several machine models
+ * and process counts and verifies that the machine calibration yields sane parameters.
+ */
+class AgglomerationPolicyTest
+  : public TaggedTest<Archs::None, Archs::None>
+{
+public:
+  typedef std::deque<std::pair<int,int>> LevelDeque;
+
+  AgglomerationPolicyTest() :
+    TaggedTest<Archs::None, Archs::None>("AgglomerationPolicyTest")
+  {
+  }
+
+  virtual ~AgglomerationPolicyTest()
+  {
+  }
+
+  /// checks that the desired levels can be used by the PartiDomainControl
+  void check_levels(const LevelDeque& levels, int num_procs, int level_max, int level_min) const
+  {
+    TEST_CHECK(levels.size() >= std::size_t(2));
+    TEST_CHECK_EQUAL(levels.front().first, level_max);
+    TEST_CHECK_EQUAL(levels.front().second, num_procs);
+    TEST_CHECK_EQUAL(levels.back().first, level_min);
+    TEST_CHECK_EQUAL(levels.back().second, 0);
+
+    for(std::size_t i(1); (i+1) < levels.size(); ++i)
+    {
+      // levels must be strictly descending
+      TEST_CHECK(levels.at(i).first < levels.at(i-1).first);
+      TEST_CHECK(levels.at(i).first >= level_min);
+      // process counts must be descending divisors
+      TEST_CHECK(levels.at(i).second > 0);
+      TEST_CHECK(levels.at(i).second < levels.at(i-1).second);
+      TEST_CHECK_EQUAL(levels.at(i-1).second % levels.at(i).second, 0);
+    }
+  }
+
+  void test_single_process() const
+  {
+    Control::Domain::AgglomerationPolicy policy;
+    LevelDeque levels = policy.compute_desired_levels(1, Index(4), 2, 6, 0);
+    check_levels(levels, 1, 6, 0);
+    TEST_CHECK_EQUAL(levels.size(), std::size_t(2));
+  }
+
+  void test_no_latency() const
+  {
+    // without communication costs there is no reason to shrink the communicator
+    Control::Domain::AgglomerationPolicy policy;
+    policy.set_machine(1E-9, 0.0, 0.0);
+    policy.set_min_dofs_per_rank(0.0);
+    LevelDeque levels = policy.compute_desired_levels(64, Index(16), 2, 8, 0);
+    check_levels(levels, 64, 8, 0);
+    TEST_CHECK_EQUAL(levels.size(), std::size_t(2));
+  }
+
+  void test_latency_bound() const
+  {
+    // 2D mesh with 4*4^10 elements on 1024 processes; the coarse levels are latency bound
+    Control::Domain::AgglomerationPolicy policy;
+    policy.set_machine(1E-9, 2E-6, 1E-10);
+    policy.set_min_dofs_per_rank(0.0);
+    LevelDeque levels = policy.compute_desired_levels(1024, Index(4), 2, 10, 0);
+    check_levels(levels, 1024, 10, 0);
+
+    // the communicator must be shrunk to a single process somewhere
+    TEST_CHECK(levels.size() > std::size_t(2));
+    TEST_CHECK_EQUAL(levels.at(levels.size()-2).second, 1);
+
+    // a higher latency must not delay the agglomeration
+    policy.set_machine(1E-9, 2E-5, 1E-10);
+    LevelDeque levels2 = policy.compute_desired_levels(1024, Index(4), 2, 10, 0);
+    check_levels(levels2, 1024, 10, 0);
+    TEST_CHECK(levels2.at(1).first >= levels.at(1).first);
+  }
+
+  void test_min_dofs() const
+  {
+    // 3D mesh with 8*8^6 elements on 4096 processes and Q2 elements
+    Control::Domain::AgglomerationPolicy policy;
+    policy.set_machine(1E-9, 0.0, 0.0);
+    policy.set_dofs_per_elem(8.0);
+    policy.set_min_dofs_per_rank(2000.0);
+    LevelDeque levels = policy.compute_desired_levels(4096, Index(8), 3, 6, 1);
+    check_levels(levels, 4096, 6, 1);
+
+    // all layers must have enough DOFs per process, unless only one process remains
+    for(std::size_t i(1); (i+1) < levels.size(); ++i)
+    {
+      if(levels.at(i).second <= 1)
+        continue;
+      const double num_dofs = 64.0 * Math::pow(8.0, double(levels.at(i).first));
+      TEST_CHECK(num_dofs >= 2000.0 * double(levels.at(i).second));
+    }
+  }
+
+  void test_calibrate() const
+  {
+    const Dist::Comm comm = Dist::Comm::world();
+    Control::Domain::AgglomerationPolicy policy;
+    TEST_CHECK(!policy.is_calibrated());
+    policy.calibrate(comm);
+    TEST_CHECK(policy.is_calibrated());
+    TEST_CHECK(policy.get_time_dof() > 0.0);
+    TEST_CHECK(policy.get_latency() >= 0.0);
+    TEST_CHECK(policy.get_time_byte() >= 0.0);
+  }
+
+  virtual void run() const override
+  {
+    test_single_process();
+    test_no_latency();
+    test_latency_bound();
+    test_min_dofs();
+    test_calibrate();
+  }
+};
+
+AgglomerationPolicyTest agglomeration_policy_test;
@@ -7,9 +7,13 @@
 #include <kernel/util/runtime.hpp>
 #include <control/checkpoint_control.hpp>
 #include <kernel/lafem/dense_vector.hpp>
+#include <kernel/lafem/sparse_matrix_csr.hpp>
+#include <kernel/lafem/pointstar_factory.hpp>
 #include <kernel/util/binary_stream.hpp>
 #include <test_system/test_system.hpp>
 
+#include <cstdio>
+
 using namespace FEAT;
 using namespace FEAT::TestSystem;
 
@@ -57,6 +61,75 @@ public:
       TEST_CHECK_EQUAL(dv1, dv2);
       TEST_CHECK_NOT_EQUAL(cp.get_identifier_list().find("dv1"), std::string::npos);
     }
+
+    // compressed containers
+    LAFEM::PointstarFactoryFD<DT_, IT_> psf(17);
+    LAFEM::SparseMatrixCSR<Mem::Main, DT_, IT_> csr_main(psf.matrix_csr());
+    LAFEM::SparseMatrixCSR<Mem_, DT_, IT_> csr1;
+    csr1.convert(csr_main);
+
+    {
+      auto comm = Dist::Comm::world();
+      Control::CheckpointControl cp(comm, LAFEM::SerialConfig(true, false, 1e-8));
+      BinaryStream bs;
+      cp.add_object(String("dv1"), dv1);
+      cp.add_object(String("csr1"), csr1);
+      cp.save(bs);
+      comm.barrier();
+      bs.seekg(0);
+      cp.load(bs);
+      LAFEM::DenseVector<Mem_, DT_, IT_> dv2;
+      LAFEM::SparseMatrixCSR<Mem_, DT_, IT_> csr2;
+      cp.restore_object(String("csr1"), csr2, false);
+      cp.restore_object(String("dv1"), dv2, false);
+      TEST_CHECK_EQUAL(csr2.used_elements(), csr1.used_elements());
+      for (Index i(0) ; i < csr1.used_elements() ; ++i)
+      {
+        TEST_CHECK_EQUAL(csr2.col_ind()[i], csr1.col_ind()[i]);
+        TEST_CHECK_EQUAL_WITHIN_EPS(csr2.val()[i], csr1.val()[i], DT_(1e-7));
+      }
+      for (Index i(0) ; i < dv1.size() ; ++i)
+        TEST_CHECK_EQUAL_WITHIN_EPS(dv2(i), dv1(i), DT_(1e-7));
+    }
+
+    // asynchronous checkpoints
+    for (String filename : {String("checkpoint-test-async.cp"), String("checkpoint-test-async.zcp")})
+    {
+      auto comm = Dist::Comm::world();
+      LAFEM::DenseVector<Mem_, DT_, IT_> dv3(dv1.clone());
+      {
+        Control::CheckpointControl cp(comm);
+        cp.add_object(String("dv3"), dv3);
+        cp.add_object(String("csr1"), csr1);
+        cp.save_async(filename);
+        // the checkpoint holds the state at the time of the save_async call
+        dv3.format(DT_(4711));
+        cp.save_async(filename);
+        dv3.copy(dv1);
+        cp.save_async(filename);
+        dv3.format(DT_(-1));
+        cp.wait_async();
+        TEST_CHECK(!cp.async_pending());
+      }
+      comm.barrier();
+      Control::CheckpointControl cp(comm);
+      cp.load(filename);
+      LAFEM::DenseVector<Mem_, DT_, IT_> dv4;
+      LAFEM::SparseMatrixCSR<Mem_, DT_, IT_> csr4;
+      cp.restore_object(String("dv3"), dv4, false);
+      cp.restore_object(String("csr1"), csr4, false);
+      TEST_CHECK_EQUAL(dv4, dv1);
+      TEST_CHECK_EQUAL(csr4, csr1);
+      cp.clear_input();
+      comm.barrier();
+      if (comm.rank() == 0)
+      {
+        const String name = filename.substr(0, filename.rfind('.'));
+        const String ext = filename.substr(filename.rfind('.') + 1);
+        std::remove(filename.c_str());
+        std::remove((name + ".s" + ext).c_str());
+      }
+    }
   }
 };
 
@@ -13,12 +13,16 @@
 #include <kernel/util/string.hpp>
 #include <kernel/util/binary_stream.hpp>
 #include <kernel/util/pack.hpp>
+#include <kernel/lafem/base.hpp>
 
 #include <cstdio>
 #include <cstring>
+#include <exception>
+#include <iostream>
 #include <map>
 #include <sys/stat.h>
 #include <memory>
+#include <thread>
 
 namespace FEAT
 {
@@ -38,10 +42,12 @@ namespace FEAT
          *
          * Calculate size of complete object as it is stored in the checkpoint
          *
-         * \return size of object
+         * \param[in] config LAFEM::SerialConfig, a struct describing the serialise configuration.
+         *
+         * \return size of object, an upper bound of the size if \p config enables compression
          *
          */
-      virtual uint64_t get_checkpoint_size() = 0;
+      virtual uint64_t get_checkpoint_size(const LAFEM::SerialConfig& config) = 0;
 
       /**
          * \brief Extract object from checkpoint
@@ -59,9 +65,12 @@ namespace FEAT
          * Adds the condensed complete object with all its contents to the end of the checkpoint buffer
          *
          * \param[out] data object as bytestream
+         * \param[in] config LAFEM::SerialConfig, a struct describing the serialise configuration.
+         *
+         * \return the number of bytes added to \p data
          *
          */
-      virtual void set_checkpoint_data(std::vector<char> & data) = 0;
+      virtual uint64_t set_checkpoint_data(std::vector<char> & data, const LAFEM::SerialConfig& config) = 0;
 
     protected:
       virtual ~Checkpointable() {}
@@ -89,12 +98,14 @@ namespace FEAT
          *
          * Calculate size of complete object as it is stored in the checkpoint
          *
-         * \return size of object
+         * \param[in] config LAFEM::SerialConfig, a struct describing the serialise configuration.
+         *
+         * \return size of object, an upper bound of the size if \p config enables compression
          *
          */
-      virtual uint64_t get_checkpoint_size() override
+      virtual uint64_t get_checkpoint_size(const LAFEM::SerialConfig& config) override
       {
-        return _object.get_checkpoint_size();
+        return _object.get_checkpoint_size(config);
       }
 
       /**
@@ -116,11 +127,14 @@ namespace FEAT
          * Adds the condensed complete object with all its contents to the end of the checkpoint buffer
          *
          * \param[out] data object as bytestream
+         * \param[in] config LAFEM::SerialConfig, a struct describing the serialise configuration.
+         *
+         * \return the number of bytes added to \p data
          *
          */
-      virtual void set_checkpoint_data(std::vector<char> & data) override
+      virtual uint64_t set_checkpoint_data(std::vector<char> & data, const LAFEM::SerialConfig& config) override
       {
-        _object.set_checkpoint_data(data);
+        return _object.set_checkpoint_data(data, config);
       }
     }; // class CheckpointableWrapper
 
@@ -136,6 +150,21 @@ namespace FEAT
      * ranks objects will be written into one single file.
      * Later on, the loaded objects will, again, be local objects in every rank with distinct contents.
      *
+     * \note The arrays of all LAFEM containers are serialised as described by the LAFEM::SerialConfig of the
+     * checkpoint control, i.e. index arrays can be delta encoded and zlib compressed and value arrays can be
+     * zlib or zfp compressed. Compressed checkpoints (.zcp files and BinaryStreams) are always compressed
+     * array by array; if the configuration does not request any compression, index and value arrays are
+     * compressed losslessly. The data is self-describing, i.e. loading a checkpoint does not require the
+     * configuration it was written with.
+     *
+     * \note Checkpoints can be written asynchronously by save_async(): the registered objects are serialised
+     * into one of two staging buffers, while the file output continues after save_async() has returned.
+     * In MPI builds, the (optional) compression is performed directly and the files are written by non-blocking
+     * MPI I/O, so that no other thread issues MPI calls on the communicator of the caller. In non-MPI builds,
+     * the compression and the file output are performed by a background thread. A pending write is completed
+     * by wait_async(), which is called implicitly by the next save_async(), save(), load() and the destructor.
+     * As completing a write is collective in MPI builds, wait_async() has to be called by all processes.
+     *
      * \todo do we need extra handling for machines with no global acessible file servers?
      */
     class CheckpointControl
@@ -149,6 +178,23 @@ namespace FEAT
       std::map<String, uint64_t> _offset_by_identifier;
       /// the mpi communicator identifying our mpi context
       const Dist::Comm & _comm;
+      /// the serialise configuration used for all containers
+      LAFEM::SerialConfig _config;
+      /// the two staging buffers of asynchronous writes
+      std::vector<char> _async_buffers[2];
+      /// the index of the staging buffer used by the next asynchronous write
+      int _async_next;
+#if defined(FEAT_HAVE_MPI) || defined(DOXYGEN)
+      /// the size record of the pending asynchronous write
+      uint64_t _async_sizes[2];
+      /// the non-blocking writes of the checkpoint file and its size file
+      DistFileIO::OrderedWriteRequest _async_writes[2];
+#else
+      /// the background thread of the pending asynchronous write
+      std::thread _async_thread;
+      /// the exception thrown by the last asynchronous write, if any
+      std::exception_ptr _async_error;
+#endif // FEAT_HAVE_MPI
 
       /**
          * \brief Build checkpoint buffer
@@ -156,36 +202,43 @@ namespace FEAT
          * Collect all data needed for a checkpoint from every object registered at the checkpoint control.
          *
          * \param[in] buffer buffer containing the collected data
+         * \param[in] config the serialise configuration of all containers
          * \returns the size of the buffer
          *
          */
-      uint64_t _collect_checkpoint_data(std::vector<char> & buffer)
+      uint64_t _collect_checkpoint_data(std::vector<char> & buffer, const LAFEM::SerialConfig& config)
       {
+        // the checkpoint sizes are upper bounds for compressed containers, so they are used for the reservation only
         uint64_t checkpoint_size(0);
-        std::map<String, std::tuple<uint64_t, uint64_t>> sizes;
-
         for (auto const & it : _checkpointable_by_identifier)
         {
-          uint64_t identifierlength = (uint64_t)it.first.length();
-          uint64_t datalength = it.second->get_checkpoint_size();
-
-          checkpoint_size += identifierlength + datalength + sizeof(uint64_t) + sizeof(uint64_t);
-          sizes[it.first] = std::make_tuple(identifierlength, datalength);
+          checkpoint_size += (uint64_t)it.first.length() + it.second->get_checkpoint_size(config) + sizeof(uint64_t) + sizeof(uint64_t);
         }
 
         buffer.reserve(checkpoint_size);
 
         for (auto const & it : _checkpointable_by_identifier)
         {
-          char * cidentifierlength = reinterpret_cast<char *>(&std::get<0>(sizes[it.first]));
+          uint64_t identifierlength = (uint64_t)it.first.length();
+          char * cidentifierlength = reinterpret_cast<char *>(&identifierlength);
           buffer.insert(std::end(buffer), cidentifierlength, cidentifierlength + sizeof(uint64_t));
           buffer.insert(std::end(buffer), it.first.begin(), it.first.end());
-          char * cdatalength = reinterpret_cast<char *>(&std::get<1>(sizes[it.first]));
-          buffer.insert(std::end(buffer), cdatalength, cdatalength + sizeof(uint64_t));
-          it.second->set_checkpoint_data(buffer);
+          // insert a placeholder for the data length and replace it by the actual length afterwards
+          std::size_t datalength_pos = buffer.size();
+          buffer.insert(std::end(buffer), sizeof(uint64_t), 0);
+          uint64_t datalength = it.second->set_checkpoint_data(buffer, config);
+          ::memcpy(buffer.data() + datalength_pos, &datalength, sizeof(uint64_t));
         }
 
-        return checkpoint_size;
+        return buffer.size();
+      }
+
+      /// Returns the serialise configuration for compressed checkpoints.
+      LAFEM::SerialConfig _compressed_config() const
+      {
+        if (_config.get_requested_compression() != LAFEM::CompressionModes::None)
+          return _config;
+        return LAFEM::SerialConfig(true, true);
       }
 
       /**
@@ -220,7 +273,6 @@ namespace FEAT
         }
       }
 
-#ifdef FEAT_HAVE_ZLIB
       /**
          * \brief Write checkpoint files to disk
          *
@@ -228,25 +280,17 @@ namespace FEAT
          * [name].zcp: a compressed file holding the current status of all checkpointable objects added to the checkpoint control
          * [name].szcp: a file holding the size of the checkpoint data per rank, needed for loading the checkpoint
          *
+         * The containers are compressed array by array, see _compressed_config().
+         *
          * \param[in] name String holding the name of the file (without the extension .zcp)
          */
       void _save_compressed(const String name)
       {
         std::vector<char> buffer;
-        uint64_t sizes[2];
-        sizes[0] = _collect_checkpoint_data(buffer);
-
-        uLongf compressedLen = compressBound(static_cast<uLong>(sizes[0]));
-        Bytef * compressed = new Bytef[compressedLen];
-        Bytef * buffer_data = (Bytef *)buffer.data();
-
-        int c_status = ::compress(compressed, &compressedLen, buffer_data, static_cast<uLongf>(sizes[0]));
-        XASSERTM(c_status == Z_OK, "compression of checkpoint data failed");
+        uint64_t checkpoint_size = _collect_checkpoint_data(buffer, _compressed_config());
 
-        sizes[1] = static_cast<uint64_t>(compressedLen);
-
-        DistFileIO::write_ordered(compressed, sizes[1], name + ".zcp", _comm);
-        DistFileIO::write_ordered(sizes, 2 * sizeof(uint64_t), name + ".szcp", _comm);
+        DistFileIO::write_ordered(buffer.data(), checkpoint_size, name + ".zcp", _comm);
+        DistFileIO::write_ordered(reinterpret_cast<char *>(&checkpoint_size), sizeof(uint64_t), name + ".szcp", _comm);
       }
 
       /**
@@ -257,6 +301,9 @@ namespace FEAT
          *
          * Fill the _offset_by_identifier map with the data from the array.
          *
+         * \note Checkpoints, which have been compressed as a whole by older versions, are identified by their
+         * [name].szcp file holding two sizes per rank and can still be read, if zlib is available.
+         *
          * \param[in] name String holding the name of the file (without the extension .zcp)
          *
          * \warning Reading another input file / stream will overwrite values in _input_array and _offset_by_identifier
@@ -266,10 +313,26 @@ namespace FEAT
         struct stat stat_buf;
         stat((name + ".szcp").c_str(), &stat_buf);
         size_t filesize = (unsigned)stat_buf.st_size;
-        size_t original_rank_count = (filesize / (2 * sizeof(uint64_t)));
         int world_size(_comm.size());
-        XASSERTM(original_rank_count == unsigned(world_size), "number of ranks of checkpoint file and running program does not match");
 
+        // checkpoint with compressed arrays: one size per rank
+        if ((filesize / sizeof(uint64_t)) == unsigned(world_size))
+        {
+          uint64_t size_buffer[1];
+          DistFileIO::read_ordered((char *)size_buffer, sizeof(uint64_t), name + ".szcp", _comm);
+          const uint64_t size = *size_buffer;
+
+          _input_array = new char[size];
+          DistFileIO::read_ordered(_input_array, size, name + ".zcp", _comm);
+
+          _restore_checkpoint_data(size);
+          return;
+        }
+
+        // legacy checkpoint compressed as a whole: uncompressed and compressed size per rank
+        size_t original_rank_count = (filesize / (2 * sizeof(uint64_t)));
+        XASSERTM(original_rank_count == unsigned(world_size), "number of ranks of checkpoint file and running program does not match");
+#ifdef FEAT_HAVE_ZLIB
         // read the file with the sizes first, so that every rank knows its checkpoint size (needed for read_ordered)
         uint64_t size_buffer[2];
         DistFileIO::read_ordered((char *)size_buffer, 2 * sizeof(uint64_t), name + ".szcp", _comm);
@@ -288,8 +351,10 @@ namespace FEAT
         delete[] buffer;
 
         _restore_checkpoint_data(static_cast<uint64_t>(size));
+#else // no FEAT_HAVE_ZLIB
+        XASSERTM(false, "no zlib support, activate zlib to read checkpoints written by older versions");
+#endif // FEAT_HAVE_ZLIB
       }
-#endif //FEAT_HAVE_ZLIB
 
       /**
          * \brief Write checkpoint files to disk
@@ -303,7 +368,7 @@ namespace FEAT
       void _save(const String name)
       {
         std::vector<char> buffer;
-        auto checkpoint_size = _collect_checkpoint_data(buffer);
+        auto checkpoint_size = _collect_checkpoint_data(buffer, _config);
 
         DistFileIO::write_ordered(buffer.data(), checkpoint_size, name + ".cp", _comm);
         DistFileIO::write_ordered(reinterpret_cast<char *>(&checkpoint_size), sizeof(uint64_t), name + ".scp", _comm);
@@ -341,6 +406,60 @@ namespace FEAT
         _restore_checkpoint_data(size);
       }
 
+      /**
+         * \brief Finish a staged checkpoint for the file output
+         *
+         * If a compressed checkpoint is requested, but the staged data has not been compressed array by array,
+         * the whole buffer is compressed by zlib, which results in the [name].zcp layout of older versions that
+         * is still understood by load().
+         *
+         * \param[in,out] buffer The staged checkpoint data; replaced by its compressed version if necessary
+         * \param[in] compressed Write a .zcp checkpoint instead of a .cp checkpoint?
+         * \param[in] config The serialise configuration the buffer has been collected with
+         * \param[out] sizes The size record, which is to be written to the [name].scp or [name].szcp file
+         * \returns the size of the size record in bytes
+         */
+      static std::size_t _finish_staged(std::vector<char>& buffer, bool compressed, const LAFEM::SerialConfig& config, uint64_t* sizes)
+      {
+        sizes[0] = buffer.size();
+#ifdef FEAT_HAVE_ZLIB
+        if (compressed && !config.is_compressed())
+        {
+          uLongf compressedLen = compressBound(static_cast<uLong>(sizes[0]));
+          std::vector<char> compressed_data(compressedLen);
+          int c_status = ::compress((Bytef *)compressed_data.data(), &compressedLen, (const Bytef *)buffer.data(), static_cast<uLong>(sizes[0]));
+          XASSERTM(c_status == Z_OK, "compression of checkpoint data failed");
+          sizes[1] = static_cast<uint64_t>(compressedLen);
+          compressed_data.resize(std::size_t(compressedLen));
+          buffer.swap(compressed_data);
+          return 2 * sizeof(uint64_t);
+        }
+#else // no FEAT_HAVE_ZLIB
+        (void)compressed;
+        (void)config;
+#endif // FEAT_HAVE_ZLIB
+        return sizeof(uint64_t);
+      }
+
+      /**
+         * \brief Write a staged checkpoint to disk
+         *
+         * Writes a checkpoint collected by _collect_checkpoint_data() in the same file format as save().
+         *
+         * \param[in,out] buffer The staged checkpoint data, see _finish_staged()
+         * \param[in] name String holding the name of the file (without extension)
+         * \param[in] compressed Write a .zcp checkpoint instead of a .cp checkpoint?
+         * \param[in] config The serialise configuration the buffer has been collected with
+         * \param[in] comm The communicator of the collective file output
+         */
+      static void _write_staged(std::vector<char>& buffer, const String name, bool compressed, const LAFEM::SerialConfig& config, const Dist::Comm & comm)
+      {
+        uint64_t sizes[2];
+        const std::size_t sizes_bytes = _finish_staged(buffer, compressed, config, sizes);
+        DistFileIO::write_ordered(buffer.data(), buffer.size(), name + (compressed ? ".zcp" : ".cp"), comm);
+        DistFileIO::write_ordered(sizes, sizes_bytes, name + (compressed ? ".szcp" : ".scp"), comm);
+      }
+
     public:
       /**
          * \brief Constructor
@@ -348,9 +467,12 @@ namespace FEAT
          * Initalise the input array as NULL pointer.
          *
          * \param[in] comm The communicator common to all stored objects
+         * \param[in] config The serialise configuration of all stored containers
          */
-      CheckpointControl(const Dist::Comm & comm) :
-        _comm(comm)
+      explicit CheckpointControl(const Dist::Comm & comm, const LAFEM::SerialConfig& config = LAFEM::SerialConfig()) :
+        _comm(comm),
+        _config(config),
+        _async_next(0)
       {
         _input_array = nullptr;
       }
@@ -358,10 +480,19 @@ namespace FEAT
       /**
          * \brief Destructor
          *
-         * Destroy the checkpoint control instance and delete the input array.
+         * Complete a pending asynchronous write, destroy the checkpoint control instance and delete the input array.
          */
       ~CheckpointControl()
       {
+#ifdef FEAT_HAVE_MPI
+        _async_writes[0].wait();
+        _async_writes[1].wait();
+#else
+        if (_async_thread.joinable())
+          _async_thread.join();
+        if (_async_error)
+          std::cerr << "WARNING: CheckpointControl: asynchronous checkpoint write failed" << std::endl;
+#endif // FEAT_HAVE_MPI
         delete[] _input_array;
       }
 
@@ -378,6 +509,18 @@ namespace FEAT
         _input_array = nullptr;
       }
 
+      /// Sets the serialise configuration of all stored containers.
+      void set_config(const LAFEM::SerialConfig& config)
+      {
+        _config = config;
+      }
+
+      /// \returns The serialise configuration of all stored containers.
+      const LAFEM::SerialConfig& get_config() const
+      {
+        return _config;
+      }
+
       /// Retrieve a list of all items stored in the checkpoint
       String get_identifier_list()
       {
@@ -464,13 +607,15 @@ namespace FEAT
          * filename: [name.cp]: holding the current status of all checkpointable objects added to the checkpoint control
          *           [name.scp]: holding the size of the checkpoint data per rank, needed for loading the checkpoint
          * or write two compressed binary files:
-         * filename: [name.zcp]: a compressed file holding the current status of all checkpointable objects added to the checkpoint control, needs zlib support
+         * filename: [name.zcp]: a compressed file holding the current status of all checkpointable objects added to the checkpoint control
          *           [name.szcp]: holding the size of the checkpoint data per rank, needed for loading the checkpoint
          *
          * \param[in] filename String holding the complete name of the file with extension .cp, without compression, or .zcp, for compression
          */
       void save(const String filename)
       {
+        wait_async();
+
         size_t pos = filename.rfind('.');
         String extension = filename.substr(pos + 1);
         String name = filename.substr(0, pos);
@@ -481,15 +626,12 @@ namespace FEAT
         {
           _save(name);
         }
-#ifdef FEAT_HAVE_ZLIB
         else if (extension == "zcp")
         {
           _save_compressed(name);
         }
-#endif // FEAT_HAVE_ZLIB
         else
         {
-          XASSERTM(extension != "zcp", "no zlib support, activate zlib or write uncompressed files with .cp extension instead");
           XASSERTM(extension == "zcp", "no valid checkpoint filename choosen");
         }
       }
@@ -510,6 +652,7 @@ namespace FEAT
       void load(const String filename)
       {
         XASSERTM(_input_array == nullptr, "another input file was read before");
+        wait_async();
 
         size_t pos = filename.rfind('.');
         String extension = filename.substr(pos + 1);
@@ -521,89 +664,125 @@ namespace FEAT
         {
           _load(name);
         }
-#ifdef FEAT_HAVE_ZLIB
         else if (extension == "zcp")
         {
           _load_compressed(name);
         }
-#endif // FEAT_HAVE_ZLIB
         else
         {
-          XASSERTM(extension != "zcp", "no zlib support, activate zlip or read uncompressed files with .cp extension instead");
           XASSERTM(extension == "zcp", "no valid checkpoint file choosen");
         }
       }
 
-#ifdef FEAT_HAVE_ZLIB
       /**
-         * \brief Save checkpoint to a stream
+         * \brief Write checkpoint files to disk asynchronously
          *
-         * Save a checkpoint, holding the current status of all registered objects, in a BinaryStream
+         * Serialises all registered objects into a staging buffer and returns afterwards, while the file output
+         * continues: in MPI builds, the files are written by non-blocking MPI I/O after the (optional) compression;
+         * otherwise, the compression and the file output are performed by a background thread. The registered
+         * objects may be modified directly after this function returns. The files are identical to the ones written by save(), except
+         * for .zcp checkpoints without requested compression, which are compressed as a whole.
          *
-         * \param[in] bs BinaryStream that shall be written to
+         * \attention
+         * In MPI builds, the compression of .zcp checkpoints runs synchronously within this function before the
+         * non-blocking write is started, so only the file output overlaps with the computation of the caller.
+         *
+         * A previously started asynchronous write is completed before the new one is started; the serialisation
+         * of the new checkpoint overlaps with the previous write, as both use different staging buffers.
+         *
+         * \param[in] filename String holding the complete name of the file with extension .cp, without compression, or .zcp, for compression
+         *
+         * \note Call wait_async() to ensure that the checkpoint has been written completely. This function and
+         * wait_async() are collective operations in MPI builds.
          */
-      void save(BinaryStream & bs)
+      void save_async(const String filename)
       {
-        std::vector<char> data;
-
-        uLongf checkpoint_size = static_cast<uLongf>(_collect_checkpoint_data(data));
-
-        uLongf compressedLen = static_cast<uLongf>(compressBound(checkpoint_size));
-
-        Bytef * compressed = new Bytef[compressedLen];
-        Bytef * uncompressed = (Bytef *)data.data();
-        int c_status = ::compress(compressed, &compressedLen, uncompressed, checkpoint_size);
-        XASSERTM(c_status == Z_OK, "compression of checkpoint data failed");
-
-        std::uint64_t clen = compressedLen;
-        std::uint64_t slen = checkpoint_size;
-
-        bs.write(reinterpret_cast<char *>(&clen), sizeof(clen));
-        bs.write(reinterpret_cast<char *>(&slen), sizeof(slen));
-        bs.write(reinterpret_cast<char *>(compressed), static_cast<std::streamsize>(clen));
+        size_t pos = filename.rfind('.');
+        String extension = filename.substr(pos + 1);
+        String name = filename.substr(0, pos);
 
-        delete[] compressed;
+        XASSERTM(name != "", "no complete filename consisting of name.extension given");
+        XASSERTM((extension == "cp") || (extension == "zcp"), "no valid checkpoint filename choosen");
+
+        // serialise into the free staging buffer, while the previous write may still be running
+        std::vector<char>& buffer = _async_buffers[_async_next];
+        buffer.clear();
+        _collect_checkpoint_data(buffer, _config);
+
+        wait_async();
+
+        const bool compressed(extension == "zcp");
+#ifdef FEAT_HAVE_MPI
+        // no background thread: the caller may issue collectives on our communicator at any time,
+        // so the file output is started by non-blocking MPI I/O and completed by wait_async()
+        const std::size_t sizes_bytes = _finish_staged(buffer, compressed, _config, _async_sizes);
+        _async_writes[0] = DistFileIO::iwrite_ordered(buffer.data(), buffer.size(), name + (compressed ? ".zcp" : ".cp"), _comm);
+        _async_writes[1] = DistFileIO::iwrite_ordered(_async_sizes, sizes_bytes, name + (compressed ? ".szcp" : ".scp"), _comm);
+#else
+        const LAFEM::SerialConfig config(_config);
+        const Dist::Comm & comm(_comm);
+        std::exception_ptr & error(_async_error);
+        _async_thread = std::thread([&buffer, name, compressed, config, &comm, &error] ()
+        {
+          try
+          {
+            _write_staged(buffer, name, compressed, config, comm);
+          }
+          catch(...)
+          {
+            error = std::current_exception();
+          }
+        });
+#endif // FEAT_HAVE_MPI
+        _async_next = 1 - _async_next;
       }
 
       /**
-         * \brief Load checkpoint from stream
-         *
-         * Read the BinaryStream, to restore the safed state of all objects registered to the checkpoint control
-         * and store it to _input_array.
-         *
-         * Fill the _offset_by_identifier map with the data from the array.
-         *
-         * \param[in] bs BinaryStream that shall be read from
+         * \brief Complete asynchronous write
          *
-         * \warning Reading another input file / stream will overwrite values in _input_array and _offset_by_identifier
+         * Blocks until a pending asynchronous write started by save_async() has been completed.
+         * An exception thrown by the background thread is rethrown.
          */
-      void load(BinaryStream & bs)
+      void wait_async()
       {
-        XASSERTM(_input_array == nullptr, "another input file was read before");
-
-        char * data = bs.data();
-        uLongf compressed_size = static_cast<uLongf>(*(std::uint64_t *)(data));
-        uLongf checkpoint_size = static_cast<uLongf>(*(std::uint64_t *)(data + sizeof(uint64_t)));
-
-        Bytef * compressed = (Bytef *)(data + (2 * sizeof(uint64_t)));
-        _input_array = new char[checkpoint_size];
-        int d_status = ::uncompress((Bytef *)_input_array, &checkpoint_size, compressed, compressed_size);
-        XASSERTM(d_status == Z_OK, "decompression of checkpoint data failed");
+#ifdef FEAT_HAVE_MPI
+        _async_writes[0].wait();
+        _async_writes[1].wait();
+#else
+        if (_async_thread.joinable())
+          _async_thread.join();
+        if (_async_error)
+        {
+          std::exception_ptr error(_async_error);
+          _async_error = nullptr;
+          std::rethrow_exception(error);
+        }
+#endif // FEAT_HAVE_MPI
+      }
 
-        _restore_checkpoint_data(static_cast<uint64_t>(checkpoint_size));
+      /// \returns \c true, if an asynchronous write has not been completed by wait_async() yet, otherwise \c false.
+      bool async_pending() const
+      {
+#ifdef FEAT_HAVE_MPI
+        return !_async_writes[0].is_null();
+#else
+        return _async_thread.joinable();
+#endif // FEAT_HAVE_MPI
       }
-#else //FEAT_HAVE_ZLIB
+
       /**
          * \brief Save checkpoint to a stream
          *
          * Save a checkpoint, holding the current status of all registered objects, in a BinaryStream
          *
+         * The containers are compressed array by array, see _compressed_config().
+         *
          * \param[in] bs BinaryStream that shall be written to
          */
       void save(BinaryStream & bs)
       {
         std::vector<char> buffer;
-        auto checkpoint_size = _collect_checkpoint_data(buffer);
+        auto checkpoint_size = _collect_checkpoint_data(buffer, _compressed_config());
 
         std::uint64_t slen = checkpoint_size;
         bs.write(reinterpret_cast<char *>(&slen), sizeof(slen));
@@ -630,11 +809,10 @@ namespace FEAT
         uint64_t size = *(std::uint64_t *)(buffer);
 
         _input_array = new char[size];
-        std::copy(buffer + sizeof(uint64_t), buffer + sizeof(uint64_t) + size - 1, _input_array);
+        std::copy(buffer + sizeof(uint64_t), buffer + sizeof(uint64_t) + size, _input_array);
 
         _restore_checkpoint_data(size);
       }
-#endif //FEAT_HAVE_ZLIB
 
     }; // class Checkpoint
 
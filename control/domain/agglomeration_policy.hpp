@@ -0,0 +1,473 @@
+// FEAT3: Finite Element Analysis Toolbox, Version 3
+// Copyright (C) 2010 - 2020 by Stefan Turek & the FEAT group
+// FEAT3 is released under the GNU General Public License version 3,
+// see the file 'copyright.txt' in the top level directory for details.
+
+#pragma once
+#ifndef CONTROL_DOMAIN_AGGLOMERATION_POLICY_HPP
+#define CONTROL_DOMAIN_AGGLOMERATION_POLICY_HPP 1
+
+#include <kernel/base_header.hpp>
+#include <kernel/util/dist.hpp>
+#include <kernel/util/exception.hpp>
+#include <kernel/util/math.hpp>
+#include <kernel/util/time_stamp.hpp>
+
+#include <deque>
+#include <vector>
+
+namespace FEAT
+{
+  namespace Control
+  {
+    namespace Domain
+    {
+      /**
+       * \brief Automatic coarse-level agglomeration policy
+       *
+       * This class decides on which levels of a multigrid hierarchy the active communicator should be
+       * shrunk, i.e. on which levels the PartiDomainControl should insert a new domain layer, so that
+       * the coarse levels are not dominated by the message latency.
+       *
+       * The decision is based on a simple performance model for a single visit of a level within a
+       * multigrid cycle: if a level with \e N DOFs is distributed over \e p processes, so that each
+       * process owns <em>n = N/p</em> DOFs, the runtime of one level visit is estimated by
+       *
+       * \f[T(p) = w\cdot n\cdot t_{dof} + s\cdot\big(2d\cdot\alpha + 8\cdot n^{(d-1)/d}\cdot\beta\big)
+       *   + r\cdot\lceil\log_2(p)\rceil\cdot\alpha\f]
+       *
+       * where
+       * - \e w is the work per DOF and level visit, measured in vector updates,
+       * - \e s is the number of halo synchronisations per level visit,
+       * - \e r is the number of global reductions per level visit,
+       * - \e d is the shape dimension of the mesh,
+       * - \f$t_{dof}\f$ is the time for a single DOF of a vector update,
+       * - \f$\alpha\f$ is the message latency and \f$\beta\f$ is the transfer time per byte.
+       *
+       * Starting on the finest level with all processes, the policy walks down the hierarchy and
+       * shrinks the process count \e p on a level by the divisor \e f of \e p which minimises
+       * \f$T(p/f)\f$ plus the cost of the muxer gather, which is estimated by
+       * \f$\lceil\log_2(f)\rceil\cdot\alpha + 8\cdot(f-1)\cdot n\cdot\beta\f$.
+       * Moreover, the communicator is always shrunk if the number of DOFs per process drops below
+       * a user-defined threshold.
+       *
+       * The machine parameters \f$t_{dof}\f$, \f$\alpha\f$ and \f$\beta\f$ can either be set
+       * manually or measured by the calibrate() function at application startup.
+       */
+      class AgglomerationPolicy
+      {
+      protected:
+        /// time per DOF of a vector update in seconds
+        double _time_dof;
+        /// message latency in seconds
+        double _latency;
+        /// transfer time per byte in seconds
+        double _time_byte;
+        /// work per DOF and level visit in vector updates
+        double _work_per_dof;
+        /// number of halo synchronisations per level visit
+        double _syncs_per_level;
+        /// number of global reductions per level visit
+        double _reductions_per_level;
+        /// number of DOFs per element
+        double _dofs_per_elem;
+        /// minimum number of DOFs per process
+        double _min_dofs_per_rank;
+        /// specifies whether the machine parameters have been calibrated
+        bool _calibrated;
+
+      public:
+        /**
+         * \brief Constructor
+         *
+         * Creates a policy with default machine parameters, which correspond to a commodity
+         * cluster with an InfiniBand network.
+         */
+        AgglomerationPolicy() :
+          _time_dof(1E-9),
+          _latency(2E-6),
+          _time_byte(1E-10),
+          _work_per_dof(30.0),
+          _syncs_per_level(8.0),
+          _reductions_per_level(0.0),
+          _dofs_per_elem(1.0),
+          _min_dofs_per_rank(1000.0),
+          _calibrated(false)
+        {
+        }
+
+        /**
+         * \brief Sets the machine parameters manually
+         *
+         * \param[in] time_dof
+         * The time for a single DOF of a vector update in seconds. Must be > 0.
+         *
+         * \param[in] latency
+         * The message latency in seconds. Must be >= 0.
+         *
+         * \param[in] time_byte
+         * The transfer time per byte in seconds, i.e. the inverse bandwidth. Must be >= 0.
+         */
+        void set_machine(double time_dof, double latency, double time_byte)
+        {
+          XASSERTM(time_dof > 0.0, "time per DOF must be positive");
+          XASSERTM(latency >= 0.0, "latency must be non-negative");
+          XASSERTM(time_byte >= 0.0, "time per byte must be non-negative");
+          _time_dof = time_dof;
+          _latency = latency;
+          _time_byte = time_byte;
+          _calibrated = true;
+        }
+
+        /**
+         * \brief Sets the parameters of the solver model
+         *
+         * \param[in] work_per_dof
+         * The work per DOF and level visit measured in vector updates. Must be > 0.
+         *
+         * \param[in] syncs_per_level
+         * The number of halo synchronisations per level visit. Must be >= 0.
+         *
+         * \param[in] reductions_per_level
+         * The number of global reductions per level visit. Must be >= 0.
+         */
+        void set_model(double work_per_dof, double syncs_per_level, double reductions_per_level)
+        {
+          XASSERTM(work_per_dof > 0.0, "work per DOF must be positive");
+          XASSERTM(syncs_per_level >= 0.0, "synchronisations per level must be non-negative");
+          XASSERTM(reductions_per_level >= 0.0, "reductions per level must be non-negative");
+          _work_per_dof = work_per_dof;
+          _syncs_per_level = syncs_per_level;
+          _reductions_per_level = reductions_per_level;
+        }
+
+        /**
+         * \brief Sets the number of DOFs per element
+         *
+         * \param[in] dofs_per_elem
+         * The (average) number of DOFs per element, e.g. 1 for Q1 and 4 for Q2. Must be > 0.
+         */
+        void set_dofs_per_elem(double dofs_per_elem)
+        {
+          XASSERTM(dofs_per_elem > 0.0, "DOFs per element must be positive");
+          _dofs_per_elem = dofs_per_elem;
+        }
+
+        /**
+         * \brief Sets the minimum number of DOFs per process
+         *
+         * \param[in] min_dofs_per_rank
+         * The number of DOFs per process below which the communicator is always shrunk.
+         */
+        void set_min_dofs_per_rank(double min_dofs_per_rank)
+        {
+          XASSERTM(min_dofs_per_rank >= 0.0, "DOFs per rank must be non-negative");
+          _min_dofs_per_rank = min_dofs_per_rank;
+        }
+
+        /// \returns The number of DOFs per element.
+        double get_dofs_per_elem() const
+        {
+          return _dofs_per_elem;
+        }
+
+        /// \returns The minimum number of DOFs per process.
+        double get_min_dofs_per_rank() const
+        {
+          return _min_dofs_per_rank;
+        }
+
+        /// \returns The work per DOF and level visit measured in vector updates.
+        double get_work_per_dof() const
+        {
+          return _work_per_dof;
+        }
+
+        /// \returns The number of halo synchronisations per level visit.
+        double get_syncs_per_level() const
+        {
+          return _syncs_per_level;
+        }
+
+        /// \returns The number of global reductions per level visit.
+        double get_reductions_per_level() const
+        {
+          return _reductions_per_level;
+        }
+
+        /// \returns The time for a single DOF of a vector update in seconds.
+        double get_time_dof() const
+        {
+          return _time_dof;
+        }
+
+        /// \returns The message latency in seconds.
+        double get_latency() const
+        {
+          return _latency;
+        }
+
+        /// \returns The transfer time per byte in seconds.
+        double get_time_byte() const
+        {
+          return _time_byte;
+        }
+
+        /// \returns \c true, if the machine parameters have been set or calibrated, otherwise \c false.
+        bool is_calibrated() const
+        {
+          return _calibrated;
+        }
+
+        /**
+         * \brief Measures the machine parameters
+         *
+         * This function measures the time per DOF of a vector update as well as the latency and
+         * bandwidth of point-to-point messages between pairs of processes. The results are reduced
+         * over the communicator, so that all processes obtain the same (i.e. the worst) parameters.
+         *
+         * \attention
+         * This function is a collective operation and must be called by all processes in the
+         * communicator.
+         *
+         * \param[in] comm
+         * The communicator whose processes are to be measured.
+         */
+        void calibrate(const Dist::Comm& comm)
+        {
+          double params[3] =
+          {
+            _measure_time_dof(),
+            _latency,
+            _time_byte
+          };
+
+          if(comm.size() > 1)
+          {
+            // exchange messages with a partner process; the last process idles for odd sizes
+            const int rank = comm.rank();
+            const int partner = (rank ^ 1);
+            const bool active = (partner < comm.size());
+            const std::size_t big_size = std::size_t(1) << 17;
+            const int num_reps = 10;
+            std::vector<double> buffer(big_size, 0.0);
+
+            // warm-up and synchronise
+            comm.barrier();
+
+            // measure latency by small messages and bandwidth by large messages
+            double time_small(0.0), time_big(0.0);
+            if(active)
+            {
+              time_small = _ping_pong(comm, partner, buffer.data(), std::size_t(1), num_reps);
+              time_big = _ping_pong(comm, partner, buffer.data(), big_size, num_reps);
+            }
+            params[1] = time_small;
+            params[2] = Math::max(time_big - time_small, 0.0) / double(big_size * sizeof(double));
+
+            // idle processes do not contribute
+            if(!active)
+              params[1] = params[2] = 0.0;
+          }
+
+          // reduce to worst parameters
+          comm.allreduce(params, params, std::size_t(3), Dist::op_max);
+          _time_dof = Math::max(params[0], 1E-12);
+          _latency = params[1];
+          _time_byte = params[2];
+          _calibrated = true;
+        }
+
+        /**
+         * \brief Estimates the runtime of a single level visit
+         *
+         * \param[in] num_dofs
+         * The total number of DOFs on the level.
+         *
+         * \param[in] num_procs
+         * The number of processes over which the level is distributed.
+         *
+         * \param[in] shape_dim
+         * The shape dimension of the mesh.
+         *
+         * \returns The estimated runtime in seconds.
+         */
+        double estimate_level_time(double num_dofs, int num_procs, int shape_dim) const
+        {
+          const double n = num_dofs / double(num_procs);
+          double t = _work_per_dof * n * _time_dof;
+
+          // no communication required on a single process
+          if(num_procs <= 1)
+            return t;
+
+          const double halo = Math::pow(n, double(shape_dim - 1) / double(shape_dim));
+          t += _syncs_per_level * (double(2*shape_dim) * _latency + 8.0 * halo * _time_byte);
+          t += _reductions_per_level * _log2_ceil(num_procs) * _latency;
+          return t;
+        }
+
+        /**
+         * \brief Estimates the runtime of a muxer join/split
+         *
+         * \param[in] num_dofs
+         * The total number of DOFs on the level.
+         *
+         * \param[in] num_procs
+         * The number of processes of the child layer.
+         *
+         * \param[in] num_sibs
+         * The number of siblings per parent process.
+         *
+         * \returns The estimated runtime in seconds.
+         */
+        double estimate_muxer_time(double num_dofs, int num_procs, int num_sibs) const
+        {
+          if(num_sibs <= 1)
+            return 0.0;
+          const double n = num_dofs / double(num_procs);
+          return _log2_ceil(num_sibs) * _latency + 8.0 * double(num_sibs - 1) * n * _time_byte;
+        }
+
+        /**
+         * \brief Computes the desired levels for a multi-layered hierarchy
+         *
+         * \param[in] num_procs
+         * The number of processes in the main communicator.
+         *
+         * \param[in] num_base_elems
+         * The number of elements of the base mesh on level 0.
+         *
+         * \param[in] shape_dim
+         * The shape dimension of the mesh.
+         *
+         * \param[in] level_max
+         * The desired maximum refinement level.
+         *
+         * \param[in] level_min
+         * The desired minimum refinement level.
+         *
+         * \returns
+         * A deque of level/process-count pairs in the format used by
+         * PartiDomainControl::set_desired_levels(), i.e. the first entry is
+         * (level_max, num_procs) and the last entry is (level_min, 0).
+         */
+        std::deque<std::pair<int,int>> compute_desired_levels(int num_procs, Index num_base_elems,
+          int shape_dim, int level_max, int level_min) const
+        {
+          XASSERT(num_procs > 0);
+          XASSERT(shape_dim > 0);
+          XASSERT((level_min >= 0) && (level_min <= level_max));
+
+          std::deque<std::pair<int,int>> levels;
+          levels.emplace_back(level_max, num_procs);
+
+          const double refine_factor = double(1 << shape_dim);
+          int nprocs = num_procs;
+
+          // walk down the hierarchy; the finest level always belongs to the main layer
+          double num_elems = double(num_base_elems) * Math::pow(refine_factor, double(level_max));
+          for(int lvl(level_max - 1); (lvl >= level_min) && (nprocs > 1); --lvl)
+          {
+            num_elems /= refine_factor;
+            const double num_dofs = _dofs_per_elem * num_elems;
+
+            // test all divisors of the current process count
+            int best_procs = nprocs;
+            double best_time = estimate_level_time(num_dofs, nprocs, shape_dim);
+            const bool force = (num_dofs < _min_dofs_per_rank * double(nprocs));
+            if(force)
+              best_time = Math::huge<double>();
+
+            for(int np(nprocs - 1); np > 0; --np)
+            {
+              if(nprocs % np != 0)
+                continue;
+
+              // each process needs at least one element
+              if(double(np) > num_elems)
+                continue;
+
+              // respect the DOF threshold unless only one process remains
+              if(force && (np > 1) && (num_dofs < _min_dofs_per_rank * double(np)))
+                continue;
+
+              const double t = estimate_level_time(num_dofs, np, shape_dim)
+                + estimate_muxer_time(num_dofs, nprocs, nprocs / np);
+              if(t < best_time)
+              {
+                best_time = t;
+                best_procs = np;
+              }
+            }
+
+            // shrink the communicator on this level?
+            if(best_procs < nprocs)
+            {
+              levels.emplace_back(lvl, best_procs);
+              nprocs = best_procs;
+            }
+          }
+
+          levels.emplace_back(level_min, 0);
+          return levels;
+        }
+
+      protected:
+        /// computes ceil(log2(n))
+        static double _log2_ceil(int n)
+        {
+          int k(0);
+          while((1 << k) < n)
+            ++k;
+          return double(k);
+        }
+
+        /// measures the time per DOF of a vector update
+        static double _measure_time_dof()
+        {
+          const std::size_t n = std::size_t(1) << 16;
+          const int num_reps = 20;
+          std::vector<double> x(n, 1.0), y(n, 0.0);
+
+          TimeStamp stamp;
+          for(int k(0); k < num_reps; ++k)
+          {
+            for(std::size_t i(0); i < n; ++i)
+              y[i] += 0.5 * x[i];
+          }
+          const double t = stamp.elapsed_now();
+
+          // use the result, so that the loop is not optimised away
+          if(!(y.back() > 0.0))
+            return 1E-9;
+
+          return t / double(n * std::size_t(num_reps));
+        }
+
+        /// measures the time of a single message by ping-pong
+        static double _ping_pong(const Dist::Comm& comm, int partner, double* buffer, std::size_t count, int num_reps)
+        {
+          const bool sender = (comm.rank() < partner);
+          TimeStamp stamp;
+          for(int k(0); k < num_reps; ++k)
+          {
+            if(sender)
+            {
+              comm.send(buffer, count, partner);
+              comm.recv(buffer, count, partner);
+            }
+            else
+            {
+              comm.recv(buffer, count, partner);
+              comm.send(buffer, count, partner);
+            }
+          }
+          return stamp.elapsed_now() / double(2 * num_reps);
+        }
+      }; // class AgglomerationPolicy
+    } // namespace Domain
+  } // namespace Control
+} // namespace FEAT
+
+#endif // CONTROL_DOMAIN_AGGLOMERATION_POLICY_HPP
@@ -11,19 +11,26 @@
 
 #include <kernel/util/dist.hpp>
 #include <kernel/util/dist_file_io.hpp>
+#include <kernel/util/binary_stream.hpp>
+#include <kernel/util/hash.hpp>
 #include <kernel/util/runtime.hpp>
 #include <kernel/util/simple_arg_parser.hpp>
 #include <kernel/util/property_map.hpp>
 #include <kernel/util/statistics.hpp>
 #include <kernel/geometry/mesh_file_reader.hpp>
 #include <kernel/geometry/mesh_node.hpp>
+#include <kernel/geometry/mesh_node_serialiser.hpp>
 #include <kernel/geometry/partition_set.hpp>
 #include <kernel/geometry/parti_2lvl.hpp>
 #include <kernel/geometry/parti_iterative.hpp>
 #include <kernel/geometry/parti_metis.hpp>
 
+#include <control/domain/agglomeration_policy.hpp>
 #include <control/domain/domain_control.hpp>
 
+#include <cstdint>
+#include <sstream>
+
 namespace FEAT
 {
   namespace Control
@@ -55,6 +62,14 @@ namespace FEAT
         args.support("parti-genetic-time", "<time-init> <time-mutate>\n"
           "Specifies the time for initial distribution and mutation for the genetic partitioner."
         );
+        args.support("parti-cache", "<pattern>\n"
+          "Specifies the filename pattern of the per-rank hierarchy cache files.\n"
+          "The pattern must contain a block of asterisks as a placeholder for the rank."
+        );
+        args.support("parti-auto-layers", "[<min-dofs-per-rank>] [<dofs-per-elem>]\n"
+          "Enables the automatic creation of the coarse layers by the agglomeration policy,\n"
+          "which decides on which levels the active communicator is shrunk."
+        );
       }
 
       /**
@@ -171,6 +186,18 @@ namespace FEAT
         /// the partition ancestry deque
         std::deque<Ancestor> _ancestry;
 
+        /// the filename pattern of the hierarchy cache files
+        String _hierarchy_cache;
+        /// the hash of the base-mesh, partitioning and level settings
+        String _hierarchy_hash;
+        /// specifies whether the hierarchy was restored from the cache
+        bool _hierarchy_restored;
+
+        /// choose the layers automatically?
+        bool _auto_layers;
+        /// the agglomeration policy for automatic layers
+        AgglomerationPolicy _agglomeration;
+
       public:
         /**
          * \brief Constructor
@@ -196,7 +223,12 @@ namespace FEAT
           _required_elems_per_rank(1),
           _genetic_time_init(5),
           _genetic_time_mutate(5),
-          _ancestry()
+          _ancestry(),
+          _hierarchy_cache(),
+          _hierarchy_hash(),
+          _hierarchy_restored(false),
+          _auto_layers(false),
+          _agglomeration()
         {
         }
 
@@ -264,6 +296,25 @@ namespace FEAT
           // parse --parti-genetic-time <time-init> <time-mutate>
           args.parse("parti-genetic-time", _genetic_time_init, _genetic_time_mutate);
 
+          // parse --parti-cache <pattern>
+          args.parse("parti-cache", _hierarchy_cache);
+
+          // parse --parti-auto-layers [<min-dofs-per-rank>] [<dofs-per-elem>]
+          if(args.check("parti-auto-layers") >= 0)
+          {
+            double min_dofs_per_rank = _agglomeration.get_min_dofs_per_rank();
+            double dofs_per_elem = _agglomeration.get_dofs_per_elem();
+            if((args.parse("parti-auto-layers", min_dofs_per_rank, dofs_per_elem) < 0) ||
+              (min_dofs_per_rank < 0.0) || (dofs_per_elem <= 0.0))
+            {
+              this->_comm.print("ERROR: Failed to parse 'parti-auto-layers'");
+              return false;
+            }
+            _agglomeration.set_min_dofs_per_rank(min_dofs_per_rank);
+            _agglomeration.set_dofs_per_elem(dofs_per_elem);
+            _auto_layers = true;
+          }
+
           // okay
           return true;
         }
@@ -346,9 +397,109 @@ namespace FEAT
             }
           }
 
+          auto parti_cache_p = pmap.query("parti-cache");
+          if(parti_cache_p.second)
+          {
+            _hierarchy_cache = parti_cache_p.first.trim();
+          }
+
+          auto parti_auto_layers_p = pmap.query("parti-auto-layers");
+          if(parti_auto_layers_p.second)
+          {
+            std::deque<String> sv = parti_auto_layers_p.first.split_by_whitespaces();
+            double min_dofs_per_rank = _agglomeration.get_min_dofs_per_rank();
+            double dofs_per_elem = _agglomeration.get_dofs_per_elem();
+            if((sv.size() > std::size_t(2)) ||
+              ((sv.size() > std::size_t(0)) && (!sv.at(0).parse(min_dofs_per_rank) || (min_dofs_per_rank < 0.0))) ||
+              ((sv.size() > std::size_t(1)) && (!sv.at(1).parse(dofs_per_elem) || (dofs_per_elem <= 0.0))))
+            {
+              this->_comm.print("ERROR: Failed to parse 'parti-auto-layers'");
+              return false;
+            }
+            _agglomeration.set_min_dofs_per_rank(min_dofs_per_rank);
+            _agglomeration.set_dofs_per_elem(dofs_per_elem);
+            _auto_layers = true;
+          }
+
           return true;
         }
 
+        /**
+         * \brief Sets the filename pattern for the hierarchy cache.
+         *
+         * If a cache pattern is set, the #create() function computes a hash of the base-mesh, the
+         * partitioning and the level settings and tries to restore the whole partitioned mesh hierarchy
+         * from the per-rank cache files. If at least one of the files does not exist or was created
+         * with a different hash, the hierarchy is created as usual and the cache files are (re)written.
+         *
+         * \param[in] pattern
+         * The filename pattern of the cache files; see DistFileIO for details. May be empty to disable
+         * the cache.
+         */
+        void set_hierarchy_cache(const String& pattern)
+        {
+          _hierarchy_cache = pattern;
+        }
+
+        /// \returns The filename pattern of the hierarchy cache.
+        const String& get_hierarchy_cache() const
+        {
+          return _hierarchy_cache;
+        }
+
+        /**
+         * \brief Returns the hierarchy hash.
+         *
+         * \note
+         * The hash is only computed by the #create() function if a hierarchy cache was set.
+         *
+         * \returns The hash of the base-mesh, partitioning and level settings.
+         */
+        const String& get_hierarchy_hash() const
+        {
+          return _hierarchy_hash;
+        }
+
+        /// \returns \c true, if the hierarchy was restored from the cache, otherwise \c false.
+        bool is_hierarchy_restored() const
+        {
+          return _hierarchy_restored;
+        }
+
+        /**
+         * \brief Enables or disables the automatic creation of the coarse layers.
+         *
+         * If enabled and if the controller supports multi-layered hierarchies, the #create() function
+         * replaces a single-layered level range given by set_desired_levels() by the multi-layered
+         * hierarchy chosen by the agglomeration policy for the base-mesh. If the policy has not been
+         * calibrated before, the machine parameters are measured on the main communicator.
+         *
+         * \param[in] auto_layers
+         * Specifies whether the layers are to be chosen automatically.
+         */
+        void set_auto_layers(bool auto_layers)
+        {
+          _auto_layers = auto_layers;
+        }
+
+        /// \returns \c true, if the layers are chosen automatically, otherwise \c false.
+        bool get_auto_layers() const
+        {
+          return _auto_layers;
+        }
+
+        /// \returns A reference to the agglomeration policy for automatic layers.
+        AgglomerationPolicy& get_agglomeration_policy()
+        {
+          return _agglomeration;
+        }
+
+        /// \returns A const reference to the agglomeration policy for automatic layers.
+        const AgglomerationPolicy& get_agglomeration_policy() const
+        {
+          return _agglomeration;
+        }
+
         /**
          * \brief Sets the adapt-mode for refinement
          *
@@ -674,9 +825,25 @@ namespace FEAT
           // try to the read the base-mesh
           mesh_reader.parse(*base_mesh_node, this->_atlas, &_parti_set);
 
+          // try to restore the hierarchy from the cache; this also restores the layers chosen by
+          // the agglomeration policy when the cache was written
+          if(!_hierarchy_cache.empty())
+          {
+            _hierarchy_hash = this->_compute_hierarchy_hash(*base_mesh_node);
+            _hierarchy_restored = this->_load_hierarchy();
+          }
+
+          // let the agglomeration policy choose the layers
+          if(_auto_layers && !_hierarchy_restored)
+            this->_apply_agglomeration_policy(*base_mesh_node);
+
           // create the domain control
+          if(_hierarchy_restored)
+          {
+            // nothing to do here
+          }
 #ifdef FEAT_HAVE_MPI
-          if(this->_comm.size() == 1)
+          else if(this->_comm.size() == 1)
           {
             // We've got just one process, so it's a simple choice:
             this->_create_single_process(base_mesh_node);
@@ -693,12 +860,17 @@ namespace FEAT
             this->_create_single_layered(base_mesh_node);
           }
 #else // not FEAT_HAVE_MPI
+          else
           {
             // In the non-MPI case, we always have only one process:
             this->_create_single_process(base_mesh_node);
           }
 #endif // FEAT_HAVE_MPI
 
+          // write the cache files if the hierarchy was not restored
+          if(!_hierarchy_cache.empty() && !_hierarchy_restored)
+            this->_save_hierarchy();
+
           // cleanup
           _parti_set.clear();
 
@@ -745,7 +917,353 @@ namespace FEAT
           return s;
         }
 
+        /**
+         * \brief Writes the grid transfer operators of a system level hierarchy into cache files.
+         *
+         * The transfers are written via the system levels' write_transfers() function together with
+         * the hierarchy hash, so that load_system_transfers() can validate them in a later run.
+         *
+         * \param[in] system_levels
+         * The system levels whose transfers are to be written.
+         *
+         * \param[in] pattern
+         * The filename pattern of the cache files; see DistFileIO for details.
+         *
+         * \param[in] tag
+         * An additional tag identifying the assembly settings, e.g. the cubature rule name.
+         */
+        template<typename SystemLevel_>
+        void save_system_transfers(const std::deque<std::shared_ptr<SystemLevel_>>& system_levels,
+          const String& pattern, const String& tag = "") const
+        {
+          XASSERTM(!_hierarchy_hash.empty(), "hierarchy hash is missing; did you set a hierarchy cache?");
+
+          BinaryStream bs;
+          _write_cache(bs, _hierarchy_hash);
+          _write_cache(bs, tag);
+          _write_cache(bs, std::int64_t(system_levels.size()));
+          for(const auto& sys_lvl : system_levels)
+            sys_lvl->write_transfers(bs);
+
+          DistFileIO::write_sequence(bs, pattern, this->_comm);
+        }
+
+        /**
+         * \brief Tries to read the grid transfer operators of a system level hierarchy from cache files.
+         *
+         * \attention
+         * The gates and coarse muxers of the system levels must have been assembled before.
+         *
+         * \param[inout] system_levels
+         * The system levels whose transfers are to be read.
+         *
+         * \param[in] pattern
+         * The filename pattern of the cache files; see DistFileIO for details.
+         *
+         * \param[in] tag
+         * An additional tag identifying the assembly settings; must match the tag used for saving.
+         *
+         * \returns
+         * \c true, if the transfers were read on all processes, or \c false, if at least one cache file
+         * is missing or does not match the hierarchy hash, tag or number of levels.
+         */
+        template<typename SystemLevel_>
+        bool load_system_transfers(std::deque<std::shared_ptr<SystemLevel_>>& system_levels,
+          const String& pattern, const String& tag = "") const
+        {
+          XASSERTM(!_hierarchy_hash.empty(), "hierarchy hash is missing; did you set a hierarchy cache?");
+
+          if(!DistFileIO::exists_sequence(pattern, this->_comm))
+            return false;
+
+          BinaryStream bs;
+          DistFileIO::read_sequence(bs, pattern, this->_comm);
+
+          // validate the header on all processes
+          String hash, tag2;
+          std::int64_t num_levels(-1);
+          int valid = (_read_cache(bs, hash) && _read_cache(bs, tag2) && _read_cache(bs, num_levels) &&
+            (hash == _hierarchy_hash) && (tag2 == tag) && (num_levels == std::int64_t(system_levels.size())) ? 1 : 0);
+          this->_comm.allreduce(&valid, &valid, std::size_t(1), Dist::op_min);
+          if(valid == 0)
+            return false;
+
+          for(auto& sys_lvl : system_levels)
+            sys_lvl->read_transfers(bs);
+
+          return true;
+        }
+
       protected:
+        /// writes an integer into a cache stream
+        static void _write_cache(BinaryStream& bs, std::int64_t value)
+        {
+          bs.write(reinterpret_cast<const char*>(&value), std::streamsize(sizeof(value)));
+        }
+
+        /// writes a string into a cache stream
+        static void _write_cache(BinaryStream& bs, const String& value)
+        {
+          _write_cache(bs, std::int64_t(value.size()));
+          bs.write(value.data(), std::streamsize(value.size()));
+        }
+
+        /// reads an integer from a cache stream
+        static bool _read_cache(BinaryStream& bs, std::int64_t& value)
+        {
+          bs.read(reinterpret_cast<char*>(&value), std::streamsize(sizeof(value)));
+          return bs.good();
+        }
+
+        /// reads a string from a cache stream
+        static bool _read_cache(BinaryStream& bs, String& value)
+        {
+          std::int64_t len(0);
+          if(!_read_cache(bs, len) || (len < 0) || (len > std::int64_t(bs.size())))
+            return false;
+          std::vector<char> buf(std::size_t(len) + 1u, '\0');
+          bs.read(buf.data(), std::streamsize(len));
+          value = String(buf.data(), std::size_t(len));
+          return bs.good();
+        }
+
+        /**
+         * \brief Computes the hierarchy hash.
+         *
+         * The hash is a 64 bit FNV-1a hash of the base-mesh node including its mesh-parts, the extern
+         * partitions, the partitioner and level settings, the inputs of the agglomeration policy and the
+         * number of processes.
+         *
+         * \param[in] base_mesh_node
+         * The base-mesh node that the hierarchy is to be derived from.
+         *
+         * \returns The hierarchy hash as a hexadecimal string.
+         */
+        String _compute_hierarchy_hash(const MeshNodeType& base_mesh_node) const
+        {
+          BinaryStream bs;
+
+          // write all settings which affect the hierarchy
+          _write_cache(bs, MeshType::name());
+          _write_cache(bs, std::int64_t(this->_comm.size()));
+          _write_cache(bs, this->format_desired_levels());
+          _write_cache(bs, stringify(_adapt_mode));
+          _write_cache(bs, std::int64_t(_allow_parti_extern ? 1 : 0));
+          _write_cache(bs, std::int64_t(_allow_parti_2level ? 1 : 0));
+          _write_cache(bs, std::int64_t(_allow_parti_metis ? 1 : 0));
+          _write_cache(bs, std::int64_t(_allow_parti_genetic ? 1 : 0));
+          _write_cache(bs, std::int64_t(_allow_parti_naive ? 1 : 0));
+          _write_cache(bs, std::int64_t(_support_multi_layered ? 1 : 0));
+          _write_cache(bs, std::int64_t(_required_elems_per_rank));
+          _write_cache(bs, stringify(_genetic_time_init) + " " + stringify(_genetic_time_mutate));
+
+          // write the inputs of the agglomeration policy; the machine parameters are measured and
+          // must not enter the hash, as the levels chosen from them are stored in the cache file
+          _write_cache(bs, std::int64_t(_auto_layers ? 1 : 0));
+          if(_auto_layers)
+          {
+            _write_cache(bs, stringify(_agglomeration.get_min_dofs_per_rank()) + " " +
+              stringify(_agglomeration.get_dofs_per_elem()) + " " +
+              stringify(_agglomeration.get_work_per_dof()) + " " +
+              stringify(_agglomeration.get_syncs_per_level()) + " " +
+              stringify(_agglomeration.get_reductions_per_level()));
+          }
+          for(const auto& name : _extern_parti_names)
+            _write_cache(bs, name);
+
+          // write the extern partitions
+          for(const auto& part : _parti_set.get_partitions())
+          {
+            _write_cache(bs, part.get_name());
+            _write_cache(bs, std::int64_t(part.get_priority()));
+            _write_cache(bs, std::int64_t(part.get_level()));
+            const Adjacency::Graph& graph = part.get_patches();
+            _write_cache(bs, std::int64_t(graph.get_num_nodes_domain()));
+            _write_cache(bs, std::int64_t(graph.get_num_indices()));
+            bs.write(reinterpret_cast<const char*>(graph.get_domain_ptr()),
+              std::streamsize(sizeof(Index) * (graph.get_num_nodes_domain() + 1u)));
+            bs.write(reinterpret_cast<const char*>(graph.get_image_idx()),
+              std::streamsize(sizeof(Index) * graph.get_num_indices()));
+          }
+
+          // write the base-mesh node
+          Geometry::MeshNodeSerialiser<MeshType>::write(bs, base_mesh_node);
+
+          // compute FNV-1a hash
+          HashFNV1a hash;
+          hash.feed(bs.data(), std::size_t(bs.size()));
+
+          std::ostringstream oss;
+          oss << std::hex << hash.value();
+          return oss.str();
+        }
+
+        /**
+         * \brief Writes the hierarchy into the cache files.
+         *
+         * Each process writes its layers, levels and mesh nodes as well as the chosen levels and
+         * the ancestry information into its own cache file.
+         */
+        void _save_hierarchy() const
+        {
+          BinaryStream bs;
+          _write_cache(bs, _hierarchy_hash);
+
+          // write desired levels, which may have been chosen by the agglomeration policy
+          _write_cache(bs, std::int64_t(_desired_levels.size()));
+          for(const auto& dl : _desired_levels)
+          {
+            _write_cache(bs, std::int64_t(dl.first));
+            _write_cache(bs, std::int64_t(dl.second));
+          }
+
+          // write chosen levels
+          _write_cache(bs, std::int64_t(_chosen_levels.size()));
+          for(const auto& cl : _chosen_levels)
+          {
+            _write_cache(bs, std::int64_t(cl.first));
+            _write_cache(bs, std::int64_t(cl.second));
+          }
+
+          // write ancestry; the communicators and partition graphs are not required anymore
+          _write_cache(bs, std::int64_t(_ancestry.size()));
+          for(const auto& anc : _ancestry)
+          {
+            _write_cache(bs, std::int64_t(anc.layer));
+            _write_cache(bs, std::int64_t(anc.layer_p));
+            _write_cache(bs, std::int64_t(anc.num_procs));
+            _write_cache(bs, std::int64_t(anc.num_parts));
+            _write_cache(bs, std::int64_t(anc.desired_level_max));
+            _write_cache(bs, std::int64_t(anc.desired_level_min));
+            _write_cache(bs, std::int64_t(anc.progeny_group));
+            _write_cache(bs, std::int64_t(anc.progeny_child));
+            _write_cache(bs, std::int64_t(anc.progeny_first));
+            _write_cache(bs, std::int64_t(anc.progeny_count));
+            _write_cache(bs, std::int64_t(anc.parti_level));
+            _write_cache(bs, std::int64_t(anc.parti_apriori ? 1 : 0));
+            _write_cache(bs, anc.parti_info);
+          }
+
+          // write layers and their levels
+          _write_cache(bs, std::int64_t(this->_layers.size()));
+          for(std::size_t i(0); i < this->_layers.size(); ++i)
+          {
+            const std::vector<int>& neighbours = this->_layers.at(i)->get_neighbour_ranks();
+            _write_cache(bs, std::int64_t(neighbours.size()));
+            for(int r : neighbours)
+              _write_cache(bs, std::int64_t(r));
+
+            const auto& levels = this->_layer_levels.at(i);
+            _write_cache(bs, std::int64_t(levels.size()));
+            for(const auto& lvl : levels)
+            {
+              _write_cache(bs, std::int64_t(lvl->get_level_index()));
+              Geometry::MeshNodeSerialiser<MeshType>::write(bs, *lvl->get_mesh_node());
+            }
+          }
+
+          DistFileIO::write_sequence(bs, _hierarchy_cache, this->_comm);
+        }
+
+        /**
+         * \brief Tries to restore the hierarchy from the cache files.
+         *
+         * The layer communicators are recreated as in the regular creation, whereas the partitioning
+         * and refinement steps are replaced by reading the mesh nodes from the cache files.
+         *
+         * \returns
+         * \c true, if the hierarchy was restored, or \c false, if at least one cache file is missing
+         * or was created with a different hierarchy hash.
+         */
+        bool _load_hierarchy()
+        {
+          if(!DistFileIO::exists_sequence(_hierarchy_cache, this->_comm))
+            return false;
+
+          BinaryStream bs;
+          DistFileIO::read_sequence(bs, _hierarchy_cache, this->_comm);
+
+          // validate the hash on all processes
+          String hash;
+          int valid = (_read_cache(bs, hash) && (hash == _hierarchy_hash) ? 1 : 0);
+          this->_comm.allreduce(&valid, &valid, std::size_t(1), Dist::op_min);
+          if(valid == 0)
+            return false;
+
+          // all further read errors indicate a corrupt cache file
+          auto read_int = [&bs]() -> std::int64_t
+          {
+            std::int64_t value(0);
+            if(!_read_cache(bs, value))
+              throw INTERNAL_ERROR("Corrupt hierarchy cache file");
+            return value;
+          };
+
+          // read desired levels
+          _desired_levels.clear();
+          for(std::int64_t i(0), n(read_int()); i < n; ++i)
+          {
+            const int lvl = int(read_int());
+            _desired_levels.push_back(std::make_pair(lvl, int(read_int())));
+          }
+
+          // read chosen levels
+          for(std::int64_t i(0), n(read_int()); i < n; ++i)
+          {
+            const int lvl = int(read_int());
+            _chosen_levels.push_back(std::make_pair(lvl, int(read_int())));
+          }
+
+          // read ancestry
+          _ancestry.resize(std::size_t(read_int()));
+          for(auto& anc : _ancestry)
+          {
+            anc.layer = int(read_int());
+            anc.layer_p = int(read_int());
+            anc.num_procs = int(read_int());
+            anc.num_parts = int(read_int());
+            anc.desired_level_max = int(read_int());
+            anc.desired_level_min = int(read_int());
+            anc.progeny_group = int(read_int());
+            anc.progeny_child = int(read_int());
+            anc.progeny_first = int(read_int());
+            anc.progeny_count = int(read_int());
+            anc.parti_level = int(read_int());
+            anc.parti_apriori = (read_int() != 0);
+            if(!_read_cache(bs, anc.parti_info))
+              throw INTERNAL_ERROR("Corrupt hierarchy cache file");
+          }
+
+          // create the layers; this is independent of the partitioning
+#ifdef FEAT_HAVE_MPI
+          if((this->_comm.size() > 1) && _support_multi_layered && (_desired_levels.size() > std::size_t(2)))
+            this->_create_multi_layers_scattered();
+          else
+#endif // FEAT_HAVE_MPI
+            this->push_layer(std::make_shared<LayerType>(this->_comm.comm_dup(), 0));
+
+          // read layers and their levels
+          if(std::size_t(read_int()) != this->_layers.size())
+            throw INTERNAL_ERROR("Hierarchy cache layer count mismatch");
+          for(std::size_t i(0); i < this->_layers.size(); ++i)
+          {
+            const std::size_t num_neighbours = std::size_t(read_int());
+            std::vector<int> neighbours(num_neighbours);
+            for(auto& r : neighbours)
+              r = int(read_int());
+            this->_layers.at(i)->set_neighbour_ranks(neighbours);
+
+            for(std::int64_t k(0), n(read_int()); k < n; ++k)
+            {
+              const int lvl = int(read_int());
+              std::shared_ptr<MeshNodeType> node(Geometry::MeshNodeSerialiser<MeshType>::read(bs, &this->_atlas));
+              this->push_level_back(int(i), std::make_shared<LevelType>(lvl, node));
+            }
+          }
+
+          return true;
+        }
+
         /**
          * \brief Creates the ancestry for a single layer (or a single process)
          */
@@ -833,6 +1351,28 @@ namespace FEAT
           this->push_level_front(0, std::make_shared<LevelType>(lvl, base_mesh_node));
         }
 
+        /**
+         * \brief Replaces the desired levels by the ones chosen by the agglomeration policy.
+         *
+         * \param[in] base_mesh_node
+         * The base-mesh node from which the hierarchy is to be derived from.
+         */
+        void _apply_agglomeration_policy(const MeshNodeType& base_mesh_node)
+        {
+          // only a single-layered level range is replaced
+          if(!_support_multi_layered || (this->_comm.size() <= 1) || (_desired_levels.size() != std::size_t(2)))
+            return;
+
+          // measure the machine if necessary; this is a collective operation
+          if(!_agglomeration.is_calibrated())
+            _agglomeration.calibrate(this->_comm);
+
+          // all processes compute the same levels, as the calibration is reduced over the communicator
+          _desired_levels = _agglomeration.compute_desired_levels(this->_comm.size(),
+            base_mesh_node.get_mesh()->get_num_elements(), MeshType::shape_dim,
+            _desired_levels.front().first, _desired_levels.back().first);
+        }
+
 
         // Note: all following member functions are only required for parallel builds,
         // so we enclose them in the following #if-block to reduce compile times.
@@ -0,0 +1,299 @@
+// FEAT3: Finite Element Analysis Toolbox, Version 3
+// Copyright (C) 2010 - 2020 by Stefan Turek & the FEAT group
+// FEAT3 is released under the GNU General Public License version 3,
+// see the file 'copyright.txt' in the top level directory for details.
+
+#include <kernel/base_header.hpp>
+#include <kernel/geometry/conformal_mesh.hpp>
+#include <kernel/geometry/mesh_file_reader.hpp>
+#include <kernel/trafo/standard/mapping.hpp>
+#include <kernel/space/lagrange1/element.hpp>
+#include <kernel/cubature/dynamic_factory.hpp>
+#include <control/domain/parti_domain_control.hpp>
+#include <control/scalar_basic.hpp>
+#include <test_system/test_system.hpp>
+
+#include <cstdio>
+#include <sstream>
+
+using namespace FEAT;
+using namespace FEAT::TestSystem;
+
+/**
+ * \brief Test class for the hierarchy cache of the PartiDomainControl.
+ *
+ * \test Creates a domain hierarchy twice with the same cache and checks that the second
+ * hierarchy is restored from the cache and matches the first one. Furthermore, the grid
+ * transfers of a system level hierarchy are written and restored.
+ */
+class HierarchyCacheTest
+  : public TaggedTest<Archs::None, Archs::None>
+{
+public:
+  typedef Geometry::ConformalMesh<Shape::Simplex<2>> MeshType;
+  typedef Trafo::Standard::Mapping<MeshType> TrafoType;
+  typedef Space::Lagrange1::Element<TrafoType> SpaceType;
+  typedef Control::Domain::SimpleDomainLevel<MeshType, TrafoType, SpaceType> DomainLevelType;
+  typedef Control::Domain::PartiDomainControl<DomainLevelType> DomainControlType;
+  typedef Control::ScalarBasicSystemLevel<Mem::Main, double, Index> SystemLevelType;
+
+  HierarchyCacheTest()
+    : TaggedTest<Archs::None, Archs::None>("HierarchyCacheTest")
+  {
+  }
+
+  virtual ~HierarchyCacheTest()
+  {
+  }
+
+  static void write_mesh(std::stringstream& ioss)
+  {
+    // the unit-circle mesh consisting of four triangles
+    ioss << "<FeatMeshFile version=\"1\" mesh=\"conformal:simplex:2:2\">" << std::endl;
+    ioss << "  <Chart name=\"outer\">" << std::endl;
+    ioss << "    <Circle radius=\"1\" midpoint=\"0 0\" domain=\"0 4\" />" << std::endl;
+    ioss << "  </Chart>" << std::endl;
+    ioss << "  <Mesh type=\"conformal:simplex:2:2\" size=\"5 8 4\">" << std::endl;
+    ioss << "    <Vertices>" << std::endl;
+    ioss << "      1 0" << std::endl;
+    ioss << "      0 1" << std::endl;
+    ioss << "      -1 0" << std::endl;
+    ioss << "      0 -1" << std::endl;
+    ioss << "      0 0" << std::endl;
+    ioss << "    </Vertices>" << std::endl;
+    ioss << "    <Topology dim=\"1\">" << std::endl;
+    ioss << "      0 1" << std::endl;
+    ioss << "      1 2" << std::endl;
+    ioss << "      2 3" << std::endl;
+    ioss << "      3 0" << std::endl;
+    ioss << "      0 4" << std::endl;
+    ioss << "      1 4" << std::endl;
+    ioss << "      2 4" << std::endl;
+    ioss << "      3 4" << std::endl;
+    ioss << "    </Topology>" << std::endl;
+    ioss << "    <Topology dim=\"2\">" << std::endl;
+    ioss << "      0 1 4" << std::endl;
+    ioss << "      1 2 4" << std::endl;
+    ioss << "      2 3 4" << std::endl;
+    ioss << "      3 0 4" << std::endl;
+    ioss << "    </Topology>" << std::endl;
+    ioss << "  </Mesh>" << std::endl;
+    ioss << "  <MeshPart name=\"outer\" parent=\"root\" chart=\"outer\" topology=\"full\" size=\"5 4\">" << std::endl;
+    ioss << "    <Mapping dim=\"0\">" << std::endl;
+    ioss << "      0" << std::endl;
+    ioss << "      1" << std::endl;
+    ioss << "      2" << std::endl;
+    ioss << "      3" << std::endl;
+    ioss << "      0" << std::endl;
+    ioss << "    </Mapping>" << std::endl;
+    ioss << "    <Mapping dim=\"1\">" << std::endl;
+    ioss << "      0" << std::endl;
+    ioss << "      1" << std::endl;
+    ioss << "      2" << std::endl;
+    ioss << "      3" << std::endl;
+    ioss << "    </Mapping>" << std::endl;
+    ioss << "    <Topology dim=\"1\">" << std::endl;
+    ioss << "      0 1" << std::endl;
+    ioss << "      1 2" << std::endl;
+    ioss << "      2 3" << std::endl;
+    ioss << "      3 4" << std::endl;
+    ioss << "    </Topology>" << std::endl;
+    ioss << "    <Attribute name=\"param\" dim=\"1\">" << std::endl;
+    ioss << "      0" << std::endl;
+    ioss << "      1" << std::endl;
+    ioss << "      2" << std::endl;
+    ioss << "      3" << std::endl;
+    ioss << "      4" << std::endl;
+    ioss << "    </Attribute>" << std::endl;
+    ioss << "  </MeshPart>" << std::endl;
+    ioss << "</FeatMeshFile>" << std::endl;
+  }
+
+  static void create_domain(DomainControlType& domain, const String& cache, int lvl_max)
+  {
+    std::stringstream ioss;
+    write_mesh(ioss);
+    Geometry::MeshFileReader reader(ioss);
+    domain.set_desired_levels(lvl_max, 0);
+    domain.set_hierarchy_cache(cache);
+    domain.create(reader);
+  }
+
+  static String rank_filename(const String& prefix, const Dist::Comm& comm)
+  {
+    return prefix + stringify(comm.rank()).pad_front(3, '0') + ".bin";
+  }
+
+  void compare_mesh(const MeshType& mesh_1, const MeshType& mesh_2) const
+  {
+    for(int d(0); d < 3; ++d)
+      TEST_CHECK_EQUAL(mesh_1.get_num_entities(d), mesh_2.get_num_entities(d));
+
+    const auto& vtx_1 = mesh_1.get_vertex_set();
+    const auto& vtx_2 = mesh_2.get_vertex_set();
+    for(Index i(0); i < vtx_1.get_num_vertices(); ++i)
+    {
+      for(int j(0); j < 2; ++j)
+        TEST_CHECK_EQUAL(vtx_1[i][j], vtx_2[i][j]);
+    }
+
+    const auto& idx_1 = mesh_1.template get_index_set<2,0>();
+    const auto& idx_2 = mesh_2.template get_index_set<2,0>();
+    for(Index i(0); i < idx_1.get_num_entities(); ++i)
+    {
+      for(int j(0); j < 3; ++j)
+        TEST_CHECK_EQUAL(idx_1(i,j), idx_2(i,j));
+    }
+
+    const auto& fidx_1 = mesh_1.template get_index_set<2,1>();
+    const auto& fidx_2 = mesh_2.template get_index_set<2,1>();
+    for(Index i(0); i < fidx_1.get_num_entities(); ++i)
+    {
+      for(int j(0); j < 3; ++j)
+        TEST_CHECK_EQUAL(fidx_1(i,j), fidx_2(i,j));
+    }
+  }
+
+  void compare_domains(const DomainControlType& domain_1, const DomainControlType& domain_2) const
+  {
+    TEST_CHECK_EQUAL(domain_1.size_physical(), domain_2.size_physical());
+    TEST_CHECK_EQUAL(domain_1.size_virtual(), domain_2.size_virtual());
+    TEST_CHECK_EQUAL(domain_1.format_chosen_levels(), domain_2.format_chosen_levels());
+
+    for(Index i(0); i < domain_1.size_physical(); ++i)
+    {
+      const DomainLevelType& lvl_1 = *domain_1.at(i);
+      const DomainLevelType& lvl_2 = *domain_2.at(i);
+      TEST_CHECK_EQUAL(lvl_1.get_level_index(), lvl_2.get_level_index());
+      compare_mesh(lvl_1.get_mesh(), lvl_2.get_mesh());
+
+      const auto* node_1 = lvl_1.get_mesh_node();
+      const auto* node_2 = lvl_2.get_mesh_node();
+      TEST_CHECK(node_1->get_base_cells() == node_2->get_base_cells());
+      TEST_CHECK_EQUAL(node_1->get_num_base_cells(), node_2->get_num_base_cells());
+      TEST_CHECK(node_1->get_mesh_part_names() == node_2->get_mesh_part_names());
+
+      // check the outer mesh-part
+      const auto* part_1 = node_1->find_mesh_part("outer");
+      const auto* part_2 = node_2->find_mesh_part("outer");
+      TEST_CHECK_NOT_EQUAL(part_2, nullptr);
+      TEST_CHECK_EQUAL(node_2->find_mesh_part_chart_name("outer"), "outer");
+      TEST_CHECK_EQUAL(node_2->find_mesh_part_chart("outer"), domain_2.get_atlas().find_mesh_chart("outer"));
+      TEST_CHECK_EQUAL(part_1->get_num_entities(0), part_2->get_num_entities(0));
+      TEST_CHECK_EQUAL(part_1->get_num_entities(1), part_2->get_num_entities(1));
+      TEST_CHECK(part_2->has_topology());
+      for(Index k(0); k < part_1->get_num_entities(0); ++k)
+        TEST_CHECK_EQUAL(part_1->template get_target_set<0>()[k], part_2->template get_target_set<0>()[k]);
+
+      const auto* attr_1 = part_1->find_attribute("param");
+      const auto* attr_2 = part_2->find_attribute("param");
+      TEST_CHECK_NOT_EQUAL(attr_2, nullptr);
+      TEST_CHECK_EQUAL(attr_1->get_num_values(), attr_2->get_num_values());
+      for(Index k(0); k < attr_1->get_num_values(); ++k)
+        TEST_CHECK_EQUAL((*attr_1)(k, 0), (*attr_2)(k, 0));
+    }
+  }
+
+  void assemble_transfers(DomainControlType& domain, std::deque<std::shared_ptr<SystemLevelType>>& system_levels,
+    bool transfers) const
+  {
+    Cubature::DynamicFactory cubature("auto-degree:3");
+    for(Index i(0); i < domain.size_physical(); ++i)
+    {
+      system_levels.push_back(std::make_shared<SystemLevelType>());
+      system_levels.back()->assemble_gate(domain.at(i));
+      if((i+1) < domain.size_virtual())
+      {
+        system_levels.back()->assemble_coarse_muxer(domain.at(i+1));
+        if(transfers)
+          system_levels.back()->assemble_transfer(domain.at(i), domain.at(i+1), cubature);
+      }
+    }
+  }
+
+  virtual void run() const override
+  {
+    const Dist::Comm comm = Dist::Comm::world();
+    const String domain_cache("hierarchy-cache-test-domain.***.bin");
+    const String system_cache("hierarchy-cache-test-system.***.bin");
+
+    // make sure that no stale cache files exist
+    std::remove(rank_filename("hierarchy-cache-test-domain.", comm).c_str());
+    std::remove(rank_filename("hierarchy-cache-test-system.", comm).c_str());
+
+    // create the hierarchy from scratch
+    DomainControlType domain_1(comm, true);
+    create_domain(domain_1, domain_cache, 3);
+    TEST_CHECK(!domain_1.is_hierarchy_restored());
+    TEST_CHECK(!domain_1.get_hierarchy_hash().empty());
+
+    // restore the hierarchy from the cache
+    DomainControlType domain_2(comm, true);
+    create_domain(domain_2, domain_cache, 3);
+    TEST_CHECK(domain_2.is_hierarchy_restored());
+    TEST_CHECK_EQUAL(domain_1.get_hierarchy_hash(), domain_2.get_hierarchy_hash());
+    compare_domains(domain_1, domain_2);
+
+    // different level settings must not match the cache
+    {
+      DomainControlType domain_3(comm, true);
+      create_domain(domain_3, domain_cache, 2);
+      TEST_CHECK(!domain_3.is_hierarchy_restored());
+      TEST_CHECK_NOT_EQUAL(domain_1.get_hierarchy_hash(), domain_3.get_hierarchy_hash());
+    }
+
+    // assemble transfers on the first domain and write them
+    std::deque<std::shared_ptr<SystemLevelType>> system_levels_1, system_levels_2;
+    assemble_transfers(domain_1, system_levels_1, true);
+    domain_1.save_system_transfers(system_levels_1, system_cache, "auto-degree:3");
+
+    // restore transfers on the second domain
+    assemble_transfers(domain_2, system_levels_2, false);
+    TEST_CHECK(!domain_2.load_system_transfers(system_levels_2, system_cache, "auto-degree:5"));
+    TEST_CHECK(domain_2.load_system_transfers(system_levels_2, system_cache, "auto-degree:3"));
+    for(std::size_t i(0); i < system_levels_1.size(); ++i)
+    {
+      const auto& trans_1 = system_levels_1.at(i)->transfer_sys.local();
+      const auto& trans_2 = system_levels_2.at(i)->transfer_sys.local();
+      TEST_CHECK_EQUAL(trans_1.get_mat_prol(), trans_2.get_mat_prol());
+      TEST_CHECK_EQUAL(trans_1.get_mat_rest(), trans_2.get_mat_rest());
+    }
+
+    // the hash of an automatically layered hierarchy must not depend on the machine parameters
+    const String auto_cache("hierarchy-cache-test-auto.***.bin");
+    std::remove(rank_filename("hierarchy-cache-test-auto.", comm).c_str());
+    {
+      DomainControlType domain_4(comm, true);
+      domain_4.set_auto_layers(true);
+      domain_4.get_agglomeration_policy().set_machine(1E-9, 1E-6, 1E-9);
+      create_domain(domain_4, auto_cache, 3);
+      TEST_CHECK(!domain_4.is_hierarchy_restored());
+      TEST_CHECK_NOT_EQUAL(domain_1.get_hierarchy_hash(), domain_4.get_hierarchy_hash());
+
+      DomainControlType domain_5(comm, true);
+      domain_5.set_auto_layers(true);
+      domain_5.get_agglomeration_policy().set_machine(1E-8, 1E-4, 1E-8);
+      create_domain(domain_5, auto_cache, 3);
+      TEST_CHECK(domain_5.is_hierarchy_restored());
+      TEST_CHECK_EQUAL(domain_4.get_hierarchy_hash(), domain_5.get_hierarchy_hash());
+      TEST_CHECK_EQUAL(domain_4.format_desired_levels(), domain_5.format_desired_levels());
+      compare_domains(domain_4, domain_5);
+
+      // different policy inputs must not match the cache
+      DomainControlType domain_6(comm, true);
+      domain_6.set_auto_layers(true);
+      domain_6.get_agglomeration_policy().set_machine(1E-9, 1E-6, 1E-9);
+      domain_6.get_agglomeration_policy().set_min_dofs_per_rank(1.0);
+      create_domain(domain_6, auto_cache, 3);
+      TEST_CHECK(!domain_6.is_hierarchy_restored());
+      TEST_CHECK_NOT_EQUAL(domain_4.get_hierarchy_hash(), domain_6.get_hierarchy_hash());
+    }
+
+    comm.barrier();
+    std::remove(rank_filename("hierarchy-cache-test-domain.", comm).c_str());
+    std::remove(rank_filename("hierarchy-cache-test-system.", comm).c_str());
+    std::remove(rank_filename("hierarchy-cache-test-auto.", comm).c_str());
+  }
+};
+
+HierarchyCacheTest hierarchy_cache_test;
@@ -378,6 +378,30 @@ namespace FEAT
         Assembly::Common::LaplaceOperator laplace_op;
         Assembly::BilinearOperatorAssembler::assemble_matrix1(loc_matrix, laplace_op, space, cubature, nu);
       }
+
+      /**
+       * \brief Writes the local transfer matrices into a binary stream.
+       *
+       * \param[in] os
+       * The binary output stream to write to.
+       */
+      void write_transfers(std::ostream& os) const
+      {
+        this->transfer_sys.local().write_out(os);
+      }
+
+      /**
+       * \brief Reads the local transfer matrices from a binary stream and compiles the transfer.
+       *
+       * \param[in] is
+       * The binary input stream to read from, which has been written by write_transfers().
+       */
+      void read_transfers(std::istream& is)
+      {
+        this->transfer_sys.local().read_from(is);
+        if(!this->transfer_sys.local().get_mat_prol().empty())
+          this->transfer_sys.compile();
+      }
     }; // class ScalarBasicSystemLevel<...>
 
     template<
@@ -723,6 +723,36 @@ namespace FEAT
         // assemble matrix structure
         Assembly::SymbolicAssembler::assemble_matrix_std1(this->matrix_s.local(), space_pres);
       }
+
+      /**
+       * \brief Writes the local velocity and pressure transfer matrices into a binary stream.
+       *
+       * \param[in] os
+       * The binary output stream to write to.
+       */
+      void write_transfers(std::ostream& os) const
+      {
+        this->transfer_velo.local().write_out(os);
+        this->transfer_pres.local().write_out(os);
+      }
+
+      /**
+       * \brief Reads the local transfer matrices from a binary stream and compiles the transfers.
+       *
+       * \param[in] is
+       * The binary input stream to read from, which has been written by write_transfers().
+       */
+      void read_transfers(std::istream& is)
+      {
+        this->transfer_velo.local().read_from(is);
+        this->transfer_pres.local().read_from(is);
+        if(!this->transfer_velo.local().get_mat_prol().empty())
+        {
+          this->transfer_velo.compile();
+          this->transfer_pres.compile();
+          this->compile_system_transfer();
+        }
+      }
     }; // class StokesBlockedSystemLevel<...>
 
     template
@@ -0,0 +1,199 @@
+// FEAT3: Finite Element Analysis Toolbox, Version 3
+// Copyright (C) 2010 - 2020 by Stefan Turek & the FEAT group
+// FEAT3 is released under the GNU General Public License version 3,
+// see the file 'copyright.txt' in the top level directory for details.
+
+#include <test_system/test_system.hpp>
+#include <kernel/analytic/expression_function.hpp>
+#include <kernel/analytic/common.hpp>
+
+#include <vector>
+
+using namespace FEAT;
+using namespace FEAT::TestSystem;
+
+/**
+ * \brief Test class for the ExpressionFunction class template
+ *
+ * \test Tests the parsing, the constant folding, the batch evaluation and the automatic
+ * differentiation of the Analytic::ExpressionFunction class template.
+ *
+ * \tparam DataType_
+ * The data type for the test. Shall be either double or float.
+ */
+template<typename DataType_>
+class ExpressionFunctionTest :
+  public TestSystem::TaggedTest<Archs::None, DataType_>
+{
+public:
+  ExpressionFunctionTest() :
+    TestSystem::TaggedTest<Archs::None, DataType_>("ExpressionFunctionTest")
+  {
+  }
+
+  virtual ~ExpressionFunctionTest()
+  {
+  }
+
+  /// compares two functions in a set of points
+  template<typename Func1_, typename Func2_, typename Point_>
+  void compare(const Func1_& func_1, const Func2_& func_2, const std::vector<Point_>& points, const DataType_ eps) const
+  {
+    typedef Analytic::EvalTraits<DataType_, Func1_> Traits;
+    typename Func1_::template Evaluator<Traits> eval_1(func_1);
+    typename Func2_::template Evaluator<Traits> eval_2(func_2);
+    static constexpr int dim = Func1_::domain_dim;
+
+    for(const auto& p : points)
+    {
+      const DataType_ v1 = eval_1.value(p);
+      const DataType_ v2 = eval_2.value(p);
+      const auto g1 = eval_1.gradient(p);
+      const auto g2 = eval_2.gradient(p);
+      const auto h1 = eval_1.hessian(p);
+      const auto h2 = eval_2.hessian(p);
+      const DataType_ sv = Math::max(DataType_(1), Math::abs(v2));
+      TEST_CHECK_EQUAL_WITHIN_EPS(v1, v2, eps * sv);
+      for(int i(0); i < dim; ++i)
+      {
+        const DataType_ sg = Math::max(DataType_(1), Math::abs(g2[i]));
+        TEST_CHECK_EQUAL_WITHIN_EPS(g1[i], g2[i], eps * sg);
+        for(int j(0); j < dim; ++j)
+        {
+          const DataType_ sh = Math::max(DataType_(1), Math::abs(h2[i][j]));
+          TEST_CHECK_EQUAL_WITHIN_EPS(h1[i][j], h2[i][j], eps * sh);
+        }
+      }
+    }
+  }
+
+  /// checks the derivatives of a function by central difference quotients
+  template<typename Point_>
+  void check_derivs(const Analytic::ExpressionFunction<2>& func, const std::vector<Point_>& points) const
+  {
+    // the difference quotients are always computed in double precision
+    typedef Analytic::EvalTraits<DataType_, Analytic::ExpressionFunction<2>> Traits;
+    typedef Analytic::EvalTraits<double, Analytic::ExpressionFunction<2>> TraitsDQ;
+    typename Analytic::ExpressionFunction<2>::template Evaluator<Traits> eval(func);
+    typename Analytic::ExpressionFunction<2>::template Evaluator<TraitsDQ> eval_dq(func);
+
+    const double h = 1E-5;
+    const DataType_ eps = Math::max(Math::pow(Math::eps<DataType_>(), DataType_(0.6)), DataType_(1E-7));
+
+    for(const auto& p : points)
+    {
+      const auto grad = eval.gradient(p);
+      const auto hess = eval.hessian(p);
+      for(int i(0); i < 2; ++i)
+      {
+        Tiny::Vector<double, 2> pl, pr;
+        pl[0] = pr[0] = double(p[0]);
+        pl[1] = pr[1] = double(p[1]);
+        pl[i] -= h;
+        pr[i] += h;
+        const DataType_ dq = DataType_((eval_dq.value(pr) - eval_dq.value(pl)) / (2.0 * h));
+        TEST_CHECK_EQUAL_WITHIN_EPS(grad[i], dq, eps * Math::max(DataType_(1), Math::abs(dq)));
+        const auto gl = eval_dq.gradient(pl);
+        const auto gr = eval_dq.gradient(pr);
+        for(int j(0); j < 2; ++j)
+        {
+          const DataType_ hq = DataType_((gr[j] - gl[j]) / (2.0 * h));
+          TEST_CHECK_EQUAL_WITHIN_EPS(hess[i][j], hq, eps * Math::max(DataType_(1), Math::abs(hq)));
+        }
+      }
+    }
+  }
+
+  void test_parse() const
+  {
+    // constant folding
+    Analytic::ExpressionFunction<2> func_1("2*pi*3 + x - (1+1)^3");
+    TEST_CHECK_EQUAL(func_1.get_program_size(), std::size_t(5));
+    TEST_CHECK_EQUAL_WITHIN_EPS(Analytic::eval_value_x(func_1, DataType_(1), DataType_(0)),
+      DataType_(6)*Math::pi<DataType_>() - DataType_(7), Math::eps<DataType_>() * DataType_(100));
+
+    // user-defined constants and operator precedence
+    Analytic::ExpressionFunction<1> func_2;
+    func_2.add_constant("Re", 100.0);
+    func_2.parse("-x^2 + Re/2^2^-1 * (x < 1 & x >= 0) + if(x > 1, 1, 0) + !(x = 2)");
+    TEST_CHECK_EQUAL_WITHIN_EPS(Analytic::eval_value_x(func_2, DataType_(0.5)),
+      DataType_(-0.25) + DataType_(100) / Math::sqrt(DataType_(2)) + DataType_(1), Math::eps<DataType_>() * DataType_(1000));
+    TEST_CHECK_EQUAL_WITHIN_EPS(Analytic::eval_value_x(func_2, DataType_(2)),
+      DataType_(-4) + DataType_(1), Math::eps<DataType_>() * DataType_(100));
+
+    // parse errors
+    TEST_CHECK_THROWS(Analytic::ExpressionFunction<2>("x + z"), Analytic::ExpressionParseError);
+    TEST_CHECK_THROWS(Analytic::ExpressionFunction<2>("sin(x"), Analytic::ExpressionParseError);
+    TEST_CHECK_THROWS(Analytic::ExpressionFunction<2>("foo(x)"), Analytic::ExpressionParseError);
+    TEST_CHECK_THROWS(Analytic::ExpressionFunction<2>("x + * y"), Analytic::ExpressionParseError);
+    TEST_CHECK_THROWS(Analytic::ExpressionFunction<2>("atan2(x)"), Analytic::ExpressionParseError);
+    TEST_CHECK_THROWS(Analytic::ExpressionFunction<2>("x y"), Analytic::ExpressionParseError);
+  }
+
+  void test_common() const
+  {
+    const DataType_ eps = Math::pow(Math::eps<DataType_>(), DataType_(0.6));
+
+    std::vector<Tiny::Vector<DataType_, 2>> points_2;
+    std::vector<Tiny::Vector<DataType_, 3>> points_3;
+    for(int i(0); i < 5; ++i)
+    {
+      for(int j(0); j < 5; ++j)
+      {
+        Tiny::Vector<DataType_, 3> p;
+        p[0] = DataType_(0.1 + 0.2*i);
+        p[1] = DataType_(0.15 + 0.17*j);
+        p[2] = DataType_(0.9 - 0.13*i);
+        points_2.push_back(p.template size_cast<2>());
+        points_3.push_back(p);
+      }
+    }
+
+    Analytic::Common::SineBubbleFunction<2> sine_bubble;
+    Analytic::ExpressionFunction<2> sine_expr("sin(pi*x)*sin(pi*y)");
+    compare(sine_expr, sine_bubble, points_2, eps);
+
+    Analytic::Common::ExpBubbleFunction<3> exp_bubble;
+    Analytic::ExpressionFunction<3> exp_expr(
+      "(exp(-(2*x-1)^2)-exp(-1))*(exp(-(2*y-1)^2)-exp(-1))*(exp(-(2*z-1)^2)-exp(-1)) / (1-exp(-1))^3");
+    compare(exp_expr, exp_bubble, points_3, eps);
+
+    Analytic::Common::GoldsteinPriceFunction goldstein_price;
+    Analytic::ExpressionFunction<2> goldstein_expr(
+      "(1 + (1+x+y)^2*(19-14*x+3*x^2-14*y+6*x*y+3*y^2)) * (30 + (2*x-3*y)^2*(18-32*x+12*x^2+48*y-36*x*y+27*y^2))");
+    compare(goldstein_expr, goldstein_price, points_2, eps);
+
+    // check the derivatives of all other functions by difference quotients
+    Analytic::ExpressionFunction<2> misc_expr("atan2(y-0.5,x-0.4) + tanh(x*y) + asin(x/3) + log10(1+y^2) "
+      "+ sqrt(2+x)/(2+cos(x*y)) + cosh(y)*sinh(x) + acos(y/4) + tan(x/5) + log(1+x) + pow(1+x,y) + x^1.5 "
+      "+ min(x,y)^3 + max(2*x,y)^2 + abs(x-y)^3");
+    check_derivs(misc_expr, points_2);
+
+    // powers with a non-literal exponent at negative bases
+    std::vector<Tiny::Vector<DataType_, 2>> points_neg(points_2);
+    for(auto& p : points_neg)
+      p[0] -= DataType_(1.5);
+    Analytic::ExpressionFunction<2> pow_expr("x^(0*y+2) * pow(x, 3+0*y) + pow(y+1, x)");
+    check_derivs(pow_expr, points_neg);
+
+    // check the batch evaluation
+    typedef Analytic::EvalTraits<DataType_, Analytic::ExpressionFunction<2>> Traits;
+    typename Analytic::ExpressionFunction<2>::template Evaluator<Traits> eval(misc_expr);
+    std::vector<Tiny::Vector<DataType_, 2>> points;
+    for(int k(0); k < 3; ++k)
+      points.insert(points.end(), points_2.begin(), points_2.end());
+    std::vector<DataType_> values(points.size());
+    eval.value_batch(values.data(), points.data(), Index(points.size()));
+    for(std::size_t i(0); i < points.size(); ++i)
+      TEST_CHECK_EQUAL(values[i], eval.value(points[i]));
+  }
+
+  virtual void run() const override
+  {
+    test_parse();
+    test_common();
+  }
+};
+
+ExpressionFunctionTest<double> expression_function_test_double;
+ExpressionFunctionTest<float> expression_function_test_float;
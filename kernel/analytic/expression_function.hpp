@@ -0,0 +1,1036 @@
+// FEAT3: Finite Element Analysis Toolbox, Version 3
+// Copyright (C) 2010 - 2020 by Stefan Turek & the FEAT group
+// FEAT3 is released under the GNU General Public License version 3,
+// see the file 'copyright.txt' in the top level directory for details.
+
+#pragma once
+#ifndef KERNEL_ANALYTIC_EXPRESSION_FUNCTION_HPP
+#define KERNEL_ANALYTIC_EXPRESSION_FUNCTION_HPP 1
+
+// includes, FEAT
+#include <kernel/analytic/function.hpp>
+#include <kernel/util/exception.hpp>
+#include <kernel/util/math.hpp>
+#include <kernel/util/string.hpp>
+
+// includes, system
+#include <cctype>
+#include <cstdlib>
+#include <map>
+#include <vector>
+
+namespace FEAT
+{
+  namespace Analytic
+  {
+    /**
+     * \brief Expression Function parse error
+     *
+     * An instance of this exception is thrown if the parsing process of an
+     * ExpressionFunction formula fails for some reason.
+     *
+     * The error message contains a description of the error cause and
+     * can be queried by calling the inherited what() method.
+     */
+    class ExpressionParseError : public ParseError
+    {
+    public:
+      /// constructor
+      explicit ExpressionParseError(const String& msg) : ParseError(msg) {}
+    };
+
+    /// \cond internal
+    namespace Intern
+    {
+      /// expression bytecode operations
+      enum class ExprOp
+      {
+        // push a constant onto the stack
+        push_const,
+        // push a variable onto the stack
+        push_var,
+        // unary operations
+        neg, sqr, powc, abs, sqrt, exp, log, log10, sin, cos, tan, asin, acos, atan, sinh, cosh, tanh, lnot,
+        // binary operations
+        add, sub, mul, div, pow, atan2, min, max, lt, le, gt, ge, eq, ne, land, lor,
+        // ternary operations
+        select
+      };
+
+      /// returns the number of stack operands of an operation
+      inline int expr_op_arity(ExprOp op)
+      {
+        if((op == ExprOp::push_const) || (op == ExprOp::push_var))
+          return 0;
+        if(int(op) < int(ExprOp::add))
+          return 1;
+        if(int(op) < int(ExprOp::select))
+          return 2;
+        return 3;
+      }
+
+      /// expression bytecode instruction
+      struct ExprInstr
+      {
+        /// the operation
+        ExprOp op;
+        /// the variable index for push_var
+        int var;
+        /// the constant for push_const and the exponent for powc
+        double val;
+
+        explicit ExprInstr(ExprOp op_, int var_ = 0, double val_ = 0.0) :
+          op(op_), var(var_), val(val_)
+        {
+        }
+      };
+
+      /**
+       * \brief Evaluates a bytecode program for a batch of points
+       *
+       * The stack is stored in blocks of \p n entries, i.e. the operations are applied
+       * to all points of the batch at once, so that the inner loops can be vectorised.
+       *
+       * \param[in] prog
+       * The bytecode program.
+       *
+       * \param[in] points
+       * The array of \p n points in which the program is to be evaluated.
+       *
+       * \param[in] n
+       * The number of points.
+       *
+       * \param[in] stack
+       * The stack of size at least <em>n x depth</em>, where depth is the stack depth of the program.
+       *
+       * \returns
+       * A pointer to the \p n results, which is the first block of the stack.
+       */
+      template<typename DT_, typename Point_>
+      const DT_* expr_eval_batch(const std::vector<ExprInstr>& prog, const Point_* points, const int n, DT_* stack)
+      {
+        int sp(0);
+        for(const auto& ins : prog)
+        {
+          const int arity = expr_op_arity(ins.op);
+          DT_* a = &stack[(sp - arity) * n];
+          const DT_* b = a + (arity > 1 ? n : 0);
+          const DT_* c = b + (arity > 2 ? n : 0);
+          switch(ins.op)
+          {
+          case ExprOp::push_const:
+            for(int l(0); l < n; ++l) a[l] = DT_(ins.val);
+            break;
+          case ExprOp::push_var:
+            for(int l(0); l < n; ++l) a[l] = points[l][ins.var];
+            break;
+          case ExprOp::neg:   for(int l(0); l < n; ++l) a[l] = -a[l]; break;
+          case ExprOp::sqr:   for(int l(0); l < n; ++l) a[l] = a[l] * a[l]; break;
+          case ExprOp::powc:  for(int l(0); l < n; ++l) a[l] = Math::pow(a[l], DT_(ins.val)); break;
+          case ExprOp::abs:   for(int l(0); l < n; ++l) a[l] = Math::abs(a[l]); break;
+          case ExprOp::sqrt:  for(int l(0); l < n; ++l) a[l] = Math::sqrt(a[l]); break;
+          case ExprOp::exp:   for(int l(0); l < n; ++l) a[l] = Math::exp(a[l]); break;
+          case ExprOp::log:   for(int l(0); l < n; ++l) a[l] = Math::log(a[l]); break;
+          case ExprOp::log10: for(int l(0); l < n; ++l) a[l] = Math::log10(a[l]); break;
+          case ExprOp::sin:   for(int l(0); l < n; ++l) a[l] = Math::sin(a[l]); break;
+          case ExprOp::cos:   for(int l(0); l < n; ++l) a[l] = Math::cos(a[l]); break;
+          case ExprOp::tan:   for(int l(0); l < n; ++l) a[l] = Math::tan(a[l]); break;
+          case ExprOp::asin:  for(int l(0); l < n; ++l) a[l] = Math::asin(a[l]); break;
+          case ExprOp::acos:  for(int l(0); l < n; ++l) a[l] = Math::acos(a[l]); break;
+          case ExprOp::atan:  for(int l(0); l < n; ++l) a[l] = Math::atan(a[l]); break;
+          case ExprOp::sinh:  for(int l(0); l < n; ++l) a[l] = Math::sinh(a[l]); break;
+          case ExprOp::cosh:  for(int l(0); l < n; ++l) a[l] = Math::cosh(a[l]); break;
+          case ExprOp::tanh:  for(int l(0); l < n; ++l) a[l] = Math::tanh(a[l]); break;
+          case ExprOp::lnot:  for(int l(0); l < n; ++l) a[l] = DT_(a[l] == DT_(0) ? 1 : 0); break;
+          case ExprOp::add:   for(int l(0); l < n; ++l) a[l] += b[l]; break;
+          case ExprOp::sub:   for(int l(0); l < n; ++l) a[l] -= b[l]; break;
+          case ExprOp::mul:   for(int l(0); l < n; ++l) a[l] *= b[l]; break;
+          case ExprOp::div:   for(int l(0); l < n; ++l) a[l] /= b[l]; break;
+          case ExprOp::pow:   for(int l(0); l < n; ++l) a[l] = Math::pow(a[l], b[l]); break;
+          case ExprOp::atan2: for(int l(0); l < n; ++l) a[l] = Math::atan2(a[l], b[l]); break;
+          case ExprOp::min:   for(int l(0); l < n; ++l) a[l] = Math::min(a[l], b[l]); break;
+          case ExprOp::max:   for(int l(0); l < n; ++l) a[l] = Math::max(a[l], b[l]); break;
+          case ExprOp::lt:    for(int l(0); l < n; ++l) a[l] = DT_(a[l] <  b[l] ? 1 : 0); break;
+          case ExprOp::le:    for(int l(0); l < n; ++l) a[l] = DT_(a[l] <= b[l] ? 1 : 0); break;
+          case ExprOp::gt:    for(int l(0); l < n; ++l) a[l] = DT_(a[l] >  b[l] ? 1 : 0); break;
+          case ExprOp::ge:    for(int l(0); l < n; ++l) a[l] = DT_(a[l] >= b[l] ? 1 : 0); break;
+          case ExprOp::eq:    for(int l(0); l < n; ++l) a[l] = DT_(a[l] == b[l] ? 1 : 0); break;
+          case ExprOp::ne:    for(int l(0); l < n; ++l) a[l] = DT_(a[l] != b[l] ? 1 : 0); break;
+          case ExprOp::land:  for(int l(0); l < n; ++l) a[l] = DT_((a[l] != DT_(0)) && (b[l] != DT_(0)) ? 1 : 0); break;
+          case ExprOp::lor:   for(int l(0); l < n; ++l) a[l] = DT_((a[l] != DT_(0)) || (b[l] != DT_(0)) ? 1 : 0); break;
+          case ExprOp::select:for(int l(0); l < n; ++l) a[l] = (a[l] != DT_(0) ? b[l] : c[l]); break;
+          }
+          sp += 1 - arity;
+        }
+        return stack;
+      }
+
+      /**
+       * \brief Computes the value and the first two derivatives of a unary operation
+       *
+       * \param[in] op
+       * The unary operation.
+       *
+       * \param[in] u
+       * The operand.
+       *
+       * \param[in] c
+       * The exponent for ExprOp::powc.
+       *
+       * \param[out] f0, f1, f2
+       * The value, the first and the second derivative of the operation in \p u.
+       */
+      template<typename DT_>
+      void expr_unary(ExprOp op, const DT_ u, const DT_ c, DT_& f0, DT_& f1, DT_& f2)
+      {
+        switch(op)
+        {
+        case ExprOp::neg:
+          f0 = -u; f1 = -DT_(1); f2 = DT_(0);
+          break;
+        case ExprOp::sqr:
+          f0 = u*u; f1 = DT_(2)*u; f2 = DT_(2);
+          break;
+        case ExprOp::powc:
+          f0 = Math::pow(u, c);
+          f1 = (c == DT_(0) ? DT_(0) : c * Math::pow(u, c - DT_(1)));
+          f2 = ((c == DT_(0)) || (c == DT_(1)) ? DT_(0) : c * (c - DT_(1)) * Math::pow(u, c - DT_(2)));
+          break;
+        case ExprOp::abs:
+          f0 = Math::abs(u); f1 = Math::signum(u); f2 = DT_(0);
+          break;
+        case ExprOp::sqrt:
+          f0 = Math::sqrt(u); f1 = DT_(0.5) / f0; f2 = -DT_(0.25) / (u * f0);
+          break;
+        case ExprOp::exp:
+          f0 = f1 = f2 = Math::exp(u);
+          break;
+        case ExprOp::log:
+          f0 = Math::log(u); f1 = DT_(1) / u; f2 = -f1*f1;
+          break;
+        case ExprOp::log10:
+          f0 = Math::log10(u); f1 = DT_(1) / (u * Math::log(DT_(10))); f2 = -f1 / u;
+          break;
+        case ExprOp::sin:
+          f0 = Math::sin(u); f1 = Math::cos(u); f2 = -f0;
+          break;
+        case ExprOp::cos:
+          f0 = Math::cos(u); f1 = -Math::sin(u); f2 = -f0;
+          break;
+        case ExprOp::tan:
+          f0 = Math::tan(u); f1 = DT_(1) + f0*f0; f2 = DT_(2)*f0*f1;
+          break;
+        case ExprOp::asin:
+          f0 = Math::asin(u); f1 = DT_(1) / Math::sqrt(DT_(1) - u*u); f2 = u*f1*f1*f1;
+          break;
+        case ExprOp::acos:
+          f0 = Math::acos(u); f1 = -DT_(1) / Math::sqrt(DT_(1) - u*u); f2 = u*f1*f1*f1;
+          break;
+        case ExprOp::atan:
+          f0 = Math::atan(u); f1 = DT_(1) / (DT_(1) + u*u); f2 = -DT_(2)*u*f1*f1;
+          break;
+        case ExprOp::sinh:
+          f0 = Math::sinh(u); f1 = Math::cosh(u); f2 = f0;
+          break;
+        case ExprOp::cosh:
+          f0 = Math::cosh(u); f1 = Math::sinh(u); f2 = f0;
+          break;
+        case ExprOp::tanh:
+          f0 = Math::tanh(u); f1 = DT_(1) - f0*f0; f2 = -DT_(2)*f0*f1;
+          break;
+        default:
+          // lnot: piecewise constant
+          f0 = DT_(u == DT_(0) ? 1 : 0); f1 = f2 = DT_(0);
+          break;
+        }
+      }
+
+      /**
+       * \brief Second-order jet for forward-mode automatic differentiation
+       *
+       * A jet stores the value, the gradient and (optionally) the hessian of a
+       * subexpression with respect to the \p n_ variables.
+       */
+      template<typename DT_, int n_>
+      struct ExprJet
+      {
+        /// the value
+        DT_ v;
+        /// the gradient
+        DT_ g[n_];
+        /// the hessian
+        DT_ h[n_][n_];
+
+        template<bool hess_>
+        void set_const(const DT_ val)
+        {
+          v = val;
+          for(int i(0); i < n_; ++i)
+            g[i] = DT_(0);
+          for(int i(0); hess_ && (i < n_); ++i)
+            for(int j(0); j < n_; ++j)
+              h[i][j] = DT_(0);
+        }
+
+        template<bool hess_>
+        void set_var(const DT_ val, const int k)
+        {
+          set_const<hess_>(val);
+          g[k] = DT_(1);
+        }
+
+        /// applies a unary chain rule: this <- f(this)
+        template<bool hess_>
+        void chain(const DT_ f0, const DT_ f1, const DT_ f2)
+        {
+          v = f0;
+          for(int i(0); hess_ && (i < n_); ++i)
+            for(int j(0); j < n_; ++j)
+              h[i][j] = f1 * h[i][j] + f2 * g[i] * g[j];
+          for(int i(0); i < n_; ++i)
+            g[i] *= f1;
+        }
+
+        /// returns true, if the jet does not depend on any variable
+        bool is_const() const
+        {
+          for(int i(0); i < n_; ++i)
+            if(g[i] != DT_(0))
+              return false;
+          return true;
+        }
+
+        /// applies a binary chain rule: this <- f(this, b)
+        template<bool hess_>
+        void chain2(const ExprJet& b, const DT_ f0, const DT_ fa, const DT_ fb, const DT_ faa, const DT_ fab, const DT_ fbb)
+        {
+          v = f0;
+          for(int i(0); hess_ && (i < n_); ++i)
+            for(int j(0); j < n_; ++j)
+              h[i][j] = fa * h[i][j] + fb * b.h[i][j] + faa * g[i] * g[j] + fbb * b.g[i] * b.g[j]
+                + fab * (g[i] * b.g[j] + b.g[i] * g[j]);
+          for(int i(0); i < n_; ++i)
+            g[i] = fa * g[i] + fb * b.g[i];
+        }
+
+        /// this <- this + s*b
+        template<bool hess_>
+        void add(const ExprJet& b, const DT_ s)
+        {
+          v += s * b.v;
+          for(int i(0); i < n_; ++i)
+            g[i] += s * b.g[i];
+          for(int i(0); hess_ && (i < n_); ++i)
+            for(int j(0); j < n_; ++j)
+              h[i][j] += s * b.h[i][j];
+        }
+
+        /// this <- this * b
+        template<bool hess_>
+        void mul(const ExprJet& b)
+        {
+          for(int i(0); hess_ && (i < n_); ++i)
+            for(int j(0); j < n_; ++j)
+              h[i][j] = h[i][j] * b.v + v * b.h[i][j] + g[i] * b.g[j] + b.g[i] * g[j];
+          for(int i(0); i < n_; ++i)
+            g[i] = g[i] * b.v + v * b.g[i];
+          v *= b.v;
+        }
+      };
+
+      /**
+       * \brief Evaluates a bytecode program with forward-mode automatic differentiation
+       *
+       * \param[in] prog
+       * The bytecode program.
+       *
+       * \param[in] point
+       * The point in which the program is to be evaluated.
+       *
+       * \param[in] stack
+       * The jet stack of size at least depth, where depth is the stack depth of the program.
+       *
+       * \returns
+       * A reference to the resulting jet, which is the first entry of the stack.
+       */
+      template<bool hess_, typename DT_, int n_, typename Point_>
+      const ExprJet<DT_, n_>& expr_eval_jet(const std::vector<ExprInstr>& prog, const Point_& point, ExprJet<DT_, n_>* stack)
+      {
+        int sp(0);
+        DT_ f0, f1, f2;
+        for(const auto& ins : prog)
+        {
+          const int arity = expr_op_arity(ins.op);
+          ExprJet<DT_, n_>& a = stack[sp - arity];
+          ExprJet<DT_, n_>& b = stack[sp - arity + (arity > 1 ? 1 : 0)];
+          const ExprJet<DT_, n_>& c = stack[sp - arity + (arity > 2 ? 2 : 0)];
+          switch(ins.op)
+          {
+          case ExprOp::push_const:
+            a.template set_const<hess_>(DT_(ins.val));
+            break;
+          case ExprOp::push_var:
+            a.template set_var<hess_>(point[ins.var], ins.var);
+            break;
+          case ExprOp::add:
+            a.template add<hess_>(b, DT_(1));
+            break;
+          case ExprOp::sub:
+            a.template add<hess_>(b, -DT_(1));
+            break;
+          case ExprOp::mul:
+            a.template mul<hess_>(b);
+            break;
+          case ExprOp::div:
+            // a / b = a * (1/b)
+            f0 = DT_(1) / b.v;
+            b.template chain<hess_>(f0, -f0*f0, DT_(2)*f0*f0*f0);
+            a.template mul<hess_>(b);
+            break;
+          case ExprOp::pow:
+            if(b.is_const())
+            {
+              // constant exponent: same rule as powc, which is also valid for a <= 0
+              expr_unary(ExprOp::powc, a.v, b.v, f0, f1, f2);
+              a.template chain<hess_>(f0, f1, f2);
+            }
+            else
+            {
+              // d/da a^b = b*a^(b-1) and d/db a^b = a^b*log(a)
+              const DT_ la = Math::log(a.v);
+              const DT_ pm1 = Math::pow(a.v, b.v - DT_(1));
+              f0 = Math::pow(a.v, b.v);
+              a.template chain2<hess_>(b, f0, b.v * pm1, f0 * la, b.v * (b.v - DT_(1)) * Math::pow(a.v, b.v - DT_(2)),
+                pm1 * (DT_(1) + b.v * la), f0 * la * la);
+            }
+            break;
+          case ExprOp::atan2:
+            {
+              // use the derivatives of atan(a/b) or -atan(b/a), which coincide with those
+              // of atan2(a,b), and overwrite the value afterwards
+              const DT_ val = Math::atan2(a.v, b.v);
+              if(Math::abs(b.v) >= Math::abs(a.v))
+              {
+                f0 = DT_(1) / b.v;
+                b.template chain<hess_>(f0, -f0*f0, DT_(2)*f0*f0*f0);
+                a.template mul<hess_>(b);
+                expr_unary(ExprOp::atan, a.v, DT_(0), f0, f1, f2);
+                a.template chain<hess_>(f0, f1, f2);
+              }
+              else
+              {
+                f0 = DT_(1) / a.v;
+                a.template chain<hess_>(f0, -f0*f0, DT_(2)*f0*f0*f0);
+                a.template mul<hess_>(b);
+                expr_unary(ExprOp::atan, a.v, DT_(0), f0, f1, f2);
+                a.template chain<hess_>(f0, -f1, -f2);
+              }
+              a.v = val;
+            }
+            break;
+          case ExprOp::min:
+            if(b.v < a.v)
+              a = b;
+            break;
+          case ExprOp::max:
+            if(b.v > a.v)
+              a = b;
+            break;
+          case ExprOp::select:
+            if(a.v != DT_(0))
+              a = b;
+            else
+              a = c;
+            break;
+          case ExprOp::lt: a.template set_const<hess_>(DT_(a.v <  b.v ? 1 : 0)); break;
+          case ExprOp::le: a.template set_const<hess_>(DT_(a.v <= b.v ? 1 : 0)); break;
+          case ExprOp::gt: a.template set_const<hess_>(DT_(a.v >  b.v ? 1 : 0)); break;
+          case ExprOp::ge: a.template set_const<hess_>(DT_(a.v >= b.v ? 1 : 0)); break;
+          case ExprOp::eq: a.template set_const<hess_>(DT_(a.v == b.v ? 1 : 0)); break;
+          case ExprOp::ne: a.template set_const<hess_>(DT_(a.v != b.v ? 1 : 0)); break;
+          case ExprOp::land: a.template set_const<hess_>(DT_((a.v != DT_(0)) && (b.v != DT_(0)) ? 1 : 0)); break;
+          case ExprOp::lor:  a.template set_const<hess_>(DT_((a.v != DT_(0)) || (b.v != DT_(0)) ? 1 : 0)); break;
+          default:
+            // all remaining operations are unary
+            expr_unary(ins.op, a.v, DT_(ins.val), f0, f1, f2);
+            a.template chain<hess_>(f0, f1, f2);
+            break;
+          }
+          sp += 1 - arity;
+        }
+        return *stack;
+      }
+
+      /**
+       * \brief Expression compiler
+       *
+       * This class implements a recursive descent parser which translates an expression
+       * into a postfix bytecode program and folds all constant subexpressions.
+       */
+      class ExprCompiler
+      {
+      protected:
+        /// the expression
+        const String& _expr;
+        /// the variable names
+        const std::vector<String>& _vars;
+        /// the constants
+        const std::map<String, double>& _consts;
+        /// the current position in the expression
+        std::size_t _pos;
+        /// the compiled program
+        std::vector<ExprInstr>& _prog;
+
+      public:
+        explicit ExprCompiler(const String& expr, const std::vector<String>& vars,
+          const std::map<String, double>& consts, std::vector<ExprInstr>& prog) :
+          _expr(expr), _vars(vars), _consts(consts), _pos(0), _prog(prog)
+        {
+        }
+
+        /// compiles the expression
+        void compile()
+        {
+          _prog.clear();
+          _parse_or();
+          _skip();
+          if(_pos < _expr.size())
+            _error("unexpected character");
+        }
+
+      protected:
+        void _error(const String& msg) const
+        {
+          String s(msg);
+          s.append("\n>>> '");
+          s.append(_expr);
+          s.append("'\n>>>");
+          s.append(String(_pos + 2u, '-'));
+          s.append("^");
+          throw ExpressionParseError(s);
+        }
+
+        void _skip()
+        {
+          while((_pos < _expr.size()) && std::isspace(static_cast<unsigned char>(_expr[_pos])))
+            ++_pos;
+        }
+
+        /// checks whether the next token is \p tok and consumes it if so
+        bool _accept(const char* tok)
+        {
+          _skip();
+          std::size_t k(0);
+          while((tok[k] != '\0') && (_pos + k < _expr.size()) && (_expr[_pos + k] == tok[k]))
+            ++k;
+          if(tok[k] != '\0')
+            return false;
+          _pos += k;
+          return true;
+        }
+
+        void _expect(const char* tok)
+        {
+          if(!_accept(tok))
+            _error(String("expected '") + tok + "'");
+        }
+
+        /// appends an instruction and folds it if all of its operands are constants
+        void _emit(ExprOp op, double val = 0.0)
+        {
+          const std::size_t arity = std::size_t(expr_op_arity(op));
+
+          // replace powers with constant exponents
+          if((op == ExprOp::pow) && (_prog.back().op == ExprOp::push_const))
+          {
+            const double e = _prog.back().val;
+            _prog.pop_back();
+            if(e == 1.0)
+              return;
+            _emit(e == 2.0 ? ExprOp::sqr : (e == 0.5 ? ExprOp::sqrt : ExprOp::powc), e);
+            return;
+          }
+
+          _prog.push_back(ExprInstr(op, 0, val));
+
+          // fold constant operands
+          if(_prog.size() < arity + 1u)
+            return;
+          for(std::size_t i(0); i < arity; ++i)
+          {
+            if(_prog.at(_prog.size() - 2u - i).op != ExprOp::push_const)
+              return;
+          }
+          std::vector<ExprInstr> sub(_prog.end() - std::ptrdiff_t(arity + 1u), _prog.end());
+          double stack[3];
+          const Tiny::Vector<double, 1>* no_points = nullptr;
+          const double res = *expr_eval_batch(sub, no_points, 1, stack);
+          _prog.erase(_prog.end() - std::ptrdiff_t(arity + 1u), _prog.end());
+          _prog.push_back(ExprInstr(ExprOp::push_const, 0, res));
+        }
+
+        void _parse_or()
+        {
+          _parse_and();
+          while(_accept("|"))
+          {
+            _parse_and();
+            _emit(ExprOp::lor);
+          }
+        }
+
+        void _parse_and()
+        {
+          _parse_cmp();
+          while(_accept("&"))
+          {
+            _parse_cmp();
+            _emit(ExprOp::land);
+          }
+        }
+
+        void _parse_cmp()
+        {
+          _parse_add();
+          ExprOp op;
+          if(_accept("<="))      op = ExprOp::le;
+          else if(_accept(">=")) op = ExprOp::ge;
+          else if(_accept("!=")) op = ExprOp::ne;
+          else if(_accept("==")) op = ExprOp::eq;
+          else if(_accept("<"))  op = ExprOp::lt;
+          else if(_accept(">"))  op = ExprOp::gt;
+          else if(_accept("="))  op = ExprOp::eq;
+          else return;
+          _parse_add();
+          _emit(op);
+        }
+
+        void _parse_add()
+        {
+          _parse_mul();
+          while(true)
+          {
+            if(_accept("+"))
+            {
+              _parse_mul();
+              _emit(ExprOp::add);
+            }
+            else if(_accept("-"))
+            {
+              _parse_mul();
+              _emit(ExprOp::sub);
+            }
+            else
+              return;
+          }
+        }
+
+        void _parse_mul()
+        {
+          _parse_unary();
+          while(true)
+          {
+            if(_accept("*"))
+            {
+              _parse_unary();
+              _emit(ExprOp::mul);
+            }
+            else if(_accept("/"))
+            {
+              _parse_unary();
+              _emit(ExprOp::div);
+            }
+            else
+              return;
+          }
+        }
+
+        void _parse_unary()
+        {
+          if(_accept("-"))
+          {
+            _parse_unary();
+            _emit(ExprOp::neg);
+          }
+          else if(_accept("!"))
+          {
+            _parse_unary();
+            _emit(ExprOp::lnot);
+          }
+          else
+          {
+            _accept("+");
+            _parse_pow();
+          }
+        }
+
+        void _parse_pow()
+        {
+          _parse_primary();
+          if(_accept("^"))
+          {
+            // right-associative; the exponent may have a sign
+            _parse_unary();
+            _emit(ExprOp::pow);
+          }
+        }
+
+        void _parse_primary()
+        {
+          _skip();
+          if(_pos >= _expr.size())
+            _error("unexpected end of expression");
+
+          const char ch = _expr[_pos];
+
+          // parenthesised expression
+          if(ch == '(')
+          {
+            ++_pos;
+            _parse_or();
+            _expect(")");
+            return;
+          }
+
+          // number
+          if(std::isdigit(static_cast<unsigned char>(ch)) || (ch == '.'))
+          {
+            const char* beg = _expr.c_str() + _pos;
+            char* end = nullptr;
+            const double val = std::strtod(beg, &end);
+            if(end == beg)
+              _error("invalid number");
+            _pos += std::size_t(end - beg);
+            _prog.push_back(ExprInstr(ExprOp::push_const, 0, val));
+            return;
+          }
+
+          // identifier
+          if(!(std::isalpha(static_cast<unsigned char>(ch)) || (ch == '_')))
+            _error("unexpected character");
+
+          const std::size_t beg = _pos;
+          while((_pos < _expr.size()) && (std::isalnum(static_cast<unsigned char>(_expr[_pos])) || (_expr[_pos] == '_')))
+            ++_pos;
+          const String name(_expr.substr(beg, _pos - beg));
+
+          // function call?
+          if(_accept("("))
+          {
+            _parse_function(name, beg);
+            return;
+          }
+
+          // variable?
+          for(std::size_t i(0); i < _vars.size(); ++i)
+          {
+            if(_vars[i] == name)
+            {
+              _prog.push_back(ExprInstr(ExprOp::push_var, int(i)));
+              return;
+            }
+          }
+
+          // constant?
+          auto it = _consts.find(name);
+          if(it != _consts.end())
+          {
+            _prog.push_back(ExprInstr(ExprOp::push_const, 0, it->second));
+            return;
+          }
+
+          _pos = beg;
+          _error("unknown identifier '" + name + "'");
+        }
+
+        void _parse_function(const String& name, const std::size_t beg)
+        {
+          static const struct
+          {
+            const char* name;
+            ExprOp op;
+          } funcs[] =
+          {
+            {"abs", ExprOp::abs}, {"sqrt", ExprOp::sqrt}, {"exp", ExprOp::exp}, {"log", ExprOp::log},
+            {"log10", ExprOp::log10}, {"sin", ExprOp::sin}, {"cos", ExprOp::cos}, {"tan", ExprOp::tan},
+            {"asin", ExprOp::asin}, {"acos", ExprOp::acos}, {"atan", ExprOp::atan}, {"sinh", ExprOp::sinh},
+            {"cosh", ExprOp::cosh}, {"tanh", ExprOp::tanh}, {"atan2", ExprOp::atan2}, {"pow", ExprOp::pow},
+            {"min", ExprOp::min}, {"max", ExprOp::max}, {"if", ExprOp::select}
+          };
+
+          for(const auto& f : funcs)
+          {
+            if(name != f.name)
+              continue;
+            const int arity = expr_op_arity(f.op);
+            for(int i(0); i < arity; ++i)
+            {
+              if(i > 0)
+                _expect(",");
+              _parse_or();
+            }
+            _expect(")");
+            _emit(f.op);
+            return;
+          }
+
+          _pos = beg;
+          _error("unknown function '" + name + "'");
+        }
+      }; // class ExprCompiler
+    } // namespace Intern
+    /// \endcond
+
+    /**
+     * \brief Compiled expression function implementation
+     *
+     * This class provides an implementation of the Analytic::Function interface which parses a
+     * formula in the up to three variables 'x', 'y' and 'z' given as a string at runtime and
+     * compiles it into a compact postfix bytecode program, in which all constant subexpressions
+     * are folded. In contrast to the ParsedFunction class, this class does not require any
+     * third-party library and its evaluator can compute gradients and hessians by forward-mode
+     * automatic differentiation, so it can also be used as a reference solution for H1 error
+     * computations or as a boundary condition for derivative-based assemblies.
+     *
+     * The evaluator additionally offers the #Evaluator::value_batch() function, which evaluates
+     * the function in an array of points by applying each bytecode operation to a whole block
+     * of points at once, so that the inner loops can be vectorised by the compiler.
+     *
+     * The following syntax is supported, listed by increasing precedence:
+     * - logical operators <c>|</c> and <c>&</c>
+     * - comparison operators <c>=</c>, <c>==</c>, <c>!=</c>, <c><</c>, <c><=</c>, <c>></c>, <c>>=</c>
+     * - arithmetic operators <c>+</c>, <c>-</c>, <c>*</c>, <c>/</c>
+     * - unary operators <c>-</c>, <c>+</c> and <c>!</c>
+     * - the right-associative power operator <c>^</c>
+     * - the functions <c>abs</c>, <c>sqrt</c>, <c>exp</c>, <c>log</c>, <c>log10</c>, <c>sin</c>,
+     *   <c>cos</c>, <c>tan</c>, <c>asin</c>, <c>acos</c>, <c>atan</c>, <c>sinh</c>, <c>cosh</c>,
+     *   <c>tanh</c>, <c>atan2(y,x)</c>, <c>pow(a,b)</c>, <c>min(a,b)</c>, <c>max(a,b)</c> and
+     *   <c>if(c,a,b)</c>
+     *
+     * This is the common subset of the syntax of the 'fparser' library, so that the formulae
+     * used with the ParsedFunction class can be used with this class as well.
+     *
+     * \note
+     * Comparisons and logical operators are treated as piecewise constant functions and
+     * the \c if function evaluates both branches, so the derivatives of piecewise defined
+     * functions are the derivatives of the active piece. The evaluation follows the IEEE
+     * semantics, i.e. invalid operations like a division by zero result in inf or NaN
+     * instead of an exception.
+     *
+     * This class already offers the following pre-defined constants:
+     * - <c>pi</c> = 3.14159...
+     * - <c>eps</c> = ~1E-16
+     *
+     * \tparam dim_
+     * The dimension of the function, i.e. the number of variables. Must be 1 <= dim_ <= 3.
+     */
+    template<int dim_>
+    class ExpressionFunction :
+      public Analytic::Function
+    {
+    public:
+      /// validate our dimension
+      static_assert((dim_ >= 1) && (dim_ <= 3), "unsupported function dimension");
+
+      /// specify our domain dimension
+      static constexpr int domain_dim = dim_;
+
+      /// This function is always scalar
+      typedef Analytic::Image::Scalar ImageType;
+
+      /// we can compute function values
+      static constexpr bool can_value = true;
+
+      /// we can compute gradients
+      static constexpr bool can_grad = true;
+
+      /// we can compute hessians
+      static constexpr bool can_hess = true;
+
+      /// number of points processed at once by the batch evaluation
+      static constexpr int batch_size = 32;
+
+    private:
+      /// the constants
+      std::map<String, double> _consts;
+      /// the compiled bytecode program
+      std::vector<Intern::ExprInstr> _program;
+      /// the stack depth of the program
+      int _depth;
+
+    public:
+      /**
+       * \brief Standard constructor
+       *
+       * This constructor adds the following constants:
+       * - <c>pi</c> = 3.14159...
+       * - <c>eps</c> = ~1E-16
+       */
+      explicit ExpressionFunction() :
+        _depth(0)
+      {
+        add_constant("pi", Math::pi<double>());
+        add_constant("eps", Math::eps<double>());
+      }
+
+      /**
+       * \brief Constructor
+       *
+       * This constructor creates an expression function from a String.
+       *
+       * \param[in] function
+       * The expression that defines the function in the variables \c x, \c y, and \c z.
+       *
+       * \throws ExpressionParseError
+       * An instance of the ExpressionParseError exception is thrown if the formula cannot
+       * be parsed. The message of the exception contains more information on the cause of
+       * the error and should be presented the user in an appropriate way.
+       */
+      explicit ExpressionFunction(const String& function) :
+        ExpressionFunction()
+      {
+        parse(function);
+      }
+
+      /**
+       * \brief Adds a constant.
+       *
+       * \param[in] name
+       * The name of the constant.
+       *
+       * \param[in] value
+       * The value of the constant.
+       *
+       * \note
+       * Constants are folded into the program by #parse(), so all constants
+       * have to be added before the function is parsed.
+       */
+      void add_constant(const String& name, double value)
+      {
+        _consts[name] = value;
+      }
+
+      /**
+       * \brief Parses a function.
+       *
+       * \param[in] function
+       * The expression that defines the function in the variables \c x, \c y, and \c z.
+       *
+       * \throws ExpressionParseError
+       * An instance of the ExpressionParseError exception is thrown if the formula cannot
+       * be parsed. The message of the exception contains more information on the cause of
+       * the error and should be presented the user in an appropriate way.
+       */
+      void parse(const String& function)
+      {
+        std::vector<String> vars;
+        vars.push_back("x");
+        if(dim_ > 1) vars.push_back("y");
+        if(dim_ > 2) vars.push_back("z");
+
+        Intern::ExprCompiler(function, vars, _consts, _program).compile();
+
+        // compute the stack depth
+        int depth(0);
+        _depth = 0;
+        for(const auto& ins : _program)
+        {
+          depth += 1 - Intern::expr_op_arity(ins.op);
+          _depth = Math::max(_depth, depth);
+        }
+      }
+
+      /// \returns The number of instructions of the compiled program.
+      std::size_t get_program_size() const
+      {
+        return _program.size();
+      }
+
+      template<typename Traits_>
+      class Evaluator :
+        public Analytic::Function::Evaluator<Traits_>
+      {
+      public:
+        /// coefficient data type
+        typedef typename Traits_::DataType DataType;
+        /// evaluation point type
+        typedef typename Traits_::PointType PointType;
+        /// value type
+        typedef typename Traits_::ValueType ValueType;
+        /// gradient type
+        typedef typename Traits_::GradientType GradientType;
+        /// hessian type
+        typedef typename Traits_::HessianType HessianType;
+
+      private:
+        /// the jet type
+        typedef Intern::ExprJet<DataType, dim_> JetType;
+
+        /// the compiled program of the function
+        const std::vector<Intern::ExprInstr>& _program;
+        /// the value stack for batch evaluation
+        std::vector<DataType> _stack;
+        /// the jet stack for derivatives
+        std::vector<JetType> _jets;
+
+      public:
+        explicit Evaluator(const ExpressionFunction& function) :
+          _program(function._program),
+          _stack(std::size_t(function._depth * batch_size)),
+          _jets(std::size_t(function._depth))
+        {
+          XASSERTM(!_program.empty(), "expression function has not been parsed");
+        }
+
+        ValueType value(const PointType& point)
+        {
+          return *Intern::expr_eval_batch(_program, &point, 1, _stack.data());
+        }
+
+        GradientType gradient(const PointType& point)
+        {
+          const JetType& jet = Intern::expr_eval_jet<false>(_program, point, _jets.data());
+          GradientType grad;
+          for(int i(0); i < dim_; ++i)
+            grad[i] = jet.g[i];
+          return grad;
+        }
+
+        HessianType hessian(const PointType& point)
+        {
+          const JetType& jet = Intern::expr_eval_jet<true>(_program, point, _jets.data());
+          HessianType hess;
+          for(int i(0); i < dim_; ++i)
+            for(int j(0); j < dim_; ++j)
+              hess[i][j] = jet.h[i][j];
+          return hess;
+        }
+
+        /**
+         * \brief Computes the function values in an array of points.
+         *
+         * \param[out] values
+         * The array of \p count function values.
+         *
+         * \param[in] points
+         * The array of \p count points in which the function is to be evaluated.
+         *
+         * \param[in] count
+         * The number of points.
+         */
+        void value_batch(ValueType* values, const PointType* points, const Index count)
+        {
+          for(Index k(0); k < count; k += Index(batch_size))
+          {
+            const int n = int(Math::min(count - k, Index(batch_size)));
+            const DataType* res = Intern::expr_eval_batch(_program, &points[k], n, _stack.data());
+            for(int l(0); l < n; ++l)
+              values[k + Index(l)] = res[l];
+          }
+        }
+      }; // class ExpressionFunction::Evaluator<...>
+    }; // class ExpressionFunction
+  } // namespace Analytic
+} // namespace FEAT
+
+#endif // KERNEL_ANALYTIC_EXPRESSION_FUNCTION_HPP
@@ -11,6 +11,7 @@
 #include <kernel/eval_tags.hpp>
 #include <kernel/space/eval_data.hpp>
 #include <kernel/trafo/eval_data.hpp>
+#include <kernel/util/region_timer.hpp>
 
 namespace FEAT
 {
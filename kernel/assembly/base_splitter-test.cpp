@@ -47,13 +47,43 @@ public:
 
     // create base cell splitting
     root_mesh_node->create_base_splitting();
+    TEST_CHECK_EQUAL(root_mesh_node->get_num_base_cells(), Index(16));
 
-    // refine mesh node
+    // extract a patch containing the first 8 of the 16 base cells
+    RootMeshNodeType* patch_mesh_node = nullptr;
+    {
+      std::vector<Index> dom_ptr = {Index(0), Index(8), Index(16)};
+      std::vector<Index> img_idx(16);
+      for(Index i(0); i < Index(16); ++i)
+        img_idx[i] = i;
+      Adjacency::Graph elems_at_rank(Index(2), Index(16), Index(16), dom_ptr.data(), img_idx.data());
+      std::vector<int> comm_ranks;
+      patch_mesh_node = root_mesh_node->extract_patch(comm_ranks, elems_at_rank, 0);
+    }
+
+    // refine mesh nodes
     for(int i(0); i < 2; ++i)
     {
       auto* old_node = root_mesh_node;
       root_mesh_node = old_node->refine();
       delete old_node;
+      old_node = patch_mesh_node;
+      patch_mesh_node = old_node->refine();
+      delete old_node;
+    }
+
+    // check the refined base-cell mapping: each of the 16 base cells has 16 children
+    {
+      const std::vector<Index>& base_cells = root_mesh_node->get_base_cells();
+      TEST_CHECK_EQUAL(Index(base_cells.size()), root_mesh_node->get_mesh()->get_num_elements());
+      std::vector<Index> num_children(16, Index(0));
+      for(Index cell : base_cells)
+      {
+        TEST_CHECK(cell < Index(16));
+        ++num_children.at(cell);
+      }
+      for(Index n : num_children)
+        TEST_CHECK_EQUAL(n, Index(16));
     }
 
     {
@@ -66,7 +96,25 @@ public:
       test_space<Space::CroRavRanTur::Element<TrafoType>>(trafo, *root_mesh_node);
     }
 
-    // delete root mesh node
+    // the patch knows all 16 base cells, although it contains only 8 of them
+    {
+      TEST_CHECK_EQUAL(patch_mesh_node->get_num_base_cells(), Index(16));
+      TEST_CHECK_EQUAL(Index(patch_mesh_node->get_base_cells().size()), Index(128));
+
+      TrafoType trafo(*patch_mesh_node->get_mesh());
+      Space::Lagrange1::Element<TrafoType> space(trafo);
+      Assembly::BaseSplitter<Space::Lagrange1::Element<TrafoType>, DT_, IT_> splitter(space, *patch_mesh_node);
+
+      VectorType vec(space.get_num_dofs(), DT_(1));
+      std::vector<VectorType> split_vec;
+      splitter.split(split_vec, vec);
+      TEST_CHECK_EQUAL(split_vec.size(), std::size_t(16));
+      for(std::size_t i(0); i < split_vec.size(); ++i)
+        TEST_CHECK_EQUAL(split_vec.at(i).empty(), i >= std::size_t(8));
+    }
+
+    // delete mesh nodes
+    delete patch_mesh_node;
     delete root_mesh_node;
   }
 
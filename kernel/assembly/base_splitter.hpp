@@ -7,10 +7,11 @@
 #ifndef KERNEL_ASSEMBLY_BASE_SPLITTER_HPP
 #define KERNEL_ASSEMBLY_BASE_SPLITTER_HPP 1
 
-#include <kernel/assembly/mirror_assembler.hpp>
+#include <kernel/adjacency/graph.hpp>
 #include <kernel/geometry/mesh_node.hpp>
 #include <kernel/lafem/dense_vector.hpp>
 #include <kernel/lafem/vector_mirror.hpp>
+#include <kernel/space/dof_mapping_renderer.hpp>
 
 #include <vector>
 
@@ -50,6 +51,10 @@ namespace FEAT
        * The root mesh node on which \p space is defined. The 'create_base_splitting'
        * function must have been called for the root mesh node representing the base
        * mesh from which this mesh node is refined.
+       *
+       * The mirror of each base cell contains all dofs of the cells which are refined
+       * from that base cell. If \p mesh_node is a patch, the mirrors of all base cells
+       * that are not part of the patch are empty.
        */
       explicit BaseSplitter(const SpaceType& space, const RootMeshNodeType& mesh_node)
       {
@@ -57,22 +62,39 @@ namespace FEAT
         if(mesh_node.get_mesh() != &space.get_mesh())
           throw InternalError("Space mesh and root mesh different");
 
-        // loop over all base cell mesh-parts
-        for(Index cell(0); ; ++cell)
+        // get the base-cell mapping
+        const std::vector<Index>& base_cells = mesh_node.get_base_cells();
+        if(base_cells.empty())
+          throw InternalError("No base cell splitting available in mesh node");
+
+        const Index num_cells = Index(base_cells.size());
+        XASSERTM(num_cells == space.get_mesh().get_num_entities(SpaceType::shape_dim), "invalid base-cell mapping");
+        // note: a patch may not contain all base cells, so use the global count of the base mesh
+        const Index num_base_cells = mesh_node.get_num_base_cells();
+
+        // build the cells-at-base-cell graph by transposing the base-cell mapping
+        std::vector<Index> dom_ptr(num_cells + Index(1));
+        for(Index i(0); i <= num_cells; ++i)
+          dom_ptr[i] = i;
+        Adjacency::Graph base_at_cell(num_cells, num_base_cells, num_cells, dom_ptr.data(), base_cells.data());
+        Adjacency::Graph cells_at_base(Adjacency::RenderType::transpose, base_at_cell);
+
+        // build the dofs-at-base-cell graph
+        Adjacency::Graph dofs_at_cell(Space::DofMappingRenderer::render(space));
+        Adjacency::Graph dofs_at_base(Adjacency::RenderType::injectify_sorted, cells_at_base, dofs_at_cell);
+
+        // create one mirror for each base cell
+        const Index* ptr = dofs_at_base.get_domain_ptr();
+        const Index* idx = dofs_at_base.get_image_idx();
+        _mirrors.reserve(num_base_cells);
+        for(Index cell(0); cell < num_base_cells; ++cell)
         {
-          // try to fetch base-cell mesh part
-          const auto* mesh_part = mesh_node.find_mesh_part("_base:" + stringify(cell));
-          if(mesh_part == nullptr)
-            break;
-
-          // assemble mirror
-          LAFEM::VectorMirror<Mem::Main, DT_, IT_> mir;
-          Assembly::MirrorAssembler::assemble_mirror(mir, space, *mesh_part);
+          LAFEM::VectorMirror<Mem::Main, DT_, IT_> mir(space.get_num_dofs(), ptr[cell+1] - ptr[cell]);
+          IT_* mir_idx = mir.indices();
+          for(Index j(ptr[cell]); j < ptr[cell+1]; ++j)
+            mir_idx[j - ptr[cell]] = IT_(idx[j]);
           _mirrors.push_back(std::move(mir));
         }
-
-        if(_mirrors.empty())
-          throw InternalError("No base cell splitting available in mesh node");
       }
 
       virtual ~BaseSplitter()
@@ -99,6 +121,11 @@ namespace FEAT
         // loop over all mirrors and gather
         for(auto it = _mirrors.begin(); it != _mirrors.end(); ++it)
         {
+          if((*it).empty())
+          {
+            splits.push_back(LAFEM::DenseVector<Mem::Main, DT_, IT_>());
+            continue;
+          }
           auto svec = (*it).create_buffer(vector);
           (*it).gather(svec, vector);
           splits.push_back(std::move(svec));
@@ -131,6 +158,8 @@ namespace FEAT
         // loop over all mirrors and scatter splits
         for(std::size_t i(0); i < _mirrors.size(); ++i)
         {
+          if(_mirrors.at(i).empty())
+            continue;
           _mirrors.at(i).scatter_axpy(vector, splits.at(i));
           auto tmp = splits.at(i).clone();
           tmp.format(DT_(1));
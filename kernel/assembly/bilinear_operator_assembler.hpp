@@ -61,6 +61,8 @@ namespace FEAT
         const CubatureFactory_& cubature_factory,
         typename Matrix_::DataType alpha = typename Matrix_::DataType(1))
       {
+        RegionTimer::Scope region("asm-bilinear-operator");
+
         // validate matrix dimensions
         XASSERTM(matrix.rows() == test_space.get_num_dofs(), "invalid matrix dimensions");
         XASSERTM(matrix.columns() == trial_space.get_num_dofs(), "invalid matrix dimensions");
@@ -222,6 +224,8 @@ namespace FEAT
         const CubatureFactory_& cubature_factory,
         typename Matrix_::DataType alpha = typename Matrix_::DataType(1))
       {
+        RegionTimer::Scope region("asm-bilinear-operator");
+
         // validate matrix dimensions
         XASSERTM(matrix.rows() == space.get_num_dofs(), "invalid matrix dimensions");
         XASSERTM(matrix.columns() == space.get_num_dofs(), "invalid matrix dimensions");
@@ -376,6 +380,8 @@ namespace FEAT
         const CubatureFactory_& cubature_factory,
         typename Matrix_::DataType alpha = typename Matrix_::DataType(1))
       {
+        RegionTimer::Scope region("asm-bilinear-operator");
+
         // Make sure matrix and operator match
         static_assert(Operator_::BlockHeight == Matrix_::BlockHeight, "Operator/Matrix BlockHeight mismatch.");
         static_assert(Operator_::BlockWidth == Matrix_::BlockWidth, "Operator/Matrix BlockHeight mismatch.");
@@ -557,6 +563,8 @@ namespace FEAT
         const CubatureFactory_& cubature_factory,
         typename Matrix_::DataType alpha = typename Matrix_::DataType(1))
       {
+        RegionTimer::Scope region("asm-bilinear-operator");
+
         // Make sure matrix and operator match
         static_assert(Operator_::BlockHeight == Matrix_::BlockHeight, "Operator/Matrix BlockHeight mismatch.");
         static_assert(Operator_::BlockWidth == Matrix_::BlockWidth, "Operator/Matrix BlockHeight mismatch.");
@@ -8,15 +8,32 @@
 #define KERNEL_ASSEMBLY_BURGERS_ASSEMBLER_HPP
 
 #include <kernel/assembly/asm_traits.hpp>
+#include <kernel/assembly/scatter_map.hpp>
+#include <kernel/space/parametric_evaluator.hpp>
+#include <kernel/trafo/eval_cache.hpp>
 #include <kernel/lafem/dense_vector.hpp>
 #include <kernel/lafem/sparse_matrix_bcsr.hpp>
 #include <kernel/lafem/dense_vector_blocked.hpp>
 #include <kernel/global/vector.hpp>
 
+#include <memory>
+
 namespace FEAT
 {
   namespace Assembly
   {
+    /// \cond internal
+    namespace Intern
+    {
+      /// overload for parametric space evaluators, whose prepare() does not evaluate the trafo
+      template<typename SpaceEval_, typename TrafoEval_, typename SpaceEvalTraits_, SpaceTags ref_caps_>
+      std::true_type is_parametric_evaluator(const Space::ParametricEvaluator<SpaceEval_, TrafoEval_, SpaceEvalTraits_, ref_caps_>*);
+
+      /// overload for all other space evaluators
+      std::false_type is_parametric_evaluator(const void*);
+    } // namespace Intern
+    /// \endcond
+
     /**
      * \brief Burgers operator assembly class
      *
@@ -104,6 +121,18 @@ namespace FEAT
       {
       }
 
+      /**
+       * \brief Trafo evaluation cache type for a given velocity space
+       *
+       * This cache type contains exactly the trafo data required by the assembly functions of this class.
+       *
+       * \tparam Space_
+       * The velocity space.
+       */
+      template<typename Space_>
+      using TrafoEvalCache = Trafo::EvalCache<typename Space_::TrafoType, DataType_,
+        AsmTraits1<DataType_, Space_, TrafoTags::jac_det, SpaceTags::value|SpaceTags::grad>::trafo_config>;
+
       /**
        * \brief Assembles the Burgers operator into a matrix.
        *
@@ -121,6 +150,10 @@ namespace FEAT
        *
        * \param[in] scale
        * A scaling factor for the matrix to be assembled.
+       *
+       * \param[in] scatter_map
+       * An optional scatter map for the matrix, see SymbolicAssembler::assemble_scatter_map_std1.
+       * If given, the local matrices are scattered directly into the matrix value array.
        */
       template<typename Space_>
       void assemble_matrix(
@@ -128,9 +161,261 @@ namespace FEAT
         const LAFEM::DenseVectorBlocked<Mem::Main, DataType_, IndexType_, dim_>& convect,
         const Space_& space,
         const Cubature::DynamicFactory& cubature_factory,
+        const DataType_ scale = DataType_(1),
+        const ScatterMap<IndexType_>* scatter_map = nullptr
+        ) const
+      {
+        typedef AsmTraits1<DataType_, Space_, TrafoTags::jac_det, SpaceTags::value|SpaceTags::grad> AsmTraits;
+
+        // create cubature rule
+        typename AsmTraits::CubatureRuleType cubature_rule(Cubature::ctor_factory, cubature_factory);
+
+        this->_assemble_matrix(matrix, convect, space, cubature_rule, static_cast<const TrafoEvalCache<Space_>*>(nullptr), scale, scatter_map);
+      }
+
+      /**
+       * \brief Assembles the Burgers operator into a matrix.
+       *
+       * \param[in,out] matrix
+       * The matrix to be assembled.
+       *
+       * \param[in] convect
+       * The transport vector for the convection.
+       *
+       * \param[in] space
+       * The velocity space.
+       *
+       * \param[in] trafo_cache
+       * The trafo evaluation cache to be used for integration. It must have been compiled for the
+       * trafo of the space and its configuration must contain all data required by this assembler.
+       *
+       * \param[in] scale
+       * A scaling factor for the matrix to be assembled.
+       *
+       * \param[in] scatter_map
+       * An optional scatter map for the matrix, see SymbolicAssembler::assemble_scatter_map_std1.
+       * If given, the local matrices are scattered directly into the matrix value array.
+       */
+      template<typename Space_, TrafoTags cache_config_>
+      void assemble_matrix(
+        LAFEM::SparseMatrixBCSR<Mem::Main, DataType_, IndexType_, dim_, dim_>& matrix,
+        const LAFEM::DenseVectorBlocked<Mem::Main, DataType_, IndexType_, dim_>& convect,
+        const Space_& space,
+        const Trafo::EvalCache<typename Space_::TrafoType, DataType_, cache_config_>& trafo_cache,
+        const DataType_ scale = DataType_(1),
+        const ScatterMap<IndexType_>* scatter_map = nullptr
+        ) const
+      {
+        XASSERTM(&trafo_cache.get_trafo() == &space.get_trafo(), "trafo cache was not created for the trafo of the space");
+        trafo_cache.validate();
+
+        this->_assemble_matrix(matrix, convect, space, trafo_cache.get_cubature_rule(), &trafo_cache, scale, scatter_map);
+      }
+
+      /**
+       * \brief Assembles the Burgers operator into a scalar matrix.
+       *
+       * \param[in,out] matrix
+       * The scalar matrix to be assembled.
+       *
+       * \param[in] convect
+       * The transport vector for the convection.
+       *
+       * \param[in] space
+       * The velocity space.
+       *
+       * \param[in] cubature_factory
+       * The cubature factory to be used for integration.
+       *
+       * \param[in] scale
+       * A scaling factor for the matrix to be assembled.
+       *
+       * \param[in] scatter_map
+       * An optional scatter map for the matrix, see SymbolicAssembler::assemble_scatter_map_std1.
+       * If given, the local matrices are scattered directly into the matrix value array.
+       */
+      template<typename Matrix_, typename Space_>
+      void assemble_scalar_matrix(
+        Matrix_& matrix,
+        const LAFEM::DenseVectorBlocked<Mem::Main, DataType_, IndexType_, dim_>& convect,
+        const Space_& space,
+        const Cubature::DynamicFactory& cubature_factory,
+        const DataType_ scale = DataType_(1),
+        const ScatterMap<IndexType_>* scatter_map = nullptr
+        ) const
+      {
+        typedef AsmTraits1<DataType_, Space_, TrafoTags::jac_det, SpaceTags::value|SpaceTags::grad> AsmTraits;
+
+        // create cubature rule
+        typename AsmTraits::CubatureRuleType cubature_rule(Cubature::ctor_factory, cubature_factory);
+
+        this->_assemble_scalar_matrix(matrix, convect, space, cubature_rule, static_cast<const TrafoEvalCache<Space_>*>(nullptr), scale, scatter_map);
+      }
+
+      /**
+       * \brief Assembles the Burgers operator into a scalar matrix.
+       *
+       * \param[in,out] matrix
+       * The scalar matrix to be assembled.
+       *
+       * \param[in] convect
+       * The transport vector for the convection.
+       *
+       * \param[in] space
+       * The velocity space.
+       *
+       * \param[in] trafo_cache
+       * The trafo evaluation cache to be used for integration. It must have been compiled for the
+       * trafo of the space and its configuration must contain all data required by this assembler.
+       *
+       * \param[in] scale
+       * A scaling factor for the matrix to be assembled.
+       *
+       * \param[in] scatter_map
+       * An optional scatter map for the matrix, see SymbolicAssembler::assemble_scatter_map_std1.
+       * If given, the local matrices are scattered directly into the matrix value array.
+       */
+      template<typename Matrix_, typename Space_, TrafoTags cache_config_>
+      void assemble_scalar_matrix(
+        Matrix_& matrix,
+        const LAFEM::DenseVectorBlocked<Mem::Main, DataType_, IndexType_, dim_>& convect,
+        const Space_& space,
+        const Trafo::EvalCache<typename Space_::TrafoType, DataType_, cache_config_>& trafo_cache,
+        const DataType_ scale = DataType_(1),
+        const ScatterMap<IndexType_>* scatter_map = nullptr
+        ) const
+      {
+        XASSERTM(&trafo_cache.get_trafo() == &space.get_trafo(), "trafo cache was not created for the trafo of the space");
+        trafo_cache.validate();
+
+        this->_assemble_scalar_matrix(matrix, convect, space, trafo_cache.get_cubature_rule(), &trafo_cache, scale, scatter_map);
+      }
+
+      /**
+       * \brief Assembles the Burgers operator into a vector.
+       *
+       * \param[in,out] vector
+       * The vector to be assembled.
+       *
+       * \param[in] convect
+       * The transport vector for the convection.
+       *
+       * \param[in] primal
+       * The primal vector, usually a solution vector.
+       *
+       * \param[in] space
+       * The velocity space.
+       *
+       * \param[in] cubature_factory
+       * The cubature factory to be used for integration.
+       *
+       * \param[in] scale
+       * A scaling factor the the vector to be assembled.
+       */
+      template<typename Space_>
+      void assemble_vector(
+        LAFEM::DenseVectorBlocked<Mem::Main, DataType_, IndexType_, dim_>& vector,
+        const LAFEM::DenseVectorBlocked<Mem::Main, DataType_, IndexType_, dim_>& convect,
+        const LAFEM::DenseVectorBlocked<Mem::Main, DataType_, IndexType_, dim_>& primal,
+        const Space_& space,
+        const Cubature::DynamicFactory& cubature_factory,
         const DataType_ scale = DataType_(1)
         ) const
       {
+        typedef AsmTraits1<DataType_, Space_, TrafoTags::jac_det, SpaceTags::value|SpaceTags::grad> AsmTraits;
+
+        // create cubature rule
+        typename AsmTraits::CubatureRuleType cubature_rule(Cubature::ctor_factory, cubature_factory);
+
+        this->_assemble_vector(vector, convect, primal, space, cubature_rule, static_cast<const TrafoEvalCache<Space_>*>(nullptr), scale);
+      }
+
+      /**
+       * \brief Assembles the Burgers operator into a vector.
+       *
+       * \param[in,out] vector
+       * The vector to be assembled.
+       *
+       * \param[in] convect
+       * The transport vector for the convection.
+       *
+       * \param[in] primal
+       * The primal vector, usually a solution vector.
+       *
+       * \param[in] space
+       * The velocity space.
+       *
+       * \param[in] trafo_cache
+       * The trafo evaluation cache to be used for integration. It must have been compiled for the
+       * trafo of the space and its configuration must contain all data required by this assembler.
+       *
+       * \param[in] scale
+       * A scaling factor the the vector to be assembled.
+       */
+      template<typename Space_, TrafoTags cache_config_>
+      void assemble_vector(
+        LAFEM::DenseVectorBlocked<Mem::Main, DataType_, IndexType_, dim_>& vector,
+        const LAFEM::DenseVectorBlocked<Mem::Main, DataType_, IndexType_, dim_>& convect,
+        const LAFEM::DenseVectorBlocked<Mem::Main, DataType_, IndexType_, dim_>& primal,
+        const Space_& space,
+        const Trafo::EvalCache<typename Space_::TrafoType, DataType_, cache_config_>& trafo_cache,
+        const DataType_ scale = DataType_(1)
+        ) const
+      {
+        XASSERTM(&trafo_cache.get_trafo() == &space.get_trafo(), "trafo cache was not created for the trafo of the space");
+        trafo_cache.validate();
+
+        this->_assemble_vector(vector, convect, primal, space, trafo_cache.get_cubature_rule(), &trafo_cache, scale);
+      }
+
+      /**
+       * \brief Sets the convection field norm \f$\|v\|_\Omega\f$ for the local streamline diffusion parameter delta_T.
+       *
+       * \param[in] convect
+       * The (local) convection field vector.
+       */
+      void set_sd_v_norm(const LAFEM::DenseVectorBlocked<Mem::Main, DataType_, IndexType_, dim_>& convect)
+      {
+        const auto* vals = convect.elements();
+        DataType_ r = DataType(0);
+        for(Index i(0); i < convect.size(); ++i)
+          r = Math::max(r, vals[i].norm_euclid());
+        this->sd_v_norm = r;
+      }
+
+      /**
+       * \brief Sets the convection field norm \f$\|v\|_\Omega\f$ for the streamline diffusion parameter delta_T.
+       *
+       * \note
+       * This function automatically syncs the norm over all processes by using the vector's gate.
+       *
+       * \param[in] convect
+       * The (global) convection field vector.
+       */
+      template<typename LocalVector_, typename Mirror_>
+      void set_sd_v_norm(const Global::Vector<LocalVector_, Mirror_>& convect)
+      {
+        this->set_sd_v_norm(convect.local());
+        const auto* gate = convect.get_gate();
+        if(gate != nullptr)
+          this->sd_v_norm = gate->max(this->sd_v_norm);
+      }
+
+    protected:
+      /// Burgers operator assembly kernel for blocked matrices; the trafo data is loaded from \p trafo_cache unless it is \c nullptr
+      template<typename Space_, typename CubatureRule_, typename TrafoCache_>
+      void _assemble_matrix(
+        LAFEM::SparseMatrixBCSR<Mem::Main, DataType_, IndexType_, dim_, dim_>& matrix,
+        const LAFEM::DenseVectorBlocked<Mem::Main, DataType_, IndexType_, dim_>& convect,
+        const Space_& space,
+        const CubatureRule_& cubature_rule,
+        const TrafoCache_* trafo_cache,
+        const DataType_ scale,
+        const ScatterMap<IndexType_>* scatter_map
+        ) const
+      {
+        RegionTimer::Scope region("asm-burgers-matrix");
+
         // validate matrix and vector dimensions
         XASSERTM(matrix.rows() == space.get_num_dofs(), "invalid matrix dimensions");
         XASSERTM(matrix.columns() == space.get_num_dofs(), "invalid matrix dimensions");
@@ -170,11 +455,12 @@ namespace FEAT
         // create space evaluation data
         typename AsmTraits::SpaceEvalData space_data;
 
-        // create cubature rule
-        typename AsmTraits::CubatureRuleType cubature_rule(Cubature::ctor_factory, cubature_factory);
-
-        // create matrix scatter-axpy
-        typename MatrixType::ScatterAxpy scatter_matrix(matrix);
+        // create matrix scatter-axpy unless we use a scatter map
+        std::unique_ptr<typename MatrixType::ScatterAxpy> scatter_matrix;
+        if(scatter_map == nullptr)
+          scatter_matrix.reset(new typename MatrixType::ScatterAxpy(matrix));
+        else
+          XASSERTM(scatter_map->is_compatible(matrix), "scatter map does not match the matrix");
 
         // create convection gather-axpy
         typename VectorType::GatherAxpy gather_conv(convect);
@@ -216,11 +502,17 @@ namespace FEAT
         // our local delta for streamline diffusion
         DataType local_delta = DataType(0);
 
+        // the trafo evaluator only needs to be prepared if the trafo data is not cached, if the
+        // space evaluator is not parametric or if the streamline diffusion parameter is computed
+        const bool need_trafo_eval = (trafo_cache == nullptr) || need_streamdiff ||
+          !decltype(Intern::is_parametric_evaluator(&space_eval))::value;
+
         // loop over all cells of the mesh
         for(typename AsmTraits::CellIterator cell(trafo_eval.begin()); cell != trafo_eval.end(); ++cell)
         {
           // prepare trafo evaluator
-          trafo_eval.prepare(cell);
+          if(need_trafo_eval)
+            trafo_eval.prepare(cell);
 
           // prepare space evaluator
           space_eval.prepare(trafo_eval);
@@ -273,8 +565,11 @@ namespace FEAT
           // loop over all quadrature points and integrate
           for(int point(0); point < cubature_rule.get_num_points(); ++point)
           {
-            // compute trafo data
-            trafo_eval(trafo_data, cubature_rule.get_point(point));
+            // compute trafo data or load it from the cache
+            if(trafo_cache != nullptr)
+              trafo_cache->load(trafo_data, cell, point);
+            else
+              trafo_eval(trafo_data, cubature_rule.get_point(point));
 
             // compute basis function data
             space_eval(space_data, trafo_data);
@@ -428,44 +723,35 @@ namespace FEAT
           }
 
           // scatter into matrix
-          scatter_matrix(local_matrix, dof_mapping, dof_mapping, scale);
+          if(scatter_map != nullptr)
+            scatter_map->scatter_axpy(matrix.val(), local_matrix, cell, scale);
+          else
+            (*scatter_matrix)(local_matrix, dof_mapping, dof_mapping, scale);
 
           // finish dof mapping
           dof_mapping.finish();
 
           // finish evaluators
           space_eval.finish();
-          trafo_eval.finish();
+          if(need_trafo_eval)
+            trafo_eval.finish();
         }
       }
 
-      /**
-       * \brief Assembles the Burgers operator into a scalar matrix.
-       *
-       * \param[in,out] matrix
-       * The scalar matrix to be assembled.
-       *
-       * \param[in] convect
-       * The transport vector for the convection.
-       *
-       * \param[in] space
-       * The velocity space.
-       *
-       * \param[in] cubature_factory
-       * The cubature factory to be used for integration.
-       *
-       * \param[in] scale
-       * A scaling factor for the matrix to be assembled.
-       */
-      template<typename Matrix_, typename Space_>
-      void assemble_scalar_matrix(
+      /// Burgers operator assembly kernel for scalar matrices; the trafo data is loaded from \p trafo_cache unless it is \c nullptr
+      template<typename Matrix_, typename Space_, typename CubatureRule_, typename TrafoCache_>
+      void _assemble_scalar_matrix(
         Matrix_& matrix,
         const LAFEM::DenseVectorBlocked<Mem::Main, DataType_, IndexType_, dim_>& convect,
         const Space_& space,
-        const Cubature::DynamicFactory& cubature_factory,
-        const DataType_ scale = DataType_(1)
+        const CubatureRule_& cubature_rule,
+        const TrafoCache_* trafo_cache,
+        const DataType_ scale,
+        const ScatterMap<IndexType_>* scatter_map
         ) const
       {
+        RegionTimer::Scope region("asm-burgers-matrix");
+
         // validate matrix and vector dimensions
         XASSERTM(matrix.rows() == space.get_num_dofs(), "invalid matrix dimensions");
         XASSERTM(matrix.columns() == space.get_num_dofs(), "invalid matrix dimensions");
@@ -508,11 +794,12 @@ namespace FEAT
         // create space evaluation data
         typename AsmTraits::SpaceEvalData space_data;
 
-        // create cubature rule
-        typename AsmTraits::CubatureRuleType cubature_rule(Cubature::ctor_factory, cubature_factory);
-
-        // create matrix scatter-axpy
-        typename MatrixType::ScatterAxpy scatter_matrix(matrix);
+        // create matrix scatter-axpy unless we use a scatter map
+        std::unique_ptr<typename MatrixType::ScatterAxpy> scatter_matrix;
+        if(scatter_map == nullptr)
+          scatter_matrix.reset(new typename MatrixType::ScatterAxpy(matrix));
+        else
+          XASSERTM(scatter_map->is_compatible(matrix), "scatter map does not match the matrix");
 
         // create convection gather-axpy
         typename VectorType::GatherAxpy gather_conv(convect);
@@ -548,11 +835,17 @@ namespace FEAT
         // our local delta for streamline diffusion
         DataType local_delta = DataType(0);
 
+        // the trafo evaluator only needs to be prepared if the trafo data is not cached, if the
+        // space evaluator is not parametric or if the streamline diffusion parameter is computed
+        const bool need_trafo_eval = (trafo_cache == nullptr) || need_streamdiff ||
+          !decltype(Intern::is_parametric_evaluator(&space_eval))::value;
+
         // loop over all cells of the mesh
         for(typename AsmTraits::CellIterator cell(trafo_eval.begin()); cell != trafo_eval.end(); ++cell)
         {
           // prepare trafo evaluator
-          trafo_eval.prepare(cell);
+          if(need_trafo_eval)
+            trafo_eval.prepare(cell);
 
           // prepare space evaluator
           space_eval.prepare(trafo_eval);
@@ -605,8 +898,11 @@ namespace FEAT
           // loop over all quadrature points and integrate
           for(int point(0); point < cubature_rule.get_num_points(); ++point)
           {
-            // compute trafo data
-            trafo_eval(trafo_data, cubature_rule.get_point(point));
+            // compute trafo data or load it from the cache
+            if(trafo_cache != nullptr)
+              trafo_cache->load(trafo_data, cell, point);
+            else
+              trafo_eval(trafo_data, cubature_rule.get_point(point));
 
             // compute basis function data
             space_eval(space_data, trafo_data);
@@ -694,48 +990,35 @@ namespace FEAT
           }
 
           // scatter into matrix
-          scatter_matrix(local_matrix, dof_mapping, dof_mapping, scale);
+          if(scatter_map != nullptr)
+            scatter_map->scatter_axpy(matrix.val(), local_matrix, cell, scale);
+          else
+            (*scatter_matrix)(local_matrix, dof_mapping, dof_mapping, scale);
 
           // finish dof mapping
           dof_mapping.finish();
 
           // finish evaluators
           space_eval.finish();
-          trafo_eval.finish();
+          if(need_trafo_eval)
+            trafo_eval.finish();
         }
       }
 
-      /**
-       * \brief Assembles the Burgers operator into a vector.
-       *
-       * \param[in,out] vector
-       * The vector to be assembled.
-       *
-       * \param[in] convect
-       * The transport vector for the convection.
-       *
-       * \param[in] primal
-       * The primal vector, usually a solution vector.
-       *
-       * \param[in] space
-       * The velocity space.
-       *
-       * \param[in] cubature_factory
-       * The cubature factory to be used for integration.
-       *
-       * \param[in] scale
-       * A scaling factor the the vector to be assembled.
-       */
-      template<typename Space_>
-      void assemble_vector(
+      /// Burgers operator assembly kernel for vectors; the trafo data is loaded from \p trafo_cache unless it is \c nullptr
+      template<typename Space_, typename CubatureRule_, typename TrafoCache_>
+      void _assemble_vector(
         LAFEM::DenseVectorBlocked<Mem::Main, DataType_, IndexType_, dim_>& vector,
         const LAFEM::DenseVectorBlocked<Mem::Main, DataType_, IndexType_, dim_>& convect,
         const LAFEM::DenseVectorBlocked<Mem::Main, DataType_, IndexType_, dim_>& primal,
         const Space_& space,
-        const Cubature::DynamicFactory& cubature_factory,
-        const DataType_ scale = DataType_(1)
+        const CubatureRule_& cubature_rule,
+        const TrafoCache_* trafo_cache,
+        const DataType_ scale
         ) const
       {
+        RegionTimer::Scope region("asm-burgers-vector");
+
         // validate matrix and vector dimensions
         XASSERTM(vector.size() == space.get_num_dofs(), "invalid vector size");
         XASSERTM(convect.size() == space.get_num_dofs(), "invalid vector size");
@@ -769,9 +1052,6 @@ namespace FEAT
         // create space evaluation data
         typename AsmTraits::SpaceEvalData space_data;
 
-        // create cubature rule
-        typename AsmTraits::CubatureRuleType cubature_rule(Cubature::ctor_factory, cubature_factory);
-
         // create vector-scatter-axpy (if needed)
         typename VectorType::ScatterAxpy scatter_vector(vector);
 
@@ -804,11 +1084,17 @@ namespace FEAT
         loc_v.format();
         //loc_grad_v.format();
 
+        // the trafo evaluator only needs to be prepared if the trafo data is not cached
+        // or if the space evaluator is not parametric
+        const bool need_trafo_eval = (trafo_cache == nullptr) ||
+          !decltype(Intern::is_parametric_evaluator(&space_eval))::value;
+
         // loop over all cells of the mesh
         for(typename AsmTraits::CellIterator cell(trafo_eval.begin()); cell != trafo_eval.end(); ++cell)
         {
           // prepare trafo evaluator
-          trafo_eval.prepare(cell);
+          if(need_trafo_eval)
+            trafo_eval.prepare(cell);
 
           // prepare space evaluator
           space_eval.prepare(trafo_eval);
@@ -833,8 +1119,11 @@ namespace FEAT
           // loop over all quadrature points and integrate
           for(int point(0); point < cubature_rule.get_num_points(); ++point)
           {
-            // compute trafo data
-            trafo_eval(trafo_data, cubature_rule.get_point(point));
+            // compute trafo data or load it from the cache
+            if(trafo_cache != nullptr)
+              trafo_cache->load(trafo_data, cell, point);
+            else
+              trafo_eval(trafo_data, cubature_rule.get_point(point));
 
             // compute basis function data
             space_eval(space_data, trafo_data);
@@ -951,42 +1240,10 @@ namespace FEAT
 
           // finish evaluators
           space_eval.finish();
-          trafo_eval.finish();
+          if(need_trafo_eval)
+            trafo_eval.finish();
         }
       }
-
-      /**
-       * \brief Sets the convection field norm \f$\|v\|_\Omega\f$ for the local streamline diffusion parameter delta_T.
-       *
-       * \param[in] convect
-       * The (local) convection field vector.
-       */
-      void set_sd_v_norm(const LAFEM::DenseVectorBlocked<Mem::Main, DataType_, IndexType_, dim_>& convect)
-      {
-        const auto* vals = convect.elements();
-        DataType_ r = DataType(0);
-        for(Index i(0); i < convect.size(); ++i)
-          r = Math::max(r, vals[i].norm_euclid());
-        this->sd_v_norm = r;
-      }
-
-      /**
-       * \brief Sets the convection field norm \f$\|v\|_\Omega\f$ for the streamline diffusion parameter delta_T.
-       *
-       * \note
-       * This function automatically syncs the norm over all processes by using the vector's gate.
-       *
-       * \param[in] convect
-       * The (global) convection field vector.
-       */
-      template<typename LocalVector_, typename Mirror_>
-      void set_sd_v_norm(const Global::Vector<LocalVector_, Mirror_>& convect)
-      {
-        this->set_sd_v_norm(convect.local());
-        const auto* gate = convect.get_gate();
-        if(gate != nullptr)
-          this->sd_v_norm = gate->max(this->sd_v_norm);
-      }
     }; // class BurgersAssembler<...>
   } // namespace Assembly
 } // namespace FEAT
@@ -62,6 +62,8 @@ namespace FEAT
         const CoarseSpace_& coarse_space,
         const CubatureFactory_& cubature_factory)
       {
+        RegionTimer::Scope region("asm-grid-transfer");
+
         // validate matrix and vector dimensions
         XASSERTM(matrix.rows() == fine_space.get_num_dofs(), "invalid matrix dimensions");
         XASSERTM(matrix.columns() == coarse_space.get_num_dofs(), "invalid matrix dimensions");
@@ -307,6 +309,8 @@ namespace FEAT
         const CoarseSpace_& coarse_space,
         const CubatureFactory_& cubature_factory)
       {
+        RegionTimer::Scope region("asm-grid-transfer");
+
         // create a weight vector
         auto weight = matrix.create_vector_l();
         matrix.format();
@@ -356,6 +360,8 @@ namespace FEAT
         const CoarseSpace_& coarse_space,
         const CubatureFactory_& cubature_factory)
       {
+        RegionTimer::Scope region("asm-grid-transfer");
+
         // validate matrix and vector dimensions
         XASSERTM(matrix.rows() == coarse_space.get_num_dofs(), "invalid matrix dimensions");
         XASSERTM(matrix.columns() == fine_space.get_num_dofs(), "invalid matrix dimensions");
@@ -601,6 +607,8 @@ namespace FEAT
         const CoarseSpace_& coarse_space,
         const CubatureFactory_& cubature_factory)
       {
+        RegionTimer::Scope region("asm-grid-transfer");
+
         // create a weight vector
         auto weight = matrix.create_vector_l();
         matrix.format();
@@ -51,6 +51,8 @@ namespace FEAT
         const CubatureFactory_& cubature_factory,
         typename Vector_::DataType alpha = typename Vector_::DataType(1))
       {
+        RegionTimer::Scope region("asm-linear-functional");
+
         // validate vector dimensions
         XASSERTM(vector.size() == space.get_num_dofs(), "invalid vector size");
 
@@ -0,0 +1,193 @@
+// FEAT3: Finite Element Analysis Toolbox, Version 3
+// Copyright (C) 2010 - 2020 by Stefan Turek & the FEAT group
+// FEAT3 is released under the GNU General Public License version 3,
+// see the file 'copyright.txt' in the top level directory for details.
+
+#include <test_system/test_system.hpp>
+#include <kernel/geometry/common_factories.hpp>
+#include <kernel/trafo/standard/mapping.hpp>
+#include <kernel/space/lagrange2/element.hpp>
+#include <kernel/space/discontinuous/element.hpp>
+#include <kernel/assembly/symbolic_assembler.hpp>
+#include <kernel/assembly/burgers_assembler.hpp>
+#include <kernel/lafem/sparse_matrix_csr.hpp>
+#include <kernel/lafem/sparse_matrix_bcsr.hpp>
+
+using namespace FEAT;
+using namespace FEAT::TestSystem;
+
+/**
+ * \brief Test class for the ScatterMap class template.
+ *
+ * \test Tests the assembly of scatter maps for identical and different test-/trial-spaces
+ * as well as the Burgers matrix assembly with scatter maps for CSR and BCSR matrices.
+ *
+ * \tparam DataType_
+ * The data type for the test. Shall be either double or float.
+ *
+ * \tparam IndexType_
+ * The index type for the test.
+ */
+template<typename DataType_, typename IndexType_>
+class ScatterMapTest :
+  public TestSystem::FullTaggedTest<Mem::Main, DataType_, IndexType_>
+{
+  typedef Geometry::ConformalMesh<Shape::Quadrilateral> MeshType;
+  typedef Trafo::Standard::Mapping<MeshType> TrafoType;
+  typedef Space::Lagrange2::Element<TrafoType> SpaceVeloType;
+  typedef Space::Discontinuous::Element<TrafoType, Space::Discontinuous::Variant::StdPolyP<1>> SpacePresType;
+
+  typedef LAFEM::SparseMatrixCSR<Mem::Main, DataType_, IndexType_> ScalarMatrixType;
+  typedef LAFEM::SparseMatrixBCSR<Mem::Main, DataType_, IndexType_, 2, 2> BlockMatrixType;
+  typedef LAFEM::DenseVectorBlocked<Mem::Main, DataType_, IndexType_, 2> VectorType;
+
+public:
+  ScatterMapTest() :
+    TestSystem::FullTaggedTest<Mem::Main, DataType_, IndexType_>("ScatterMapTest")
+  {
+  }
+
+  virtual ~ScatterMapTest()
+  {
+  }
+
+  void check_equal(const ScalarMatrixType& a, const ScalarMatrixType& b, const DataType_ eps) const
+  {
+    for(Index i(0); i < a.used_elements(); ++i)
+      TEST_CHECK_EQUAL_WITHIN_EPS(a.val()[i], b.val()[i], eps);
+  }
+
+  void check_equal(const BlockMatrixType& a, const BlockMatrixType& b, const DataType_ eps) const
+  {
+    const DataType_* va = a.template val<LAFEM::Perspective::pod>();
+    const DataType_* vb = b.template val<LAFEM::Perspective::pod>();
+    for(Index i(0); i < a.template used_elements<LAFEM::Perspective::pod>(); ++i)
+      TEST_CHECK_EQUAL_WITHIN_EPS(va[i], vb[i], eps);
+  }
+
+  void test_std2(const SpaceVeloType& space_v, const SpacePresType& space_p) const
+  {
+    // assemble a velocity-pressure coupling structure
+    ScalarMatrixType matrix_1, matrix_2;
+    Assembly::SymbolicAssembler::assemble_matrix_std2(matrix_1, space_v, space_p);
+    matrix_2 = matrix_1.clone(LAFEM::CloneMode::Layout);
+    matrix_1.format();
+    matrix_2.format();
+
+    Assembly::ScatterMap<IndexType_> scatter_map;
+    Assembly::SymbolicAssembler::assemble_scatter_map_std2(scatter_map, matrix_1, space_v, space_p);
+    TEST_CHECK(scatter_map.is_compatible(matrix_1));
+    TEST_CHECK_EQUAL(scatter_map.get_num_cells(), space_v.get_mesh().get_num_elements());
+
+    // scatter some artificial local matrices with both approaches
+    typename ScalarMatrixType::ScatterAxpy scatter_axpy(matrix_1);
+    typename SpaceVeloType::DofMappingType dof_map_v(space_v);
+    typename SpacePresType::DofMappingType dof_map_p(space_p);
+    Tiny::Matrix<DataType_, 9, 3> local_matrix;
+
+    for(Index cell(0); cell < scatter_map.get_num_cells(); ++cell)
+    {
+      for(int i(0); i < 9; ++i)
+        for(int j(0); j < 3; ++j)
+          local_matrix[i][j] = DataType_(1 + (cell % 5)) * DataType_(i + 2*j);
+
+      dof_map_v.prepare(cell);
+      dof_map_p.prepare(cell);
+      scatter_axpy(local_matrix, dof_map_v, dof_map_p, DataType_(0.5));
+      scatter_map.scatter_axpy(matrix_2.val(), local_matrix, cell, DataType_(0.5));
+      dof_map_p.finish();
+      dof_map_v.finish();
+    }
+
+    check_equal(matrix_1, matrix_2, Math::eps<DataType_>());
+
+    // a matrix with the same dimensions and number of non-zeros but a different pattern
+    ScalarMatrixType matrix_3(matrix_1.clone(LAFEM::CloneMode::Deep));
+    IndexType_* col_ind = matrix_3.col_ind();
+    for(Index i(0); i < matrix_3.rows(); ++i)
+    {
+      const IndexType_* row_ptr = matrix_3.row_ptr();
+      if(row_ptr[i+1] - row_ptr[i] < IndexType_(2))
+        continue;
+      std::swap(col_ind[row_ptr[i]], col_ind[row_ptr[i]+1]);
+      break;
+    }
+    TEST_CHECK(!scatter_map.is_compatible(matrix_3));
+
+    scatter_map.clear();
+    TEST_CHECK(scatter_map.empty());
+    TEST_CHECK(!scatter_map.is_compatible(matrix_1));
+  }
+
+  void test_burgers(const SpaceVeloType& space) const
+  {
+    const DataType_ eps = Math::pow(Math::eps<DataType_>(), DataType_(0.8));
+
+    Cubature::DynamicFactory cubature("auto-degree:5");
+
+    Assembly::BurgersAssembler<DataType_, IndexType_, 2> burgers;
+    burgers.nu = DataType_(0.1);
+    burgers.beta = DataType_(1);
+    burgers.frechet_beta = DataType_(1);
+    burgers.deformation = true;
+
+    VectorType vec_conv(space.get_num_dofs());
+    for(Index i(0); i < vec_conv.size(); ++i)
+    {
+      Tiny::Vector<DataType_, 2> v;
+      v[0] = DataType_(1) - DataType_(i % 3);
+      v[1] = DataType_(0.5) + DataType_(i % 4);
+      vec_conv(i, v);
+    }
+
+    // blocked matrix
+    BlockMatrixType matrix_b1, matrix_b2;
+    Assembly::SymbolicAssembler::assemble_matrix_std1(matrix_b1, space);
+    matrix_b2 = matrix_b1.clone(LAFEM::CloneMode::Layout);
+    Assembly::ScatterMap<IndexType_> scatter_map_b;
+    Assembly::SymbolicAssembler::assemble_scatter_map_std1(scatter_map_b, matrix_b1, space);
+
+    // scalar matrix
+    ScalarMatrixType matrix_s1, matrix_s2;
+    Assembly::SymbolicAssembler::assemble_matrix_std1(matrix_s1, space);
+    matrix_s2 = matrix_s1.clone(LAFEM::CloneMode::Layout);
+    Assembly::ScatterMap<IndexType_> scatter_map_s;
+    Assembly::SymbolicAssembler::assemble_scatter_map_std1(scatter_map_s, matrix_s1, space);
+
+    // assemble twice to ensure that reassembly into the same structure works
+    for(int k(0); k < 2; ++k)
+    {
+      matrix_b1.format();
+      matrix_b2.format();
+      burgers.assemble_matrix(matrix_b1, vec_conv, space, cubature);
+      burgers.assemble_matrix(matrix_b2, vec_conv, space, cubature, DataType_(1), &scatter_map_b);
+      check_equal(matrix_b1, matrix_b2, eps);
+
+      // the deformation tensor and the Frechet derivative are not available for scalar matrices
+      burgers.deformation = false;
+      burgers.frechet_beta = DataType_(0);
+      matrix_s1.format();
+      matrix_s2.format();
+      burgers.assemble_scalar_matrix(matrix_s1, vec_conv, space, cubature);
+      burgers.assemble_scalar_matrix(matrix_s2, vec_conv, space, cubature, DataType_(1), &scatter_map_s);
+      check_equal(matrix_s1, matrix_s2, eps);
+      burgers.deformation = true;
+      burgers.frechet_beta = DataType_(1);
+    }
+  }
+
+  virtual void run() const override
+  {
+    Geometry::RefineFactory<MeshType, Geometry::UnitCubeFactory> mesh_factory(2);
+    MeshType mesh(mesh_factory);
+    TrafoType trafo(mesh);
+    SpaceVeloType space_v(trafo);
+    SpacePresType space_p(trafo);
+
+    test_std2(space_v, space_p);
+    test_burgers(space_v);
+  }
+};
+
+ScatterMapTest<double, unsigned int> scatter_map_test_double_uint;
+ScatterMapTest<float, unsigned long> scatter_map_test_float_ulong;
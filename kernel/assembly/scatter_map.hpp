@@ -0,0 +1,267 @@
+// FEAT3: Finite Element Analysis Toolbox, Version 3
+// Copyright (C) 2010 - 2020 by Stefan Turek & the FEAT group
+// FEAT3 is released under the GNU General Public License version 3,
+// see the file 'copyright.txt' in the top level directory for details.
+
+#pragma once
+#ifndef KERNEL_ASSEMBLY_SCATTER_MAP_HPP
+#define KERNEL_ASSEMBLY_SCATTER_MAP_HPP 1
+
+// includes, FEAT
+#include <kernel/assembly/base.hpp>
+#include <kernel/util/hash.hpp>
+
+// includes, system
+#include <cstdint>
+#include <vector>
+
+namespace FEAT
+{
+  namespace Assembly
+  {
+    /**
+     * \brief Cell-wise scatter map for numeric matrix reassembly
+     *
+     * This class stores for each cell of the mesh and for each pair of local test- and trial-dofs
+     * the index of the corresponding entry in the value array of a CSR-like sparse matrix, i.e.
+     * the offsets which are otherwise looked up by the ScatterAxpy classes of the matrix containers
+     * for each local row of each cell. Once compiled for a given sparsity pattern, the local
+     * matrices of repeated numeric assemblies can be scattered directly into the value array.
+     *
+     * The map can be compiled for any matrix which offers the \c row_ptr() and \c col_ind()
+     * arrays in main memory, i.e. LAFEM::SparseMatrixCSR and LAFEM::SparseMatrixBCSR; for
+     * meta-matrices like LAFEM::TupleMatrix or LAFEM::SaddlePointMatrix, one map has to be
+     * compiled for each block, since each block has its own sparsity pattern.
+     *
+     * \note
+     * The map stays valid as long as the sparsity pattern of the matrix is not changed;
+     * use SymbolicAssembler::assemble_scatter_map_std1 or SymbolicAssembler::assemble_scatter_map_std2
+     * to create it right after the assembly of the matrix structure.
+     *
+     * \tparam IT_
+     * The index type of the matrix.
+     */
+    template<typename IT_>
+    class ScatterMap
+    {
+    public:
+      /// the index type
+      typedef IT_ IndexType;
+
+    protected:
+      /// number of rows of the matrix
+      Index _num_rows;
+      /// number of columns of the matrix
+      Index _num_cols;
+      /// number of non-zero entries of the matrix
+      Index _used_elements;
+      /// hash of the row pointer and column index arrays of the matrix
+      std::uint64_t _pattern_hash;
+      /// offsets of the cells in the offset array
+      std::vector<Index> _cell_ptr;
+      /// number of local test dofs per cell
+      std::vector<int> _cell_rows;
+      /// number of local trial dofs per cell
+      std::vector<int> _cell_cols;
+      /// value array offsets for all local dof pairs
+      std::vector<IT_> _offsets;
+
+    public:
+      /// default constructor
+      ScatterMap() :
+        _num_rows(0),
+        _num_cols(0),
+        _used_elements(0),
+        _pattern_hash(0)
+      {
+      }
+
+      /// move constructor
+      ScatterMap(ScatterMap&&) = default;
+      /// move-assignment operator
+      ScatterMap& operator=(ScatterMap&&) = default;
+
+      /// virtual destructor
+      virtual ~ScatterMap()
+      {
+      }
+
+      /**
+       * \brief Compiles the scatter map
+       *
+       * \param[in] matrix
+       * The matrix whose sparsity pattern is to be mapped. Its row pattern has to contain all
+       * couplings of the test- and trial-space dofs on each cell.
+       *
+       * \param[in] test_space, trial_space
+       * The test- and trial-spaces that correspond to the rows and columns of the matrix.
+       */
+      template<typename Matrix_, typename TestSpace_, typename TrialSpace_>
+      void compile(const Matrix_& matrix, const TestSpace_& test_space, const TrialSpace_& trial_space)
+      {
+        XASSERTM(matrix.rows() == test_space.get_num_dofs(), "invalid matrix row count");
+        XASSERTM(matrix.columns() == trial_space.get_num_dofs(), "invalid matrix column count");
+
+        const Index num_cells = test_space.get_mesh().get_num_entities(TestSpace_::shape_dim);
+        XASSERTM(num_cells == trial_space.get_mesh().get_num_entities(TrialSpace_::shape_dim), "invalid space pair");
+
+        _num_rows = matrix.rows();
+        _num_cols = matrix.columns();
+        _used_elements = matrix.used_elements();
+        _pattern_hash = _hash_pattern(matrix);
+
+        const IT_* row_ptr = matrix.row_ptr();
+        const IT_* col_idx = matrix.col_ind();
+
+        typename TestSpace_::DofMappingType test_map(test_space);
+        typename TrialSpace_::DofMappingType trial_map(trial_space);
+
+        // count the local dof pairs of all cells
+        _cell_ptr.resize(std::size_t(num_cells) + 1u);
+        _cell_rows.resize(std::size_t(num_cells));
+        _cell_cols.resize(std::size_t(num_cells));
+        _cell_ptr[0] = Index(0);
+        for(Index cell(0); cell < num_cells; ++cell)
+        {
+          test_map.prepare(cell);
+          trial_map.prepare(cell);
+          _cell_rows[cell] = test_map.get_num_local_dofs();
+          _cell_cols[cell] = trial_map.get_num_local_dofs();
+          _cell_ptr[cell+1] = _cell_ptr[cell] + Index(_cell_rows[cell] * _cell_cols[cell]);
+          trial_map.finish();
+          test_map.finish();
+        }
+
+        // column pointer array, initialised to an invalid offset
+        const IT_ deadcode = ~IT_(0);
+        std::vector<IT_> col_ptr(std::size_t(_num_cols), deadcode);
+
+        // compute the offsets
+        _offsets.resize(std::size_t(_cell_ptr.back()));
+        for(Index cell(0); cell < num_cells; ++cell)
+        {
+          test_map.prepare(cell);
+          trial_map.prepare(cell);
+          Index k(_cell_ptr[cell]);
+          for(int i(0); i < _cell_rows[cell]; ++i)
+          {
+            const Index ix = test_map.get_index(i);
+            for(IT_ l(row_ptr[ix]); l < row_ptr[ix + 1]; ++l)
+              col_ptr[col_idx[l]] = l;
+
+            for(int j(0); j < _cell_cols[cell]; ++j, ++k)
+            {
+              const IT_ off = col_ptr[trial_map.get_index(j)];
+              XASSERTM(off != deadcode, "matrix pattern does not contain all local dof couplings");
+              _offsets[k] = off;
+            }
+
+            for(IT_ l(row_ptr[ix]); l < row_ptr[ix + 1]; ++l)
+              col_ptr[col_idx[l]] = deadcode;
+          }
+          trial_map.finish();
+          test_map.finish();
+        }
+      }
+
+      /// Releases all data of the map.
+      void clear()
+      {
+        _num_rows = _num_cols = _used_elements = Index(0);
+        _pattern_hash = std::uint64_t(0);
+        _cell_ptr.clear();
+        _cell_rows.clear();
+        _cell_cols.clear();
+        _offsets.clear();
+      }
+
+      /// \returns \c true, if the map is empty, otherwise \c false.
+      bool empty() const
+      {
+        return _cell_ptr.empty();
+      }
+
+      /// \returns The number of cells in the map.
+      Index get_num_cells() const
+      {
+        return _cell_ptr.empty() ? Index(0) : Index(_cell_ptr.size() - 1u);
+      }
+
+      /// \returns The size of dynamically allocated memory in bytes.
+      std::size_t bytes() const
+      {
+        return _cell_ptr.size() * sizeof(Index) + (_cell_rows.size() + _cell_cols.size()) * sizeof(int) +
+          _offsets.size() * sizeof(IT_);
+      }
+
+      /**
+       * \brief Checks whether the map fits to a matrix
+       *
+       * \param[in] matrix
+       * The matrix to be checked.
+       *
+       * \returns
+       * \c true, if the dimensions, the number of non-zero entries and the hash of the sparsity
+       * pattern of the matrix coincide with the matrix that was used for the compilation of this
+       * map, otherwise \c false.
+       *
+       * \note
+       * The pattern hash is only computed if all other checks succeed; its effort is linear in
+       * the number of non-zero entries and thus small compared to a numeric assembly.
+       */
+      template<typename Matrix_>
+      bool is_compatible(const Matrix_& matrix) const
+      {
+        return !empty() && (matrix.rows() == _num_rows) && (matrix.columns() == _num_cols) &&
+          (matrix.used_elements() == _used_elements) && (_hash_pattern(matrix) == _pattern_hash);
+      }
+
+      /**
+       * \brief Scatters a local matrix into a matrix value array
+       *
+       * \param[in,out] data
+       * The value array of the matrix, i.e. the return value of its \c val() function.
+       *
+       * \param[in] loc_mat
+       * The local matrix that is to be scattered.
+       *
+       * \param[in] cell
+       * The index of the cell that the local matrix belongs to.
+       *
+       * \param[in] alpha
+       * The scaling factor for the local matrix.
+       */
+      template<typename Value_, typename LocalMatrix_, typename DT_>
+      void scatter_axpy(Value_* data, const LocalMatrix_& loc_mat, const Index cell, const DT_ alpha) const
+      {
+        ASSERTM(cell < get_num_cells(), "invalid cell index");
+        const IT_* off = &_offsets[_cell_ptr[cell]];
+        const int nr = _cell_rows[cell];
+        const int nc = _cell_cols[cell];
+        for(int i(0); i < nr; ++i)
+        {
+          for(int j(0); j < nc; ++j, ++off)
+          {
+            data[*off] += alpha * loc_mat[i][j];
+          }
+        }
+      }
+
+    protected:
+      /// computes the 64 bit FNV-1a hash of the row pointer and column index arrays of a matrix
+      template<typename Matrix_>
+      static std::uint64_t _hash_pattern(const Matrix_& matrix)
+      {
+        HashFNV1a hash;
+        if(matrix.used_elements() > Index(0))
+        {
+          hash.feed(matrix.row_ptr(), sizeof(IT_) * std::size_t(matrix.rows() + Index(1)));
+          hash.feed(matrix.col_ind(), sizeof(IT_) * std::size_t(matrix.used_elements()));
+        }
+        return hash.value();
+      }
+    }; // class ScatterMap<...>
+  } // namespace Assembly
+} // namespace FEAT
+
+#endif // KERNEL_ASSEMBLY_SCATTER_MAP_HPP
@@ -17,6 +17,9 @@
 #include <kernel/space/lagrange1/element.hpp>
 #include <kernel/space/lagrange2/element.hpp>
 
+// includes, system
+#include <vector>
+
 namespace FEAT
 {
   namespace Assembly
@@ -27,6 +30,71 @@ namespace FEAT
     {
       template<typename Space_, int shape_dim_ = Space_::shape_dim>
       class Lagrange2InterpolatorWrapper;
+
+      /**
+       * \brief Scatters a sparse blocked vector into a dense value array
+       *
+       * All entries of the sparse vector are copied into the value array and marked in the mask array,
+       * so that the vector can be modified by random access without searching its index array.
+       */
+      template<typename Vector_>
+      void slip_asm_densify(std::vector<typename Vector_::ValueType>& val, std::vector<char>& mask, const Vector_& vec)
+      {
+        typedef typename Vector_::DataType DataType;
+        typedef typename Vector_::ValueType ValueType;
+
+        val.assign(std::size_t(vec.size()), ValueType(DataType(0)));
+        mask.assign(std::size_t(vec.size()), char(0));
+
+        const Index num_used = vec.used_elements();
+        if(num_used == Index(0))
+          return;
+
+        const auto* idx = vec.indices();
+        const auto* elem = vec.elements();
+        for(Index i(0); i < num_used; ++i)
+        {
+          val[idx[i]] = elem[i];
+          mask[idx[i]] = char(1);
+        }
+      }
+
+      /**
+       * \brief Rebuilds a sparse blocked vector from a dense value array
+       *
+       * The sparse vector is replaced by a vector containing all marked entries of the value array,
+       * which are added in ascending order, so that the new vector is sorted right away.
+       */
+      template<typename Vector_>
+      void slip_asm_build(Vector_& vec, const std::vector<typename Vector_::ValueType>& val, const std::vector<char>& mask)
+      {
+        typedef typename Vector_::MemType MemType;
+        typedef typename Vector_::DataType DataType;
+        typedef typename Vector_::IndexType IndexType;
+        static_assert(std::is_same<MemType, Mem::Main>::value, "slip filter assembly requires main memory");
+        static constexpr int block_size = Vector_::BlockSize;
+
+        Index num_used(0);
+        for(std::size_t i(0); i < mask.size(); ++i)
+          num_used += Index(mask[i]);
+        if(num_used == Index(0))
+          return;
+
+        LAFEM::DenseVectorBlocked<MemType, DataType, IndexType, block_size> vec_val(num_used);
+        LAFEM::DenseVector<MemType, IndexType, IndexType> vec_idx(num_used);
+        auto* elem = vec_val.elements();
+        IndexType* idx = vec_idx.elements();
+        for(std::size_t i(0), k(0); i < mask.size(); ++i)
+        {
+          if(mask[i] != char(0))
+          {
+            idx[k] = IndexType(i);
+            elem[k] = val[i];
+            ++k;
+          }
+        }
+        vec = Vector_(vec.size(), vec_val, vec_idx);
+      }
     }
     /// \endcond
 
@@ -192,8 +260,12 @@ namespace FEAT
             nu.format(DataType(0));
             // Vertex at facet index set from the parent
             auto& idx(trafo.get_mesh().template get_index_set<facet_dim,0>());
-            // Temporary vector for holding one normal at a time
-            Tiny::Vector<DataType, world_dim> tmp(DataType(0));
+
+            // Accumulate the normals in a dense array, because every random access to the sparse vector
+            // has to search its index array
+            std::vector<typename VectorType_::ValueType> nu_val;
+            std::vector<char> nu_mask;
+            Intern::slip_asm_densify(nu_val, nu_mask, nu);
 
             // For every cell in the meshpart, compute the outer normal vectors in all local Lagrange points of the
             // element's transformation
@@ -209,12 +281,15 @@ namespace FEAT
                 // Add the local contributions to the vector that is numbered according to the parent
                 for(int l(0); l < nvt_loc; ++l)
                 {
-                  tmp = nu(idx[k][l]) + nu_loc[l]*DataType(orientation[k]*vol);
-                  nu(idx[k][l],  tmp);
+                  nu_val[idx[k][l]] += nu_loc[l]*DataType(orientation[k]*vol);
+                  nu_mask[idx[k][l]] = char(1);
                 }
               }
             }
 
+            // Write the accumulated normals back in ascending order
+            Intern::slip_asm_build(nu, nu_val, nu_mask);
+
             //// Normalize nu
             //for(Index i(0); i < nu.used_elements(); ++i)
             //{
@@ -486,8 +561,16 @@ namespace FEAT
           // We only have something to do if the filter is not empty after recompute_target_set_holder()
           if(buffer.get_nu().used_elements() > Index(0))
           {
-            Intern::Lagrange2InterpolatorWrapper<SpaceType>::project(
-              buffer.get_filter_vector(), buffer.get_nu(), space, _target_set_holder);
+            // Project on dense arrays to avoid random access to the sparse vectors
+            typedef typename LAFEM::SlipFilter<Mem::Main, DataType_, IndexType_, world_dim>::ValueType ValueType;
+            std::vector<ValueType> nu_val, sv_val;
+            std::vector<char> nu_mask, sv_mask;
+            Intern::slip_asm_densify(nu_val, nu_mask, buffer.get_nu());
+            Intern::slip_asm_densify(sv_val, sv_mask, buffer.get_filter_vector());
+
+            Intern::Lagrange2InterpolatorWrapper<SpaceType>::project(sv_val, sv_mask, nu_val, space, _target_set_holder);
+
+            Intern::slip_asm_build(buffer.get_filter_vector(), sv_val, sv_mask);
           }
           // Upload assembled result
           filter.convert(buffer);
@@ -506,15 +589,16 @@ namespace FEAT
        * functionals (which are point evaluations) to Q1~ functions (which are not continuous). In the case of
        * conforming Lagrange elements, it is well-defined however, and implemented below.
        */
-      template<typename Vector_, typename Space_, int shape_dim_>
+      template<typename Value_, typename Space_, int shape_dim_>
       struct Lagrange2InterpolatorCore
       {
         public:
           template< typename TSH_>
-          static void project(Vector_& lagrange_2_vector, const Vector_& lagrange_1_vector, const Space_& space, const TSH_* tsh)
+          static void project(std::vector<Value_>& lagrange_2_vector, std::vector<char>& lagrange_2_mask,
+            const std::vector<Value_>& lagrange_1_vector, const Space_& space, const TSH_* tsh)
           {
-            typedef typename Vector_::DataType DataType;
-            typedef typename Vector_::ValueType ValueType;
+            typedef typename Value_::DataType DataType;
+            typedef Value_ ValueType;
 
             // define dof assignment
             typedef typename Space_::template DofAssignment<shape_dim_, DataType>::Type DofAssignType;
@@ -537,7 +621,7 @@ namespace FEAT
 
                 // evaluate the "node functional"
                 for(int j(0); j < idx.get_num_indices(); ++j)
-                  tmp += lagrange_1_vector(idx(shape, j));
+                  tmp += lagrange_1_vector[idx(shape, j)];
 
                 tmp *= DataType(1)/DataType(idx.get_num_indices());
                 tmp.normalise();
@@ -547,7 +631,8 @@ namespace FEAT
 
                 // loop over all contributions
                 Index dof_index(dof_assign.get_index(0));
-                lagrange_2_vector(dof_index, tmp);
+                lagrange_2_vector[dof_index] = tmp;
+                lagrange_2_mask[dof_index] = char(1);
 
                 // finish
                 dof_assign.finish();
@@ -566,7 +651,7 @@ namespace FEAT
 
                 // evaluate the "node functional"
                 for(int j(0); j < idx.get_num_indices(); ++j)
-                  tmp += lagrange_1_vector(idx(ts[shape], j));
+                  tmp += lagrange_1_vector[idx(ts[shape], j)];
 
                 tmp *= DataType(1)/DataType(idx.get_num_indices());
                 tmp.normalise();
@@ -576,7 +661,8 @@ namespace FEAT
 
                 // loop over all contributions
                 Index dof_index(dof_assign.get_index(0));
-                lagrange_2_vector(dof_index, tmp);
+                lagrange_2_vector[dof_index] = tmp;
+                lagrange_2_mask[dof_index] = char(1);
 
                 // finish
                 dof_assign.finish();
@@ -585,15 +671,16 @@ namespace FEAT
           }
       };
 
-      template<typename Vector_, typename Space_>
-      struct Lagrange2InterpolatorCore<Vector_, Space_, 0>
+      template<typename Value_, typename Space_>
+      struct Lagrange2InterpolatorCore<Value_, Space_, 0>
       {
         public:
           template<typename TSH_>
-          static void project(Vector_& lagrange_2_vector, const Vector_& lagrange_1_vector, const Space_& space, const TSH_* tsh)
+          static void project(std::vector<Value_>& lagrange_2_vector, std::vector<char>& lagrange_2_mask,
+            const std::vector<Value_>& lagrange_1_vector, const Space_& space, const TSH_* tsh)
           {
-            typedef typename Vector_::DataType DataType;
-            typedef typename Vector_::ValueType ValueType;
+            typedef typename Value_::DataType DataType;
+            typedef Value_ ValueType;
 
             // define dof assignment
             typedef typename Space_::template DofAssignment<0, DataType>::Type DofAssignType;
@@ -612,8 +699,9 @@ namespace FEAT
                 Index dof_index(dof_assign.get_index(0));
 
                 // evaluate the "node functional"
-                ValueType tmp(lagrange_1_vector(vert));
-                lagrange_2_vector(dof_index, tmp);
+                ValueType tmp(lagrange_1_vector[vert]);
+                lagrange_2_vector[dof_index] = tmp;
+                lagrange_2_mask[dof_index] = char(1);
 
                 // finish
                 dof_assign.finish();
@@ -633,8 +721,9 @@ namespace FEAT
                 Index dof_index(dof_assign.get_index(0));
 
                 // evaluate the "node functional"
-                ValueType tmp(lagrange_1_vector(ts[vert]));
-                lagrange_2_vector(dof_index, tmp);
+                ValueType tmp(lagrange_1_vector[ts[vert]]);
+                lagrange_2_vector[dof_index] = tmp;
+                lagrange_2_mask[dof_index] = char(1);
 
                 // finish
                 dof_assign.finish();
@@ -647,14 +736,17 @@ namespace FEAT
       class Lagrange2InterpolatorWrapper
       {
         public:
-          template<typename Vector_, typename TSH_>
-          static void project(Vector_& lagrange_2_vector, const Vector_& lagrange_1_vector, const Space_& space, const TSH_* tsh)
+          template<typename Value_, typename TSH_>
+          static void project(std::vector<Value_>& lagrange_2_vector, std::vector<char>& lagrange_2_mask,
+            const std::vector<Value_>& lagrange_1_vector, const Space_& space, const TSH_* tsh)
           {
             // recurse down
-            Lagrange2InterpolatorWrapper<Space_, shape_dim_ - 1>::project(lagrange_2_vector, lagrange_1_vector, space, tsh);
+            Lagrange2InterpolatorWrapper<Space_, shape_dim_ - 1>::project(
+              lagrange_2_vector, lagrange_2_mask, lagrange_1_vector, space, tsh);
 
             // call interpolator core
-            Lagrange2InterpolatorCore<Vector_, Space_, shape_dim_>::project(lagrange_2_vector, lagrange_1_vector, space, tsh);
+            Lagrange2InterpolatorCore<Value_, Space_, shape_dim_>::project(
+              lagrange_2_vector, lagrange_2_mask, lagrange_1_vector, space, tsh);
           }
       };
 
@@ -662,11 +754,13 @@ namespace FEAT
       class Lagrange2InterpolatorWrapper<Space_, 0>
       {
         public:
-          template<typename Vector_, typename TSH_>
-          static void project(Vector_& lagrange_2_vector, const Vector_& lagrange_1_vector, const Space_& space, const TSH_* tsh)
+          template<typename Value_, typename TSH_>
+          static void project(std::vector<Value_>& lagrange_2_vector, std::vector<char>& lagrange_2_mask,
+            const std::vector<Value_>& lagrange_1_vector, const Space_& space, const TSH_* tsh)
           {
             // call interpolator core
-            Lagrange2InterpolatorCore<Vector_, Space_, 0>::project(lagrange_2_vector, lagrange_1_vector, space, tsh);
+            Lagrange2InterpolatorCore<Value_, Space_, 0>::project(
+              lagrange_2_vector, lagrange_2_mask, lagrange_1_vector, space, tsh);
           }
       };
 
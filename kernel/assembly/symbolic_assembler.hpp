@@ -11,6 +11,8 @@
 #include <kernel/adjacency/graph.hpp>
 #include <kernel/space/dof_mapping_renderer.hpp>
 #include <kernel/lafem/null_matrix.hpp>
+#include <kernel/assembly/scatter_map.hpp>
+#include <kernel/util/region_timer.hpp>
 #include <kernel/geometry/intern/coarse_fine_cell_mapping.hpp>
 
 namespace FEAT
@@ -352,6 +354,7 @@ namespace FEAT
       static void assemble_matrix_std2(MatrixType_ & matrix,
         const TestSpace_& test_space, const TrialSpace_& trial_space)
       {
+        RegionTimer::Scope region("asm-symbolic");
         matrix = MatrixType_(assemble_graph_std2(test_space, trial_space));
       }
 
@@ -377,6 +380,7 @@ namespace FEAT
       template<typename MatrixType_, typename Space_>
       static void assemble_matrix_std1(MatrixType_ & matrix, const Space_& space)
       {
+        RegionTimer::Scope region("asm-symbolic");
         matrix = MatrixType_(assemble_graph_std1(space));
       }
 
@@ -389,6 +393,45 @@ namespace FEAT
         matrix.resize(space.get_num_dofs(), space.get_num_dofs());
       }
 
+      /**
+       * \brief Assembles a scatter map for a standard matrix structure from a test-trial-space pair.
+       *
+       * \param[out] scatter_map
+       * A reference to the scatter map to be assembled.
+       *
+       * \param[in] matrix
+       * The matrix whose structure has been assembled by assemble_matrix_std2.
+       *
+       * \param[in] test_space, trial_space
+       * The test- and trial-spaces to be used for the assembly.
+       */
+      template<typename IT_, typename MatrixType_, typename TestSpace_, typename TrialSpace_>
+      static void assemble_scatter_map_std2(ScatterMap<IT_>& scatter_map, const MatrixType_& matrix,
+                                            const TestSpace_& test_space, const TrialSpace_& trial_space)
+      {
+        RegionTimer::Scope region("asm-scatter-map");
+        scatter_map.compile(matrix, test_space, trial_space);
+      }
+
+      /**
+       * \brief Assembles a scatter map for a standard matrix structure from a single space.
+       *
+       * \param[out] scatter_map
+       * A reference to the scatter map to be assembled.
+       *
+       * \param[in] matrix
+       * The matrix whose structure has been assembled by assemble_matrix_std1.
+       *
+       * \param[in] space
+       * The space to be used for the assembly.
+       */
+      template<typename IT_, typename MatrixType_, typename Space_>
+      static void assemble_scatter_map_std1(ScatterMap<IT_>& scatter_map, const MatrixType_& matrix, const Space_& space)
+      {
+        RegionTimer::Scope region("asm-scatter-map");
+        scatter_map.compile(matrix, space, space);
+      }
+
       /**
        * \brief Assembles an extended-facet matrix structure from a test-trial-space pair.
        *
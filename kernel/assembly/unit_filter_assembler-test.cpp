@@ -0,0 +1,141 @@
+// FEAT3: Finite Element Analysis Toolbox, Version 3
+// Copyright (C) 2010 - 2020 by Stefan Turek & the FEAT group
+// FEAT3 is released under the GNU General Public License version 3,
+// see the file 'copyright.txt' in the top level directory for details.
+
+#include <test_system/test_system.hpp>
+#include <kernel/geometry/common_factories.hpp>
+#include <kernel/geometry/boundary_factory.hpp>
+#include <kernel/trafo/standard/mapping.hpp>
+#include <kernel/space/lagrange2/element.hpp>
+#include <kernel/analytic/expression_function.hpp>
+#include <kernel/assembly/interpolator.hpp>
+#include <kernel/assembly/unit_filter_assembler.hpp>
+
+using namespace FEAT;
+using namespace FEAT::TestSystem;
+
+/**
+ * \brief Test class for the UnitFilterAssembler class template.
+ *
+ * \test Tests the assembly of scalar and blocked unit filters from several overlapping mesh-parts
+ * as well as the assembly into already existing filters.
+ *
+ * \tparam DataType_
+ * The data type for the test. Shall be either double or float.
+ *
+ * \tparam IndexType_
+ * The index type for the test.
+ */
+template<typename DataType_, typename IndexType_>
+class UnitFilterAssemblerTest :
+  public TestSystem::FullTaggedTest<Mem::Main, DataType_, IndexType_>
+{
+  typedef Geometry::ConformalMesh<Shape::Quadrilateral> MeshType;
+  typedef Geometry::MeshPart<MeshType> MeshPartType;
+  typedef Trafo::Standard::Mapping<MeshType> TrafoType;
+  typedef Space::Lagrange2::Element<TrafoType> SpaceType;
+
+  typedef LAFEM::DenseVector<Mem::Main, DataType_, IndexType_> VectorType;
+  typedef LAFEM::DenseVectorBlocked<Mem::Main, DataType_, IndexType_, 2> BlockedVectorType;
+  typedef LAFEM::UnitFilter<Mem::Main, DataType_, IndexType_> FilterType;
+  typedef LAFEM::UnitFilterBlocked<Mem::Main, DataType_, IndexType_, 2> BlockedFilterType;
+
+public:
+  UnitFilterAssemblerTest() :
+    TestSystem::FullTaggedTest<Mem::Main, DataType_, IndexType_>("UnitFilterAssemblerTest")
+  {
+  }
+
+  virtual ~UnitFilterAssemblerTest()
+  {
+  }
+
+  /// checks that the filter indices are strictly ascending
+  template<typename Filter_>
+  void check_sorted(const Filter_& filter) const
+  {
+    const IndexType_* idx = filter.get_indices();
+    for(Index i(1); i < filter.used_elements(); ++i)
+      TEST_CHECK(idx[i-1] < idx[i]);
+  }
+
+  virtual void run() const override
+  {
+    const DataType_ eps = Math::pow(Math::eps<DataType_>(), DataType_(0.8));
+
+    // 4x4 quadrilateral mesh; the boundary contains 16 vertices and 16 edges
+    Geometry::RefineFactory<MeshType, Geometry::UnitCubeFactory> mesh_factory(2);
+    MeshType mesh(mesh_factory);
+    TrafoType trafo(mesh);
+    SpaceType space(trafo);
+
+    Geometry::BoundaryFactory<MeshType> boundary_factory(mesh);
+    MeshPartType boundary(boundary_factory);
+
+    // add the boundary twice; the dofs must still be contained only once
+    Assembly::UnitFilterAssembler<MeshType> unit_asm;
+    unit_asm.add_mesh_part(boundary);
+    unit_asm.add_mesh_part(boundary);
+
+    // homogeneous filter
+    FilterType filter;
+    unit_asm.assemble(filter, space);
+    TEST_CHECK_EQUAL(filter.used_elements(), Index(32));
+    check_sorted(filter);
+    for(Index i(0); i < filter.used_elements(); ++i)
+      TEST_CHECK_EQUAL(filter.get_values()[i], DataType_(0));
+
+    // function-based filter assembled into the existing homogeneous filter
+    Analytic::ExpressionFunction<2> function("1 + x + 2*y^2");
+    unit_asm.assemble(filter, space, function);
+    TEST_CHECK_EQUAL(filter.used_elements(), Index(32));
+    check_sorted(filter);
+
+    // the filter values must coincide with the interpolated function
+    VectorType vector(space.get_num_dofs());
+    Assembly::Interpolator::project(vector, function, space);
+    for(Index i(0); i < filter.used_elements(); ++i)
+    {
+      const Index k = Index(filter.get_indices()[i]);
+      TEST_CHECK_EQUAL_WITHIN_EPS(filter.get_values()[i], vector(k), eps);
+    }
+
+    // vector-based filter
+    FilterType filter_vec;
+    unit_asm.assemble(filter_vec, space, vector);
+    TEST_CHECK_EQUAL(filter_vec.used_elements(), Index(32));
+    for(Index i(0); i < filter.used_elements(); ++i)
+    {
+      TEST_CHECK_EQUAL(filter_vec.get_indices()[i], filter.get_indices()[i]);
+      TEST_CHECK_EQUAL(filter_vec.get_values()[i], filter.get_values()[i]);
+    }
+
+    // blocked filters
+    BlockedVectorType vector_b(space.get_num_dofs());
+    for(Index i(0); i < vector_b.size(); ++i)
+    {
+      Tiny::Vector<DataType_, 2> v;
+      v[0] = DataType_(i);
+      v[1] = -DataType_(i);
+      vector_b(i, v);
+    }
+
+    BlockedFilterType filter_b;
+    unit_asm.assemble(filter_b, space);
+    TEST_CHECK_EQUAL(filter_b.used_elements(), Index(32));
+    check_sorted(filter_b);
+    unit_asm.assemble(filter_b, space, vector_b);
+    TEST_CHECK_EQUAL(filter_b.used_elements(), Index(32));
+    check_sorted(filter_b);
+    for(Index i(0); i < filter_b.used_elements(); ++i)
+    {
+      const Index k = Index(filter_b.get_indices()[i]);
+      TEST_CHECK_EQUAL(filter_b.get_values()[i][0], DataType_(k));
+      TEST_CHECK_EQUAL(filter_b.get_values()[i][1], -DataType_(k));
+    }
+  }
+};
+
+UnitFilterAssemblerTest<double, unsigned int> unit_filter_assembler_test_double_uint;
+UnitFilterAssemblerTest<float, unsigned long> unit_filter_assembler_test_float_ulong;
@@ -14,10 +14,13 @@
 #include <kernel/lafem/unit_filter_blocked.hpp>
 #include <kernel/lafem/dense_vector.hpp>
 #include <kernel/geometry/mesh_part.hpp>
+#include <kernel/space/dof_table.hpp>
 
 // includes, system
-#include <set>
-#include <map>
+#include <algorithm>
+#include <typeindex>
+#include <typeinfo>
+#include <utility>
 #include <vector>
 
 namespace FEAT
@@ -30,6 +33,101 @@ namespace FEAT
       // forward declarations
       template<int shape_dim_>
       struct UnitAsmWrapper;
+
+      /// sorts a dof-index vector and removes all duplicates
+      inline void unit_asm_sort_unique(std::vector<Index>& idx)
+      {
+        std::sort(idx.begin(), idx.end());
+        idx.erase(std::unique(idx.begin(), idx.end()), idx.end());
+      }
+
+      /// sorts a dof-index/value vector by its indices and keeps only the first value of each index
+      template<typename Value_>
+      void unit_asm_sort_unique(std::vector<std::pair<Index, Value_>>& idx)
+      {
+        std::stable_sort(idx.begin(), idx.end(),
+          [](const std::pair<Index, Value_>& a, const std::pair<Index, Value_>& b) {return a.first < b.first;});
+        idx.erase(std::unique(idx.begin(), idx.end(),
+          [](const std::pair<Index, Value_>& a, const std::pair<Index, Value_>& b) {return a.first == b.first;}),
+          idx.end());
+      }
+
+      /**
+       * \brief Merges the sorted entries of an existing filter into a sorted dof-index/value vector
+       *
+       * If an index is contained in both sets, the value of the new entry is kept, as this is what
+       * adding the new entries to the existing filter one by one would have done.
+       */
+      template<typename IT_, typename Value_>
+      void unit_asm_merge(std::vector<std::pair<Index, Value_>>& entries, const Index num_old,
+        const IT_* old_idx, const Value_* old_val)
+      {
+        std::vector<std::pair<Index, Value_>> merged;
+        merged.reserve(entries.size() + std::size_t(num_old));
+
+        std::size_t i(0);
+        Index j(0);
+        while((i < entries.size()) || (j < num_old))
+        {
+          if((j >= num_old) || ((i < entries.size()) && (entries[i].first <= Index(old_idx[j]))))
+          {
+            if((j < num_old) && (entries[i].first == Index(old_idx[j])))
+              ++j;
+            merged.push_back(entries[i++]);
+          }
+          else
+          {
+            merged.push_back(std::make_pair(Index(old_idx[j]), old_val[j]));
+            ++j;
+          }
+        }
+        entries = std::move(merged);
+      }
+
+      /// builds a unit-filter from a sorted dof-index/value vector and the existing filter entries
+      template<typename DT_, typename IT_>
+      void unit_asm_build(LAFEM::UnitFilter<Mem::Main, DT_, IT_>& filter, std::vector<std::pair<Index, DT_>>& entries)
+      {
+        if(filter.used_elements() > Index(0))
+          unit_asm_merge(entries, filter.used_elements(), filter.get_indices(), filter.get_values());
+        if(entries.empty())
+          return;
+
+        const Index n = Index(entries.size());
+        LAFEM::DenseVector<Mem::Main, DT_, IT_> vec_val(n);
+        LAFEM::DenseVector<Mem::Main, IT_, IT_> vec_idx(n);
+        DT_* val = vec_val.elements();
+        IT_* idx = vec_idx.elements();
+        for(Index i(0); i < n; ++i)
+        {
+          idx[i] = IT_(entries[i].first);
+          val[i] = entries[i].second;
+        }
+        filter = LAFEM::UnitFilter<Mem::Main, DT_, IT_>(filter.size(), vec_val, vec_idx);
+      }
+
+      /// builds a blocked unit-filter from a sorted dof-index/value vector and the existing filter entries
+      template<typename DT_, typename IT_, int BlockSize_>
+      void unit_asm_build(LAFEM::UnitFilterBlocked<Mem::Main, DT_, IT_, BlockSize_>& filter,
+        std::vector<std::pair<Index, Tiny::Vector<DT_, BlockSize_>>>& entries)
+      {
+        if(filter.used_elements() > Index(0))
+          unit_asm_merge(entries, filter.used_elements(), filter.get_indices(), filter.get_values());
+        if(entries.empty())
+          return;
+
+        const Index n = Index(entries.size());
+        LAFEM::DenseVectorBlocked<Mem::Main, DT_, IT_, BlockSize_> vec_val(n);
+        LAFEM::DenseVector<Mem::Main, IT_, IT_> vec_idx(n);
+        Tiny::Vector<DT_, BlockSize_>* val = vec_val.elements();
+        IT_* idx = vec_idx.elements();
+        for(Index i(0); i < n; ++i)
+        {
+          idx[i] = IT_(entries[i].first);
+          val[i] = entries[i].second;
+        }
+        filter = LAFEM::UnitFilterBlocked<Mem::Main, DT_, IT_, BlockSize_>(filter.size(), vec_val, vec_idx);
+      }
     } // namespace Intern
     /// \endcond
 
@@ -39,6 +137,15 @@ namespace FEAT
      * \tparam Mesh_
      * The type of the mesh on which the unit filter is to be assembled.
      *
+     * \note
+     * The sorted dof-index vector of each space, for which a filter has been assembled, is cached
+     * by the assembler, so that repeated assemblies on the same space, e.g. on each time step or
+     * after a change of the boundary values, do not need to collect and sort the dofs again. A
+     * cache entry is identified by the type and the address of the space and its mesh and it is
+     * rebuilt if the number of dofs or the topology version of the mesh has changed; adding another
+     * mesh-part clears the cache. If a space is destroyed and another one is created at the same
+     * address, the cache has to be cleared by calling #clear_dof_cache().
+     *
      * \author Peter Zajac
      */
     template<typename Mesh_>
@@ -52,11 +159,66 @@ namespace FEAT
       /// shape dimension
       static constexpr int shape_dim = MeshType::shape_dim;
 
-      /// dof-index set typedef
-      typedef std::set<Index> IdxSet;
+      /// dof-index vector typedef
+      typedef std::vector<Index> IdxVector;
+
+      /// sorted mesh entity index vectors for each shape dimension
+      IdxVector _cells[shape_dim + 1];
 
-      /// dof-index set
-      IdxSet _cells[shape_dim + 1];
+      /// cached sorted dof-index vector of a space
+      struct DofCacheEntry
+      {
+        /// the type of the space
+        std::type_index type;
+        /// the address of the space
+        const void* space;
+        /// the address of the mesh of the space
+        const void* mesh;
+        /// the number of dofs of the space
+        Index num_dofs;
+        /// the topology version of the mesh of the space
+        Index topology_version;
+        /// the sorted dof indices
+        IdxVector dofs;
+      };
+
+      /// the dof-index vectors of all spaces that filters have been assembled for
+      mutable std::vector<DofCacheEntry> _dof_cache;
+
+      /**
+       * \brief Returns the sorted dof-index vector of a space
+       *
+       * The vector is built on the first call for a space and taken from the cache afterwards.
+       */
+      template<typename Space_>
+      const IdxVector& _get_dofs(const Space_& space) const
+      {
+        const Index num_dofs = space.get_num_dofs();
+        const Index version = Space::Intern::mesh_topology_version(space.get_mesh(), 0);
+        const std::type_index type(typeid(Space_));
+        for(auto& entry : _dof_cache)
+        {
+          if((entry.type != type) || (entry.space != static_cast<const void*>(&space)) ||
+            (entry.mesh != static_cast<const void*>(&space.get_mesh())))
+            continue;
+          if((entry.num_dofs != num_dofs) || (entry.topology_version != version))
+          {
+            entry.dofs.clear();
+            Intern::UnitAsmWrapper<shape_dim>::assemble(entry.dofs, space, _cells);
+            Intern::unit_asm_sort_unique(entry.dofs);
+            entry.num_dofs = num_dofs;
+            entry.topology_version = version;
+          }
+          return entry.dofs;
+        }
+
+        DofCacheEntry entry{type, static_cast<const void*>(&space), static_cast<const void*>(&space.get_mesh()),
+          num_dofs, version, IdxVector()};
+        Intern::UnitAsmWrapper<shape_dim>::assemble(entry.dofs, space, _cells);
+        Intern::unit_asm_sort_unique(entry.dofs);
+        _dof_cache.push_back(std::move(entry));
+        return _dof_cache.back().dofs;
+      }
 
     public:
       /**
@@ -74,12 +236,22 @@ namespace FEAT
       /**
        * \brief Adds the dofs on a mesh-part to the dof-set.
        *
+       * The entity indices of the mesh-part are merged into the sorted entity index vectors of
+       * this assembler, so that the dofs of all mesh-parts are collected only once per assembly.
+       *
        * \param[in] mesh_part
        * A reference to a mesh part object.
        */
       void add_mesh_part(const Geometry::MeshPart<MeshType>& mesh_part)
       {
         Intern::UnitAsmWrapper<shape_dim>::merge(_cells, mesh_part);
+        _dof_cache.clear();
+      }
+
+      /// Clears the cached dof-index vectors of all spaces.
+      void clear_dof_cache()
+      {
+        _dof_cache.clear();
       }
 
       /**
@@ -100,9 +272,8 @@ namespace FEAT
       template<typename MemType_, typename DataType_, typename IndexType_, typename Space_>
       void assemble(LAFEM::UnitFilter<MemType_, DataType_, IndexType_>& filter, const Space_& space) const
       {
-        // build index set
-        std::set<Index> idx_set;
-        Intern::UnitAsmWrapper<shape_dim>::assemble(idx_set, space, _cells);
+        // get the (cached) sorted index vector
+        const IdxVector& idx_vec = _get_dofs(space);
 
         // allocate filter if necessary
         if(filter.size() == Index(0))
@@ -114,14 +285,14 @@ namespace FEAT
         LAFEM::UnitFilter<Mem::Main, DataType_, IndexType_> buffer;
         buffer.convert(filter);
 
-        // loop over all dof-indices
-        typename std::set<Index>::const_iterator it(idx_set.begin());
-        typename std::set<Index>::const_iterator jt(idx_set.end());
-        for(Index i(0); it != jt; ++it, ++i)
-        {
-          // store the dof-index
-          buffer.add(IndexType_(*it), DataType_(0));
-        }
+        // build the index-value vector
+        std::vector<std::pair<Index, DataType_>> entries;
+        entries.reserve(idx_vec.size());
+        for(const Index i : idx_vec)
+          entries.push_back(std::make_pair(i, DataType_(0)));
+
+        // merge with existing entries
+        Intern::unit_asm_build(buffer, entries);
 
         // Upload assembled result to the filter
         filter.convert(buffer);
@@ -151,9 +322,8 @@ namespace FEAT
         const Space_& space,
         const LAFEM::DenseVector<MemType_, DataType_, IndexType_>& vector_) const
       {
-        // build index set
-        std::set<Index> idx_set;
-        Intern::UnitAsmWrapper<shape_dim>::assemble(idx_set, space, _cells);
+        // get the (cached) sorted index vector
+        const IdxVector& idx_vec = _get_dofs(space);
 
         // allocate filter if necessary
         if(filter.size() == Index(0))
@@ -165,14 +335,19 @@ namespace FEAT
         LAFEM::UnitFilter<Mem::Main, DataType_, IndexType_> buffer;
         buffer.convert(filter);
 
-        // loop over all dof-indices
-        typename std::set<Index>::const_iterator it(idx_set.begin());
-        typename std::set<Index>::const_iterator jt(idx_set.end());
-        for(Index i(0); it != jt; ++it, ++i)
-        {
-          // store the dof-index
-          buffer.add(IndexType_(*it), vector_(IndexType_(*it)));
-        }
+        // Create buffer vector to avoid the ()-operator on the vector_ memory
+        LAFEM::DenseVector<Mem::Main, DataType_, IndexType_> vec_buf;
+        vec_buf.convert(vector_);
+        const DataType_* vals = vec_buf.elements();
+
+        // build the index-value vector
+        std::vector<std::pair<Index, DataType_>> entries;
+        entries.reserve(idx_vec.size());
+        for(const Index i : idx_vec)
+          entries.push_back(std::make_pair(i, vals[i]));
+
+        // merge with existing entries
+        Intern::unit_asm_build(buffer, entries);
 
         // Upload assembled result to the filter
         filter.convert(buffer);
@@ -212,9 +387,10 @@ namespace FEAT
         typedef typename Function_::ImageType FuncImageType;
         static_assert(FuncImageType::is_scalar, "only scalar functions are supported");
 
-        // build index-value map
-        std::map<Index, DataType_> idx_map;
-        Intern::UnitAsmWrapper<shape_dim>::assemble(idx_map, space, _cells, function);
+        // build sorted index-value vector
+        std::vector<std::pair<Index, DataType_>> entries;
+        Intern::UnitAsmWrapper<shape_dim>::assemble(entries, space, _cells, function);
+        Intern::unit_asm_sort_unique(entries);
 
         // allocate filter if necessary
         if(filter.size() == Index(0))
@@ -226,14 +402,8 @@ namespace FEAT
         LAFEM::UnitFilter<Mem::Main, DataType_, IndexType_> buffer;
         buffer.convert(filter);
 
-        // loop over all dof-indices
-        typename std::map<Index, DataType_>::const_iterator it(idx_map.begin());
-        typename std::map<Index, DataType_>::const_iterator jt(idx_map.end());
-        for(Index i(0); it != jt; ++it, ++i)
-        {
-          // store the dof-index
-          buffer.add(IndexType_(it->first), it->second);
-        }
+        // merge with existing entries
+        Intern::unit_asm_build(buffer, entries);
 
         // Upload assembled result to the filter
         filter.convert(buffer);
@@ -258,9 +428,8 @@ namespace FEAT
         LAFEM::UnitFilterBlocked<MemType_, DataType_, IndexType_, BlockSize_>& filter,
         const Space_& space) const
       {
-        // build index set
-        std::set<Index> idx_set;
-        Intern::UnitAsmWrapper<shape_dim>::assemble(idx_set, space, _cells);
+        // get the (cached) sorted index vector
+        const IdxVector& idx_vec = _get_dofs(space);
 
         // allocate filter if necessary
         if (filter.size() == Index(0))
@@ -272,15 +441,15 @@ namespace FEAT
         LAFEM::UnitFilterBlocked<Mem::Main, DataType_, IndexType_, BlockSize_> buffer;
         buffer.convert(filter);
 
-        // loop over all dof-indices
-        typename std::set<Index>::const_iterator it(idx_set.begin());
-        typename std::set<Index>::const_iterator jt(idx_set.end());
-        typename LAFEM::UnitFilterBlocked<MemType_, DataType_, IndexType_, BlockSize_>::ValueType tmp(DataType_(0));
-        for(Index i(0); it != jt; ++it, ++i)
-        {
-          // store the dof-index
-          buffer.add(IndexType_(*it), tmp);
-        }
+        // build the index-value vector
+        typedef typename LAFEM::UnitFilterBlocked<MemType_, DataType_, IndexType_, BlockSize_>::ValueType ValueType;
+        std::vector<std::pair<Index, ValueType>> entries;
+        entries.reserve(idx_vec.size());
+        for(const Index i : idx_vec)
+          entries.push_back(std::make_pair(i, ValueType(DataType_(0))));
+
+        // merge with existing entries
+        Intern::unit_asm_build(buffer, entries);
 
         // Upload assembled result to the filter
         filter.convert(buffer);
@@ -318,9 +487,10 @@ namespace FEAT
         // get the value type of the function
         typedef typename Analytic::EvalTraits<DataType_, Function_>::ValueType ValueType;
 
-        // build index-value map
-        std::map<Index, ValueType> idx_map;
-        Intern::UnitAsmWrapper<shape_dim>::assemble(idx_map, space, _cells, function);
+        // build sorted index-value vector
+        std::vector<std::pair<Index, ValueType>> entries;
+        Intern::UnitAsmWrapper<shape_dim>::assemble(entries, space, _cells, function);
+        Intern::unit_asm_sort_unique(entries);
 
         // allocate filter if necessary
         if (filter.size() == Index(0))
@@ -332,18 +502,11 @@ namespace FEAT
         LAFEM::UnitFilterBlocked<Mem::Main, DataType_, IndexType_, BlockSize_> buffer;
         buffer.convert(filter);
 
-        // loop over all dof-indices
-        auto it(idx_map.begin());
-        auto jt(idx_map.end());
-        for(Index i(0); it != jt; ++it, ++i)
-        {
-          // store the dof-index
-          buffer.add(IndexType_(it->first), it->second);
-        }
+        // merge with existing entries
+        Intern::unit_asm_build(buffer, entries);
 
         // Upload assembled result to the filter
         filter.convert(buffer);
-
       }
 
       /**
@@ -375,9 +538,8 @@ namespace FEAT
         const Space_& space,
         const LAFEM::DenseVectorBlocked<MemV_, DTV_, ITV_, BlockSize_>& vector_) const
       {
-        // build index set
-        std::set<Index> idx_set;
-        Intern::UnitAsmWrapper<shape_dim>::assemble(idx_set, space, _cells);
+        // get the (cached) sorted index vector
+        const IdxVector& idx_vec = _get_dofs(space);
 
         // allocate filter if necessary
         if (filter.size() == Index(0))
@@ -389,14 +551,20 @@ namespace FEAT
         LAFEM::UnitFilterBlocked<Mem::Main, DTF_, ITF_, BlockSize_> buffer;
         buffer.convert(filter);
 
-        // loop over all dof-indices
-        typename std::set<Index>::const_iterator it(idx_set.begin());
-        typename std::set<Index>::const_iterator jt(idx_set.end());
-        for(Index i(0); it != jt; ++it, ++i)
-        {
-          // store the dof-index
-          buffer.add(ITF_(*it), vector_(ITV_(*it)));
-        }
+        // Create buffer vector to avoid the ()-operator on the vector_ memory
+        LAFEM::DenseVectorBlocked<Mem::Main, DTF_, ITF_, BlockSize_> vec_buf;
+        vec_buf.convert(vector_);
+        const auto* vals = vec_buf.elements();
+
+        // build the index-value vector
+        typedef typename LAFEM::UnitFilterBlocked<MemF_, DTF_, ITF_, BlockSize_>::ValueType ValueType;
+        std::vector<std::pair<Index, ValueType>> entries;
+        entries.reserve(idx_vec.size());
+        for(const Index i : idx_vec)
+          entries.push_back(std::make_pair(i, ValueType(vals[i])));
+
+        // merge with existing entries
+        Intern::unit_asm_build(buffer, entries);
 
         // Upload assembled result to the filter
         filter.convert(buffer);
@@ -412,37 +580,42 @@ namespace FEAT
       struct UnitAsmHelper
       {
         template<typename MeshPart_>
-        static void merge(std::set<Index>& idx, const MeshPart_& mesh_part)
+        static void merge(std::vector<Index>& idx, const MeshPart_& mesh_part)
         {
           // fetch the target set for this dimension
           const typename MeshPart_::template TargetSet<shape_dim_>::Type&
             target_set(mesh_part.template get_target_set<shape_dim_>());
 
-          // merge
+          // append the target set entries
+          const std::size_t num_old = idx.size();
           const Index num_entities = target_set.get_num_entities();
+          idx.resize(num_old + std::size_t(num_entities));
           for(Index i(0); i < num_entities; ++i)
           {
-            idx.insert(target_set[i]);
+            idx[num_old + i] = target_set[i];
           }
+
+          // sort the new entries and merge them with the old ones
+          std::sort(idx.begin() + std::ptrdiff_t(num_old), idx.end());
+          std::inplace_merge(idx.begin(), idx.begin() + std::ptrdiff_t(num_old), idx.end());
+          idx.erase(std::unique(idx.begin(), idx.end()), idx.end());
         }
 
         /// homogeneous assembly
         template<typename Space_>
-        static void assemble(std::set<Index>& idx, const Space_& space, const std::set<Index>& cells)
+        static void assemble(std::vector<Index>& idx, const Space_& space, const std::vector<Index>& cells)
         {
           // create a dof-assignment object
           typename Space_::template DofAssignment<shape_dim_>::Type dof_assign(space);
 
           // loop over all target indices
-          std::set<Index>::const_iterator it(cells.begin());
-          std::set<Index>::const_iterator jt(cells.end());
-          for(; it != jt; ++it)
+          for(const Index cell : cells)
           {
-            dof_assign.prepare(*it);
+            dof_assign.prepare(cell);
             const int num_assign(dof_assign.get_num_assigned_dofs());
             for(int j(0); j < num_assign; ++j)
             {
-              idx.insert(dof_assign.get_index(j));
+              idx.push_back(dof_assign.get_index(j));
             }
             dof_assign.finish();
           }
@@ -454,9 +627,9 @@ namespace FEAT
           typename Space_,
           typename Function_>
         static void assemble(
-          std::map<Index, DataType_>& idx,
+          std::vector<std::pair<Index, DataType_>>& idx,
           const Space_& space,
-          const std::set<Index>& cells,
+          const std::vector<Index>& cells,
           const Function_& function)
         {
           // create a node-functional object
@@ -477,20 +650,18 @@ namespace FEAT
           Tiny::Vector<DataType_, max_dofs+1> node_data;
 
           // loop over all target indices
-          std::set<Index>::const_iterator it(cells.begin());
-          std::set<Index>::const_iterator jt(cells.end());
-          for(; it != jt; ++it)
+          for(const Index cell : cells)
           {
-            node_func.prepare(*it);
+            node_func.prepare(cell);
             node_func(node_data, function);
             node_func.finish();
 
-            dof_assign.prepare(*it);
+            dof_assign.prepare(cell);
 
             const int num_assign(dof_assign.get_num_assigned_dofs());
             for(int j(0); j < num_assign; ++j)
             {
-              idx.insert(std::make_pair(dof_assign.get_index(j), node_data[j]));
+              idx.push_back(std::make_pair(dof_assign.get_index(j), node_data[j]));
             }
             dof_assign.finish();
           }
@@ -504,9 +675,9 @@ namespace FEAT
           typename Space_,
           typename Function_>
         static void assemble(
-          std::map<Index, Tiny::Vector<DataType_, dim_, s_>>& idx,
+          std::vector<std::pair<Index, Tiny::Vector<DataType_, dim_, s_>>>& idx,
           const Space_& space,
-          const std::set<Index>& cells,
+          const std::vector<Index>& cells,
           const Function_& function)
         {
           // create a node-functional object
@@ -529,20 +700,18 @@ namespace FEAT
           Tiny::Vector<ValueType, max_dofs+1> node_data;
 
           // loop over all target indices
-          std::set<Index>::const_iterator it(cells.begin());
-          std::set<Index>::const_iterator jt(cells.end());
-          for(; it != jt; ++it)
+          for(const Index cell : cells)
           {
-            node_func.prepare(*it);
+            node_func.prepare(cell);
             node_func(node_data, function);
             node_func.finish();
 
-            dof_assign.prepare(*it);
+            dof_assign.prepare(cell);
 
             const int num_assign(dof_assign.get_num_assigned_dofs());
             for(int j(0); j < num_assign; ++j)
             {
-              idx.insert(std::make_pair(dof_assign.get_index(j), node_data[j]));
+              idx.push_back(std::make_pair(dof_assign.get_index(j), node_data[j]));
             }
             dof_assign.finish();
           }
@@ -554,14 +723,14 @@ namespace FEAT
       struct UnitAsmWrapper
       {
         template<typename MeshPart_>
-        static void merge(std::set<Index>* idx, const MeshPart_& mesh_part)
+        static void merge(std::vector<Index>* idx, const MeshPart_& mesh_part)
         {
           UnitAsmWrapper<shape_dim_ - 1>::merge(idx, mesh_part);
           UnitAsmHelper<shape_dim_>::merge(idx[shape_dim_], mesh_part);
         }
 
         template<typename Space_>
-        static void assemble(std::set<Index>& idx, const Space_& space, const std::set<Index>* cells)
+        static void assemble(std::vector<Index>& idx, const Space_& space, const std::vector<Index>* cells)
         {
           UnitAsmWrapper<shape_dim_ - 1>::assemble(idx, space, cells);
           UnitAsmHelper<shape_dim_>::assemble(idx, space, cells[shape_dim_]);
@@ -572,9 +741,9 @@ namespace FEAT
           typename Space_,
           typename Function_>
         static void assemble(
-          std::map<Index, DataType_>& idx,
+          std::vector<std::pair<Index, DataType_>>& idx,
           const Space_& space,
-          const std::set<Index>* cells,
+          const std::vector<Index>* cells,
           const Function_& function)
         {
           UnitAsmWrapper<shape_dim_ - 1>::assemble(idx, space, cells, function);
@@ -586,13 +755,13 @@ namespace FEAT
       struct UnitAsmWrapper<0>
       {
         template<typename MeshPart_>
-        static void merge(std::set<Index>* idx, const MeshPart_& mesh_part)
+        static void merge(std::vector<Index>* idx, const MeshPart_& mesh_part)
         {
           UnitAsmHelper<0>::merge(idx[0], mesh_part);
         }
 
         template<typename Space_>
-        static void assemble(std::set<Index>& idx, const Space_& space, const std::set<Index>* cells)
+        static void assemble(std::vector<Index>& idx, const Space_& space, const std::vector<Index>* cells)
         {
           UnitAsmHelper<0>::assemble(idx, space, cells[0]);
         }
@@ -602,9 +771,9 @@ namespace FEAT
           typename Space_,
           typename Function_>
         static void assemble(
-          std::map<Index, DataType_>& idx,
+          std::vector<std::pair<Index, DataType_>>& idx,
           const Space_& space,
-          const std::set<Index>* cells,
+          const std::vector<Index>* cells,
           const Function_& function)
         {
           UnitAsmHelper<0>::assemble(idx, space, cells[0], function);
@@ -14,10 +14,25 @@
 #include <kernel/geometry/intern/standard_vertex_refiner.hpp>
 #include <kernel/geometry/index_calculator.hpp>
 
+// includes, system
+#include <atomic>
+
 namespace FEAT
 {
   namespace Geometry
   {
+    /// \cond internal
+    namespace Intern
+    {
+      /// returns a new topology version, which is unique among all meshes of the process
+      inline Index next_topology_version()
+      {
+        static std::atomic<Index> version(0);
+        return ++version;
+      }
+    } // namespace Intern
+    /// \endcond
+
     /**
      * \brief Conformal mesh class template
      *
@@ -107,6 +122,9 @@ namespace FEAT
       /// Information about cells sharing a facet
       typename IndexSet<shape_dim, shape_dim-1>::Type _neighbours;
 
+      /// the topology version; renewed whenever the index sets have been modified
+      Index _topology_version;
+
     private:
       /// \brief Copy assignment operator declared but not implemented
       ConformalMesh& operator=(const ConformalMesh&);
@@ -124,7 +142,8 @@ namespace FEAT
       explicit ConformalMesh(const Index num_entities[]) :
         _vertex_set(num_entities[0]),
         _index_set_holder(num_entities),
-        _neighbours(num_entities[shape_dim])
+        _neighbours(num_entities[shape_dim]),
+        _topology_version(Intern::next_topology_version())
       {
         for(int i(0); i <= shape_dim; ++i)
         {
@@ -144,7 +163,8 @@ namespace FEAT
       explicit ConformalMesh(Factory<ConformalMesh>& factory) :
         _vertex_set(factory.get_num_entities(0)),
         _index_set_holder(Intern::NumEntitiesWrapper<shape_dim>(factory).num_entities),
-        _neighbours(Intern::NumEntitiesWrapper<shape_dim>(factory).num_entities[shape_dim])
+        _neighbours(Intern::NumEntitiesWrapper<shape_dim>(factory).num_entities[shape_dim]),
+        _topology_version(Intern::next_topology_version())
       {
         // Compute entity counts
         Intern::NumEntitiesWrapper<shape_dim>::apply(factory, _num_entities);
@@ -174,7 +194,8 @@ namespace FEAT
       ConformalMesh(const ConformalMesh& other) :
         _vertex_set(other.get_vertex_set()),
         _index_set_holder(other.get_index_set_holder()),
-        _neighbours(other.get_neighbours())
+        _neighbours(other.get_neighbours()),
+        _topology_version(Intern::next_topology_version())
       {
         for(int i(0); i <= shape_dim; ++i)
         {
@@ -230,7 +251,7 @@ namespace FEAT
       void fill_neighbours()
       {
         // Facet at cell index set
-        auto& facet_idx = get_index_set<shape_dim, shape_dim -1>();
+        const auto& facet_idx = _index_set_holder.template get_index_set_wrapper<shape_dim>().template get_index_set<shape_dim-1>();
 
         XASSERTM(get_num_entities(shape_dim-1) == facet_idx.get_index_bound(), "mesh num_entities / index_set num_entities mismatch");
 
@@ -241,6 +262,38 @@ namespace FEAT
 
       }
 
+      /**
+       * \brief Returns the topology version of the mesh.
+       *
+       * Each mesh receives a new topology version upon construction and whenever its index sets are
+       * modified by the mesh itself, e.g. by deduct_topology_from_top(). The version is unique among
+       * all meshes, so objects which are derived from the topology of a mesh, like a Space::DofTable,
+       * can detect whether the topology has changed since their creation, even if a new mesh has been
+       * created at the address of a deleted one.
+       *
+       * \note
+       * The non-const index set accessors do not renew the version. Code which modifies the index
+       * sets through these accessors after the construction of the mesh has to call
+       * mark_topology_modified() afterwards.
+       *
+       * \returns The topology version of the mesh.
+       */
+      Index get_topology_version() const
+      {
+        return _topology_version;
+      }
+
+      /**
+       * \brief Renews the topology version of the mesh.
+       *
+       * This function has to be called after the index sets have been modified through one of the
+       * non-const index set accessors.
+       */
+      void mark_topology_modified()
+      {
+        _topology_version = Intern::next_topology_version();
+      }
+
       /// \returns A reference to the facet neighbour relations
       typename IndexSet<shape_dim, shape_dim-1>::Type& get_neighbours()
       {
@@ -324,6 +377,7 @@ namespace FEAT
         RedundantIndexSetBuilder<ShapeType>::compute(_index_set_holder);
         NumEntitiesExtractor<shape_dim>::set_num_entities(_index_set_holder, _num_entities);
         this->fill_neighbours();
+        this->mark_topology_modified();
       }
 
       /**
@@ -19,6 +19,7 @@
 #include <kernel/geometry/patch_meshpart_factory.hpp>
 #include <kernel/geometry/patch_meshpart_splitter.hpp>
 #include <kernel/geometry/intern/dual_adaptor.hpp>
+#include <kernel/geometry/intern/coarse_fine_cell_mapping.hpp>
 #include <kernel/adjacency/graph.hpp>
 
 // includes, STL
@@ -719,6 +720,10 @@ namespace FEAT
       std::map<int, MeshPartType*> _halos;
       /// a map of our patch mesh-parts
       std::map<int, MeshPartType*> _patches;
+      /// the base-mesh cell index for each cell of our mesh
+      std::vector<Index> _base_cells;
+      /// the total number of cells of the base mesh
+      Index _num_base_cells;
 
     public:
       /**
@@ -734,7 +739,9 @@ namespace FEAT
         BaseClass(mesh),
         _atlas(atlas),
         _halos(),
-        _patches()
+        _patches(),
+        _base_cells(),
+        _num_base_cells(0)
       {
       }
 
@@ -765,6 +772,7 @@ namespace FEAT
           s += x.second->bytes();
         for(const auto& x : _patches)
           s += x.second->bytes();
+        s += _base_cells.size() * sizeof(Index);
         return s;
       }
 
@@ -845,11 +853,15 @@ namespace FEAT
       }
 
       /**
-       * \brief Creates mesh-parts for all base cells of this root mesh.
+       * \brief Creates the base-cell mapping of this root mesh.
        *
        * This function must be called for the unrefined base root mesh, if one
        * intends to use the Assembly::BaseSplitter class for the redistribution
        * of data in dynamic load balancing.
+       *
+       * The mapping stores the index of the base-mesh cell for each cell of the
+       * mesh; it is propagated to the refined mesh nodes by the #refine() function
+       * and to the patch mesh nodes by the #extract_patch() function.
        */
       void create_base_splitting()
       {
@@ -858,16 +870,67 @@ namespace FEAT
           throw InternalError("No mesh assigned");
 
         // get number of cells
-        Index num_cells = this->_mesh->get_num_entities(MeshType::shape_dim);
+        const Index num_cells = this->_mesh->get_num_entities(MeshType::shape_dim);
 
-        // loop over all cell indices
+        // each cell is its own base cell
+        _num_base_cells = num_cells;
+        _base_cells.resize(num_cells);
         for(Index cell(0); cell < num_cells; ++cell)
-        {
-          // create a macro factory
-          MacroFactory<MeshPartType> factory(*this->_mesh, cell);
-          // create a new mesh part and add to this mesh node
-          this->add_mesh_part("_base:" + stringify(cell), new MeshPartType(factory));
-        }
+          _base_cells[cell] = cell;
+      }
+
+      /// \returns \c true, if this mesh node has a base-cell mapping, otherwise \c false.
+      bool has_base_splitting() const
+      {
+        return !_base_cells.empty();
+      }
+
+      /**
+       * \brief Returns the base-cell mapping of this root mesh.
+       *
+       * \returns
+       * A vector containing the index of the base-mesh cell for each cell of this
+       * mesh, or an empty vector, if no base splitting was created.
+       */
+      const std::vector<Index>& get_base_cells() const
+      {
+        return _base_cells;
+      }
+
+      /**
+       * \brief Returns the number of base-mesh cells.
+       *
+       * \note This is the number of cells of the whole base mesh, i.e. it is the same
+       * for all patches extracted from the base mesh, even if a patch does not contain
+       * all base cells.
+       *
+       * \returns
+       * The number of base-mesh cells, or 0, if no base splitting was created.
+       */
+      Index get_num_base_cells() const
+      {
+        return _num_base_cells;
+      }
+
+      /**
+       * \brief Sets the base-cell mapping of this root mesh.
+       *
+       * This function is used to restore a previously computed base splitting,
+       * e.g. when reading a mesh node from a hierarchy cache.
+       *
+       * \param[in] base_cells
+       * A vector containing the index of the base-mesh cell for each cell of this mesh.
+       *
+       * \param[in] num_base_cells
+       * The total number of cells of the base mesh.
+       */
+      void set_base_cells(std::vector<Index>&& base_cells, Index num_base_cells)
+      {
+        XASSERTM(base_cells.empty() || (Index(base_cells.size()) == this->get_mesh()->get_num_elements()),
+          "invalid base-cell mapping size");
+        XASSERTM(base_cells.empty() == (num_base_cells == Index(0)), "invalid number of base cells");
+        _base_cells = std::forward<std::vector<Index>>(base_cells);
+        _num_base_cells = num_base_cells;
       }
 
       /**
@@ -904,6 +967,20 @@ namespace FEAT
           fine_node->add_patch(v.first, new MeshPartType(patch_refinery));
         }
 
+        // refine our base-cell mapping; each child inherits the base cell of its parent
+        if(!_base_cells.empty())
+        {
+          const MeshType& fine_mesh = *fine_node->get_mesh();
+          Intern::CoarseFineCellMapping<MeshType> cf_map(fine_mesh, *this->_mesh);
+          fine_node->_num_base_cells = _num_base_cells;
+          fine_node->_base_cells.resize(fine_mesh.get_num_entities(MeshType::shape_dim));
+          for(Index cell(0); cell < Index(_base_cells.size()); ++cell)
+          {
+            for(auto it = cf_map.image_begin(cell); it != cf_map.image_end(cell); ++it)
+              fine_node->_base_cells[*it] = _base_cells[cell];
+          }
+        }
+
         // adapt by chart?
         if((adapt_mode & AdaptMode::chart) != AdaptMode::none)
         {
@@ -1078,7 +1155,17 @@ namespace FEAT
           }
         }
 
-        // Step 6: Create halos
+        // Step 6: restrict the base-cell mapping to the patch
+        if(!_base_cells.empty())
+        {
+          const auto& patch_cells = patch_mesh_part->template get_target_set<MeshType::shape_dim>();
+          patch_node->_num_base_cells = _num_base_cells;
+          patch_node->_base_cells.resize(patch_cells.get_num_entities());
+          for(Index cell(0); cell < patch_cells.get_num_entities(); ++cell)
+            patch_node->_base_cells[cell] = _base_cells[patch_cells[cell]];
+        }
+
+        // Step 7: Create halos
         {
           // create halo factory
           PatchHaloFactory<MeshType> halo_factory(ranks_at_elem, *base_root_mesh, *patch_mesh_part);
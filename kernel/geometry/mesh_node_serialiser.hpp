@@ -0,0 +1,419 @@
+// FEAT3: Finite Element Analysis Toolbox, Version 3
+// Copyright (C) 2010 - 2020 by Stefan Turek & the FEAT group
+// FEAT3 is released under the GNU General Public License version 3,
+// see the file 'copyright.txt' in the top level directory for details.
+
+#pragma once
+#ifndef KERNEL_GEOMETRY_MESH_NODE_SERIALISER_HPP
+#define KERNEL_GEOMETRY_MESH_NODE_SERIALISER_HPP 1
+
+#include <kernel/geometry/mesh_atlas.hpp>
+#include <kernel/geometry/conformal_mesh.hpp>
+#include <kernel/geometry/mesh_part.hpp>
+#include <kernel/geometry/mesh_node.hpp>
+
+#include <cstdint>
+#include <iostream>
+#include <map>
+#include <memory>
+#include <vector>
+
+namespace FEAT
+{
+  namespace Geometry
+  {
+    /// \cond internal
+    namespace Intern
+    {
+      class SerialiseHelper
+      {
+      public:
+        template<typename T_>
+        static void write_raw(std::ostream& os, const T_* data, std::size_t count)
+        {
+          if(count > std::size_t(0))
+            os.write(reinterpret_cast<const char*>(data), std::streamsize(count * sizeof(T_)));
+        }
+
+        template<typename T_>
+        static void read_raw(std::istream& is, T_* data, std::size_t count)
+        {
+          if(count > std::size_t(0))
+            is.read(reinterpret_cast<char*>(data), std::streamsize(count * sizeof(T_)));
+          if(!is.good())
+            throw InternalError(__func__, __FILE__, __LINE__, "Unexpected end of mesh node stream");
+        }
+
+        static void write_index(std::ostream& os, std::uint64_t value)
+        {
+          write_raw(os, &value, std::size_t(1));
+        }
+
+        static std::uint64_t read_index(std::istream& is)
+        {
+          std::uint64_t value(0u);
+          read_raw(is, &value, std::size_t(1));
+          return value;
+        }
+
+        static void write_string(std::ostream& os, const String& s)
+        {
+          write_index(os, std::uint64_t(s.size()));
+          write_raw(os, s.data(), s.size());
+        }
+
+        static String read_string(std::istream& is)
+        {
+          std::vector<char> buf(std::size_t(read_index(is)) + 1u, '\0');
+          read_raw(is, buf.data(), buf.size() - 1u);
+          return String(buf.data(), buf.size() - 1u);
+        }
+      };
+
+      template<typename Shape_, int cell_dim_ = Shape_::dimension, int face_dim_ = cell_dim_ - 1>
+      class IndexSetSerialiseHelper
+      {
+      public:
+        static void write(std::ostream& os, const IndexSetHolder<Shape_>& ish)
+        {
+          // recurse down
+          IndexSetSerialiseHelper<Shape_, cell_dim_, face_dim_ - 1>::write(os, ish);
+
+          const auto& index_set = ish.template get_index_set<cell_dim_, face_dim_>();
+          SerialiseHelper::write_index(os, index_set.get_num_entities());
+          SerialiseHelper::write_raw(os, index_set.get_indices(), std::size_t(index_set.get_num_entities()));
+        }
+
+        static void read(std::istream& is, IndexSetHolder<Shape_>& ish)
+        {
+          // recurse down
+          IndexSetSerialiseHelper<Shape_, cell_dim_, face_dim_ - 1>::read(is, ish);
+
+          auto& index_set = ish.template get_index_set<cell_dim_, face_dim_>();
+          if(SerialiseHelper::read_index(is) != std::uint64_t(index_set.get_num_entities()))
+            throw InternalError(__func__, __FILE__, __LINE__, "Index set size mismatch in mesh node stream");
+          SerialiseHelper::read_raw(is, index_set.get_indices(), std::size_t(index_set.get_num_entities()));
+        }
+      };
+
+      template<typename Shape_, int cell_dim_>
+      class IndexSetSerialiseHelper<Shape_, cell_dim_, -1>
+      {
+      public:
+        static void write(std::ostream& os, const IndexSetHolder<Shape_>& ish)
+        {
+          IndexSetSerialiseHelper<Shape_, cell_dim_ - 1>::write(os, ish);
+        }
+
+        static void read(std::istream& is, IndexSetHolder<Shape_>& ish)
+        {
+          IndexSetSerialiseHelper<Shape_, cell_dim_ - 1>::read(is, ish);
+        }
+      };
+
+      template<typename Shape_>
+      class IndexSetSerialiseHelper<Shape_, 0, -1>
+      {
+      public:
+        static void write(std::ostream&, const IndexSetHolder<Shape_>&)
+        {
+        }
+
+        static void read(std::istream&, IndexSetHolder<Shape_>&)
+        {
+        }
+      };
+
+      template<typename Shape_, int dim_ = Shape_::dimension>
+      class TargetSetSerialiseHelper
+      {
+      public:
+        static void write(std::ostream& os, const TargetSetHolder<Shape_>& tsh)
+        {
+          // recurse down
+          TargetSetSerialiseHelper<Shape_, dim_ - 1>::write(os, tsh);
+
+          const TargetSet& target_set = tsh.template get_target_set<dim_>();
+          SerialiseHelper::write_raw(os, target_set.get_indices(), std::size_t(target_set.get_num_entities()));
+        }
+
+        static void read(std::istream& is, TargetSetHolder<Shape_>& tsh)
+        {
+          // recurse down
+          TargetSetSerialiseHelper<Shape_, dim_ - 1>::read(is, tsh);
+
+          TargetSet& target_set = tsh.template get_target_set<dim_>();
+          SerialiseHelper::read_raw(is, target_set.get_indices(), std::size_t(target_set.get_num_entities()));
+        }
+      };
+
+      template<typename Shape_>
+      class TargetSetSerialiseHelper<Shape_, -1>
+      {
+      public:
+        static void write(std::ostream&, const TargetSetHolder<Shape_>&)
+        {
+        }
+
+        static void read(std::istream&, TargetSetHolder<Shape_>&)
+        {
+        }
+      };
+    } // namespace Intern
+    /// \endcond
+
+    /**
+     * \brief Binary mesh node serialiser class template
+     *
+     * This class implements the binary serialisation and deserialisation of a whole RootMeshNode,
+     * i.e. the root mesh including its complete topology, the mesh-parts including their topologies
+     * and attributes and chart associations, the halo and patch mesh-parts as well as the base-cell
+     * mapping. In contrast to the MeshFileWriter/MeshFileReader pair, the binary format reproduces
+     * the exact entity numbering of refined and partitioned meshes, so that a deserialised mesh node
+     * is indistinguishable from the original one. The format is meant for caching on the same
+     * platform and is neither portable nor versioned beyond a simple magic number.
+     *
+     * \note
+     * Only the mesh-part nodes which are direct children of the root node are serialised.
+     *
+     * \tparam Mesh_
+     * The mesh type of the root mesh node.
+     */
+    template<typename Mesh_>
+    class MeshNodeSerialiser
+    {
+    public:
+      /// the mesh type
+      typedef Mesh_ MeshType;
+      /// the shape type
+      typedef typename MeshType::ShapeType ShapeType;
+      /// the mesh-part type
+      typedef MeshPart<MeshType> MeshPartType;
+      /// the root mesh node type
+      typedef RootMeshNode<MeshType> MeshNodeType;
+      /// the mesh-part node type
+      typedef MeshPartNode<MeshType> MeshPartNodeType;
+      /// the mesh atlas type
+      typedef MeshAtlas<MeshType> MeshAtlasType;
+
+      /// the shape dimension
+      static constexpr int shape_dim = ShapeType::dimension;
+
+      /// magic number of a serialised mesh node: "FMSHNODE"
+      static constexpr std::uint64_t magic = 0x45444F4E48534D46ull;
+
+    protected:
+      typedef Intern::SerialiseHelper IO;
+
+      static void _write_num_entities(std::ostream& os, const Index* num_entities)
+      {
+        for(int i(0); i <= shape_dim; ++i)
+          IO::write_index(os, num_entities[i]);
+      }
+
+      static void _read_num_entities(std::istream& is, Index* num_entities)
+      {
+        for(int i(0); i <= shape_dim; ++i)
+          num_entities[i] = Index(IO::read_index(is));
+      }
+
+      static void _write_mesh_part(std::ostream& os, const MeshPartType* part)
+      {
+        IO::write_index(os, part != nullptr ? 1u : 0u);
+        if(part == nullptr)
+          return;
+
+        Index num_entities[shape_dim+1];
+        for(int i(0); i <= shape_dim; ++i)
+          num_entities[i] = part->get_num_entities(i);
+        _write_num_entities(os, num_entities);
+        IO::write_index(os, part->has_topology() ? 1u : 0u);
+
+        // write target sets
+        Intern::TargetSetSerialiseHelper<ShapeType>::write(os, part->get_target_set_holder());
+
+        // write topology if present
+        if(part->has_topology())
+          Intern::IndexSetSerialiseHelper<ShapeType>::write(os, *part->get_topology());
+
+        // write attributes
+        const auto& attribs = part->get_mesh_attributes();
+        IO::write_index(os, attribs.size());
+        for(const auto& at : attribs)
+        {
+          IO::write_string(os, at.first);
+          IO::write_index(os, std::uint64_t(at.second->get_dimension()));
+          IO::write_index(os, at.second->get_num_values());
+          if(at.second->get_num_values() > Index(0))
+            IO::write_raw(os, at.second->raw_at(0), std::size_t(at.second->get_num_values()) *
+              std::size_t(at.second->get_dimension()));
+        }
+      }
+
+      static MeshPartType* _read_mesh_part(std::istream& is)
+      {
+        if(IO::read_index(is) == 0u)
+          return nullptr;
+
+        Index num_entities[shape_dim+1];
+        _read_num_entities(is, num_entities);
+        const bool have_topology = (IO::read_index(is) != 0u);
+        std::unique_ptr<MeshPartType> part(new MeshPartType(num_entities, have_topology));
+
+        // read target sets
+        Intern::TargetSetSerialiseHelper<ShapeType>::read(is, part->get_target_set_holder());
+
+        // read topology if present
+        if(have_topology)
+          Intern::IndexSetSerialiseHelper<ShapeType>::read(is, *part->get_topology());
+
+        // read attributes
+        const std::size_t num_attribs = std::size_t(IO::read_index(is));
+        for(std::size_t i(0); i < num_attribs; ++i)
+        {
+          String name = IO::read_string(is);
+          const int dim = int(IO::read_index(is));
+          const Index num_values = Index(IO::read_index(is));
+          auto* attrib = new typename MeshPartType::AttributeSetType(num_values, dim);
+          if(num_values > Index(0))
+            IO::read_raw(is, attrib->raw_at(0), std::size_t(num_values) * std::size_t(dim));
+          part->add_attribute(attrib, name);
+        }
+
+        return part.release();
+      }
+
+    public:
+      /**
+       * \brief Writes a root mesh node into a binary stream.
+       *
+       * \param[in] os
+       * The binary output stream that the mesh node is to be written to.
+       *
+       * \param[in] node
+       * The mesh node that is to be serialised.
+       */
+      static void write(std::ostream& os, const MeshNodeType& node)
+      {
+        const MeshType* mesh = node.get_mesh();
+        XASSERTM(mesh != nullptr, "cannot serialise a mesh node without a mesh");
+
+        IO::write_index(os, magic);
+
+        // write entity counts
+        Index num_entities[shape_dim+1];
+        for(int i(0); i <= shape_dim; ++i)
+          num_entities[i] = mesh->get_num_entities(i);
+        _write_num_entities(os, num_entities);
+
+        // write vertices and topology
+        const auto& vtx = mesh->get_vertex_set();
+        if(vtx.get_num_vertices() > Index(0))
+          IO::write_raw(os, &vtx[0], std::size_t(vtx.get_num_vertices()));
+        Intern::IndexSetSerialiseHelper<ShapeType>::write(os, mesh->get_index_set_holder());
+
+        // write base cells
+        const std::vector<Index>& base_cells = node.get_base_cells();
+        IO::write_index(os, base_cells.size());
+        IO::write_raw(os, base_cells.data(), base_cells.size());
+        IO::write_index(os, node.get_num_base_cells());
+
+        // write mesh-parts
+        std::deque<String> part_names = node.get_mesh_part_names();
+        IO::write_index(os, part_names.size());
+        for(const auto& name : part_names)
+        {
+          IO::write_string(os, name);
+          IO::write_string(os, node.find_mesh_part_chart_name(name));
+          _write_mesh_part(os, node.find_mesh_part(name));
+        }
+
+        // write halos
+        IO::write_index(os, node.get_halo_map().size());
+        for(const auto& v : node.get_halo_map())
+        {
+          IO::write_index(os, std::uint64_t(std::int64_t(v.first)));
+          _write_mesh_part(os, v.second);
+        }
+
+        // write patches
+        IO::write_index(os, node.get_patch_map().size());
+        for(const auto& v : node.get_patch_map())
+        {
+          IO::write_index(os, std::uint64_t(std::int64_t(v.first)));
+          _write_mesh_part(os, v.second);
+        }
+      }
+
+      /**
+       * \brief Reads a root mesh node from a binary stream.
+       *
+       * \param[in] is
+       * The binary input stream that the mesh node is to be read from.
+       *
+       * \param[in] atlas
+       * A pointer to the atlas that the charts of the mesh-parts are to be looked up in.
+       * May be \c nullptr, if no charts are to be linked.
+       *
+       * \returns
+       * A new mesh node; the caller is responsible for deleting it.
+       */
+      static MeshNodeType* read(std::istream& is, MeshAtlasType* atlas = nullptr)
+      {
+        if(IO::read_index(is) != magic)
+          throw InternalError(__func__, __FILE__, __LINE__, "Invalid mesh node stream");
+
+        // read entity counts and create mesh
+        Index num_entities[shape_dim+1];
+        _read_num_entities(is, num_entities);
+        std::unique_ptr<MeshType> mesh(new MeshType(num_entities));
+
+        // read vertices and topology
+        auto& vtx = mesh->get_vertex_set();
+        if(vtx.get_num_vertices() > Index(0))
+          IO::read_raw(is, &vtx[0], std::size_t(vtx.get_num_vertices()));
+        Intern::IndexSetSerialiseHelper<ShapeType>::read(is, mesh->get_index_set_holder());
+        mesh->fill_neighbours();
+
+        std::unique_ptr<MeshNodeType> node(new MeshNodeType(mesh.release(), atlas));
+
+        // read base cells
+        std::vector<Index> base_cells(std::size_t(IO::read_index(is)));
+        IO::read_raw(is, base_cells.data(), base_cells.size());
+        const Index num_base_cells = Index(IO::read_index(is));
+        node->set_base_cells(std::move(base_cells), num_base_cells);
+
+        // read mesh-parts
+        const std::size_t num_parts = std::size_t(IO::read_index(is));
+        for(std::size_t i(0); i < num_parts; ++i)
+        {
+          String name = IO::read_string(is);
+          String chart_name = IO::read_string(is);
+          MeshPartType* part = _read_mesh_part(is);
+          const auto* chart = ((atlas != nullptr) && !chart_name.empty() ? atlas->find_mesh_chart(chart_name) : nullptr);
+          node->add_mesh_part(name, part, chart_name, chart);
+        }
+
+        // read halos
+        const std::size_t num_halos = std::size_t(IO::read_index(is));
+        for(std::size_t i(0); i < num_halos; ++i)
+        {
+          const int rank = int(std::int64_t(IO::read_index(is)));
+          node->add_halo(rank, _read_mesh_part(is));
+        }
+
+        // read patches
+        const std::size_t num_patches = std::size_t(IO::read_index(is));
+        for(std::size_t i(0); i < num_patches; ++i)
+        {
+          const int rank = int(std::int64_t(IO::read_index(is)));
+          node->add_patch(rank, _read_mesh_part(is));
+        }
+
+        return node.release();
+      }
+    }; // class MeshNodeSerialiser<...>
+  } // namespace Geometry
+} // namespace FEAT
+
+#endif // KERNEL_GEOMETRY_MESH_NODE_SERIALISER_HPP
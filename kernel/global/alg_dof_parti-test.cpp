@@ -124,6 +124,9 @@ public:
   {
     const Dist::Comm comm = Dist::Comm::world();
 
+    // test the flattened index lists of nested mirrors
+    test_sync_index();
+
     // create gate
     GateType gate(comm);
     if(!create_gate(gate, 5))
@@ -139,6 +142,109 @@ public:
 
     // test matrix
     test_matrix(gate, adp, 5);
+
+    // test point-to-point, neighbourhood collective and shared-memory synchronisation
+    test_sync_modes(gate);
+  }
+
+  void test_sync_modes(GateType& gate) const
+  {
+    const DataType tol = Math::pow(Math::eps<DataType>(), DataType(0.9));
+    Random rng(311ull + 13ull * (unsigned long long)gate.get_comm()->rank());
+
+    // create three random type-0 vectors and synchronise copies of them via point-to-point messages;
+    // in contrast to the gate, this does not use the flattened index lists but the mirrors
+    std::vector<LocalVectorType> vecs, refs;
+    for(int k(0); k < 3; ++k)
+    {
+      vecs.push_back(gate._freqs.clone(LAFEM::CloneMode::Layout));
+      vecs.back().format(rng, -1.0, +1.0);
+      refs.push_back(vecs.back().clone());
+      if(!gate._ranks.empty())
+        Global::synch_vector(refs.back(), *gate.get_comm(), gate._ranks, gate._mirrors);
+    }
+
+    // by default, the gate uses point-to-point messages
+    TEST_CHECK(gate._graph_comm == nullptr);
+    test_sync(gate, vecs, refs, tol);
+
+    // enable the neighbourhood collective exchange; this requires more than one process
+    gate.compile_graph();
+    TEST_CHECK((gate._graph_comm != nullptr) == (gate.get_comm()->size() > 1));
+    test_sync(gate, vecs, refs, tol);
+
+    // enable the shared-memory exchange on top of the neighbourhood collective
+    gate.compile_shared();
+    test_sync(gate, vecs, refs, tol);
+  }
+
+  /// checks the flattened index lists against the gather and scatter functions of nested mirrors
+  void test_sync_index() const
+  {
+    typedef LAFEM::DenseVectorBlocked<MemType, DataType, IndexType, 2> BlockedVectorType;
+    typedef LAFEM::TupleVector<LAFEM::PowerVector<BlockedVectorType, 2>, LocalVectorType> MetaVectorType;
+    typedef LAFEM::TupleMirror<LAFEM::PowerMirror<MirrorType, 2>, MirrorType> MetaMirrorType;
+    typedef Global::Intern::SynchVectorFlat<MetaVectorType, MetaMirrorType> FlatType;
+
+    Random rng(523ull);
+    MetaVectorType vector;
+    vector.template at<0>().template at<0>() = BlockedVectorType(Index(7));
+    vector.template at<0>().template at<1>() = BlockedVectorType(Index(7));
+    vector.template at<1>() = LocalVectorType(Index(5));
+    vector.format(rng, -1.0, +1.0);
+
+    // both mirrors share the second block entry 3 and the scalar entry 4
+    std::vector<MetaMirrorType> mirrors;
+    mirrors.push_back(MetaMirrorType(LAFEM::PowerMirror<MirrorType, 2>(create_mirror_1(7, 3, 0, 3)), create_mirror_1(5, 2, 1, 3)));
+    mirrors.push_back(MetaMirrorType(LAFEM::PowerMirror<MirrorType, 2>(create_mirror_1(7, 2, 3, 2)), create_mirror_1(5, 2, 0, 4)));
+
+    std::vector<Index> offs(1u, Index(0));
+    for(const auto& mir : mirrors)
+      offs.push_back(offs.back() + mir.buffer_size(vector));
+
+    Global::SynchVectorIndex<DataType> index(vector, mirrors);
+    TEST_CHECK_EQUAL(index.num_leaves, Index(3));
+    TEST_CHECK_EQUAL(Index(index.leaf_idx.size()), offs.back());
+
+    // gather by the mirrors and by the flattened index lists
+    LocalVectorType buf_ref(offs.back(), DataType(0)), buf(offs.back(), DataType(0));
+    for(std::size_t i(0); i < mirrors.size(); ++i)
+      mirrors[i].gather(buf_ref, vector, offs[i]);
+    std::vector<DataType*> leaves;
+    FlatType::leaves(vector, leaves);
+    index.gather(buf.elements(), leaves.data(), Index(0), offs.back());
+    for(Index i(0); i < buf.size(); ++i)
+      TEST_CHECK_EQUAL(buf(i), buf_ref(i));
+
+    // scatter by the mirrors and by the flattened index lists
+    MetaVectorType vec_ref = vector.clone();
+    for(std::size_t i(0); i < mirrors.size(); ++i)
+    {
+      mirrors[i].scatter_axpy(vec_ref, buf_ref, DataType(1), offs[i]);
+      index.scatter_axpy(leaves.data(), buf.elements(), offs[i], offs[i+1]);
+    }
+    vec_ref.axpy(vector, vec_ref, -DataType(1));
+    TEST_CHECK_EQUAL(vec_ref.norm2(), DataType(0));
+  }
+
+  /// synchronises copies of the vectors by the synchronous and the asynchronous variant and compares the sums
+  void test_sync(const GateType& gate, const std::vector<LocalVectorType>& vecs,
+    const std::vector<LocalVectorType>& refs, const DataType tol) const
+  {
+    for(std::size_t k(0); k < vecs.size(); ++k)
+    {
+      LocalVectorType vec = vecs[k].clone();
+      LocalVectorType vec_async = vecs[k].clone();
+      gate.sync_0(vec);
+      gate.sync_0_async(vec_async)->wait();
+
+      // all synchronisations must yield the same sums up to the summation order
+      for(Index i(0); i < vec.size(); ++i)
+      {
+        TEST_CHECK_EQUAL_WITHIN_EPS(vec(i), refs[k](i), tol);
+        TEST_CHECK_EQUAL_WITHIN_EPS(vec_async(i), refs[k](i), tol);
+      }
+    }
   }
 
   void test_vector(const GateType& gate, const AlgDofPartiType& adp) const
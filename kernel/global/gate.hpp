@@ -10,10 +10,13 @@
 #include <kernel/base_header.hpp>
 #include <kernel/util/dist.hpp>
 #include <kernel/util/exception.hpp>
+#include <kernel/util/region_timer.hpp>
+#include <kernel/util/tiny_algebra.hpp>
 #include <kernel/lafem/dense_vector.hpp>
 #include <kernel/global/synch_vec.hpp>
 #include <kernel/global/synch_scal.hpp>
 
+#include <memory>
 #include <vector>
 
 namespace FEAT
@@ -39,7 +42,7 @@ namespace FEAT
       typedef Mirror_ MirrorType;
 
       typedef std::shared_ptr<SynchScalarTicket<DataType>> ScalarTicketType;
-      typedef std::shared_ptr<SynchVectorTicket<LocalVector_, std::vector<Mirror_>>> VectorTicketType;
+      typedef std::shared_ptr<SynchVectorTicket<LocalVector_, Mirror_>> VectorTicketType;
 
     public:
       /// our communicator
@@ -50,6 +53,12 @@ namespace FEAT
       std::vector<Mirror_> _mirrors;
       /// frequency vector
       LocalVector_ _freqs;
+      /// shared-memory exchange data for on-node neighbours
+      std::shared_ptr<SynchVectorShared<DataType>> _shared;
+      /// communicator with the distributed graph topology of our neighbours
+      std::shared_ptr<Dist::Comm> _graph_comm;
+      /// flattened pack and unpack index lists of our mirrors
+      std::shared_ptr<SynchVectorIndex<DataType>> _index;
 
       /// Our 'base' class type
       template <typename LocalVector2_, typename Mirror2_>
@@ -92,9 +101,13 @@ namespace FEAT
 
         this->_ranks.clear();
         this->_mirrors.clear();
+        this->_shared.reset();
+
+        this->_index.reset();
 
         this->_comm = other._comm;
         this->_ranks = other._ranks;
+        this->_graph_comm = other._graph_comm;
 
         for(auto& other_mirrors_i : other._mirrors)
         {
@@ -104,6 +117,9 @@ namespace FEAT
         }
 
         this->_freqs.convert(other._freqs);
+
+        if(other._index)
+          this->_compile_index(std::integral_constant<bool, Intern::SynchVectorFlat<LocalVector_, Mirror_>::supported>());
       }
 
       /// \brief Returns the total amount of bytes allocated.
@@ -116,6 +132,10 @@ namespace FEAT
         }
         temp += _freqs.bytes();
         temp += _ranks.size() * sizeof(int);
+        if(_shared)
+          temp += _shared->window.bytes();
+        if(_index)
+          temp += (_index->leaf_idx.size() + _index->elem_idx.size()) * sizeof(Index);
 
         return temp;
       }
@@ -148,6 +168,57 @@ namespace FEAT
 
         // invert frequencies
         _freqs.component_invert(_freqs);
+
+        // build the flattened index lists for the vector synchronisation
+        _compile_index(std::integral_constant<bool, Intern::SynchVectorFlat<LocalVector_, Mirror_>::supported>());
+      }
+
+      /**
+       * \brief Enables the neighbourhood collective exchange.
+       *
+       * This function creates a communicator whose distributed graph topology consists of the
+       * neighbour ranks of this gate, so that the synchronisation functions of this gate
+       * exchange the buffers of all neighbours by a single neighbourhood collective instead of
+       * one point-to-point message pair per neighbour, which is the default.
+       *
+       * \attention
+       * This function must be called after compile() and it is a collective operation on
+       * the communicator of this gate.
+       */
+      void compile_graph()
+      {
+        _graph_comm.reset();
+        if((_comm == nullptr) || (_comm->size() <= 1))
+          return;
+
+        const int degree = int(_ranks.size());
+        _graph_comm = std::make_shared<Dist::Comm>(_comm->dist_graph_create_adjacent(degree, _ranks.data(), degree, _ranks.data()));
+      }
+
+      /**
+       * \brief Enables the shared-memory exchange for all neighbours on the same node.
+       *
+       * After this function has been called, the synchronisation functions of this gate
+       * exchange the buffers of all neighbours which run on the same shared-memory node
+       * by direct copies from a shared memory window, see SynchVectorShared for details.
+       * The buffers of all other neighbours are still exchanged via MPI messages.
+       *
+       * \attention
+       * This function must be called after compile() and it is a collective operation on
+       * the communicator of this gate. Furthermore, the gate must be destroyed collectively.
+       */
+      void compile_shared()
+      {
+        _shared.reset();
+        if(_comm == nullptr)
+          return;
+
+        std::vector<Index> sizes;
+        sizes.reserve(_mirrors.size());
+        for(const auto& mir : _mirrors)
+          sizes.push_back(mir.buffer_size(_freqs));
+
+        _shared = std::make_shared<SynchVectorShared<DataType>>(*_comm, _ranks, sizes);
       }
 
       /**
@@ -176,15 +247,17 @@ namespace FEAT
        */
       void sync_0(LocalVector_& vector) const
       {
+        RegionTimer::Scope region("gate-sync");
+
         if(_ranks.empty())
           return;
 
-        synch_vector(vector, *_comm, _ranks, _mirrors);
+        synch_vector(vector, *_comm, _ranks, _mirrors, _shared.get(), _graph_comm.get(), _index.get());
       }
 
       VectorTicketType sync_0_async(LocalVector_& vector) const
       {
-        return std::make_shared<SynchVectorTicket<LocalVector_, Mirror_>>(vector, *_comm, _ranks, _mirrors);
+        return std::make_shared<SynchVectorTicket<LocalVector_, Mirror_>>(vector, *_comm, _ranks, _mirrors, _shared.get(), _graph_comm.get(), _index.get());
       }
 
       /**
@@ -200,11 +273,13 @@ namespace FEAT
        */
       void sync_1(LocalVector_& vector) const
       {
+        RegionTimer::Scope region("gate-sync");
+
         if(_ranks.empty())
           return;
 
         from_1_to_0(vector);
-        synch_vector(vector, *_comm, _ranks, _mirrors);
+        synch_vector(vector, *_comm, _ranks, _mirrors, _shared.get(), _graph_comm.get(), _index.get());
       }
 
       VectorTicketType sync_1_async(LocalVector_& vector) const
@@ -224,6 +299,8 @@ namespace FEAT
        */
       DataType dot(const LocalVector_& x, const LocalVector_& y) const
       {
+        RegionTimer::Scope region("gate-dot");
+
         // This is if there is only one process
         if(_comm == nullptr || _comm->size() == 1)
         {
@@ -246,6 +323,36 @@ namespace FEAT
         return sum_async(_freqs.triple_dot(x, y), sqrt);
       }
 
+      /**
+       * \brief Computes the synchronised column-wise dot-products of two type-1 multi-vectors.
+       *
+       * All columns are reduced in a single message, see sum(const Tiny::Vector&).
+       *
+       * \param[in] x, y
+       * The two type-1 multi-vectors whose column-wise dot-products are to be computed.
+       *
+       * \returns
+       * The column-wise dot-products of \p x and \p y.
+       */
+      template<typename LV_ = LocalVector_>
+      typename LV_::ValueType dot_blocked(const LV_& x, const LV_& y) const
+      {
+        RegionTimer::Scope region("gate-dot-blocked");
+
+        if(_comm == nullptr || _comm->size() == 1)
+        {
+          return x.dot_blocked(y);
+        }
+        else if(_ranks.empty())
+        {
+          return sum(x.dot_blocked(y));
+        }
+        else
+        {
+          return sum(_freqs.triple_dot_blocked(x, y));
+        }
+      }
+
       /**
        * \brief Computes a reduced sum over all processes.
        *
@@ -257,6 +364,8 @@ namespace FEAT
        */
       DataType sum(DataType x) const
       {
+        RegionTimer::Scope region("gate-sum");
+
         return synch_scalar(x, *_comm, Dist::op_sum, false);
       }
 
@@ -265,6 +374,31 @@ namespace FEAT
         return std::make_shared<SynchScalarTicket<DataType>>(x, *_comm, Dist::op_sum, sqrt);
       }
 
+      /**
+       * \brief Computes a reduced sum of a small vector over all processes.
+       *
+       * In contrast to calling sum(DataType) for each component, all components are
+       * reduced by a single allreduce.
+       *
+       * \param[in] x
+       * The vector that is to be summarised over all processes.
+       *
+       * \returns
+       * The reduced sum of all \p x.
+       */
+      template<int n_>
+      Tiny::Vector<DataType, n_> sum(const Tiny::Vector<DataType, n_>& x) const
+      {
+        RegionTimer::Scope region("gate-sum");
+
+        if(_comm == nullptr || _comm->size() <= 1)
+          return x;
+
+        Tiny::Vector<DataType, n_> r;
+        _comm->allreduce(x.v, r.v, std::size_t(n_), Dist::op_sum);
+        return r;
+      }
+
       /**
        * \brief Computes the minimum of a scalar variable over all processes.
        *
@@ -332,6 +466,8 @@ namespace FEAT
        */
       DataType max_element(const LocalVector_ & x) const
       {
+        RegionTimer::Scope region("gate-max-element");
+
         return synch_scalar(x.max_element(), *_comm, Dist::op_max);
       }
 
@@ -339,6 +475,21 @@ namespace FEAT
       {
         return std::make_shared<SynchScalarTicket<DataType>>(x.max_element(), *_comm, Dist::op_max);
       }
+
+    protected:
+      /// builds the flattened index lists for all vector types which support them
+      void _compile_index(std::true_type)
+      {
+        _index.reset();
+        if(!_ranks.empty())
+          _index = std::make_shared<SynchVectorIndex<DataType>>(_freqs, _mirrors);
+      }
+
+      /// vector types without flattened index lists are packed and unpacked by the mirrors
+      void _compile_index(std::false_type)
+      {
+        _index.reset();
+      }
     }; // class Gate<...>
   } // namespace Global
 } // namespace FEAT
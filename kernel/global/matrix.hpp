@@ -12,10 +12,94 @@
 #include <kernel/global/vector.hpp>
 #include <kernel/global/synch_mat.hpp>
 
+#include <memory>
+
 namespace FEAT
 {
   namespace Global
   {
+    /**
+     * \brief Interface for the local matrix-vector products of a global matrix in another storage format
+     *
+     * An object of a class implementing this interface can be deployed to a Global::Matrix by its
+     * set_apply_format() function; the global matrix then performs the local part of its products with
+     * the standard global vector types by this object instead of its local matrix, while all other
+     * operations keep using the local matrix.
+     *
+     * \tparam LocalVectorL_, LocalVectorR_
+     * The local left and right vector types of the global matrix.
+     */
+    template<typename LocalVectorL_, typename LocalVectorR_>
+    class ApplyFormatBase
+    {
+    public:
+      typedef typename LocalVectorL_::DataType DataType;
+
+      virtual ~ApplyFormatBase()
+      {
+      }
+
+      /// \returns The name of the storage format.
+      virtual String name() const = 0;
+
+      /// \returns The size of the dynamically allocated memory in bytes.
+      virtual std::size_t bytes() const = 0;
+
+      /// computes r <- A*x
+      virtual void apply(LocalVectorL_& r, const LocalVectorR_& x) const = 0;
+
+      /// computes r <- y + alpha*A*x
+      virtual void apply(LocalVectorL_& r, const LocalVectorR_& x, const LocalVectorL_& y, const DataType alpha) const = 0;
+    }; // class ApplyFormatBase
+
+    /**
+     * \brief Local matrix-vector products by a copy of the local matrix in another storage format
+     *
+     * \tparam LocalMatrix_
+     * The type of the copy of the local matrix, e.g. LAFEM::SparseMatrixELL.
+     */
+    template<typename LocalMatrix_, typename LocalVectorL_, typename LocalVectorR_>
+    class ApplyFormat :
+      public ApplyFormatBase<LocalVectorL_, LocalVectorR_>
+    {
+    public:
+      typedef ApplyFormatBase<LocalVectorL_, LocalVectorR_> BaseClass;
+      typedef typename BaseClass::DataType DataType;
+
+    protected:
+      /// the copy of the local matrix
+      LocalMatrix_ _matrix;
+      /// the name of the storage format
+      String _name;
+
+    public:
+      explicit ApplyFormat(LocalMatrix_&& matrix, const String& name) :
+        _matrix(std::move(matrix)),
+        _name(name)
+      {
+      }
+
+      virtual String name() const override
+      {
+        return _name;
+      }
+
+      virtual std::size_t bytes() const override
+      {
+        return _matrix.bytes();
+      }
+
+      virtual void apply(LocalVectorL_& r, const LocalVectorR_& x) const override
+      {
+        _matrix.apply(r, x);
+      }
+
+      virtual void apply(LocalVectorL_& r, const LocalVectorR_& x, const LocalVectorL_& y, const DataType alpha) const override
+      {
+        _matrix.apply(r, x, y, alpha);
+      }
+    }; // class ApplyFormat<...>
+
     /**
      * \brief Global Matrix wrapper class template
      *
@@ -42,6 +126,8 @@ namespace FEAT
       typedef Gate<LocalVectorTypeL, RowMirror_> GateRowType;
       typedef Gate<LocalVectorTypeR, ColMirror_> GateColType;
 
+      typedef ApplyFormatBase<LocalVectorTypeL, LocalVectorTypeR> ApplyFormatType;
+
       /// Our 'base' class type
       template <typename LocalMatrix2_, typename RowMirror2_ = RowMirror_, typename ColMirror2_ = ColMirror_>
       using ContainerType = Matrix<LocalMatrix2_, RowMirror2_, ColMirror2_>;
@@ -60,12 +146,15 @@ namespace FEAT
       GateRowType* _row_gate;
       GateColType* _col_gate;
       LocalMatrix_ _matrix;
+      /// the optional storage format of the local matrix-vector products
+      std::shared_ptr<const ApplyFormatType> _apply_format;
 
     public:
       Matrix() :
         _row_gate(nullptr),
         _col_gate(nullptr),
-        _matrix()
+        _matrix(),
+        _apply_format()
       {
       }
 
@@ -73,7 +162,8 @@ namespace FEAT
       explicit Matrix(GateRowType* row_gate, GateColType* col_gate, Args_&&... args) :
         _row_gate(row_gate),
         _col_gate(col_gate),
-        _matrix(std::forward<Args_>(args)...)
+        _matrix(std::forward<Args_>(args)...),
+        _apply_format()
       {
       }
 
@@ -93,6 +183,29 @@ namespace FEAT
         this->_row_gate = row_gate;
         this->_col_gate = col_gate;
         this->_matrix.convert(other.local());
+        this->_apply_format.reset();
+      }
+
+      /**
+       * \brief Deploys a storage format for the local matrix-vector products
+       *
+       * \param[in] apply_format
+       * An object, which performs the local matrix-vector products of this matrix in another storage
+       * format, or \c nullptr to use the local matrix again.
+       *
+       * \attention
+       * The object has to be redeployed whenever the values of the local matrix are changed;
+       * a convert() resets it.
+       */
+      void set_apply_format(std::shared_ptr<const ApplyFormatType> apply_format)
+      {
+        _apply_format = apply_format;
+      }
+
+      /// \returns The storage format of the local matrix-vector products or \c nullptr, if the local matrix is used.
+      std::shared_ptr<const ApplyFormatType> get_apply_format() const
+      {
+        return _apply_format;
       }
 
       const GateRowType* get_row_gate() const
@@ -178,7 +291,7 @@ namespace FEAT
       /// \brief Returns the total amount of bytes allocated.
       std::size_t bytes() const
       {
-        size_t my_bytes(_matrix.bytes());
+        size_t my_bytes(_matrix.bytes() + (_apply_format ? _apply_format->bytes() : std::size_t(0)));
         const Dist::Comm* comm = (_row_gate != nullptr ? _row_gate->get_comm() : (_col_gate != nullptr ? _col_gate->get_comm() : nullptr));
         if((comm != nullptr) && (comm->size() > 1))
           comm->allreduce(&my_bytes, &my_bytes, std::size_t(1), Dist::op_sum);
@@ -195,14 +308,38 @@ namespace FEAT
       }
 
       void apply(VectorTypeL& r, const VectorTypeR& x) const
+      {
+        _apply_local(r.local(), x.local());
+        r.sync_0();
+      }
+
+      /**
+       * \brief Applies the matrix onto a global multi-vector
+       *
+       * This overload accepts global vectors of other local vector types than VectorTypeL and VectorTypeR,
+       * e.g. multi-vectors, for which the local matrix provides a corresponding apply overload.
+       */
+      template<typename LocalVectorL_, typename LocalVectorR_>
+      void apply(Vector<LocalVectorL_, RowMirror_>& r, const Vector<LocalVectorR_, ColMirror_>& x) const
       {
         _matrix.apply(r.local(), x.local());
         r.sync_0();
       }
 
+      /// \copydoc apply(Vector<LocalVectorL_, RowMirror_>&, const Vector<LocalVectorR_, ColMirror_>&) const
+      template<typename LocalVectorL_, typename LocalVectorR_>
+      void apply(Vector<LocalVectorL_, RowMirror_>& r, const Vector<LocalVectorR_, ColMirror_>& x,
+        const Vector<LocalVectorL_, RowMirror_>& y, const DataType alpha = DataType(1)) const
+      {
+        r.copy(y);
+        r.from_1_to_0();
+        _matrix.apply(r.local(), x.local(), r.local(), alpha);
+        r.sync_0();
+      }
+
       auto apply_async(VectorTypeL& r, const VectorTypeR& x) const -> decltype(r.sync_0_async())
       {
-        _matrix.apply(r.local(), x.local());
+        _apply_local(r.local(), x.local());
         return r.sync_0_async();
       }
 
@@ -215,7 +352,7 @@ namespace FEAT
         r.from_1_to_0();
 
         // r <- r + alpha*A*x
-        _matrix.apply(r.local(), x.local(), r.local(), alpha);
+        _apply_local(r.local(), x.local(), r.local(), alpha);
 
         // synchronise r
         r.sync_0();
@@ -230,7 +367,7 @@ namespace FEAT
         r.from_1_to_0();
 
         // r <- r + alpha*A*x
-        _matrix.apply(r.local(), x.local(), r.local(), alpha);
+        _apply_local(r.local(), x.local(), r.local(), alpha);
 
         // synchronise r
         r.sync_0_async();
@@ -287,22 +424,42 @@ namespace FEAT
         return locmat;
       }
 
-      /// \copydoc FEAT::Control::Checkpointable::get_checkpoint_size()
-      uint64_t get_checkpoint_size()
+      /// \copydoc FEAT::Control::Checkpointable::get_checkpoint_size(const LAFEM::SerialConfig&)
+      uint64_t get_checkpoint_size(const LAFEM::SerialConfig& config)
       {
-        return _matrix.get_checkpoint_size();
+        return _matrix.get_checkpoint_size(config);
       }
 
       /// \copydoc FEAT::Control::Checkpointable::restore_from_checkpoint_data(std::vector<char>&)
       void restore_from_checkpoint_data(std::vector<char>& data)
       {
         _matrix.restore_from_checkpoint_data(data);
+        _apply_format.reset();
+      }
+
+      /// \copydoc FEAT::Control::Checkpointable::set_checkpoint_data(std::vector<char>&,const LAFEM::SerialConfig&)
+      uint64_t set_checkpoint_data(std::vector<char>& data, const LAFEM::SerialConfig& config)
+      {
+        return _matrix.set_checkpoint_data(data, config);
+      }
+
+    protected:
+      /// computes the local product r <- A*x by the deployed storage format or the local matrix
+      void _apply_local(LocalVectorTypeL& r, const LocalVectorTypeR& x) const
+      {
+        if(_apply_format)
+          _apply_format->apply(r, x);
+        else
+          _matrix.apply(r, x);
       }
 
-      /// \copydoc FEAT::Control::Checkpointable::set_checkpoint_data(std::vector<char>&)
-      void set_checkpoint_data(std::vector<char>& data)
+      /// computes the local product r <- y + alpha*A*x by the deployed storage format or the local matrix
+      void _apply_local(LocalVectorTypeL& r, const LocalVectorTypeR& x, const LocalVectorTypeL& y, const DataType alpha) const
       {
-        _matrix.set_checkpoint_data(data);
+        if(_apply_format)
+          _apply_format->apply(r, x, y, alpha);
+        else
+          _matrix.apply(r, x, y, alpha);
       }
     };
   } // namespace Global
@@ -10,6 +10,7 @@
 #include <kernel/base_header.hpp>
 #include <kernel/util/assertion.hpp>
 #include <kernel/util/dist.hpp>
+#include <kernel/util/region_timer.hpp>
 #include <kernel/lafem/dense_vector.hpp>
 
 #include <vector>
@@ -263,6 +264,8 @@ namespace FEAT
        */
       void join_send(const LocalVector_& vec_src) const
       {
+        RegionTimer::Scope region("muxer-join");
+
         XASSERT(_sibling_comm != nullptr);
         XASSERT(_sibling_comm->size() > 1);
         XASSERT(_sibling_comm->rank() != _parent_rank); // parent must call join() instead
@@ -299,6 +302,8 @@ namespace FEAT
        */
       void join(const LocalVector_& vec_src, LocalVector_& vec_trg) const
       {
+        RegionTimer::Scope region("muxer-join");
+
         // if this muxer is not a child, then this operation is a simple copy
         if((_sibling_comm == nullptr) || (_sibling_comm->size() <= 1))
         {
@@ -360,6 +365,8 @@ namespace FEAT
        */
       void split_recv(LocalVector_& vec_trg) const
       {
+        RegionTimer::Scope region("muxer-split");
+
         XASSERT(_sibling_comm != nullptr);
         XASSERT(_sibling_comm->size() > 1);
         XASSERT(_sibling_comm->rank() != _parent_rank); // parent must call split() instead
@@ -396,6 +403,8 @@ namespace FEAT
        */
       void split(LocalVector_& vec_trg, const LocalVector_& vec_src) const
       {
+        RegionTimer::Scope region("muxer-split");
+
         // if this muxer is not a child, then this operation is a simple copy
         if((_sibling_comm == nullptr) || (_sibling_comm->size() <= 1))
         {
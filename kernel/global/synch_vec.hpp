@@ -12,14 +12,433 @@
 #include <kernel/util/time_stamp.hpp>
 #include <kernel/util/statistics.hpp>
 #include <kernel/lafem/dense_vector.hpp>
+#include <kernel/lafem/dense_vector_blocked.hpp>
+#include <kernel/lafem/power_vector.hpp>
+#include <kernel/lafem/tuple_vector.hpp>
+#include <kernel/lafem/vector_mirror.hpp>
+#include <kernel/lafem/power_mirror.hpp>
+#include <kernel/lafem/tuple_mirror.hpp>
+
+#include <cstring>
+#include <type_traits>
+#include <vector>
 
 namespace FEAT
 {
   namespace Global
   {
+    /// \cond internal
+    namespace Intern
+    {
+      /**
+       * \brief Helper class for the flattened index lists of vector synchronisation
+       *
+       * This helper enumerates the contiguous main memory arrays (leaves) of a vector and the
+       * positions of the entries gathered by a mirror within these leaves. The primary template
+       * is used for all vector/mirror combinations, which do not support flattened index lists.
+       */
+      template<typename Vector_, typename Mirror_>
+      struct SynchVectorFlat
+      {
+        static constexpr bool supported = false;
+
+        template<typename DT_>
+        static void leaves(Vector_&, std::vector<DT_*>&)
+        {
+        }
+
+        static void indices(const Mirror_&, const Vector_&, Index&, std::vector<Index>&, std::vector<Index>&)
+        {
+        }
+      };
+
+      template<typename DT_, typename IT_>
+      struct SynchVectorFlat<LAFEM::DenseVector<Mem::Main, DT_, IT_>, LAFEM::VectorMirror<Mem::Main, DT_, IT_>>
+      {
+        static constexpr bool supported = true;
+
+        static void leaves(LAFEM::DenseVector<Mem::Main, DT_, IT_>& vector, std::vector<DT_*>& lvs)
+        {
+          lvs.push_back(vector.elements());
+        }
+
+        static void indices(const LAFEM::VectorMirror<Mem::Main, DT_, IT_>& mirror, const LAFEM::DenseVector<Mem::Main, DT_, IT_>& vector,
+          Index& leaf, std::vector<Index>& leaf_idx, std::vector<Index>& elem_idx)
+        {
+          XASSERTM(mirror.size() == vector.size(), "size mismatch between mirror and vector");
+          const IT_* idx = mirror.indices();
+          for(Index i(0); i < mirror.num_indices(); ++i)
+          {
+            leaf_idx.push_back(leaf);
+            elem_idx.push_back(Index(idx[i]));
+          }
+          ++leaf;
+        }
+      };
+
+      template<typename DT_, typename IT_, int bs_>
+      struct SynchVectorFlat<LAFEM::DenseVectorBlocked<Mem::Main, DT_, IT_, bs_>, LAFEM::VectorMirror<Mem::Main, DT_, IT_>>
+      {
+        static constexpr bool supported = true;
+
+        static void leaves(LAFEM::DenseVectorBlocked<Mem::Main, DT_, IT_, bs_>& vector, std::vector<DT_*>& lvs)
+        {
+          lvs.push_back(vector.template elements<LAFEM::Perspective::pod>());
+        }
+
+        static void indices(const LAFEM::VectorMirror<Mem::Main, DT_, IT_>& mirror, const LAFEM::DenseVectorBlocked<Mem::Main, DT_, IT_, bs_>& vector,
+          Index& leaf, std::vector<Index>& leaf_idx, std::vector<Index>& elem_idx)
+        {
+          XASSERTM(mirror.size() == vector.size(), "size mismatch between mirror and vector");
+          const IT_* idx = mirror.indices();
+          for(Index i(0); i < mirror.num_indices(); ++i)
+          {
+            for(Index k(0); k < Index(bs_); ++k)
+            {
+              leaf_idx.push_back(leaf);
+              elem_idx.push_back(Index(idx[i])*Index(bs_) + k);
+            }
+          }
+          ++leaf;
+        }
+      };
+
+      template<typename SubVector_, typename SubMirror_, int count_>
+      struct SynchVectorFlat<LAFEM::PowerVector<SubVector_, count_>, LAFEM::PowerMirror<SubMirror_, count_>>
+      {
+        typedef SynchVectorFlat<SubVector_, SubMirror_> SubFlat;
+        static constexpr bool supported = SubFlat::supported;
+
+        template<typename DT_>
+        static void leaves(LAFEM::PowerVector<SubVector_, count_>& vector, std::vector<DT_*>& lvs)
+        {
+          for(int i(0); i < count_; ++i)
+            SubFlat::leaves(vector.get(i), lvs);
+        }
+
+        static void indices(const LAFEM::PowerMirror<SubMirror_, count_>& mirror, const LAFEM::PowerVector<SubVector_, count_>& vector,
+          Index& leaf, std::vector<Index>& leaf_idx, std::vector<Index>& elem_idx)
+        {
+          for(int i(0); i < count_; ++i)
+            SubFlat::indices(mirror.get(i), vector.get(i), leaf, leaf_idx, elem_idx);
+        }
+      };
+
+      template<typename First_, typename FirstMirror_>
+      struct SynchVectorFlat<LAFEM::TupleVector<First_>, LAFEM::TupleMirror<FirstMirror_>>
+      {
+        typedef SynchVectorFlat<First_, FirstMirror_> FirstFlat;
+        static constexpr bool supported = FirstFlat::supported;
+
+        template<typename DT_>
+        static void leaves(LAFEM::TupleVector<First_>& vector, std::vector<DT_*>& lvs)
+        {
+          FirstFlat::leaves(vector.first(), lvs);
+        }
+
+        static void indices(const LAFEM::TupleMirror<FirstMirror_>& mirror, const LAFEM::TupleVector<First_>& vector,
+          Index& leaf, std::vector<Index>& leaf_idx, std::vector<Index>& elem_idx)
+        {
+          FirstFlat::indices(mirror.first(), vector.first(), leaf, leaf_idx, elem_idx);
+        }
+      };
+
+      template<typename First_, typename Second_, typename... Rest_, typename FirstMirror_, typename SecondMirror_, typename... RestMirror_>
+      struct SynchVectorFlat<LAFEM::TupleVector<First_, Second_, Rest_...>, LAFEM::TupleMirror<FirstMirror_, SecondMirror_, RestMirror_...>>
+      {
+        typedef SynchVectorFlat<First_, FirstMirror_> FirstFlat;
+        typedef SynchVectorFlat<LAFEM::TupleVector<Second_, Rest_...>, LAFEM::TupleMirror<SecondMirror_, RestMirror_...>> RestFlat;
+        static constexpr bool supported = FirstFlat::supported && RestFlat::supported;
+
+        template<typename DT_>
+        static void leaves(LAFEM::TupleVector<First_, Second_, Rest_...>& vector, std::vector<DT_*>& lvs)
+        {
+          FirstFlat::leaves(vector.first(), lvs);
+          RestFlat::leaves(vector.rest(), lvs);
+        }
+
+        static void indices(const LAFEM::TupleMirror<FirstMirror_, SecondMirror_, RestMirror_...>& mirror,
+          const LAFEM::TupleVector<First_, Second_, Rest_...>& vector,
+          Index& leaf, std::vector<Index>& leaf_idx, std::vector<Index>& elem_idx)
+        {
+          FirstFlat::indices(mirror.first(), vector.first(), leaf, leaf_idx, elem_idx);
+          RestFlat::indices(mirror.rest(), vector.rest(), leaf, leaf_idx, elem_idx);
+        }
+      };
+    } // namespace Intern
+    /// \endcond
+
+    /**
+     * \brief Flattened pack and unpack index lists for vector synchronisation
+     *
+     * This class stores the position of each entry of the contiguous send and receive buffer of
+     * all neighbours within the local vector, so that the SynchVectorTicket can pack and unpack
+     * the buffers by a single loop over the buffer instead of calling the (possibly nested)
+     * gather and scatter functions of all mirrors. As the entries of PowerVector and TupleVector
+     * containers are not contiguous, each position is given by the index of the main memory
+     * array (leaf) of the DenseVector or DenseVectorBlocked it belongs to and the index within
+     * that leaf; the leaves are enumerated in the order of the gather functions of the mirrors.
+     *
+     * The pack loop over all buffer entries and the unpack loop over the buffer entries of one
+     * neighbour are parallelised by OpenMP if available, where the latter is free of write
+     * conflicts, because the indices of a single mirror are unique.
+     */
+    template<typename DT_>
+    class SynchVectorIndex
+    {
+    public:
+      /// the number of leaves of the local vector
+      Index num_leaves;
+      /// the leaf index of each buffer entry
+      std::vector<Index> leaf_idx;
+      /// the index of each buffer entry within its leaf
+      std::vector<Index> elem_idx;
+
+      /**
+       * \brief Constructor
+       *
+       * \param[in] vector
+       * A vector with the layout of the vectors to be synchronised.
+       *
+       * \param[in] mirrors
+       * The vector mirrors of all neighbours.
+       */
+      template<typename VT_, typename VMT_>
+      explicit SynchVectorIndex(const VT_& vector, const std::vector<VMT_>& mirrors) :
+        num_leaves(0)
+      {
+        static_assert(Intern::SynchVectorFlat<VT_, VMT_>::supported, "flattened index lists are not supported for this vector type");
+        for(const auto& mir : mirrors)
+        {
+          Index leaf(0);
+          Intern::SynchVectorFlat<VT_, VMT_>::indices(mir, vector, leaf, leaf_idx, elem_idx);
+          num_leaves = leaf;
+        }
+      }
+
+      /**
+       * \brief Gathers a range of buffer entries from the leaves of a vector
+       *
+       * \param[out] buf
+       * The buffer whose entries [first, last) are to be gathered.
+       *
+       * \param[in] leaves
+       * The leaves of the vector.
+       *
+       * \param[in] first, last
+       * The range of buffer entries to be gathered.
+       */
+      void gather(DT_* buf, DT_* const* leaves, const Index first, const Index last) const
+      {
+        const long n0 = long(first), n1 = long(last);
+#ifdef _OPENMP
+#pragma omp parallel for if(last - first > LAFEM::Arch::Mirror<Mem::Main>::min_omp_size)
+#endif
+        for(long i = n0; i < n1; ++i)
+          buf[i] = leaves[leaf_idx[std::size_t(i)]][elem_idx[std::size_t(i)]];
+      }
+
+      /**
+       * \brief Adds a range of buffer entries onto the leaves of a vector
+       *
+       * \attention
+       * The range must not contain the entries of more than one neighbour, because the
+       * buffers of different neighbours may refer to the same vector entries.
+       *
+       * \param[inout] leaves
+       * The leaves of the vector.
+       *
+       * \param[in] buf
+       * The buffer whose entries [first, last) are to be scattered.
+       *
+       * \param[in] first, last
+       * The range of buffer entries to be scattered.
+       */
+      void scatter_axpy(DT_* const* leaves, const DT_* buf, const Index first, const Index last) const
+      {
+        const long n0 = long(first), n1 = long(last);
+#ifdef _OPENMP
+#pragma omp parallel for if(last - first > LAFEM::Arch::Mirror<Mem::Main>::min_omp_size)
+#endif
+        for(long i = n0; i < n1; ++i)
+          leaves[leaf_idx[std::size_t(i)]][elem_idx[std::size_t(i)]] += buf[i];
+      }
+    }; // class SynchVectorIndex
+
+    /**
+     * \brief Shared-memory exchange data for vector synchronisation
+     *
+     * This class stores all the information required by the SynchVectorTicket to exchange the
+     * buffers of all neighbours that run on the same shared-memory node by direct copies from
+     * a shared memory window instead of MPI messages:
+     * - the node-local communicator and the rank of each neighbour within it
+     * - a shared window, whose segment of this process contains the send buffers of all
+     *   on-node neighbours
+     * - the pointers to the send buffers of all on-node neighbours that are meant for us
+     *
+     * The exchange is synchronised by small signal messages: each process sends a \e ready
+     * signal to its on-node neighbours once its send buffers have been written, and each
+     * neighbour sends a \e done signal once it has copied its buffer, so that the window
+     * can be reused by the next exchange.
+     *
+     * \note
+     * The constructor and the destructor of this class are collective operations on the
+     * communicator that was passed to the constructor.
+     *
+     * \note
+     * Only one ticket can use the shared window at a time; if another ticket is created while
+     * the window is in use, it falls back to MPI messages for all neighbours. As all processes
+     * create their tickets in the same order, all neighbours agree on the mode of each exchange.
+     */
+    template<typename DT_>
+    class SynchVectorShared
+    {
+    public:
+      /// message tag for the buffer offset exchange
+      static constexpr int tag_setup = 0x5301;
+      /// message tag for the ready signals
+      static constexpr int tag_ready = 0x5302;
+      /// message tag for the done signals
+      static constexpr int tag_done = 0x5303;
+
+      /// the node-local communicator
+      Dist::Comm node_comm;
+      /// the shared window containing our send buffers for all on-node neighbours
+      Dist::SharedWindow window;
+      /// the rank of each neighbour within the node communicator or -1, if it is not on our node
+      std::vector<int> node_ranks;
+      /// the buffer size of each neighbour
+      std::vector<Index> buf_sizes;
+      /// the offset of the send buffer of each on-node neighbour within our window segment
+      std::vector<Index> local_offs;
+      /// the pointer to our receive buffer within the window segment of each on-node neighbour
+      std::vector<const DT_*> remote_ptrs;
+      /// specifies whether the window is currently used by a ticket
+      bool busy;
+
+      /**
+       * \brief Constructor
+       *
+       * \param[in] comm
+       * The communicator of the neighbour ranks.
+       *
+       * \param[in] ranks
+       * The neighbour ranks within the communicator.
+       *
+       * \param[in] sizes
+       * The buffer sizes of all neighbours.
+       */
+      explicit SynchVectorShared(const Dist::Comm& comm, const std::vector<int>& ranks, const std::vector<Index>& sizes) :
+        node_comm(comm.comm_split_shared(comm.rank())),
+        window(),
+        node_ranks(ranks.size(), -1),
+        buf_sizes(sizes),
+        local_offs(ranks.size(), Index(0)),
+        remote_ptrs(ranks.size(), nullptr),
+        busy(false)
+      {
+        const std::size_t n = ranks.size();
+        XASSERTM(sizes.size() == n, "invalid buffer size count");
+
+        // gather the ranks of all processes on our node
+        const int my_rank = comm.rank();
+        std::vector<int> comm_ranks(std::size_t(node_comm.size()));
+        node_comm.allgather(&my_rank, std::size_t(1), comm_ranks.data(), std::size_t(1));
+
+        // determine the on-node neighbours and compute our window layout
+        Index total(0);
+        for(std::size_t i(0); i < n; ++i)
+        {
+          for(std::size_t j(0); j < comm_ranks.size(); ++j)
+          {
+            if(comm_ranks[j] == ranks[i])
+              node_ranks[i] = int(j);
+          }
+          if(node_ranks[i] >= 0)
+          {
+            local_offs[i] = total;
+            total += sizes[i];
+          }
+        }
+
+        // allocate the shared window
+        window = Dist::SharedWindow(node_comm, std::size_t(total) * sizeof(DT_));
+
+        // exchange the buffer offsets with all on-node neighbours
+        std::vector<Index> remote_offs(n, Index(0));
+        Dist::RequestVector recv_reqs, send_reqs;
+        for(std::size_t i(0); i < n; ++i)
+        {
+          if(node_ranks[i] >= 0)
+            recv_reqs.push_back(comm.irecv(&remote_offs[i], std::size_t(1), ranks[i], tag_setup));
+        }
+        for(std::size_t i(0); i < n; ++i)
+        {
+          if(node_ranks[i] >= 0)
+            send_reqs.push_back(comm.isend(&local_offs[i], std::size_t(1), ranks[i], tag_setup));
+        }
+        recv_reqs.wait_all();
+        send_reqs.wait_all();
+
+        // query the window segments of all on-node neighbours
+        for(std::size_t i(0); i < n; ++i)
+        {
+          if(node_ranks[i] < 0)
+            continue;
+          std::size_t bytes(0u);
+          const DT_* seg = static_cast<const DT_*>(window.query(node_ranks[i], bytes));
+          XASSERTM(std::size_t(remote_offs[i] + sizes[i]) * sizeof(DT_) <= bytes, "invalid shared window segment");
+          remote_ptrs[i] = seg + remote_offs[i];
+        }
+      }
+
+      /// no copies
+      SynchVectorShared(const SynchVectorShared&) = delete;
+      /// no copies
+      SynchVectorShared& operator=(const SynchVectorShared&) = delete;
+
+      /// \returns \c true, if the i-th neighbour is on our node, otherwise \c false.
+      bool is_on_node(std::size_t i) const
+      {
+        return node_ranks[i] >= 0;
+      }
+
+      /// \returns The number of neighbours on our node.
+      std::size_t num_on_node() const
+      {
+        std::size_t k(0u);
+        for(const int r : node_ranks)
+          k += (r >= 0 ? 1u : 0u);
+        return k;
+      }
+
+      /// \returns A pointer to our send buffer for the i-th neighbour within our window segment.
+      DT_* local_buffer(std::size_t i) const
+      {
+        return static_cast<DT_*>(window.local()) + local_offs[i];
+      }
+    }; // class SynchVectorShared
+
     /**
      * \brief Ticket class for asynchronous global operations on vectors
      *
+     * The send and receive buffers of all neighbours are stored contiguously in one single send
+     * and receive buffer vector each, where the buffer of the i-th neighbour starts at the
+     * i-th entry of the buffer offset array. If the vector resides in main memory, the buffers
+     * are packed and unpacked directly from the send and receive buffers by the flattened index
+     * lists of a SynchVectorIndex object, if one is passed to the constructor, or by the gather
+     * and scatter functions of the mirrors otherwise.
+     *
+     * If a SynchVectorShared object is passed to the constructor, the buffers of all neighbours
+     * on the same shared-memory node are exchanged via its shared window, i.e. they are copied
+     * directly from the window segment of the neighbour into our receive buffer, whereas the
+     * buffers of all other neighbours are still exchanged via MPI messages.
+     *
+     * If a communicator with a distributed graph topology, whose sources and destinations coincide
+     * with the neighbour ranks, is passed to the constructor and the shared window is not used,
+     * the buffers of all neighbours are exchanged by a single neighbourhood collective, which
+     * allows the MPI library to optimise the message schedule.
+     *
      * \todo statistics
      *
      * \author Dirk Ribbrock, Peter Zajac
@@ -47,8 +466,84 @@ namespace FEAT
       const std::vector<VMT_>& _mirrors;
       /// send and receive request vectors
       Dist::RequestVector _send_reqs, _recv_reqs;
-      /// send and receive buffers
-      std::vector<BufferMain> _send_bufs, _recv_bufs;
+      /// buffer offsets of all neighbours within the send and receive buffers
+      std::vector<Index> _buf_offs;
+      /// contiguous send and receive buffers for all neighbours
+      BufferMain _send_buf, _recv_buf;
+      /// the shared-memory exchange data or nullptr, if all neighbours are served via MPI
+      SynchVectorShared<typename VT_::DataType>* _shared;
+      /// the neighbour ranks
+      const std::vector<int>& _ranks;
+      /// receive requests for the done signals of all on-node neighbours
+      Dist::RequestVector _done_reqs;
+      /// receive buffers for the ready and done signals of all neighbours
+      std::vector<int> _sig_recv;
+      /// send buffer for the signals
+      int _sig_send;
+      /// the distributed graph communicator or nullptr, if the neighbours are served by point-to-point messages
+      const Dist::Comm* _graph_comm;
+      /// buffer sizes and offsets of all neighbours for the neighbourhood collective
+      std::vector<int> _graph_counts, _graph_displs;
+      /// the flattened index lists or nullptr, if the mirrors are used for packing and unpacking
+      const SynchVectorIndex<typename VT_::DataType>* _index;
+      /// the leaves of the target vector for the flattened index lists
+      std::vector<typename VT_::DataType*> _leaves;
+
+      /// checks whether the i-th neighbour is exchanged via the shared window
+      bool _on_node(std::size_t i) const
+      {
+        return (_shared != nullptr) && _shared->is_on_node(i);
+      }
+
+      /// copies the buffer of an on-node neighbour from its window segment and signals that we are done
+      void _copy_shared(std::size_t i)
+      {
+        _shared->window.sync();
+        const std::size_t len = std::size_t(_buf_offs[i+1] - _buf_offs[i]);
+        if(len > std::size_t(0))
+          std::memcpy(_recv_buf.elements() + _buf_offs[i], _shared->remote_ptrs[i], len * sizeof(typename VT_::DataType));
+        _send_reqs.push_back(_comm.isend(&_sig_send, std::size_t(1), _ranks.at(i), _shared->tag_done));
+      }
+
+      /// gathers the send buffers of all neighbours directly into the main memory send buffer
+      void _gather_all(std::true_type)
+      {
+        if(_index != nullptr)
+          _index->gather(_send_buf.elements(), _leaves.data(), Index(0), _buf_offs.back());
+        else
+        {
+          for(std::size_t i(0); i < _mirrors.size(); ++i)
+            _mirrors[i].gather(_send_buf, _target, _buf_offs[i]);
+        }
+      }
+
+      /// gathers the send buffers of all neighbours in device memory and copies them to main memory
+      void _gather_all(std::false_type)
+      {
+        BufferType buffer(_send_buf.size(), LAFEM::Pinning::disabled);
+        for(std::size_t i(0); i < _mirrors.size(); ++i)
+          _mirrors[i].gather(buffer, _target, _buf_offs[i]);
+        _send_buf.copy(buffer);
+      }
+
+      /// scatters the receive buffer of a single neighbour directly from the main memory receive buffer
+      void _scatter(std::size_t i, std::true_type)
+      {
+        if(_index != nullptr)
+          _index->scatter_axpy(_leaves.data(), _recv_buf.elements(), _buf_offs[i], _buf_offs[i+1]);
+        else
+          _mirrors[i].scatter_axpy(_target, _recv_buf, typename VT_::DataType(1), _buf_offs[i]);
+      }
+
+      /// copies the receive buffer of a single neighbour to device memory and scatters it
+      void _scatter(std::size_t i, std::false_type)
+      {
+        if(_buf_offs[i+1] == _buf_offs[i])
+          return;
+        BufferType buffer;
+        buffer.convert(BufferMain(_recv_buf, _buf_offs[i+1] - _buf_offs[i], _buf_offs[i]));
+        _mirrors[i].scatter_axpy(_target, buffer);
+      }
 #endif // FEAT_HAVE_MPI || DOXYGEN
 
     public:
@@ -66,53 +561,141 @@ namespace FEAT
        *
        * \param[in] mirrors
        * The vector mirrors to be used for synchronisation
+       *
+       * \param[in] shared
+       * The shared-memory exchange data for the neighbours or \c nullptr, if all buffers are
+       * to be exchanged via MPI messages.
+       *
+       * \param[in] graph_comm
+       * A communicator with a distributed graph topology, whose sources and destinations are
+       * given by \p ranks, or \c nullptr, if point-to-point messages are to be used.
+       *
+       * \param[in] index
+       * The flattened index lists of the mirrors or \c nullptr, if the buffers are to be packed
+       * and unpacked by the mirrors.
        */
 #if defined(FEAT_HAVE_MPI) || defined(DOXYGEN)
-      SynchVectorTicket(VT_ & target, const Dist::Comm& comm, const std::vector<int>& ranks, const std::vector<VMT_> & mirrors) :
+      SynchVectorTicket(VT_ & target, const Dist::Comm& comm, const std::vector<int>& ranks, const std::vector<VMT_> & mirrors,
+        SynchVectorShared<typename VT_::DataType>* shared = nullptr, const Dist::Comm* graph_comm = nullptr,
+        const SynchVectorIndex<typename VT_::DataType>* index = nullptr) :
         _finished(false),
         _target(target),
         _comm(comm),
-        _mirrors(mirrors)
+        _mirrors(mirrors),
+        _shared(nullptr),
+        _ranks(ranks),
+        _sig_recv(2u*ranks.size(), 0),
+        _sig_send(1),
+        _graph_comm(nullptr),
+        _index(nullptr)
       {
         TimeStamp ts_start;
         const std::size_t n = ranks.size();
 
         XASSERTM(mirrors.size() == n, "invalid vector mirror count");
 
-        // post receives
-        _recv_reqs.reserve(n);
-        _recv_bufs.resize(n);
+        // compute buffer offsets
+        _buf_offs.resize(n + 1u);
+        _buf_offs[0] = Index(0);
         for(std::size_t i(0); i < n; ++i)
+          _buf_offs[i+1] = _buf_offs[i] + _mirrors.at(i).buffer_size(target);
+
+        // allocate contiguous buffers in main memory; we need at least one entry for a valid allocation
+        _recv_buf = BufferMain(Math::max(_buf_offs.back(), Index(1)), LAFEM::Pinning::disabled);
+        _send_buf = BufferMain(Math::max(_buf_offs.back(), Index(1)), LAFEM::Pinning::disabled);
+
+        // query the leaves of the target vector for the flattened index lists
+        if(index != nullptr)
         {
-          // create buffer vector in main memory
-          _recv_bufs.at(i) = BufferMain(_mirrors.at(i).buffer_size(target), LAFEM::Pinning::disabled);
+          XASSERTM(Index(index->leaf_idx.size()) == _buf_offs.back(), "invalid flattened index lists");
+          Intern::SynchVectorFlat<VT_, VMT_>::leaves(target, _leaves);
+          XASSERTM(Index(_leaves.size()) == index->num_leaves, "invalid flattened index lists");
+          _index = index;
+        }
+
+        // use the shared window unless it is in use by another ticket
+        if((shared != nullptr) && !shared->busy)
+        {
+          XASSERTM(shared->buf_sizes.size() == n, "invalid shared exchange data");
+          for(std::size_t i(0); i < n; ++i)
+          {
+            XASSERTM(shared->buf_sizes[i] == _buf_offs[i+1] - _buf_offs[i], "invalid shared buffer size");
+          }
+          _shared = shared;
+          _shared->busy = true;
+        }
+        else if(graph_comm != nullptr)
+        {
+          // exchange all buffers by a single neighbourhood collective
+          _graph_comm = graph_comm;
+          _graph_counts.resize(n);
+          _graph_displs.resize(n);
+          for(std::size_t i(0); i < n; ++i)
+          {
+            _graph_counts[i] = int(_buf_offs[i+1] - _buf_offs[i]);
+            _graph_displs[i] = int(_buf_offs[i]);
+          }
+
+          _gather_all(std::is_same<BufferType, BufferMain>());
 
-          // post receive
-          _recv_reqs.push_back(_comm.irecv(_recv_bufs.at(i).elements(), _recv_bufs.at(i).size(), ranks.at(i)));
+          _recv_reqs.push_back(_graph_comm->ineighbor_alltoallv(_send_buf.elements(), _graph_counts.data(),
+            _graph_displs.data(), _recv_buf.elements(), _graph_counts.data(), _graph_displs.data()));
+
+          Statistics::add_time_mpi_execute_blas2(ts_start.elapsed_now());
+          return;
         }
 
-        // post sends
-        _send_reqs.reserve(n);
-        _send_bufs.resize(n);
+        // post receives; on-node neighbours only send a ready signal
+        _recv_reqs.reserve(n);
         for(std::size_t i(0); i < n; ++i)
         {
-          // create buffer in device memory
-          BufferType buffer(_mirrors.at(i).buffer_size(target), LAFEM::Pinning::disabled);
+          if(_on_node(i))
+            _recv_reqs.push_back(_comm.irecv(&_sig_recv[i], std::size_t(1), ranks.at(i), _shared->tag_ready));
+          else
+            _recv_reqs.push_back(_comm.irecv(_recv_buf.elements() + _buf_offs[i], _buf_offs[i+1] - _buf_offs[i], ranks.at(i)));
+        }
 
-          // gather from mirror
-          _mirrors.at(i).gather(buffer, _target);
+        // post receives for the done signals of the on-node neighbours
+        if(_shared != nullptr)
+        {
+          for(std::size_t i(0); i < n; ++i)
+          {
+            if(_on_node(i))
+              _done_reqs.push_back(_comm.irecv(&_sig_recv[n+i], std::size_t(1), ranks.at(i), _shared->tag_done));
+          }
+        }
 
-          // convert buffer to main memory
-          _send_bufs.at(i).convert(buffer);
+        // gather all send buffers
+        _gather_all(std::is_same<BufferType, BufferMain>());
 
-          // post send
-          _send_reqs.push_back(_comm.isend(_send_bufs.at(i).elements(), _send_bufs.at(i).size(), ranks.at(i)));
+        // copy the send buffers of the on-node neighbours into our window segment
+        if(_shared != nullptr)
+        {
+          for(std::size_t i(0); i < n; ++i)
+          {
+            const std::size_t len = std::size_t(_buf_offs[i+1] - _buf_offs[i]);
+            if(_on_node(i) && (len > std::size_t(0)))
+              std::memcpy(_shared->local_buffer(i), _send_buf.elements() + _buf_offs[i], len * sizeof(typename VT_::DataType));
+          }
+          _shared->window.sync();
+        }
+
+        // post sends; on-node neighbours only receive a ready signal
+        _send_reqs.reserve(2u*n);
+        for(std::size_t i(0); i < n; ++i)
+        {
+          if(_on_node(i))
+            _send_reqs.push_back(_comm.isend(&_sig_send, std::size_t(1), ranks.at(i), _shared->tag_ready));
+          else
+            _send_reqs.push_back(_comm.isend(_send_buf.elements() + _buf_offs[i], _buf_offs[i+1] - _buf_offs[i], ranks.at(i)));
         }
 
         Statistics::add_time_mpi_execute_blas2(ts_start.elapsed_now());
       }
 #else // non-MPI version
-      SynchVectorTicket(VT_ &, const Dist::Comm&, const std::vector<int>& ranks, const std::vector<VMT_> &) :
+      SynchVectorTicket(VT_ &, const Dist::Comm&, const std::vector<int>& ranks, const std::vector<VMT_> &,
+        SynchVectorShared<typename VT_::DataType>* = nullptr, const Dist::Comm* = nullptr,
+        const SynchVectorIndex<typename VT_::DataType>* = nullptr) :
         _finished(false)
       {
         XASSERT(ranks.empty());
@@ -137,15 +720,29 @@ namespace FEAT
         TimeStamp ts_start;
 
         // process all pending receives
-        for(std::size_t idx; _recv_reqs.wait_any(idx); )
+        // Note: the buffers of different neighbours are scattered one after another, because
+        // the mirrors of different neighbours may share the same vector entries
+        if(_graph_comm != nullptr)
         {
-          // convert buffer to device memory
-          BufferType buffer;
-          buffer.convert(_recv_bufs.at(idx));
-
-          // scatter the receive buffer
-          _mirrors.at(idx).scatter_axpy(_target, buffer);
+          // the neighbourhood collective receives all buffers at once
+          _recv_reqs.wait_all();
+          for(std::size_t i(0); i < _mirrors.size(); ++i)
+            _scatter(i, std::is_same<BufferType, BufferMain>());
         }
+        else
+        {
+          for(std::size_t idx; _recv_reqs.wait_any(idx); )
+          {
+            if(_on_node(idx))
+              _copy_shared(idx);
+            _scatter(idx, std::is_same<BufferType, BufferMain>());
+          }
+        }
+
+        // wait until all on-node neighbours have copied their buffers from our window segment
+        _done_reqs.wait_all();
+        if(_shared != nullptr)
+          _shared->busy = false;
 
         // wait for all sends to finish
         _send_reqs.wait_all();
@@ -177,11 +774,22 @@ namespace FEAT
      *
      * \param[in] mirrors
      * The vector mirrors to be used for synchronisation
+     *
+     * \param[in] shared
+     * The shared-memory exchange data for the neighbours or \c nullptr.
+     *
+     * \param[in] graph_comm
+     * The distributed graph communicator of the neighbours or \c nullptr.
+     *
+     * \param[in] index
+     * The flattened index lists of the mirrors or \c nullptr.
      */
     template<typename VT_, typename VMT_>
-    void synch_vector(VT_& target, const Dist::Comm& comm, const std::vector<int>& ranks, const std::vector<VMT_>& mirrors)
+    void synch_vector(VT_& target, const Dist::Comm& comm, const std::vector<int>& ranks, const std::vector<VMT_>& mirrors,
+      SynchVectorShared<typename VT_::DataType>* shared = nullptr, const Dist::Comm* graph_comm = nullptr,
+      const SynchVectorIndex<typename VT_::DataType>* index = nullptr)
     {
-      SynchVectorTicket<VT_, VMT_> ticket(target, comm, ranks, mirrors);
+      SynchVectorTicket<VT_, VMT_> ticket(target, comm, ranks, mirrors, shared, graph_comm, index);
       ticket.wait();
     }
   } // namespace Global
@@ -226,6 +226,36 @@ namespace FEAT
         return _gate->dot_async(_vector, _vector, true);
       }
 
+      /// column-wise axpy for multi-vectors, see LAFEM::DenseVectorBlocked::axpy_blocked
+      template<typename LV_ = LocalVector_>
+      void axpy_blocked(const Vector& x, const Vector& y, const typename LV_::ValueType& alpha)
+      {
+        _vector.axpy_blocked(x.local(), y.local(), alpha);
+      }
+
+      /// column-wise scale for multi-vectors, see LAFEM::DenseVectorBlocked::scale_blocked
+      template<typename LV_ = LocalVector_>
+      void scale_blocked(const Vector& x, const typename LV_::ValueType& alpha)
+      {
+        _vector.scale_blocked(x.local(), alpha);
+      }
+
+      /// column-wise dot-products for multi-vectors, synchronised in a single message
+      template<typename LV_ = LocalVector_>
+      typename LV_::ValueType dot_blocked(const Vector& x) const
+      {
+        if(_gate != nullptr)
+          return _gate->dot_blocked(_vector, x.local());
+        return _vector.dot_blocked(x.local());
+      }
+
+      /// column-wise squared norms for multi-vectors
+      template<typename LV_ = LocalVector_>
+      typename LV_::ValueType norm2sqr_blocked() const
+      {
+        return dot_blocked(*this);
+      }
+
       void component_invert(const Vector& x, const DataType alpha = DataType(1))
       {
         _vector.component_invert(x.local(), alpha);
@@ -248,10 +278,10 @@ namespace FEAT
         return _gate->max_element_async(_vector);
       }
 
-      /// \copydoc FEAT::Control::Checkpointable::get_checkpoint_size()
-      uint64_t get_checkpoint_size()
+      /// \copydoc FEAT::Control::Checkpointable::get_checkpoint_size(const LAFEM::SerialConfig&)
+      uint64_t get_checkpoint_size(const LAFEM::SerialConfig& config)
       {
-        return _vector.get_checkpoint_size();
+        return _vector.get_checkpoint_size(config);
       }
 
       /// \copydoc FEAT::Control::Checkpointable::restore_from_checkpoint_data(std::vector<char>&)
@@ -260,10 +290,10 @@ namespace FEAT
         _vector.restore_from_checkpoint_data(data);
       }
 
-      /// \copydoc FEAT::Control::Checkpointable::set_checkpoint_data(std::vector<char>&)
-      void set_checkpoint_data(std::vector<char>& data)
+      /// \copydoc FEAT::Control::Checkpointable::set_checkpoint_data(std::vector<char>&,const LAFEM::SerialConfig&)
+      uint64_t set_checkpoint_data(std::vector<char>& data, const LAFEM::SerialConfig& config)
       {
-        _vector.set_checkpoint_data(data);
+        return _vector.set_checkpoint_data(data, config);
       }
     };
   } // namespace Global
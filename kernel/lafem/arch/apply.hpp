@@ -12,6 +12,7 @@
 #include <kernel/util/exception.hpp>
 #include <kernel/util/assertion.hpp>
 #include <kernel/archs.hpp>
+#include <kernel/util/region_timer.hpp>
 
 #include <typeinfo>
 
@@ -21,6 +22,77 @@ namespace FEAT
   {
     namespace Arch
     {
+      /// \cond internal
+      namespace Intern
+      {
+        /**
+         * \brief Work estimates of the matrix-vector products for the region timer
+         *
+         * Each function returns the estimated number of bytes transferred and floating point
+         * operations performed by one product of the corresponding matrix format. The pointer
+         * arguments are only used to deduce the vector, matrix and index types.
+         */
+        struct ApplyWork
+        {
+          /// CSR-based formats with bh x bw blocks applied to ncols vectors each
+          template <typename DT_, typename DTM_, typename IT_>
+          static RegionTimer::Work csr(const DT_*, const DTM_*, const IT_*, const Index rows, const Index columns,
+            const Index used_elements, const Index bh = Index(1), const Index bw = Index(1), const Index ncols = Index(1))
+          {
+            return RegionTimer::Work{
+              std::uint64_t(used_elements) * std::uint64_t(bh * bw * sizeof(DTM_) + sizeof(IT_)) + std::uint64_t(rows + 1) * std::uint64_t(sizeof(IT_))
+                + std::uint64_t((columns * bw + 2 * rows * bh) * ncols) * std::uint64_t(sizeof(DT_)),
+              std::uint64_t(2 * used_elements * bh * bw * ncols)};
+          }
+
+          /// delta-compressed CSR format
+          template <typename DT_, typename DIT_, typename IT_>
+          static RegionTimer::Work dcsr(const DT_*, const DIT_*, const IT_*, const Index rows, const Index columns, const Index used_elements)
+          {
+            return RegionTimer::Work{
+              std::uint64_t(used_elements) * std::uint64_t(sizeof(DT_) + sizeof(DIT_)) + std::uint64_t(rows + 1) * std::uint64_t(2 * sizeof(IT_))
+                + std::uint64_t(columns + 2 * rows) * std::uint64_t(sizeof(DT_)),
+              std::uint64_t(2 * used_elements)};
+          }
+
+          /// SELL-C format; the number of stored entries is the last chunk start
+          template <typename DT_, typename IT_>
+          static RegionTimer::Work ell(const DT_*, const IT_*, const IT_ * const cs, const Index C, const Index rows)
+          {
+            const std::uint64_t stored = std::uint64_t(cs[(rows + C - 1) / C]);
+            return RegionTimer::Work{stored * std::uint64_t(sizeof(DT_) + sizeof(IT_)) + std::uint64_t(3 * rows) * std::uint64_t(sizeof(DT_)), 2u * stored};
+          }
+
+          /// coordinate format
+          template <typename DT_, typename IT_>
+          static RegionTimer::Work coo(const DT_*, const IT_*, const Index rows, const Index columns, const Index used_elements)
+          {
+            return RegionTimer::Work{
+              std::uint64_t(used_elements) * std::uint64_t(sizeof(DT_) + 2 * sizeof(IT_)) + std::uint64_t(columns + 2 * rows) * std::uint64_t(sizeof(DT_)),
+              std::uint64_t(2 * used_elements)};
+          }
+
+          /// banded format
+          template <typename DT_>
+          static RegionTimer::Work banded(const DT_*, const Index num_of_offsets, const Index rows, const Index columns)
+          {
+            return RegionTimer::Work{
+              std::uint64_t(num_of_offsets * rows) * std::uint64_t(sizeof(DT_)) + std::uint64_t(columns + 2 * rows) * std::uint64_t(sizeof(DT_)),
+              std::uint64_t(2 * num_of_offsets * rows)};
+          }
+
+          /// dense format
+          template <typename DT_>
+          static RegionTimer::Work dense(const DT_*, const Index rows, const Index columns)
+          {
+            return RegionTimer::Work{
+              std::uint64_t(rows * columns) * std::uint64_t(sizeof(DT_)) + std::uint64_t(columns + 2 * rows) * std::uint64_t(sizeof(DT_)),
+              std::uint64_t(2 * rows * columns)};
+          }
+        }; // struct ApplyWork
+      } // namespace Intern
+      /// \endcond
+
       template <typename Mem_>
       struct Apply;
 
@@ -32,6 +104,7 @@ namespace FEAT
                         const IT_ * const col_ind, const IT_ * const row_ptr, const Index rows, const Index columns,
                         const Index used_elements, const bool transposed)
         {
+          RegionTimer::Scope region("arch-apply-csr", [&]{ return Intern::ApplyWork::csr(r, val, col_ind, rows, columns, used_elements); });
           csr_generic(r, a, x, b, y, val, col_ind, row_ptr, rows, columns, used_elements, transposed);
         }
 
@@ -40,6 +113,7 @@ namespace FEAT
                         const unsigned long * const col_ind, const unsigned long * const row_ptr, const Index rows, const Index columns,
                         const Index used_elements, const bool transposed)
         {
+          RegionTimer::Scope region("arch-apply-csr", [&]{ return Intern::ApplyWork::csr(r, val, col_ind, rows, columns, used_elements); });
           csr_mkl(r, a, x, b, y, val, col_ind, row_ptr, rows, columns, used_elements, transposed);
         }
 
@@ -47,6 +121,7 @@ namespace FEAT
                         const unsigned long * const col_ind, const unsigned long * const row_ptr, const Index rows, const Index columns,
                         const Index used_elements, const bool transposed)
         {
+          RegionTimer::Scope region("arch-apply-csr", [&]{ return Intern::ApplyWork::csr(r, val, col_ind, rows, columns, used_elements); });
           csr_mkl(r, a, x, b, y, val, col_ind, row_ptr, rows, columns, used_elements, transposed);
         }
 #endif
@@ -56,6 +131,7 @@ namespace FEAT
                         const Index * const col_ind, const Index * const row_ptr, const Index rows, const Index columns,
                         const Index used_elements, const bool transposed)
         {
+          RegionTimer::Scope region("arch-apply-csr", [&]{ return Intern::ApplyWork::csr(r, val, col_ind, rows, columns, used_elements); });
           csr_generic(r, a, x, b, y, val, col_ind, row_ptr, rows, columns, used_elements, transposed);
         }
 #endif
@@ -65,14 +141,26 @@ namespace FEAT
                         const IT_ * const col_ind, const IT_ * const row_ptr, const IT_ * const row_numbers, const Index used_rows, const Index rows, const Index columns,
                         const Index used_elements, const bool transposed)
         {
+          RegionTimer::Scope region("arch-apply-cscr", [&]{ return Intern::ApplyWork::csr(r, val, col_ind, rows, columns, used_elements); });
           cscr_generic(r, a, x, b, y, val, col_ind, row_ptr, row_numbers, used_rows, rows, columns, used_elements, transposed);
         }
 
+        template <typename DT_, typename IT_, typename DIT_>
+        static void dcsr(DT_ * r, const DT_ a, const DT_ * const x, const DT_ b, const DT_ * const y, const DT_ * const val,
+                        const DIT_ * const col_delta, const IT_ * const row_base, const IT_ * const row_ptr,
+                        const IT_ * const esc_col, const IT_ * const esc_ptr, const Index rows, const Index columns,
+                        const Index used_elements, const bool transposed)
+        {
+          RegionTimer::Scope region("arch-apply-dcsr", [&]{ return Intern::ApplyWork::dcsr(r, col_delta, row_ptr, rows, columns, used_elements); });
+          dcsr_generic(r, a, x, b, y, val, col_delta, row_base, row_ptr, esc_col, esc_ptr, rows, columns, used_elements, transposed);
+        }
+
         template <typename DT_, typename IT_, int BlockHeight_, int BlockWidth_>
         static void csrb(DT_ * r, const DT_ a, const DT_ * const x, const DT_ b, const DT_ * const y, const DT_ * const val,
                          const IT_ * const col_ind, const IT_ * const row_ptr, const Index rows, const Index columns,
                          const Index used_elements)
         {
+          RegionTimer::Scope region("arch-apply-csrb", [&]{ return Intern::ApplyWork::csr(r, val, col_ind, rows, columns, used_elements, Index(BlockHeight_), Index(BlockWidth_)); });
           csrb_generic<DT_, IT_, BlockHeight_, BlockWidth_>(r, a, x, b, y, val, col_ind, row_ptr, rows, columns, used_elements);
         }
 
@@ -82,6 +170,7 @@ namespace FEAT
                          const unsigned long * const col_ind, const unsigned long * const row_ptr, const Index rows, const Index columns,
                          const Index used_elements)
         {
+          RegionTimer::Scope region("arch-apply-csrb", [&]{ return Intern::ApplyWork::csr(r, val, col_ind, rows, columns, used_elements, Index(BlockHeight_), Index(BlockWidth_)); });
           if (BlockHeight_ == BlockWidth_)
             csrb_mkl(r, a, x, b, y, val, (const unsigned long*)col_ind, (const unsigned long*)row_ptr, rows, columns, used_elements, BlockHeight_);
           else
@@ -93,6 +182,7 @@ namespace FEAT
                          const unsigned long * const col_ind, const unsigned long * const row_ptr, const Index rows, const Index columns,
                          const Index used_elements)
         {
+          RegionTimer::Scope region("arch-apply-csrb", [&]{ return Intern::ApplyWork::csr(r, val, col_ind, rows, columns, used_elements, Index(BlockHeight_), Index(BlockWidth_)); });
           if (BlockHeight_ == BlockWidth_)
             csrb_mkl(r, a, x, b, y, val, (const unsigned long*)col_ind, (const unsigned long*)row_ptr, rows, columns, used_elements, BlockHeight_);
           else
@@ -106,6 +196,7 @@ namespace FEAT
                          const IT_ * const col_ind, const IT_ * const row_ptr, const Index rows, const Index columns,
                          const Index used_elements)
         {
+          RegionTimer::Scope region("arch-apply-csrb", [&]{ return Intern::ApplyWork::csr(r, val, col_ind, rows, columns, used_elements, Index(BlockHeight_), Index(BlockWidth_)); });
           csrb_generic<__float128, IT_, BlockHeight_, BlockWidth_>(r, a, x, b, y, val, col_ind, row_ptr, rows, columns, used_elements);
         }
 #endif
@@ -113,12 +204,41 @@ namespace FEAT
         template <typename DT_, typename IT_, int BlockSize_>
         static void csrsb(DT_ * r, const DT_ a, const DT_ * const x, const DT_ b, const DT_ * const y, const DT_ * const val, const IT_ * const col_ind, const IT_ * const row_ptr, const Index rows, const Index columns, const Index used_elements)
         {
+          RegionTimer::Scope region("arch-apply-csrsb", [&]{ return Intern::ApplyWork::csr(r, val, col_ind, rows, columns, used_elements, Index(1), Index(1), Index(BlockSize_)); });
           csrsb_generic<DT_, IT_, BlockSize_>(r, a, x, b, y, val, col_ind, row_ptr, rows, columns, used_elements);
         }
 
+        template <typename DT_, typename IT_, int BlockHeight_, int BlockWidth_, int NumCols_>
+        static void csrb_multi(DT_ * r, const DT_ a, const DT_ * const x, const DT_ b, const DT_ * const y, const DT_ * const val,
+                               const IT_ * const col_ind, const IT_ * const row_ptr, const Index rows, const Index columns,
+                               const Index used_elements)
+        {
+          RegionTimer::Scope region("arch-apply-csrb-multi", [&]{ return Intern::ApplyWork::csr(r, val, col_ind, rows, columns, used_elements, Index(BlockHeight_), Index(BlockWidth_), Index(NumCols_)); });
+          csrb_multi_generic<DT_, IT_, BlockHeight_, BlockWidth_, NumCols_>(r, a, x, b, y, val, col_ind, row_ptr, rows, columns, used_elements);
+        }
+
+        template <typename DT_, typename DTM_, typename IT_>
+        static void csr_mixed(DT_ * r, const DT_ a, const DT_ * const x, const DT_ b, const DT_ * const y, const DTM_ * const val,
+                              const IT_ * const col_ind, const IT_ * const row_ptr, const Index rows, const Index columns,
+                              const Index used_elements)
+        {
+          RegionTimer::Scope region("arch-apply-csr-mixed", [&]{ return Intern::ApplyWork::csr(r, val, col_ind, rows, columns, used_elements); });
+          csr_mixed_generic(r, a, x, b, y, val, col_ind, row_ptr, rows, columns, used_elements);
+        }
+
+        template <typename DT_, typename DTM_, typename IT_, int BlockHeight_, int BlockWidth_>
+        static void csrb_mixed(DT_ * r, const DT_ a, const DT_ * const x, const DT_ b, const DT_ * const y, const DTM_ * const val,
+                               const IT_ * const col_ind, const IT_ * const row_ptr, const Index rows, const Index columns,
+                               const Index used_elements)
+        {
+          RegionTimer::Scope region("arch-apply-csrb-mixed", [&]{ return Intern::ApplyWork::csr(r, val, col_ind, rows, columns, used_elements, Index(BlockHeight_), Index(BlockWidth_)); });
+          csrb_mixed_generic<DT_, DTM_, IT_, BlockHeight_, BlockWidth_>(r, a, x, b, y, val, col_ind, row_ptr, rows, columns, used_elements);
+        }
+
         template <typename DT_, typename IT_>
         static void ell(DT_ * r, const DT_ a, const DT_ * const x, const DT_ b, const DT_ * const y, const DT_ * const val, const IT_ * const col_ind, const IT_ * const cs, const IT_ * const cl, const Index C, const Index rows)
         {
+          RegionTimer::Scope region("arch-apply-ell", [&]{ return Intern::ApplyWork::ell(r, col_ind, cs, C, rows); });
           ell_generic(r, a, x, b, y, val, col_ind, cs, cl, C, rows);
         }
 
@@ -126,6 +246,7 @@ namespace FEAT
         static void coo(DT_ * r, const DT_ a, const DT_ * const x, const DT_ b, const DT_ * const y, const DT_ * const val,
                         const IT_ * const row_ptr, const IT_ * const col_ptr, const Index rows, const Index columns, const Index used_elements)
         {
+          RegionTimer::Scope region("arch-apply-coo", [&]{ return Intern::ApplyWork::coo(r, row_ptr, rows, columns, used_elements); });
           coo_generic(r, a, x, b, y, val, row_ptr, col_ptr, rows, columns, used_elements);
         }
 
@@ -133,6 +254,7 @@ namespace FEAT
         static void coo(DT_ * r, const DT_ a, const DT_ * const x, const DT_ b, const DT_ * const y, const DT_ * const val,
                         const Index * const row_ptr, const Index * const col_ptr, const Index rows, const Index columns, const Index used_elements)
         {
+          RegionTimer::Scope region("arch-apply-coo", [&]{ return Intern::ApplyWork::coo(r, row_ptr, rows, columns, used_elements); });
           coo_generic(r, a, x, b, y, val, row_ptr, col_ptr, rows, columns, used_elements);
         }
 
@@ -140,12 +262,14 @@ namespace FEAT
         static void coo(float * r, const float a, const float * const x, const float b, const float * const y, const float * const val,
                         const Index * const row_ptr, const Index * const col_ptr, const Index rows, const Index columns, const Index used_elements)
         {
+          RegionTimer::Scope region("arch-apply-coo", [&]{ return Intern::ApplyWork::coo(r, row_ptr, rows, columns, used_elements); });
           coo_mkl(r, a, x, b, y, val, row_ptr, col_ptr, rows, columns, used_elements);
         }
 
         static void coo(double * r, const double a, const double * const x, const double b, const double * const y, const double * const val,
                         const Index * const row_ptr, const Index * const col_ptr, const Index rows, const Index columns, const Index used_elements)
         {
+          RegionTimer::Scope region("arch-apply-coo", [&]{ return Intern::ApplyWork::coo(r, row_ptr, rows, columns, used_elements); });
           coo_mkl(r, a, x, b, y, val, row_ptr, col_ptr, rows, columns, used_elements);
         }
 #endif
@@ -154,6 +278,7 @@ namespace FEAT
         static void coo(__float128 * r, const __float128 a, const __float128 * const x, const __float128 b, const __float128 * const y, const __float128 * const val,
                         const Index * const row_ptr, const Index * const col_ptr, const Index rows, const Index columns, const Index used_elements)
         {
+          RegionTimer::Scope region("arch-apply-coo", [&]{ return Intern::ApplyWork::coo(r, row_ptr, rows, columns, used_elements); });
           coo_generic(r, a, x, b, y, val, row_ptr, col_ptr, rows, columns, used_elements);
         }
 #endif
@@ -161,23 +286,27 @@ namespace FEAT
         template <typename DT_, typename IT_>
         static void banded(DT_ * r, const DT_ alpha, const DT_ * const x, const DT_ beta, const DT_ * const y, const DT_ * const val, const IT_ * const offsets,  const Index num_of_offsets, const Index rows, const Index columns)
         {
+          RegionTimer::Scope region("arch-apply-banded", [&]{ return Intern::ApplyWork::banded(r, num_of_offsets, rows, columns); });
           banded_generic(r, alpha, x, beta, y, val, offsets, num_of_offsets, rows, columns);
         }
 
         template <typename DT_>
         static void dense(DT_ * r, const DT_ alpha, const DT_ beta, const DT_ * const y, const DT_ * const val, const DT_ * const x, const Index rows, const Index columns)
         {
+          RegionTimer::Scope region("arch-apply-dense", [&]{ return Intern::ApplyWork::dense(r, rows, columns); });
           dense_generic(r, alpha, beta, y, val, x, rows, columns);
         }
 
 #ifdef FEAT_HAVE_MKL
         static void dense(float * r, const float alpha, const float beta, const float * const y, const float * const val, const float * const x, const Index rows, const Index columns)
         {
+          RegionTimer::Scope region("arch-apply-dense", [&]{ return Intern::ApplyWork::dense(r, rows, columns); });
           dense_mkl(r, alpha, beta, y, val, x, rows, columns);
         }
 
         static void dense(double * r, const double alpha, const double beta, const double * const y, const double * const val, const double * const x, const Index rows, const Index columns)
         {
+          RegionTimer::Scope region("arch-apply-dense", [&]{ return Intern::ApplyWork::dense(r, rows, columns); });
           dense_mkl(r, alpha, beta, y, val, x, rows, columns);
         }
 #endif
@@ -185,6 +314,7 @@ namespace FEAT
 #if defined(FEAT_HAVE_QUADMATH) && !defined(__CUDACC__)
         static void dense(__float128 * r, const __float128 alpha, const __float128 beta, const __float128 * const y, const __float128 * const val, const __float128 * const x, const Index rows, const Index columns)
         {
+          RegionTimer::Scope region("arch-apply-dense", [&]{ return Intern::ApplyWork::dense(r, rows, columns); });
           dense_generic(r, alpha, beta, y, val, x, rows, columns);
         }
 #endif
@@ -199,13 +329,30 @@ namespace FEAT
                         const IT_ * const col_ind, const IT_ * const row_ptr, const IT_ * const row_numbers, const Index used_rows,
                         const Index rows, const Index, const Index, const bool);
 
+        template <typename DT_, typename IT_, typename DIT_>
+        static void dcsr_generic(DT_ * r, const DT_ a, const DT_ * const x, const DT_ b, const DT_ * const y, const DT_ * const val,
+                        const DIT_ * const col_delta, const IT_ * const row_base, const IT_ * const row_ptr,
+                        const IT_ * const esc_col, const IT_ * const esc_ptr, const Index rows, const Index, const Index, const bool);
+
         template <typename DT_, typename IT_, int BlockHeight_, int BlockWidth_>
         static void csrb_generic(DT_ * r, const DT_ a, const DT_ * const x, const DT_ b, const DT_ * const y, const DT_ * const val,
                          const IT_ * const col_ind, const IT_ * const row_ptr, const Index rows, const Index, const Index);
 
+        template <typename DT_, typename DTM_, typename IT_>
+        static void csr_mixed_generic(DT_ * r, const DT_ a, const DT_ * const x, const DT_ b, const DT_ * const y, const DTM_ * const val,
+                        const IT_ * const col_ind, const IT_ * const row_ptr, const Index rows, const Index, const Index);
+
+        template <typename DT_, typename DTM_, typename IT_, int BlockHeight_, int BlockWidth_>
+        static void csrb_mixed_generic(DT_ * r, const DT_ a, const DT_ * const x, const DT_ b, const DT_ * const y, const DTM_ * const val,
+                         const IT_ * const col_ind, const IT_ * const row_ptr, const Index rows, const Index, const Index);
+
         template <typename DT_, typename IT_, int BlockSize_>
         static void csrsb_generic(DT_ * r, const DT_ a, const DT_ * const x, const DT_ b, const DT_ * const y, const DT_ * const val, const IT_ * const col_ind, const IT_ * const row_ptr, const Index rows, const Index, const Index);
 
+        template <typename DT_, typename IT_, int BlockHeight_, int BlockWidth_, int NumCols_>
+        static void csrb_multi_generic(DT_ * r, const DT_ a, const DT_ * const x, const DT_ b, const DT_ * const y, const DT_ * const val,
+                         const IT_ * const col_ind, const IT_ * const row_ptr, const Index rows, const Index, const Index);
+
         template <typename DT_, typename IT_>
         static void ell_generic(DT_ * r, const DT_ a, const DT_ * const x, const DT_ b, const DT_ * const y, const DT_ * const val, const IT_ * const col_ind, const IT_ * const cs, const IT_ * const cl, const Index C, const Index rows);
 
@@ -15,6 +15,8 @@
 #include <kernel/util/tiny_algebra.hpp>
 #include <kernel/util/memory_pool.hpp>
 
+#include <limits>
+
 namespace FEAT
 {
   namespace LAFEM
@@ -118,6 +120,62 @@ namespace FEAT
         }
       }
 
+      template <typename DT_, typename IT_, typename DIT_>
+      void Apply<Mem::Main>::dcsr_generic(DT_ * r, const DT_ a, const DT_ * const x, const DT_ b, const DT_ * const y, const DT_ * const val,
+                                               const DIT_ * const col_delta, const IT_ * const row_base, const IT_ * const row_ptr,
+                                               const IT_ * const esc_col, const IT_ * const esc_ptr, const Index rows, const Index columns,
+                                               const Index, const bool transposed)
+      {
+        // deltas with this value mark an entry whose column index is stored in esc_col;
+        // esc_col and esc_ptr may be nullptr if there are no such entries
+        const DIT_ escape(std::numeric_limits<DIT_>::max());
+
+        if (Math::abs(b) < Math::eps<DT_>())
+        {
+          MemoryPool<Mem::Main>::set_memory(r, DT_(0), (transposed?columns:rows));
+        }
+        else if (r != y)
+        {
+          MemoryPool<Mem::Main>::copy(r, y, (transposed?columns:rows));
+        }
+
+        if (transposed)
+        {
+          for (Index col(0) ; col < columns ; ++col)
+          {
+            r[col] = b * r[col];
+          }
+          for (Index row(0) ; row < rows ; ++row)
+          {
+            const IT_ base(row_base[row]);
+            const DT_ ax(a * x[row]);
+            IT_ esc(esc_ptr != nullptr ? esc_ptr[row] : IT_(0));
+            const IT_ end(row_ptr[row + 1]);
+            for (IT_ i(row_ptr[row]) ; i < end ; ++i)
+            {
+              const IT_ col(col_delta[i] != escape ? base + IT_(col_delta[i]) : esc_col[esc++]);
+              r[col] += val[i] * ax;
+            }
+          }
+        }
+        else
+        {
+          for (Index row(0) ; row < rows ; ++row)
+          {
+            DT_ sum(0);
+            const IT_ base(row_base[row]);
+            IT_ esc(esc_ptr != nullptr ? esc_ptr[row] : IT_(0));
+            const IT_ end(row_ptr[row + 1]);
+            for (IT_ i(row_ptr[row]) ; i < end ; ++i)
+            {
+              const IT_ col(col_delta[i] != escape ? base + IT_(col_delta[i]) : esc_col[esc++]);
+              sum += val[i] * x[col];
+            }
+            r[row] = (sum * a) + (b * r[row]);
+          }
+        }
+      }
+
       template <typename DT_, typename IT_, int BlockHeight_, int BlockWidth_>
       void Apply<Mem::Main>::csrb_generic(DT_ * r, const DT_ a, const DT_ * const x, const DT_ b, const DT_ * const y, const DT_ * const val,
                                                 const IT_ * const col_ind, const IT_ * const row_ptr, const Index rows, const Index, const Index)
@@ -153,6 +211,74 @@ namespace FEAT
         }
       }
 
+      template <typename DT_, typename DTM_, typename IT_>
+      void Apply<Mem::Main>::csr_mixed_generic(DT_ * r, const DT_ a, const DT_ * const x, const DT_ b, const DT_ * const y, const DTM_ * const val,
+                                               const IT_ * const col_ind, const IT_ * const row_ptr, const Index rows, const Index, const Index)
+      {
+        if (Math::abs(b) < Math::eps<DT_>())
+        {
+          MemoryPool<Mem::Main>::set_memory(r, DT_(0), rows);
+        }
+        else if (r != y)
+        {
+          MemoryPool<Mem::Main>::copy(r, y, rows);
+        }
+
+        // the matrix entries are stored in DTM_ and are converted to DT_ on the fly
+        for (Index row(0) ; row < rows ; ++row)
+        {
+          DT_ sum(0);
+          const IT_ end(row_ptr[row + 1]);
+          for (IT_ i(row_ptr[row]) ; i < end ; ++i)
+          {
+            sum += DT_(val[i]) * x[col_ind[i]];
+          }
+          r[row] = (sum * a) + (b * r[row]);
+        }
+      }
+
+      template <typename DT_, typename DTM_, typename IT_, int BlockHeight_, int BlockWidth_>
+      void Apply<Mem::Main>::csrb_mixed_generic(DT_ * r, const DT_ a, const DT_ * const x, const DT_ b, const DT_ * const y, const DTM_ * const val,
+                                                const IT_ * const col_ind, const IT_ * const row_ptr, const Index rows, const Index, const Index)
+      {
+        if (Math::abs(b) < Math::eps<DT_>())
+        {
+          MemoryPool<Mem::Main>::set_memory(r, DT_(0), rows * BlockHeight_);
+        }
+        else if (r != y)
+        {
+          MemoryPool<Mem::Main>::copy(r, y, rows * BlockHeight_);
+        }
+
+        // the matrix entries are stored in DTM_ and are converted to DT_ on the fly
+        for (Index row(0) ; row < rows ; ++row)
+        {
+          DT_ bsum[BlockHeight_];
+          for (int h(0) ; h < BlockHeight_ ; ++h)
+            bsum[h] = DT_(0);
+
+          const IT_ end(row_ptr[row + 1]);
+          for (IT_ i(row_ptr[row]) ; i < end ; ++i)
+          {
+            const DTM_ * const bval(&val[Index(i) * Index(BlockHeight_ * BlockWidth_)]);
+            const DT_ * const bx(&x[Index(col_ind[i]) * Index(BlockWidth_)]);
+            for (int h(0) ; h < BlockHeight_ ; ++h)
+            {
+              for (int w(0) ; w < BlockWidth_ ; ++w)
+              {
+                bsum[h] += DT_(bval[h * BlockWidth_ + w]) * bx[w];
+              }
+            }
+          }
+
+          DT_ * const br(&r[row * Index(BlockHeight_)]);
+          for (int h(0) ; h < BlockHeight_ ; ++h)
+          {
+            br[h] = (bsum[h] * a) + (b * br[h]);
+          }
+        }
+      }
+
       template <typename DT_, typename IT_, int BlockSize_>
       void Apply<Mem::Main>::csrsb_generic(DT_ * r, const DT_ a, const DT_ * const x, const DT_ b, const DT_ * const y, const DT_ * const val, const IT_ * const col_ind, const IT_ * const row_ptr, const Index rows, const Index, const Index)
       {
@@ -180,6 +306,53 @@ namespace FEAT
         }
       }
 
+      template <typename DT_, typename IT_, int BlockHeight_, int BlockWidth_, int NumCols_>
+      void Apply<Mem::Main>::csrb_multi_generic(DT_ * r, const DT_ a, const DT_ * const x, const DT_ b, const DT_ * const y, const DT_ * const val,
+                                                const IT_ * const col_ind, const IT_ * const row_ptr, const Index rows, const Index, const Index)
+      {
+        // each block row of x and r holds NumCols_ consecutive entries per scalar row
+        Tiny::Matrix<DT_, BlockHeight_, NumCols_> * br(reinterpret_cast<Tiny::Matrix<DT_, BlockHeight_, NumCols_> *>(r));
+        const Tiny::Matrix<DT_, BlockHeight_, BlockWidth_> * const bval(reinterpret_cast<const Tiny::Matrix<DT_, BlockHeight_, BlockWidth_> *>(val));
+        const Tiny::Matrix<DT_, BlockWidth_, NumCols_> * const bx(reinterpret_cast<const Tiny::Matrix<DT_, BlockWidth_, NumCols_> *>(x));
+
+        if (Math::abs(b) < Math::eps<DT_>())
+        {
+          MemoryPool<Mem::Main>::set_memory(r, DT_(0), rows * BlockHeight_ * NumCols_);
+        }
+        else if (r != y)
+        {
+          MemoryPool<Mem::Main>::copy(r, y, rows * BlockHeight_ * NumCols_);
+        }
+
+        for (Index row(0) ; row < rows ; ++row)
+        {
+          Tiny::Matrix<DT_, BlockHeight_, NumCols_> bsum(DT_(0));
+          const IT_ end(row_ptr[row + 1]);
+          for (IT_ i(row_ptr[row]) ; i < end ; ++i)
+          {
+            const Tiny::Matrix<DT_, BlockWidth_, NumCols_> & xc = bx[col_ind[i]];
+            for (int h(0) ; h < BlockHeight_ ; ++h)
+            {
+              for (int w(0) ; w < BlockWidth_ ; ++w)
+              {
+                const DT_ v(bval[i][h][w]);
+                for (int k(0) ; k < NumCols_ ; ++k)
+                {
+                  bsum[h][k] += v * xc[w][k];
+                }
+              }
+            }
+          }
+          for (int h(0) ; h < BlockHeight_ ; ++h)
+          {
+            for (int k(0) ; k < NumCols_ ; ++k)
+            {
+              br[row][h][k] = a * bsum[h][k] + b * br[row][h][k];
+            }
+          }
+        }
+      }
+
       namespace Intern
       {
         template <Index Start, Index End, Index Step = 1>
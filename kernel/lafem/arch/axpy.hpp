@@ -11,6 +11,7 @@
 #include <kernel/base_header.hpp>
 #include <kernel/util/exception.hpp>
 #include <kernel/archs.hpp>
+#include <kernel/util/region_timer.hpp>
 
 #include <typeinfo>
 
@@ -29,12 +30,14 @@ namespace FEAT
         template <typename DT_>
         static void dv(DT_ * r, const DT_ a, const DT_ * const x, const DT_ * const y, const Index size)
         {
+          RegionTimer::Scope region("arch-axpy", [&]{ return RegionTimer::Work{std::uint64_t(3 * size) * std::uint64_t(sizeof(*r)), std::uint64_t(2 * size)}; });
           dv_generic(r, a, x, y, size);
         }
 
 #ifdef FEAT_HAVE_MKL
         static void dv(float * r, const float a, const float * const x, const float * const y, const Index size)
         {
+          RegionTimer::Scope region("arch-axpy", [&]{ return RegionTimer::Work{std::uint64_t(3 * size) * std::uint64_t(sizeof(*r)), std::uint64_t(2 * size)}; });
         /// \compilerhack icc (in combination with mkl)  crashes kernel/solver/optimiser-test when calculating axpy on very small vectors (size=2)
 #ifdef FEAT_COMPILER_INTEL
           if (size < 17)
@@ -46,6 +49,7 @@ namespace FEAT
 
         static void dv(double * r, const double a, const double * const x, const double * const y, const Index size)
         {
+          RegionTimer::Scope region("arch-axpy", [&]{ return RegionTimer::Work{std::uint64_t(3 * size) * std::uint64_t(sizeof(*r)), std::uint64_t(2 * size)}; });
         /// \compilerhack icc (in combination with mkl)  crashes kernel/solver/optimiser-test when calculating axpy on very small vectors (size=2)
 #ifdef FEAT_COMPILER_INTEL
           if (size < 17)
@@ -59,6 +63,7 @@ namespace FEAT
 #if defined(FEAT_HAVE_QUADMATH) && !defined(__CUDACC__)
         static void dv(__float128 * r, const __float128 a, const __float128 * const x, const __float128 * const y, const Index size)
         {
+          RegionTimer::Scope region("arch-axpy", [&]{ return RegionTimer::Work{std::uint64_t(3 * size) * std::uint64_t(sizeof(*r)), std::uint64_t(2 * size)}; });
           dv_generic(r, a, x, y, size);
         }
 #endif
@@ -68,6 +73,16 @@ namespace FEAT
 
         static void dv_mkl(float * r, const float a, const float * const x, const float * const y, const Index size);
         static void dv_mkl(double * r, const double a, const double * const x, const double * const y, const Index size);
+
+        template <typename DT_, int BlockSize_>
+        static void dv_blocked(DT_ * r, const DT_ * const a, const DT_ * const x, const DT_ * const y, const Index size)
+        {
+          RegionTimer::Scope region("arch-axpy-blocked", [&]{ return RegionTimer::Work{std::uint64_t(3 * size * BlockSize_) * std::uint64_t(sizeof(*r)), std::uint64_t(2 * size * BlockSize_)}; });
+          dv_blocked_generic<DT_, BlockSize_>(r, a, x, y, size);
+        }
+
+        template <typename DT_, int BlockSize_>
+        static void dv_blocked_generic(DT_ * r, const DT_ * const a, const DT_ * const x, const DT_ * const y, const Index size);
       };
 
 #ifdef FEAT_EICKT
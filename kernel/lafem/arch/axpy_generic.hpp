@@ -47,6 +47,20 @@ namespace FEAT
           }
         }
       }
+
+      template <typename DT_, int BlockSize_>
+      void Axpy<Mem::Main>::dv_blocked_generic(DT_ * r, const DT_ * const a, const DT_ * const x, const DT_ * const y, const Index size)
+      {
+        DT_ s[BlockSize_];
+        for (int j(0) ; j < BlockSize_ ; ++j)
+          s[j] = a[j];
+
+        for (Index i(0) ; i < size ; ++i)
+        {
+          for (int j(0) ; j < BlockSize_ ; ++j)
+            r[i * BlockSize_ + j] = (s[j] * x[i * BlockSize_ + j]) + y[i * BlockSize_ + j];
+        }
+      }
     } // namespace Arch
   } // namespace LAFEM
 } // namespace FEAT
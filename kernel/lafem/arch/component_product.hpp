@@ -10,6 +10,7 @@
 // includes, FEAT
 #include <kernel/base_header.hpp>
 #include <kernel/archs.hpp>
+#include <kernel/util/region_timer.hpp>
 
 
 namespace FEAT
@@ -27,17 +28,20 @@ namespace FEAT
         template <typename DT_>
         static void value(DT_ * r, const DT_ * const x, const DT_ * const y, const Index size)
         {
+          RegionTimer::Scope region("arch-component-product", [&]{ return RegionTimer::Work{std::uint64_t(3 * size) * std::uint64_t(sizeof(*r)), std::uint64_t(size)}; });
           value_generic(r, x, y, size);
         }
 
 #ifdef FEAT_HAVE_MKL
         static void value(float * r, const float * const x, const float * const y, const Index size)
         {
+          RegionTimer::Scope region("arch-component-product", [&]{ return RegionTimer::Work{std::uint64_t(3 * size) * std::uint64_t(sizeof(*r)), std::uint64_t(size)}; });
           value_mkl(r, x, y, size);
         }
 
         static void value(double * r, const double * const x, const double * const y, const Index size)
         {
+          RegionTimer::Scope region("arch-component-product", [&]{ return RegionTimer::Work{std::uint64_t(3 * size) * std::uint64_t(sizeof(*r)), std::uint64_t(size)}; });
           value_mkl(r, x, y, size);
         }
 #endif // FEAT_HAVE_MKL
@@ -45,13 +49,24 @@ namespace FEAT
 #if defined(FEAT_HAVE_QUADMATH) && !defined(__CUDACC__)
         static void value(__float128 * r, const __float128 * const x, const __float128 * const y, const Index size)
         {
+          RegionTimer::Scope region("arch-component-product", [&]{ return RegionTimer::Work{std::uint64_t(3 * size) * std::uint64_t(sizeof(*r)), std::uint64_t(size)}; });
           value_generic(r, x, y, size);
         }
 #endif
 
+        template <typename DT_, typename DTX_>
+        static void value_mixed(DT_ * r, const DTX_ * const x, const DT_ * const y, const Index size)
+        {
+          RegionTimer::Scope region("arch-component-product-mixed", [&]{ return RegionTimer::Work{std::uint64_t(2 * size) * std::uint64_t(sizeof(*r)) + std::uint64_t(size) * std::uint64_t(sizeof(*x)), std::uint64_t(size)}; });
+          value_mixed_generic(r, x, y, size);
+        }
+
         template <typename DT_>
         static void value_generic(DT_ * r, const DT_ * const x, const DT_ * const y, const Index size);
 
+        template <typename DT_, typename DTX_>
+        static void value_mixed_generic(DT_ * r, const DTX_ * const x, const DT_ * const y, const Index size);
+
         static void value_mkl(float * r, const float * const x, const float * const y, const Index size);
         static void value_mkl(double * r, const double * const x, const double * const y, const Index size);
       };
@@ -50,6 +50,15 @@ namespace FEAT
           }
         }
       }
+
+      template <typename DT_, typename DTX_>
+      void ComponentProduct<Mem::Main>::value_mixed_generic(DT_ * r, const DTX_ * const x, const DT_ * const y, const Index size)
+      {
+        for (Index i(0) ; i < size ; ++i)
+        {
+          r[i] = DT_(x[i]) * y[i];
+        }
+      }
     } // namespace Arch
   } // namespace LAFEM
 } // namespace FEAT
@@ -10,6 +10,7 @@
 // includes, FEAT
 #include <kernel/base_header.hpp>
 #include <kernel/archs.hpp>
+#include <kernel/util/region_timer.hpp>
 
 
 
@@ -28,17 +29,20 @@ namespace FEAT
         template <typename DT_>
         static DT_ value(const DT_ * const x, const DT_ * const y, const Index size)
         {
+          RegionTimer::Scope region("arch-dot-product", [&]{ return RegionTimer::Work{std::uint64_t(2 * size) * std::uint64_t(sizeof(*x)), std::uint64_t(2 * size)}; });
           return value_generic(x, y, size);
         }
 
 #ifdef FEAT_HAVE_MKL
         static float value(const float * const x, const float * const y, const Index size)
         {
+          RegionTimer::Scope region("arch-dot-product", [&]{ return RegionTimer::Work{std::uint64_t(2 * size) * std::uint64_t(sizeof(*x)), std::uint64_t(2 * size)}; });
           return value_mkl(x, y, size);
         }
 
         static double value(const double * const x, const double * const y, const Index size)
         {
+          RegionTimer::Scope region("arch-dot-product", [&]{ return RegionTimer::Work{std::uint64_t(2 * size) * std::uint64_t(sizeof(*x)), std::uint64_t(2 * size)}; });
           return value_mkl(x, y, size);
         }
 #endif // FEAT_HAVE_MKL
@@ -46,6 +50,7 @@ namespace FEAT
 #if defined(FEAT_HAVE_QUADMATH) && !defined(__CUDACC__)
         static __float128 value(const __float128 * const x, const __float128 * const y, const Index size)
         {
+          RegionTimer::Scope region("arch-dot-product", [&]{ return RegionTimer::Work{std::uint64_t(2 * size) * std::uint64_t(sizeof(*x)), std::uint64_t(2 * size)}; });
           return value_generic(x, y, size);
         }
 #endif
@@ -55,6 +60,16 @@ namespace FEAT
 
         static float value_mkl(const float * const x, const float * const y, const Index size);
         static double value_mkl(const double * const x, const double * const y, const Index size);
+
+        template <typename DT_, int BlockSize_>
+        static void value_blocked(DT_ * result, const DT_ * const x, const DT_ * const y, const Index size)
+        {
+          RegionTimer::Scope region("arch-dot-product-blocked", [&]{ return RegionTimer::Work{std::uint64_t(2 * size * BlockSize_) * std::uint64_t(sizeof(*x)), std::uint64_t(2 * size * BlockSize_)}; });
+          value_blocked_generic<DT_, BlockSize_>(result, x, y, size);
+        }
+
+        template <typename DT_, int BlockSize_>
+        static void value_blocked_generic(DT_ * result, const DT_ * const x, const DT_ * const y, const Index size);
       };
 
 #ifdef FEAT_EICKT
@@ -78,17 +93,20 @@ namespace FEAT
         template <typename DT_>
         static DT_ value(const DT_ * const x, const DT_ * const y, const DT_ * const z, const Index size)
         {
+          RegionTimer::Scope region("arch-triple-dot-product", [&]{ return RegionTimer::Work{std::uint64_t(3 * size) * std::uint64_t(sizeof(*x)), std::uint64_t(3 * size)}; });
           return value_generic(x, y, z, size);
         }
 
 #ifdef FEAT_HAVE_MKL
         static float value(const float * const x, const float * const y, const float * const z, const Index size)
         {
+          RegionTimer::Scope region("arch-triple-dot-product", [&]{ return RegionTimer::Work{std::uint64_t(3 * size) * std::uint64_t(sizeof(*x)), std::uint64_t(3 * size)}; });
           return value_mkl(x, y, z, size);
         }
 
         static double value(const double * const x, const double * const y, const double * const z, const Index size)
         {
+          RegionTimer::Scope region("arch-triple-dot-product", [&]{ return RegionTimer::Work{std::uint64_t(3 * size) * std::uint64_t(sizeof(*x)), std::uint64_t(3 * size)}; });
           return value_mkl(x, y, z, size);
         }
 #endif // FEAT_HAVE_MKL
@@ -96,6 +114,7 @@ namespace FEAT
 #if defined(FEAT_HAVE_QUADMATH) && !defined(__CUDACC__)
         static __float128 value(const __float128 * const x, const __float128 * const y, const __float128 * const z, const Index size)
         {
+          RegionTimer::Scope region("arch-triple-dot-product", [&]{ return RegionTimer::Work{std::uint64_t(3 * size) * std::uint64_t(sizeof(*x)), std::uint64_t(3 * size)}; });
           return value_generic(x, y, z, size);
         }
 #endif
@@ -105,6 +124,16 @@ namespace FEAT
 
         static float value_mkl(const float * const x, const float * const y, const float * const z, const Index size);
         static double value_mkl(const double * const x, const double * const y, const double * const z, const Index size);
+
+        template <typename DT_, int BlockSize_>
+        static void value_blocked(DT_ * result, const DT_ * const x, const DT_ * const y, const DT_ * const z, const Index size)
+        {
+          RegionTimer::Scope region("arch-triple-dot-product-blocked", [&]{ return RegionTimer::Work{std::uint64_t(3 * size * BlockSize_) * std::uint64_t(sizeof(*x)), std::uint64_t(3 * size * BlockSize_)}; });
+          value_blocked_generic<DT_, BlockSize_>(result, x, y, z, size);
+        }
+
+        template <typename DT_, int BlockSize_>
+        static void value_blocked_generic(DT_ * result, const DT_ * const x, const DT_ * const y, const DT_ * const z, const Index size);
       };
 
 #ifdef FEAT_EICKT
@@ -68,6 +68,40 @@ namespace FEAT
 
         return r;
       }
+
+      template <typename DT_, int BlockSize_>
+      void DotProduct<Mem::Main>::value_blocked_generic(DT_ * result, const DT_ * const x, const DT_ * const y, const Index size)
+      {
+        DT_ r[BlockSize_];
+        for (int j(0) ; j < BlockSize_ ; ++j)
+          r[j] = DT_(0);
+
+        for (Index i(0) ; i < size ; ++i)
+        {
+          for (int j(0) ; j < BlockSize_ ; ++j)
+            r[j] += x[i * BlockSize_ + j] * y[i * BlockSize_ + j];
+        }
+
+        for (int j(0) ; j < BlockSize_ ; ++j)
+          result[j] = r[j];
+      }
+
+      template <typename DT_, int BlockSize_>
+      void TripleDotProduct<Mem::Main>::value_blocked_generic(DT_ * result, const DT_ * const x, const DT_ * const y, const DT_ * const z, const Index size)
+      {
+        DT_ r[BlockSize_];
+        for (int j(0) ; j < BlockSize_ ; ++j)
+          r[j] = DT_(0);
+
+        for (Index i(0) ; i < size ; ++i)
+        {
+          for (int j(0) ; j < BlockSize_ ; ++j)
+            r[j] += x[i * BlockSize_ + j] * y[i * BlockSize_ + j] * z[i * BlockSize_ + j];
+        }
+
+        for (int j(0) ; j < BlockSize_ ; ++j)
+          result[j] = r[j];
+      }
     } // namespace Arch
   } // namespace LAFEM
 } // namespace FEAT
@@ -23,6 +23,9 @@ namespace FEAT
       template<>
       struct Mirror<Mem::Main>
       {
+        /// minimum number of buffer entries for the OpenMP parallelisation of the gather/scatter loops
+        static constexpr Index min_omp_size = Index(10000);
+
         template<typename DT_, typename IT_>
         static void gather_dv(const Index boff, const Index nidx, const IT_* idx, DT_* buf, const DT_* vec)
         {
@@ -21,29 +21,42 @@ namespace FEAT
       template<typename DT_, typename IT_>
       void Mirror<Mem::Main>::gather_dv_generic(const Index boff, const Index nidx, const IT_* idx, DT_* buf, const DT_* vec)
       {
-        for(Index i(0); i < nidx; ++i)
+        const long n = long(nidx);
+#ifdef _OPENMP
+#pragma omp parallel for if(nidx > min_omp_size)
+#endif
+        for(long i = 0; i < n; ++i)
         {
-          buf[boff+i] = vec[idx[i]];
+          buf[boff+Index(i)] = vec[idx[i]];
         }
       }
 
       template<typename DT_, typename IT_>
       void Mirror<Mem::Main>::scatter_dv_generic(const Index boff, const Index nidx, const IT_* idx, const DT_* buf, DT_* vec, const DT_ alpha)
       {
-        for(Index i(0); i < nidx; ++i)
+        // Note: the indices of a mirror are unique, so the loop is free of write conflicts
+        const long n = long(nidx);
+#ifdef _OPENMP
+#pragma omp parallel for if(nidx > min_omp_size)
+#endif
+        for(long i = 0; i < n; ++i)
         {
-          vec[idx[i]] += alpha*buf[boff+i];
+          vec[idx[i]] += alpha*buf[boff+Index(i)];
         }
       }
 
       template<typename DT_, typename IT_>
       void Mirror<Mem::Main>::gather_dvb_generic(const Index bs, const Index boff, const Index nidx, const IT_* idx, DT_* buf, const DT_* vec)
       {
-        for(Index i(0); i < nidx; ++i)
+        const long n = long(nidx);
+#ifdef _OPENMP
+#pragma omp parallel for if(nidx*bs > min_omp_size)
+#endif
+        for(long i = 0; i < n; ++i)
         {
           for(Index k(0); k < bs; ++k)
           {
-            buf[boff+i*bs+k] = vec[idx[i]*bs+k];
+            buf[boff+Index(i)*bs+k] = vec[idx[i]*bs+k];
           }
         }
       }
@@ -51,11 +64,16 @@ namespace FEAT
       template<typename DT_, typename IT_>
       void Mirror<Mem::Main>::scatter_dvb_generic(const Index bs, const Index boff, const Index nidx, const IT_* idx, const DT_* buf, DT_* vec, const DT_ alpha)
       {
-        for(Index i(0); i < nidx; ++i)
+        // Note: the indices of a mirror are unique, so the loop is free of write conflicts
+        const long n = long(nidx);
+#ifdef _OPENMP
+#pragma omp parallel for if(nidx*bs > min_omp_size)
+#endif
+        for(long i = 0; i < n; ++i)
         {
           for(Index k(0); k < bs; ++k)
           {
-            vec[idx[i]*bs+k] += alpha*buf[boff+i*bs+k];
+            vec[idx[i]*bs+k] += alpha*buf[boff+Index(i)*bs+k];
           }
         }
       }
@@ -10,6 +10,7 @@
 // includes, FEAT
 #include <kernel/base_header.hpp>
 #include <kernel/archs.hpp>
+#include <kernel/util/region_timer.hpp>
 
 namespace FEAT
 {
@@ -26,17 +27,20 @@ namespace FEAT
         template <typename DT_>
         static DT_ value(const DT_ * const x, const Index size)
         {
+          RegionTimer::Scope region("arch-norm2", [&]{ return RegionTimer::Work{std::uint64_t(size) * std::uint64_t(sizeof(*x)), std::uint64_t(2 * size)}; });
           return value_generic(x, size);
         }
 
 #ifdef FEAT_HAVE_MKL
         static float value(const float * const x, const Index size)
         {
+          RegionTimer::Scope region("arch-norm2", [&]{ return RegionTimer::Work{std::uint64_t(size) * std::uint64_t(sizeof(*x)), std::uint64_t(2 * size)}; });
           return value_mkl(x, size);
         }
 
         static double value(const double * const x, const Index size)
         {
+          RegionTimer::Scope region("arch-norm2", [&]{ return RegionTimer::Work{std::uint64_t(size) * std::uint64_t(sizeof(*x)), std::uint64_t(2 * size)}; });
           return value_mkl(x, size);
         }
 #endif
@@ -44,6 +48,7 @@ namespace FEAT
 #if defined(FEAT_HAVE_QUADMATH) && !defined(__CUDACC__)
         static __float128 value(const __float128 * const x, const Index size)
         {
+          RegionTimer::Scope region("arch-norm2", [&]{ return RegionTimer::Work{std::uint64_t(size) * std::uint64_t(sizeof(*x)), std::uint64_t(2 * size)}; });
           return value_generic(x, size);
         }
 #endif
@@ -10,6 +10,7 @@
 // includes, FEAT
 #include <kernel/base_header.hpp>
 #include <kernel/archs.hpp>
+#include <kernel/util/region_timer.hpp>
 
 
 namespace FEAT
@@ -27,17 +28,20 @@ namespace FEAT
         template <typename DT_>
         static void value(DT_ * r, const DT_ * const x, const DT_ s, const Index size)
         {
+          RegionTimer::Scope region("arch-scale", [&]{ return RegionTimer::Work{std::uint64_t(2 * size) * std::uint64_t(sizeof(*r)), std::uint64_t(size)}; });
           value_generic(r, x, s, size);
         }
 
 #ifdef FEAT_HAVE_MKL
         static void value(float * r, const float * const x, const float s, const Index size)
         {
+          RegionTimer::Scope region("arch-scale", [&]{ return RegionTimer::Work{std::uint64_t(2 * size) * std::uint64_t(sizeof(*r)), std::uint64_t(size)}; });
           value_mkl(r, x, s, size);
         }
 
         static void value(double * r, const double * const x, const double s, const Index size)
         {
+          RegionTimer::Scope region("arch-scale", [&]{ return RegionTimer::Work{std::uint64_t(2 * size) * std::uint64_t(sizeof(*r)), std::uint64_t(size)}; });
           value_mkl(r, x, s, size);
         }
 #endif
@@ -45,6 +49,7 @@ namespace FEAT
 #if defined(FEAT_HAVE_QUADMATH) && !defined(__CUDACC__)
         static void value(__float128 * r, const __float128 * const x, const __float128 s, const Index size)
         {
+          RegionTimer::Scope region("arch-scale", [&]{ return RegionTimer::Work{std::uint64_t(2 * size) * std::uint64_t(sizeof(*r)), std::uint64_t(size)}; });
           value_generic(r, x, s, size);
         }
 #endif
@@ -54,6 +59,16 @@ namespace FEAT
 
         static void value_mkl(float * r, const float * const x, const float, const Index size);
         static void value_mkl(double * r, const double * const x, const double, const Index size);
+
+        template <typename DT_, int BlockSize_>
+        static void value_blocked(DT_ * r, const DT_ * const x, const DT_ * const s, const Index size)
+        {
+          RegionTimer::Scope region("arch-scale-blocked", [&]{ return RegionTimer::Work{std::uint64_t(2 * size * BlockSize_) * std::uint64_t(sizeof(*r)), std::uint64_t(size * BlockSize_)}; });
+          value_blocked_generic<DT_, BlockSize_>(r, x, s, size);
+        }
+
+        template <typename DT_, int BlockSize_>
+        static void value_blocked_generic(DT_ * r, const DT_ * const x, const DT_ * const s, const Index size);
       };
 
 #ifdef FEAT_EICKT
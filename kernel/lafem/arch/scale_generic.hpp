@@ -37,6 +37,20 @@ namespace FEAT
         }
       }
 
+      template <typename DT_, int BlockSize_>
+      void Scale<Mem::Main>::value_blocked_generic(DT_ * r, const DT_ * const x, const DT_ * const s, const Index size)
+      {
+        DT_ t[BlockSize_];
+        for (int j(0) ; j < BlockSize_ ; ++j)
+          t[j] = s[j];
+
+        for (Index i(0) ; i < size ; ++i)
+        {
+          for (int j(0) ; j < BlockSize_ ; ++j)
+            r[i * BlockSize_ + j] = x[i * BlockSize_ + j] * t[j];
+        }
+      }
+
     } // namespace Arch
   } // namespace LAFEM
 } // namespace FEAT
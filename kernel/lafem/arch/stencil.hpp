@@ -0,0 +1,125 @@
+// FEAT3: Finite Element Analysis Toolbox, Version 3
+// Copyright (C) 2010 - 2020 by Stefan Turek & the FEAT group
+// FEAT3 is released under the GNU General Public License version 3,
+// see the file 'copyright.txt' in the top level directory for details.
+
+#pragma once
+#ifndef KERNEL_LAFEM_ARCH_STENCIL_HPP
+#define KERNEL_LAFEM_ARCH_STENCIL_HPP 1
+
+// includes, FEAT
+#include <kernel/base_header.hpp>
+#include <kernel/archs.hpp>
+#include <kernel/util/region_timer.hpp>
+
+#include <cstdint>
+
+namespace FEAT
+{
+  namespace LAFEM
+  {
+    namespace Arch
+    {
+      /// \cond internal
+      namespace Intern
+      {
+        /// work estimates of the stencil kernels for the region timer
+        struct StencilWork
+        {
+          /// one product reads x and y and writes r; 7 multiply-adds and the scaling per node
+          template <typename DT_>
+          static RegionTimer::Work apply(const DT_*, const Index nx, const Index ny, const Index nz)
+          {
+            const std::uint64_t n(nx * ny * nz);
+            return RegionTimer::Work{std::uint64_t(3) * n * std::uint64_t(sizeof(DT_)), std::uint64_t(15) * n};
+          }
+
+          /// all steps read x, c and b and write x and c once per node
+          template <typename DT_>
+          static RegionTimer::Work smooth(const DT_*, const Index steps, const Index nx, const Index ny, const Index nz)
+          {
+            const std::uint64_t n(nx * ny * nz);
+            return RegionTimer::Work{std::uint64_t(5) * n * std::uint64_t(sizeof(DT_)), std::uint64_t(19 * steps) * n};
+          }
+        }; // struct StencilWork
+      } // namespace Intern
+      /// \endcond
+
+      /**
+       * \brief Matrix-free kernels for constant coefficient pointstar stencils
+       *
+       * All kernels operate on a lexicographically ordered nx x ny x nz grid (x runs fastest)
+       * and a 7-point stencil, whose coefficients are given in the order
+       * (center, x-lower, x-upper, y-lower, y-upper, z-lower, z-upper).
+       * Neighbours outside of the grid are treated as zero, i.e. the boundary nodes are eliminated
+       * as in the case of homogeneous Dirichlet boundary conditions.
+       */
+      template <typename Mem_>
+      struct Stencil;
+
+      template <>
+      struct Stencil<Mem::Main>
+      {
+        /**
+         * \brief Computes r <- beta * y + alpha * A * x
+         *
+         * The z-planes are processed in blocks of y-lines, so that the three planes required for each
+         * line stay in cache; the x-lines are processed by a branch-free and vectorisable inner loop.
+         */
+        template <typename DT_>
+        static void apply(DT_ * r, const DT_ alpha, const DT_ * const x, const DT_ beta, const DT_ * const y,
+          const DT_ * const coeffs, const Index nx, const Index ny, const Index nz)
+        {
+          RegionTimer::Scope region("arch-apply-stencil", [&]{ return Intern::StencilWork::apply(r, nx, ny, nz); });
+          apply_generic(r, alpha, x, beta, y, coeffs, nx, ny, nz);
+        }
+
+        template <typename DT_>
+        static void apply_generic(DT_ * r, const DT_ alpha, const DT_ * const x, const DT_ beta, const DT_ * const y,
+          const DT_ * const coeffs, const Index nx, const Index ny, const Index nz);
+
+        /**
+         * \brief Performs several temporally blocked smoothing steps
+         *
+         * Each step k = 0,...,steps-1 performs
+         * \f[ c \leftarrow \beta_k c + \alpha_k (b - A x), \qquad x \leftarrow x + c, \f]
+         * which covers damped Jacobi (beta_k = 0) as well as Chebyshev smoothing.
+         * The steps are interleaved in a wavefront over the z-planes, so that each plane of x is read
+         * and written only once for all steps; the intermediate iterates are kept in small ring buffers
+         * of three planes per step.
+         */
+        template <typename DT_>
+        static void smooth(DT_ * x, DT_ * c, const DT_ * const b, const DT_ * const coeffs,
+          const DT_ * const alphas, const DT_ * const betas, const Index steps,
+          const Index nx, const Index ny, const Index nz)
+        {
+          RegionTimer::Scope region("arch-smooth-stencil", [&]{ return Intern::StencilWork::smooth(x, steps, nx, ny, nz); });
+          smooth_generic(x, c, b, coeffs, alphas, betas, steps, nx, ny, nz);
+        }
+
+        template <typename DT_>
+        static void smooth_generic(DT_ * x, DT_ * c, const DT_ * const b, const DT_ * const coeffs,
+          const DT_ * const alphas, const DT_ * const betas, const Index steps,
+          const Index nx, const Index ny, const Index nz);
+      };
+
+#ifdef FEAT_EICKT
+      extern template void Stencil<Mem::Main>::apply_generic(float *, const float, const float * const, const float, const float * const,
+        const float * const, const Index, const Index, const Index);
+      extern template void Stencil<Mem::Main>::apply_generic(double *, const double, const double * const, const double, const double * const,
+        const double * const, const Index, const Index, const Index);
+
+      extern template void Stencil<Mem::Main>::smooth_generic(float *, float *, const float * const, const float * const,
+        const float * const, const float * const, const Index, const Index, const Index, const Index);
+      extern template void Stencil<Mem::Main>::smooth_generic(double *, double *, const double * const, const double * const,
+        const double * const, const double * const, const Index, const Index, const Index, const Index);
+#endif
+
+    } // namespace Arch
+  } // namespace LAFEM
+} // namespace FEAT
+
+#ifndef  __CUDACC__
+#include <kernel/lafem/arch/stencil_generic.hpp>
+#endif
+#endif // KERNEL_LAFEM_ARCH_STENCIL_HPP
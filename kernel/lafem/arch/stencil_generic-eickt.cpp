@@ -0,0 +1,23 @@
+// FEAT3: Finite Element Analysis Toolbox, Version 3
+// Copyright (C) 2010 - 2020 by Stefan Turek & the FEAT group
+// FEAT3 is released under the GNU General Public License version 3,
+// see the file 'copyright.txt' in the top level directory for details.
+
+// includes, FEAT
+#include <kernel/base_header.hpp>
+#include <kernel/archs.hpp>
+#include <kernel/lafem/arch/stencil.hpp>
+
+using namespace FEAT;
+using namespace FEAT::LAFEM;
+using namespace FEAT::LAFEM::Arch;
+
+template void Stencil<Mem::Main>::apply_generic(float *, const float, const float * const, const float, const float * const,
+  const float * const, const Index, const Index, const Index);
+template void Stencil<Mem::Main>::apply_generic(double *, const double, const double * const, const double, const double * const,
+  const double * const, const Index, const Index, const Index);
+
+template void Stencil<Mem::Main>::smooth_generic(float *, float *, const float * const, const float * const,
+  const float * const, const float * const, const Index, const Index, const Index, const Index);
+template void Stencil<Mem::Main>::smooth_generic(double *, double *, const double * const, const double * const,
+  const double * const, const double * const, const Index, const Index, const Index, const Index);
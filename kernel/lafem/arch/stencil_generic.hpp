@@ -0,0 +1,187 @@
+// FEAT3: Finite Element Analysis Toolbox, Version 3
+// Copyright (C) 2010 - 2020 by Stefan Turek & the FEAT group
+// FEAT3 is released under the GNU General Public License version 3,
+// see the file 'copyright.txt' in the top level directory for details.
+
+#pragma once
+#ifndef KERNEL_LAFEM_ARCH_STENCIL_GENERIC_HPP
+#define KERNEL_LAFEM_ARCH_STENCIL_GENERIC_HPP 1
+
+#ifndef KERNEL_LAFEM_ARCH_STENCIL_HPP
+#error "Do not include this implementation-only header file directly!"
+#endif
+
+#include <kernel/util/math.hpp>
+#include <kernel/util/memory_pool.hpp>
+
+#include <vector>
+
+namespace FEAT
+{
+  namespace LAFEM
+  {
+    namespace Arch
+    {
+      /// \cond internal
+      namespace Intern
+      {
+        namespace StencilLine
+        {
+          /**
+           * \brief Applies the stencil to a single x-line
+           *
+           * The neighbour lines \p yl, \p yu, \p zl and \p zu point to a line of zeros if the
+           * corresponding neighbour does not exist, so that the inner loop is free of branches.
+           */
+          template <typename DT_>
+          inline void apply(DT_ * t, const DT_ * const xc, const DT_ * const yl, const DT_ * const yu,
+            const DT_ * const zl, const DT_ * const zu, const DT_ * const coeffs, const Index nx)
+          {
+            const DT_ c0(coeffs[0]), c1(coeffs[1]), c2(coeffs[2]), c3(coeffs[3]);
+            const DT_ c4(coeffs[4]), c5(coeffs[5]), c6(coeffs[6]);
+
+            if(nx == Index(1))
+            {
+              t[0] = c0*xc[0] + c3*yl[0] + c4*yu[0] + c5*zl[0] + c6*zu[0];
+              return;
+            }
+
+            t[0] = c0*xc[0] + c2*xc[1] + c3*yl[0] + c4*yu[0] + c5*zl[0] + c6*zu[0];
+            for(Index i(1); i + 1 < nx; ++i)
+            {
+              t[i] = c1*xc[i-1] + c0*xc[i] + c2*xc[i+1] + c3*yl[i] + c4*yu[i] + c5*zl[i] + c6*zu[i];
+            }
+            const Index l(nx - 1);
+            t[l] = c1*xc[l-1] + c0*xc[l] + c3*yl[l] + c4*yu[l] + c5*zl[l] + c6*zu[l];
+          }
+        } // namespace StencilLine
+      } // namespace Intern
+      /// \endcond
+
+      template <typename DT_>
+      void Stencil<Mem::Main>::apply_generic(DT_ * r, const DT_ alpha, const DT_ * const x, const DT_ beta, const DT_ * const y,
+        const DT_ * const coeffs, const Index nx, const Index ny, const Index nz)
+      {
+        const Index np(nx * ny);
+        const bool use_y(Math::abs(beta) >= Math::eps<DT_>());
+        std::vector<DT_> zero(nx, DT_(0)), t(nx);
+
+        // number of y-lines per block, chosen such that three planes of a block fit into 256 KB
+        const Index by = Math::max(Index(1), (Index(1) << 18) / (Index(3) * nx * Index(sizeof(DT_))));
+
+        for(Index y0(0); y0 < ny; y0 += by)
+        {
+          const Index y1(Math::min(y0 + by, ny));
+          for(Index iz(0); iz < nz; ++iz)
+          {
+            for(Index iy(y0); iy < y1; ++iy)
+            {
+              const Index k(iz * np + iy * nx);
+              const DT_ * const xc = x + k;
+              const DT_ * const yl = (iy > Index(0) ? xc - nx : zero.data());
+              const DT_ * const yu = (iy + 1 < ny ? xc + nx : zero.data());
+              const DT_ * const zl = (iz > Index(0) ? xc - np : zero.data());
+              const DT_ * const zu = (iz + 1 < nz ? xc + np : zero.data());
+              Intern::StencilLine::apply(t.data(), xc, yl, yu, zl, zu, coeffs, nx);
+
+              DT_ * const rk = r + k;
+              if(use_y)
+              {
+                const DT_ * const yk = y + k;
+                for(Index i(0); i < nx; ++i)
+                  rk[i] = beta * yk[i] + alpha * t[i];
+              }
+              else
+              {
+                for(Index i(0); i < nx; ++i)
+                  rk[i] = alpha * t[i];
+              }
+            }
+          }
+        }
+      }
+
+      template <typename DT_>
+      void Stencil<Mem::Main>::smooth_generic(DT_ * x, DT_ * c, const DT_ * const b, const DT_ * const coeffs,
+        const DT_ * const alphas, const DT_ * const betas, const Index steps,
+        const Index nx, const Index ny, const Index nz)
+      {
+        if(steps == Index(0))
+          return;
+
+        const Index np(nx * ny);
+        std::vector<DT_> zero(nx, DT_(0)), t(nx);
+
+        // ring buffers holding the last three planes of x and c computed by each step
+        std::vector<DT_> xring(Index(3) * steps * np), cring(Index(3) * steps * np);
+        auto xplane = [&](Index s, Index iz) -> DT_* {return xring.data() + (Index(3) * s + iz % Index(3)) * np;};
+        auto cplane = [&](Index s, Index iz) -> DT_* {return cring.data() + (Index(3) * s + iz % Index(3)) * np;};
+
+        // wavefront: at time it, step s processes plane it - s, which requires the planes
+        // it - s - 1, it - s and it - s + 1 of step s - 1, which have all been computed by now
+        for(Index it(0); it < nz + steps; ++it)
+        {
+          for(Index s(0); (s < steps) && (s <= it); ++s)
+          {
+            const Index iz(it - s);
+            if(iz >= nz)
+              continue;
+
+            const DT_ * src_c(nullptr), * src_l(nullptr), * src_u(nullptr), * src_cor(nullptr);
+            if(s == Index(0))
+            {
+              src_c = x + iz * np;
+              src_l = (iz > Index(0) ? src_c - np : nullptr);
+              src_u = (iz + 1 < nz ? src_c + np : nullptr);
+              src_cor = c + iz * np;
+            }
+            else
+            {
+              src_c = xplane(s - 1, iz);
+              src_l = (iz > Index(0) ? xplane(s - 1, iz - 1) : nullptr);
+              src_u = (iz + 1 < nz ? xplane(s - 1, iz + 1) : nullptr);
+              src_cor = cplane(s - 1, iz);
+            }
+            DT_ * const dst_x = xplane(s, iz);
+            DT_ * const dst_c = cplane(s, iz);
+            const DT_ * const bz = b + iz * np;
+            const DT_ alpha(alphas[s]), beta(betas[s]);
+
+            for(Index iy(0); iy < ny; ++iy)
+            {
+              const Index k(iy * nx);
+              const DT_ * const xc = src_c + k;
+              const DT_ * const yl = (iy > Index(0) ? xc - nx : zero.data());
+              const DT_ * const yu = (iy + 1 < ny ? xc + nx : zero.data());
+              const DT_ * const zl = (src_l != nullptr ? src_l + k : zero.data());
+              const DT_ * const zu = (src_u != nullptr ? src_u + k : zero.data());
+              Intern::StencilLine::apply(t.data(), xc, yl, yu, zl, zu, coeffs, nx);
+
+              const DT_ * const ck = src_cor + k;
+              const DT_ * const bk = bz + k;
+              DT_ * const xk = dst_x + k;
+              DT_ * const dk = dst_c + k;
+              for(Index i(0); i < nx; ++i)
+              {
+                const DT_ cor = beta * ck[i] + alpha * (bk[i] - t[i]);
+                dk[i] = cor;
+                xk[i] = xc[i] + cor;
+              }
+            }
+          }
+
+          // write back the plane of the last step, which is not required by the first step anymore
+          if(it >= steps)
+          {
+            const Index iz(it - steps);
+            MemoryPool<Mem::Main>::copy(x + iz * np, xplane(steps - 1, iz), np);
+            MemoryPool<Mem::Main>::copy(c + iz * np, cplane(steps - 1, iz), np);
+          }
+        }
+      }
+
+    } // namespace Arch
+  } // namespace LAFEM
+} // namespace FEAT
+
+#endif // KERNEL_LAFEM_ARCH_STENCIL_GENERIC_HPP
@@ -17,6 +17,10 @@
 
 // includes, FEAT
 #include <kernel/base_header.hpp>
+#include <kernel/util/assertion.hpp>
+
+// includes, system
+#include <cstdint>
 
 namespace FEAT
 {
@@ -98,6 +102,126 @@ namespace FEAT
       disabled = 0, /**< do not use memory pinning */
       enabled /** < enable memory pinning (for fast device <-> host transfers) */
     };
+
+    /**
+     * Supported compression modes for serialised container arrays.
+     *
+     * The modes can be combined by the bit-wise OR operator.
+     */
+    enum class CompressionModes : std::uint64_t
+    {
+      None = 0x0, /**< store all arrays uncompressed */
+      indices_zlib = 0x1, /**< store index arrays delta encoded and zlib compressed (lossless) */
+      elements_zlib = 0x2, /**< store value arrays zlib compressed (lossless) */
+      elements_zfp = 0x4 /**< store value arrays zfp compressed (lossy) */
+    };
+
+    /// bit-wise OR operator for CompressionModes
+    inline CompressionModes operator|(CompressionModes a, CompressionModes b)
+    {
+      return (CompressionModes)(((std::uint64_t)a) | ((std::uint64_t)b));
+    }
+
+    /// bit-wise AND operator for CompressionModes
+    inline CompressionModes operator&(CompressionModes a, CompressionModes b)
+    {
+      return (CompressionModes)(((std::uint64_t)a) & ((std::uint64_t)b));
+    }
+
+    /**
+     * \brief Serialisation configuration
+     *
+     * This class describes how the arrays of a container are stored by the serialisation and checkpoint
+     * routines. Index arrays can be delta encoded and compressed losslessly by zlib, whereas value arrays
+     * can either be compressed losslessly by zlib or lossy by zfp with a given absolute error tolerance.
+     *
+     * Compression modes, which are not supported by the current build, are dropped silently by
+     * get_compression(), i.e. a zfp request falls back to zlib and a zlib request falls back to raw storage.
+     * Thus, the same configuration can be used on every build; the resulting data is always self-describing.
+     */
+    class SerialConfig
+    {
+    private:
+      /// the requested compression modes
+      CompressionModes _modes;
+      /// the absolute error tolerance for lossy compression
+      double _tolerance;
+
+    public:
+      /**
+       * \brief Constructor
+       *
+       * \param[in] indices_zlib Compress index arrays by delta encoding and zlib?
+       * \param[in] elements_zlib Compress value arrays by zlib?
+       * \param[in] tolerance The absolute error tolerance for lossy zfp compression of value arrays; zero disables zfp.
+       */
+      explicit SerialConfig(bool indices_zlib = false, bool elements_zlib = false, double tolerance = 0.0) :
+        _modes(CompressionModes::None),
+        _tolerance(0.0)
+      {
+        set_indices_compression(indices_zlib);
+        set_elements_compression(elements_zlib, tolerance);
+      }
+
+      /// Enables or disables the lossless compression of index arrays.
+      void set_indices_compression(bool zlib)
+      {
+        _modes = (_modes & (CompressionModes::elements_zlib | CompressionModes::elements_zfp));
+        if(zlib)
+          _modes = _modes | CompressionModes::indices_zlib;
+      }
+
+      /**
+       * \brief Sets the compression of value arrays.
+       *
+       * \param[in] zlib Compress value arrays losslessly by zlib?
+       * \param[in] tolerance The absolute error tolerance for lossy zfp compression; zero disables zfp.
+       * If zfp is enabled, it takes precedence over zlib for floating point arrays.
+       */
+      void set_elements_compression(bool zlib, double tolerance = 0.0)
+      {
+        XASSERTM(tolerance >= 0.0, "zfp tolerance must not be negative");
+        _modes = (_modes & CompressionModes::indices_zlib);
+        if(zlib)
+          _modes = _modes | CompressionModes::elements_zlib;
+        if(tolerance > 0.0)
+          _modes = _modes | CompressionModes::elements_zfp;
+        _tolerance = tolerance;
+      }
+
+      /// \returns The absolute error tolerance for lossy compression.
+      double get_tolerance() const
+      {
+        return _tolerance;
+      }
+
+      /// \returns The requested compression modes, regardless of the support of the current build.
+      CompressionModes get_requested_compression() const
+      {
+        return _modes;
+      }
+
+      /// \returns The compression modes that are supported by the current build.
+      CompressionModes get_compression() const
+      {
+        CompressionModes modes(_modes);
+#ifndef FEAT_HAVE_ZFP
+        // fall back to lossless compression
+        if((modes & CompressionModes::elements_zfp) != CompressionModes::None)
+          modes = (modes & CompressionModes::indices_zlib) | CompressionModes::elements_zlib;
+#endif // FEAT_HAVE_ZFP
+#ifndef FEAT_HAVE_ZLIB
+        modes = (modes & CompressionModes::elements_zfp);
+#endif // FEAT_HAVE_ZLIB
+        return modes;
+      }
+
+      /// \returns \c true, if any array is compressed by the current build, otherwise \c false.
+      bool is_compressed() const
+      {
+        return get_compression() != CompressionModes::None;
+      }
+    }; // class SerialConfig
   } // namespace LAFEM
 } // namespace FEAT
 
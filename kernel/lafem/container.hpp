@@ -14,7 +14,7 @@
 #include <kernel/lafem/base.hpp>
 #include <kernel/util/type_traits.hpp>
 #include <kernel/util/random.hpp>
-
+#include <kernel/util/pack.hpp>
 
 #include <vector>
 #include <limits>
@@ -312,16 +312,46 @@ namespace FEAT
        /**
        * \brief Calculation of the serialised size of complete container entity.
        *
+       * \param[in] config LAFEM::SerialConfig, a struct describing the serialise configuration.
+       *
        * \return An unsigned int containing the size of serialised container.
        *
        * Calculate the size of the serialised container entity.
+       *
+       * \note If \p config enables compression, the returned size is an upper bound of the size of the serialised container.
        */
       template <typename DT2_ = DT_, typename IT2_ = IT_>
-      uint64_t _serialised_size() const
+      uint64_t _serialised_size(const SerialConfig& config = SerialConfig()) const
       {
         Container<Mem::Main, DT2_, IT2_> tc(0);
         tc.assign(*this);
 
+        if (config.is_compressed())
+        {
+          const CompressionModes modes(config.get_compression());
+          const Pack::Type dt_type(_elements_pack_type<DT2_>(modes));
+          const Pack::Type it_type(_indices_pack_type<IT2_>(modes));
+
+          uint64_t gsize(10 * sizeof(uint64_t)); // header, see _serialise
+          gsize += tc._elements_size.size() * sizeof(uint64_t); // _elements_size contents
+          gsize += tc._indices_size.size() * sizeof(uint64_t); // _indices_size contents
+          gsize += tc._scalar_index.size() * sizeof(uint64_t); // _scalar_index contents
+          gsize += tc._scalar_dt.size() * sizeof(DT2_); // _scalar_dt contents
+
+          for (Index i(0) ; i < tc._elements_size.size() ; ++i)
+          {
+            gsize += 2 * sizeof(uint64_t); // pack type + packed size
+            gsize += Pack::estimate_size(tc._elements_size.at(i), dt_type, config.get_tolerance());
+          }
+          for (Index i(0) ; i < tc._indices_size.size() ; ++i)
+          {
+            gsize += 2 * sizeof(uint64_t); // pack type + packed size
+            gsize += Pack::estimate_size(tc._indices_size.at(i), it_type);
+          }
+
+          return gsize;
+        }
+
         uint64_t gsize(4 * sizeof(uint64_t)); //raw array size + magic number + type_index DT_ + type_index IT_
         gsize += 6 * sizeof(uint64_t); // size of all six stl containers
         gsize += tc._elements_size.size() * sizeof(uint64_t); // _elements_size contents
@@ -346,6 +376,7 @@ namespace FEAT
        * \brief Serialisation of complete container entity.
        *
        * \param[in] mode FileMode enum, describing the actual container specialisation.
+       * \param[in] config LAFEM::SerialConfig, a struct describing the serialise configuration.
        * \returns A std::vector, containing the byte array.
        *
        * Serialize a complete container entity into a single binary array.
@@ -370,10 +401,23 @@ namespace FEAT
        * _elements arrays (DT2_)
        * _indices arrays (IT2_)
        * \endcode
+       *
+       * If \p config enables any compression, which is supported by the current build, the enabled
+       * CompressionModes are stored in the upper 32 bits of the magic number and each _elements and
+       * _indices array is stored as a Pack buffer instead:
+       * \code
+       * Pack::Type of the array (uint64_t)
+       * packed size in bytes (uint64_t)
+       * packed array, index arrays are delta encoded before compression
+       * \endcode
+       * In this case, the raw array size is the actual (unpadded) size of the serialised container.
        */
       template <typename DT2_ = DT_, typename IT2_ = IT_>
-      std::vector<char> _serialise(FileMode mode) const
+      std::vector<char> _serialise(FileMode mode, const SerialConfig& config = SerialConfig()) const
       {
+        if (config.is_compressed())
+          return this->template _serialise_packed<DT2_, IT2_>(mode, config);
+
         Container<Mem::Main, DT2_, IT2_> tc(0);
         tc.assign(*this);
 
@@ -451,13 +495,14 @@ namespace FEAT
        *
        * \param[in] mode FileMode enum, describing the actual container specialisation.
        * \param[in] file The output stream to write data into.
+       * \param[in] config LAFEM::SerialConfig, a struct describing the serialise configuration.
        *
        * Serialize a complete container entity into a single binary file.
        */
       template <typename DT2_ = DT_, typename IT2_ = IT_>
-      void _serialise(FileMode mode, std::ostream & file) const
+      void _serialise(FileMode mode, std::ostream & file, const SerialConfig& config = SerialConfig()) const
       {
-        auto temp(this->template _serialise<DT2_, IT2_>(mode));
+        auto temp(this->template _serialise<DT2_, IT2_>(mode, config));
         file.write(temp.data(), long(temp.size()));
         if (!file.good())
           throw InternalError(__func__, __FILE__, __LINE__, "Error in _serialise - file ostream is not good anymore!");
@@ -489,7 +534,7 @@ namespace FEAT
 #else
         uint64_t magic = (uint64_t)static_cast<typename std::underlying_type<FileMode>::type>(mode);
 #endif
-        XASSERTM(magic == uiarray[1], "_deserialise: given FileMode incompatible with given array!");
+        XASSERTM(magic == (uiarray[1] & 0xFFFFFFFFu), "_deserialise: given FileMode incompatible with given array!");
 
         //ensure that we have the same integral/floating type configuration, that was used when storing the serialised data
         XASSERT(Type::Traits<DT_>::is_int == Type::Helper::extract_intness(uiarray[2]));
@@ -505,6 +550,13 @@ namespace FEAT
         if (sizeof(IT_) > Type::Helper::extract_type_size(uiarray[3]))
           std::cerr<<"Warning: You are reading a container integral type in higher precision then it was saved before!"<<std::endl;
 
+        // packed arrays are stored in a different layout
+        if ((uiarray[1] >> 32) != 0u)
+        {
+          this->template _deserialise_packed<DT2_, IT2_>(input);
+          return;
+        }
+
         Index global_i(10);
         for (uint64_t i(0) ; i < uiarray[6] ; ++i)
         {
@@ -570,6 +622,197 @@ namespace FEAT
         this->template _deserialise<DT2_, IT2_>(mode, temp);
       }
 
+      /// Returns the pack type of the value arrays for the given compression modes.
+      template <typename DT2_>
+      static Pack::Type _elements_pack_type(CompressionModes modes)
+      {
+        const Pack::Type raw_type(Pack::deduct_type<DT2_>());
+        XASSERTM(raw_type != Pack::Type::None, "container data type can not be packed");
+        if (((modes & CompressionModes::elements_zfp) != CompressionModes::None) &&
+          ((raw_type == Pack::Type::F32) || (raw_type == Pack::Type::F64)))
+          return raw_type | Pack::Type::Mask_P;
+#ifdef FEAT_HAVE_ZLIB
+        // zfp supports single and double precision only, all other types fall back to zlib
+        if ((modes & (CompressionModes::elements_zlib | CompressionModes::elements_zfp)) != CompressionModes::None)
+          return raw_type | Pack::Type::Mask_Z;
+#endif // FEAT_HAVE_ZLIB
+        return raw_type;
+      }
+
+      /// Returns the pack type of the index arrays for the given compression modes.
+      template <typename IT2_>
+      static Pack::Type _indices_pack_type(CompressionModes modes)
+      {
+        const Pack::Type raw_type(Pack::deduct_type<IT2_>());
+        XASSERTM(raw_type != Pack::Type::None, "container index type can not be packed");
+        if ((modes & CompressionModes::indices_zlib) != CompressionModes::None)
+          return raw_type | Pack::Type::Mask_Z;
+        return raw_type;
+      }
+
+      /**
+       * \brief Serialisation of complete container entity with packed arrays.
+       *
+       * \param[in] mode FileMode enum, describing the actual container specialisation.
+       * \param[in] config LAFEM::SerialConfig, a struct describing the serialise configuration.
+       * \returns A std::vector, containing the byte array.
+       *
+       * See \ref _serialise for the data layout.
+       */
+      template <typename DT2_, typename IT2_>
+      std::vector<char> _serialise_packed(FileMode mode, const SerialConfig& config) const
+      {
+        Container<Mem::Main, DT2_, IT2_> tc(0);
+        tc.assign(*this);
+
+        const CompressionModes modes(config.get_compression());
+        const Pack::Type dt_type(_elements_pack_type<DT2_>(modes));
+        const Pack::Type it_type(_indices_pack_type<IT2_>(modes));
+
+        std::vector<char> result((size_t(this->template _serialised_size<DT2_, IT2_>(config))));
+        char * array(result.data());
+        std::size_t pos(0);
+
+        auto put = [&array, &pos] (uint64_t value)
+        {
+          std::memcpy(array + pos, &value, sizeof(uint64_t));
+          pos += sizeof(uint64_t);
+        };
+
+        /// \compilerhack clang seems to use older libc++ without std::underlying_type
+#if defined(FEAT_COMPILER_CLANG)
+        uint64_t magic = (uint64_t)static_cast<__underlying_type(FileMode)>(mode);
+#else
+        uint64_t magic = (uint64_t)static_cast<typename std::underlying_type<FileMode>::type>(mode);
+#endif
+        put(0u); // final size, set below
+        put(magic | (uint64_t(modes) << 32));
+        put(Type::Traits<DT_>::feature_hash());
+        put(Type::Traits<IT_>::feature_hash());
+        put(tc._elements.size());
+        put(tc._indices.size());
+        put(tc._elements_size.size());
+        put(tc._indices_size.size());
+        put(tc._scalar_index.size());
+        put(tc._scalar_dt.size());
+
+        for (Index i(0) ; i < tc._elements_size.size() ; ++i)
+          put(tc._elements_size.at(i));
+        for (Index i(0) ; i < tc._indices_size.size() ; ++i)
+          put(tc._indices_size.at(i));
+        for (Index i(0) ; i < tc._scalar_index.size() ; ++i)
+          put(tc._scalar_index.at(i));
+
+        if (!tc._scalar_dt.empty())
+          std::memcpy(array + pos, tc._scalar_dt.data(), tc._scalar_dt.size() * sizeof(DT2_));
+        pos += tc._scalar_dt.size() * sizeof(DT2_);
+
+        for (Index i(0) ; i < tc._elements.size() ; ++i)
+        {
+          put(uint64_t(dt_type));
+          const std::size_t bytes = Pack::encode(array + pos + sizeof(uint64_t), tc._elements.at(i),
+            result.size() - pos - sizeof(uint64_t), tc._elements_size.at(i), dt_type, false, config.get_tolerance());
+          put(bytes);
+          pos += bytes;
+        }
+
+        std::vector<IT2_> delta;
+        for (Index i(0) ; i < tc._indices.size() ; ++i)
+        {
+          const Index n(tc._indices_size.at(i));
+          const IT2_ * indices(tc._indices.at(i));
+          if ((it_type & Pack::Type::Mask_Z) != Pack::Type::None)
+          {
+            // delta encoding turns sorted index arrays into small numbers, which compress a lot better
+            delta.resize(n);
+            for (Index j(0) ; j < n ; ++j)
+              delta[j] = (j > 0 ? IT2_(indices[j] - indices[j-1]) : indices[j]);
+            indices = delta.data();
+          }
+          put(uint64_t(it_type));
+          const std::size_t bytes = Pack::encode(array + pos + sizeof(uint64_t), indices,
+            result.size() - pos - sizeof(uint64_t), n, it_type, false);
+          put(bytes);
+          pos += bytes;
+        }
+
+        result.resize(pos);
+        uint64_t gsize(pos);
+        std::memcpy(array, &gsize, sizeof(uint64_t));
+        return result;
+      }
+
+      /**
+       * \brief Deserialisation of complete container entity with packed arrays.
+       *
+       * \param[in] input A std::vector containing the byte array.
+       *
+       * \note The magic number and the data types have already been checked by \ref _deserialise.
+       */
+      template <typename DT2_, typename IT2_>
+      void _deserialise_packed(std::vector<char> & input)
+      {
+        Container<Mem::Main, DT2_, IT2_> tc(0);
+        tc.clear();
+
+        char * array(input.data());
+        std::size_t pos(0);
+
+        auto get = [&array, &pos] () -> uint64_t
+        {
+          uint64_t value;
+          std::memcpy(&value, array + pos, sizeof(uint64_t));
+          pos += sizeof(uint64_t);
+          return value;
+        };
+
+        uint64_t header[10];
+        for (int i(0) ; i < 10 ; ++i)
+          header[i] = get();
+
+        for (uint64_t i(0) ; i < header[6] ; ++i)
+          tc._elements_size.push_back(Index(get()));
+        for (uint64_t i(0) ; i < header[7] ; ++i)
+          tc._indices_size.push_back(Index(get()));
+        for (uint64_t i(0) ; i < header[8] ; ++i)
+          tc._scalar_index.push_back(Index(get()));
+
+        tc._scalar_dt.resize(size_t(header[9]));
+        if (!tc._scalar_dt.empty())
+          std::memcpy(tc._scalar_dt.data(), array + pos, tc._scalar_dt.size() * sizeof(DT2_));
+        pos += tc._scalar_dt.size() * sizeof(DT2_);
+
+        for (Index i(0) ; i < Index(header[4]) ; ++i)
+        {
+          const Index n(tc._elements_size.at(i));
+          const Pack::Type type = Pack::Type(get());
+          const std::size_t bytes = std::size_t(get());
+          tc._elements.push_back(MemoryPool<Mem::Main>::template allocate_memory<DT2_>(n));
+          Pack::decode(tc._elements.back(), array + pos, n, bytes, type, false);
+          pos += bytes;
+        }
+
+        for (Index i(0) ; i < Index(header[5]) ; ++i)
+        {
+          const Index n(tc._indices_size.at(i));
+          const Pack::Type type = Pack::Type(get());
+          const std::size_t bytes = std::size_t(get());
+          tc._indices.push_back(MemoryPool<Mem::Main>::template allocate_memory<IT2_>(n));
+          IT2_ * indices(tc._indices.back());
+          Pack::decode(indices, array + pos, n, bytes, type, false);
+          pos += bytes;
+          // undo the delta encoding of compressed index arrays
+          if ((type & Pack::Type::Mask_Z) != Pack::Type::None)
+          {
+            for (Index j(1) ; j < n ; ++j)
+              indices[j] = IT2_(indices[j] + indices[j-1]);
+          }
+        }
+
+        XASSERTM(pos <= input.size(), "_deserialise: packed array exceeds the given input!");
+        this->assign(tc);
+      }
+
     public:
       /**
        * \brief Constructor
@@ -790,10 +1033,10 @@ namespace FEAT
         this->_foreign_memory = other._foreign_memory;
       }
 
-      /// \copydoc FEAT::Control::Checkpointable::get_checkpoint_size()
-      uint64_t get_checkpoint_size()
+      /// \copydoc FEAT::Control::Checkpointable::get_checkpoint_size(const LAFEM::SerialConfig&)
+      uint64_t get_checkpoint_size(const SerialConfig& config)
       {
-        return this->template _serialised_size<>();
+        return this->template _serialised_size<>(config);
       }
 
       /// \copydoc FEAT::Control::Checkpointable::restore_from_checkpoint_data(std::vector<char>&)
@@ -802,11 +1045,12 @@ namespace FEAT
         this->template _deserialise<>(FileMode::fm_binary, data);
       }
 
-      /// \copydoc FEAT::Control::Checkpointable::set_checkpoint_data(std::vector<char>&)
-      void set_checkpoint_data(std::vector<char>& data)
+      /// \copydoc FEAT::Control::Checkpointable::set_checkpoint_data(std::vector<char>&,const LAFEM::SerialConfig&)
+      uint64_t set_checkpoint_data(std::vector<char>& data, const SerialConfig& config)
       {
-        auto buffer = this->template _serialise<>(FileMode::fm_binary);
+        auto buffer = this->template _serialise<>(FileMode::fm_binary, config);
         data.insert(std::end(data), std::begin(buffer), std::end(buffer));
+        return buffer.size();
       }
 
       /**
@@ -187,6 +187,13 @@ public:
         TEST_CHECK_EQUAL_WITHIN_EPS(o(i), k(i), DT_(1e-5));
     }
 
+    {
+      auto op = k.serialise(SerialConfig(false, false, 1e-4));
+      DenseVector<Mem_, DT_, IT_> o(op);
+      for (Index i(0) ; i < k.size() ; ++i)
+        TEST_CHECK_EQUAL_WITHIN_EPS(o(i), k(i), DT_(1e-4));
+    }
+
     // new clone testing
     auto clone1 = a.clone(CloneMode::Deep);
     TEST_CHECK_EQUAL(clone1, a);
@@ -17,6 +17,7 @@
   #include <kernel/lafem/container.hpp>
   #include <kernel/lafem/dense_vector_blocked.hpp>
   #include <kernel/lafem/edi.hpp>
+  #include <kernel/lafem/mtx_reader.hpp>
   #include <kernel/lafem/arch/component_invert.hpp>
   #include <kernel/lafem/arch/dot_product.hpp>
   #include <kernel/lafem/arch/norm.hpp>
@@ -137,6 +138,23 @@ namespace FEAT
         }
       }; // class GatherAxpy
 
+    private:
+      /// reads in the vector from a Matrix Market or exp input buffer
+      void _read_from_text(FileMode mode, const TextInput& input)
+      {
+        std::vector<DT_> data;
+        if (mode == FileMode::fm_mtx)
+          MtxReader::read_array(input, data);
+        else
+          MtxReader::read_values(input.begin(), input.end(), '#', data);
+
+        this->clear();
+        this->_scalar_index.push_back(Index(data.size()));
+        this->_elements.push_back(MemoryPool<Mem_>::template allocate_memory<DT_>(Index(data.size())));
+        this->_elements_size.push_back(Index(data.size()));
+        MemoryPool<Mem_>::template upload<DT_>(this->_elements.at(0), data.data(), Index(data.size()));
+      }
+
     public:
       /// Our datatype
       typedef DT_ DataType;
@@ -494,14 +512,16 @@ namespace FEAT
        *
        * \returns A std::vector, containing the byte array.
        *
+       * \param[in] config LAFEM::SerialConfig, a struct describing the serialise configuration.
+       *
        * Serialize a complete container entity into a single binary array.
        *
        * See \ref FEAT::LAFEM::Container::_serialise for details.
        */
       template <typename DT2_ = DT_, typename IT2_ = IT_>
-      std::vector<char> serialise()
+      std::vector<char> serialise(const LAFEM::SerialConfig& config = LAFEM::SerialConfig())
       {
-        return this->template _serialise<DT2_, IT2_>(FileMode::fm_dv);
+        return this->template _serialise<DT2_, IT2_>(FileMode::fm_dv, config);
       }
 
       /**
@@ -586,10 +606,13 @@ namespace FEAT
 
       void read_from(FileMode mode, String filename)
       {
-        std::ios_base::openmode bin = std::ifstream::in | std::ifstream::binary;
-        if (mode == FileMode::fm_mtx)
-          bin = std::ifstream::in;
-        std::ifstream file(filename.c_str(), bin);
+        if (mode == FileMode::fm_mtx || mode == FileMode::fm_exp)
+        {
+          TextInput input(filename);
+          _read_from_text(mode, input);
+          return;
+        }
+        std::ifstream file(filename.c_str(), std::ifstream::in | std::ifstream::binary);
         if (! file.is_open())
           throw InternalError(__func__, __FILE__, __LINE__, "Unable to open Vector file " + filename);
         read_from(mode, file);
@@ -607,100 +630,10 @@ namespace FEAT
         switch (mode)
         {
         case FileMode::fm_mtx:
-        {
-          this->clear();
-          this->_scalar_index.push_back(0);
-
-          Index rows;
-          String line;
-          std::getline(file, line);
-          if (line.find("%%MatrixMarket matrix array real general") == String::npos)
-          {
-            throw InternalError(__func__, __FILE__, __LINE__, "Input-file is not a compatible mtx-vector-file");
-          }
-          while (! file.eof())
-          {
-            std::getline(file, line);
-            if (file.eof())
-              throw InternalError(__func__, __FILE__, __LINE__, "Input-file is empty");
-
-            String::size_type begin(line.find_first_not_of(" "));
-            if (line.at(begin) != '%')
-              break;
-          }
-          {
-            String::size_type begin(line.find_first_not_of(" "));
-            line.erase(0, begin);
-            String::size_type end(line.find_first_of(" "));
-            String srows(line, 0, end);
-            rows = (Index)atol(srows.c_str());
-            line.erase(0, end);
-
-            begin = line.find_first_not_of(" ");
-            line.erase(0, begin);
-            end = line.find_first_of(" ");
-            String scols(line, 0, end);
-            Index cols((Index)atol(scols.c_str()));
-            line.erase(0, end);
-            XASSERTM(cols == 1, "Input-file is no dense-vector-file");
-          }
-
-          DenseVector<Mem::Main, DT_, IT_> tmp(rows);
-          DT_ * pval(tmp.elements());
-
-          while (! file.eof())
-          {
-            std::getline(file, line);
-            if (file.eof())
-              break;
-
-            String::size_type begin(line.find_first_not_of(" "));
-            line.erase(0, begin);
-            String::size_type end(line.find_first_of(" "));
-            String sval(line, 0, end);
-            DT_ tval((DT_)atof(sval.c_str()));
-
-            *pval = tval;
-            ++pval;
-          }
-          this->assign(tmp);
-          break;
-        }
         case FileMode::fm_exp:
         {
-          this->clear();
-          this->_scalar_index.push_back(0);
-
-          std::vector<DT_> data;
-
-          while (! file.eof())
-          {
-            std::string line;
-            std::getline(file, line);
-            if (line.find("#", 0) < line.npos)
-              continue;
-            if (file.eof())
-              break;
-
-            std::string n_z_s;
-
-            std::string::size_type first_digit(line.find_first_not_of(" "));
-            line.erase(0, first_digit);
-            std::string::size_type eol(line.length());
-            for (unsigned long i(0); i < eol; ++i)
-            {
-              n_z_s.append(1, line[i]);
-            }
-
-            DT_ n_z((DT_)atof(n_z_s.c_str()));
-
-            data.push_back(n_z);
-          }
-
-          this->_scalar_index.at(0) = Index(data.size());
-          this->_elements.push_back(MemoryPool<Mem_>::template allocate_memory<DT_>(Index(data.size())));
-          this->_elements_size.push_back(Index(data.size()));
-          MemoryPool<Mem_>::template upload<DT_>(this->_elements.at(0), &data[0], Index(data.size()));
+          TextInput input(file);
+          _read_from_text(mode, input);
           break;
         }
         case FileMode::fm_dv:
@@ -773,3 +773,77 @@ DenseVectorBlockedPermuteTest<Mem::CUDA, double, unsigned int, 2> cuda_dv_permut
 DenseVectorBlockedPermuteTest<Mem::CUDA, float, unsigned long, 3> cuda_dv_permute_test_float_ulong;
 DenseVectorBlockedPermuteTest<Mem::CUDA, double, unsigned long, 3> cuda_dv_permute_test_double_ulong;
 #endif
+
+template<
+  typename Mem_,
+  typename DT_,
+  typename IT_,
+  int BS_>
+class DenseVectorBlockedColumnwiseTest
+  : public FullTaggedTest<Mem_, DT_, IT_>
+{
+public:
+  typedef DenseMultiVector<Mem_, DT_, IT_, BS_> VectorType;
+  typedef Tiny::Vector<DT_, BS_> ValueType;
+
+  DenseVectorBlockedColumnwiseTest()
+    : FullTaggedTest<Mem_, DT_, IT_>("DenseVectorBlockedColumnwiseTest")
+  {
+  }
+
+  virtual ~DenseVectorBlockedColumnwiseTest()
+  {
+  }
+
+  virtual void run() const override
+  {
+    const DT_ eps = Math::pow(Math::eps<DT_>(), DT_(0.7));
+    Random rng;
+
+    for (Index size(1) ; size < 1e3 ; size*=3)
+    {
+      VectorType a(rng, size, DT_(-1), DT_(1));
+      VectorType b(rng, size, DT_(-1), DT_(1));
+      VectorType c(rng, size, DT_(-1), DT_(1));
+      ValueType alpha;
+      for (int j(0) ; j < BS_ ; ++j)
+        alpha[j] = DT_(j + 1) - DT_(0.5) * DT_(BS_);
+
+      // compute references column by column
+      ValueType ref_dot(DT_(0)), ref_tdot(DT_(0));
+      for (Index i(0) ; i < size ; ++i)
+      {
+        for (int j(0) ; j < BS_ ; ++j)
+        {
+          ref_dot[j] += a(i)[j] * b(i)[j];
+          ref_tdot[j] += a(i)[j] * b(i)[j] * c(i)[j];
+        }
+      }
+
+      ValueType dot = a.dot_blocked(b);
+      ValueType tdot = c.triple_dot_blocked(a, b);
+      ValueType nsqr = a.norm2sqr_blocked();
+      DT_ nsum(0);
+      for (int j(0) ; j < BS_ ; ++j)
+      {
+        TEST_CHECK_EQUAL_WITHIN_EPS(dot[j], ref_dot[j], eps);
+        TEST_CHECK_EQUAL_WITHIN_EPS(tdot[j], ref_tdot[j], eps);
+        nsum += nsqr[j];
+      }
+      TEST_CHECK_EQUAL_WITHIN_EPS(nsum, a.norm2sqr(), eps * nsum);
+
+      VectorType r(size);
+      r.axpy_blocked(a, b, alpha);
+      for (Index i(0) ; i < size ; ++i)
+        for (int j(0) ; j < BS_ ; ++j)
+          TEST_CHECK_EQUAL_WITHIN_EPS(r(i)[j], alpha[j] * a(i)[j] + b(i)[j], eps);
+
+      r.scale_blocked(a, alpha);
+      for (Index i(0) ; i < size ; ++i)
+        for (int j(0) ; j < BS_ ; ++j)
+          TEST_CHECK_EQUAL_WITHIN_EPS(r(i)[j], alpha[j] * a(i)[j], eps);
+    }
+  }
+};
+DenseVectorBlockedColumnwiseTest<Mem::Main, float, unsigned int, 3> dv_columnwise_test_float_uint;
+DenseVectorBlockedColumnwiseTest<Mem::Main, double, unsigned long, 4> dv_columnwise_test_double_ulong;
@@ -494,14 +494,16 @@ namespace FEAT
        *
        * \returns A std::vector, containing the byte array.
        *
+       * \param[in] config LAFEM::SerialConfig, a struct describing the serialise configuration.
+       *
        * Serialize a complete container entity into a single binary array.
        *
        * See \ref FEAT::LAFEM::Container::_serialise for details.
        */
       template <typename DT2_ = DT_, typename IT2_ = IT_>
-      std::vector<char> serialise()
+      std::vector<char> serialise(const LAFEM::SerialConfig& config = LAFEM::SerialConfig())
       {
-        return this->template _serialise<DT2_, IT2_>(FileMode::fm_dvb);
+        return this->template _serialise<DT2_, IT2_>(FileMode::fm_dvb, config);
       }
 
       /**
@@ -982,6 +984,113 @@ namespace FEAT
         return Math::sqr(this->norm2());
       }
 
+      /**
+       * \brief Calculate the column-wise dot products of this and x
+       *
+       * Interprets both vectors as multi-vectors with BlockSize_ columns and returns the vector of
+       * the dot products of the corresponding columns, computed in a single sweep over the data.
+       *
+       * \param[in] x The other vector.
+       *
+       * \return The column-wise dot products.
+       */
+      ValueType dot_blocked(const DenseVectorBlocked & x) const
+      {
+        XASSERTM(x.size() == this->size(), "Vector size does not match!");
+
+        TimeStamp ts_start;
+
+        ValueType result;
+        Statistics::add_flops(this->size<Perspective::pod>() * 2);
+        Arch::DotProduct<Mem_>::template value_blocked<DT_, BlockSize_>(result.v, elements<Perspective::pod>(), x.template elements<Perspective::pod>(), this->size());
+
+        TimeStamp ts_stop;
+        Statistics::add_time_reduction(ts_stop.elapsed(ts_start));
+
+        return result;
+      }
+
+      /**
+       * \brief Calculate the column-wise triple dot products \f$x_j^T \mathrm{diag}(this_j) y_j \f$
+       *
+       * \param[in] x The first vector.
+       * \param[in] y The second vector.
+       *
+       * \return The column-wise triple dot products.
+       */
+      ValueType triple_dot_blocked(const DenseVectorBlocked & x, const DenseVectorBlocked & y) const
+      {
+        XASSERTM(x.size() == this->size(), "Vector size does not match!");
+        XASSERTM(y.size() == this->size(), "Vector size does not match!");
+
+        TimeStamp ts_start;
+
+        ValueType result;
+        Statistics::add_flops(this->size<Perspective::pod>() * 3);
+        Arch::TripleDotProduct<Mem_>::template value_blocked<DT_, BlockSize_>(result.v, elements<Perspective::pod>(),
+          x.template elements<Perspective::pod>(), y.template elements<Perspective::pod>(), this->size());
+
+        TimeStamp ts_stop;
+        Statistics::add_time_reduction(ts_stop.elapsed(ts_start));
+
+        return result;
+      }
+
+      /**
+       * \brief Calculates the column-wise squared euclid norms of this vector.
+       *
+       * \return The column-wise squared norms.
+       */
+      ValueType norm2sqr_blocked() const
+      {
+        return this->dot_blocked(*this);
+      }
+
+      /**
+       * \brief Calculate \f$this_j \leftarrow \alpha_j~ x_j + y_j\f$ for each column j
+       *
+       * \param[in] x The first summand vector to be scaled.
+       * \param[in] y The second summand vector
+       * \param[in] alpha The column-wise scalars to multiply x with.
+       */
+      void axpy_blocked(
+        const DenseVectorBlocked & x,
+        const DenseVectorBlocked & y,
+        const ValueType & alpha)
+      {
+        XASSERTM(x.size() == y.size(), "Vector size does not match!");
+        XASSERTM(x.size() == this->size(), "Vector size does not match!");
+
+        TimeStamp ts_start;
+
+        Statistics::add_flops(this->size<Perspective::pod>() * 2);
+        Arch::Axpy<Mem_>::template dv_blocked<DT_, BlockSize_>(elements<Perspective::pod>(), alpha.v,
+          x.template elements<Perspective::pod>(), y.template elements<Perspective::pod>(), this->size());
+
+        TimeStamp ts_stop;
+        Statistics::add_time_axpy(ts_stop.elapsed(ts_start));
+      }
+
+      /**
+       * \brief Calculate \f$this_j \leftarrow \alpha_j~ x_j \f$ for each column j
+       *
+       * \param[in] x The vector to be scaled.
+       * \param[in] alpha The column-wise scalars to scale x with.
+       */
+      void scale_blocked(const DenseVectorBlocked & x, const ValueType & alpha)
+      {
+        XASSERTM(x.size() == this->size(), "Vector size does not match!");
+
+        TimeStamp ts_start;
+
+        Arch::Scale<Mem_>::template value_blocked<DT_, BlockSize_>(elements<Perspective::pod>(),
+          x.template elements<Perspective::pod>(), alpha.v, this->size());
+        Statistics::add_flops(this->size<Perspective::pod>());
+
+        TimeStamp ts_stop;
+        Statistics::add_time_axpy(ts_stop.elapsed(ts_start));
+      }
+
       /**
        * \brief Retrieve the absolute maximum value of this vector.
        *
@@ -1115,6 +1224,18 @@ namespace FEAT
       }
     }; // class DenseVectorBlocked<...>
 
+    /**
+     * \brief Dense multi-vector
+     *
+     * A multi-vector stores NumCols_ vectors of equal length in row-major order, i.e. the NumCols_
+     * entries of each row are stored contiguously, which is exactly the layout of a DenseVectorBlocked
+     * with a block size of NumCols_. Applying a matrix to a multi-vector (see SparseMatrixCSR::apply and
+     * SparseMatrixBCSR::apply) streams the matrix only once for all columns, and the column-wise
+     * reductions (DenseVectorBlocked::dot_blocked etc.) compute all columns in a single sweep.
+     */
+    template <typename Mem_, typename DT_, typename IT_, int NumCols_>
+    using DenseMultiVector = DenseVectorBlocked<Mem_, DT_, IT_, NumCols_>;
+
   } // namespace LAFEM
 } // namespace FEAT
 
@@ -48,6 +48,9 @@ namespace FEAT
     template <typename Mem_, typename DT_, typename IT_>
     class SparseMatrixCSCR;
 
+    template <typename Mem_, typename DT_, typename IT_>
+    class SparseMatrixDCSR;
+
     template<typename Mem_, typename DT_, typename IT_>
     class VectorMirror;
 
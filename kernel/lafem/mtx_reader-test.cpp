@@ -0,0 +1,242 @@
+// FEAT3: Finite Element Analysis Toolbox, Version 3
+// Copyright (C) 2010 - 2020 by Stefan Turek & the FEAT group
+// FEAT3 is released under the GNU General Public License version 3,
+// see the file 'copyright.txt' in the top level directory for details.
+
+#include <test_system/test_system.hpp>
+#include <kernel/base_header.hpp>
+#include <kernel/archs.hpp>
+#include <kernel/lafem/mtx_reader.hpp>
+#include <kernel/lafem/sparse_matrix_csr.hpp>
+#include <kernel/lafem/sparse_matrix_coo.hpp>
+#include <kernel/lafem/sparse_matrix_ell.hpp>
+#include <kernel/lafem/dense_vector.hpp>
+#include <kernel/util/random.hpp>
+
+#include <cstdio>
+#include <sstream>
+#include <iomanip>
+
+using namespace FEAT;
+using namespace FEAT::LAFEM;
+using namespace FEAT::TestSystem;
+
+/**
+ * \brief Test class for the MtxReader class.
+ *
+ * \test Tests the parsing of Matrix Market and exp files, i.e. comments, symmetric files,
+ * unsorted and duplicate entries, empty rows, the number parsing and the multithreaded
+ * tokenisation.
+ *
+ * \tparam DT_
+ * The data type.
+ *
+ * \tparam IT_
+ * The index type.
+ */
+template<
+  typename DT_,
+  typename IT_>
+class MtxReaderTest
+  : public FullTaggedTest<Mem::Main, DT_, IT_>
+{
+public:
+  typedef SparseMatrixCSR<Mem::Main, DT_, IT_> MatrixType;
+
+  MtxReaderTest()
+    : FullTaggedTest<Mem::Main, DT_, IT_>("MtxReaderTest")
+  {
+  }
+
+  virtual ~MtxReaderTest()
+  {
+  }
+
+  void test_coordinate() const
+  {
+    std::stringstream ts;
+    ts << "%%MatrixMarket matrix coordinate real general\n";
+    ts << "% a comment line\n";
+    ts << "\n";
+    ts << "4 5 7\n";
+    ts << "1 4 4.0\n";
+    ts << "1 2 2.0\n";
+    ts << "% an interleaved comment\n";
+    ts << "4 5 -1.5E+2\n";
+    ts << "  4   1   0.25\r\n";
+    ts << "1 2 7.0\n";
+    ts << "2 2 1e-3";
+
+    SparseMatrixCSR<Mem::Main, DT_, IT_> csr(FileMode::fm_mtx, ts);
+    TEST_CHECK_EQUAL(csr.rows(), Index(4));
+    TEST_CHECK_EQUAL(csr.columns(), Index(5));
+    TEST_CHECK_EQUAL(csr.used_elements(), Index(5));
+    // duplicate entries keep their first value
+    TEST_CHECK_EQUAL(csr(0, 1), DT_(2));
+    TEST_CHECK_EQUAL(csr(0, 3), DT_(4));
+    TEST_CHECK_EQUAL(csr(1, 1), DT_(1e-3));
+    TEST_CHECK_EQUAL(csr(3, 0), DT_(0.25));
+    TEST_CHECK_EQUAL(csr(3, 4), DT_(-150));
+    // row 2 is empty
+    TEST_CHECK_EQUAL(csr.row_ptr()[2], csr.row_ptr()[3]);
+    // entries are sorted by columns
+    TEST_CHECK_EQUAL(csr.col_ind()[0], IT_(1));
+    TEST_CHECK_EQUAL(csr.col_ind()[1], IT_(3));
+
+    std::stringstream ts2;
+    ts2.str(ts.str());
+    SparseMatrixCOO<Mem::Main, DT_, IT_> coo(FileMode::fm_mtx, ts2);
+    TEST_CHECK_EQUAL(coo.used_elements(), Index(5));
+    TEST_CHECK_EQUAL(coo(3, 4), DT_(-150));
+    TEST_CHECK_EQUAL(coo(2, 2), DT_(0));
+
+    std::stringstream ts3;
+    ts3.str(ts.str());
+    SparseMatrixELL<Mem::Main, DT_, IT_> ell(FileMode::fm_mtx, ts3);
+    TEST_CHECK_EQUAL(ell.used_elements(), Index(5));
+    TEST_CHECK_EQUAL(ell(0, 3), DT_(4));
+    TEST_CHECK_EQUAL(ell(3, 0), DT_(0.25));
+
+    std::stringstream ts4;
+    ts4 << "%%MatrixMarket matrix coordinate real general\n";
+    ts4 << "2 2 1\n";
+    ts4 << "3 1 1.0\n";
+    TEST_CHECK_THROWS(MatrixType e4(FileMode::fm_mtx, ts4), InternalError);
+
+    std::stringstream ts5;
+    ts5 << "%%MatrixMarket matrix coordinate real general\n";
+    ts5 << "2 2 1\n";
+    ts5 << "1 1 abc\n";
+    TEST_CHECK_THROWS(MatrixType e5(FileMode::fm_mtx, ts5), InternalError);
+  }
+
+  void test_symmetric() const
+  {
+    std::stringstream ts;
+    ts << "%%MatrixMarket matrix coordinate real symmetric\n";
+    ts << "3 3 4\n";
+    ts << "1 1 2.0\n";
+    ts << "2 1 -1.0\n";
+    ts << "3 2 -3.0\n";
+    ts << "3 3 5.0\n";
+
+    SparseMatrixCSR<Mem::Main, DT_, IT_> csr(FileMode::fm_mtx, ts);
+    TEST_CHECK_EQUAL(csr.used_elements(), Index(6));
+    TEST_CHECK_EQUAL(csr(0, 1), DT_(-1));
+    TEST_CHECK_EQUAL(csr(1, 0), DT_(-1));
+    TEST_CHECK_EQUAL(csr(1, 2), DT_(-3));
+    TEST_CHECK_EQUAL(csr(2, 1), DT_(-3));
+    TEST_CHECK_EQUAL(csr(1, 1), DT_(0));
+  }
+
+  void test_numbers() const
+  {
+    const char* tokens[] =
+    {
+      "0", "-0.0", "1", "+2.5", "3.141592653589793", "1.000000e+00", "-7.250000e-05",
+      "123456789012345678901234", "0.1", "1e22", "1e23", "4.9e-324", "1.7976931348623157e308",
+      "2.2250738585072014E-308", "0.000000000000000000000001", ".5", "5.", "12345678901234567e-5"
+    };
+
+    std::stringstream ts;
+    ts << "# exp file\n";
+    for(const char* t : tokens)
+      ts << t << "\n";
+    TextInput input(ts);
+    std::vector<double> values;
+    MtxReader::read_values(input.begin(), input.end(), '#', values);
+    TEST_CHECK_EQUAL(values.size(), sizeof(tokens) / sizeof(tokens[0]));
+    for(std::size_t i(0); i < values.size(); ++i)
+      TEST_CHECK_EQUAL(values.at(i), std::strtod(tokens[i], nullptr));
+
+    // random numbers in full precision must be read back exactly
+    Random rng;
+    std::stringstream rs;
+    std::vector<double> ref;
+    for(int i(0); i < 1000; ++i)
+    {
+      ref.push_back(rng(-1.0, 1.0) * std::pow(10.0, double(rng(-30, 30))));
+      rs << std::setprecision(i % 2 == 0 ? 17 : 12) << std::scientific << ref.back() << "\n";
+    }
+    TextInput rinput(rs);
+    MtxReader::read_values(rinput.begin(), rinput.end(), '#', values);
+    TEST_CHECK_EQUAL(values.size(), ref.size());
+    for(std::size_t i(0); i < values.size(); i += 2)
+      TEST_CHECK_EQUAL(values.at(i), ref.at(i));
+  }
+
+  void test_threads() const
+  {
+    // create a matrix which is large enough to be split into several chunks
+    const Index n(40000);
+    std::stringstream ts;
+    ts << "%%MatrixMarket matrix coordinate real general\n";
+    ts << n << " " << n << " " << 3*n << "\n";
+    for(Index i(0); i < n; ++i)
+    {
+      ts << (i+1) << " " << ((7*i) % n + 1) << " " << std::scientific << DT_(i) * DT_(0.5) << "\n";
+      ts << (i+1) << " " << (i+1) << " " << std::scientific << DT_(2) << "\n";
+      ts << ((3*i) % n + 1) << " " << (i+1) << " " << std::scientific << DT_(-1) << "\n";
+    }
+
+    const Index old_threads = MtxReader::get_max_threads();
+    MtxReader::set_max_threads(1);
+    std::stringstream ts1;
+    ts1.str(ts.str());
+    SparseMatrixCSR<Mem::Main, DT_, IT_> a(FileMode::fm_mtx, ts1);
+    MtxReader::set_max_threads(4);
+    std::stringstream ts2;
+    ts2.str(ts.str());
+    SparseMatrixCSR<Mem::Main, DT_, IT_> b(FileMode::fm_mtx, ts2);
+    MtxReader::set_max_threads(old_threads);
+
+    TEST_CHECK_EQUAL(a.used_elements(), b.used_elements());
+    TEST_CHECK_EQUAL(a, b);
+  }
+
+  void test_files() const
+  {
+    std::stringstream ts("%%MatrixMarket matrix coordinate real general\n3 3 3\n1 1 1.0\n2 3 2.0\n3 2 3.0\n");
+    SparseMatrixCSR<Mem::Main, DT_, IT_> a(FileMode::fm_mtx, ts);
+    DenseVector<Mem::Main, DT_, IT_> v(Index(5));
+    for(Index i(0); i < v.size(); ++i)
+      v(i, DT_(i) / DT_(4));
+
+    String mtx_name = "mtx_reader-test.mtx";
+    String vec_name = "mtx_reader-test.vec.mtx";
+    String exp_name = "mtx_reader-test.exp";
+    a.write_out(FileMode::fm_mtx, mtx_name);
+    v.write_out(FileMode::fm_mtx, vec_name);
+    v.write_out(FileMode::fm_exp, exp_name);
+
+    {
+      TextInput mapped(mtx_name);
+      TextInput unmapped(mtx_name, false);
+      TEST_CHECK(!unmapped.is_mapped());
+      TEST_CHECK_EQUAL(String(mapped.begin(), String::size_type(mapped.end() - mapped.begin())),
+        String(unmapped.begin(), String::size_type(unmapped.end() - unmapped.begin())));
+    }
+
+    SparseMatrixCSR<Mem::Main, DT_, IT_> b(FileMode::fm_mtx, mtx_name);
+    TEST_CHECK_EQUAL(a, b);
+    DenseVector<Mem::Main, DT_, IT_> w(FileMode::fm_mtx, vec_name);
+    DenseVector<Mem::Main, DT_, IT_> x(FileMode::fm_exp, exp_name);
+    TEST_CHECK_EQUAL(v, w);
+    TEST_CHECK_EQUAL(v, x);
+
+    std::remove(mtx_name.c_str());
+    std::remove(vec_name.c_str());
+    std::remove(exp_name.c_str());
+  }
+
+  virtual void run() const override
+  {
+    test_coordinate();
+    test_symmetric();
+    test_numbers();
+    test_threads();
+    test_files();
+  }
+};
+MtxReaderTest<float, unsigned int> mtx_reader_test_float_uint;
+MtxReaderTest<double, unsigned long> mtx_reader_test_double_ulong;
@@ -0,0 +1,146 @@
+// FEAT3: Finite Element Analysis Toolbox, Version 3
+// Copyright (C) 2010 - 2020 by Stefan Turek & the FEAT group
+// FEAT3 is released under the GNU General Public License version 3,
+// see the file 'copyright.txt' in the top level directory for details.
+
+#include <kernel/lafem/mtx_reader.hpp>
+
+#include <fstream>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#define FEAT_MTX_READER_MMAP 1
+#endif
+
+using namespace FEAT;
+using namespace FEAT::LAFEM;
+
+// static member initialisation
+Index MtxReader::_max_threads = Index(0);
+
+void TextInput::_read(std::istream& is)
+{
+  // read in chunks of 16 MB
+  const std::size_t chunk = std::size_t(1) << 24;
+  std::size_t n(0);
+  while(is.good())
+  {
+    _buffer.resize(n + chunk);
+    is.read(_buffer.data() + n, std::streamsize(chunk));
+    n += std::size_t(is.gcount());
+  }
+  _buffer.resize(n);
+  _buffer.shrink_to_fit();
+  _begin = _buffer.data();
+  _end = _buffer.data() + n;
+}
+
+TextInput::TextInput(std::istream& is) :
+  _map(nullptr),
+  _map_size(0u),
+  _begin(nullptr),
+  _end(nullptr)
+{
+  _read(is);
+}
+
+TextInput::TextInput(const String& filename, bool use_mmap) :
+  _map(nullptr),
+  _map_size(0u),
+  _begin(nullptr),
+  _end(nullptr)
+{
+#ifdef FEAT_MTX_READER_MMAP
+  if(use_mmap)
+  {
+    int fd = ::open(filename.c_str(), O_RDONLY);
+    if(fd < 0)
+      throw InternalError(__func__, __FILE__, __LINE__, "Unable to open file " + filename);
+    struct stat st;
+    if((::fstat(fd, &st) == 0) && (st.st_size > 0))
+    {
+      void* p = ::mmap(nullptr, std::size_t(st.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+      if(p != MAP_FAILED)
+      {
+        _map = p;
+        _map_size = std::size_t(st.st_size);
+        _begin = static_cast<const char*>(p);
+        _end = _begin + _map_size;
+#ifdef MADV_SEQUENTIAL
+        ::madvise(p, _map_size, MADV_SEQUENTIAL);
+#endif
+      }
+    }
+    ::close(fd);
+    if(_map != nullptr)
+      return;
+  }
+#else
+  (void)use_mmap;
+#endif
+
+  std::ifstream file(filename.c_str(), std::ifstream::in | std::ifstream::binary);
+  if(!file.is_open())
+    throw InternalError(__func__, __FILE__, __LINE__, "Unable to open file " + filename);
+  _read(file);
+}
+
+TextInput::~TextInput()
+{
+#ifdef FEAT_MTX_READER_MMAP
+  if(_map != nullptr)
+    ::munmap(_map, _map_size);
+#endif
+}
+
+MtxReader::Header MtxReader::parse_header(const TextInput& input, bool array)
+{
+  const char* p = input.begin();
+  const char* e = input.end();
+
+  Header header;
+  header.rows = header.columns = header.entries = Index(0);
+  header.symmetric = false;
+  header.array = array;
+
+  // check the banner line
+  const char* le = p;
+  while((le < e) && (*le != '\n'))
+    ++le;
+  const String banner(p, String::size_type(le - p));
+  if(array)
+  {
+    if(banner.find("%%MatrixMarket matrix array real general") == String::npos)
+      throw InternalError(__func__, __FILE__, __LINE__, "Input-file is not a compatible mtx-vector-file");
+  }
+  else
+  {
+    const bool general(banner.find("%%MatrixMarket matrix coordinate real general") != String::npos);
+    header.symmetric = (banner.find("%%MatrixMarket matrix coordinate real symmetric") != String::npos);
+    if(!general && !header.symmetric)
+      throw InternalError(__func__, __FILE__, __LINE__, "Input-file is not a compatible mtx-file");
+  }
+  p = _next_line(p, e);
+
+  // skip comments and empty lines
+  for(;;)
+  {
+    if(p >= e)
+      throw InternalError(__func__, __FILE__, __LINE__, "Input-file is empty");
+    const char* q = _skip_blanks(p, e);
+    if((q < e) && (*q != '%') && (*q != '\n'))
+      break;
+    p = _next_line(p, e);
+  }
+
+  // parse the size line
+  if(!_parse_index(p, e, header.rows) || !_parse_index(p, e, header.columns))
+    throw InternalError(__func__, __FILE__, __LINE__, "Input-file has an invalid size line");
+  if(!array)
+    _parse_index(p, e, header.entries);
+  header.data = _next_line(p, e);
+  return header;
+}
@@ -0,0 +1,592 @@
+// FEAT3: Finite Element Analysis Toolbox, Version 3
+// Copyright (C) 2010 - 2020 by Stefan Turek & the FEAT group
+// FEAT3 is released under the GNU General Public License version 3,
+// see the file 'copyright.txt' in the top level directory for details.
+
+#pragma once
+#ifndef KERNEL_LAFEM_MTX_READER_HPP
+#define KERNEL_LAFEM_MTX_READER_HPP 1
+
+// includes, FEAT
+#include <kernel/base_header.hpp>
+#include <kernel/util/string.hpp>
+#include <kernel/util/assertion.hpp>
+#include <kernel/util/exception.hpp>
+
+// includes, system
+#include <algorithm>
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <thread>
+#include <vector>
+
+namespace FEAT
+{
+  namespace LAFEM
+  {
+    /**
+     * \brief Read-only text input buffer
+     *
+     * This class provides the contents of a text file as a contiguous character range, which
+     * is required by the MtxReader class. If the buffer is created from a filename, the file
+     * is mapped into memory if the operating system supports it; otherwise, the file or stream
+     * is read in large chunks into an internal buffer. In contrast to the std::getline based
+     * parsing, this avoids any per-line allocations.
+     */
+    class TextInput
+    {
+    protected:
+      /// the internal buffer, if the input is not mapped
+      std::vector<char> _buffer;
+      /// the mapped memory region or nullptr
+      void* _map;
+      /// the size of the mapped memory region
+      std::size_t _map_size;
+      /// the character range
+      const char* _begin;
+      const char* _end;
+
+      /// reads the remainder of a stream into the internal buffer
+      void _read(std::istream& is);
+
+    public:
+      /**
+       * \brief Creates the buffer from the remainder of a stream
+       *
+       * \param[in] is
+       * The stream whose remaining contents are to be read in.
+       */
+      explicit TextInput(std::istream& is);
+
+      /**
+       * \brief Creates the buffer from a file
+       *
+       * \param[in] filename
+       * The name of the file to be read in.
+       *
+       * \param[in] use_mmap
+       * Specifies whether the file is to be mapped into memory, if this is supported.
+       */
+      explicit TextInput(const String& filename, bool use_mmap = true);
+
+      TextInput(const TextInput&) = delete;
+      TextInput& operator=(const TextInput&) = delete;
+
+      /// destructor
+      ~TextInput();
+
+      /// \returns The beginning of the character range.
+      const char* begin() const
+      {
+        return _begin;
+      }
+
+      /// \returns The end of the character range.
+      const char* end() const
+      {
+        return _end;
+      }
+
+      /// \returns \c true, if the file has been mapped into memory, otherwise \c false.
+      bool is_mapped() const
+      {
+        return _map != nullptr;
+      }
+    }; // class TextInput
+
+    /**
+     * \brief Matrix Market and exp file reader
+     *
+     * This class implements the parsing of the text based file formats FileMode::fm_mtx and
+     * FileMode::fm_exp for the LAFEM containers. The data section of the input is split into
+     * line-aligned chunks, which are tokenised in parallel by a number of threads. Coordinate
+     * matrices are then converted into a CSR structure by a two-pass count-then-fill approach,
+     * where the entries of each row are sorted by their column indices afterwards. If a matrix
+     * entry appears more than once, the first occurrence is kept.
+     */
+    class MtxReader
+    {
+    public:
+      /// header information of a Matrix Market file
+      struct Header
+      {
+        /// the dimensions of the matrix
+        Index rows, columns;
+        /// the number of entries as specified in the file, or 0 for array files
+        Index entries;
+        /// specifies whether the file contains the lower triangular part of a symmetric matrix
+        bool symmetric;
+        /// specifies whether the file is in array format
+        bool array;
+        /// the beginning of the data section
+        const char* data;
+      };
+
+      /// a chunk of tokenised coordinate entries
+      template<typename DT_, typename IT_>
+      struct Chunk
+      {
+        std::vector<IT_> row, col;
+        std::vector<DT_> val;
+        bool failed = false;
+      };
+
+    private:
+      /// the maximum number of threads, or 0 for the hardware concurrency
+      static Index _max_threads;
+
+      /// minimum number of characters per chunk
+      static constexpr std::size_t _min_chunk_size = std::size_t(1) << 20;
+
+      /// skips spaces and tabs
+      static const char* _skip_blanks(const char* p, const char* e)
+      {
+        while((p < e) && ((*p == ' ') || (*p == '\t') || (*p == '\r')))
+          ++p;
+        return p;
+      }
+
+      /// returns the beginning of the next line
+      static const char* _next_line(const char* p, const char* e)
+      {
+        while((p < e) && (*p != '\n'))
+          ++p;
+        return (p < e) ? p + 1 : e;
+      }
+
+      /// parses an unsigned integer
+      static bool _parse_index(const char*& p, const char* e, Index& value)
+      {
+        p = _skip_blanks(p, e);
+        if((p >= e) || (*p < '0') || (*p > '9'))
+          return false;
+        Index v(0);
+        for(; (p < e) && (*p >= '0') && (*p <= '9'); ++p)
+          v = Index(10)*v + Index(*p - '0');
+        value = v;
+        return true;
+      }
+
+      /**
+       * \brief Parses a floating point number
+       *
+       * Numbers with at most 15 significant digits and a decimal exponent of at most 22 are
+       * converted exactly by a single multiplication or division; all other tokens are passed
+       * to std::strtod.
+       */
+      static bool _parse_real(const char*& p, const char* e, double& value)
+      {
+        static const double pow10[23] =
+        {
+          1E0, 1E1, 1E2, 1E3, 1E4, 1E5, 1E6, 1E7, 1E8, 1E9, 1E10, 1E11,
+          1E12, 1E13, 1E14, 1E15, 1E16, 1E17, 1E18, 1E19, 1E20, 1E21, 1E22
+        };
+
+        p = _skip_blanks(p, e);
+        const char* tok = p;
+
+        bool neg(false);
+        if((p < e) && ((*p == '-') || (*p == '+')))
+          neg = (*p++ == '-');
+
+        std::uint64_t mant(0);
+        int digits(0), exp10(0);
+        bool any(false);
+        for(; (p < e) && (*p >= '0') && (*p <= '9'); ++p, any = true)
+        {
+          if((mant == 0u) && (*p == '0'))
+            continue;
+          if(digits < 19)
+          {
+            mant = 10u*mant + std::uint64_t(*p - '0');
+            ++digits;
+          }
+          else
+            ++exp10;
+        }
+        if((p < e) && (*p == '.'))
+        {
+          for(++p; (p < e) && (*p >= '0') && (*p <= '9'); ++p, any = true)
+          {
+            if((mant == 0u) && (*p == '0'))
+            {
+              --exp10;
+              continue;
+            }
+            if(digits < 19)
+            {
+              mant = 10u*mant + std::uint64_t(*p - '0');
+              ++digits;
+              --exp10;
+            }
+          }
+        }
+        if(any && (p < e) && ((*p == 'e') || (*p == 'E')))
+        {
+          const char* q = p + 1;
+          bool eneg(false);
+          if((q < e) && ((*q == '-') || (*q == '+')))
+            eneg = (*q++ == '-');
+          if((q < e) && (*q >= '0') && (*q <= '9'))
+          {
+            int ev(0);
+            for(; (q < e) && (*q >= '0') && (*q <= '9'); ++q)
+              ev = (ev < 100000 ? 10*ev + int(*q - '0') : ev);
+            exp10 += (eneg ? -ev : ev);
+            p = q;
+          }
+        }
+
+        // fast path: the mantissa and the power of ten are exact doubles
+        if(any && (digits <= 15) && (exp10 >= -22) && (exp10 <= 22) && ((p >= e) || (*p <= ' ')))
+        {
+          double v = double(mant);
+          v = (exp10 < 0) ? v / pow10[-exp10] : v * pow10[exp10];
+          value = (neg ? -v : v);
+          return true;
+        }
+
+        // slow path: copy the token and use strtod
+        const char* te = tok;
+        while((te < e) && (*te > ' '))
+          ++te;
+        if((te == tok) || (te - tok > 127))
+          return false;
+        char buf[128];
+        std::copy(tok, te, buf);
+        buf[te - tok] = '\0';
+        char* stop(nullptr);
+        value = std::strtod(buf, &stop);
+        p = te;
+        return stop == buf + (te - tok);
+      }
+
+      /// returns the number of threads to be used for a range of characters
+      static std::size_t _num_threads(const char* begin, const char* end)
+      {
+        std::size_t n = std::size_t(_max_threads);
+        if(n == 0u)
+          n = std::max(std::size_t(std::thread::hardware_concurrency()), std::size_t(1));
+        const std::size_t len = std::size_t(end - begin);
+        return std::max(std::size_t(1), std::min(n, len / _min_chunk_size));
+      }
+
+      /// splits a character range into line-aligned chunks
+      static std::vector<const char*> _split(const char* begin, const char* end, std::size_t num_chunks)
+      {
+        std::vector<const char*> bounds(num_chunks + 1u, end);
+        bounds.front() = begin;
+        const std::size_t len = std::size_t(end - begin);
+        for(std::size_t i(1); i < num_chunks; ++i)
+        {
+          const char* p = begin + (len * i) / num_chunks;
+          p = (p > begin) && (p[-1] == '\n') ? p : _next_line(p, end);
+          bounds.at(i) = std::max(p, bounds.at(i-1));
+        }
+        return bounds;
+      }
+
+      /// runs a functor on all chunks, using one thread per chunk
+      template<typename Func_>
+      static void _parallel(std::size_t num_chunks, Func_ func)
+      {
+        if(num_chunks <= 1u)
+        {
+          func(std::size_t(0));
+          return;
+        }
+        std::vector<std::thread> threads;
+        threads.reserve(num_chunks - 1u);
+        for(std::size_t i(1); i < num_chunks; ++i)
+          threads.emplace_back(func, i);
+        func(std::size_t(0));
+        for(auto& t : threads)
+          t.join();
+      }
+
+      /// tokenises the coordinate entries of a character range
+      template<typename DT_, typename IT_>
+      static void _tokenise(const char* p, const char* e, Chunk<DT_, IT_>& chunk)
+      {
+        // estimate the number of entries by assuming 24 characters per line
+        const std::size_t guess = std::size_t(e - p) / 24u + 1u;
+        chunk.row.reserve(guess);
+        chunk.col.reserve(guess);
+        chunk.val.reserve(guess);
+        while(p < e)
+        {
+          p = _skip_blanks(p, e);
+          if((p >= e) || (*p == '\n') || (*p == '%'))
+          {
+            p = _next_line(p, e);
+            continue;
+          }
+          Index r(0), c(0);
+          double v(0.0);
+          if(!_parse_index(p, e, r) || !_parse_index(p, e, c) || !_parse_real(p, e, v) || (r == Index(0)) || (c == Index(0)))
+          {
+            chunk.failed = true;
+            return;
+          }
+          chunk.row.push_back(IT_(r - 1u));
+          chunk.col.push_back(IT_(c - 1u));
+          chunk.val.push_back(DT_(v));
+          p = _next_line(p, e);
+        }
+      }
+
+      /// tokenises the values of a character range; lines starting with the comment character are skipped
+      template<typename DT_>
+      static bool _tokenise_values(const char* p, const char* e, char comment, std::vector<DT_>& values)
+      {
+        values.reserve(std::size_t(e - p) / 14u + 1u);
+        while(p < e)
+        {
+          p = _skip_blanks(p, e);
+          if((p >= e) || (*p == '\n') || (*p == comment))
+          {
+            p = _next_line(p, e);
+            continue;
+          }
+          double v(0.0);
+          if(!_parse_real(p, e, v))
+            return false;
+          values.push_back(DT_(v));
+          p = _next_line(p, e);
+        }
+        return true;
+      }
+
+    public:
+      /**
+       * \brief Sets the maximum number of threads used for tokenisation
+       *
+       * \param[in] max_threads
+       * The maximum number of threads. If set to 0, the hardware concurrency is used.
+       */
+      static void set_max_threads(Index max_threads)
+      {
+        _max_threads = max_threads;
+      }
+
+      /// \returns The maximum number of threads used for tokenisation.
+      static Index get_max_threads()
+      {
+        return _max_threads;
+      }
+
+      /**
+       * \brief Parses the header of a Matrix Market file
+       *
+       * \param[in] input
+       * The input buffer.
+       *
+       * \param[in] array
+       * Specifies whether an array file (\c true) or a coordinate file (\c false) is expected.
+       *
+       * \returns The header information.
+       */
+      static Header parse_header(const TextInput& input, bool array);
+
+      /**
+       * \brief Reads a Matrix Market coordinate file into a CSR structure
+       *
+       * \param[in] input
+       * The input buffer.
+       *
+       * \param[out] rows, columns
+       * Receive the dimensions of the matrix.
+       *
+       * \param[out] row_ptr, col_idx, val
+       * Receive the CSR arrays of the matrix with column indices sorted in ascending order.
+       */
+      template<typename DT_, typename IT_>
+      static void read_csr(const TextInput& input, Index& rows, Index& columns,
+        std::vector<IT_>& row_ptr, std::vector<IT_>& col_idx, std::vector<DT_>& val)
+      {
+        const Header header = parse_header(input, false);
+        rows = header.rows;
+        columns = header.columns;
+
+        // pass 0: tokenise all chunks in parallel
+        const std::size_t num_chunks = _num_threads(header.data, input.end());
+        const std::vector<const char*> bounds = _split(header.data, input.end(), num_chunks);
+        std::vector<Chunk<DT_, IT_>> chunks(num_chunks);
+        _parallel(num_chunks, [&](std::size_t i) {_tokenise(bounds.at(i), bounds.at(i+1u), chunks.at(i));});
+
+        // pass 1: count the entries per row
+        row_ptr.assign(rows + 1u, IT_(0));
+        for(const auto& ch : chunks)
+        {
+          if(ch.failed)
+            throw InternalError(__func__, __FILE__, __LINE__, "Input-file contains an invalid matrix entry");
+          for(std::size_t k(0); k < ch.row.size(); ++k)
+          {
+            if((Index(ch.row[k]) >= rows) || (Index(ch.col[k]) >= columns))
+              throw InternalError(__func__, __FILE__, __LINE__, "Input-file contains an entry outside of the matrix");
+            ++row_ptr[ch.row[k] + 1u];
+            if(header.symmetric && (ch.row[k] != ch.col[k]))
+              ++row_ptr[ch.col[k] + 1u];
+          }
+        }
+        for(Index i(0); i < rows; ++i)
+          row_ptr[i+1u] += row_ptr[i];
+
+        // pass 2: fill the entries in file order
+        const Index num_raw = Index(row_ptr[rows]);
+        col_idx.resize(num_raw);
+        val.resize(num_raw);
+        {
+          std::vector<IT_> pos(row_ptr.begin(), row_ptr.end() - 1);
+          for(auto& ch : chunks)
+          {
+            for(std::size_t k(0); k < ch.row.size(); ++k)
+            {
+              IT_ j = pos[ch.row[k]]++;
+              col_idx[j] = ch.col[k];
+              val[j] = ch.val[k];
+              if(header.symmetric && (ch.row[k] != ch.col[k]))
+              {
+                j = pos[ch.col[k]]++;
+                col_idx[j] = ch.row[k];
+                val[j] = ch.val[k];
+              }
+            }
+            // release the chunk memory as early as possible
+            std::vector<IT_>().swap(ch.row);
+            std::vector<IT_>().swap(ch.col);
+            std::vector<DT_>().swap(ch.val);
+          }
+        }
+
+        // sort each row by column indices and remove duplicates, keeping the first occurrence
+        std::vector<IT_> row_len(rows, IT_(0));
+        const std::size_t num_sort = std::min(num_chunks, std::size_t(rows / 1000u + 1u));
+        _parallel(num_sort, [&](std::size_t t)
+        {
+          std::vector<std::pair<IT_, DT_>> buf;
+          for(Index i(Index(rows * t / num_sort)); i < Index(rows * (t+1u) / num_sort); ++i)
+          {
+            const IT_ b(row_ptr[i]), e(row_ptr[i+1u]);
+
+            // most files are sorted already, so check this first
+            IT_ j(b + 1u);
+            while((j < e) && (col_idx[j-1u] < col_idx[j]))
+              ++j;
+            if(j >= e)
+            {
+              row_len[i] = e - b;
+              continue;
+            }
+
+            buf.clear();
+            for(j = b; j < e; ++j)
+              buf.emplace_back(col_idx[j], val[j]);
+            auto less = [](const std::pair<IT_, DT_>& x, const std::pair<IT_, DT_>& y) {return x.first < y.first;};
+            if(buf.size() <= std::size_t(32))
+            {
+              // insertion sort for short rows
+              for(std::size_t k(1); k < buf.size(); ++k)
+              {
+                for(std::size_t l(k); (l > 0u) && less(buf[l], buf[l-1u]); --l)
+                  std::swap(buf[l], buf[l-1u]);
+              }
+            }
+            else
+              std::stable_sort(buf.begin(), buf.end(), less);
+
+            IT_ n(0);
+            for(std::size_t k(0); k < buf.size(); ++k)
+            {
+              if((n > IT_(0)) && (col_idx[b + n - 1u] == buf[k].first))
+                continue;
+              col_idx[b + n] = buf[k].first;
+              val[b + n] = buf[k].second;
+              ++n;
+            }
+            row_len[i] = n;
+          }
+        });
+
+        // compress the arrays, if duplicates have been removed
+        IT_ nnz(0);
+        for(Index i(0); i < rows; ++i)
+        {
+          const IT_ b(row_ptr[i]);
+          row_ptr[i] = nnz;
+          if(b != nnz)
+          {
+            for(IT_ j(0); j < row_len[i]; ++j)
+            {
+              col_idx[nnz + j] = col_idx[b + j];
+              val[nnz + j] = val[b + j];
+            }
+          }
+          nnz += row_len[i];
+        }
+        row_ptr[rows] = nnz;
+        col_idx.resize(nnz);
+        val.resize(nnz);
+      }
+
+      /**
+       * \brief Reads a Matrix Market array file of a single column
+       *
+       * \param[in] input
+       * The input buffer.
+       *
+       * \param[out] values
+       * Receives the values of the vector.
+       */
+      template<typename DT_>
+      static void read_array(const TextInput& input, std::vector<DT_>& values)
+      {
+        const Header header = parse_header(input, true);
+        XASSERTM(header.columns == 1, "Input-file is no dense-vector-file");
+        read_values(header.data, input.end(), '%', values);
+        if(Index(values.size()) != header.rows)
+          throw InternalError(__func__, __FILE__, __LINE__, "Input-file does not contain " + stringify(header.rows) + " values");
+      }
+
+      /**
+       * \brief Reads a list of values, one per line
+       *
+       * \param[in] begin, end
+       * The character range to be parsed.
+       *
+       * \param[in] comment
+       * The comment character; lines starting with this character are skipped.
+       *
+       * \param[out] values
+       * Receives the values in the order of their appearance.
+       */
+      template<typename DT_>
+      static void read_values(const char* begin, const char* end, char comment, std::vector<DT_>& values)
+      {
+        const std::size_t num_chunks = _num_threads(begin, end);
+        const std::vector<const char*> bounds = _split(begin, end, num_chunks);
+        std::vector<std::vector<DT_>> parts(num_chunks);
+        std::vector<int> okay(num_chunks, 0);
+        _parallel(num_chunks, [&](std::size_t i)
+        {
+          okay.at(i) = _tokenise_values(bounds.at(i), bounds.at(i+1u), comment, parts.at(i)) ? 1 : 0;
+        });
+
+        std::size_t n(0);
+        for(std::size_t i(0); i < num_chunks; ++i)
+        {
+          if(okay.at(i) == 0)
+            throw InternalError(__func__, __FILE__, __LINE__, "Input-file contains an invalid value");
+          n += parts.at(i).size();
+        }
+        values.clear();
+        values.reserve(n);
+        for(const auto& part : parts)
+          values.insert(values.end(), part.begin(), part.end());
+      }
+    }; // class MtxReader
+  } // namespace LAFEM
+} // namespace FEAT
+
+#endif // KERNEL_LAFEM_MTX_READER_HPP
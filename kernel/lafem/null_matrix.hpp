@@ -663,8 +663,8 @@ namespace FEAT
       }
       /// \endcond
 
-      /// \copydoc FEAT::Control::Checkpointable::get_checkpoint_size()
-      uint64_t get_checkpoint_size()
+      /// \copydoc FEAT::Control::Checkpointable::get_checkpoint_size(const LAFEM::SerialConfig&)
+      uint64_t get_checkpoint_size(const SerialConfig& /*config*/)
       {
         return size_t(0);
       }
@@ -675,10 +675,11 @@ namespace FEAT
         // nothing to do here
       }
 
-      /// \copydoc FEAT::Control::Checkpointable::set_checkpoint_data(std::vector<char>&)
-      void set_checkpoint_data(std::vector<char>& /*data*/)
+      /// \copydoc FEAT::Control::Checkpointable::set_checkpoint_data(std::vector<char>&,const LAFEM::SerialConfig&)
+      uint64_t set_checkpoint_data(std::vector<char>& /*data*/, const SerialConfig& /*config*/)
       {
         // nothing to do here
+        return uint64_t(0);
       }
 
       /* ******************************************************************* */
@@ -11,6 +11,7 @@
 #include <kernel/lafem/dense_vector.hpp>
 #include <kernel/lafem/sparse_matrix_csr.hpp>
 #include <kernel/lafem/sparse_matrix_banded.hpp>
+#include <kernel/lafem/stencil_matrix.hpp>
 #include <kernel/lafem/pointstar_structure.hpp>
 
 #include <stack>
@@ -375,6 +376,17 @@ namespace FEAT
         return SparseMatrixCSR<Mem::Main, DataType_, IndexType_>(neq, neq, vec_col_idx, vec_data, vec_row_ptr);
       }
 
+      /**
+       * \brief Generates a matrix-free FD-style pointstar stencil matrix
+       *
+       * \returns
+       * The m^d x m^d FD-style pointstar matrix as a StencilMatrix; only available for d <= 3.
+       */
+      StencilMatrix<Mem::Main, DataType_, IndexType_> matrix_stencil() const
+      {
+        return StencilMatrix<Mem::Main, DataType_, IndexType_>::laplace(this->_m, int(this->_d));
+      }
+
       /**
        * \brief Computes the smallest eigenvalue of the FD-style matrix.
        *
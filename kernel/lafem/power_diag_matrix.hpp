@@ -338,10 +338,10 @@ namespace FEAT
         return (i == 0) ? _first : _rest.get(i-1, j-1);
       }
 
-      /// \copydoc FEAT::Control::Checkpointable::get_checkpoint_size()
-      uint64_t get_checkpoint_size()
+      /// \copydoc FEAT::Control::Checkpointable::get_checkpoint_size(const LAFEM::SerialConfig&)
+      uint64_t get_checkpoint_size(const SerialConfig& config)
       {
-        return sizeof(uint64_t) + _first.get_checkpoint_size() + _rest.get_checkpoint_size(); //sizeof(uint64_t) bits needed to store lenght of checkpointed _first
+        return sizeof(uint64_t) + _first.get_checkpoint_size(config) + _rest.get_checkpoint_size(config); //sizeof(uint64_t) bits needed to store lenght of checkpointed _first
       }
 
       /// \copydoc FEAT::Control::Checkpointable::restore_from_checkpoint_data(std::vector<char>&)
@@ -357,16 +357,15 @@ namespace FEAT
         _rest.restore_from_checkpoint_data(data);
       }
 
-      /// \copydoc FEAT::Control::Checkpointable::set_checkpoint_data(std::vector<char>&)
-      void set_checkpoint_data(std::vector<char>& data)
+      /// \copydoc FEAT::Control::Checkpointable::set_checkpoint_data(std::vector<char>&,const LAFEM::SerialConfig&)
+      uint64_t set_checkpoint_data(std::vector<char>& data, const SerialConfig& config)
       {
-        uint64_t isize = _first.get_checkpoint_size();
-        char* csize = reinterpret_cast<char*>(&isize);
+        std::size_t old_size = data.size();
+        data.insert(std::end(data), sizeof(uint64_t), 0); //add placeholder for the lenght of checkpointed _first element
+        uint64_t isize = _first.set_checkpoint_data(data, config); //add data of _first to the overall checkpoint
+        std::memcpy(data.data() + old_size, &isize, sizeof(uint64_t)); //store the real lenght of checkpointed _first element
 
-        data.insert(std::end(data), csize, csize + sizeof(uint64_t)); //add lenght of checkpointed _first element to the overall checkpoint data
-        _first.set_checkpoint_data(data); //add data of _first to the overall checkpoint
-
-        _rest.set_checkpoint_data(data); //generate and add checkpoint data for the _rest
+        return sizeof(uint64_t) + isize + _rest.set_checkpoint_data(data, config); //generate and add checkpoint data for the _rest
       }
 
       /// \cond internal
@@ -856,10 +855,10 @@ namespace FEAT
         return _first;
       }
 
-      /// \copydoc FEAT::Control::Checkpointable::get_checkpoint_size()
-      uint64_t get_checkpoint_size()
+      /// \copydoc FEAT::Control::Checkpointable::get_checkpoint_size(const LAFEM::SerialConfig&)
+      uint64_t get_checkpoint_size(const SerialConfig& config)
       {
-        return _first.get_checkpoint_size();
+        return _first.get_checkpoint_size(config);
       }
 
       /// \copydoc FEAT::Control::Checkpointable::restore_from_checkpoint_data(std::vector<char>&)
@@ -868,10 +867,10 @@ namespace FEAT
         _first.restore_from_checkpoint_data(data);
       }
 
-      /// \copydoc FEAT::Control::Checkpointable::set_checkpoint_data(std::vector<char>&)
-      void set_checkpoint_data(std::vector<char>& data)
+      /// \copydoc FEAT::Control::Checkpointable::set_checkpoint_data(std::vector<char>&,const LAFEM::SerialConfig&)
+      uint64_t set_checkpoint_data(std::vector<char>& data, const SerialConfig& config)
       {
-        _first.set_checkpoint_data(data);
+        return _first.set_checkpoint_data(data, config);
       }
 
       SubMatrixType& first()
@@ -390,10 +390,10 @@ namespace FEAT
         _container.convert_reverse(other._container);
       }
 
-      /// \copydoc FEAT::Control::Checkpointable::get_checkpoint_size()
-      uint64_t get_checkpoint_size()
+      /// \copydoc FEAT::Control::Checkpointable::get_checkpoint_size(const LAFEM::SerialConfig&)
+      uint64_t get_checkpoint_size(const SerialConfig& config)
       {
-        return _container.get_checkpoint_size();
+        return _container.get_checkpoint_size(config);
       }
 
       /// \copydoc FEAT::Control::Checkpointable::restore_from_checkpoint_data(std::vector<char>&)
@@ -402,10 +402,10 @@ namespace FEAT
         _container.restore_from_checkpoint_data(data);
       }
 
-      /// \copydoc FEAT::Control::Checkpointable::set_checkpoint_data(std::vector<char>&)
-      void set_checkpoint_data(std::vector<char>& data)
+      /// \copydoc FEAT::Control::Checkpointable::set_checkpoint_data(std::vector<char>&,const LAFEM::SerialConfig&)
+      uint64_t set_checkpoint_data(std::vector<char>& data, const SerialConfig& config)
       {
-        _container.set_checkpoint_data(data);
+        return _container.set_checkpoint_data(data, config);
       }
 
       /**
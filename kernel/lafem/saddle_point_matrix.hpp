@@ -576,10 +576,10 @@ namespace FEAT
       }
       /// \endcond
 
-      /// \copydoc FEAT::Control::Checkpointable::get_checkpoint_size()
-      uint64_t get_checkpoint_size()
+      /// \copydoc FEAT::Control::Checkpointable::get_checkpoint_size(const LAFEM::SerialConfig&)
+      uint64_t get_checkpoint_size(const SerialConfig& config)
       {
-        return (3 * sizeof(uint64_t)) + this->block_a().get_checkpoint_size() + this->block_b().get_checkpoint_size() + this->block_d().get_checkpoint_size();
+        return (3 * sizeof(uint64_t)) + this->block_a().get_checkpoint_size(config) + this->block_b().get_checkpoint_size(config) + this->block_d().get_checkpoint_size(config);
       }
 
       /// \copydoc FEAT::Control::Checkpointable::restore_from_checkpoint_data(std::vector<char>&)
@@ -602,20 +602,20 @@ namespace FEAT
         this->block_d().restore_from_checkpoint_data(data);
       }
 
-      /// \copydoc FEAT::Control::Checkpointable::set_checkpoint_data(std::vector<char>&)
-      void set_checkpoint_data(std::vector<char>& data)
+      /// \copydoc FEAT::Control::Checkpointable::set_checkpoint_data(std::vector<char>&,const LAFEM::SerialConfig&)
+      uint64_t set_checkpoint_data(std::vector<char>& data, const SerialConfig& config)
       {
-        uint64_t isize = this->block_a().get_checkpoint_size();
-        char* csize = reinterpret_cast<char*>(&isize);
-        data.insert(std::end(data), csize, csize + sizeof(uint64_t)); //add lenght of checkpointed block a to the overall checkpoint data
-        this->block_a().set_checkpoint_data(data); //add data of block a to the overall checkpoint
+        std::size_t old_size = data.size();
+        data.insert(std::end(data), sizeof(uint64_t), 0); //add placeholder for the lenght of checkpointed block a
+        uint64_t isize_a = this->block_a().set_checkpoint_data(data, config); //add data of block a to the overall checkpoint
+        std::memcpy(data.data() + old_size, &isize_a, sizeof(uint64_t)); //store the real lenght of checkpointed block a
 
-        isize = this->block_b().get_checkpoint_size();
-        csize = reinterpret_cast<char*>(&isize);
-        data.insert(std::end(data), csize, csize + sizeof(uint64_t)); //add lenght of checkpointed block b to the overall checkpoint data
-        this->block_b().set_checkpoint_data(data); //add data of block b to the overall checkpoint
+        old_size = data.size();
+        data.insert(std::end(data), sizeof(uint64_t), 0); //add placeholder for the lenght of checkpointed block b
+        uint64_t isize_b = this->block_b().set_checkpoint_data(data, config); //add data of block b to the overall checkpoint
+        std::memcpy(data.data() + old_size, &isize_b, sizeof(uint64_t)); //store the real lenght of checkpointed block b
 
-        this->block_d().set_checkpoint_data(data); //add data of block d to the overall checkpoint
+        return 2 * sizeof(uint64_t) + isize_a + isize_b + this->block_d().set_checkpoint_data(data, config); //add data of block d to the overall checkpoint
       }
 
       /**
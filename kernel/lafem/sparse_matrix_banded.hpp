@@ -1095,14 +1095,16 @@ namespace FEAT
       /**
        * \brief Serialisation of complete container entity.
        *
+       * \param[in] config LAFEM::SerialConfig, a struct describing the serialise configuration.
+       *
        * Serialize a complete container entity into a single binary array.
        *
        * See \ref FEAT::LAFEM::Container::_serialise for details.
        */
       template <typename DT2_ = DT_, typename IT2_ = IT_>
-      std::vector<char> serialise()
+      std::vector<char> serialise(const LAFEM::SerialConfig& config = LAFEM::SerialConfig())
       {
-        return this->template _serialise<DT2_, IT2_>(FileMode::fm_bm);
+        return this->template _serialise<DT2_, IT2_>(FileMode::fm_bm, config);
       }
 
       /**
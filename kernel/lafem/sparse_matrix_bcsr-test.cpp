@@ -7,6 +7,8 @@
 #include <kernel/archs.hpp>
 #include <test_system/test_system.hpp>
 #include <kernel/lafem/sparse_matrix_bcsr.hpp>
+#include <kernel/lafem/dense_vector_blocked.hpp>
+#include <kernel/util/random.hpp>
 #include <kernel/util/binary_stream.hpp>
 #include <kernel/adjacency/cuthill_mckee.hpp>
 
@@ -818,3 +820,87 @@ SparseMatrixBCSRPermuteTest<Mem::CUDA, double, unsigned long> cpu_sparse_matrix_
 SparseMatrixBCSRPermuteTest<Mem::CUDA, float, unsigned int> cpu_sparse_matrix_bcsr_permute_test_float_uint_cuda;
 SparseMatrixBCSRPermuteTest<Mem::CUDA, double, unsigned int> cpu_sparse_matrix_bcsr_permute_test_double_uint_cuda;
 #endif
+
+/**
+ * \brief Test class for the sparse matrix csr blocked multi-vector apply method.
+ *
+ * \test Tests the application onto multi-vectors against the column-wise application.
+ */
+template<
+  typename Mem_,
+  typename DT_,
+  typename IT_>
+class SparseMatrixBCSRMultiApplyTest
+  : public FullTaggedTest<Mem_, DT_, IT_>
+{
+public:
+  static constexpr int k = 3;
+
+  SparseMatrixBCSRMultiApplyTest()
+    : FullTaggedTest<Mem_, DT_, IT_>("SparseMatrixBCSRMultiApplyTest")
+  {
+  }
+
+  virtual ~SparseMatrixBCSRMultiApplyTest()
+  {
+  }
+
+  virtual void run() const override
+  {
+    const DT_ eps = Math::pow(Math::eps<DT_>(), DT_(0.7));
+    Random rng;
+
+    // 3x4 block matrix with a staggered pattern of 2x3 blocks
+    DenseVector<Mem_, IT_, IT_> row_ptr(4);
+    row_ptr(0, IT_(0));
+    row_ptr(1, IT_(2));
+    row_ptr(2, IT_(3));
+    row_ptr(3, IT_(6));
+    DenseVector<Mem_, IT_, IT_> col_ind(6);
+    col_ind(0, IT_(0));
+    col_ind(1, IT_(3));
+    col_ind(2, IT_(1));
+    col_ind(3, IT_(0));
+    col_ind(4, IT_(2));
+    col_ind(5, IT_(3));
+    DenseVector<Mem_, DT_, IT_> val(rng, 6 * 6, DT_(-1), DT_(1));
+    SparseMatrixBCSR<Mem_, DT_, IT_, 2, 3> c(3, 4, col_ind, val, row_ptr);
+
+    DenseMultiVector<Mem_, DT_, IT_, 3 * k> x(rng, c.columns(), DT_(-1), DT_(1));
+    DenseMultiVector<Mem_, DT_, IT_, 2 * k> y(rng, c.rows(), DT_(-1), DT_(1));
+    DenseMultiVector<Mem_, DT_, IT_, 2 * k> r(c.rows(), DT_(4711));
+    DenseMultiVector<Mem_, DT_, IT_, 2 * k> s(c.rows(), DT_(4711));
+    const DT_ alpha(-0.75);
+
+    c.apply(r, x);
+    c.apply(s, x, y, alpha);
+
+    for (int j(0) ; j < k ; ++j)
+    {
+      // extract column j
+      DenseVector<Mem_, DT_, IT_> xj(c.template columns<Perspective::pod>());
+      DenseVector<Mem_, DT_, IT_> yj(c.template rows<Perspective::pod>());
+      DenseVector<Mem_, DT_, IT_> rj(c.template rows<Perspective::pod>());
+      DenseVector<Mem_, DT_, IT_> sj(c.template rows<Perspective::pod>());
+      for (Index i(0) ; i < c.columns() ; ++i)
+        for (int w(0) ; w < 3 ; ++w)
+          xj(i * 3 + Index(w), x(i)[w * k + j]);
+      for (Index i(0) ; i < c.rows() ; ++i)
+        for (int h(0) ; h < 2 ; ++h)
+          yj(i * 2 + Index(h), y(i)[h * k + j]);
+
+      c.apply(rj, xj);
+      c.apply(sj, xj, yj, alpha);
+      for (Index i(0) ; i < c.rows() ; ++i)
+      {
+        for (int h(0) ; h < 2 ; ++h)
+        {
+          TEST_CHECK_EQUAL_WITHIN_EPS(r(i)[h * k + j], rj(i * 2 + Index(h)), eps);
+          TEST_CHECK_EQUAL_WITHIN_EPS(s(i)[h * k + j], sj(i * 2 + Index(h)), eps);
+        }
+      }
+    }
+  }
+};
+SparseMatrixBCSRMultiApplyTest<Mem::Main, float, unsigned int> cpu_sparse_matrix_bcsr_multi_apply_test_float_uint;
+SparseMatrixBCSRMultiApplyTest<Mem::Main, double, unsigned long> cpu_sparse_matrix_bcsr_multi_apply_test_double_ulong;
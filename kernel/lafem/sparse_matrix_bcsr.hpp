@@ -589,14 +589,16 @@ namespace FEAT
       /**
        * \brief Serialisation of complete container entity.
        *
+       * \param[in] config LAFEM::SerialConfig, a struct describing the serialise configuration.
+       *
        * Serialize a complete container entity into a single binary array.
        *
        * See \ref FEAT::LAFEM::Container::_serialise for details.
        */
       template <typename DT2_ = DT_, typename IT2_ = IT_>
-      std::vector<char> serialise()
+      std::vector<char> serialise(const LAFEM::SerialConfig& config = LAFEM::SerialConfig())
       {
-        return this->template _serialise<DT2_, IT2_>(FileMode::fm_bcsr);
+        return this->template _serialise<DT2_, IT2_>(FileMode::fm_bcsr, config);
       }
 
       /**
@@ -1600,6 +1602,83 @@ namespace FEAT
         Statistics::add_time_blas2(ts_stop.elapsed(ts_start));
       }
 
+      /**
+       * \brief Calculate \f$ R \leftarrow this\cdot X \f$ for a multi-vector X
+       *
+       * The vectors are interpreted as multi-vectors with k = BlockSizeR_ / BlockHeight_ columns,
+       * i.e. each block of x holds the k columns of BlockWidth_ consecutive scalar rows, so that the
+       * matrix is streamed only once for all k columns.
+       *
+       * \param[out] r The multi-vector that receives the result.
+       * \param[in] x The multi-vector to be multiplied by this matrix.
+       */
+      template<int BlockSizeR_, int BlockSizeX_, typename = typename std::enable_if<(BlockSizeR_ != BlockHeight_) &&
+        (BlockSizeR_ % BlockHeight_ == 0) && (BlockSizeX_ == (BlockSizeR_ / BlockHeight_) * BlockWidth_)>::type>
+      void apply(DenseVectorBlocked<Mem_, DT_, IT_, BlockSizeR_> & r, const DenseVectorBlocked<Mem_, DT_, IT_, BlockSizeX_> & x) const
+      {
+        XASSERTM(r.size() == this->rows(), "Vector size of r does not match!");
+        XASSERTM(x.size() == this->columns(), "Vector size of x does not match!");
+
+        TimeStamp ts_start;
+
+        if (this->used_elements() == 0)
+        {
+          r.format();
+          return;
+        }
+
+        XASSERTM(r.template elements<Perspective::pod>() != x.template elements<Perspective::pod>(), "Vector x and r must not share the same memory!");
+
+        Statistics::add_flops(this->used_elements<Perspective::pod>() * 2 * Index(BlockSizeR_ / BlockHeight_));
+
+        Arch::Apply<Mem_>::template csrb_multi<DT_, IT_, BlockHeight_, BlockWidth_, BlockSizeR_ / BlockHeight_>(
+            r.template elements<Perspective::pod>(), DT_(1), x.template elements<Perspective::pod>(), DT_(0), r.template elements<Perspective::pod>(), this->template val<Perspective::pod>(),
+            this->col_ind(), this->row_ptr(), this->rows(), this->columns(), this->used_elements());
+
+        TimeStamp ts_stop;
+        Statistics::add_time_blas2(ts_stop.elapsed(ts_start));
+      }
+
+      /**
+       * \brief Calculate \f$ R \leftarrow Y + \alpha~ this\cdot X \f$ for multi-vectors X, Y
+       *
+       * \param[out] r The multi-vector that receives the result.
+       * \param[in] x The multi-vector to be multiplied by this matrix.
+       * \param[in] y The summand multi-vector.
+       * \param[in] alpha A scalar to scale the product with.
+       */
+      template<int BlockSizeR_, int BlockSizeX_, typename = typename std::enable_if<(BlockSizeR_ != BlockHeight_) &&
+        (BlockSizeR_ % BlockHeight_ == 0) && (BlockSizeX_ == (BlockSizeR_ / BlockHeight_) * BlockWidth_)>::type>
+      void apply(
+                 DenseVectorBlocked<Mem_, DT_, IT_, BlockSizeR_> & r,
+                 const DenseVectorBlocked<Mem_, DT_, IT_, BlockSizeX_> & x,
+                 const DenseVectorBlocked<Mem_, DT_, IT_, BlockSizeR_> & y,
+                 const DT_ alpha = DT_(1)) const
+      {
+        XASSERTM(r.size() == this->rows(), "Vector size of r does not match!");
+        XASSERTM(x.size() == this->columns(), "Vector size of x does not match!");
+        XASSERTM(y.size() == this->rows(), "Vector size of y does not match!");
+
+        TimeStamp ts_start;
+
+        if (this->used_elements() == 0 || Math::abs(alpha) < Math::eps<DT_>())
+        {
+          r.copy(y);
+          return;
+        }
+
+        XASSERTM(r.template elements<Perspective::pod>() != x.template elements<Perspective::pod>(), "Vector x and r must not share the same memory!");
+
+        Statistics::add_flops((this->used_elements<Perspective::pod>() + this->rows<Perspective::pod>()) * 2 * Index(BlockSizeR_ / BlockHeight_));
+
+        Arch::Apply<Mem_>::template csrb_multi<DT_, IT_, BlockHeight_, BlockWidth_, BlockSizeR_ / BlockHeight_>(
+            r.template elements<Perspective::pod>(), alpha, x.template elements<Perspective::pod>(), DT_(1), y.template elements<Perspective::pod>(), this->template val<Perspective::pod>(),
+            this->col_ind(), this->row_ptr(), this->rows(), this->columns(), this->used_elements());
+
+        TimeStamp ts_stop;
+        Statistics::add_time_blas2(ts_stop.elapsed(ts_start));
+      }
+
       /**
        * \brief Adds a double-matrix product onto this matrix
        *
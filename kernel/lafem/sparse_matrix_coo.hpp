@@ -16,6 +16,7 @@
 #include <kernel/lafem/dense_vector.hpp>
 #include <kernel/lafem/sparse_matrix_csr.hpp>
 #include <kernel/lafem/sparse_matrix_ell.hpp>
+#include <kernel/lafem/mtx_reader.hpp>
 #include <kernel/lafem/arch/scale_row_col.hpp>
 #include <kernel/lafem/arch/scale.hpp>
 #include <kernel/lafem/arch/axpy.hpp>
@@ -389,6 +390,44 @@ namespace FEAT
         return this->_scalar_index.at(6);
       }
 
+      /// reads in the matrix from a Matrix Market input buffer
+      void _read_from_mtx(const TextInput& input)
+      {
+        Index trows(0), tcols(0);
+        std::vector<IT_> trow_ptr, tcol_ind;
+        std::vector<DT_> tval;
+        MtxReader::read_csr(input, trows, tcols, trow_ptr, tcol_ind, tval);
+
+        const Index ue(Index(tval.size()));
+        std::vector<IT_> trow_ind(ue);
+        for(Index i(0); i < trows; ++i)
+        {
+          for(IT_ j(trow_ptr[i]); j < trow_ptr[i+1]; ++j)
+            trow_ind[j] = IT_(i);
+        }
+
+        this->clear();
+        this->_scalar_index.push_back(trows * tcols);
+        this->_scalar_index.push_back(trows);
+        this->_scalar_index.push_back(tcols);
+        this->_scalar_index.push_back(ue);
+        this->_scalar_index.push_back(ue);
+        this->_scalar_index.push_back(1000);
+        this->_scalar_index.push_back(1);
+        this->_scalar_dt.push_back(DT_(0));
+
+        this->_elements.push_back(MemoryPool<Mem_>::template allocate_memory<DT_>(ue));
+        this->_elements_size.push_back(ue);
+        this->_indices.push_back(MemoryPool<Mem_>::template allocate_memory<IT_>(ue));
+        this->_indices_size.push_back(ue);
+        this->_indices.push_back(MemoryPool<Mem_>::template allocate_memory<IT_>(ue));
+        this->_indices_size.push_back(ue);
+
+        MemoryPool<Mem_>::template upload<DT_>(this->_elements.at(0), tval.data(), ue);
+        MemoryPool<Mem_>::template upload<IT_>(this->_indices.at(0), trow_ind.data(), ue);
+        MemoryPool<Mem_>::template upload<IT_>(this->_indices.at(1), tcol_ind.data(), ue);
+      }
+
     public:
       /// Our datatype
       typedef DT_ DataType;
@@ -1061,14 +1100,16 @@ namespace FEAT
       /**
        * \brief Serialisation of complete container entity.
        *
+       * \param[in] config LAFEM::SerialConfig, a struct describing the serialise configuration.
+       *
        * Serialize a complete container entity into a single binary array.
        *
        * See \ref FEAT::LAFEM::Container::_serialise for details.
        */
       template <typename DT2_ = DT_, typename IT2_ = IT_>
-      std::vector<char> serialise()
+      std::vector<char> serialise(const LAFEM::SerialConfig& config = LAFEM::SerialConfig())
       {
-        return this->template _serialise<DT2_, IT2_>(FileMode::fm_coo);
+        return this->template _serialise<DT2_, IT2_>(FileMode::fm_coo, config);
       }
 
       /**
@@ -1079,10 +1120,13 @@ namespace FEAT
        */
       void read_from(FileMode mode, String filename)
       {
-        std::ios_base::openmode bin = std::ifstream::in | std::ifstream::binary;
         if(mode == FileMode::fm_mtx)
-          bin = std::ifstream::in;
-        std::ifstream file(filename.c_str(), bin);
+        {
+          TextInput input(filename);
+          _read_from_mtx(input);
+          return;
+        }
+        std::ifstream file(filename.c_str(), std::ifstream::in | std::ifstream::binary);
         if (! file.is_open())
           throw InternalError(__func__, __FILE__, __LINE__, "Unable to open Matrix file " + filename);
         read_from(mode, file);
@@ -1100,130 +1144,8 @@ namespace FEAT
         {
           case FileMode::fm_mtx:
           {
-            this->clear();
-            this->_scalar_index.push_back(0);
-            this->_scalar_index.push_back(0);
-            this->_scalar_index.push_back(0);
-            this->_scalar_index.push_back(0);
-            this->_scalar_index.push_back(0);
-            this->_scalar_index.push_back(1000);
-            this->_scalar_index.push_back(1);
-            this->_scalar_dt.push_back(DT_(0));
-
-            std::map<IT_, std::map<IT_, DT_> > entries; // map<row, map<column, value> >
-
-            Index ue(0);
-            String line;
-            std::getline(file, line);
-            const bool general((line.find("%%MatrixMarket matrix coordinate real general") != String::npos) ? true : false);
-            const bool symmetric((line.find("%%MatrixMarket matrix coordinate real symmetric") != String::npos) ? true : false);
-
-            if (symmetric == false && general == false)
-            {
-              throw InternalError(__func__, __FILE__, __LINE__, "Input-file is not a compatible mtx-file");
-            }
-
-            while(!file.eof())
-            {
-              std::getline(file,line);
-              if (file.eof())
-                throw InternalError(__func__, __FILE__, __LINE__, "Input-file is empty");
-
-              String::size_type begin(line.find_first_not_of(" "));
-              if (line.at(begin) != '%')
-                break;
-            }
-            {
-              String::size_type begin(line.find_first_not_of(" "));
-              line.erase(0, begin);
-              String::size_type end(line.find_first_of(" "));
-              String srow(line, 0, end);
-              Index row((Index)atol(srow.c_str()));
-              line.erase(0, end);
-
-              begin = line.find_first_not_of(" ");
-              line.erase(0, begin);
-              end = line.find_first_of(" ");
-              String scol(line, 0, end);
-              Index col((Index)atol(scol.c_str()));
-              line.erase(0, end);
-              _rows() = row;
-              _columns() = col;
-              _size() = this->rows() * this->columns();
-            }
-            while(!file.eof())
-            {
-              std::getline(file, line);
-              if (file.eof())
-                break;
-
-              String::size_type begin(line.find_first_not_of(" "));
-              line.erase(0, begin);
-              String::size_type end(line.find_first_of(" "));
-              String srow(line, 0, end);
-              IT_ row((IT_)atol(srow.c_str()));
-              --row;
-              line.erase(0, end);
-
-              begin = line.find_first_not_of(" ");
-              line.erase(0, begin);
-              end = line.find_first_of(" ");
-              String scol(line, 0, end);
-              IT_ col((IT_)atol(scol.c_str()));
-              --col;
-              line.erase(0, end);
-
-              begin = line.find_first_not_of(" ");
-              line.erase(0, begin);
-              end = line.find_first_of(" ");
-              String sval(line, 0, end);
-              DT_ tval((DT_)atof(sval.c_str()));
-
-              entries[IT_(row)].insert(std::pair<IT_, DT_>(col, tval));
-              ++ue;
-              if (symmetric == true && row != col)
-              {
-                entries[IT_(col)].insert(std::pair<IT_, DT_>(row, tval));
-                ++ue;
-              }
-            }
-
-            _size() = this->rows() * this->columns();
-            _used_elements() = ue;
-            _allocated_elements() = ue;
-
-            DT_ * tval = new DT_[ue];
-            IT_ * trow = new IT_[ue];
-            IT_ * tcolumn = new IT_[ue];
-
-            Index idx(0);
-            for (auto row : entries)
-            {
-              for (auto col : row.second )
-              {
-                trow[idx] = row.first;
-                tcolumn[idx] = col.first;
-                tval[idx] = col.second;
-                ++idx;
-              }
-              row.second.clear();
-            }
-            entries.clear();
-
-            this->_elements.push_back(MemoryPool<Mem_>::template allocate_memory<DT_>(_used_elements()));
-            this->_elements_size.push_back(_used_elements());
-            this->_indices.push_back(MemoryPool<Mem_>::template allocate_memory<IT_>(_used_elements()));
-            this->_indices_size.push_back(_used_elements());
-            this->_indices.push_back(MemoryPool<Mem_>::template allocate_memory<IT_>(_used_elements()));
-            this->_indices_size.push_back(_used_elements());
-
-            MemoryPool<Mem_>::template upload<DT_>(this->_elements.at(0), tval, _used_elements());
-            MemoryPool<Mem_>::template upload<IT_>(this->_indices.at(0), trow, _used_elements());
-            MemoryPool<Mem_>::template upload<IT_>(this->_indices.at(1), tcolumn, _used_elements());
-
-            delete[] tval;
-            delete[] trow;
-            delete[] tcolumn;
+            TextInput input(file);
+            _read_from_mtx(input);
             break;
           }
           case FileMode::fm_coo:
@@ -222,6 +222,10 @@ public:
     SparseMatrixCSR<Mem_, DT_, IT_> k(kp);
     TEST_CHECK_EQUAL(k, f);
 
+    auto kpz = f.serialise(SerialConfig(true, true));
+    SparseMatrixCSR<Mem_, DT_, IT_> kz(kpz);
+    TEST_CHECK_EQUAL(kz, f);
+
     // new clone testing
     auto clone1 = b.clone(CloneMode::Deep);
     TEST_CHECK_EQUAL(clone1, b);
@@ -0,0 +1,205 @@
+// FEAT3: Finite Element Analysis Toolbox, Version 3
+// Copyright (C) 2010 - 2020 by Stefan Turek & the FEAT group
+// FEAT3 is released under the GNU General Public License version 3,
+// see the file 'copyright.txt' in the top level directory for details.
+
+#include <kernel/base_header.hpp>
+#include <kernel/archs.hpp>
+#include <test_system/test_system.hpp>
+#include <kernel/lafem/sparse_matrix_csr.hpp>
+#include <kernel/lafem/sparse_matrix_bcsr.hpp>
+#include <kernel/lafem/sparse_matrix_dcsr.hpp>
+
+#include <vector>
+
+using namespace FEAT;
+using namespace FEAT::LAFEM;
+using namespace FEAT::TestSystem;
+
+/**
+ * \brief Test class for the delta compressed sparse matrix csr class.
+ *
+ * \test Tests the conversion from and to SparseMatrixCSR/BCSR as well as the (transposed) matrix-vector product
+ * for matrices, which result in 8 bit deltas, 16 bit deltas and escaped column indices.
+ *
+ * \tparam Mem_
+ * description missing
+ *
+ * \tparam DT_
+ * description missing
+ *
+ * \tparam IT_
+ * description missing
+ */
+template<
+  typename Mem_,
+  typename DT_,
+  typename IT_>
+class SparseMatrixDCSRTest
+  : public FullTaggedTest<Mem_, DT_, IT_>
+{
+public:
+   SparseMatrixDCSRTest()
+    : FullTaggedTest<Mem_, DT_, IT_>("SparseMatrixDCSRTest")
+  {
+  }
+
+  virtual ~SparseMatrixDCSRTest()
+  {
+  }
+
+  /// creates a n x n matrix with the given column offsets in each row and optional far off corner entries
+  static SparseMatrixCSR<Mem_, DT_, IT_> create_matrix(const Index n, const std::vector<Index>& offsets, bool corners)
+  {
+    std::vector<IT_> row_ptr(1, IT_(0)), col_ind;
+    std::vector<DT_> val;
+    for (Index row(0) ; row < n ; ++row)
+    {
+      if (corners && (row == n - 1))
+        col_ind.push_back(IT_(0));
+      for (auto off : offsets)
+      {
+        if ((row + off >= n / 2) && (row + off < n + n / 2))
+          col_ind.push_back(IT_(row + off - n / 2));
+      }
+      if (corners && (row == 0))
+        col_ind.push_back(IT_(n - 1));
+      while (val.size() < col_ind.size())
+        val.push_back(DT_(1) + DT_(val.size() % 7) / DT_(3));
+      row_ptr.push_back(IT_(col_ind.size()));
+    }
+
+    DenseVector<Mem_, DT_, IT_> vval(Index(val.size()));
+    DenseVector<Mem_, IT_, IT_> vcol_ind(Index(col_ind.size()));
+    DenseVector<Mem_, IT_, IT_> vrow_ptr(Index(row_ptr.size()));
+    MemoryPool<Mem_>::copy(vval.elements(), val.data(), vval.size());
+    MemoryPool<Mem_>::copy(vcol_ind.elements(), col_ind.data(), vcol_ind.size());
+    MemoryPool<Mem_>::copy(vrow_ptr.elements(), row_ptr.data(), vrow_ptr.size());
+
+    return SparseMatrixCSR<Mem_, DT_, IT_>(n, n, vcol_ind, vval, vrow_ptr);
+  }
+
+  void test_matrix(const SparseMatrixCSR<Mem_, DT_, IT_>& csr, const Index delta_bytes, const Index escapes) const
+  {
+    const DT_ eps = Math::pow(Math::eps<DT_>(), DT_(0.7));
+    const Index n(csr.rows());
+
+    SparseMatrixDCSR<Mem_, DT_, IT_> dcsr(csr);
+    TEST_CHECK_EQUAL(dcsr.rows(), csr.rows());
+    TEST_CHECK_EQUAL(dcsr.columns(), csr.columns());
+    TEST_CHECK_EQUAL(dcsr.used_elements(), csr.used_elements());
+    TEST_CHECK_EQUAL(dcsr.delta_bytes(), delta_bytes);
+    TEST_CHECK_EQUAL(dcsr.used_escapes(), escapes);
+    TEST_CHECK(dcsr.bytes() < csr.bytes());
+
+    // convert back and compare the whole structure
+    SparseMatrixCSR<Mem_, DT_, IT_> csr2;
+    csr2.convert(dcsr);
+    TEST_CHECK_EQUAL(csr2, csr);
+
+    // clone and convert to other index type
+    SparseMatrixDCSR<Mem_, DT_, IT_> dcsr2(dcsr.clone(CloneMode::Deep));
+    SparseMatrixDCSR<Mem_, DT_, unsigned int> dcsr3;
+    dcsr3.convert(dcsr2);
+    TEST_CHECK_EQUAL(dcsr3.used_escapes(), escapes);
+    for (Index row(0) ; row < n ; row += n / 7)
+    {
+      TEST_CHECK_EQUAL(dcsr(row, row), csr(row, row));
+      TEST_CHECK_EQUAL(dcsr3(row, n - 1), csr(row, n - 1));
+      TEST_CHECK_EQUAL(dcsr2(row, 0), csr(row, 0));
+    }
+
+    DenseVector<Mem_, DT_, IT_> x(n), y(n), r(n), ref(n);
+    for (Index i(0) ; i < n ; ++i)
+    {
+      x(i, DT_(i % 100) * DT_(0.0123));
+      y(i, DT_(2) - DT_(i % 42));
+    }
+
+    // r <- A*x
+    csr.apply(ref, x);
+    dcsr.apply(r, x);
+    for (Index i(0) ; i < n ; ++i)
+      TEST_CHECK_EQUAL_WITHIN_EPS(r(i), ref(i), eps);
+
+    // r <- y - 0.5*A*x
+    csr.apply(ref, x, y, DT_(-0.5));
+    dcsr.apply(r, x, y, DT_(-0.5));
+    for (Index i(0) ; i < n ; ++i)
+      TEST_CHECK_EQUAL_WITHIN_EPS(r(i), ref(i), eps);
+
+    // r <- A^T*x and r <- y + 2*A^T*x
+    csr.apply(ref, x, true);
+    dcsr.apply(r, x, true);
+    for (Index i(0) ; i < n ; ++i)
+      TEST_CHECK_EQUAL_WITHIN_EPS(r(i), ref(i), eps);
+    csr.apply(ref, x, y, DT_(2), true);
+    dcsr.apply(r, x, y, DT_(2), true);
+    for (Index i(0) ; i < n ; ++i)
+      TEST_CHECK_EQUAL_WITHIN_EPS(r(i), ref(i), eps);
+
+    // diagonal and lumping
+    DenseVector<Mem_, DT_, IT_> diag(csr.extract_diag()), diag2(dcsr.extract_diag());
+    DenseVector<Mem_, DT_, IT_> lump(csr.lump_rows()), lump2(dcsr.lump_rows());
+    for (Index i(0) ; i < n ; ++i)
+    {
+      TEST_CHECK_EQUAL(diag2(i), diag(i));
+      TEST_CHECK_EQUAL_WITHIN_EPS(lump2(i), lump(i), eps);
+    }
+  }
+
+  virtual void run() const override
+  {
+    std::vector<Index> tridiag = {Index(499), Index(500), Index(501)};
+    std::vector<Index> wide = {Index(200), Index(500), Index(800)};
+    std::vector<Index> huge_tridiag = {Index(34999), Index(35000), Index(35001)};
+
+    // tridiagonal matrix: 8 bit deltas without escapes
+    test_matrix(create_matrix(1000, tridiag, false), 1, 0);
+
+    // column span of 600 per row: 16 bit deltas without escapes
+    test_matrix(create_matrix(1000, wide, false), 2, 0);
+
+    // tridiagonal matrix with two far off corner entries: 8 bit deltas, where the
+    // two corner entries of the last row and the one in the first row are escaped
+    test_matrix(create_matrix(70000, huge_tridiag, true), 1, 3);
+
+    // lower left quarter of an identity matrix: the first half of the rows is empty
+    {
+      SparseMatrixCSR<Mem_, DT_, IT_> csr_e(create_matrix(1000, std::vector<Index>(1, Index(0)), false));
+      SparseMatrixDCSR<Mem_, DT_, IT_> dcsr_e(csr_e);
+      TEST_CHECK_EQUAL(dcsr_e.used_elements(), csr_e.used_elements());
+      SparseMatrixCSR<Mem_, DT_, IT_> csr_e2;
+      csr_e2.convert(dcsr_e);
+      TEST_CHECK_EQUAL(csr_e2, csr_e);
+      DenseVector<Mem_, DT_, IT_> x(csr_e.columns(), DT_(1)), r(csr_e.rows()), ref(csr_e.rows());
+      csr_e.apply(ref, x);
+      dcsr_e.apply(r, x);
+      for (Index i(0) ; i < r.size() ; ++i)
+        TEST_CHECK_EQUAL(r(i), ref(i));
+    }
+
+    // conversion from a BCSR matrix with the same block layout as the tridiagonal matrix
+    SparseMatrixCSR<Mem_, DT_, IT_> csr(create_matrix(1000, tridiag, false));
+    DenseVector<Mem_, IT_, IT_> bcol_ind(csr.used_elements()), brow_ptr(csr.rows() + 1);
+    DenseVector<Mem_, DT_, IT_> bval(4 * csr.used_elements());
+    MemoryPool<Mem_>::copy(bcol_ind.elements(), csr.col_ind(), bcol_ind.size());
+    MemoryPool<Mem_>::copy(brow_ptr.elements(), csr.row_ptr(), brow_ptr.size());
+    for (Index i(0) ; i < bval.size() ; ++i)
+      bval(i, DT_(1) + DT_(i % 5));
+    SparseMatrixBCSR<Mem_, DT_, IT_, 2, 2> bcsr(csr.rows(), csr.columns(), bcol_ind, bval, brow_ptr);
+    SparseMatrixCSR<Mem_, DT_, IT_> csr_b;
+    csr_b.convert(bcsr);
+    SparseMatrixDCSR<Mem_, DT_, IT_> dcsr_b(bcsr);
+    TEST_CHECK_EQUAL(dcsr_b.rows(), bcsr.template rows<Perspective::pod>());
+    TEST_CHECK_EQUAL(dcsr_b.used_elements(), bcsr.template used_elements<Perspective::pod>());
+    SparseMatrixCSR<Mem_, DT_, IT_> csr_b2;
+    csr_b2.convert(dcsr_b);
+    TEST_CHECK_EQUAL(csr_b2, csr_b);
+  }
+};
+
+SparseMatrixDCSRTest<Mem::Main, float, unsigned long> cpu_sparse_matrix_dcsr_test_float_ulong;
+SparseMatrixDCSRTest<Mem::Main, double, unsigned long> cpu_sparse_matrix_dcsr_test_double_ulong;
+SparseMatrixDCSRTest<Mem::Main, float, unsigned int> cpu_sparse_matrix_dcsr_test_float_uint;
+SparseMatrixDCSRTest<Mem::Main, double, unsigned int> cpu_sparse_matrix_dcsr_test_double_uint;
@@ -0,0 +1,830 @@
+// FEAT3: Finite Element Analysis Toolbox, Version 3
+// Copyright (C) 2010 - 2020 by Stefan Turek & the FEAT group
+// FEAT3 is released under the GNU General Public License version 3,
+// see the file 'copyright.txt' in the top level directory for details.
+
+#pragma once
+#ifndef KERNEL_LAFEM_SPARSE_MATRIX_DCSR_HPP
+#define KERNEL_LAFEM_SPARSE_MATRIX_DCSR_HPP 1
+
+// includes, FEAT
+#include <kernel/base_header.hpp>
+#include <kernel/util/assertion.hpp>
+#include <kernel/lafem/forward.hpp>
+#include <kernel/lafem/container.hpp>
+#include <kernel/lafem/dense_vector.hpp>
+#include <kernel/lafem/sparse_matrix_csr.hpp>
+#include <kernel/lafem/arch/apply.hpp>
+#include <kernel/util/statistics.hpp>
+#include <kernel/util/time_stamp.hpp>
+
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+namespace FEAT
+{
+  namespace LAFEM
+  {
+    /**
+     * \brief Delta compressed CSR based sparse matrix.
+     *
+     * \tparam Mem_ The \ref FEAT::Mem "memory architecture" to be used.
+     * \tparam DT_ The datatype to be used.
+     * \tparam IT_ The indexing type to be used.
+     *
+     * This class represents a sparse matrix, that stores its non zero elements in a CSR like format with compressed
+     * column indices: each row stores a base column index and each non zero element only stores the (unsigned) distance
+     * of its column index to the base column of its row as a 8 or 16 bit integer.
+     * Entries, whose distance does not fit into the delta type, store the maximum delta value as an escape marker and
+     * their full column index is stored in a separate (small) escape array.\n
+     * The delta width is chosen automatically during conversion, such that the total size of the index data is minimal.
+     * For matrices with small column spans per row (e.g. FEM matrices after a bandwidth reducing renumbering) this
+     * reduces the index memory traffic of the matrix-vector product by a factor of 4 to 8 compared to the CSR format.\n\n
+     * Data survey: \n
+     * _elements[0]: raw non zero number values \n
+     * _indices[0]: column delta per non zero element, packed as 8 or 16 bit unsigned integers \n
+     * _indices[1]: row start index (including matrix end index)\n
+     * _indices[2]: base column index of each row\n
+     * _indices[3]: column index of each escaped non zero element\n
+     * _indices[4]: row start index into the escaped column indices (including end index), only present
+     * if the matrix contains escaped elements\n
+     *
+     * _scalar_index[0]: container size \n
+     * _scalar_index[1]: row count \n
+     * _scalar_index[2]: column count \n
+     * _scalar_index[3]: non zero element count (used elements) \n
+     * _scalar_index[4]: size of one column delta in bytes \n
+     * _scalar_index[5]: escaped non zero element count \n
+     * _scalar_dt[0]: zero element
+     *
+     * \note This matrix is a read-only container, which can only be created by conversion from another
+     * matrix, e.g. a SparseMatrixCSR or a SparseMatrixBCSR. Currently, only Mem::Main is supported.
+     *
+     * Refer to \ref lafem_design for general usage informations.
+     */
+    template <typename Mem_, typename DT_, typename IT_ = Index>
+    class SparseMatrixDCSR : public Container<Mem_, DT_, IT_>
+    {
+    private:
+      Index & _size()
+      {
+        return this->_scalar_index.at(0);
+      }
+
+      Index & _rows()
+      {
+        return this->_scalar_index.at(1);
+      }
+
+      Index & _columns()
+      {
+        return this->_scalar_index.at(2);
+      }
+
+      Index & _used_elements()
+      {
+        return this->_scalar_index.at(3);
+      }
+
+      Index & _delta_bytes()
+      {
+        return this->_scalar_index.at(4);
+      }
+
+      Index & _used_escapes()
+      {
+        return this->_scalar_index.at(5);
+      }
+
+    public:
+      /// Our memory architecture type
+      typedef Mem_ MemType;
+      /// Our datatype
+      typedef DT_ DataType;
+      /// Our indextype
+      typedef IT_ IndexType;
+      /// Compatible L-vector type
+      typedef DenseVector<Mem_, DT_, IT_> VectorTypeL;
+      /// Compatible R-vector type
+      typedef DenseVector<Mem_, DT_, IT_> VectorTypeR;
+      /// Our 'base' class type
+      template <typename Mem2_, typename DT2_ = DT_, typename IT2_ = IT_>
+      using ContainerType = SparseMatrixDCSR<Mem2_, DT2_, IT2_>;
+
+      /// this typedef lets you create a matrix container with new Memory, Datatape and Index types
+      template <typename Mem2_, typename DataType2_, typename IndexType2_>
+      using ContainerTypeByMDI = ContainerType<Mem2_, DataType2_, IndexType2_>;
+
+      static constexpr bool is_global = false;
+      static constexpr bool is_local = true;
+
+      /**
+       * \brief Constructor
+       *
+       * Creates an empty non dimensional matrix.
+       */
+      explicit SparseMatrixDCSR() :
+        Container<Mem_, DT_, IT_> (0)
+      {
+        this->_scalar_index.push_back(0);
+        this->_scalar_index.push_back(0);
+        this->_scalar_index.push_back(0);
+        this->_scalar_index.push_back(0);
+        this->_scalar_index.push_back(0);
+        this->_scalar_dt.push_back(DT_(0));
+      }
+
+      /**
+       * \brief Constructor
+       *
+       * \param[in] rows_in The row count of the created matrix.
+       * \param[in] columns_in The column count of the created matrix.
+       *
+       * Creates an empty matrix.
+       * Because SparseMatrixDCSR is a read-only container, it stays empty.
+       *
+       * \note This matrix does not allocate any memory
+       */
+      explicit SparseMatrixDCSR(Index rows_in, Index columns_in) :
+        Container<Mem_, DT_, IT_> (rows_in * columns_in)
+      {
+        this->_scalar_index.push_back(rows_in);
+        this->_scalar_index.push_back(columns_in);
+        this->_scalar_index.push_back(0);
+        this->_scalar_index.push_back(0);
+        this->_scalar_index.push_back(0);
+        this->_scalar_dt.push_back(DT_(0));
+      }
+
+      /**
+       * \brief Constructor
+       *
+       * \param[in] other The source matrix.
+       *
+       * Creates a DCSR matrix based on the source matrix.
+       */
+      template <typename MT_>
+      explicit SparseMatrixDCSR(const MT_ & other) :
+        Container<Mem_, DT_, IT_>(other.size())
+      {
+        convert(other);
+      }
+
+      /**
+       * \brief Move Constructor
+       *
+       * \param[in] other The source matrix.
+       *
+       * Moves a given matrix to this matrix.
+       */
+      SparseMatrixDCSR(SparseMatrixDCSR && other) :
+        Container<Mem_, DT_, IT_>(std::forward<SparseMatrixDCSR>(other))
+      {
+      }
+
+      /**
+       * \brief Move operator
+       *
+       * \param[in] other The source matrix.
+       *
+       * Moves another matrix to the target matrix.
+       */
+      SparseMatrixDCSR & operator= (SparseMatrixDCSR && other)
+      {
+        this->move(std::forward<SparseMatrixDCSR>(other));
+
+        return *this;
+      }
+
+      /** \brief Clone operation
+       *
+       * Create a clone of this container.
+       *
+       * \param[in] clone_mode The actual cloning procedure.
+       * \returns The created clone.
+       *
+       */
+      SparseMatrixDCSR clone(CloneMode clone_mode = CloneMode::Weak) const
+      {
+        SparseMatrixDCSR t;
+        t.clone(*this, clone_mode);
+        return t;
+      }
+
+      /** \brief Clone operation
+       *
+       * Create a clone of another container.
+       *
+       * \param[in] other The source container to create the clone from.
+       * \param[in] clone_mode The actual cloning procedure.
+       *
+       */
+      template<typename Mem2_, typename DT2_>
+      void clone(const SparseMatrixDCSR<Mem2_, DT2_, IT_> & other, CloneMode clone_mode = CloneMode::Weak)
+      {
+        Container<Mem_, DT_, IT_>::clone(other, clone_mode);
+      }
+
+      /**
+       * \brief Conversion method
+       *
+       * \param[in] other The source Matrix.
+       *
+       * Use source matrix content as content of current matrix
+       */
+      template <typename Mem2_, typename DT2_, typename IT2_>
+      void convert(const SparseMatrixDCSR<Mem2_, DT2_, IT2_> & other)
+      {
+        // the packed column deltas can only be copied if the index type does not change
+        if (std::is_same<IT_, IT2_>::value)
+        {
+          this->assign(other);
+          return;
+        }
+
+        SparseMatrixCSR<Mem::Main, DT2_, IT2_> tcsr;
+        tcsr.convert(other);
+        this->convert(tcsr);
+      }
+
+      /**
+       * \brief Conversion method
+       *
+       * \param[in] a The input matrix.
+       *
+       * Converts any matrix to SparseMatrixDCSR-format
+       */
+      template <typename MT_>
+      void convert(const MT_ & a)
+      {
+        static_assert(std::is_same<Mem_, Mem::Main>::value, "SparseMatrixDCSR only supports Mem::Main");
+
+        SparseMatrixCSR<Mem::Main, DT_, IT_> tcsr;
+        tcsr.convert(a);
+
+        this->_compress(tcsr);
+      }
+
+      /**
+       * \brief Retrieve specific matrix element.
+       *
+       * \param[in] row The row of the matrix element.
+       * \param[in] col The column of the matrix element.
+       *
+       * \returns Specific matrix element.
+       */
+      DT_ operator()(Index row, Index col) const
+      {
+        ASSERT(row < rows());
+        ASSERT(col < columns());
+
+        const Index length(get_length_of_line(row));
+        std::vector<IT_> cols(length);
+        _decode_line(row, cols.data(), 0, 1);
+
+        const IT_ * prow_ptr(this->row_ptr());
+        for (Index i(0) ; i < length ; ++i)
+        {
+          if (Index(cols[i]) == col)
+            return this->val()[prow_ptr[row] + i];
+        }
+        return zero_element();
+      }
+
+      /**
+       * \brief Retrieve matrix row count.
+       *
+       * \returns Matrix row count.
+       */
+      template <Perspective = Perspective::native>
+      Index rows() const
+      {
+        return this->_scalar_index.at(1);
+      }
+
+      /**
+       * \brief Retrieve matrix column count.
+       *
+       * \returns Matrix column count.
+       */
+      template <Perspective = Perspective::native>
+      Index columns() const
+      {
+        return this->_scalar_index.at(2);
+      }
+
+      /**
+       * \brief Retrieve non zero element count.
+       *
+       * \returns Non zero element count.
+       */
+      template <Perspective = Perspective::native>
+      Index used_elements() const
+      {
+        return this->_scalar_index.at(3);
+      }
+
+      /**
+       * \brief Retrieve the size of a single column delta.
+       *
+       * \returns The number of bytes used for a column delta, i.e. 1 or 2.
+       */
+      Index delta_bytes() const
+      {
+        return this->_scalar_index.at(4);
+      }
+
+      /**
+       * \brief Retrieve escaped non zero element count.
+       *
+       * \returns The number of non zero elements, whose column index is stored explicitly.
+       */
+      Index used_escapes() const
+      {
+        return this->_scalar_index.at(5);
+      }
+
+      /**
+       * \brief Retrieve non zero element array.
+       *
+       * \returns Non zero element array.
+       */
+      DT_ * val()
+      {
+        if (this->_elements.size() == 0)
+          return nullptr;
+
+        return this->_elements.at(0);
+      }
+
+      DT_ const * val() const
+      {
+        if (this->_elements.size() == 0)
+          return nullptr;
+
+        return this->_elements.at(0);
+      }
+
+      /**
+       * \brief Retrieve packed column delta array.
+       *
+       * \tparam DIT_ The delta type, must match delta_bytes().
+       *
+       * \returns Column delta array.
+       */
+      template <typename DIT_>
+      DIT_ const * col_delta() const
+      {
+        XASSERTM(sizeof(DIT_) == delta_bytes(), "delta type does not match delta size!");
+        if (this->_indices.size() == 0)
+          return nullptr;
+
+        return reinterpret_cast<const DIT_*>(this->_indices.at(0));
+      }
+
+      /**
+       * \brief Retrieve row start index array.
+       *
+       * \returns Row start index array.
+       */
+      IT_ const * row_ptr() const
+      {
+        if (this->_indices.size() == 0)
+          return nullptr;
+
+        return this->_indices.at(1);
+      }
+
+      /**
+       * \brief Retrieve row base column array.
+       *
+       * \returns Row base column array.
+       */
+      IT_ const * row_base() const
+      {
+        if (this->_indices.size() == 0)
+          return nullptr;
+
+        return this->_indices.at(2);
+      }
+
+      /**
+       * \brief Retrieve escaped column index array.
+       *
+       * \returns Escaped column index array or \c nullptr, if there are no escaped elements.
+       */
+      IT_ const * esc_col() const
+      {
+        if (this->_indices.size() == 0 || used_escapes() == Index(0))
+          return nullptr;
+
+        return this->_indices.at(3);
+      }
+
+      /**
+       * \brief Retrieve row start index array of the escaped column indices.
+       *
+       * \returns Escaped row start index array or \c nullptr, if there are no escaped elements.
+       */
+      IT_ const * esc_ptr() const
+      {
+        if (this->_indices.size() == 0 || used_escapes() == Index(0))
+          return nullptr;
+
+        return this->_indices.at(4);
+      }
+
+      /**
+       * \brief Retrieve non zero element.
+       *
+       * \returns Non zero element.
+       */
+      DT_ zero_element() const
+      {
+        return this->_scalar_dt.at(0);
+      }
+
+      /**
+       * \brief Returns a descriptive string.
+       *
+       * \returns A string describing the container.
+       */
+      static String name()
+      {
+        return "SparseMatrixDCSR";
+      }
+
+      ///@name Linear algebra operations
+      ///@{
+      /**
+       * \brief Calculate \f$ r \leftarrow this\cdot x \f$
+       *
+       * \param[out] r The vector that receives the result.
+       * \param[in] x The vector to be multiplied by this matrix.
+       * \param[in] transposed Should the product use the transposed matrix?
+       */
+      void apply(DenseVector<Mem_,DT_, IT_> & r, const DenseVector<Mem_, DT_, IT_> & x, bool transposed = false) const
+      {
+        if (transposed)
+        {
+          XASSERTM(r.size() == this->columns(), "Vector size of r does not match!");
+          XASSERTM(x.size() == this->rows(), "Vector size of x does not match!");
+        }
+        else
+        {
+          XASSERTM(r.size() == this->rows(), "Vector size of r does not match!");
+          XASSERTM(x.size() == this->columns(), "Vector size of x does not match!");
+        }
+
+        TimeStamp ts_start;
+
+        if (this->used_elements() == 0)
+        {
+          r.format();
+          return;
+        }
+
+        XASSERTM(r.template elements<Perspective::pod>() != x.template elements<Perspective::pod>(), "Vector x and r must not share the same memory!");
+
+        Statistics::add_flops(this->used_elements() * 2);
+        _apply(r.elements(), DT_(1), x.elements(), DT_(0), r.elements(), transposed);
+
+        TimeStamp ts_stop;
+        Statistics::add_time_blas2(ts_stop.elapsed(ts_start));
+      }
+
+      /**
+       * \brief Calculate \f$ r \leftarrow y + \alpha~ this\cdot x \f$
+       *
+       * \param[out] r The vector that receives the result.
+       * \param[in] x The vector to be multiplied by this matrix.
+       * \param[in] y The summand vector.
+       * \param[in] alpha A scalar to scale the product with.
+       * \param[in] transposed Should the product use the transposed matrix?
+       */
+      void apply(
+                 DenseVector<Mem_,DT_, IT_> & r,
+                 const DenseVector<Mem_, DT_, IT_> & x,
+                 const DenseVector<Mem_, DT_, IT_> & y,
+                 const DT_ alpha = DT_(1),
+                 const bool transposed = false) const
+      {
+        if (transposed)
+        {
+          XASSERTM(r.size() == this->columns(), "Vector size of r does not match!");
+          XASSERTM(x.size() == this->rows(), "Vector size of x does not match!");
+          XASSERTM(y.size() == this->columns(), "Vector size of y does not match!");
+        }
+        else
+        {
+          XASSERTM(r.size() == this->rows(), "Vector size of r does not match!");
+          XASSERTM(x.size() == this->columns(), "Vector size of x does not match!");
+          XASSERTM(y.size() == this->rows(), "Vector size of y does not match!");
+        }
+
+        TimeStamp ts_start;
+
+        if (this->used_elements() == 0 || Math::abs(alpha) < Math::eps<DT_>())
+        {
+          r.copy(y);
+          return;
+        }
+
+        XASSERTM(r.template elements<Perspective::pod>() != x.template elements<Perspective::pod>(), "Vector x and r must not share the same memory!");
+
+        Statistics::add_flops( (this->used_elements() + this->rows()) * 2 );
+        _apply(r.elements(), alpha, x.elements(), DT_(1), y.elements(), transposed);
+
+        TimeStamp ts_stop;
+        Statistics::add_time_blas2(ts_stop.elapsed(ts_start));
+      }
+      ///@}
+
+      /// Returns a new compatible L-Vector.
+      VectorTypeL create_vector_l() const
+      {
+        return VectorTypeL(this->rows());
+      }
+
+      /// Returns a new compatible R-Vector.
+      VectorTypeR create_vector_r() const
+      {
+        return VectorTypeR(this->columns());
+      }
+
+      /// Returns the number of NNZ-elements of the selected row
+      Index get_length_of_line(const Index row) const
+      {
+        const IT_ * prow_ptr(this->row_ptr());
+        return Index(prow_ptr[row + 1] - prow_ptr[row]);
+      }
+
+      /// \cond internal
+
+      /// Writes the non-zero-values and matching col-indices of the selected row in allocated arrays
+      void set_line(const Index row, DT_ * const pval_set, IT_ * const pcol_set,
+                    const Index col_start, const Index stride = 1) const
+      {
+        const IT_ * prow_ptr(this->row_ptr());
+        const DT_ * pval(this->val());
+
+        const Index start(Index(prow_ptr[row]));
+        const Index end(Index(prow_ptr[row + 1] - prow_ptr[row]));
+        for (Index i(0); i < end; ++i)
+        {
+          pval_set[i * stride] = pval[start + i];
+        }
+        _decode_line(row, pcol_set, col_start, stride);
+      }
+
+      /// \endcond
+
+      /**
+       * \brief Decodes the column indices of the selected row
+       *
+       * \param[in] row The row whose column indices are to be decoded.
+       * \param[out] pcol_set The array that receives the get_length_of_line(row) column indices of the row.
+       */
+      void decode_line(const Index row, IT_ * const pcol_set) const
+      {
+        _decode_line(row, pcol_set, 0, 1);
+      }
+
+      /// \copydoc lump_rows()
+      void lump_rows(VectorTypeL& lump) const
+      {
+        XASSERTM(lump.size() == rows(), "lump vector size does not match matrix row count!");
+
+        const IT_ * prow_ptr(this->row_ptr());
+        const DT_ * pval(this->val());
+        DT_ * plump(lump.elements());
+        for (Index row(0) ; row < rows() ; ++row)
+        {
+          DT_ sum(0);
+          for (IT_ i(prow_ptr[row]) ; i < prow_ptr[row + 1] ; ++i)
+            sum += pval[i];
+          plump[row] = sum;
+        }
+      }
+
+      /**
+       * \brief Returns the lumped rows vector
+       *
+       * Each entry in the returned lumped rows vector contains the
+       * the sum of all matrix elements in the corresponding row.
+       *
+       * \returns
+       * The lumped vector.
+       */
+      VectorTypeL lump_rows() const
+      {
+        VectorTypeL lump = create_vector_l();
+        lump_rows(lump);
+        return lump;
+      }
+
+      /// \copydoc extract_diag()
+      void extract_diag(VectorTypeL & diag) const
+      {
+        XASSERTM(diag.size() == rows(), "diag size does not match matrix row count!");
+        XASSERTM(rows() == columns(), "matrix is not square!");
+
+        const IT_ * prow_ptr(this->row_ptr());
+        const DT_ * pval(this->val());
+        DT_ * pdiag(diag.elements());
+        std::vector<IT_> cols;
+        for (Index row(0) ; row < rows() ; ++row)
+        {
+          const Index length(get_length_of_line(row));
+          cols.resize(length);
+          _decode_line(row, cols.data(), 0, 1);
+          pdiag[row] = DT_(0);
+          for (Index i(0) ; i < length ; ++i)
+          {
+            if (Index(cols[i]) == row)
+            {
+              pdiag[row] = pval[prow_ptr[row] + i];
+              break;
+            }
+          }
+        }
+      }
+
+      /// extract main diagonal vector from matrix
+      VectorTypeL extract_diag() const
+      {
+        VectorTypeL diag = create_vector_l();
+        extract_diag(diag);
+        return diag;
+      }
+
+    private:
+      /// dispatches the matrix-vector product to the kernel matching our delta size
+      void _apply(DT_ * r, const DT_ a, const DT_ * const x, const DT_ b, const DT_ * const y, const bool transposed) const
+      {
+        if (delta_bytes() == Index(1))
+        {
+          Arch::Apply<Mem_>::dcsr(r, a, x, b, y, this->val(), this->template col_delta<std::uint8_t>(), this->row_base(),
+            this->row_ptr(), this->esc_col(), this->esc_ptr(), this->rows(), this->columns(), this->used_elements(), transposed);
+        }
+        else
+        {
+          Arch::Apply<Mem_>::dcsr(r, a, x, b, y, this->val(), this->template col_delta<std::uint16_t>(), this->row_base(),
+            this->row_ptr(), this->esc_col(), this->esc_ptr(), this->rows(), this->columns(), this->used_elements(), transposed);
+        }
+      }
+
+      /// writes the decoded column indices of a single row
+      void _decode_line(const Index row, IT_ * const pcol_set, const Index col_start, const Index stride) const
+      {
+        if (delta_bytes() == Index(1))
+          _decode_line(this->template col_delta<std::uint8_t>(), row, pcol_set, col_start, stride);
+        else
+          _decode_line(this->template col_delta<std::uint16_t>(), row, pcol_set, col_start, stride);
+      }
+
+      template <typename DIT_>
+      void _decode_line(const DIT_ * const pdelta, const Index row, IT_ * const pcol_set, const Index col_start, const Index stride) const
+      {
+        const DIT_ escape(std::numeric_limits<DIT_>::max());
+        const IT_ * prow_ptr(this->row_ptr());
+        const IT_ base(this->row_base()[row]);
+        const IT_ * pesc_col(this->esc_col());
+        IT_ esc(pesc_col != nullptr ? this->esc_ptr()[row] : IT_(0));
+
+        const Index start(Index(prow_ptr[row]));
+        const Index end(Index(prow_ptr[row + 1] - prow_ptr[row]));
+        for (Index i(0); i < end; ++i)
+        {
+          const DIT_ d(pdelta[start + i]);
+          pcol_set[i * stride] = (d != escape ? base + IT_(d) : pesc_col[esc++]) + IT_(col_start);
+        }
+      }
+
+      /// counts the number of entries, whose column delta does not fit into DIT_
+      template <typename DIT_>
+      static Index _count_escapes(const SparseMatrixCSR<Mem::Main, DT_, IT_> & csr, const IT_ * const pbase)
+      {
+        const Index escape(Index(std::numeric_limits<DIT_>::max()));
+        const IT_ * prow_ptr(csr.row_ptr());
+        const IT_ * pcol_ind(csr.col_ind());
+
+        Index count(0);
+        for (Index row(0) ; row < csr.rows() ; ++row)
+        {
+          for (IT_ i(prow_ptr[row]) ; i < prow_ptr[row + 1] ; ++i)
+            count += Index(Index(pcol_ind[i] - pbase[row]) >= escape);
+        }
+        return count;
+      }
+
+      /// writes the packed column deltas and the escape arrays
+      template <typename DIT_>
+      void _pack(const SparseMatrixCSR<Mem::Main, DT_, IT_> & csr)
+      {
+        const Index escape(Index(std::numeric_limits<DIT_>::max()));
+        const IT_ * prow_ptr(csr.row_ptr());
+        const IT_ * pcol_ind(csr.col_ind());
+        const IT_ * pbase(this->_indices.at(2));
+        DIT_ * pdelta(reinterpret_cast<DIT_*>(this->_indices.at(0)));
+        IT_ * pesc_col(this->_indices.at(3));
+        IT_ * pesc_ptr(this->_indices.at(4));
+        const bool have_esc(this->_indices_size.at(4) > Index(1));
+
+        IT_ esc(0);
+        pesc_ptr[0] = IT_(0);
+        for (Index row(0) ; row < csr.rows() ; ++row)
+        {
+          for (IT_ i(prow_ptr[row]) ; i < prow_ptr[row + 1] ; ++i)
+          {
+            const Index delta(Index(pcol_ind[i] - pbase[row]));
+            if (delta < escape)
+            {
+              pdelta[i] = DIT_(delta);
+            }
+            else
+            {
+              pdelta[i] = DIT_(escape);
+              pesc_col[esc++] = pcol_ind[i];
+            }
+          }
+          if (have_esc)
+            pesc_ptr[row + 1] = esc;
+        }
+      }
+
+      /// builds this matrix from a CSR matrix in main memory
+      void _compress(const SparseMatrixCSR<Mem::Main, DT_, IT_> & csr)
+      {
+        const Index nrows(csr.rows());
+        const Index nnze(csr.used_elements());
+        const IT_ * prow_ptr(csr.row_ptr());
+        const IT_ * pcol_ind(csr.col_ind());
+
+        this->clear();
+
+        // all arrays contain at least one entry, as the memory pool cannot handle empty arrays
+        const Index val_words(Math::max(nnze, Index(1)));
+        const Index base_words(Math::max(nrows, Index(1)));
+
+        // use the smallest column index of each row as its base
+        IT_ * pbase(MemoryPool<Mem::Main>::template allocate_memory<IT_>(base_words));
+        pbase[0] = IT_(0);
+        for (Index row(0) ; row < nrows ; ++row)
+        {
+          pbase[row] = IT_(0);
+          if (prow_ptr[row] < prow_ptr[row + 1])
+            pbase[row] = pcol_ind[prow_ptr[row]];
+          for (IT_ i(prow_ptr[row]) ; i < prow_ptr[row + 1] ; ++i)
+            pbase[row] = Math::min(pbase[row], pcol_ind[i]);
+        }
+
+        // choose the delta size with the smallest total index footprint
+        const Index esc8(_count_escapes<std::uint8_t>(csr, pbase));
+        const Index esc16(_count_escapes<std::uint16_t>(csr, pbase));
+        const Index delta_bytes((nnze + esc8 * sizeof(IT_) <= 2 * nnze + esc16 * sizeof(IT_)) ? 1 : 2);
+        const Index num_esc(delta_bytes == Index(1) ? esc8 : esc16);
+        const Index delta_words(Math::max((nnze * delta_bytes + sizeof(IT_) - 1) / sizeof(IT_), Index(1)));
+        const Index esc_words(Math::max(num_esc, Index(1)));
+        const Index esc_ptr_words(num_esc > Index(0) ? nrows + 1 : Index(1));
+
+        this->_scalar_index.push_back(csr.size());
+        this->_scalar_index.push_back(nrows);
+        this->_scalar_index.push_back(csr.columns());
+        this->_scalar_index.push_back(nnze);
+        this->_scalar_index.push_back(delta_bytes);
+        this->_scalar_index.push_back(num_esc);
+        this->_scalar_dt.push_back(DT_(0));
+
+        this->_elements.push_back(MemoryPool<Mem::Main>::template allocate_memory<DT_>(val_words));
+        this->_elements_size.push_back(val_words);
+        this->_elements.at(0)[0] = DT_(0);
+        MemoryPool<Mem::Main>::copy(this->_elements.at(0), csr.val(), nnze);
+
+        this->_indices.push_back(MemoryPool<Mem::Main>::template allocate_memory<IT_>(delta_words));
+        this->_indices_size.push_back(delta_words);
+
+        this->_indices.push_back(MemoryPool<Mem::Main>::template allocate_memory<IT_>(nrows + 1));
+        this->_indices_size.push_back(nrows + 1);
+        MemoryPool<Mem::Main>::copy(this->_indices.at(1), prow_ptr, nrows + 1);
+
+        this->_indices.push_back(pbase);
+        this->_indices_size.push_back(base_words);
+
+        this->_indices.push_back(MemoryPool<Mem::Main>::template allocate_memory<IT_>(esc_words));
+        this->_indices_size.push_back(esc_words);
+
+        this->_indices.push_back(MemoryPool<Mem::Main>::template allocate_memory<IT_>(esc_ptr_words));
+        this->_indices_size.push_back(esc_ptr_words);
+
+        if (delta_bytes == Index(1))
+          _pack<std::uint8_t>(csr);
+        else
+          _pack<std::uint16_t>(csr);
+      }
+    }; //SparseMatrixDCSR
+  } // namespace LAFEM
+} // namespace FEAT
+
+#endif // KERNEL_LAFEM_SPARSE_MATRIX_DCSR_HPP
@@ -16,6 +16,7 @@
 #include <kernel/lafem/sparse_matrix_coo.hpp>
 #include <kernel/lafem/sparse_matrix_csr.hpp>
 #include <kernel/lafem/sparse_layout.hpp>
+#include <kernel/lafem/mtx_reader.hpp>
 #include <kernel/lafem/arch/scale_row_col.hpp>
 #include <kernel/lafem/arch/scale.hpp>
 #include <kernel/lafem/arch/axpy.hpp>
@@ -320,6 +321,66 @@ namespace FEAT
         }
       }
 
+      /// reads in the matrix from a Matrix Market input buffer
+      void _read_from_mtx(const TextInput& input)
+      {
+        Index trows(0), tcols(0);
+        std::vector<IT_> trow_ptr, tcol_ind;
+        std::vector<DT_> tval;
+        MtxReader::read_csr(input, trows, tcols, trow_ptr, tcol_ind, tval);
+
+        const IT_ tC((IT_(this->_C())));
+        const Index tnum_of_chunks((trows + tC - IT_(1)) / tC);
+
+        LAFEM::DenseVector<Mem::Main, IT_, IT_> tcl(tnum_of_chunks, IT_(0));
+        IT_ * ptcl(tcl.elements());
+        LAFEM::DenseVector<Mem::Main, IT_, IT_> tcs(tnum_of_chunks + 1);
+        IT_ * ptcs(tcs.elements());
+        LAFEM::DenseVector<Mem::Main, IT_, IT_> trl(trows);
+        IT_ * ptrl(trl.elements());
+
+        for (Index i(0); i < trows; ++i)
+        {
+          ptrl[i] = trow_ptr[i+1] - trow_ptr[i];
+          if (ptrl[i] > ptcl[i/tC])
+            ptcl[i/tC] = ptrl[i];
+        }
+
+        ptcs[0] = IT_(0);
+        for (Index i(0); i < tnum_of_chunks; ++i)
+        {
+          ptcs[i+1] = ptcs[i] + tC * ptcl[i];
+        }
+
+        Index tval_size = Index(ptcs[tnum_of_chunks]);
+
+        LAFEM::DenseVector<Mem::Main, IT_, IT_> tcol_ell(tval_size);
+        IT_ * ptcol_ind(tcol_ell.elements());
+        LAFEM::DenseVector<Mem::Main, DT_, IT_> tval_ell(tval_size);
+        DT_ * ptval(tval_ell.elements());
+
+        for (Index row(0); row < trows; ++row)
+        {
+          IT_ idx(ptcs[row/tC] + IT_(row%tC));
+
+          for (IT_ j(trow_ptr[row]); j < trow_ptr[row+1]; ++j)
+          {
+            ptcol_ind[idx] = tcol_ind[j];
+            ptval    [idx] = tval[j];
+            idx += tC;
+          }
+          for (; idx < ptcs[row/tC + 1]; idx += tC)
+          {
+            ptcol_ind[idx] = IT_(0);
+            ptval    [idx] = DT_(0);
+          }
+        }
+
+        _init_padded_elements<Mem::Main, Mem::Main>(ptval, ptcol_ind, ptcs, trows, tnum_of_chunks, Index(tC));
+
+        this->assign(SparseMatrixELL<Mem::Main, DT_, IT_>(trows, tcols, Index(tval.size()), tval_ell, tcol_ell, tcs, tcl, trl, Index(tC)));
+      }
+
     public:
       /// Our memory architecture type
       typedef Mem_ MemType;
@@ -1220,14 +1281,16 @@ namespace FEAT
       /**
        * \brief Serialisation of complete container entity.
        *
+       * \param[in] config LAFEM::SerialConfig, a struct describing the serialise configuration.
+       *
        * Serialize a complete container entity into a single binary array.
        *
        * See \ref FEAT::LAFEM::Container::_serialise for details.
        */
       template <typename DT2_ = DT_, typename IT2_ = IT_>
-      std::vector<char> serialise()
+      std::vector<char> serialise(const LAFEM::SerialConfig& config = LAFEM::SerialConfig())
       {
-        return this->template _serialise<DT2_, IT2_>(FileMode::fm_ell);
+        return this->template _serialise<DT2_, IT2_>(FileMode::fm_ell, config);
       }
 
       /**
@@ -1238,10 +1301,13 @@ namespace FEAT
        */
       void read_from(FileMode mode, String filename)
       {
-        std::ios_base::openmode bin = std::ifstream::in | std::ifstream::binary;
         if(mode == FileMode::fm_mtx)
-          bin = std::ifstream::in;
-        std::ifstream file(filename.c_str(), bin);
+        {
+          TextInput input(filename);
+          _read_from_mtx(input);
+          return;
+        }
+        std::ifstream file(filename.c_str(), std::ifstream::in | std::ifstream::binary);
         if (! file.is_open())
           throw InternalError(__func__, __FILE__, __LINE__, "Unable to open Matrix file " + filename);
         read_from(mode, file);
@@ -1260,135 +1326,8 @@ namespace FEAT
         {
           case FileMode::fm_mtx:
           {
-            std::map<IT_, std::map<IT_, DT_> > entries; // map<row, map<column, value> >
-
-            IT_ trows;
-            Index tcols, ue(0);
-            String line;
-            std::getline(file, line);
-            const bool general((line.find("%%MatrixMarket matrix coordinate real general") != String::npos) ? true : false);
-            const bool symmetric((line.find("%%MatrixMarket matrix coordinate real symmetric") != String::npos) ? true : false);
-
-            if (symmetric == false && general == false)
-            {
-              throw InternalError(__func__, __FILE__, __LINE__, "Input-file is not a compatible mtx-file");
-            }
-
-            while(!file.eof())
-            {
-              std::getline(file,line);
-              if (file.eof())
-                throw InternalError(__func__, __FILE__, __LINE__, "Input-file is empty");
-
-              String::size_type begin(line.find_first_not_of(" "));
-              if (line.at(begin) != '%')
-                break;
-            }
-            {
-              String::size_type begin(line.find_first_not_of(" "));
-              line.erase(0, begin);
-              String::size_type end(line.find_first_of(" "));
-              String srow(line, 0, end);
-              trows = IT_(atol(srow.c_str()));
-              line.erase(0, end);
-
-              begin = line.find_first_not_of(" ");
-              line.erase(0, begin);
-              end = line.find_first_of(" ");
-              String scol(line, 0, end);
-              tcols = Index(atol(scol.c_str()));
-              line.erase(0, end);
-            }
-
-            while(!file.eof())
-            {
-              std::getline(file, line);
-              if (file.eof())
-                break;
-
-              String::size_type begin(line.find_first_not_of(" "));
-              line.erase(0, begin);
-              String::size_type end(line.find_first_of(" "));
-              String srow(line, 0, end);
-              IT_ row((IT_)atol(srow.c_str()));
-              --row;
-              line.erase(0, end);
-
-              begin = line.find_first_not_of(" ");
-              line.erase(0, begin);
-              end = line.find_first_of(" ");
-              String scol(line, 0, end);
-              IT_ col((IT_)atol(scol.c_str()));
-              --col;
-              line.erase(0, end);
-
-              begin = line.find_first_not_of(" ");
-              line.erase(0, begin);
-              end = line.find_first_of(" ");
-              String sval(line, 0, end);
-              DT_ tval((DT_)atof(sval.c_str()));
-
-              entries[IT_(row)].insert(std::pair<IT_, DT_>(col, tval));
-              ++ue;
-              if (symmetric == true && row != col)
-              {
-                entries[IT_(col)].insert(std::pair<IT_, DT_>(row, tval));
-                ++ue;
-              }
-            }
-
-            const IT_ tC((IT_(this->_C())));
-            const Index tnum_of_chunks((trows + tC - IT_(1)) / tC);
-
-            LAFEM::DenseVector<Mem::Main, IT_, IT_> tcl(tnum_of_chunks, IT_(0));
-            IT_ * ptcl(tcl.elements());
-            LAFEM::DenseVector<Mem::Main, IT_, IT_> tcs(tnum_of_chunks + 1);
-            IT_ * ptcs(tcs.elements());
-            LAFEM::DenseVector<Mem::Main, IT_, IT_> trl((Index(trows)));
-            IT_ * ptrl(trl.elements());
-
-            for (IT_ i(0); i < trows; ++i)
-            {
-              ptrl[i] = IT_(entries[i].size());
-              if (ptrl[i] > ptcl[i/tC])
-                ptcl[i/tC] = IT_(ptrl[i]);
-            }
-
-            ptcs[0] = IT_(0);
-            for (Index i(0); i < tnum_of_chunks; ++i)
-            {
-              ptcs[i+1] = ptcs[i] + tC * ptcl[i];
-            }
-
-            Index tval_size = Index(ptcs[tnum_of_chunks]);
-
-            LAFEM::DenseVector<Mem::Main, IT_, IT_> tcol_ind(tval_size);
-            IT_ * ptcol_ind(tcol_ind.elements());
-            LAFEM::DenseVector<Mem::Main, DT_, IT_> tval(tval_size);
-            DT_ * ptval(tval.elements());
-
-            IT_ row_idx(0);
-            for (auto row : entries)
-            {
-              IT_ idx(ptcs[row_idx/tC] + row_idx%tC);
-
-              for (auto col : row.second)
-              {
-                ptcol_ind[idx] = col.first;
-                ptval    [idx] = col.second;
-                idx += tC;
-              }
-              for (; idx < ptcs[row_idx/tC + 1]; idx += tC)
-              {
-                ptcol_ind[idx] = IT_(0);
-                ptval    [idx] = DT_(0);
-              }
-              ++row_idx;
-            }
-
-            _init_padded_elements<Mem::Main, Mem::Main>(ptval, ptcol_ind, ptcs, Index(trows), tnum_of_chunks, tC);
-
-            this->assign(SparseMatrixELL<Mem::Main, DT_, IT_>(Index(trows), tcols, ue, tval, tcol_ind, tcs, tcl, trl, tC));
+            TextInput input(file);
+            _read_from_mtx(input);
             break;
           }
           case FileMode::fm_ell:
@@ -0,0 +1,202 @@
+// FEAT3: Finite Element Analysis Toolbox, Version 3
+// Copyright (C) 2010 - 2020 by Stefan Turek & the FEAT group
+// FEAT3 is released under the GNU General Public License version 3,
+// see the file 'copyright.txt' in the top level directory for details.
+
+#include <test_system/test_system.hpp>
+#include <kernel/base_header.hpp>
+#include <kernel/archs.hpp>
+#include <kernel/lafem/stencil_matrix.hpp>
+#include <kernel/lafem/pointstar_factory.hpp>
+#include <kernel/util/random.hpp>
+
+using namespace FEAT;
+using namespace FEAT::LAFEM;
+using namespace FEAT::TestSystem;
+
+/**
+ * \brief Test class for the StencilMatrix class.
+ *
+ * \test Tests the matrix-vector products against the assembled CSR matrices as well as the
+ * temporally blocked Jacobi and Chebyshev smoothers against their unblocked counterparts.
+ *
+ * \tparam DT_
+ * The data type.
+ *
+ * \tparam IT_
+ * The index type.
+ */
+template<
+  typename DT_,
+  typename IT_>
+class StencilMatrixTest
+  : public FullTaggedTest<Mem::Main, DT_, IT_>
+{
+public:
+  typedef StencilMatrix<Mem::Main, DT_, IT_> MatrixType;
+  typedef SparseMatrixCSR<Mem::Main, DT_, IT_> CSRType;
+  typedef DenseVector<Mem::Main, DT_, IT_> VectorType;
+
+  StencilMatrixTest()
+    : FullTaggedTest<Mem::Main, DT_, IT_>("StencilMatrixTest")
+  {
+  }
+
+  virtual ~StencilMatrixTest()
+  {
+  }
+
+  static VectorType random_vector(Random& rng, Index n)
+  {
+    VectorType v(n);
+    for(Index i(0); i < n; ++i)
+      v(i, rng(DT_(-1), DT_(1)));
+    return v;
+  }
+
+  static MatrixType random_stencil(Random& rng, Index nx, Index ny, Index nz)
+  {
+    MatrixType a(nx, ny, nz);
+    a.set_center(DT_(8) + rng(DT_(0), DT_(1)));
+    for(int i(0); i < 3; ++i)
+      a.set_axis(i, rng(DT_(-1), DT_(0)), rng(DT_(-1), DT_(0)));
+    return a;
+  }
+
+  void test_pointstar() const
+  {
+    const DT_ tol(Math::pow(Math::eps<DT_>(), DT_(0.7)));
+    Random rng;
+
+    for(Index d(1); d < 4; ++d)
+    {
+      for(Index m(3); m < 7; ++m)
+      {
+        PointstarFactoryFD<DT_, IT_> factory(m, d);
+        CSRType csr(factory.matrix_csr());
+        MatrixType a(factory.matrix_stencil());
+
+        TEST_CHECK_EQUAL(a.rows(), csr.rows());
+        TEST_CHECK_EQUAL(a.used_elements(), csr.used_elements());
+        TEST_CHECK_EQUAL(a.matrix_csr(), csr);
+        TEST_CHECK_EQUAL_WITHIN_EPS(a.lambda_min(), factory.lambda_min(), tol);
+        TEST_CHECK_EQUAL_WITHIN_EPS(a.lambda_max(), factory.lambda_max(), tol);
+
+        VectorType x(random_vector(rng, a.columns()));
+        VectorType r(a.create_vector_l()), s(a.create_vector_l());
+        a.apply(r, x);
+        csr.apply(s, x);
+        s.axpy(r, s, -DT_(1));
+        TEST_CHECK_EQUAL_WITHIN_EPS(s.norm2(), DT_(0), tol);
+      }
+    }
+  }
+
+  void test_apply(Index nx, Index ny, Index nz) const
+  {
+    const DT_ tol(Math::pow(Math::eps<DT_>(), DT_(0.7)));
+    Random rng;
+
+    MatrixType a(random_stencil(rng, nx, ny, nz));
+    CSRType csr(a.matrix_csr());
+    TEST_CHECK_EQUAL(a.used_elements(), csr.used_elements());
+
+    VectorType x(random_vector(rng, a.columns()));
+    VectorType y(random_vector(rng, a.rows()));
+    VectorType r(a.create_vector_l()), s(a.create_vector_l());
+
+    a.apply(r, x);
+    csr.apply(s, x);
+    s.axpy(r, s, -DT_(1));
+    TEST_CHECK_EQUAL_WITHIN_EPS(s.norm2(), DT_(0), tol);
+
+    a.apply(r, x, y, -DT_(0.5));
+    csr.apply(s, x, y, -DT_(0.5));
+    s.axpy(r, s, -DT_(1));
+    TEST_CHECK_EQUAL_WITHIN_EPS(s.norm2(), DT_(0), tol);
+
+    VectorType diag(a.extract_diag()), lump(a.lump_rows());
+    VectorType diag_csr(csr.extract_diag()), lump_csr(csr.lump_rows());
+    TEST_CHECK_EQUAL(diag, diag_csr);
+    lump.axpy(lump_csr, lump, -DT_(1));
+    TEST_CHECK_EQUAL_WITHIN_EPS(lump.norm2(), DT_(0), tol);
+  }
+
+  void test_smooth(Index nx, Index ny, Index nz) const
+  {
+    const DT_ tol(Math::pow(Math::eps<DT_>(), DT_(0.7)));
+    Random rng;
+
+    MatrixType a(random_stencil(rng, nx, ny, nz));
+    CSRType csr(a.matrix_csr());
+
+    const VectorType b(random_vector(rng, a.rows()));
+    const VectorType x0(random_vector(rng, a.columns()));
+    const Index steps(7);
+
+    // damped Jacobi
+    {
+      const DT_ omega(0.7);
+      VectorType x(x0.clone()), d(a.create_vector_l());
+      for(Index k(0); k < steps; ++k)
+      {
+        csr.apply(d, x, b, -DT_(1));
+        x.axpy(d, x, omega / a.get_center());
+      }
+
+      for(Index block(1); block < steps + 2; block += 3)
+      {
+        a.set_block_steps(block);
+        VectorType z(x0.clone());
+        a.smooth_jacobi(z, b, omega, steps);
+        z.axpy(x, z, -DT_(1));
+        TEST_CHECK_EQUAL_WITHIN_EPS(z.norm2(), DT_(0), tol);
+      }
+    }
+
+    // Chebyshev
+    {
+      const DT_ lmax(a.get_center() + DT_(2) * (Math::abs(a.get_lower(0)) + Math::abs(a.get_upper(0))));
+      const DT_ lmin(DT_(0.25) * lmax);
+      const DT_ dd((lmax + lmin) / DT_(2)), cc((lmax - lmin) / DT_(2));
+      VectorType x(x0.clone()), d(a.create_vector_l()), c(a.rows(), DT_(0));
+      DT_ alpha(0);
+      for(Index k(0); k < steps; ++k)
+      {
+        if(k == 0)
+          alpha = DT_(1) / dd;
+        else if(k == 1)
+          alpha = DT_(2) * dd / (DT_(2) * dd * dd - cc * cc);
+        else
+          alpha = DT_(1) / (dd - alpha * cc * cc / DT_(4));
+        csr.apply(d, x, b, -DT_(1));
+        c.scale(c, k == 0 ? DT_(0) : alpha * dd - DT_(1));
+        c.axpy(d, c, alpha);
+        x.axpy(c, x);
+      }
+
+      for(Index block(1); block < steps + 2; block += 3)
+      {
+        a.set_block_steps(block);
+        VectorType z(x0.clone());
+        a.smooth_chebyshev(z, b, lmin, lmax, steps);
+        z.axpy(x, z, -DT_(1));
+        TEST_CHECK_EQUAL_WITHIN_EPS(z.norm2(), DT_(0), tol);
+      }
+    }
+  }
+
+  virtual void run() const override
+  {
+    test_pointstar();
+    test_apply(Index(17), Index(1), Index(1));
+    test_apply(Index(9), Index(6), Index(1));
+    test_apply(Index(7), Index(5), Index(4));
+    test_apply(Index(1), Index(5), Index(4));
+    test_smooth(Index(13), Index(1), Index(1));
+    test_smooth(Index(8), Index(11), Index(1));
+    test_smooth(Index(6), Index(5), Index(9));
+  }
+};
+StencilMatrixTest<float, unsigned int> stencil_matrix_test_float_uint;
+StencilMatrixTest<double, unsigned long> stencil_matrix_test_double_ulong;
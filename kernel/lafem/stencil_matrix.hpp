@@ -0,0 +1,633 @@
+// FEAT3: Finite Element Analysis Toolbox, Version 3
+// Copyright (C) 2010 - 2020 by Stefan Turek & the FEAT group
+// FEAT3 is released under the GNU General Public License version 3,
+// see the file 'copyright.txt' in the top level directory for details.
+
+#pragma once
+#ifndef KERNEL_LAFEM_STENCIL_MATRIX_HPP
+#define KERNEL_LAFEM_STENCIL_MATRIX_HPP 1
+
+// includes, FEAT
+#include <kernel/base_header.hpp>
+#include <kernel/util/assertion.hpp>
+#include <kernel/util/math.hpp>
+#include <kernel/util/statistics.hpp>
+#include <kernel/util/time_stamp.hpp>
+#include <kernel/lafem/base.hpp>
+#include <kernel/lafem/dense_vector.hpp>
+#include <kernel/lafem/sparse_matrix_csr.hpp>
+#include <kernel/lafem/arch/stencil.hpp>
+
+#include <array>
+#include <type_traits>
+#include <vector>
+
+namespace FEAT
+{
+  namespace LAFEM
+  {
+    /**
+     * \brief Matrix-free constant coefficient pointstar stencil operator
+     *
+     * This class represents the matrix of a constant coefficient 3/5/7-point stencil on a
+     * structured nx x ny x nz grid of inner nodes in the common LAFEM matrix interface.
+     * The nodes are numbered lexicographically with x running fastest, i.e. in the same way as
+     * the inner vertices of a Geometry::StructuredMesh or the rows of the PointstarFactoryFD matrices.
+     * Couplings to nodes outside of the grid are dropped, which corresponds to the elimination
+     * of homogeneous Dirichlet boundary conditions.
+     *
+     * In contrast to SparseMatrixBanded, which stores a full value array for each of its diagonals,
+     * this class only stores one coefficient per stencil point, so the matrix-vector product only
+     * has to stream the vectors. Moreover, this class offers temporally blocked Jacobi and
+     * Chebyshev smoothers, which perform several smoothing steps in a single sweep over the grid.
+     *
+     * \tparam Mem_ The \ref FEAT::Mem "memory architecture" to be used; only Mem::Main is supported.
+     * \tparam DT_ The datatype to be used.
+     * \tparam IT_ The indexing type to be used.
+     */
+    template <typename Mem_, typename DT_, typename IT_ = Index>
+    class StencilMatrix
+    {
+      static_assert(std::is_same<Mem_, Mem::Main>::value, "StencilMatrix is only available for Mem::Main");
+
+    public:
+      /// Our memory architecture type
+      typedef Mem_ MemType;
+      /// Our datatype
+      typedef DT_ DataType;
+      /// Our indextype
+      typedef IT_ IndexType;
+      /// Value type, meaning the type of each 'block'
+      typedef DT_ ValueType;
+      /// Compatible L-vector type
+      typedef DenseVector<Mem_, DT_, IT_> VectorTypeL;
+      /// Compatible R-vector type
+      typedef DenseVector<Mem_, DT_, IT_> VectorTypeR;
+
+      /// Our 'base' class type
+      template <typename Mem2_, typename DT2_ = DT_, typename IT2_ = IT_>
+      using ContainerType = StencilMatrix<Mem2_, DT2_, IT2_>;
+
+      /// this typedef lets you create a matrix container with new Memory, Datatype and Index types
+      template <typename Mem2_, typename DataType2_, typename IndexType2_>
+      using ContainerTypeByMDI = ContainerType<Mem2_, DataType2_, IndexType2_>;
+
+      static constexpr bool is_global = false;
+      static constexpr bool is_local = true;
+
+    private:
+      /// number of nodes in x-, y- and z-direction
+      std::array<Index, 3> _num_nodes;
+      /// stencil coefficients: center, x-lower, x-upper, y-lower, y-upper, z-lower, z-upper
+      std::array<DT_, 7> _coeffs;
+      /// maximum number of smoothing steps per sweep
+      Index _block_steps;
+
+      /// computes the kernel grid dimensions and coefficients
+      void _kernel_setup(Index& nx, Index& ny, Index& nz, std::array<DT_, 7>& coeffs) const
+      {
+        nx = _num_nodes[0];
+        ny = _num_nodes[1];
+        nz = _num_nodes[2];
+        coeffs = _coeffs;
+
+        // the kernels block over z-planes, so a 2D grid is processed as a stack of x-lines
+        if((nz == Index(1)) && (ny > Index(1)))
+        {
+          nz = ny;
+          ny = Index(1);
+          coeffs[5] = _coeffs[3];
+          coeffs[6] = _coeffs[4];
+          coeffs[3] = coeffs[4] = DT_(0);
+        }
+      }
+
+      /// performs the smoothing steps given by the coefficient arrays in sweeps of at most _block_steps steps
+      void _smooth(VectorTypeR& x, const VectorTypeL& b, const std::vector<DT_>& alphas, const std::vector<DT_>& betas) const
+      {
+        XASSERTM(x.size() == this->columns(), "Vector size of x does not match!");
+        XASSERTM(b.size() == this->rows(), "Vector size of b does not match!");
+
+        Index nx, ny, nz;
+        std::array<DT_, 7> coeffs;
+        _kernel_setup(nx, ny, nz, coeffs);
+
+        TimeStamp ts_start;
+        Statistics::add_flops(Index(alphas.size()) * (2 * this->used_elements() + 5 * this->rows()));
+
+        VectorTypeR cor(x.size(), DT_(0));
+        const Index steps(Index(alphas.size()));
+        for(Index k(0); k < steps; k += _block_steps)
+        {
+          Arch::Stencil<Mem_>::smooth(x.elements(), cor.elements(), b.elements(), coeffs.data(),
+            &alphas[k], &betas[k], Math::min(_block_steps, steps - k), nx, ny, nz);
+        }
+
+        TimeStamp ts_stop;
+        Statistics::add_time_blas2(ts_stop.elapsed(ts_start));
+      }
+
+    public:
+      /**
+       * \brief Constructor
+       *
+       * Creates an empty matrix.
+       */
+      explicit StencilMatrix() :
+        _block_steps(4)
+      {
+        _num_nodes.fill(Index(0));
+        _coeffs.fill(DT_(0));
+      }
+
+      /**
+       * \brief Constructor
+       *
+       * \param[in] nx, ny, nz
+       * The number of inner nodes in each direction. Set \p nz = 1 for a 2D grid and
+       * \p ny = \p nz = 1 for a 1D grid.
+       *
+       * Creates a matrix with all stencil coefficients set to zero.
+       */
+      explicit StencilMatrix(Index nx, Index ny = Index(1), Index nz = Index(1)) :
+        _block_steps(4)
+      {
+        XASSERTM((nx > Index(0)) && (ny > Index(0)) && (nz > Index(0)), "invalid grid dimensions");
+        _num_nodes[0] = nx;
+        _num_nodes[1] = ny;
+        _num_nodes[2] = nz;
+        _coeffs.fill(DT_(0));
+      }
+
+      /**
+       * \brief Creates the finite-differences Laplace stencil
+       *
+       * \param[in] m
+       * The number of inner nodes per dimension.
+       *
+       * \param[in] d
+       * The dimension of the grid; must be 1, 2 or 3.
+       *
+       * \returns
+       * The m^d x m^d matrix, which coincides with the one of PointstarFactoryFD(m, d).
+       */
+      static StencilMatrix laplace(Index m, int d)
+      {
+        XASSERTM((d >= 1) && (d <= 3), "invalid dimension");
+        StencilMatrix matrix(m, d > 1 ? m : Index(1), d > 2 ? m : Index(1));
+        matrix.set_center(DT_(2*d));
+        for(int i(0); i < d; ++i)
+          matrix.set_axis(i, -DT_(1), -DT_(1));
+        return matrix;
+      }
+
+      /// move constructor
+      StencilMatrix(StencilMatrix&& other) = default;
+      /// move-assignment operator
+      StencilMatrix& operator=(StencilMatrix&& other) = default;
+
+      /** \brief Clone operation
+       *
+       * Create a clone of this container.
+       *
+       * \param[in] clone_mode The actual cloning procedure.
+       * \returns The created clone.
+       */
+      StencilMatrix clone(CloneMode DOXY(clone_mode) = CloneMode::Weak) const
+      {
+        StencilMatrix t;
+        t._num_nodes = this->_num_nodes;
+        t._coeffs = this->_coeffs;
+        t._block_steps = this->_block_steps;
+        return t;
+      }
+
+      /** \brief Clone operation
+       *
+       * Become a clone of a given container.
+       *
+       * \param[in] other The source container.
+       * \param[in] clone_mode The actual cloning procedure.
+       */
+      template<typename Mem2_, typename DT2_, typename IT2_>
+      void clone(const StencilMatrix<Mem2_, DT2_, IT2_>& other, CloneMode DOXY(clone_mode) = CloneMode::Weak)
+      {
+        this->convert(other);
+      }
+
+      /**
+       * \brief Conversion method
+       *
+       * \param[in] other The source matrix.
+       */
+      template <typename Mem2_, typename DT2_, typename IT2_>
+      void convert(const StencilMatrix<Mem2_, DT2_, IT2_>& other)
+      {
+        for(int i(0); i < 3; ++i)
+          this->_num_nodes[std::size_t(i)] = other.get_num_nodes(i);
+        this->_coeffs[0] = DT_(other.get_center());
+        for(int i(0); i < 3; ++i)
+          this->set_axis(i, DT_(other.get_lower(i)), DT_(other.get_upper(i)));
+        this->_block_steps = other.get_block_steps();
+      }
+
+      /**
+       * \brief Sets the coefficient of the center point
+       *
+       * \param[in] value The new center coefficient.
+       */
+      void set_center(DT_ value)
+      {
+        _coeffs[0] = value;
+      }
+
+      /**
+       * \brief Sets the coefficients of the two neighbours along an axis
+       *
+       * \param[in] axis The axis, i.e. 0 for x, 1 for y and 2 for z.
+       * \param[in] lower The coefficient of the neighbour with the smaller coordinate.
+       * \param[in] upper The coefficient of the neighbour with the greater coordinate.
+       */
+      void set_axis(int axis, DT_ lower, DT_ upper)
+      {
+        XASSERTM((axis >= 0) && (axis < 3), "invalid axis");
+        _coeffs[std::size_t(2*axis + 1)] = lower;
+        _coeffs[std::size_t(2*axis + 2)] = upper;
+      }
+
+      /// \returns The coefficient of the center point.
+      DT_ get_center() const
+      {
+        return _coeffs[0];
+      }
+
+      /// \returns The coefficient of the lower neighbour along an axis.
+      DT_ get_lower(int axis) const
+      {
+        XASSERTM((axis >= 0) && (axis < 3), "invalid axis");
+        return _coeffs[std::size_t(2*axis + 1)];
+      }
+
+      /// \returns The coefficient of the upper neighbour along an axis.
+      DT_ get_upper(int axis) const
+      {
+        XASSERTM((axis >= 0) && (axis < 3), "invalid axis");
+        return _coeffs[std::size_t(2*axis + 2)];
+      }
+
+      /// \returns The number of inner nodes along an axis.
+      Index get_num_nodes(int axis) const
+      {
+        XASSERTM((axis >= 0) && (axis < 3), "invalid axis");
+        return _num_nodes[std::size_t(axis)];
+      }
+
+      /**
+       * \brief Sets the temporal blocking depth
+       *
+       * \param[in] block_steps
+       * The maximum number of smoothing steps, which are performed in a single sweep over the grid.
+       * Each step of a sweep requires a buffer of six z-planes (or three x-lines in 2D).
+       */
+      void set_block_steps(Index block_steps)
+      {
+        XASSERTM(block_steps > Index(0), "block steps must be positive");
+        _block_steps = block_steps;
+      }
+
+      /// \returns The temporal blocking depth.
+      Index get_block_steps() const
+      {
+        return _block_steps;
+      }
+
+      /**
+       * \brief Retrieve matrix row count.
+       *
+       * \returns Matrix row count.
+       */
+      template <Perspective = Perspective::native>
+      Index rows() const
+      {
+        return _num_nodes[0] * _num_nodes[1] * _num_nodes[2];
+      }
+
+      /**
+       * \brief Retrieve matrix column count.
+       *
+       * \returns Matrix column count.
+       */
+      template <Perspective = Perspective::native>
+      Index columns() const
+      {
+        return this->rows();
+      }
+
+      /**
+       * \brief Retrieve non zero element count.
+       *
+       * \returns The number of couplings of the stencil within the grid.
+       */
+      template <Perspective = Perspective::native>
+      Index used_elements() const
+      {
+        const Index n(this->rows());
+        Index nze(n);
+        for(std::size_t i(0); i < 3; ++i)
+          nze += Index(2) * (n / _num_nodes[i]) * (_num_nodes[i] - Index(1));
+        return nze;
+      }
+
+      /**
+       * \brief Returns a descriptive string.
+       *
+       * \returns A string describing the container.
+       */
+      static String name()
+      {
+        return "StencilMatrix";
+      }
+
+      /**
+       * \brief Returns the total amount of bytes allocated.
+       *
+       * \returns The size of the stencil coefficients.
+       */
+      std::size_t bytes() const
+      {
+        return _coeffs.size() * sizeof(DT_);
+      }
+
+      /**
+       * \brief Reset all stencil coefficients to a given value or zero if missing.
+       *
+       * \param[in] value The value to be set (defaults to 0)
+       */
+      void format(const DT_ value = DT_(0))
+      {
+        _coeffs.fill(value);
+      }
+
+      /**
+       * \brief Performs \f$this \leftarrow \alpha\cdot x \f$
+       *
+       * \param[in] x The matrix to be scaled.
+       * \param[in] alpha A scalar to scale x with.
+       */
+      void scale(const StencilMatrix& x, const DT_ alpha)
+      {
+        XASSERTM(x.rows() == this->rows(), "Row count does not match!");
+        this->_num_nodes = x._num_nodes;
+        for(std::size_t i(0); i < _coeffs.size(); ++i)
+          _coeffs[i] = alpha * x._coeffs[i];
+      }
+
+      /**
+       * \brief Computes the smallest eigenvalue of a symmetric stencil
+       *
+       * \note The stencil must be symmetric, i.e. the lower and upper coefficients of each axis must coincide.
+       *
+       * \returns The smallest eigenvalue of the matrix.
+       */
+      DT_ lambda_min() const
+      {
+        return _coeffs[0] - _lambda_offset();
+      }
+
+      /**
+       * \brief Computes the largest eigenvalue of a symmetric stencil
+       *
+       * \note The stencil must be symmetric, i.e. the lower and upper coefficients of each axis must coincide.
+       *
+       * \returns The largest eigenvalue of the matrix.
+       */
+      DT_ lambda_max() const
+      {
+        return _coeffs[0] + _lambda_offset();
+      }
+
+      /**
+       * \brief Calculate \f$ r \leftarrow this\cdot x \f$
+       *
+       * \param[out] r The vector that receives the result.
+       * \param[in] x The vector to be multiplied by this matrix.
+       */
+      void apply(DenseVector<Mem_,DT_, IT_>& r, const DenseVector<Mem_, DT_, IT_>& x) const
+      {
+        XASSERTM(r.size() == this->rows(), "Vector size of r does not match!");
+        XASSERTM(x.size() == this->columns(), "Vector size of x does not match!");
+
+        XASSERTM(r.template elements<Perspective::pod>() != x.template elements<Perspective::pod>(), "Vector x and r must not share the same memory!");
+
+        Index nx, ny, nz;
+        std::array<DT_, 7> coeffs;
+        _kernel_setup(nx, ny, nz, coeffs);
+
+        TimeStamp ts_start;
+        Statistics::add_flops( 2 * this->used_elements() );
+
+        Arch::Stencil<Mem_>::apply(r.elements(), DT_(1), x.elements(), DT_(0), r.elements(), coeffs.data(), nx, ny, nz);
+
+        TimeStamp ts_stop;
+        Statistics::add_time_blas2(ts_stop.elapsed(ts_start));
+      }
+
+      /**
+       * \brief Calculate \f$ r \leftarrow y + \alpha~ this\cdot x \f$
+       *
+       * \param[out] r The vector that receives the result.
+       * \param[in] x The vector to be multiplied by this matrix.
+       * \param[in] y The summand vector.
+       * \param[in] alpha A scalar to scale the product with.
+       */
+      void apply(DenseVector<Mem_,DT_, IT_>& r,
+                 const DenseVector<Mem_, DT_, IT_>& x,
+                 const DenseVector<Mem_, DT_, IT_>& y,
+                 const DT_ alpha = DT_(1)) const
+      {
+        XASSERTM(r.size() == this->rows(), "Vector size of r does not match!");
+        XASSERTM(x.size() == this->columns(), "Vector size of x does not match!");
+        XASSERTM(y.size() == this->rows(), "Vector size of y does not match!");
+
+        XASSERTM(r.template elements<Perspective::pod>() != x.template elements<Perspective::pod>(), "Vector x and r must not share the same memory!");
+
+        Index nx, ny, nz;
+        std::array<DT_, 7> coeffs;
+        _kernel_setup(nx, ny, nz, coeffs);
+
+        TimeStamp ts_start;
+        Statistics::add_flops( 2 * (this->used_elements() + this->rows()) );
+
+        Arch::Stencil<Mem_>::apply(r.elements(), alpha, x.elements(), DT_(1), y.elements(), coeffs.data(), nx, ny, nz);
+
+        TimeStamp ts_stop;
+        Statistics::add_time_blas2(ts_stop.elapsed(ts_start));
+      }
+
+      /**
+       * \brief Performs temporally blocked damped Jacobi smoothing steps
+       *
+       * Performs \p steps iterations of \f$ x \leftarrow x + \omega D^{-1}(b - Ax) \f$.
+       *
+       * \param[in,out] x The iterate to be smoothed.
+       * \param[in] b The right hand side vector.
+       * \param[in] omega The damping parameter.
+       * \param[in] steps The number of smoothing steps.
+       */
+      void smooth_jacobi(VectorTypeR& x, const VectorTypeL& b, const DT_ omega, const Index steps) const
+      {
+        XASSERTM(Math::abs(_coeffs[0]) > Math::eps<DT_>(), "stencil has a zero center coefficient");
+        std::vector<DT_> alphas(steps, omega / _coeffs[0]), betas(steps, DT_(0));
+        _smooth(x, b, alphas, betas);
+      }
+
+      /**
+       * \brief Performs temporally blocked Chebyshev smoothing steps
+       *
+       * Performs \p steps iterations of the Chebyshev iteration for the spectral interval
+       * [\p lambda_min, \p lambda_max] with the same recurrence as Solver::Chebyshev.
+       * For smoothing, this interval should only cover the upper part of the spectrum,
+       * e.g. [0.25*lambda_max(), lambda_max()].
+       *
+       * \param[in,out] x The iterate to be smoothed.
+       * \param[in] b The right hand side vector.
+       * \param[in] lambda_min, lambda_max The spectral interval to be damped.
+       * \param[in] steps The number of smoothing steps.
+       */
+      void smooth_chebyshev(VectorTypeR& x, const VectorTypeL& b, const DT_ lambda_min, const DT_ lambda_max, const Index steps) const
+      {
+        XASSERTM(lambda_min < lambda_max, "invalid spectral interval");
+        const DT_ d = (lambda_max + lambda_min) / DT_(2);
+        const DT_ c = (lambda_max - lambda_min) / DT_(2);
+        std::vector<DT_> alphas(steps), betas(steps);
+        DT_ alpha(0);
+        for(Index k(0); k < steps; ++k)
+        {
+          switch(k)
+          {
+          case 0:
+            alpha = DT_(1) / d;
+            break;
+          case 1:
+            alpha = DT_(2) * d * (DT_(1) / ((DT_(2) * d * d) - (c * c)));
+            break;
+          default:
+            alpha = DT_(1) / (d - ((alpha * c * c) / DT_(4)));
+          }
+          alphas[k] = alpha;
+          betas[k] = (k == Index(0) ? DT_(0) : alpha * d - DT_(1));
+        }
+        _smooth(x, b, alphas, betas);
+      }
+
+      /// \copydoc extract_diag()
+      void extract_diag(VectorTypeL & diag) const
+      {
+        XASSERTM(diag.size() == rows(), "diag size does not match matrix row count!");
+        diag.format(_coeffs[0]);
+      }
+
+      /// extract main diagonal vector from matrix
+      VectorTypeL extract_diag() const
+      {
+        VectorTypeL diag = create_vector_l();
+        extract_diag(diag);
+        return diag;
+      }
+
+      /// \copydoc lump_rows()
+      void lump_rows(VectorTypeL& lump) const
+      {
+        XASSERTM(lump.size() == rows(), "lump vector size does not match matrix row count!");
+        VectorTypeR ones(this->columns(), DT_(1));
+        this->apply(lump, ones);
+      }
+
+      /**
+       * \brief Returns the lumped rows vector
+       *
+       * Each entry in the returned lumped rows vector contains the
+       * the sum of all matrix elements in the corresponding row.
+       *
+       * \returns
+       * The lumped vector.
+       */
+      VectorTypeL lump_rows() const
+      {
+        VectorTypeL lump = create_vector_l();
+        lump_rows(lump);
+        return lump;
+      }
+
+      /**
+       * \brief Assembles the matrix in CSR format
+       *
+       * \returns The assembled matrix.
+       */
+      SparseMatrixCSR<Mem::Main, DT_, IT_> matrix_csr() const
+      {
+        const Index n(this->rows()), nze(this->used_elements());
+        const Index nx(_num_nodes[0]), ny(_num_nodes[1]), nz(_num_nodes[2]);
+        DenseVector<Mem::Main, IT_, IT_> vrow_ptr(n + Index(1));
+        DenseVector<Mem::Main, IT_, IT_> vcol_idx(nze);
+        DenseVector<Mem::Main, DT_, IT_> vval(nze);
+        IT_* row_ptr = vrow_ptr.elements();
+        IT_* col_idx = vcol_idx.elements();
+        DT_* val = vval.elements();
+
+        Index k(0);
+        row_ptr[0] = IT_(0);
+        for(Index iz(0); iz < nz; ++iz)
+        {
+          for(Index iy(0); iy < ny; ++iy)
+          {
+            for(Index ix(0); ix < nx; ++ix)
+            {
+              const Index i((iz * ny + iy) * nx + ix);
+              // insert couplings in ascending column order
+              if(iz > Index(0))      {col_idx[k] = IT_(i - nx*ny); val[k++] = _coeffs[5];}
+              if(iy > Index(0))      {col_idx[k] = IT_(i - nx);    val[k++] = _coeffs[3];}
+              if(ix > Index(0))      {col_idx[k] = IT_(i - 1);     val[k++] = _coeffs[1];}
+              col_idx[k] = IT_(i); val[k++] = _coeffs[0];
+              if(ix + 1 < nx)        {col_idx[k] = IT_(i + 1);     val[k++] = _coeffs[2];}
+              if(iy + 1 < ny)        {col_idx[k] = IT_(i + nx);    val[k++] = _coeffs[4];}
+              if(iz + 1 < nz)        {col_idx[k] = IT_(i + nx*ny); val[k++] = _coeffs[6];}
+              row_ptr[i + 1] = IT_(k);
+            }
+          }
+        }
+
+        return SparseMatrixCSR<Mem::Main, DT_, IT_>(n, n, vcol_idx, vval, vrow_ptr);
+      }
+
+      /// \cond internal
+      // Returns a new compatible L-Vector.
+      VectorTypeL create_vector_l() const
+      {
+        return VectorTypeL(this->rows());
+      }
+
+      // Returns a new compatible R-Vector.
+      VectorTypeR create_vector_r() const
+      {
+        return VectorTypeR(this->columns());
+      }
+      /// \endcond
+
+    private:
+      /// computes the half width of the spectrum of a symmetric stencil
+      DT_ _lambda_offset() const
+      {
+        DT_ s(0);
+        for(std::size_t i(0); i < 3; ++i)
+        {
+          XASSERTM(Math::abs(_coeffs[2*i+1] - _coeffs[2*i+2]) <= Math::eps<DT_>() * Math::abs(_coeffs[0]), "stencil is not symmetric");
+          s += DT_(2) * Math::abs(_coeffs[2*i+1]) * Math::cos(Math::pi<DT_>() / DT_(_num_nodes[i] + Index(1)));
+        }
+        return s;
+      }
+    }; // class StencilMatrix<...>
+  } // namespace LAFEM
+} // namespace FEAT
+
+#endif // KERNEL_LAFEM_STENCIL_MATRIX_HPP
@@ -10,6 +10,7 @@
 #include <kernel/lafem/base.hpp>
 #include <kernel/util/exception.hpp>
 
+#include <iostream>
 #include <utility>
 
 namespace FEAT
@@ -55,6 +56,27 @@ namespace FEAT
       /// the internal truncation matrix
       Matrix_ _mat_trunc;
 
+      /// auxiliary function: writes a single possibly empty matrix
+      static void _write_matrix(std::ostream& os, const Matrix_& matrix)
+      {
+        const char flag(matrix.empty() ? 0 : 1);
+        os.write(&flag, std::streamsize(1));
+        if(flag != 0)
+          matrix.write_out(FileMode::fm_binary, os);
+      }
+
+      /// auxiliary function: reads a single possibly empty matrix
+      static void _read_matrix(std::istream& is, Matrix_& matrix)
+      {
+        char flag(0);
+        if(!is.read(&flag, std::streamsize(1)).good())
+          throw InternalError(__func__, __FILE__, __LINE__, "Failed to read transfer matrix from stream");
+        if(flag != 0)
+          matrix.read_from(FileMode::fm_binary, is);
+        else
+          matrix = Matrix_();
+      }
+
     public:
       /// standard constructor
       Transfer()
@@ -163,6 +185,35 @@ namespace FEAT
         // nothing to do here...
       }
 
+      /**
+       * \brief Writes the transfer matrices into a binary stream.
+       *
+       * Empty matrices are tagged as such, so that partially assembled transfers
+       * can be written and restored, too.
+       *
+       * \param[in] os
+       * The binary output stream to write to.
+       */
+      void write_out(std::ostream& os) const
+      {
+        _write_matrix(os, _mat_prol);
+        _write_matrix(os, _mat_rest);
+        _write_matrix(os, _mat_trunc);
+      }
+
+      /**
+       * \brief Reads the transfer matrices from a binary stream.
+       *
+       * \param[in] is
+       * The binary input stream to read from, which has been written by write_out().
+       */
+      void read_from(std::istream& is)
+      {
+        _read_matrix(is, _mat_prol);
+        _read_matrix(is, _mat_rest);
+        _read_matrix(is, _mat_trunc);
+      }
+
       /// \cond internal
       Matrix_& get_mat_prol()
       {
@@ -9,6 +9,9 @@
 #include <kernel/archs.hpp>
 #include <kernel/lafem/pointstar_factory.hpp>
 
+#include <cstdio>
+#include <fstream>
+
 using namespace FEAT;
 using namespace FEAT::LAFEM;
 using namespace FEAT::TestSystem;
@@ -59,3 +62,135 @@ public:
 TuningTest<Mem::CUDA, float, unsigned long> cuda_tuning_test_float_ulong;
 #endif
 #endif
+
+/// computes the deviation of the products of a converted matrix from those of its CSR matrix
+template<typename DT_, typename IT_>
+class ConvertedApplyCheck
+{
+public:
+  const SparseMatrixCSR<Mem::Main, DT_, IT_> & csr;
+  /// the maximum relative deviation of all checked matrices
+  DT_ max_dev;
+  /// the number of checked matrices
+  Index num_checks;
+
+  explicit ConvertedApplyCheck(const SparseMatrixCSR<Mem::Main, DT_, IT_> & csr_) :
+    csr(csr_),
+    max_dev(DT_(0)),
+    num_checks(0)
+  {
+  }
+
+  template<typename Matrix_>
+  void operator()(Matrix_ && matrix)
+  {
+    DenseVector<Mem::Main, DT_, IT_> x(csr.columns()), y(csr.rows());
+    for (Index i(0) ; i < x.size() ; ++i)
+      x(i, DT_(i % 7) - DT_(2));
+    for (Index i(0) ; i < y.size() ; ++i)
+      y(i, DT_(i % 3) + DT_(1));
+    DenseVector<Mem::Main, DT_, IT_> r(y.clone()), r_csr(y.clone());
+
+    matrix.apply(r, x);
+    csr.apply(r_csr, x);
+    r.axpy(r_csr, r, -DT_(1));
+    max_dev = Math::max(max_dev, r.norm2() / r_csr.norm2());
+
+    matrix.apply(r, x, y, -DT_(0.5));
+    csr.apply(r_csr, x, y, -DT_(0.5));
+    r.axpy(r_csr, r, -DT_(1));
+    max_dev = Math::max(max_dev, r.norm2() / r_csr.norm2());
+    ++num_checks;
+  }
+};
+
+/**
+ * \brief Test class for the CPU format autotuner.
+ *
+ * \test Tests the format selection, the tuning cache file and the conversion into the candidate formats.
+ */
+template<
+  typename Mem_,
+  typename DT_,
+  typename IT_>
+class CPUTuningTest
+  : public FullTaggedTest<Mem_, DT_, IT_>
+{
+public:
+  CPUTuningTest()
+    : FullTaggedTest<Mem_, DT_, IT_>("CPUTuningTest")
+  {
+  }
+
+  virtual ~CPUTuningTest()
+  {
+  }
+
+  virtual void run() const override
+  {
+    const String cache_file("tuning-test-" + stringify(sizeof(DT_)) + stringify(sizeof(IT_)) + ".cache");
+    std::remove(cache_file.c_str());
+
+    // scalar 5-point star and a 2x2 blocked version of it
+    PointstarFactoryFD<DT_, IT_> psf(65, 2);
+    SparseMatrixCSR<Mem_, DT_, IT_> csr(psf.matrix_csr());
+    SparseMatrixBCSR<Mem_, DT_, IT_, 2, 2> bcsr(psf.matrix_csr().layout());
+    for (Index i(0) ; i < bcsr.used_elements() ; ++i)
+      bcsr.val()[i] = Tiny::Matrix<DT_, 2, 2>(DT_(i % 7) + DT_(1));
+    SparseMatrixCSR<Mem_, DT_, IT_> csr_block;
+    csr_block.convert(bcsr);
+
+    const String sig(Tuning::matrix_signature(csr));
+    TEST_CHECK(sig.find_first_of(" \t\n") == String::npos);
+    TEST_CHECK(sig != Tuning::matrix_signature(csr_block));
+
+    // tune both matrices
+    Tuning::FormatInfo info = Tuning::tune_cpu_format(csr, cache_file);
+    TEST_CHECK(info.time > 0.0);
+    TEST_CHECK((info.format == "bcsr") == (info.block_size > 1));
+    Tuning::FormatInfo info_block = Tuning::tune_cpu_format(csr_block, cache_file);
+    TEST_CHECK(info_block.time > 0.0);
+    TEST_CHECK((info_block.format == "bcsr") == (info_block.block_size > 1));
+
+    // the second call must return the cached decision
+    Tuning::FormatInfo info2 = Tuning::tune_cpu_format(csr, cache_file);
+    TEST_CHECK_EQUAL(info2.format, info.format);
+    TEST_CHECK_EQUAL(info2.block_size, info.block_size);
+    TEST_CHECK_EQUAL_WITHIN_EPS(info2.time, info.time, 1E-5 * info.time);
+
+    // a single process shares the signature and hence the cached decision of the serial matrix
+    Tuning::FormatInfo info3 = Tuning::tune_cpu_format(csr, cache_file, Dist::Comm::self());
+    TEST_CHECK_EQUAL(info3.format, info.format);
+    TEST_CHECK_EQUAL(info3.block_size, info.block_size);
+
+    std::ifstream ifs(cache_file.c_str());
+    Index lines(0);
+    String line;
+    while (std::getline(ifs, line))
+      ++lines;
+    TEST_CHECK_EQUAL(lines, Index(2));
+    ifs.close();
+    std::remove(cache_file.c_str());
+
+    // all candidates compute the same products
+    const char * const formats[] = {"csr", "dcsr", "ell", "banded", "bcsr"};
+    ConvertedApplyCheck<DT_, IT_> check(csr_block);
+    for (const char * format : formats)
+    {
+      Tuning::FormatInfo candidate;
+      candidate.format = format;
+      candidate.block_size = (candidate.format == "bcsr" ? 2 : 1);
+      Tuning::convert_cpu_format(candidate, csr_block, check);
+    }
+    TEST_CHECK_EQUAL(check.num_checks, Index(5));
+    TEST_CHECK(check.max_dev <= Math::eps<DT_>() * DT_(100));
+
+    Tuning::FormatInfo unknown;
+    unknown.format = "coo";
+    TEST_CHECK_THROWS(Tuning::convert_cpu_format(unknown, csr_block, check), InternalError);
+  }
+};
+#ifndef FEAT_DEBUG_MODE
+CPUTuningTest<Mem::Main, double, unsigned long> cpu_tuning_test_double_ulong;
+CPUTuningTest<Mem::Main, float, unsigned int> cpu_tuning_test_float_uint;
+#endif
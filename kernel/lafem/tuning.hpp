@@ -9,12 +9,27 @@
 
 // includes, FEAT
 #include <kernel/base_header.hpp>
+#include <kernel/util/hash.hpp>
 #include <kernel/util/time_stamp.hpp>
+#include <kernel/util/string.hpp>
 #include <kernel/lafem/dense_vector.hpp>
+#include <kernel/lafem/sparse_matrix_csr.hpp>
+#include <kernel/lafem/sparse_matrix_bcsr.hpp>
+#include <kernel/lafem/sparse_matrix_dcsr.hpp>
 #include <kernel/lafem/sparse_matrix_ell.hpp>
+#include <kernel/lafem/sparse_matrix_banded.hpp>
 #include <kernel/util/cuda_util.hpp>
+#include <kernel/util/dist.hpp>
 
+#include <algorithm>
+#include <cstdint>
+#include <fstream>
 #include <iostream>
+#include <limits>
+#include <map>
+#include <set>
+#include <sstream>
+#include <vector>
 
 #ifdef FEAT_COMPILER_MICROSOFT
 // Microsoft's STL implementation is not safe for /Wall "by design", see:
@@ -35,18 +50,42 @@ namespace FEAT
   {
     class Tuning
     {
+      public:
+      /**
+       * \brief Result of the CPU matrix format autotuner
+       *
+       * \see Tuning::tune_cpu_format
+       */
+      struct FormatInfo
+      {
+        /// the name of the fastest format, i.e. one of "csr", "dcsr", "ell", "banded" or "bcsr"
+        String format;
+        /// the block size of the bcsr format, 1 for all other formats
+        int block_size;
+        /// the measured time of a single matrix-vector product in seconds
+        double time;
+
+        FormatInfo() :
+          format("csr"),
+          block_size(1),
+          time(0.0)
+        {
+        }
+      };
+
       private:
+      template <typename Mem_ = Mem::CUDA>
       static double _run_bench(std::function<void (void)> func)
       {
         Index iters(1);
         //warmup
         func();
-        MemoryPool<Mem::CUDA>::synchronise();
+        MemoryPool<Mem_>::synchronise();
 
         TimeStamp at, bt;
         at.stamp();
         func();
-        MemoryPool<Mem::CUDA>::synchronise();
+        MemoryPool<Mem_>::synchronise();
         bt.stamp();
         double test_run_time(bt.elapsed(at));
         if (test_run_time < 0.1)
@@ -60,7 +99,7 @@ namespace FEAT
           {
             func();
           }
-          MemoryPool<Mem::CUDA>::synchronise();
+          MemoryPool<Mem_>::synchronise();
           bt.stamp();
           times.push_back(bt.elapsed(at));
         }
@@ -74,7 +113,383 @@ namespace FEAT
         return mean;
       }
 
+      /**
+       * \brief Converts a scalar CSR matrix into a square-blocked BCSR matrix
+       *
+       * \returns \c false, if the matrix dimensions are not divisible by the block size or if the
+       * block structure would store more than \p max_fill times the non-zero entries of the CSR matrix.
+       */
+      template <int b_, typename DT_, typename IT_>
+      static bool _convert_bcsr(SparseMatrixBCSR<Mem::Main, DT_, IT_, b_, b_> & bcsr,
+        const SparseMatrixCSR<Mem::Main, DT_, IT_> & csr, double max_fill)
+      {
+        const Index nrows(csr.rows()), ncols(csr.columns());
+        if((nrows % Index(b_) != 0) || (ncols % Index(b_) != 0))
+          return false;
+
+        const IT_ * row_ptr(csr.row_ptr());
+        const IT_ * col_ind(csr.col_ind());
+        const DT_ * val(csr.val());
+        const Index nbrows(nrows / Index(b_)), nbcols(ncols / Index(b_));
+
+        // assemble the block structure row by row
+        std::vector<IT_> brow_ptr(nbrows + 1, IT_(0));
+        std::vector<IT_> bcol_ind;
+        std::vector<Index> mark(nbcols, ~Index(0));
+        for(Index br(0); br < nbrows; ++br)
+        {
+          const std::size_t first(bcol_ind.size());
+          for(Index row(br * Index(b_)); row < (br + 1) * Index(b_); ++row)
+          {
+            for(IT_ i(row_ptr[row]); i < row_ptr[row + 1]; ++i)
+            {
+              const Index bc(Index(col_ind[i]) / Index(b_));
+              if(mark[bc] != br)
+              {
+                mark[bc] = br;
+                bcol_ind.push_back(IT_(bc));
+              }
+            }
+          }
+          std::sort(bcol_ind.begin() + std::ptrdiff_t(first), bcol_ind.end());
+          brow_ptr[br + 1] = IT_(bcol_ind.size());
+        }
+
+        const Index nnzb(Index(bcol_ind.size()));
+        if(double(nnzb * Index(b_ * b_)) > max_fill * double(csr.used_elements()))
+          return false;
+
+        // scatter the values into the blocks
+        DenseVector<Mem::Main, IT_, IT_> vrow_ptr(nbrows + 1);
+        DenseVector<Mem::Main, IT_, IT_> vcol_ind(Math::max(nnzb, Index(1)), IT_(0));
+        DenseVector<Mem::Main, DT_, IT_> vval(Math::max(nnzb, Index(1)) * Index(b_ * b_), DT_(0));
+        for(Index i(0); i <= nbrows; ++i)
+          vrow_ptr(i, brow_ptr[i]);
+        for(Index i(0); i < nnzb; ++i)
+          vcol_ind(i, bcol_ind[i]);
+        DT_ * bval(vval.elements());
+        for(Index row(0); row < nrows; ++row)
+        {
+          const Index br(row / Index(b_)), h(row % Index(b_));
+          for(IT_ i(row_ptr[row]); i < row_ptr[row + 1]; ++i)
+          {
+            const Index bc(Index(col_ind[i]) / Index(b_)), w(Index(col_ind[i]) % Index(b_));
+            const IT_ * pos = std::lower_bound(bcol_ind.data() + brow_ptr[br], bcol_ind.data() + brow_ptr[br + 1], IT_(bc));
+            const Index k(Index(pos - bcol_ind.data()));
+            bval[(k * Index(b_) + h) * Index(b_) + w] = val[i];
+          }
+        }
+
+        bcsr = SparseMatrixBCSR<Mem::Main, DT_, IT_, b_, b_>(nbrows, nbcols, vcol_ind, vval, vrow_ptr);
+        return true;
+      }
+
+      /// benchmarks the square-blocked BCSR format of block size b_; returns infinity if not applicable
+      template <int b_, typename DT_, typename IT_>
+      static double _bench_bcsr(const SparseMatrixCSR<Mem::Main, DT_, IT_> & csr)
+      {
+        SparseMatrixBCSR<Mem::Main, DT_, IT_, b_, b_> bcsr;
+        if(!_convert_bcsr(bcsr, csr, 1.5))
+          return std::numeric_limits<double>::infinity();
+        DenseVector<Mem::Main, DT_, IT_> x(csr.columns(), DT_(1)), r(csr.rows(), DT_(0));
+        return _run_bench<Mem::Main>([&] () { bcsr.apply(r, x); });
+      }
+
+      /// converts a CSR matrix into a square-blocked BCSR matrix and passes it to a functor
+      template <int b_, typename DT_, typename IT_, typename Functor_>
+      static void _convert_bcsr_to(const SparseMatrixCSR<Mem::Main, DT_, IT_> & csr, Functor_ & functor)
+      {
+        SparseMatrixBCSR<Mem::Main, DT_, IT_, b_, b_> bcsr;
+        const bool converted(_convert_bcsr(bcsr, csr, std::numeric_limits<double>::infinity()));
+        XASSERTM(converted, "matrix dimensions are not divisible by the block size");
+        functor(std::move(bcsr));
+      }
+
+      /// the number of candidates of the CPU format autotuner
+      static constexpr int _num_candidates = 7;
+
+      /// returns the format name and block size of a candidate of the CPU format autotuner
+      static FormatInfo _candidate(int i)
+      {
+        static const char * const names[_num_candidates] = {"csr", "dcsr", "ell", "banded", "bcsr", "bcsr", "bcsr"};
+        static const int block_sizes[_num_candidates] = {1, 1, 1, 1, 2, 3, 4};
+        FormatInfo info;
+        info.format = names[i];
+        info.block_size = block_sizes[i];
+        return info;
+      }
+
+      /**
+       * \brief Benchmarks all candidates of the CPU format autotuner
+       *
+       * \param[out] times
+       * The times of a single matrix-vector product of all candidates; infinity for candidates,
+       * which are not applicable to the matrix.
+       */
+      template <typename DT_, typename IT_>
+      static void _bench_candidates(const SparseMatrixCSR<Mem::Main, DT_, IT_> & matrix, double * times)
+      {
+        const double inf(std::numeric_limits<double>::infinity());
+        for(int i(0); i < _num_candidates; ++i)
+          times[i] = inf;
+
+        if(matrix.used_elements() == Index(0))
+        {
+          times[0] = 0.0;
+          return;
+        }
+
+        DenseVector<Mem::Main, DT_, IT_> x(matrix.columns(), DT_(1)), r(matrix.rows(), DT_(0));
+
+        // CSR
+        times[0] = _run_bench<Mem::Main>([&] () { matrix.apply(r, x); });
+
+        // DCSR
+        {
+          SparseMatrixDCSR<Mem::Main, DT_, IT_> dcsr;
+          dcsr.convert(matrix);
+          times[1] = _run_bench<Mem::Main>([&] () { dcsr.apply(r, x); });
+        }
+
+        // ELL
+        {
+          SparseMatrixELL<Mem::Main, DT_, IT_> ell;
+          ell.convert(matrix);
+          times[2] = _run_bench<Mem::Main>([&] () { ell.apply(r, x); });
+        }
+
+        // banded, only if the number of bands is small
+        if(matrix.rows() == matrix.columns())
+        {
+          std::set<Index> offsets;
+          const IT_ * row_ptr(matrix.row_ptr());
+          const IT_ * col_ind(matrix.col_ind());
+          for(Index row(0); row < matrix.rows(); ++row)
+            for(IT_ i(row_ptr[row]); i < row_ptr[row + 1]; ++i)
+              offsets.insert(Index(col_ind[i]) + matrix.rows() - row);
+          if(Index(offsets.size()) * matrix.rows() <= Index(2) * matrix.used_elements())
+          {
+            SparseMatrixBanded<Mem::Main, DT_, IT_> banded;
+            banded.convert(matrix);
+            times[3] = _run_bench<Mem::Main>([&] () { banded.apply(r, x); });
+          }
+        }
+
+        // BCSR
+        times[4] = _bench_bcsr<2>(matrix);
+        times[5] = _bench_bcsr<3>(matrix);
+        times[6] = _bench_bcsr<4>(matrix);
+      }
+
+      /// reads all decisions of a tuning cache file into a map
+      static std::map<String, FormatInfo> _read_cache(const String & filename)
+      {
+        std::map<String, FormatInfo> cache;
+        std::ifstream ifs(filename.c_str(), std::ios_base::in);
+        String line;
+        while(ifs.good() && std::getline(ifs, line))
+        {
+          line.trim_me();
+          if(line.empty() || line.front() == '#')
+            continue;
+          std::deque<String> tokens = line.split_by_whitespaces();
+          if(tokens.size() != std::size_t(4))
+            continue;
+          FormatInfo info;
+          info.format = tokens.at(1);
+          if(!tokens.at(2).parse(info.block_size) || !tokens.at(3).parse(info.time))
+            continue;
+          // later entries overwrite earlier ones
+          cache[tokens.front()] = info;
+        }
+        return cache;
+      }
+
       public:
+      /**
+       * \brief Computes a signature of the structure of a CSR matrix
+       *
+       * The signature consists of the matrix dimensions and a 64 bit FNV-1a hash of the data and index
+       * type sizes and the row pointer and column index arrays; it identifies a matrix structure
+       * independently of the numerical values, which have no influence on the apply performance.
+       *
+       * \param[in] matrix The matrix whose signature is to be computed.
+       *
+       * \returns The signature of the matrix, which does not contain any whitespaces.
+       */
+      template <typename DT_, typename IT_>
+      static String matrix_signature(const SparseMatrixCSR<Mem::Main, DT_, IT_> & matrix)
+      {
+        HashFNV1a hash;
+        const std::uint64_t sizes[2] = {sizeof(DT_), sizeof(IT_)};
+        hash.feed(sizes, sizeof(sizes));
+        if(matrix.used_elements() > Index(0))
+        {
+          hash.feed(matrix.row_ptr(), sizeof(IT_) * (matrix.rows() + 1));
+          hash.feed(matrix.col_ind(), sizeof(IT_) * matrix.used_elements());
+        }
+
+        std::ostringstream oss;
+        oss << matrix.rows() << "x" << matrix.columns() << ":" << matrix.used_elements() << ":" << std::hex << hash.value();
+        return oss.str();
+      }
+
+      /**
+       * \brief Finds the fastest CPU storage format for the matrix-vector product of a distributed matrix
+       *
+       * Times the matrix-vector product of the given matrix in the CSR, DCSR and ELL formats, in the banded
+       * format (if the matrix has at most twice as many bands entries as non-zero entries) and in the
+       * BCSR format with square blocks of size 2, 3 and 4 (if the block structure stores at most 1.5 times
+       * as many entries as the CSR matrix) and returns the fastest one.
+       *
+       * If the communicator contains more than one process, \p matrix is the local matrix of each process
+       * and all processes choose the same format, namely the one whose slowest process is the fastest one.
+       * Formats, which are not applicable on at least one process, are not chosen.
+       *
+       * If a cache file is given, the decision is looked up in the file by the signature of the matrix
+       * (see matrix_signature) first; for more than one process, the signature is built from the local
+       * signatures of all processes. If the matrix is not contained in the cache, the tuning is performed
+       * and the first process appends the decision to the file as a line of the form
+       * \verbatim <signature> <format> <block-size> <time> \endverbatim
+       * so that later runs on the same matrix structure skip the benchmark.
+       *
+       * \param[in] matrix The (local) matrix to use for tuning.
+       * \param[in] cache_file The name of the cache file. May be empty to disable the cache.
+       * \param[in] comm The communicator of the processes, which share the matrix.
+       *
+       * \returns The fastest format.
+       */
+      template <typename DT_, typename IT_>
+      static FormatInfo tune_cpu_format(const SparseMatrixCSR<Mem::Main, DT_, IT_> & matrix, const String & cache_file, const Dist::Comm & comm)
+      {
+        // build the signature of the distributed matrix
+        String signature(matrix_signature(matrix));
+        if(comm.size() > 1)
+        {
+          HashFNV1a local_hash;
+          local_hash.feed(signature.data(), signature.size());
+          std::vector<unsigned long long> hashes(std::size_t(comm.size()));
+          const unsigned long long my_hash(local_hash.value());
+          comm.allgather(&my_hash, std::size_t(1), hashes.data(), std::size_t(1));
+          HashFNV1a hash;
+          hash.feed(hashes.data(), sizeof(unsigned long long) * hashes.size());
+          std::ostringstream oss;
+          oss << "np" << comm.size() << ":" << std::hex << hash.value();
+          signature = oss.str();
+        }
+
+        // look up the decision on the first process and broadcast it
+        if(!cache_file.empty())
+        {
+          int found(0);
+          std::stringstream entry;
+          if(comm.rank() == 0)
+          {
+            std::map<String, FormatInfo> cache(_read_cache(cache_file));
+            auto it = cache.find(signature);
+            if(it != cache.end())
+            {
+              found = 1;
+              entry << it->second.format << " " << it->second.block_size << " " << stringify_fp_sci(it->second.time);
+            }
+          }
+          comm.bcast(&found, std::size_t(1), 0);
+          if(found != 0)
+          {
+            comm.bcast_stringstream(entry, 0);
+            FormatInfo info;
+            entry >> info.format >> info.block_size >> info.time;
+            return info;
+          }
+        }
+
+        // benchmark all candidates and reduce the times of the slowest processes
+        double times[_num_candidates];
+        _bench_candidates(matrix, times);
+        comm.allreduce(times, times, std::size_t(_num_candidates), Dist::op_max);
+
+        FormatInfo best;
+        best.time = std::numeric_limits<double>::max();
+        for(int i(0); i < _num_candidates; ++i)
+        {
+          if(times[i] < best.time)
+          {
+            best = _candidate(i);
+            best.time = times[i];
+          }
+        }
+
+        if(!cache_file.empty() && (comm.rank() == 0))
+        {
+          std::ofstream ofs(cache_file.c_str(), std::ios_base::out | std::ios_base::app);
+          if(ofs.is_open())
+            ofs << signature << " " << best.format << " " << best.block_size << " " << stringify_fp_sci(best.time) << std::endl;
+        }
+
+        return best;
+      }
+
+      /**
+       * \brief Finds the fastest CPU storage format for the matrix-vector product of a matrix
+       *
+       * This function tunes a matrix, which is not shared with other processes, see the overload above.
+       *
+       * \param[in] matrix The matrix to use for tuning.
+       * \param[in] cache_file The name of the cache file. May be empty to disable the cache.
+       *
+       * \returns The fastest format.
+       */
+      template <typename DT_, typename IT_>
+      static FormatInfo tune_cpu_format(const SparseMatrixCSR<Mem::Main, DT_, IT_> & matrix, const String & cache_file = "")
+      {
+        return tune_cpu_format(matrix, cache_file, Dist::Comm::self());
+      }
+
+      /**
+       * \brief Converts a CSR matrix into a format chosen by the CPU format autotuner
+       *
+       * \param[in] info The format to convert to, as returned by tune_cpu_format.
+       * \param[in] matrix The CSR matrix to be converted.
+       * \param[in] functor
+       * A functor, which is called with an rvalue of the converted matrix, i.e. with a SparseMatrixCSR,
+       * SparseMatrixDCSR, SparseMatrixELL, SparseMatrixBanded or a SparseMatrixBCSR with square blocks
+       * of size 2, 3 or 4 in main memory. For the csr format, it receives a shallow copy of \p matrix.
+       */
+      template <typename DT_, typename IT_, typename Functor_>
+      static void convert_cpu_format(const FormatInfo & info, const SparseMatrixCSR<Mem::Main, DT_, IT_> & matrix, Functor_ & functor)
+      {
+        if(info.format == "csr")
+        {
+          functor(matrix.clone(CloneMode::Shallow));
+        }
+        else if(info.format == "dcsr")
+        {
+          SparseMatrixDCSR<Mem::Main, DT_, IT_> dcsr;
+          dcsr.convert(matrix);
+          functor(std::move(dcsr));
+        }
+        else if(info.format == "ell")
+        {
+          SparseMatrixELL<Mem::Main, DT_, IT_> ell;
+          ell.convert(matrix);
+          functor(std::move(ell));
+        }
+        else if(info.format == "banded")
+        {
+          SparseMatrixBanded<Mem::Main, DT_, IT_> banded;
+          banded.convert(matrix);
+          functor(std::move(banded));
+        }
+        else if((info.format == "bcsr") && (info.block_size == 2))
+          _convert_bcsr_to<2>(matrix, functor);
+        else if((info.format == "bcsr") && (info.block_size == 3))
+          _convert_bcsr_to<3>(matrix, functor);
+        else if((info.format == "bcsr") && (info.block_size == 4))
+          _convert_bcsr_to<4>(matrix, functor);
+        else
+          throw InternalError(__func__, __FILE__, __LINE__, "unknown matrix format '" + info.format + "' with block size " + stringify(info.block_size));
+      }
+
       /**
        * \brief Find optimal cuda runtime parameters
        *
@@ -102,7 +517,7 @@ namespace FEAT
           {
             auto func = [&] () { Arch::Apply<Mem::CUDA>::ell(temp.elements(), DT_(1), vector.elements(), DT_(0), temp.elements(),
                 matrix.val(), matrix.col_ind(), matrix.cs(), matrix.cl(), matrix.C(), matrix.rows()); };
-            toe = LAFEM::Tuning::_run_bench(func);
+            toe = LAFEM::Tuning::_run_bench<Mem::CUDA>(func);
             Util::cuda_check_last_error();
           }
           catch (const FEAT::InternalError&)
@@ -138,7 +553,7 @@ namespace FEAT
           try
           {
             auto func = [&] () { Arch::Axpy<Mem::CUDA>::dv(temp.elements(), DT_(1.234), vector.elements(), temp.elements(), temp.size()); };
-            toe = LAFEM::Tuning::_run_bench(func);
+            toe = LAFEM::Tuning::_run_bench<Mem::CUDA>(func);
             Util::cuda_check_last_error();
           }
           catch (const FEAT::InternalError&)
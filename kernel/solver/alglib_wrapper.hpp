@@ -357,7 +357,7 @@ namespace FEAT
          */
         virtual Status _apply_intern(VectorType& vec_sol)
         {
-          Statistics::add_solver_expression(std::make_shared<ExpressionStartSolve>(this->name()));
+          Statistics::add_solver_expression(ExpressionStartSolve(this->expression_name()));
 
           // Write initial guess to iterates if desired
           if(iterates != nullptr)
@@ -371,7 +371,7 @@ namespace FEAT
 
           if(status != Status::progress)
           {
-            Statistics::add_solver_expression(std::make_shared<ExpressionEndSolve>(this->name(), status, this->get_num_iter()));
+            Statistics::add_solver_expression(ExpressionEndSolve(this->expression_name(), status, this->get_num_iter()));
             return status;
           }
 
@@ -397,38 +397,38 @@ namespace FEAT
           {
             case(-8):
               //std::cout << "ALGLIB: Got inf or NaN in function/gradient evaluation." << std::endl;
-              Statistics::add_solver_expression(std::make_shared<ExpressionEndSolve>(this->name(), Status::aborted, this->get_num_iter()));
+              Statistics::add_solver_expression(ExpressionEndSolve(this->expression_name(), Status::aborted, this->get_num_iter()));
               return Status::aborted;
             case(-7):
               //std::cout << "ALGLIB: Gradient verification failed." << std::endl;
-              Statistics::add_solver_expression(std::make_shared<ExpressionEndSolve>(this->name(), Status::aborted, this->get_num_iter()));
+              Statistics::add_solver_expression(ExpressionEndSolve(this->expression_name(), Status::aborted, this->get_num_iter()));
               return Status::aborted;
             case(1):
               //std::cout << "ALGLIB: Function value improvement criterion fulfilled." << std::endl;
-              Statistics::add_solver_expression(std::make_shared<ExpressionEndSolve>(this->name(), Status::success, this->get_num_iter()));
+              Statistics::add_solver_expression(ExpressionEndSolve(this->expression_name(), Status::success, this->get_num_iter()));
               return Status::success;
             case(2):
               //std::cout << "ALGLIB: Update step size stagnated." << std::endl;
-              Statistics::add_solver_expression(std::make_shared<ExpressionEndSolve>(this->name(), Status::success, this->get_num_iter()));
+              Statistics::add_solver_expression(ExpressionEndSolve(this->expression_name(), Status::success, this->get_num_iter()));
               return Status::success;
             case(4):
               //std::cout << "ALGLIB: Gradient norm criterion fulfilled." << std::endl;
-              Statistics::add_solver_expression(std::make_shared<ExpressionEndSolve>(this->name(), Status::success, this->get_num_iter()));
+              Statistics::add_solver_expression(ExpressionEndSolve(this->expression_name(), Status::success, this->get_num_iter()));
               return Status::success;
             case(5):
               //std::cout << "ALGLIB: Maximum number of iterations" << std::endl;
-              Statistics::add_solver_expression(std::make_shared<ExpressionEndSolve>(this->name(), Status::max_iter, this->get_num_iter()));
+              Statistics::add_solver_expression(ExpressionEndSolve(this->expression_name(), Status::max_iter, this->get_num_iter()));
               return Status::max_iter;
             case(7):
               //std::cout << "ALGLIB: Stopping criteria too stringent, further improvement impossible." << std::endl;
-              Statistics::add_solver_expression(std::make_shared<ExpressionEndSolve>(this->name(), Status::stagnated, this->get_num_iter()));
+              Statistics::add_solver_expression(ExpressionEndSolve(this->expression_name(), Status::stagnated, this->get_num_iter()));
               return Status::stagnated;
             case(8):
               //std::cout << "ALGLIB: Stopped by user" << std::endl;
-              Statistics::add_solver_expression(std::make_shared<ExpressionEndSolve>(this->name(), Status::success, this->get_num_iter()));
+              Statistics::add_solver_expression(ExpressionEndSolve(this->expression_name(), Status::success, this->get_num_iter()));
               return Status::success;
             default:
-              Statistics::add_solver_expression(std::make_shared<ExpressionEndSolve>(this->name(), Status::undefined, this->get_num_iter()));
+              Statistics::add_solver_expression(ExpressionEndSolve(this->expression_name(), Status::undefined, this->get_num_iter()));
               return Status::undefined;
           }
         }
@@ -891,7 +891,7 @@ namespace FEAT
          */
         virtual Status _apply_intern(VectorType& vec_sol)
         {
-          Statistics::add_solver_expression(std::make_shared<ExpressionStartSolve>(this->name()));
+          Statistics::add_solver_expression(ExpressionStartSolve(this->expression_name()));
 
           // Write initial guess to iterates if desired
           if(iterates != nullptr)
@@ -926,38 +926,38 @@ namespace FEAT
           {
             case(-8):
               //std::cout << "ALGLIB: Got inf or NaN in function/gradient evaluation." << std::endl;
-              Statistics::add_solver_expression(std::make_shared<ExpressionEndSolve>(this->name(), Status::aborted, this->get_num_iter()));
+              Statistics::add_solver_expression(ExpressionEndSolve(this->expression_name(), Status::aborted, this->get_num_iter()));
               return Status::aborted;
             case(-7):
               //std::cout << "ALGLIB: Gradient verification failed." << std::endl;
-              Statistics::add_solver_expression(std::make_shared<ExpressionEndSolve>(this->name(), Status::aborted, this->get_num_iter()));
+              Statistics::add_solver_expression(ExpressionEndSolve(this->expression_name(), Status::aborted, this->get_num_iter()));
               return Status::aborted;
             case(1):
               //std::cout << "ALGLIB: Function value improvement criterion fulfilled." << std::endl;
-              Statistics::add_solver_expression(std::make_shared<ExpressionEndSolve>(this->name(), Status::success, this->get_num_iter()));
+              Statistics::add_solver_expression(ExpressionEndSolve(this->expression_name(), Status::success, this->get_num_iter()));
               return Status::success;
             case(2):
               //std::cout << "ALGLIB: Update step size stagnated." << std::endl;
-              Statistics::add_solver_expression(std::make_shared<ExpressionEndSolve>(this->name(), Status::success, this->get_num_iter()));
+              Statistics::add_solver_expression(ExpressionEndSolve(this->expression_name(), Status::success, this->get_num_iter()));
               return Status::success;
             case(4):
               //std::cout << "ALGLIB: Gradient norm criterion fulfilled." << std::endl;
-              Statistics::add_solver_expression(std::make_shared<ExpressionEndSolve>(this->name(), Status::success, this->get_num_iter()));
+              Statistics::add_solver_expression(ExpressionEndSolve(this->expression_name(), Status::success, this->get_num_iter()));
               return Status::success;
             case(5):
               //std::cout << "ALGLIB: Maximum number of iterations" << std::endl;
-              Statistics::add_solver_expression(std::make_shared<ExpressionEndSolve>(this->name(), Status::max_iter, this->get_num_iter()));
+              Statistics::add_solver_expression(ExpressionEndSolve(this->expression_name(), Status::max_iter, this->get_num_iter()));
               return Status::max_iter;
             case(7):
               //std::cout << "ALGLIB: Stopping criteria too stringent, further improvement impossible." << std::endl;
-              Statistics::add_solver_expression(std::make_shared<ExpressionEndSolve>(this->name(), Status::stagnated, this->get_num_iter()));
+              Statistics::add_solver_expression(ExpressionEndSolve(this->expression_name(), Status::stagnated, this->get_num_iter()));
               return Status::stagnated;
             case(8):
               //std::cout << "ALGLIB: Stopped by user" << std::endl;
-              Statistics::add_solver_expression(std::make_shared<ExpressionEndSolve>(this->name(), Status::success, this->get_num_iter()));
+              Statistics::add_solver_expression(ExpressionEndSolve(this->expression_name(), Status::success, this->get_num_iter()));
               return Status::success;
             default:
-              Statistics::add_solver_expression(std::make_shared<ExpressionEndSolve>(this->name(), Status::undefined, this->get_num_iter()));
+              Statistics::add_solver_expression(ExpressionEndSolve(this->expression_name(), Status::undefined, this->get_num_iter()));
               return Status::undefined;
           }
         }
@@ -75,7 +75,7 @@ public:
   typedef Trafo::Standard::Mapping<MeshType> TrafoType;
 
   /// tests Vanka for Deformation tensor formulation
-  template<template<typename> class Space_>
+  template<template<typename> class Space_, typename DTS_ = DT_>
   void test_defo(MeshNode& mesh_node, const DT_ omega) const
   {
     // get our mesh
@@ -86,7 +86,7 @@ public:
 
     typename Space_<TrafoType>::V space_v(trafo);
     typename Space_<TrafoType>::P space_p(trafo);
-    const String name = Space_<TrafoType>::name();
+    const String name = String(Space_<TrafoType>::name()) + (sizeof(DTS_) < sizeof(DT_) ? " [mixed]" : "");
 
     typedef LAFEM::SparseMatrixBCSR<Mem::Main, DT_, IT_, dim, dim> MatrixTypeA;
     typedef LAFEM::SparseMatrixBCSR<Mem::Main, DT_, IT_, dim, 1> MatrixTypeB;
@@ -148,7 +148,7 @@ public:
     TimeStamp stamp1, stamp2;
     {
       // create vanka
-      auto vanka = Solver::new_amavanka(matrix, filter, omega, 10);
+      auto vanka = std::make_shared<Solver::AmaVanka<MatrixType, FilterType, DTS_>>(matrix, filter, omega, 10);
 
       // initialise and solve
       vanka->init();
@@ -192,6 +192,9 @@ public:
 
     // test Q2/P1dc
     test_defo<Q2P1>(*mesh_node, DT_(1.0));
+
+    // test Q2/P1dc with Vanka matrix stored in single precision
+    test_defo<Q2P1, float>(*mesh_node, DT_(1.0));
   }
 };
 
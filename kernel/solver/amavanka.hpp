@@ -1153,6 +1153,108 @@ namespace FEAT
           return rtn;
         }
 
+        /* ********************************************************************************************************* */
+
+#ifdef DOXYGEN
+        /**
+         * \brief Applies a Vanka matrix stored in a different precision onto a vector.
+         *
+         * This function computes r <- M*x or r <- r + M*x, where the Vanka matrix M is stored
+         * in a (typically lower) precision than the vectors r and x. The matrix entries are
+         * converted to the vector data type on the fly.
+         *
+         * \note
+         * This function is only implemented in specialised overloads,
+         * i.e. there exists no generic implementation.
+         *
+         * \param[inout] r
+         * The vector that receives the result.
+         *
+         * \param[in] matrix
+         * The Vanka matrix that is to be applied.
+         *
+         * \param[in] x
+         * The vector to be multiplied by the Vanka matrix.
+         *
+         * \param[in] add
+         * Specifies whether the product is to be added onto r rather than assigned to r.
+         */
+        template<typename VectorL_, typename Matrix_, typename VectorR_>
+        static void apply_mixed(VectorL_& r, const Matrix_& matrix, const VectorR_& x, const bool add)
+        {
+        }
+#endif // DOXYGEN
+
+        /// specialisation for LAFEM::SparseMatrixCSR
+        template<typename VectorL_, typename DTS_, typename IT_, typename VectorR_>
+        static void apply_mixed(VectorL_& r, const LAFEM::SparseMatrixCSR<Mem::Main, DTS_, IT_>& matrix,
+          const VectorR_& x, const bool add)
+        {
+          typedef typename VectorL_::DataType DT_;
+
+          TimeStamp ts_start;
+
+          Statistics::add_flops(matrix.used_elements() * 2);
+          LAFEM::Arch::Apply<Mem::Main>::csr_mixed(r.template elements<LAFEM::Perspective::pod>(), DT_(1),
+            x.template elements<LAFEM::Perspective::pod>(), DT_(add ? 1 : 0), r.template elements<LAFEM::Perspective::pod>(),
+            matrix.val(), matrix.col_ind(), matrix.row_ptr(), matrix.rows(), matrix.columns(), matrix.used_elements());
+
+          TimeStamp ts_stop;
+          Statistics::add_time_blas2(ts_stop.elapsed(ts_start));
+        }
+
+        /// specialisation for LAFEM::SparseMatrixBCSR
+        template<typename VectorL_, typename DTS_, typename IT_, int bh_, int bw_, typename VectorR_>
+        static void apply_mixed(VectorL_& r, const LAFEM::SparseMatrixBCSR<Mem::Main, DTS_, IT_, bh_, bw_>& matrix,
+          const VectorR_& x, const bool add)
+        {
+          typedef typename VectorL_::DataType DT_;
+
+          TimeStamp ts_start;
+
+          Statistics::add_flops(matrix.template used_elements<LAFEM::Perspective::pod>() * 2);
+          LAFEM::Arch::Apply<Mem::Main>::template csrb_mixed<DT_, DTS_, IT_, bh_, bw_>(
+            r.template elements<LAFEM::Perspective::pod>(), DT_(1), x.template elements<LAFEM::Perspective::pod>(),
+            DT_(add ? 1 : 0), r.template elements<LAFEM::Perspective::pod>(), matrix.template val<LAFEM::Perspective::pod>(),
+            matrix.col_ind(), matrix.row_ptr(), matrix.rows(), matrix.columns(), matrix.used_elements());
+
+          TimeStamp ts_stop;
+          Statistics::add_time_blas2(ts_stop.elapsed(ts_start));
+        }
+
+        /// specialisation for LAFEM::TupleMatrixRow
+        template<typename VectorL_, typename First_, typename Second_, typename... Rest_, typename VectorR_>
+        static void apply_mixed(VectorL_& r, const LAFEM::TupleMatrixRow<First_, Second_, Rest_...>& matrix,
+          const VectorR_& x, const bool add)
+        {
+          AmaVankaCore::apply_mixed(r, matrix.first(), x.first(), add);
+          AmaVankaCore::apply_mixed(r, matrix.rest(), x.rest(), true);
+        }
+
+        /// specialisation for LAFEM::TupleMatrixRow (single column)
+        template<typename VectorL_, typename First_, typename VectorR_>
+        static void apply_mixed(VectorL_& r, const LAFEM::TupleMatrixRow<First_>& matrix,
+          const VectorR_& x, const bool add)
+        {
+          AmaVankaCore::apply_mixed(r, matrix.first(), x.first(), add);
+        }
+
+        /// specialisation for LAFEM::TupleMatrix
+        template<typename VectorL_, typename FirstRow_, typename SecondRow_, typename... RestRows_, typename VectorR_>
+        static void apply_mixed(VectorL_& r, const LAFEM::TupleMatrix<FirstRow_, SecondRow_, RestRows_...>& matrix,
+          const VectorR_& x, const bool add)
+        {
+          AmaVankaCore::apply_mixed(r.first(), matrix.first(), x, add);
+          AmaVankaCore::apply_mixed(r.rest(), matrix.rest(), x, add);
+        }
+
+        /// specialisation for LAFEM::TupleMatrix (single row)
+        template<typename VectorL_, typename FirstRow_, typename VectorR_>
+        static void apply_mixed(VectorL_& r, const LAFEM::TupleMatrix<FirstRow_>& matrix,
+          const VectorR_& x, const bool add)
+        {
+          AmaVankaCore::apply_mixed(r.first(), matrix.first(), x, add);
+        }
       }; // struct AmaVankaCore
     } // namespace Intern
     /// \endcond
@@ -1195,9 +1297,26 @@ namespace FEAT
      * In the case of a LAFEM::SaddlePointMatrix, the smoother implemented in this class is mathematically
      * equivalent to a Solver::Vanka smoother of type Solver::VankaType::block_full_add.
      *
+     * The optional template parameter \p DTS_ specifies the data type that is used for storing the
+     * Vanka matrix. If \p DTS_ is a lower precision than the data type of the system matrix (e.g. float
+     * or half_float::half in a double solve), then the local matrices are still inverted in the precision
+     * of the system matrix, but the resulting Vanka matrix is stored in the lower precision and its entries
+     * are converted on the fly during the application of the smoother. As the smoother application is
+     * memory bound, this reduces the runtime of the apply phase roughly by the ratio of the data sizes.
+     * Note that a storage data type different from the system data type is only supported in Mem::Main.
+     *
+     * \tparam Matrix_
+     * The type of the system matrix.
+     *
+     * \tparam Filter_
+     * The type of the system filter.
+     *
+     * \tparam DTS_
+     * The data type used for storing the Vanka matrix.
+     *
      * \author Peter Zajac
      */
-    template<typename Matrix_, typename Filter_>
+    template<typename Matrix_, typename Filter_, typename DTS_ = typename Matrix_::DataType>
     class AmaVanka :
       public Solver::SolverBase<typename Matrix_::VectorTypeL>
     {
@@ -1213,11 +1332,17 @@ namespace FEAT
       typedef typename Matrix_::IndexType IndexType;
       /// our vector type
       typedef typename Matrix_::VectorTypeL VectorType;
+      /// our storage data type
+      typedef DTS_ DataTypeStorage;
+
+      static_assert(std::is_same<DTS_, DataType>::value || std::is_same<MemType, Mem::Main>::value,
+        "AmaVanka supports a storage data type different from the system data type only in Mem::Main");
 
     protected:
       /// the type of our Vanka matrix
-      typedef typename Intern::AmaVankaMatrixHelper<Matrix_>::VankaMatrix VankaMatrixType;
-      /// the type of our Vanka matrix in main memory
+      typedef typename Intern::AmaVankaMatrixHelper<Matrix_>::VankaMatrix::template
+        ContainerTypeByMDI<MemType, DTS_, IndexType> VankaMatrixType;
+      /// the type of our Vanka matrix in main memory using the system data type
       typedef typename VankaMatrixType::template ContainerTypeByMDI<Mem::Main, DataType, IndexType> VankaMatrixMainType;
 
       /// the system matrix
@@ -1360,6 +1485,18 @@ namespace FEAT
         return s;
       }
 
+      /**
+       * \brief Returns the number of bytes currently allocated for the Vanka matrix values.
+       *
+       * \note
+       * In contrast to #bytes(), this function only returns the memory footprint of the
+       * numerical values, which are stored in the storage data type \p DTS_.
+       */
+      std::size_t bytes_numeric() const
+      {
+        return sizeof(DTS_) * this->data_size();
+      }
+
       /**
        * \brief Returns the total data size used by the AmaVanka smoother.
        *
@@ -1593,7 +1730,7 @@ namespace FEAT
         watch_apply.start();
 
         // first step
-        this->_vanka.apply(vec_x, vec_b);
+        this->_apply_vanka(vec_x, vec_b, std::is_same<DTS_, DataType>());
         this->_filter.filter_cor(vec_x);
 
         // steps 2, ..., n   (if any)
@@ -1604,7 +1741,7 @@ namespace FEAT
           // filter defect
           this->_filter.filter_def(this->_vec_d);
           // apply Vanka matrix
-          this->_vanka.apply(this->_vec_c, this->_vec_d);
+          this->_apply_vanka(this->_vec_c, this->_vec_d, std::is_same<DTS_, DataType>());
           // filter correct
           this->_filter.filter_cor(this->_vec_c);
           // update solution
@@ -1615,6 +1752,19 @@ namespace FEAT
 
         return Status::success;
       }
+
+    protected:
+      /// applies the Vanka matrix stored in the system data type
+      void _apply_vanka(VectorType& vec_x, const VectorType& vec_b, std::true_type)
+      {
+        this->_vanka.apply(vec_x, vec_b);
+      }
+
+      /// applies the Vanka matrix stored in a different data type
+      void _apply_vanka(VectorType& vec_x, const VectorType& vec_b, std::false_type)
+      {
+        Intern::AmaVankaCore::apply_mixed(vec_x, this->_vanka, vec_b, false);
+      }
     }; // class AmaVanka
 
     /**
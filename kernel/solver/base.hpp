@@ -14,6 +14,7 @@
 #include <kernel/util/exception.hpp>
 #include <kernel/util/math.hpp>
 #include <kernel/util/property_map.hpp>
+#include <kernel/util/statistics.hpp>
 #include <kernel/util/string.hpp>
 
 // includes, system
@@ -187,11 +188,16 @@ namespace FEAT
       /// The type of vector this solver can be applied to
       typedef Vector_ VectorType;
 
+    protected:
+      /// the cached interned id of the solver name, see #expression_name()
+      mutable std::uint32_t _expression_id;
+
     public:
       /**
        * \brief Empty standard constructor
        */
-      SolverBase()
+      SolverBase() :
+        _expression_id(ExpressionName::no_id)
       {
       }
 
@@ -208,7 +214,8 @@ namespace FEAT
        * A pointer to the PropertyMap section configuring this solver
        *
        */
-      explicit SolverBase(const String& DOXY(section_name), PropertyMap* DOXY(config_section))
+      explicit SolverBase(const String& DOXY(section_name), PropertyMap* DOXY(config_section)) :
+        _expression_id(ExpressionName::no_id)
       {
       }
 
@@ -293,6 +300,22 @@ namespace FEAT
        */
       virtual String name() const = 0;
 
+      /**
+       * \brief Returns the solver name for solver expressions.
+       *
+       * The name is interned by Statistics::intern_expression_name() on the first call and its id is
+       * cached afterwards, so that the solver expressions of each iteration do not copy any strings.
+       * Solvers, whose name changes during their lifetime, have to reset #_expression_id.
+       *
+       * \returns The interned name of this solver.
+       */
+      ExpressionName expression_name() const
+      {
+        if(_expression_id == ExpressionName::no_id)
+          _expression_id = Statistics::intern_expression_name(this->name());
+        return ExpressionName(_expression_id);
+      }
+
       /**
        * \brief Solver application method
        *
@@ -387,7 +410,7 @@ namespace FEAT
     class IterationStats
     {
     private:
-      const String _solver_name;
+      const ExpressionName _solver_name;
       TimeStamp _at;
       double _mpi_execute_reduction_start;
       double _mpi_execute_reduction_stop;
@@ -419,7 +442,7 @@ namespace FEAT
        */
       template<typename Vector_>
       explicit IterationStats(const SolverBase<Vector_>& solver) :
-        _solver_name(solver.name()),
+        _solver_name(solver.expression_name()),
         _destroyed(false)
       {
         _mpi_execute_reduction_start = Statistics::get_time_mpi_execute_reduction();
@@ -469,7 +492,7 @@ namespace FEAT
         _mpi_wait_stop_blas2    = Statistics::get_time_mpi_wait_blas2();
         _mpi_wait_stop_blas3    = Statistics::get_time_mpi_wait_blas3();
         _mpi_wait_stop_collective    = Statistics::get_time_mpi_wait_collective();
-        Statistics::add_solver_expression(std::make_shared<ExpressionTimings>(_solver_name, _at.elapsed_now(),
+        Statistics::add_solver_expression(ExpressionTimings(_solver_name, _at.elapsed_now(),
           _mpi_execute_reduction_stop - _mpi_execute_reduction_start,
           _mpi_execute_blas2_stop - _mpi_execute_blas2_start,
           _mpi_execute_blas3_stop - _mpi_execute_blas3_start,
@@ -11,6 +11,7 @@
 #include <kernel/lafem/sparse_matrix_csr.hpp>
 #include <kernel/lafem/sparse_matrix_bcsr.hpp>
 #include <kernel/lafem/sparse_matrix_ell.hpp>
+#include <kernel/lafem/sparse_matrix_dcsr.hpp>
 #include <kernel/lafem/dense_vector.hpp>
 #include <kernel/lafem/dense_vector_blocked.hpp>
 #include <kernel/lafem/unit_filter.hpp>
@@ -18,7 +19,10 @@
 #include <kernel/solver/bicgstab.hpp>
 #include <kernel/solver/bicgstabl.hpp>
 #include <kernel/solver/fgmres.hpp>
+#include <kernel/solver/dfgmres.hpp>
 #include <kernel/solver/pcg.hpp>
+#include <kernel/solver/dpcg.hpp>
+#include <kernel/solver/multi_pcg.hpp>
 #include <kernel/solver/rgcr.hpp>
 #include <kernel/solver/pcr.hpp>
 #include <kernel/solver/richardson.hpp>
@@ -34,6 +38,7 @@
 #include <kernel/solver/idrs.hpp>
 #include <kernel/solver/amg.hpp>
 #include <kernel/solver/multigrid.hpp>
+#include <kernel/solver/solution_extrapolator.hpp>
 
 using namespace FEAT;
 using namespace FEAT::LAFEM;
@@ -98,6 +103,19 @@ public:
       + stringify(ref_iters) + " +/- " + stringify(iter_tol));
   }
 
+  void test_spai_float(const MatrixType& matrix, const FilterType& filter, VectorType& vec_sol,
+    const VectorType& vec_ref, const VectorType& vec_rhs, std::true_type) const
+  {
+    auto precon = std::make_shared<SPAIPrecond<MatrixType, FilterType, float>>(matrix, filter);
+    auto solver = Solver::new_bicgstab(matrix, filter, precon, BiCGStabPreconVariant::left);
+    test_solver("BiCGStab-left-SPAI-float", *solver, vec_sol, vec_ref, vec_rhs, 12);
+  }
+
+  // reduced precision storage of SPAI is only available for CSR matrices
+  void test_spai_float(const MatrixType&, const FilterType&, VectorType&, const VectorType&, const VectorType&, std::false_type) const
+  {
+  }
+
   virtual void run() const override
   {
     const Index m = 17;
@@ -143,6 +161,13 @@ public:
       test_solver("PCG-JAC", *solver, vec_sol, vec_ref, vec_rhs, 28);
     }
 
+    // test PCG-JAC with diagonal stored in single precision
+    {
+      auto precon = std::make_shared<JacobiPrecond<MatrixType, FilterType, float>>(matrix, filter);
+      auto solver = Solver::new_pcg(matrix, filter, precon);
+      test_solver("PCG-JAC-float", *solver, vec_sol, vec_ref, vec_rhs, 28);
+    }
+
     // test PCG-POLY(3)
     {
       auto precon = Solver::new_polynomial_precond(matrix, filter, 3);
@@ -185,6 +210,9 @@ public:
       test_solver("BiCGStab-left-SPAI", *solver, vec_sol, vec_ref, vec_rhs, 12);
     }
 
+    // test BICGStab-left-SPAI with approximate inverse stored in single precision
+    test_spai_float(matrix, filter, vec_sol, vec_ref, vec_rhs, std::is_same<MatrixType, SparseMatrixCSR<MemType_, DataType, IndexType>>());
+
     // test Richardson-SOR
     {
       auto precon = Solver::new_sor_precond(matrix, filter, DataType(1.7));
@@ -199,6 +227,13 @@ public:
       test_solver("BiCGStab-Left-ILU(0)", solver, vec_sol, vec_ref, vec_rhs, 12);
     }
 
+    // test BiCGStab-left-ILU(0) with factorisation stored in single precision
+    {
+      auto precon = std::make_shared<ILUPrecond<MatrixType, FilterType, float>>(matrix, filter, 0);
+      BiCGStab<MatrixType, FilterType> solver(matrix, filter, precon, BiCGStabPreconVariant::left);
+      test_solver("BiCGStab-Left-ILU(0)-float", solver, vec_sol, vec_ref, vec_rhs, 12);
+    }
+
     // test BiCGStab-right-SOR(1) aka GS
     {
       auto precon = Solver::new_sor_precond(matrix, filter, DataType(1));
@@ -380,12 +415,12 @@ public:
       test_solver("PCG-POLY", *solver, vec_sol, vec_ref, vec_rhs, 11);
     }
 
-    // test Richardson-JAC
+    // test BiCGStab-JAC
     {
       auto precon = Solver::new_jacobi_precond(matrix, filter);
       auto solver = Solver::new_richardson(matrix, filter, DataType(1.0), precon);
       solver->set_max_iter(1500);
-      test_solver("Richardson-JAC", *solver, vec_sol, vec_ref, vec_rhs, 1175);
+      test_solver("BiCGStab-JAC", *solver, vec_sol, vec_ref, vec_rhs, 1175);
     }
 
     // test BiCGStab-ILU(0)
@@ -734,6 +769,27 @@ public:
       test_solver("Richardson-ILU", *solver, vec_sol, vec_ref, vec_rhs, 43);
     }
 
+    // test Richardson-ILU with factorisation stored in single precision
+    {
+      auto precon = std::make_shared<ILUPrecond<MatrixType, FilterType, float>>(matrix, filter, 0);
+      auto solver = Solver::new_richardson(matrix, filter, DataType(0.9), precon);
+      test_solver("Richardson-ILU-float", *solver, vec_sol, vec_ref, vec_rhs, 43);
+    }
+
+    // test BiCGStab-JAC
+    {
+      auto precon = Solver::new_jacobi_precond(matrix, filter);
+      auto solver = Solver::new_bicgstab(matrix, filter, precon);
+      test_solver("BiCGStab-JAC", *solver, vec_sol, vec_ref, vec_rhs, 8);
+    }
+
+    // test BiCGStab-JAC with diagonal stored in single precision
+    {
+      auto precon = std::make_shared<JacobiPrecond<MatrixType, FilterType, float>>(matrix, filter);
+      auto solver = Solver::new_bicgstab(matrix, filter, precon);
+      test_solver("BiCGStab-JAC-float", *solver, vec_sol, vec_ref, vec_rhs, 8);
+    }
+
     // test Richardson-SOR
     {
       auto precon = Solver::new_sor_precond(matrix, filter, DataType(1.2));
@@ -750,3 +806,359 @@ public:
   }
 };
 BCSRSolverTest<Mem::Main, double, Index> bcsr_solver_test_main_double_index;
+
+template<typename MemType_, typename DataType_, typename IndexType_>
+class DCSRPrecondTest :
+  public TestSystem::FullTaggedTest<MemType_, DataType_, IndexType_>
+{
+public:
+  typedef DataType_ DataType;
+  typedef IndexType_ IndexType;
+  typedef LAFEM::SparseMatrixCSR<MemType_, DataType, IndexType> CSRMatrixType;
+  typedef LAFEM::SparseMatrixDCSR<MemType_, DataType, IndexType> DCSRMatrixType;
+  typedef LAFEM::DenseVector<MemType_, DataType, IndexType> VectorType;
+  typedef LAFEM::NoneFilter<MemType_, DataType, IndexType> FilterType;
+
+public:
+  DCSRPrecondTest() :
+    TestSystem::FullTaggedTest<MemType_, DataType, IndexType>("DCSRPrecondTest")
+  {
+  }
+
+  virtual ~DCSRPrecondTest()
+  {
+  }
+
+  /// applies both preconditioners to the same defect and compares the corrections
+  void test_precond(const String& name, SolverBase<VectorType>& precon_csr, SolverBase<VectorType>& precon_dcsr,
+    const VectorType& vec_def, const DataType tol) const
+  {
+    VectorType vec_cor_csr(vec_def.clone(CloneMode::Layout));
+    VectorType vec_cor_dcsr(vec_def.clone(CloneMode::Layout));
+
+    precon_csr.init();
+    precon_dcsr.init();
+    Status status_csr = precon_csr.apply(vec_cor_csr, vec_def);
+    Status status_dcsr = precon_dcsr.apply(vec_cor_dcsr, vec_def);
+    precon_dcsr.done();
+    precon_csr.done();
+    TEST_CHECK_MSG(status_success(status_csr), name + ": CSR apply failed with status = " + stringify(status_csr));
+    TEST_CHECK_MSG(status_success(status_dcsr), name + ": DCSR apply failed with status = " + stringify(status_dcsr));
+
+    const DataType ref = vec_cor_csr.norm2();
+    vec_cor_dcsr.axpy(vec_cor_csr, vec_cor_dcsr, -DataType(1));
+    const DataType err = vec_cor_dcsr.norm2();
+    TEST_CHECK_MSG(err <= tol * ref, name + ": DCSR correction differs from CSR correction by "
+      + stringify_fp_sci(err) + "; expected result <= " + stringify_fp_sci(tol * ref));
+  }
+
+  void test_matrix(const Index m) const
+  {
+    const DataType tol = Math::pow(Math::eps<DataType>(), DataType(0.8));
+
+    PointstarFactoryFD<DataType, IndexType> psf(m, 2);
+    CSRMatrixType matrix_csr(psf.matrix_csr());
+    DCSRMatrixType matrix_dcsr(matrix_csr);
+    FilterType filter;
+
+    // with 32 bit indices, the upper neighbours of the larger matrix do not fit into 8 bit deltas
+    // and are stored as escaped entries
+    if((m > Index(127)) && (matrix_dcsr.delta_bytes() == std::size_t(1)))
+      TEST_CHECK(matrix_dcsr.used_escapes() > Index(0));
+
+    Random rng;
+    VectorType vec_def(rng, matrix_csr.rows(), -DataType(1), DataType(1));
+
+    {
+      auto precon_csr = Solver::new_sor_precond(matrix_csr, filter, DataType(1.7));
+      auto precon_dcsr = Solver::new_sor_precond(matrix_dcsr, filter, DataType(1.7));
+      test_precond("SOR(1.7)", *precon_csr, *precon_dcsr, vec_def, tol);
+    }
+
+    {
+      auto precon_csr = Solver::new_ssor_precond(matrix_csr, filter);
+      auto precon_dcsr = Solver::new_ssor_precond(matrix_dcsr, filter);
+      test_precond("SSOR", *precon_csr, *precon_dcsr, vec_def, tol);
+    }
+
+    {
+      auto precon_csr = Solver::new_ilu_precond(matrix_csr, filter, Index(0));
+      auto precon_dcsr = Solver::new_ilu_precond(matrix_dcsr, filter, Index(0));
+      test_precond("ILU(0)", *precon_csr, *precon_dcsr, vec_def, tol);
+    }
+
+    {
+      auto precon_csr = Solver::new_ilu_precond(matrix_csr, filter, Index(2));
+      auto precon_dcsr = Solver::new_ilu_precond(matrix_dcsr, filter, Index(2));
+      test_precond("ILU(2)", *precon_csr, *precon_dcsr, vec_def, tol);
+    }
+
+    // factorisation stored in single precision
+    {
+      auto precon_csr = std::make_shared<ILUPrecond<CSRMatrixType, FilterType, float>>(matrix_csr, filter, 0);
+      auto precon_dcsr = std::make_shared<ILUPrecond<DCSRMatrixType, FilterType, float>>(matrix_dcsr, filter, 0);
+      test_precond("ILU(0)-float", *precon_csr, *precon_dcsr, vec_def, tol);
+    }
+  }
+
+  virtual void run() const override
+  {
+    test_matrix(Index(17));
+    test_matrix(Index(129));
+  }
+};
+
+DCSRPrecondTest<Mem::Main, double, unsigned int> dcsr_precond_test_main_double_uint;
+DCSRPrecondTest<Mem::Main, double, unsigned long> dcsr_precond_test_main_double_ulong;
+
+template<typename MemType_, typename DataType_, typename IndexType_>
+class MultiPCGSolverTest :
+  public TestSystem::FullTaggedTest<MemType_, DataType_, IndexType_>
+{
+public:
+  static constexpr int num_cols = 3;
+  typedef DataType_ DataType;
+  typedef IndexType_ IndexType;
+  typedef LAFEM::SparseMatrixCSR<MemType_, DataType, IndexType> MatrixType;
+  typedef LAFEM::DenseMultiVector<MemType_, DataType, IndexType, num_cols> VectorType;
+  typedef LAFEM::NoneFilterBlocked<MemType_, DataType, IndexType, num_cols> FilterType;
+
+public:
+  MultiPCGSolverTest() :
+    TestSystem::FullTaggedTest<MemType_, DataType, IndexType>("MultiPCGSolverTest")
+  {
+  }
+
+  virtual ~MultiPCGSolverTest()
+  {
+  }
+
+  virtual void run() const override
+  {
+    const DataType tol = Math::pow(Math::eps<DataType>(), DataType(0.5));
+
+    PointstarFactoryFD<DataType, IndexType> psf(17, 2);
+    MatrixType matrix(psf.matrix_csr());
+    DenseVector<MemType_, DataType, IndexType> q2b_vec(psf.vector_q2_bubble());
+    FilterType filter;
+
+    // reference solutions: a tiny random vector, the bubble and the null vector; the first column
+    // must converge on its own, although its defect is negligible compared to the one of the second
+    // column, and the solver has to freeze the third column
+    Random rng;
+    VectorType vec_ref(matrix.rows());
+    for(Index i(0); i < matrix.rows(); ++i)
+    {
+      Tiny::Vector<DataType, num_cols> t;
+      t[0] = DataType(1E-8) * rng(-DataType(1), DataType(1));
+      t[1] = q2b_vec(i);
+      t[2] = DataType(0);
+      vec_ref(i, t);
+    }
+
+    VectorType vec_rhs(vec_ref.clone(CloneMode::Layout));
+    matrix.apply(vec_rhs, vec_ref);
+    VectorType vec_sol(vec_ref.clone(CloneMode::Layout));
+
+    auto solver = Solver::new_multi_pcg<VectorType>(matrix, filter);
+    solver->set_plot_name("MultiCG");
+    solver->set_plot_mode(PlotMode::summary);
+    solver->set_tol_rel(DataType(1E-8));
+    solver->set_max_iter(1000);
+    solver->init();
+    Status status = solver->apply(vec_sol, vec_rhs);
+    TEST_CHECK_MSG(status_success(status), String("MultiCG: apply failed with status = ") + stringify(status));
+    solver->done();
+
+    // check each column against its reference solution
+    const Tiny::Vector<DataType, num_cols> r = vec_ref.norm2sqr_blocked();
+    vec_sol.axpy(vec_ref, vec_sol, -DataType(1));
+    const Tiny::Vector<DataType, num_cols> d = vec_sol.norm2sqr_blocked();
+    for(int j(0); j < num_cols; ++j)
+    {
+      TEST_CHECK_MSG(d[j] <= tol * Math::max(r[j], DataType(1E-30)), "MultiCG: column " + stringify(j) + " failed to reach tolerance\n"
+        + "result: " + stringify_fp_sci(d[j]) + "; expected result <= " + stringify(tol * r[j]));
+    }
+  }
+};
+
+MultiPCGSolverTest<Mem::Main, double, Index> multi_pcg_solver_test_main_double_index;
+
+template<typename MemType_, typename DataType_, typename IndexType_>
+class RecyclingSolverTest :
+  public TestSystem::FullTaggedTest<MemType_, DataType_, IndexType_>
+{
+public:
+  static constexpr Index num_systems = 6;
+  typedef DataType_ DataType;
+  typedef IndexType_ IndexType;
+  typedef LAFEM::SparseMatrixCSR<MemType_, DataType, IndexType> MatrixType;
+  typedef typename MatrixType::VectorTypeR VectorType;
+  typedef NoneFilter<MemType_, DataType, IndexType> FilterType;
+
+public:
+  RecyclingSolverTest() :
+    TestSystem::FullTaggedTest<MemType_, DataType, IndexType>("RecyclingSolverTest")
+  {
+  }
+
+  virtual ~RecyclingSolverTest()
+  {
+  }
+
+  /// solves a sequence of slowly varying systems and returns the total number of iterations
+  template<typename Solver_>
+  Index solve_sequence(String name, Solver_& solver, const MatrixType& matrix,
+    const VectorType& vec_ref, const VectorType& vec_pert) const
+  {
+    const DataType tol = Math::pow(Math::eps<DataType>(), DataType(0.5));
+
+    VectorType vec_x(vec_ref.clone(CloneMode::Layout));
+    VectorType vec_rhs(vec_ref.clone(CloneMode::Layout));
+    VectorType vec_sol(vec_ref.clone(CloneMode::Layout));
+
+    solver.set_plot_name(name);
+    solver.set_tol_rel(DataType(1E-10));
+    solver.set_max_iter(1000);
+
+    Index total_iter(0);
+    for(Index k(0); k < num_systems; ++k)
+    {
+      // x_k := x_ref + k/20 * x_pert and b_k := A*x_k
+      vec_x.axpy(vec_pert, vec_ref, DataType(k) / DataType(20));
+      matrix.apply(vec_rhs, vec_x);
+
+      vec_sol.format();
+      Status status = solver.apply(vec_sol, vec_rhs);
+      TEST_CHECK_MSG(status_success(status), name + String(": apply failed with status = ") + stringify(status));
+      total_iter += solver.get_num_iter();
+
+      vec_sol.axpy(vec_x, vec_sol, -DataType(1));
+      const DataType d = vec_sol.norm2sqr();
+      TEST_CHECK_MSG(d <= tol, name + ": system " + stringify(k) + " failed to reach tolerance\n"
+        + "result: " + stringify_fp_sci(d) + "; expected result <= " + stringify(tol));
+    }
+    return total_iter;
+  }
+
+  template<typename Solver_>
+  void test_rescaled(String name, Solver_& solver, MatrixType& matrix, const VectorType& vec_ref) const
+  {
+    const DataType tol = Math::pow(Math::eps<DataType>(), DataType(0.5));
+
+    // the recycled subspace has to be rebuilt for the modified matrix
+    matrix.scale(matrix, DataType(2));
+    solver.init_numeric();
+
+    VectorType vec_rhs(vec_ref.clone(CloneMode::Layout));
+    VectorType vec_sol(vec_ref.clone(CloneMode::Layout));
+    matrix.apply(vec_rhs, vec_ref);
+    vec_sol.format();
+    Status status = solver.apply(vec_sol, vec_rhs);
+    TEST_CHECK_MSG(status_success(status), name + String(": apply after rescaling failed with status = ") + stringify(status));
+
+    solver.done_numeric();
+    matrix.scale(matrix, DataType(0.5));
+
+    vec_sol.axpy(vec_ref, vec_sol, -DataType(1));
+    const DataType d = vec_sol.norm2sqr();
+    TEST_CHECK_MSG(d <= tol, name + ": failed to reach tolerance after rescaling\n"
+      + "result: " + stringify_fp_sci(d) + "; expected result <= " + stringify(tol));
+  }
+
+  void test_extrapolator(const MatrixType& matrix, const FilterType& filter,
+    const VectorType& vec_ref, const VectorType& vec_pert) const
+  {
+    const DataType tol = Math::pow(Math::eps<DataType>(), DataType(0.5));
+
+    VectorType vec_x(vec_ref.clone(CloneMode::Layout));
+    VectorType vec_rhs(vec_ref.clone(CloneMode::Layout));
+    VectorType vec_sol(vec_ref.clone(CloneMode::Layout));
+
+    // x_k := x_ref + k * x_pert lies in a two-dimensional space
+    SolutionExtrapolator<VectorType> extrapolator(ExtrapolationMode::polynomial, Index(3));
+    TEST_CHECK(!extrapolator.predict(vec_sol, matrix, filter, vec_rhs));
+    for(Index k(0); k < Index(4); ++k)
+    {
+      vec_x.axpy(vec_pert, vec_ref, DataType(k));
+      extrapolator.push(vec_x);
+    }
+    TEST_CHECK_EQUAL(extrapolator.size(), Index(3));
+
+    // predict x_4
+    vec_x.axpy(vec_pert, vec_ref, DataType(4));
+    matrix.apply(vec_rhs, vec_x);
+
+    for(ExtrapolationMode mode : {ExtrapolationMode::polynomial, ExtrapolationMode::pod})
+    {
+      extrapolator.set_mode(mode);
+      vec_sol.format();
+      TEST_CHECK(extrapolator.predict(vec_sol, matrix, filter, vec_rhs));
+      vec_sol.axpy(vec_x, vec_sol, -DataType(1));
+      const DataType d = vec_sol.norm2sqr() / vec_x.norm2sqr();
+      TEST_CHECK_MSG(d <= tol, "SolutionExtrapolator: mode " + stringify(mode) + " failed to reach tolerance\n"
+        + "result: " + stringify_fp_sci(d) + "; expected result <= " + stringify(tol));
+    }
+
+    extrapolator.set_mode(ExtrapolationMode::none);
+    TEST_CHECK(!extrapolator.predict(vec_sol, matrix, filter, vec_rhs));
+    extrapolator.clear();
+    TEST_CHECK_EQUAL(extrapolator.size(), Index(0));
+  }
+
+  virtual void run() const override
+  {
+    PointstarFactoryFD<DataType, IndexType> psf(17, 2);
+    MatrixType matrix(psf.matrix_csr());
+    VectorType vec_ref(psf.vector_q2_bubble());
+    FilterType filter;
+
+    Random rng;
+    VectorType vec_pert(rng, matrix.rows(), -DataType(1), DataType(1));
+
+    // reference: CG and FGMRES without recycling
+    Index iter_pcg(0), iter_fgmres(0);
+    {
+      auto solver = Solver::new_pcg(matrix, filter);
+      solver->init();
+      iter_pcg = solve_sequence("CG", *solver, matrix, vec_ref, vec_pert);
+      solver->done();
+    }
+    {
+      auto solver = Solver::new_fgmres(matrix, filter, Index(16));
+      solver->init();
+      iter_fgmres = solve_sequence("FGMRES(16)", *solver, matrix, vec_ref, vec_pert);
+      solver->done();
+    }
+
+    // deflated CG
+    {
+      auto solver = Solver::new_dpcg(matrix, filter, Index(4));
+      solver->init();
+      const Index iter = solve_sequence("DCG(4)", *solver, matrix, vec_ref, vec_pert);
+      TEST_CHECK_MSG(iter < iter_pcg, "DCG(4): " + stringify(iter) + " iterations; expected less than "
+        + stringify(iter_pcg));
+      TEST_CHECK((solver->get_num_recycled() > Index(0)) && (solver->get_num_recycled() <= Index(4)));
+      solver->done_numeric();
+      test_rescaled("DCG(4)", *solver, matrix, vec_ref);
+      solver->done_symbolic();
+    }
+
+    // deflated FGMRES
+    {
+      auto solver = Solver::new_dfgmres(matrix, filter, Index(16), Index(4));
+      solver->init();
+      const Index iter = solve_sequence("DFGMRES(16,4)", *solver, matrix, vec_ref, vec_pert);
+      TEST_CHECK_MSG(iter < iter_fgmres, "DFGMRES(16,4): " + stringify(iter) + " iterations; expected less than "
+        + stringify(iter_fgmres));
+      TEST_CHECK((solver->get_num_recycled() > Index(0)) && (solver->get_num_recycled() <= Index(4)));
+      solver->done_numeric();
+      test_rescaled("DFGMRES(16,4)", *solver, matrix, vec_ref);
+      solver->done_symbolic();
+    }
+
+    test_extrapolator(matrix, filter, vec_ref, vec_pert);
+  }
+};
+
+RecyclingSolverTest<Mem::Main, double, Index> recycling_solver_test_main_double_index;
@@ -338,7 +338,7 @@ namespace FEAT
         Status _apply_intern(VectorType& vec_sol, const VectorType& DOXY(vec_rhs))
         {
           IterationStats pre_iter(*this);
-          Statistics::add_solver_expression(std::make_shared<ExpressionStartSolve>(this->name()));
+          Statistics::add_solver_expression(ExpressionStartSolve(this->expression_name()));
           VectorType& vec_p_tilde  (_vec_p_tilde);
           VectorType& vec_r        (_vec_r);
           VectorType& vec_r_tilde  (_vec_r_tilde);
@@ -355,7 +355,7 @@ namespace FEAT
           if(!this->_apply_precond(vec_p_tilde, _vec_r, fil_sys))
           {
             Statistics::add_solver_expression(
-              std::make_shared<ExpressionEndSolve>(this->name(), Status::aborted, this->get_num_iter()));
+              ExpressionEndSolve(this->expression_name(), Status::aborted, this->get_num_iter()));
             return Status::aborted;
           }
 
@@ -398,7 +398,7 @@ namespace FEAT
             {
               stat.destroy();
               Statistics::add_solver_expression(
-                std::make_shared<ExpressionEndSolve>(this->name(), Status::aborted, this->get_num_iter()));
+                ExpressionEndSolve(this->expression_name(), Status::aborted, this->get_num_iter()));
               return Status::aborted;
             }
 
@@ -458,7 +458,7 @@ namespace FEAT
 
                 stat.destroy();
                 Statistics::add_solver_expression(
-                  std::make_shared<ExpressionEndSolve>(this->name(), status_half, this->get_num_iter()));
+                  ExpressionEndSolve(this->expression_name(), status_half, this->get_num_iter()));
 
                 return status_half;
               }
@@ -477,7 +477,7 @@ namespace FEAT
             {
               stat.destroy();
               Statistics::add_solver_expression(
-                std::make_shared<ExpressionEndSolve>(this->name(), Status::aborted, this->get_num_iter()));
+                ExpressionEndSolve(this->expression_name(), Status::aborted, this->get_num_iter()));
               return Status::aborted;
             }
 
@@ -499,7 +499,7 @@ namespace FEAT
               status = Status::aborted;
               stat.destroy();
               Statistics::add_solver_expression(
-                std::make_shared<ExpressionEndSolve>(this->name(), status, this->get_num_iter()));
+                ExpressionEndSolve(this->expression_name(), status, this->get_num_iter()));
               return status;
             }
 
@@ -518,7 +518,7 @@ namespace FEAT
             {
               stat.destroy();
               Statistics::add_solver_expression(
-                std::make_shared<ExpressionEndSolve>(this->name(), status, this->get_num_iter()));
+                ExpressionEndSolve(this->expression_name(), status, this->get_num_iter()));
               return status;
             }
 
@@ -547,7 +547,7 @@ namespace FEAT
               status = Status::aborted;
               stat.destroy();
               Statistics::add_solver_expression(
-                std::make_shared<ExpressionEndSolve>(this->name(), status, this->get_num_iter()));
+                ExpressionEndSolve(this->expression_name(), status, this->get_num_iter()));
               return status;
             }
 
@@ -559,7 +559,7 @@ namespace FEAT
 
           // we should never reach this point...
           Statistics::add_solver_expression(
-            std::make_shared<ExpressionEndSolve>(this->name(), Status::undefined, this->get_num_iter()));
+            ExpressionEndSolve(this->expression_name(), Status::undefined, this->get_num_iter()));
           return Status::undefined;
         }
     }; // class BiCGStab<...>
@@ -321,7 +321,7 @@ namespace FEAT
         Status _apply_intern(VectorType& vec_sol, const VectorType& vec_rhs)
         {
           IterationStats pre_iter(*this);
-          Statistics::add_solver_expression(std::make_shared<ExpressionStartSolve>(this->name()));
+          Statistics::add_solver_expression(ExpressionStartSolve(this->expression_name()));
 
 
           int l (_l);
@@ -353,7 +353,7 @@ namespace FEAT
             if(!this->_apply_precond(_vec_rj_hat.at(0), _vec_pc, fil_sys))
             {
               Statistics::add_solver_expression(
-                std::make_shared<ExpressionEndSolve>(this->name(), Status::aborted, this->get_num_iter()));
+                ExpressionEndSolve(this->expression_name(), Status::aborted, this->get_num_iter()));
               return Status::aborted;
             }
           }
@@ -385,7 +385,7 @@ namespace FEAT
                 if(!this->_apply_precond(_vec_uj_hat.at( Index(j+1) ), _vec_pc, fil_sys))
                 {
                   Statistics::add_solver_expression(
-                    std::make_shared<ExpressionEndSolve>(this->name(), Status::aborted, this->get_num_iter()));
+                    ExpressionEndSolve(this->expression_name(), Status::aborted, this->get_num_iter()));
                   return Status::aborted;
                 }
               }
@@ -394,7 +394,7 @@ namespace FEAT
                 if(!this->_apply_precond(_vec_pc, _vec_uj_hat.at( Index(j) ), fil_sys))
                 {
                   Statistics::add_solver_expression(
-                    std::make_shared<ExpressionEndSolve>(this->name(), Status::aborted, this->get_num_iter()));
+                    ExpressionEndSolve(this->expression_name(), Status::aborted, this->get_num_iter()));
                   return Status::aborted;
                 }
                 mat_sys.apply(_vec_uj_hat.at( Index(j+1) ), _vec_pc);
@@ -417,7 +417,7 @@ namespace FEAT
                 if(!this->_apply_precond(_vec_rj_hat.at( Index(j+1) ) , _vec_pc, fil_sys))
                 {
                   Statistics::add_solver_expression(
-                    std::make_shared<ExpressionEndSolve>(this->name(), Status::aborted, this->get_num_iter()));
+                    ExpressionEndSolve(this->expression_name(), Status::aborted, this->get_num_iter()));
                   return Status::aborted;
                 }
               }
@@ -426,7 +426,7 @@ namespace FEAT
                 if(!this->_apply_precond(_vec_pc, _vec_rj_hat.at(Index(j)), fil_sys))
                 {
                   Statistics::add_solver_expression(
-                    std::make_shared<ExpressionEndSolve>(this->name(), Status::aborted, this->get_num_iter()));
+                    ExpressionEndSolve(this->expression_name(), Status::aborted, this->get_num_iter()));
                   return Status::aborted;
                 }
                 mat_sys.apply(_vec_rj_hat.at(Index(j+1)), _vec_pc);
@@ -494,13 +494,13 @@ namespace FEAT
             {
               stat.destroy();
               Statistics::add_solver_expression(
-                std::make_shared<ExpressionEndSolve>(this->name(), status, this->get_num_iter()));
+                ExpressionEndSolve(this->expression_name(), status, this->get_num_iter()));
               if (_precon_variant == BiCGStabLPreconVariant::right)
               {
                 if(!this->_apply_precond(_vec_pc, vec_sol, fil_sys))
                 {
                   Statistics::add_solver_expression(
-                    std::make_shared<ExpressionEndSolve>(this->name(), Status::aborted, this->get_num_iter()));
+                    ExpressionEndSolve(this->expression_name(), Status::aborted, this->get_num_iter()));
                   return Status::aborted;
                 }
                 vec_sol.copy(_vec_pc);
@@ -511,7 +511,7 @@ namespace FEAT
           }
           // we should never reach this point...
           Statistics::add_solver_expression(
-            std::make_shared<ExpressionEndSolve>(this->name(), Status::undefined, this->get_num_iter()));
+            ExpressionEndSolve(this->expression_name(), Status::undefined, this->get_num_iter()));
           return Status::undefined;
         }
     };
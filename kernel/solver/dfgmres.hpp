@@ -0,0 +1,648 @@
+// FEAT3: Finite Element Analysis Toolbox, Version 3
+// Copyright (C) 2010 - 2020 by Stefan Turek & the FEAT group
+// FEAT3 is released under the GNU General Public License version 3,
+// see the file 'copyright.txt' in the top level directory for details.
+
+#pragma once
+#ifndef KERNEL_SOLVER_DFGMRES_HPP
+#define KERNEL_SOLVER_DFGMRES_HPP 1
+
+// includes, FEAT
+#include <kernel/solver/iterative.hpp>
+
+// includes, system
+#include <deque>
+#include <vector>
+
+namespace FEAT
+{
+  namespace Solver
+  {
+    /**
+     * \brief Deflated FGMRES(k) solver with subspace recycling
+     *
+     * This class implements a GCRO-type variant of the FGMRES(k) solver, which carries a recycled
+     * subspace \f$U\f$ from one call of apply() or correct() to the next one. The recycled space is
+     * stored along with its image \f$C = AU\f$, which is kept orthonormal. Each solve first projects
+     * the initial defect onto \f$C\f$ and then runs FGMRES cycles on the deflated operator
+     * \f$(I - CC^\top)A\f$, so that the spectral information of the previous solves is not lost.
+     *
+     * After each successful solve, the total correction computed by the Krylov cycles is appended to
+     * the recycled space, replacing the oldest vector if the space is full. For slowly varying sequences
+     * of systems, as they arise in time stepping schemes or Newton iterations, this usually reduces
+     * the number of iterations considerably.
+     *
+     * \note
+     * If the system matrix changes, init_numeric() has to be called, which recomputes the image
+     * \f$C\f$ of the recycled space by one matrix-vector product per recycled vector.
+     *
+     * \see
+     * M. L. Parks, E. de Sturler, G. Mackey, D. D. Johnson, S. Maiti: Recycling Krylov subspaces for
+     * sequences of linear systems; SIAM Journal on Scientific Computing, Volume 28 Issue 5, pp. 1651-1674, 2006
+     *
+     * \tparam Matrix_
+     * The matrix class to be used by the solver.
+     *
+     * \tparam Filter_
+     * The filter class to be used by the solver.
+     */
+    template<
+      typename Matrix_,
+      typename Filter_>
+    class DFGMRES :
+      public PreconditionedIterativeSolver<typename Matrix_::VectorTypeR>
+    {
+    public:
+      typedef Matrix_ MatrixType;
+      typedef Filter_ FilterType;
+      typedef typename MatrixType::VectorTypeR VectorType;
+      typedef typename MatrixType::DataType DataType;
+      typedef PreconditionedIterativeSolver<VectorType> BaseClass;
+
+      typedef SolverBase<VectorType> PrecondType;
+
+    protected:
+      /// the matrix for the solver
+      const MatrixType& _system_matrix;
+      /// the filter for the solver
+      const FilterType& _system_filter;
+      /// krylov dimension
+      Index _krylov_dim;
+      /// maximum dimension of the recycled subspace
+      Index _recycle_dim;
+      /// inner pseudo-residual scaling factor, see FGMRES
+      DataType _inner_res_scale;
+      /// krylov basis vectors
+      std::vector<VectorType> _vec_v, _vec_z;
+      /// recycled subspace U and its orthonormal image C = A*U
+      std::deque<VectorType> _vec_u, _vec_c;
+      /// solution vector after projection onto the recycled subspace
+      VectorType _vec_x0;
+      /// Givens rotation coefficients
+      std::vector<DataType> _c, _s, _q;
+      /// Hessenberg matrix
+      std::vector<std::vector<DataType>> _h;
+      /// projection coefficients B = C^T * A * Z
+      std::vector<std::vector<DataType>> _b;
+
+    public:
+      /**
+       * \brief Constructor
+       *
+       * \param[in] matrix
+       * A reference to the system matrix.
+       *
+       * \param[in] filter
+       * A reference to the system filter.
+       *
+       * \param[in] krylov_dim
+       * The maximum Krylov subspace dimension. Must be > 0.
+       *
+       * \param[in] recycle_dim
+       * The maximum dimension of the recycled subspace. May be 0, which results in plain FGMRES(k).
+       *
+       * \param[in] inner_res_scale
+       * The scaling factor for the inner GMRES loop residual; see FGMRES for details.
+       *
+       * \param[in] precond
+       * A pointer to the preconditioner. May be \c nullptr.
+       */
+      explicit DFGMRES(const MatrixType& matrix, const FilterType& filter, Index krylov_dim, Index recycle_dim,
+        DataType inner_res_scale = DataType(0), std::shared_ptr<PrecondType> precond = nullptr) :
+        BaseClass("DFGMRES(" + stringify(krylov_dim) + "," + stringify(recycle_dim) + ")", precond),
+        _system_matrix(matrix),
+        _system_filter(filter),
+        _krylov_dim(krylov_dim),
+        _recycle_dim(recycle_dim)
+      {
+        // set communicator by system matrix
+        this->_set_comm_by_matrix(matrix);
+        set_inner_res_scale(inner_res_scale);
+      }
+
+      explicit DFGMRES(const String& section_name, PropertyMap* section,
+        const MatrixType& matrix, const FilterType& filter, std::shared_ptr<PrecondType> precond = nullptr) :
+        BaseClass("DFGMRES", section_name, section, precond),
+        _system_matrix(matrix),
+        _system_filter(filter),
+        _recycle_dim(4),
+        _inner_res_scale(DataType(0))
+      {
+        // set communicator by system matrix
+        this->_set_comm_by_matrix(matrix);
+
+        // Set _inner_res_scale by parameter or use default value
+        auto inner_res_scale_p = section->query("inner_res_scale");
+        if(inner_res_scale_p.second && (!inner_res_scale_p.first.parse(this->_inner_res_scale) || (this->_inner_res_scale < DataType(0))))
+          throw ParseError(section_name + ".inner_res_scale", inner_res_scale_p.first, "a non-negative float");
+
+        // Check if we have set _krylov_vim
+        auto krylov_dim_p = section->query("krylov_dim");
+        if(!krylov_dim_p.second)
+          throw ParseError("DFGMRES config section is missing the mandatory krylov_dim!");
+
+        if(!krylov_dim_p.first.parse(this->_krylov_dim) || (this->_krylov_dim <= Index(0)))
+          throw ParseError(section_name + ".krylov_dim", krylov_dim_p.first, "a positive integer");
+
+        // Set _recycle_dim by parameter or use default value
+        auto recycle_dim_p = section->query("recycle_dim");
+        if(recycle_dim_p.second && !recycle_dim_p.first.parse(this->_recycle_dim))
+          throw ParseError(section_name + ".recycle_dim", recycle_dim_p.first, "a non-negative integer");
+
+        this->set_plot_name("DFGMRES("+stringify(_krylov_dim)+","+stringify(_recycle_dim)+")");
+      }
+
+      /**
+       * \brief Empty virtual destructor
+       */
+      virtual ~DFGMRES()
+      {
+      }
+
+      /// \copydoc BaseClass::name()
+      virtual String name() const override
+      {
+        return "DFGMRES";
+      }
+
+      virtual void init_symbolic() override
+      {
+        BaseClass::init_symbolic();
+
+        _c.reserve(_krylov_dim);
+        _s.reserve(_krylov_dim);
+        _q.reserve(_krylov_dim);
+        _h.resize(_krylov_dim);
+        _b.resize(_krylov_dim);
+
+        for(Index i(0); i < _krylov_dim; ++i)
+        {
+          _h.at(i).resize(i+1);
+        }
+
+        _vec_v.push_back(this->_system_matrix.create_vector_r());
+        for(Index i(0); i < _krylov_dim; ++i)
+        {
+          _vec_v.push_back(this->_vec_v.front().clone(LAFEM::CloneMode::Layout));
+          _vec_z.push_back(this->_vec_v.front().clone(LAFEM::CloneMode::Layout));
+        }
+        _vec_x0 = this->_vec_v.front().clone(LAFEM::CloneMode::Layout);
+      }
+
+      virtual void done_symbolic() override
+      {
+        clear_recycle_space();
+        _vec_x0.clear();
+        _vec_v.clear();
+        _vec_z.clear();
+        BaseClass::done_symbolic();
+      }
+
+      /**
+       * \brief Numeric initialisation
+       *
+       * Recomputes the image \f$C = AU\f$ of the recycled subspace for the (possibly changed) system matrix.
+       */
+      virtual void init_numeric() override
+      {
+        BaseClass::init_numeric();
+
+        // recompute C := A*U and orthonormalise C, applying the same operations to U
+        std::deque<VectorType> vec_u, vec_c;
+        vec_u.swap(_vec_u);
+        vec_c.swap(_vec_c);
+        for(std::size_t i(0); i < vec_u.size(); ++i)
+        {
+          this->_system_matrix.apply(vec_c.at(i), vec_u.at(i));
+          this->_system_filter.filter_def(vec_c.at(i));
+          _append_recycle_vector(std::move(vec_u.at(i)), std::move(vec_c.at(i)));
+        }
+      }
+
+      /**
+       * \brief Sets the inner Krylov space dimension
+       *
+       * \param[in] krylov_dim
+       * The k in DFGMRES(k)
+       */
+      virtual void set_krylov_dim(Index krylov_dim)
+      {
+        XASSERT(krylov_dim > Index(0));
+        _krylov_dim = krylov_dim;
+      }
+
+      /**
+       * \brief Sets the maximum dimension of the recycled subspace
+       *
+       * \param[in] recycle_dim
+       * The maximum number of recycled vectors. May be 0.
+       */
+      void set_recycle_dim(Index recycle_dim)
+      {
+        _recycle_dim = recycle_dim;
+        while(Index(_vec_u.size()) > _recycle_dim)
+        {
+          _vec_u.pop_front();
+          _vec_c.pop_front();
+        }
+      }
+
+      /// \returns The current dimension of the recycled subspace.
+      Index get_num_recycled() const
+      {
+        return Index(_vec_u.size());
+      }
+
+      /// Discards the recycled subspace.
+      void clear_recycle_space()
+      {
+        _vec_u.clear();
+        _vec_c.clear();
+      }
+
+      /**
+       * \brief Sets the inner residual scale
+       *
+       * \param[in] inner_res_scale
+       * Scaling parameter for convergence of the inner iteration
+       */
+      virtual void set_inner_res_scale(DataType inner_res_scale)
+      {
+        XASSERT(inner_res_scale >= DataType(0));
+        _inner_res_scale = inner_res_scale;
+      }
+
+      /// \copydoc IterativeSolver::apply()
+      virtual Status apply(VectorType& vec_sol, const VectorType& vec_rhs) override
+      {
+        // save input rhs vector as initial defect
+        this->_vec_v.at(0).copy(vec_rhs);
+
+        // clear solution vector
+        vec_sol.format();
+
+        // apply
+        this->_status = _apply_intern(vec_sol, vec_rhs);
+        this->plot_summary();
+        return this->_status;
+      }
+
+      /// \copydoc SolverBase::correct()
+      virtual Status correct(VectorType& vec_sol, const VectorType& vec_rhs) override
+      {
+        // compute initial defect
+        this->_system_matrix.apply(this->_vec_v.at(0), vec_sol, vec_rhs, -DataType(1));
+        this->_system_filter.filter_def(this->_vec_v.at(0));
+
+        // apply
+        this->_status = _apply_intern(vec_sol, vec_rhs);
+        this->plot_summary();
+        return this->_status;
+      }
+
+    protected:
+      /**
+       * \brief Appends a vector to the recycled subspace
+       *
+       * The image vector is orthonormalised against the current image space and the same
+       * linear combination is applied to the subspace vector. If the image vector is (numerically)
+       * linear dependent, it is discarded.
+       *
+       * \param[in] vec_u
+       * The new subspace vector.
+       *
+       * \param[in] vec_c
+       * The image of the new subspace vector under the system matrix.
+       */
+      void _append_recycle_vector(VectorType&& vec_u, VectorType&& vec_c)
+      {
+        const DataType norm_0 = vec_c.norm2();
+        for(std::size_t j(0); j < _vec_c.size(); ++j)
+        {
+          const DataType alpha = _vec_c.at(j).dot(vec_c);
+          vec_c.axpy(_vec_c.at(j), vec_c, -alpha);
+          vec_u.axpy(_vec_u.at(j), vec_u, -alpha);
+        }
+        const DataType norm_1 = vec_c.norm2();
+        if(!(norm_1 > Math::sqrt(Math::eps<DataType>()) * norm_0))
+          return;
+        vec_c.scale(vec_c, DataType(1) / norm_1);
+        vec_u.scale(vec_u, DataType(1) / norm_1);
+        _vec_u.push_back(std::move(vec_u));
+        _vec_c.push_back(std::move(vec_c));
+      }
+
+      /**
+       * \brief Updates the recycled subspace by the correction of the last solve
+       *
+       * \param[in] vec_sol
+       * The final solution vector of the last solve.
+       */
+      void _update_recycle_space(const VectorType& vec_sol)
+      {
+        if(_recycle_dim <= Index(0))
+          return;
+
+        VectorType vec_u(_vec_x0.clone(LAFEM::CloneMode::Layout));
+        VectorType vec_c(_vec_x0.clone(LAFEM::CloneMode::Layout));
+
+        // u := x - x0, c := A*u
+        vec_u.axpy(_vec_x0, vec_sol, -DataType(1));
+        this->_system_matrix.apply(vec_c, vec_u);
+        this->_system_filter.filter_def(vec_c);
+        _append_recycle_vector(std::move(vec_u), std::move(vec_c));
+
+        // drop the oldest vectors if the space is full
+        while(Index(_vec_u.size()) > _recycle_dim)
+        {
+          _vec_u.pop_front();
+          _vec_c.pop_front();
+        }
+      }
+
+      virtual Status _apply_intern(VectorType& vec_sol, const VectorType& vec_rhs)
+      {
+        IterationStats pre_iter(*this);
+        Statistics::add_solver_expression(ExpressionStartSolve(this->expression_name()));
+        const MatrixType& matrix(this->_system_matrix);
+        const FilterType& filter(this->_system_filter);
+        const std::size_t num_rec(_vec_c.size());
+
+        // compute initial defect
+        Status status = this->_set_initial_defect(this->_vec_v.at(0), vec_sol);
+
+        // project initial defect onto recycled subspace:
+        // x := x + U*C^T*r, r := r - C*C^T*r
+        if((status == Status::progress) && (num_rec > std::size_t(0)))
+        {
+          for(std::size_t j(0); j < num_rec; ++j)
+          {
+            const DataType alpha = this->_vec_c.at(j).dot(this->_vec_v.at(0));
+            vec_sol.axpy(this->_vec_u.at(j), vec_sol, alpha);
+            this->_vec_v.at(0).axpy(this->_vec_c.at(j), this->_vec_v.at(0), -alpha);
+          }
+          status = this->_set_new_defect(this->_vec_v.at(0), vec_sol);
+        }
+
+        // save projected solution for the recycling update
+        this->_vec_x0.copy(vec_sol);
+
+        for(Index k(0); k < this->_krylov_dim; ++k)
+          this->_b.at(k).resize(num_rec);
+
+        pre_iter.destroy();
+
+        // outer GMRES loop
+        while(status == Status::progress)
+        {
+          IterationStats stat(*this);
+
+          _q.clear();
+          _s.clear();
+          _c.clear();
+          _q.push_back(this->_def_cur);
+
+          // normalise v[0]
+          this->_vec_v.at(0).scale(this->_vec_v.at(0), DataType(1) / _q.back());
+
+          // inner GMRES loop
+          Index i(0);
+          while(i < this->_krylov_dim)
+          {
+            // apply preconditioner
+            if(!this->_apply_precond(this->_vec_z.at(i), this->_vec_v.at(i), filter))
+            {
+              stat.destroy();
+              Statistics::add_solver_expression(ExpressionEndSolve(this->expression_name(), Status::aborted, this->get_num_iter()));
+              return Status::aborted;
+            }
+
+            // v[i+1] := A*z[i]
+            matrix.apply(this->_vec_v.at(i+1), this->_vec_z.at(i));
+            filter.filter_def(this->_vec_v.at(i+1));
+
+            // deflation: v[i+1] := (I - C*C^T) * v[i+1]
+            for(std::size_t j(0); j < num_rec; ++j)
+            {
+              this->_b.at(i).at(j) = this->_vec_c.at(j).dot(this->_vec_v.at(i+1));
+              this->_vec_v.at(i+1).axpy(this->_vec_c.at(j), this->_vec_v.at(i+1), -this->_b.at(i).at(j));
+            }
+
+            // Gram-Schmidt process
+            for(Index k(0); k <= i; ++k)
+            {
+              this->_h.at(i).at(k) = this->_vec_v.at(i+1).dot(this->_vec_v.at(k));
+              this->_vec_v.at(i+1).axpy(this->_vec_v.at(k), this->_vec_v.at(i+1), -this->_h.at(i).at(k));
+            }
+
+            // normalise v[i+1]
+            DataType alpha = this->_vec_v.at(i+1).norm2();
+            this->_vec_v.at(i+1).scale(this->_vec_v.at(i+1), DataType(1) / alpha);
+
+            // apply Givens rotations
+            for(Index k(0); k < i; ++k)
+            {
+              DataType t(this->_h.at(i).at(k));
+              this->_h.at(i).at(k  ) = this->_c.at(k) * t + this->_s.at(k) * this->_h.at(i).at(k+1);
+              this->_h.at(i).at(k+1) = this->_s.at(k) * t - this->_c.at(k) * this->_h.at(i).at(k+1);
+            }
+
+            // compute beta
+            DataType beta = Math::sqrt(Math::sqr(this->_h.at(i).at(i)) + Math::sqr(alpha));
+
+            // compute next plane rotation
+            _s.push_back(alpha / beta);
+            _c.push_back(this->_h.at(i).at(i) / beta);
+
+            this->_h.at(i).at(i) = beta;
+            this->_q.push_back(this->_s.back() * this->_q.at(i));
+            this->_q.at(i) *= this->_c.back();
+
+            // push our new defect
+            if(++i < this->_krylov_dim)
+            {
+              // get the absolute defect
+              DataType def_cur = Math::abs(this->_q.back());
+
+              // did we diverge?
+              if((def_cur > this->_div_abs) || (def_cur > (this->_div_rel * this->_def_init)))
+                break;
+
+              // minimum number of iterations performed?
+              if(!(this->_num_iter < this->_min_iter))
+              {
+                // did we converge?
+                if((def_cur <= _inner_res_scale * this->_tol_abs) &&
+                  ((def_cur <= _inner_res_scale * (this->_tol_rel * this->_def_init)) || (def_cur <= _inner_res_scale * this->_tol_abs_low) ))
+                  break;
+
+                // maximum number of iterations performed?
+                if(this->_num_iter >= this->_max_iter)
+                  break;
+              }
+
+              // increase iteration count
+              ++this->_num_iter;
+
+              // compute new defect
+              this->_def_cur = def_cur;
+
+              // plot?
+              if(this->_plot_iter())
+              {
+                String msg = this->_plot_name
+                  +  "* " + stringify(this->_num_iter).pad_front(this->_iter_digits)
+                  + " : " + stringify_fp_sci(this->_def_cur);
+                this->_print_line(msg);
+              }
+            }
+          }
+
+          Index n = Math::min(i, this->_krylov_dim);
+
+          // solve H*q = q
+          for(Index k(n); k > 0;)
+          {
+            --k;
+            this->_q.at(k) /= this->_h.at(k).at(k);
+            for(Index j(k); j > 0;)
+            {
+              --j;
+              this->_q.at(j) -= this->_h.at(k).at(j) * this->_q.at(k);
+            }
+          }
+
+          // update solution: x := x + Z*q - U*B*q
+          for(Index k(0); k < n; ++k)
+            vec_sol.axpy(this->_vec_z.at(k), vec_sol, this->_q.at(k));
+          for(std::size_t j(0); j < num_rec; ++j)
+          {
+            DataType gamma(0);
+            for(Index k(0); k < n; ++k)
+              gamma += this->_b.at(k).at(j) * this->_q.at(k);
+            vec_sol.axpy(this->_vec_u.at(j), vec_sol, -gamma);
+          }
+
+          // compute "real" residual
+          matrix.apply(this->_vec_v.at(0), vec_sol, vec_rhs, -DataType(1));
+          filter.filter_def(this->_vec_v.at(0));
+
+          // set the current defect
+          status = this->_set_new_defect(this->_vec_v.at(0), vec_sol);
+        }
+
+        // update recycled subspace
+        if((status == Status::success) || (status == Status::max_iter))
+          this->_update_recycle_space(vec_sol);
+
+        // finished
+        Statistics::add_solver_expression(ExpressionEndSolve(this->expression_name(), status, this->get_num_iter()));
+        return status;
+      }
+    }; // class DFGMRES<...>
+
+    /**
+     * \brief Creates a new DFGMRES solver object
+     *
+     * \param[in] matrix
+     * The system matrix.
+     *
+     * \param[in] filter
+     * The system filter.
+     *
+     * \param[in] krylov_dim
+     * The maximum Krylov subspace dimension. Must be > 0.
+     *
+     * \param[in] recycle_dim
+     * The maximum dimension of the recycled subspace.
+     *
+     * \param[in] inner_res_scale
+     * The scaling factor for the inner GMRES loop residual.
+     * Set this to zero unless you know what you are doing.
+     *
+     * \param[in] precond
+     * The preconditioner. May be \c nullptr.
+     *
+     * \returns
+     * A shared pointer to a new DFGMRES object.
+     */
+     /// \compilerhack GCC < 4.9 fails to deduct shared_ptr
+#if defined(FEAT_COMPILER_GNU) && (FEAT_COMPILER_GNU < 40900)
+    template<typename Matrix_, typename Filter_>
+    inline std::shared_ptr<DFGMRES<Matrix_, Filter_>> new_dfgmres(
+      const Matrix_& matrix, const Filter_& filter, Index krylov_dim, Index recycle_dim,
+      typename Matrix_::DataType inner_res_scale = typename Matrix_::DataType(0))
+    {
+      return std::make_shared<DFGMRES<Matrix_, Filter_>>(matrix, filter, krylov_dim, recycle_dim, inner_res_scale);
+    }
+    template<typename Matrix_, typename Filter_, typename Precond_>
+    inline std::shared_ptr<DFGMRES<Matrix_, Filter_>> new_dfgmres(
+      const Matrix_& matrix, const Filter_& filter, Index krylov_dim, Index recycle_dim,
+      typename Matrix_::DataType inner_res_scale,
+      std::shared_ptr<Precond_> precond)
+    {
+      return std::make_shared<DFGMRES<Matrix_, Filter_>>(matrix, filter, krylov_dim, recycle_dim, inner_res_scale, precond);
+    }
+#else
+    template<typename Matrix_, typename Filter_>
+    inline std::shared_ptr<DFGMRES<Matrix_, Filter_>> new_dfgmres(
+      const Matrix_& matrix, const Filter_& filter, Index krylov_dim, Index recycle_dim,
+      typename Matrix_::DataType inner_res_scale = typename Matrix_::DataType(0),
+      std::shared_ptr<SolverBase<typename Matrix_::VectorTypeL>> precond = nullptr)
+    {
+      return std::make_shared<DFGMRES<Matrix_, Filter_>>(matrix, filter, krylov_dim, recycle_dim, inner_res_scale, precond);
+    }
+#endif
+
+    /**
+     * \brief Creates a new DFGMRES solver object using a PropertyMap
+     *
+     * \param[in] section_name
+     * The name of the config section, which it does not know by itself
+     *
+     * \param[in] section
+     * A pointer to the PropertyMap section configuring this solver
+     *
+     * \param[in] matrix
+     * The system matrix.
+     *
+     * \param[in] filter
+     * The system filter.
+     *
+     * \param[in] precond
+     * The preconditioner. May be \c nullptr.
+     *
+     * \returns
+     * A shared pointer to a new DFGMRES object.
+     */
+     /// \compilerhack GCC < 4.9 fails to deduct shared_ptr
+#if defined(FEAT_COMPILER_GNU) && (FEAT_COMPILER_GNU < 40900)
+    template<typename Matrix_, typename Filter_>
+    inline std::shared_ptr<DFGMRES<Matrix_, Filter_>> new_dfgmres(
+      const String& section_name, PropertyMap* section,
+      const Matrix_& matrix, const Filter_& filter)
+    {
+      return std::make_shared<DFGMRES<Matrix_, Filter_>>(section_name, section, matrix, filter);
+    }
+
+    template<typename Matrix_, typename Filter_, typename Precond_>
+    inline std::shared_ptr<DFGMRES<Matrix_, Filter_>> new_dfgmres(
+      const String& section_name, PropertyMap* section,
+      const Matrix_& matrix, const Filter_& filter, std::shared_ptr<Precond_> precond)
+    {
+      return std::make_shared<DFGMRES<Matrix_, Filter_>>(section_name, section, matrix, filter, precond);
+    }
+#else
+    template<typename Matrix_, typename Filter_>
+    inline std::shared_ptr<DFGMRES<Matrix_, Filter_>> new_dfgmres(
+      const String& section_name, PropertyMap* section,
+      const Matrix_& matrix, const Filter_& filter,
+      std::shared_ptr<SolverBase<typename Matrix_::VectorTypeL>> precond = nullptr)
+    {
+      return std::make_shared<DFGMRES<Matrix_, Filter_>>(section_name, section, matrix, filter, precond);
+    }
+#endif
+  } // namespace Solver
+} // namespace FEAT
+
+#endif // KERNEL_SOLVER_DFGMRES_HPP
@@ -0,0 +1,550 @@
+// FEAT3: Finite Element Analysis Toolbox, Version 3
+// Copyright (C) 2010 - 2020 by Stefan Turek & the FEAT group
+// FEAT3 is released under the GNU General Public License version 3,
+// see the file 'copyright.txt' in the top level directory for details.
+
+#pragma once
+#ifndef KERNEL_SOLVER_DPCG_HPP
+#define KERNEL_SOLVER_DPCG_HPP 1
+
+// includes, FEAT
+#include <kernel/solver/iterative.hpp>
+
+// includes, system
+#include <deque>
+
+namespace FEAT
+{
+  namespace Solver
+  {
+    /**
+     * \brief Deflated (Preconditioned) Conjugate-Gradient solver with subspace recycling
+     *
+     * This class implements a deflated PCG solver, which carries a recycled subspace \f$W\f$ from one
+     * call of apply() or correct() to the next one. The recycled space is kept A-orthonormal, i.e.
+     * \f$W^\top AW = I\f$, and is stored along with its image \f$AW\f$. Each solve starts with a Galerkin
+     * projection of the initial defect onto \f$W\f$ and keeps the search directions A-orthogonal to
+     * \f$W\f$, which removes the corresponding components from the spectrum seen by the iteration.
+     *
+     * After each successful solve, the total correction computed by the CG iteration is appended to
+     * the recycled space, replacing the oldest vector if the space is full. For slowly varying sequences
+     * of symmetric positive definite systems this usually reduces the number of iterations considerably.
+     *
+     * \note
+     * If the system matrix changes, init_numeric() has to be called, which recomputes the image
+     * \f$AW\f$ of the recycled space by one matrix-vector product per recycled vector.
+     *
+     * \see
+     * Y. Saad, M. Yeung, J. Erhel, F. Guyomarc'h: A deflated version of the conjugate gradient algorithm;
+     * SIAM Journal on Scientific Computing, Volume 21 Issue 5, pp. 1909-1926, 2000
+     *
+     * \tparam Matrix_
+     * The matrix class to be used by the solver.
+     *
+     * \tparam Filter_
+     * The filter class to be used by the solver.
+     */
+    template<typename Matrix_, typename Filter_>
+    class DPCG :
+      public PreconditionedIterativeSolver<typename Matrix_::VectorTypeR>
+    {
+    public:
+      /// The type of matrix this solver can be applied to
+      typedef Matrix_ MatrixType;
+      /// The filter for projecting solution, rhs, defect and correction vectors to subspaces
+      typedef Filter_ FilterType;
+      /// The vector type this solver can be applied to
+      typedef typename MatrixType::VectorTypeR VectorType;
+      /// The floating point precision
+      typedef typename MatrixType::DataType DataType;
+      /// Our base class
+      typedef PreconditionedIterativeSolver<VectorType> BaseClass;
+      /// The type of the preconditioner that can be used
+      typedef SolverBase<VectorType> PrecondType;
+
+    protected:
+      /// the matrix for the solver
+      const MatrixType& _system_matrix;
+      /// the filter for the solver
+      const FilterType& _system_filter;
+      /// maximum dimension of the recycled subspace
+      Index _recycle_dim;
+      /// The defect vector
+      VectorType _vec_r;
+      /// The update (or search) direction
+      VectorType _vec_p;
+      /// Temporary vector, used for e.g. the preconditioned defect
+      VectorType _vec_t;
+      /// solution vector after projection onto the recycled subspace
+      VectorType _vec_x0;
+      /// recycled subspace W and its image A*W
+      std::deque<VectorType> _vec_w, _vec_aw;
+
+    public:
+      /**
+       * \brief Constructor
+       *
+       * \param[in] matrix
+       * A reference to the system matrix.
+       *
+       * \param[in] filter
+       * A reference to the system filter.
+       *
+       * \param[in] recycle_dim
+       * The maximum dimension of the recycled subspace. May be 0, which results in plain PCG.
+       *
+       * \param[in] precond
+       * A pointer to the preconditioner. May be \c nullptr.
+       */
+      explicit DPCG(const MatrixType& matrix, const FilterType& filter, Index recycle_dim,
+        std::shared_ptr<PrecondType> precond = nullptr) :
+        BaseClass("DPCG", precond),
+        _system_matrix(matrix),
+        _system_filter(filter),
+        _recycle_dim(recycle_dim)
+      {
+        // set communicator by system matrix
+        this->_set_comm_by_matrix(matrix);
+      }
+
+      /**
+       * \brief Constructor using a PropertyMap
+       *
+       * \param[in] section_name
+       * The name of the config section, which it does not know by itself
+       *
+       * \param[in] section
+       * A pointer to the PropertyMap section configuring this solver
+       *
+       * \param[in] matrix
+       * The system matrix.
+       *
+       * \param[in] filter
+       * The system filter.
+       *
+       * \param[in] precond
+       * The preconditioner. May be \c nullptr.
+       */
+      explicit DPCG(const String& section_name, PropertyMap* section,
+        const MatrixType& matrix, const FilterType& filter, std::shared_ptr<PrecondType> precond = nullptr) :
+        BaseClass("DPCG", section_name, section, precond),
+        _system_matrix(matrix),
+        _system_filter(filter),
+        _recycle_dim(4)
+      {
+        // set communicator by system matrix
+        this->_set_comm_by_matrix(matrix);
+
+        // Set _recycle_dim by parameter or use default value
+        auto recycle_dim_p = section->query("recycle_dim");
+        if(recycle_dim_p.second && !recycle_dim_p.first.parse(this->_recycle_dim))
+          throw ParseError(section_name + ".recycle_dim", recycle_dim_p.first, "a non-negative integer");
+      }
+
+      /// \copydoc SolverBase::name()
+      virtual String name() const override
+      {
+        return "DPCG";
+      }
+
+      /// \copydoc SolverBase::init_symbolic()
+      virtual void init_symbolic() override
+      {
+        BaseClass::init_symbolic();
+        // create four temporary vectors
+        _vec_r = this->_system_matrix.create_vector_r();
+        _vec_p = this->_system_matrix.create_vector_r();
+        _vec_t = this->_system_matrix.create_vector_r();
+        _vec_x0 = this->_system_matrix.create_vector_r();
+      }
+
+      /// \copydoc SolverBase::done_symbolic()
+      virtual void done_symbolic() override
+      {
+        this->clear_recycle_space();
+        this->_vec_x0.clear();
+        this->_vec_t.clear();
+        this->_vec_p.clear();
+        this->_vec_r.clear();
+        BaseClass::done_symbolic();
+      }
+
+      /**
+       * \brief Numeric initialisation
+       *
+       * Recomputes the image \f$AW\f$ of the recycled subspace for the (possibly changed) system matrix.
+       */
+      virtual void init_numeric() override
+      {
+        BaseClass::init_numeric();
+
+        // recompute AW and A-orthonormalise W
+        std::deque<VectorType> vec_w, vec_aw;
+        vec_w.swap(_vec_w);
+        vec_aw.swap(_vec_aw);
+        for(std::size_t i(0); i < vec_w.size(); ++i)
+        {
+          this->_system_matrix.apply(vec_aw.at(i), vec_w.at(i));
+          this->_system_filter.filter_def(vec_aw.at(i));
+          _append_recycle_vector(std::move(vec_w.at(i)), std::move(vec_aw.at(i)));
+        }
+      }
+
+      /**
+       * \brief Sets the maximum dimension of the recycled subspace
+       *
+       * \param[in] recycle_dim
+       * The maximum number of recycled vectors. May be 0.
+       */
+      void set_recycle_dim(Index recycle_dim)
+      {
+        _recycle_dim = recycle_dim;
+        while(Index(_vec_w.size()) > _recycle_dim)
+        {
+          _vec_w.pop_front();
+          _vec_aw.pop_front();
+        }
+      }
+
+      /// \returns The current dimension of the recycled subspace.
+      Index get_num_recycled() const
+      {
+        return Index(_vec_w.size());
+      }
+
+      /// Discards the recycled subspace.
+      void clear_recycle_space()
+      {
+        _vec_w.clear();
+        _vec_aw.clear();
+      }
+
+      /// \copydoc SolverBase::apply()
+      virtual Status apply(VectorType& vec_cor, const VectorType& vec_def) override
+      {
+        // save defect
+        this->_vec_r.copy(vec_def);
+
+        // clear solution vector
+        vec_cor.format();
+
+        // apply solver
+        this->_status = _apply_intern(vec_cor);
+
+        // plot summary
+        this->plot_summary();
+
+        // return status
+        return this->_status;
+      }
+
+      /// \copydoc IterativeSolver::correct()
+      virtual Status correct(VectorType& vec_sol, const VectorType& vec_rhs) override
+      {
+        // compute defect
+        this->_system_matrix.apply(this->_vec_r, vec_sol, vec_rhs, -DataType(1));
+        this->_system_filter.filter_def(this->_vec_r);
+
+        // apply solver
+        this->_status = _apply_intern(vec_sol);
+
+        // plot summary
+        this->plot_summary();
+
+        // return status
+        return this->_status;
+      }
+
+    protected:
+      /**
+       * \brief Appends a vector to the recycled subspace
+       *
+       * The vector is A-orthonormalised against the current subspace. If it is (numerically)
+       * contained in the current subspace, it is discarded.
+       *
+       * \param[in] vec_w
+       * The new subspace vector.
+       *
+       * \param[in] vec_aw
+       * The image of the new subspace vector under the system matrix.
+       */
+      void _append_recycle_vector(VectorType&& vec_w, VectorType&& vec_aw)
+      {
+        const DataType norm_0 = vec_w.dot(vec_aw);
+        for(std::size_t j(0); j < _vec_w.size(); ++j)
+        {
+          const DataType gamma = _vec_aw.at(j).dot(vec_w);
+          vec_w.axpy(_vec_w.at(j), vec_w, -gamma);
+          vec_aw.axpy(_vec_aw.at(j), vec_aw, -gamma);
+        }
+        const DataType norm_1 = vec_w.dot(vec_aw);
+        if(!(norm_1 > Math::eps<DataType>() * norm_0))
+          return;
+        const DataType scale = DataType(1) / Math::sqrt(norm_1);
+        vec_w.scale(vec_w, scale);
+        vec_aw.scale(vec_aw, scale);
+        _vec_w.push_back(std::move(vec_w));
+        _vec_aw.push_back(std::move(vec_aw));
+      }
+
+      /**
+       * \brief Updates the recycled subspace by the correction of the last solve
+       *
+       * \param[in] vec_sol
+       * The final solution vector of the last solve.
+       */
+      void _update_recycle_space(const VectorType& vec_sol)
+      {
+        if(_recycle_dim <= Index(0))
+          return;
+
+        VectorType vec_w(_vec_x0.clone(LAFEM::CloneMode::Layout));
+        VectorType vec_aw(_vec_x0.clone(LAFEM::CloneMode::Layout));
+
+        // w := x - x0, aw := A*w
+        vec_w.axpy(_vec_x0, vec_sol, -DataType(1));
+        this->_system_matrix.apply(vec_aw, vec_w);
+        this->_system_filter.filter_def(vec_aw);
+        _append_recycle_vector(std::move(vec_w), std::move(vec_aw));
+
+        // drop the oldest vectors if the space is full
+        while(Index(_vec_w.size()) > _recycle_dim)
+        {
+          _vec_w.pop_front();
+          _vec_aw.pop_front();
+        }
+      }
+
+      /**
+       * \brief Deflates a search direction
+       *
+       * Computes p := p - W*(AW)^T*z
+       */
+      void _deflate_direction(VectorType& vec_p, const VectorType& vec_z)
+      {
+        for(std::size_t j(0); j < _vec_w.size(); ++j)
+          vec_p.axpy(_vec_w.at(j), vec_p, -_vec_aw.at(j).dot(vec_z));
+      }
+
+      /**
+       * \brief Internal function, applies the solver
+       *
+       * \param[in] vec_sol
+       * The current solution vector, gets overwritten
+       *
+       * \returns A status code.
+       */
+      virtual Status _apply_intern(VectorType& vec_sol)
+      {
+        IterationStats pre_iter(*this);
+        Statistics::add_solver_expression(ExpressionStartSolve(this->expression_name()));
+
+        const MatrixType& matrix(this->_system_matrix);
+        const FilterType& filter(this->_system_filter);
+        VectorType& vec_r(this->_vec_r);
+        VectorType& vec_p(this->_vec_p);
+        // Note: q and z are temporary vectors whose usage does
+        // not overlap, so we use the same vector for them
+        VectorType& vec_q(this->_vec_t);
+        VectorType& vec_z(this->_vec_t);
+
+        // set initial defect:
+        // r[0] := b - A*x[0]
+        Status status = this->_set_initial_defect(vec_r, vec_sol);
+
+        // project initial defect onto recycled subspace:
+        // x[0] := x[0] + W*W^T*r[0], r[0] := r[0] - AW*W^T*r[0]
+        if((status == Status::progress) && !_vec_w.empty())
+        {
+          for(std::size_t j(0); j < _vec_w.size(); ++j)
+          {
+            const DataType mu = _vec_w.at(j).dot(vec_r);
+            vec_sol.axpy(_vec_w.at(j), vec_sol, mu);
+            vec_r.axpy(_vec_aw.at(j), vec_r, -mu);
+          }
+          status = this->_set_new_defect(vec_r, vec_sol);
+        }
+
+        // save projected solution for the recycling update
+        this->_vec_x0.copy(vec_sol);
+
+        if(status != Status::progress)
+        {
+          pre_iter.destroy();
+          Statistics::add_solver_expression(ExpressionEndSolve(this->expression_name(), status, this->get_num_iter()));
+          return status;
+        }
+
+        // apply preconditioner to defect vector
+        // z[0] := M^{-1} * r[0]
+        if(!this->_apply_precond(vec_z, vec_r, filter))
+        {
+          pre_iter.destroy();
+          Statistics::add_solver_expression(ExpressionEndSolve(this->expression_name(), Status::aborted, this->get_num_iter()));
+          return Status::aborted;
+        }
+
+        // compute initial gamma:
+        // gamma[0] := < r[0], z[0] >
+        DataType gamma = vec_r.dot(vec_z);
+
+        // p[0] := z[0] - W*(AW)^T*z[0]
+        vec_p.copy(vec_z);
+        this->_deflate_direction(vec_p, vec_z);
+
+        pre_iter.destroy();
+
+        // start iterating
+        while(status == Status::progress)
+        {
+          IterationStats stat(*this);
+
+          // q[k] := A*p[k]
+          matrix.apply(vec_q, vec_p);
+          filter.filter_def(vec_q);
+
+          // compute alpha
+          // alpha[k] := gamma[k] / < q[k], p[k] >
+          DataType alpha = gamma / vec_q.dot(vec_p);
+
+          // update solution vector:
+          // x[k+1] := x[k] + alpha[k] * p[k]
+          vec_sol.axpy(vec_p, vec_sol, alpha);
+
+          // update defect vector:
+          // r[k+1] := r[k] - alpha[k] * q[k]
+          vec_r.axpy(vec_q, vec_r, -alpha);
+
+          // compute defect norm
+          status = this->_set_new_defect(vec_r, vec_sol);
+          if(status != Status::progress)
+            break;
+
+          // apply preconditioner
+          // z[k+1] := M^{-1} * r[k+1]
+          if(!this->_apply_precond(vec_z, vec_r, filter))
+          {
+            stat.destroy();
+            Statistics::add_solver_expression(ExpressionEndSolve(this->expression_name(), Status::aborted, this->get_num_iter()));
+            return Status::aborted;
+          }
+
+          // compute new gamma:
+          // gamma[k+1] := < r[k+1] , z[k+1] >
+          DataType gamma2 = gamma;
+          gamma = vec_r.dot(vec_z);
+
+          // compute beta:
+          // beta[k] := gamma[k+1] / gamma[k]
+          DataType beta = gamma / gamma2;
+
+          // update direction vector:
+          // p[k+1] := z[k+1] + beta[k] * p[k] - W*(AW)^T*z[k+1]
+          vec_p.axpy(vec_p, vec_z, beta);
+          this->_deflate_direction(vec_p, vec_z);
+        }
+
+        // update recycled subspace
+        if((status == Status::success) || (status == Status::max_iter))
+          this->_update_recycle_space(vec_sol);
+
+        Statistics::add_solver_expression(ExpressionEndSolve(this->expression_name(), status, this->get_num_iter()));
+        return status;
+      }
+    }; // class DPCG<...>
+
+    /**
+     * \brief Creates a new DPCG solver object
+     *
+     * \param[in] matrix
+     * The system matrix.
+     *
+     * \param[in] filter
+     * The system filter.
+     *
+     * \param[in] recycle_dim
+     * The maximum dimension of the recycled subspace.
+     *
+     * \param[in] precond
+     * The preconditioner. May be \c nullptr.
+     *
+     * \returns
+     * A shared pointer to a new DPCG object.
+     */
+     /// \compilerhack GCC < 4.9 fails to deduct shared_ptr
+#if defined(FEAT_COMPILER_GNU) && (FEAT_COMPILER_GNU < 40900)
+    template<typename Matrix_, typename Filter_>
+    inline std::shared_ptr<DPCG<Matrix_, Filter_>> new_dpcg(
+      const Matrix_& matrix, const Filter_& filter, Index recycle_dim)
+    {
+      return std::make_shared<DPCG<Matrix_, Filter_>>(matrix, filter, recycle_dim, nullptr);
+    }
+    template<typename Matrix_, typename Filter_, typename Precond_>
+    inline std::shared_ptr<DPCG<Matrix_, Filter_>> new_dpcg(
+      const Matrix_& matrix, const Filter_& filter, Index recycle_dim,
+      std::shared_ptr<Precond_> precond)
+    {
+      return std::make_shared<DPCG<Matrix_, Filter_>>(matrix, filter, recycle_dim, precond);
+    }
+#else
+    template<typename Matrix_, typename Filter_>
+    inline std::shared_ptr<DPCG<Matrix_, Filter_>> new_dpcg(
+      const Matrix_& matrix, const Filter_& filter, Index recycle_dim,
+      std::shared_ptr<SolverBase<typename Matrix_::VectorTypeL>> precond = nullptr)
+    {
+      return std::make_shared<DPCG<Matrix_, Filter_>>(matrix, filter, recycle_dim, precond);
+    }
+#endif
+
+    /**
+     * \brief Creates a new DPCG solver object using a PropertyMap
+     *
+     * \param[in] section_name
+     * The name of the config section, which it does not know by itself
+     *
+     * \param[in] section
+     * A pointer to the PropertyMap section configuring this solver
+     *
+     * \param[in] matrix
+     * The system matrix.
+     *
+     * \param[in] filter
+     * The system filter.
+     *
+     * \param[in] precond
+     * The preconditioner. May be \c nullptr.
+     *
+     * \returns
+     * A shared pointer to a new DPCG object.
+     */
+     /// \compilerhack GCC < 4.9 fails to deduct shared_ptr
+#if defined(FEAT_COMPILER_GNU) && (FEAT_COMPILER_GNU < 40900)
+    template<typename Matrix_, typename Filter_>
+    inline std::shared_ptr<DPCG<Matrix_, Filter_>> new_dpcg(
+      const String& section_name, PropertyMap* section,
+      const Matrix_& matrix, const Filter_& filter)
+    {
+      return std::make_shared<DPCG<Matrix_, Filter_>>(section_name, section, matrix, filter, nullptr);
+    }
+    template<typename Matrix_, typename Filter_, typename Precond_>
+    inline std::shared_ptr<DPCG<Matrix_, Filter_>> new_dpcg(
+      const String& section_name, PropertyMap* section,
+      const Matrix_& matrix, const Filter_& filter,
+      std::shared_ptr<Precond_> precond)
+    {
+      return std::make_shared<DPCG<Matrix_, Filter_>>(section_name, section, matrix, filter, precond);
+    }
+#else
+    template<typename Matrix_, typename Filter_>
+    inline std::shared_ptr<DPCG<Matrix_, Filter_>> new_dpcg(
+      const String& section_name, PropertyMap* section,
+      const Matrix_& matrix, const Filter_& filter,
+      std::shared_ptr<SolverBase<typename Matrix_::VectorTypeL>> precond = nullptr)
+    {
+      return std::make_shared<DPCG<Matrix_, Filter_>>(section_name, section, matrix, filter, precond);
+    }
+#endif
+  } // namespace Solver
+} // namespace FEAT
+
+#endif // KERNEL_SOLVER_DPCG_HPP
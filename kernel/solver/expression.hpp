@@ -12,6 +12,10 @@
 #include <kernel/util/exception.hpp>
 #include <kernel/util/string.hpp>
 
+// includes, system
+#include <cstdint>
+#include <type_traits>
+
 namespace FEAT
 {
   namespace Solver
@@ -91,12 +95,94 @@ namespace FEAT
     }
     /// \endcond
 
+    /**
+     * \brief Compact solver expression event
+     *
+     * This POD structure is the compact representation of a solver expression, which is stored
+     * by the Statistics class in its preallocated event ring buffer. All names are replaced by
+     * the ids that the Statistics class has assigned to them, see Statistics::get_expression_name().
+     *
+     * The meaning of the #other, #index and #values members depends on the type of the expression:
+     * - end_solve: \c other = status, \c index = iteration count
+     * - call_*: \c other = id of the called solver name
+     * - defect: \c index = iteration, \c values[0] = defect norm
+     * - timings: \c values[0..8] = solver toe and mpi execute/wait times
+     * - level_timings: \c index = level, \c values[0..8] = level toe and mpi execute/wait times
+     * - prol, rest: \c index = level
+     *
+     * \note The layout of this structure is also the record layout of the binary trace files
+     * written by Statistics::write_expression_trace().
+     */
+    struct ExpressionEvent
+    {
+      /// time stamp in seconds since the initialisation of the statistics
+      double stamp;
+      /// event-specific values
+      double values[9];
+      /// id of the expression target
+      std::uint32_t target;
+      /// id of the solver name
+      std::uint32_t solver;
+      /// event-specific id or status
+      std::uint32_t other;
+      /// event-specific index
+      std::uint32_t index;
+      /// the expression type
+      std::int32_t type;
+      /// padding
+      std::int32_t pad;
+    };
+
+    static_assert(std::is_pod<ExpressionEvent>::value, "ExpressionEvent must be a POD");
+    static_assert(sizeof(ExpressionEvent) == std::size_t(104), "invalid ExpressionEvent size");
+
+    /**
+     * \brief Solver name of a solver expression
+     *
+     * Solvers pass their name as the id, which Statistics::intern_expression_name() has assigned
+     * to it, see SolverBase::expression_name(); the id is cached by the solver, so that creating
+     * an expression neither copies a string nor looks up the name. Names given as strings are
+     * interned by Statistics::add_solver_expression().
+     */
+    class ExpressionName
+    {
+      public:
+        /// id of a name which has not been interned yet
+        static constexpr std::uint32_t no_id = ~std::uint32_t(0);
+
+        /// the interned id of the name or #no_id
+        std::uint32_t id;
+        /// the name, if it has not been interned yet
+        String name;
+
+        /// creates a name from an interned id
+        explicit ExpressionName(std::uint32_t id_in) :
+          id(id_in),
+          name()
+        {
+        }
+
+        /// creates a name, which is interned by Statistics::add_solver_expression()
+        ExpressionName(const String& name_in) :
+          id(no_id),
+          name(name_in)
+        {
+        }
+
+        /// creates a name, which is interned by Statistics::add_solver_expression()
+        ExpressionName(const char* name_in) :
+          id(no_id),
+          name(name_in)
+        {
+        }
+    };
+
     class ExpressionBase
     {
       public:
-        String solver_name;
+        ExpressionName solver_name;
 
-        explicit ExpressionBase(String name) :
+        explicit ExpressionBase(ExpressionName name) :
           solver_name(name)
         {
         }
@@ -105,13 +191,13 @@ namespace FEAT
         {
         }
 
-        virtual ExpressionType get_type() = 0;
+        virtual ExpressionType get_type() const = 0;
     };
 
     class ExpressionStartSolve : public ExpressionBase
     {
       public:
-        explicit ExpressionStartSolve(String name) :
+        explicit ExpressionStartSolve(ExpressionName name) :
           ExpressionBase(name)
         {
         }
@@ -120,7 +206,7 @@ namespace FEAT
         {
         }
 
-        virtual ExpressionType get_type() override
+        virtual ExpressionType get_type() const override
         {
           return ExpressionType::start_solve;
         }
@@ -134,7 +220,7 @@ namespace FEAT
         /// the iteration count needed in this solve process
         Index iters;
 
-        explicit ExpressionEndSolve(String name, Status end_status, Index iterations) :
+        explicit ExpressionEndSolve(ExpressionName name, Status end_status, Index iterations) :
           ExpressionBase(name),
           status(end_status),
           iters(iterations)
@@ -144,7 +230,7 @@ namespace FEAT
         {
         }
 
-        virtual ExpressionType get_type() override
+        virtual ExpressionType get_type() const override
         {
           return ExpressionType::end_solve;
         }
@@ -153,9 +239,9 @@ namespace FEAT
     class ExpressionCallPrecond : public ExpressionBase
     {
       public:
-        String precond_name;
+        ExpressionName precond_name;
 
-        explicit ExpressionCallPrecond(String name, String precond_name_in) :
+        explicit ExpressionCallPrecond(ExpressionName name, ExpressionName precond_name_in) :
           ExpressionBase(name),
           precond_name(precond_name_in)
         {
@@ -165,7 +251,7 @@ namespace FEAT
         {
         }
 
-        virtual ExpressionType get_type() override
+        virtual ExpressionType get_type() const override
         {
           return ExpressionType::call_precond;
         }
@@ -174,9 +260,9 @@ namespace FEAT
     class ExpressionCallPrecondL : public ExpressionBase
     {
       public:
-        String precond_name;
+        ExpressionName precond_name;
 
-        explicit ExpressionCallPrecondL(String name, String precond_name_in) :
+        explicit ExpressionCallPrecondL(ExpressionName name, ExpressionName precond_name_in) :
           ExpressionBase(name),
           precond_name(precond_name_in)
         {
@@ -186,7 +272,7 @@ namespace FEAT
         {
         }
 
-        virtual ExpressionType get_type() override
+        virtual ExpressionType get_type() const override
         {
           return ExpressionType::call_precond_l;
         }
@@ -195,9 +281,9 @@ namespace FEAT
     class ExpressionCallPrecondR : public ExpressionBase
     {
       public:
-        String precond_name;
+        ExpressionName precond_name;
 
-        explicit ExpressionCallPrecondR(String name, String precond_name_in) :
+        explicit ExpressionCallPrecondR(ExpressionName name, ExpressionName precond_name_in) :
           ExpressionBase(name),
           precond_name(precond_name_in)
         {
@@ -207,7 +293,7 @@ namespace FEAT
         {
         }
 
-        virtual ExpressionType get_type() override
+        virtual ExpressionType get_type() const override
         {
           return ExpressionType::call_precond_r;
         }
@@ -216,9 +302,9 @@ namespace FEAT
     class ExpressionCallSmoother : public ExpressionBase
     {
       public:
-        String smoother_name;
+        ExpressionName smoother_name;
 
-        explicit ExpressionCallSmoother(String name, String smoother_name_in) :
+        explicit ExpressionCallSmoother(ExpressionName name, ExpressionName smoother_name_in) :
           ExpressionBase(name),
           smoother_name(smoother_name_in)
         {
@@ -228,7 +314,7 @@ namespace FEAT
         {
         }
 
-        virtual ExpressionType get_type() override
+        virtual ExpressionType get_type() const override
         {
           return ExpressionType::call_smoother;
         }
@@ -237,9 +323,9 @@ namespace FEAT
     class ExpressionCallCoarseSolver : public ExpressionBase
     {
       public:
-        String coarse_solver_name;
+        ExpressionName coarse_solver_name;
 
-        explicit ExpressionCallCoarseSolver(String name, String coarse_solver_name_in) :
+        explicit ExpressionCallCoarseSolver(ExpressionName name, ExpressionName coarse_solver_name_in) :
           ExpressionBase(name),
           coarse_solver_name(coarse_solver_name_in)
         {
@@ -249,7 +335,7 @@ namespace FEAT
         {
         }
 
-        virtual ExpressionType get_type() override
+        virtual ExpressionType get_type() const override
         {
           return ExpressionType::call_coarse_solver;
         }
@@ -260,7 +346,7 @@ namespace FEAT
       public:
         Index level;
 
-        explicit ExpressionProlongation(String name, Index level_in) :
+        explicit ExpressionProlongation(ExpressionName name, Index level_in) :
           ExpressionBase(name),
           level(level_in)
         {
@@ -270,7 +356,7 @@ namespace FEAT
         {
         }
 
-        virtual ExpressionType get_type() override
+        virtual ExpressionType get_type() const override
         {
           return ExpressionType::prol;
         }
@@ -281,7 +367,7 @@ namespace FEAT
       public:
         Index level;
 
-        explicit ExpressionRestriction(String name, Index level_in) :
+        explicit ExpressionRestriction(ExpressionName name, Index level_in) :
           ExpressionBase(name),
           level(level_in)
         {
@@ -291,7 +377,7 @@ namespace FEAT
         {
         }
 
-        virtual ExpressionType get_type() override
+        virtual ExpressionType get_type() const override
         {
           return ExpressionType::rest;
         }
@@ -303,7 +389,7 @@ namespace FEAT
         double def;
         Index iter;
 
-        explicit ExpressionDefect(String name, double defect, Index iter_in) :
+        explicit ExpressionDefect(ExpressionName name, double defect, Index iter_in) :
           ExpressionBase(name),
           def(defect),
           iter(iter_in)
@@ -314,7 +400,7 @@ namespace FEAT
         {
         }
 
-        virtual ExpressionType get_type() override
+        virtual ExpressionType get_type() const override
         {
           return ExpressionType::defect;
         }
@@ -325,7 +411,7 @@ namespace FEAT
       public:
         double solver_toe, mpi_execute_reduction, mpi_execute_blas2, mpi_execute_blas3, mpi_execute_collective, mpi_wait_reduction, mpi_wait_blas2, mpi_wait_blas3, mpi_wait_collective;
 
-        explicit ExpressionTimings(String name, double solver_toe_in, double mpi_execute_reduction_in, double mpi_execute_blas2_in, double mpi_execute_blas3_in,
+        explicit ExpressionTimings(ExpressionName name, double solver_toe_in, double mpi_execute_reduction_in, double mpi_execute_blas2_in, double mpi_execute_blas3_in,
             double mpi_execute_collective_in, double mpi_wait_reduction_in, double mpi_wait_blas2_in, double mpi_wait_blas3_in, double mpi_wait_collective_in) :
           ExpressionBase(name),
           solver_toe(solver_toe_in),
@@ -344,7 +430,7 @@ namespace FEAT
         {
         }
 
-        virtual ExpressionType get_type() override
+        virtual ExpressionType get_type() const override
         {
           return ExpressionType::timings;
         }
@@ -356,7 +442,7 @@ namespace FEAT
         Index level;
         double level_toe, mpi_execute_reduction, mpi_execute_blas2, mpi_execute_blas3, mpi_execute_collective, mpi_wait_reduction, mpi_wait_blas2, mpi_wait_blas3, mpi_wait_collective;
 
-        explicit ExpressionLevelTimings(String name, Index level_in, double level_toe_in, double mpi_execute_reduction_in, double mpi_execute_blas2_in, double mpi_execute_blas3_in,
+        explicit ExpressionLevelTimings(ExpressionName name, Index level_in, double level_toe_in, double mpi_execute_reduction_in, double mpi_execute_blas2_in, double mpi_execute_blas3_in,
             double mpi_execute_collective_in, double mpi_wait_reduction_in, double mpi_wait_blas2_in, double mpi_wait_blas3_in, double mpi_wait_collective_in) :
           ExpressionBase(name),
           level(level_in),
@@ -376,7 +462,7 @@ namespace FEAT
         {
         }
 
-        virtual ExpressionType get_type() override
+        virtual ExpressionType get_type() const override
         {
           return ExpressionType::level_timings;
         }
@@ -385,9 +471,9 @@ namespace FEAT
     class ExpressionCallUzawaS : public ExpressionBase
     {
       public:
-        String solver_s_name;
+        ExpressionName solver_s_name;
 
-        explicit ExpressionCallUzawaS(String name, String solver_s_name_in) :
+        explicit ExpressionCallUzawaS(ExpressionName name, ExpressionName solver_s_name_in) :
           ExpressionBase(name),
           solver_s_name(solver_s_name_in)
         {
@@ -397,7 +483,7 @@ namespace FEAT
         {
         }
 
-        virtual ExpressionType get_type() override
+        virtual ExpressionType get_type() const override
         {
           return ExpressionType::call_uzawa_s;
         }
@@ -406,9 +492,9 @@ namespace FEAT
     class ExpressionCallUzawaA : public ExpressionBase
     {
       public:
-        String solver_a_name;
+        ExpressionName solver_a_name;
 
-        explicit ExpressionCallUzawaA(String name, String solver_a_name_in) :
+        explicit ExpressionCallUzawaA(ExpressionName name, ExpressionName solver_a_name_in) :
           ExpressionBase(name),
           solver_a_name(solver_a_name_in)
         {
@@ -418,7 +504,7 @@ namespace FEAT
         {
         }
 
-        virtual ExpressionType get_type() override
+        virtual ExpressionType get_type() const override
         {
           return ExpressionType::call_uzawa_a;
         }
@@ -241,7 +241,7 @@ namespace FEAT
       virtual Status _apply_intern(VectorType& vec_sol, const VectorType& vec_rhs)
       {
         IterationStats pre_iter(*this);
-        Statistics::add_solver_expression(std::make_shared<ExpressionStartSolve>(this->name()));
+        Statistics::add_solver_expression(ExpressionStartSolve(this->expression_name()));
         const MatrixType& matrix(this->_system_matrix);
         const FilterType& filter(this->_system_filter);
 
@@ -271,7 +271,7 @@ namespace FEAT
             if(!this->_apply_precond(this->_vec_z.at(i), this->_vec_v.at(i), filter))
             {
               stat.destroy();
-              Statistics::add_solver_expression(std::make_shared<ExpressionEndSolve>(this->name(), Status::aborted, this->get_num_iter()));
+              Statistics::add_solver_expression(ExpressionEndSolve(this->expression_name(), Status::aborted, this->get_num_iter()));
               return Status::aborted;
             }
             //filter.filter_cor(this->_vec_z.at(i));
@@ -378,7 +378,7 @@ namespace FEAT
         }
 
         // finished
-        Statistics::add_solver_expression(std::make_shared<ExpressionEndSolve>(this->name(), status, this->get_num_iter()));
+        Statistics::add_solver_expression(ExpressionEndSolve(this->expression_name(), status, this->get_num_iter()));
         return status;
       }
     }; // class FGMRES<...>
@@ -282,7 +282,7 @@ namespace FEAT
       virtual Status _apply_intern(VectorType& vec_sol, const VectorType& DOXY(vec_rhs))
       {
         IterationStats pre_iter(*this);
-        Statistics::add_solver_expression(std::make_shared<ExpressionStartSolve>(this->name()));
+        Statistics::add_solver_expression(ExpressionStartSolve(this->expression_name()));
         const MatrixType& matrix(this->_system_matrix);
         const FilterType& filter(this->_system_filter);
 
@@ -292,7 +292,7 @@ namespace FEAT
         if(!this->_apply_precond(this->_vec_r, this->_vec_t, filter))
         {
           pre_iter.destroy();
-          Statistics::add_solver_expression(std::make_shared<ExpressionEndSolve>(this->name(), Status::aborted, this->get_num_iter()));
+          Statistics::add_solver_expression(ExpressionEndSolve(this->expression_name(), Status::aborted, this->get_num_iter()));
           return Status::aborted;
         }
         //select random vector set (shadow space)
@@ -313,7 +313,7 @@ namespace FEAT
           if(!this->_apply_precond(this->_vec_v, this->_vec_t, filter))
           {
             first_iter.destroy();
-            Statistics::add_solver_expression(std::make_shared<ExpressionEndSolve>(this->name(), Status::aborted, this->get_num_iter()));
+            Statistics::add_solver_expression(ExpressionEndSolve(this->expression_name(), Status::aborted, this->get_num_iter()));
             return Status::aborted;
           }
           om = _vec_v.dot(_vec_r) / _vec_v.dot(_vec_v);
@@ -329,7 +329,7 @@ namespace FEAT
           //check for early convergence
           if (status != Status::progress)
           {
-            Statistics::add_solver_expression(std::make_shared<ExpressionEndSolve>(this->name(), status, this->get_num_iter()));
+            Statistics::add_solver_expression(ExpressionEndSolve(this->expression_name(), status, this->get_num_iter()));
             return status;
           }
           // update k-th column of M
@@ -369,7 +369,7 @@ namespace FEAT
               if(!this->_apply_precond(this->_vec_t, this->_vec_dR.at(oldest), filter))
               {
                 stat.destroy();
-                Statistics::add_solver_expression(std::make_shared<ExpressionEndSolve>(this->name(), Status::aborted, this->get_num_iter()));
+                Statistics::add_solver_expression(ExpressionEndSolve(this->expression_name(), Status::aborted, this->get_num_iter()));
                 return Status::aborted;
               }
               om = _vec_v.dot(_vec_t) / _vec_t.dot(_vec_t);
@@ -402,7 +402,7 @@ namespace FEAT
               if(!this->_apply_precond(this->_vec_dR.at(oldest), this->_vec_t, filter))
               {
                 stat.destroy();
-                Statistics::add_solver_expression(std::make_shared<ExpressionEndSolve>(this->name(), Status::aborted, this->get_num_iter()));
+                Statistics::add_solver_expression(ExpressionEndSolve(this->expression_name(), Status::aborted, this->get_num_iter()));
                 return Status::aborted;
               }
               _vec_dR.at(oldest).scale(_vec_dR.at(oldest), DataType(-1));
@@ -428,7 +428,7 @@ namespace FEAT
 
         } //end outer loop
         // finished
-        Statistics::add_solver_expression(std::make_shared<ExpressionEndSolve>(this->name(), status, this->get_num_iter()));
+        Statistics::add_solver_expression(ExpressionEndSolve(this->expression_name(), status, this->get_num_iter()));
         return status;
       } //_apply_intern(...)
     }; // class IDRS<...>
@@ -12,6 +12,7 @@
 #include <kernel/lafem/sparse_matrix_csr.hpp>
 #include <kernel/lafem/sparse_matrix_bcsr.hpp>
 #include <kernel/lafem/sparse_matrix_ell.hpp>
+#include <kernel/lafem/sparse_matrix_dcsr.hpp>
 
 // includes, system
 #include <vector>
@@ -250,6 +251,20 @@ namespace FEAT
           this->set_struct_ell(IT_(matrix.rows()), IT_(matrix.C()), matrix.col_ind(), matrix.cs(), matrix.rl());
         }
 
+        /**
+         * \brief Initialises the ILU(0) structure from a DCSR input matrix
+         *
+         * \param[in] matrix
+         * The DCSR input matrix, whose column indices are decompressed temporarily.
+         */
+        template<typename DT_>
+        void set_struct(const LAFEM::SparseMatrixDCSR<Mem::Main, DT_, IT_>& matrix)
+        {
+          LAFEM::SparseMatrixCSR<Mem::Main, DT_, IT_> csr;
+          csr.convert(matrix);
+          this->set_struct(csr);
+        }
+
         /**
          * \brief Performs symbolic ILU(p) factorisation
          *
@@ -416,7 +431,9 @@ namespace FEAT
        * This class is responsible for the factorisation and management of an ILU(p) factorisation.
        *
        * \tparam DT_
-       * The data-type to be used.
+       * The data-type to be used for the factorisation. The input matrix and the vectors passed to
+       * the solve functions may use a different data-type, which allows to store the factors in a
+       * lower precision than the one of the surrounding solver.
        *
        * \tparam IT_
        * The index-type to be used.
@@ -433,6 +450,9 @@ namespace FEAT
         /// The data arrays of L, U and D.
         std::vector<DT_> _data_l, _data_u, _data_d;
 
+        template<typename, typename>
+        friend class ILUCoreScalar;
+
       public:
         /// Clears all data arrays.
         void clear()
@@ -476,7 +496,8 @@ namespace FEAT
          * \param[in] data_a
          * The data arrays of the CSR input matrix.
          */
-        void copy_data_csr(const IT_* row_ptr_a, const IT_* col_idx_a, const DT_* data_a)
+        template<typename DTA_>
+        void copy_data_csr(const IT_* row_ptr_a, const IT_* col_idx_a, const DTA_* data_a)
         {
           // loop over all rows
           for(IT_ i(0); i < this->_n; ++i)
@@ -489,19 +510,19 @@ namespace FEAT
             for(IT_ j(this->_row_ptr_l[i]); j < this->_row_ptr_l[i+1]; ++j)
             {
               if(this->_col_idx_l[j] == col_idx_a[ra])
-                _data_l[j] = data_a[ra++];
+                _data_l[j] = DT_(data_a[ra++]);
               else //if(this->_col_idx_l[j] < col_idx_a[ra])
                 _data_l[j] = DT_(0);
             }
 
             // fetch diagonal of a
-            _data_d[i] = data_a[ra++];
+            _data_d[i] = DT_(data_a[ra++]);
 
             // fetch row i of U
             for(IT_ j(this->_row_ptr_u[i]); j < this->_row_ptr_u[i+1]; ++j)
             {
               if((ra < xa) && (this->_col_idx_u[j] == col_idx_a[ra]))
-                _data_u[j] = data_a[ra++];
+                _data_u[j] = DT_(data_a[ra++]);
               else// if(this->_col_idx_u[j] < col_idx_a[ra])
                 _data_u[j] = DT_(0);
             }
@@ -526,7 +547,8 @@ namespace FEAT
          * \param[in] data_a
          * The data array if the ELL input matrix.
          */
-        void copy_data_ell(const IT_ c, const IT_* ci_a, const IT_* cs_a, const IT_* rl_a, const DT_* data_a)
+        template<typename DTA_>
+        void copy_data_ell(const IT_ c, const IT_* ci_a, const IT_* cs_a, const IT_* rl_a, const DTA_* data_a)
         {
           // loop over all rows
           for(IT_ i(0); i < this->_n; ++i)
@@ -539,7 +561,7 @@ namespace FEAT
             {
               if(this->_col_idx_l[j] == ci_a[ra])
               {
-                _data_l[j] = data_a[ra];
+                _data_l[j] = DT_(data_a[ra]);
                 ra += c;
               }
               else
@@ -547,7 +569,7 @@ namespace FEAT
             }
 
             // fetch diagonal
-            _data_d[i] = data_a[ra];
+            _data_d[i] = DT_(data_a[ra]);
             ra += c;
 
             // fetch row i of U
@@ -555,7 +577,7 @@ namespace FEAT
             {
               if((ra < xa) && (this->_col_idx_u[j] == ci_a[ra]))
               {
-                _data_u[j] = data_a[ra];
+                _data_u[j] = DT_(data_a[ra]);
                 ra += c;
               }
               else
@@ -570,7 +592,8 @@ namespace FEAT
          * \param[in] matrix
          * The input matrix.
          */
-        void copy_data(const LAFEM::SparseMatrixCSR<Mem::Main, DT_, IT_>& matrix)
+        template<typename DTA_>
+        void copy_data(const LAFEM::SparseMatrixCSR<Mem::Main, DTA_, IT_>& matrix)
         {
           this->copy_data_csr(matrix.row_ptr(), matrix.col_ind(), matrix.val());
         }
@@ -581,11 +604,50 @@ namespace FEAT
          * \param[in] matrix
          * The input matrix.
          */
-        void copy_data(const LAFEM::SparseMatrixELL<Mem::Main, DT_, IT_>& matrix)
+        template<typename DTA_>
+        void copy_data(const LAFEM::SparseMatrixELL<Mem::Main, DTA_, IT_>& matrix)
         {
           this->copy_data_ell(IT_(matrix.C()), matrix.col_ind(), matrix.cs(), matrix.rl(), matrix.val());
         }
 
+        /**
+         * \brief Copies the data arrays from a DCSR input matrix
+         *
+         * \param[in] matrix
+         * The input matrix.
+         */
+        template<typename DTA_>
+        void copy_data(const LAFEM::SparseMatrixDCSR<Mem::Main, DTA_, IT_>& matrix)
+        {
+          LAFEM::SparseMatrixCSR<Mem::Main, DTA_, IT_> csr;
+          csr.convert(matrix);
+          this->copy_data(csr);
+        }
+
+        /**
+         * \brief Copies the numeric factors from another factorisation
+         *
+         * This function allows to perform the numeric factorisation in a higher precision
+         * and to store the resulting factors in a lower precision afterwards.
+         *
+         * \param[in] other
+         * The factorisation whose factors are to be copied. Must have the same symbolic
+         * structure as this object.
+         */
+        template<typename DTF_>
+        void copy_factors(const ILUCoreScalar<DTF_, IT_>& other)
+        {
+          XASSERTM(other._data_d.size() == _data_d.size(), "invalid factorisation structure");
+          XASSERTM(other._data_l.size() == _data_l.size(), "invalid factorisation structure");
+          XASSERTM(other._data_u.size() == _data_u.size(), "invalid factorisation structure");
+          for(std::size_t i(0); i < _data_l.size(); ++i)
+            _data_l[i] = DT_(other._data_l[i]);
+          for(std::size_t i(0); i < _data_u.size(); ++i)
+            _data_u[i] = DT_(other._data_u[i]);
+          for(std::size_t i(0); i < _data_d.size(); ++i)
+            _data_d[i] = DT_(other._data_d[i]);
+        }
+
         /**
          * \brief Performs the (I+L)*(D+U) numeric factorisation
          *
@@ -672,7 +734,8 @@ namespace FEAT
          * \note
          * \p x and \p b are allowed to refer to the same array.
          */
-        void solve_il(DT_* x, const DT_* b) const
+        template<typename DTV_>
+        void solve_il(DTV_* x, const DTV_* b) const
         {
 
           const IT_* rptr = this->_row_ptr_l.data();
@@ -681,10 +744,10 @@ namespace FEAT
 
           for(IT_ i(0); i < this->_n; ++i)
           {
-            DT_ r(b[i]);
+            DTV_ r(b[i]);
             for(IT_ j(rptr[i]); j < rptr[i+1]; ++j)
             {
-              r -= data_l[j] * x[cidx[j]];
+              r -= DTV_(data_l[j]) * x[cidx[j]];
             }
             x[i] = r;
           }
@@ -702,7 +765,8 @@ namespace FEAT
          * \note
          * \p x and \p b are allowed to refer to the same array.
          */
-        void solve_du(DT_* x, const DT_* b) const
+        template<typename DTV_>
+        void solve_du(DTV_* x, const DTV_* b) const
         {
           const IT_* rptr = this->_row_ptr_u.data();
           const IT_* cidx = (this->_col_idx_u.empty() ? nullptr : this->_col_idx_u.data());
@@ -712,12 +776,12 @@ namespace FEAT
           for(IT_ i(this->_n); i > IT_(0); )
           {
             --i;
-            DT_ r(b[i]);
+            DTV_ r(b[i]);
             for(IT_ j(rptr[i]); j < rptr[i+1]; ++j)
             {
-              r -= data_u[j] * x[cidx[j]];
+              r -= DTV_(data_u[j]) * x[cidx[j]];
             }
-            x[i] = data_d[i] * r;
+            x[i] = DTV_(data_d[i]) * r;
           }
         }
 
@@ -733,7 +797,8 @@ namespace FEAT
          * \note
          * \p x and \p b are allowed to refer to the same array.
          */
-        void solve_ilt(DT_* x, const DT_* b) const
+        template<typename DTV_>
+        void solve_ilt(DTV_* x, const DTV_* b) const
         {
           const IT_* rptr = this->_row_ptr_l.data();
           const IT_* cidx = (this->_col_idx_l.empty() ? nullptr : this->_col_idx_l.data());
@@ -751,7 +816,7 @@ namespace FEAT
             for(IT_ j(rptr[i]); j < rptr[i+1]; ++j)
             {
               // x_j -= L_ij * x[i]
-              x[cidx[j]] -= data_l[j] * x[i];
+              x[cidx[j]] -= DTV_(data_l[j]) * x[i];
             }
           }
         }
@@ -768,7 +833,8 @@ namespace FEAT
          * \note
          * \p x and \p b are allowed to refer to the same array.
          */
-        void solve_dut(DT_* x, const DT_* b) const
+        template<typename DTV_>
+        void solve_dut(DTV_* x, const DTV_* b) const
         {
           const IT_* rptr = this->_row_ptr_u.data();
           const IT_* cidx = (this->_col_idx_u.empty() ? nullptr : this->_col_idx_u.data());
@@ -783,11 +849,11 @@ namespace FEAT
 
           for(IT_ i(0); i < this->_n; ++i)
           {
-            x[i] *= data_d[i];
+            x[i] *= DTV_(data_d[i]);
             for(IT_ j(rptr[i]); j < rptr[i+1]; ++j)
             {
               // x_j -= U_ij * x_i
-              x[cidx[j]] -= data_u[j] * x[i];
+              x[cidx[j]] -= DTV_(data_u[j]) * x[i];
             }
           }
         }
@@ -799,7 +865,8 @@ namespace FEAT
        * This class is responsible for the factorisation and management of an ILU(p) factorisation.
        *
        * \tparam DT_
-       * The data-type to be used.
+       * The data-type to be used for the factorisation. The input matrix and the vectors passed to
+       * the solve functions may use a different data-type, see ILUCoreScalar.
        *
        * \tparam IT_
        * The index-type to be used.
@@ -824,6 +891,9 @@ namespace FEAT
         /// The data arrays of L, U and D.
         std::vector<MatBlock> _data_l, _data_u, _data_d;
 
+        template<typename, typename, int>
+        friend class ILUCoreBlocked;
+
       public:
         /// Clears all data arrays.
         void clear()
@@ -867,7 +937,8 @@ namespace FEAT
          * \param[in] data_a
          * The data arrays of the CSR input matrix.
          */
-        void copy_data_bcsr(const IT_* row_ptr_a, const IT_* col_idx_a, const MatBlock* data_a)
+        template<typename DTA_>
+        void copy_data_bcsr(const IT_* row_ptr_a, const IT_* col_idx_a, const Tiny::Matrix<DTA_, dim_, dim_>* data_a)
         {
           // loop over all rows
           for(IT_ i(0); i < this->_n; ++i)
@@ -880,19 +951,19 @@ namespace FEAT
             for(IT_ j(this->_row_ptr_l[i]); j < this->_row_ptr_l[i+1]; ++j)
             {
               if(this->_col_idx_l[j] == col_idx_a[ra])
-                _data_l[j] = data_a[ra++];
+                _data_l[j] = MatBlock(data_a[ra++]);
               else //if(this->_col_idx_l[j] < col_idx_a[ra])
                 _data_l[j] = DT_(0);
             }
 
             // fetch diagonal of a
-            _data_d[i] = data_a[ra++];
+            _data_d[i] = MatBlock(data_a[ra++]);
 
             // fetch row i of U
             for(IT_ j(this->_row_ptr_u[i]); j < this->_row_ptr_u[i+1]; ++j)
             {
               if((ra < xa) && (this->_col_idx_u[j] == col_idx_a[ra]))
-                _data_u[j] = data_a[ra++];
+                _data_u[j] = MatBlock(data_a[ra++]);
               else// if(this->_col_idx_u[j] < col_idx_a[ra])
                 _data_u[j] = DT_(0);
             }
@@ -905,11 +976,36 @@ namespace FEAT
          * \param[in] matrix
          * The input matrix.
          */
-        void copy_data(const LAFEM::SparseMatrixBCSR<Mem::Main, DT_, IT_, dim_, dim_>& matrix)
+        template<typename DTA_>
+        void copy_data(const LAFEM::SparseMatrixBCSR<Mem::Main, DTA_, IT_, dim_, dim_>& matrix)
         {
           this->copy_data_bcsr(matrix.row_ptr(), matrix.col_ind(), matrix.val());
         }
 
+        /**
+         * \brief Copies the numeric factors from another factorisation
+         *
+         * This function allows to perform the numeric factorisation in a higher precision
+         * and to store the resulting factors in a lower precision afterwards.
+         *
+         * \param[in] other
+         * The factorisation whose factors are to be copied. Must have the same symbolic
+         * structure as this object.
+         */
+        template<typename DTF_>
+        void copy_factors(const ILUCoreBlocked<DTF_, IT_, dim_>& other)
+        {
+          XASSERTM(other._data_d.size() == _data_d.size(), "invalid factorisation structure");
+          XASSERTM(other._data_l.size() == _data_l.size(), "invalid factorisation structure");
+          XASSERTM(other._data_u.size() == _data_u.size(), "invalid factorisation structure");
+          for(std::size_t i(0); i < _data_l.size(); ++i)
+            _data_l[i] = MatBlock(other._data_l[i]);
+          for(std::size_t i(0); i < _data_u.size(); ++i)
+            _data_u[i] = MatBlock(other._data_u[i]);
+          for(std::size_t i(0); i < _data_d.size(); ++i)
+            _data_d[i] = MatBlock(other._data_d[i]);
+        }
+
         /**
          * \brief Performs the (I+L)*(D+U) numeric factorisation
          *
@@ -1008,19 +1104,22 @@ namespace FEAT
          * \note
          * \p x and \p b are allowed to refer to the same array.
          */
-        void solve_il(VecBlock* x, const VecBlock* b) const
+        template<typename DTV_>
+        void solve_il(Tiny::Vector<DTV_, dim_>* x, const Tiny::Vector<DTV_, dim_>* b) const
         {
+          typedef Tiny::Matrix<DTV_, dim_, dim_> MatBlockV;
+
           const IT_* rptr = this->_row_ptr_l.data();
           const IT_* cidx = (this->_col_idx_l.empty() ? nullptr : this->_col_idx_l.data());
           const MatBlock* data_l = (this->_data_l.empty() ? nullptr : this->_data_l.data());
 
           for(IT_ i(0); i < this->_n; ++i)
           {
-            VecBlock r(b[i]);
+            Tiny::Vector<DTV_, dim_> r(b[i]);
             for(IT_ j(rptr[i]); j < rptr[i+1]; ++j)
             {
               //r -= data_l[j] * x[cidx[j]];
-              r.add_mat_vec_mult(data_l[j], x[cidx[j]], -DT_(1));
+              r.add_mat_vec_mult(MatBlockV(data_l[j]), x[cidx[j]], -DTV_(1));
             }
             x[i] = r;
           }
@@ -1038,8 +1137,11 @@ namespace FEAT
          * \note
          * \p x and \p b are allowed to refer to the same array.
          */
-        void solve_du(VecBlock* x, const VecBlock* b) const
+        template<typename DTV_>
+        void solve_du(Tiny::Vector<DTV_, dim_>* x, const Tiny::Vector<DTV_, dim_>* b) const
         {
+          typedef Tiny::Matrix<DTV_, dim_, dim_> MatBlockV;
+
           const IT_* rptr = this->_row_ptr_u.data();
           const IT_* cidx = (this->_col_idx_u.empty() ? nullptr : this->_col_idx_u.data());
           const MatBlock* data_u = (this->_data_u.empty() ? nullptr : this->_data_u.data());
@@ -1048,14 +1150,14 @@ namespace FEAT
           for(IT_ i(this->_n); i > IT_(0); )
           {
             --i;
-            VecBlock r(b[i]);
+            Tiny::Vector<DTV_, dim_> r(b[i]);
             for(IT_ j(rptr[i]); j < rptr[i+1]; ++j)
             {
               //r -= data_u[j] * x[cidx[j]];
-              r.add_mat_vec_mult(data_u[j], x[cidx[j]], -DT_(1));
+              r.add_mat_vec_mult(MatBlockV(data_u[j]), x[cidx[j]], -DTV_(1));
             }
             //x[i] = data_d[i] * r;
-            x[i].set_mat_vec_mult(data_d[i], r);
+            x[i].set_mat_vec_mult(MatBlockV(data_d[i]), r);
           }
         }
       }; // class ILUCoreBlocked
@@ -1072,10 +1174,28 @@ namespace FEAT
      * - LAFEM::SparseMatrixELL in Mem::Main and Mem::CUDA
      * - LAFEM::SparseMatrixBSCR in Mem::Main and Mem::CUDA
      *
+     * For matrices in Mem::Main, the optional template parameter \p DTS_ specifies the data type
+     * which is used for the storage of the factors L, D and U. Choosing a lower precision here
+     * (e.g. float or half_float::half in a double solver) reduces the memory footprint of the factors
+     * and thus the memory traffic of the (bandwidth bound) triangular solves; the factor entries are
+     * converted to the vector data type on the fly. The numeric factorisation itself is always
+     * performed in the data type of the matrix in a temporary buffer, so that only the final factors
+     * are rounded to \p DTS_.
+     *
+     * \tparam Matrix_
+     * The type of the system matrix.
+     *
+     * \tparam Filter_
+     * The type of the system filter.
+     *
+     * \tparam DTS_
+     * The data type used for storing the factorisation. Must coincide with the data type
+     * of \p Matrix_ for all matrices residing in Mem::CUDA.
+     *
      * \author Dirk Ribbrock
      * \author Peter Zajac
      */
-    template<typename Matrix_, typename Filter_>
+    template<typename Matrix_, typename Filter_, typename DTS_ = typename Matrix_::DataType>
     class ILUPrecond;
 
     /**
@@ -1085,14 +1205,15 @@ namespace FEAT
      *
      * \author Peter Zajac
      */
-    template<template<class,class,class> class ScalarMatrix_, typename DT_, typename IT_, typename Filter_>
-    class ILUPrecond<ScalarMatrix_<Mem::Main, DT_, IT_>, Filter_> :
+    template<template<class,class,class> class ScalarMatrix_, typename DT_, typename IT_, typename Filter_, typename DTS_>
+    class ILUPrecond<ScalarMatrix_<Mem::Main, DT_, IT_>, Filter_, DTS_> :
       public SolverBase<typename ScalarMatrix_<Mem::Main, DT_, IT_>::VectorTypeL>
     {
     public:
       typedef ScalarMatrix_<Mem::Main, DT_, IT_> MatrixType;
       typedef Mem::Main MemType;
       typedef DT_ DataType;
+      typedef DTS_ DataTypeStorage;
       typedef IT_ IndexType;
       typedef Filter_ FilterType;
       typedef typename MatrixType::VectorTypeL VectorType;
@@ -1101,7 +1222,7 @@ namespace FEAT
     protected:
       const MatrixType& _matrix;
       const FilterType& _filter;
-      Intern::ILUCoreScalar<DataType, IndexType> _ilu;
+      Intern::ILUCoreScalar<DataTypeStorage, IndexType> _ilu;
       int _p;
 
     public:
@@ -1152,6 +1273,14 @@ namespace FEAT
         _p = p;
       }
 
+      /**
+       * \brief Returns the total number of bytes currently allocated in this object.
+       */
+      std::size_t bytes() const
+      {
+        return _ilu.bytes();
+      }
+
       /// Returns the name of the solver.
       virtual String name() const override
       {
@@ -1181,11 +1310,31 @@ namespace FEAT
       }
 
       virtual void init_numeric() override
+      {
+        this->_init_numeric(std::is_same<DTS_, DataType>());
+      }
+
+    protected:
+      /// numeric factorisation if the factors are stored in the matrix data type
+      void _init_numeric(std::true_type)
       {
         _ilu.copy_data(_matrix);
         _ilu.factorise_numeric_il_du();
       }
 
+      /// numeric factorisation in the matrix data type and conversion to the storage data type
+      void _init_numeric(std::false_type)
+      {
+        Intern::ILUCoreScalar<DataType, IndexType> ilu;
+        static_cast<Intern::ILUCoreSymbolic<IndexType>&>(ilu) = _ilu;
+        ilu.alloc_data();
+        ilu.copy_data(_matrix);
+        ilu.factorise_numeric_il_du();
+        _ilu.copy_factors(ilu);
+      }
+
+    public:
+
       /**
        * \brief apply the preconditioner
        *
@@ -1222,14 +1371,15 @@ namespace FEAT
      *
      * \author Peter Zajac
      */
-    template<typename DT_, typename IT_, int dim_, typename Filter_>
-    class ILUPrecond<LAFEM::SparseMatrixBCSR<Mem::Main, DT_, IT_, dim_, dim_>, Filter_> :
+    template<typename DT_, typename IT_, int dim_, typename Filter_, typename DTS_>
+    class ILUPrecond<LAFEM::SparseMatrixBCSR<Mem::Main, DT_, IT_, dim_, dim_>, Filter_, DTS_> :
       public SolverBase<LAFEM::DenseVectorBlocked<Mem::Main, DT_, IT_, dim_>>
     {
     public:
       typedef LAFEM::SparseMatrixBCSR<Mem::Main, DT_, IT_, dim_, dim_> MatrixType;
       typedef Mem::Main MemType;
       typedef DT_ DataType;
+      typedef DTS_ DataTypeStorage;
       typedef IT_ IndexType;
       typedef Filter_ FilterType;
       typedef typename MatrixType::VectorTypeL VectorType;
@@ -1238,7 +1388,7 @@ namespace FEAT
     protected:
       const MatrixType& _matrix;
       const FilterType& _filter;
-      Intern::ILUCoreBlocked<DataType, IndexType, dim_> _ilu;
+      Intern::ILUCoreBlocked<DataTypeStorage, IndexType, dim_> _ilu;
       int _p;
 
     public:
@@ -1289,6 +1439,14 @@ namespace FEAT
         _p = p;
       }
 
+      /**
+       * \brief Returns the total number of bytes currently allocated in this object.
+       */
+      std::size_t bytes() const
+      {
+        return _ilu.bytes();
+      }
+
       /// Returns the name of the solver.
       virtual String name() const override
       {
@@ -1318,11 +1476,31 @@ namespace FEAT
       }
 
       virtual void init_numeric() override
+      {
+        this->_init_numeric(std::is_same<DTS_, DataType>());
+      }
+
+    protected:
+      /// numeric factorisation if the factors are stored in the matrix data type
+      void _init_numeric(std::true_type)
       {
         _ilu.copy_data(_matrix);
         _ilu.factorise_numeric_il_du();
       }
 
+      /// numeric factorisation in the matrix data type and conversion to the storage data type
+      void _init_numeric(std::false_type)
+      {
+        Intern::ILUCoreBlocked<DataType, IndexType, dim_> ilu;
+        static_cast<Intern::ILUCoreSymbolic<IndexType>&>(ilu) = _ilu;
+        ilu.alloc_data();
+        ilu.copy_data(_matrix);
+        ilu.factorise_numeric_il_du();
+        _ilu.copy_factors(ilu);
+      }
+
+    public:
+
       /**
        * \brief apply the preconditioner
        *
@@ -1368,7 +1546,7 @@ namespace FEAT
      * \author Dirk Ribbrock
      */
     template<typename Filter_>
-    class ILUPrecond<LAFEM::SparseMatrixCSR<Mem::CUDA, double, unsigned int>, Filter_> :
+    class ILUPrecond<LAFEM::SparseMatrixCSR<Mem::CUDA, double, unsigned int>, Filter_, double> :
       public SolverBase<LAFEM::SparseMatrixCSR<Mem::CUDA, double, unsigned int>::VectorTypeL>
     {
     public:
@@ -1501,7 +1679,7 @@ namespace FEAT
 
     /*
     template<typename Filter_>
-    class ILUPrecond<LAFEM::SparseMatrixCSR<Mem::CUDA, float, unsigned int>, Filter_> :
+    class ILUPrecond<LAFEM::SparseMatrixCSR<Mem::CUDA, float, unsigned int>, Filter_, float> :
       public SolverBase<LAFEM::SparseMatrixCSR<Mem::CUDA, float, unsigned int>::VectorTypeL>
     {
       public:
@@ -1525,7 +1703,7 @@ namespace FEAT
     };
 
     template<typename Filter_>
-    class ILUPrecond<LAFEM::SparseMatrixCSR<Mem::CUDA, float, unsigned long>, Filter_> :
+    class ILUPrecond<LAFEM::SparseMatrixCSR<Mem::CUDA, float, unsigned long>, Filter_, float> :
       public SolverBase<LAFEM::SparseMatrixCSR<Mem::CUDA, float, unsigned long>::VectorTypeL>
     {
       public:
@@ -1549,7 +1727,7 @@ namespace FEAT
     };
 
     template<typename Filter_>
-    class ILUPrecond<LAFEM::SparseMatrixCSR<Mem::CUDA, double, unsigned long>, Filter_> :
+    class ILUPrecond<LAFEM::SparseMatrixCSR<Mem::CUDA, double, unsigned long>, Filter_, double> :
       public SolverBase<LAFEM::SparseMatrixCSR<Mem::CUDA, double, unsigned long>::VectorTypeL>
     {
       public:
@@ -1586,7 +1764,7 @@ namespace FEAT
      * \author Dirk Ribbrock
      */
     template<typename Filter_, int blocksize_>
-    class ILUPrecond<LAFEM::SparseMatrixBCSR<Mem::CUDA, double, unsigned int, blocksize_, blocksize_>, Filter_> :
+    class ILUPrecond<LAFEM::SparseMatrixBCSR<Mem::CUDA, double, unsigned int, blocksize_, blocksize_>, Filter_, double> :
       public SolverBase<typename LAFEM::SparseMatrixBCSR<Mem::CUDA, double, unsigned int, blocksize_, blocksize_>::VectorTypeL>
     {
     public:
@@ -1731,7 +1909,7 @@ namespace FEAT
     }; // class ILUPrecond<SparseMatrixBCSR<Mem::CUDA,...>,...>
 
     /// Dummy class for not implemented specialisations
-    template<typename Matrix_, typename Filter_>
+    template<typename Matrix_, typename Filter_, typename DTS_>
     class ILUPrecond :
       public SolverBase<typename Matrix_::VectorTypeL>
     {
@@ -747,7 +747,7 @@ namespace FEAT
         this->_def_init = this->_def_cur = this->_def_prev = this->_calc_def_norm(vec_def, vec_sol);
         this->_num_iter = Index(0);
         this->_num_stag_iter = Index(0);
-        Statistics::add_solver_expression(std::make_shared<ExpressionDefect>(this->name(), this->_def_init, this->get_num_iter()));
+        Statistics::add_solver_expression(ExpressionDefect(this->expression_name(), this->_def_init, this->get_num_iter()));
 
         // plot iteration line?
         if(this->_plot_iter())
@@ -864,7 +864,7 @@ namespace FEAT
         if(calc_def)
         {
           this->_def_cur = this->_calc_def_norm(vec_def, vec_sol);
-          Statistics::add_solver_expression(std::make_shared<ExpressionDefect>(this->name(), this->_def_cur, this->get_num_iter()));
+          Statistics::add_solver_expression(ExpressionDefect(this->expression_name(), this->_def_cur, this->get_num_iter()));
         }
 
         // analyse defect
@@ -902,7 +902,7 @@ namespace FEAT
 
         // update current defect
         this->_def_cur = def_cur_norm;
-        Statistics::add_solver_expression(std::make_shared<ExpressionDefect>(this->name(), this->_def_cur, this->get_num_iter()));
+        Statistics::add_solver_expression(ExpressionDefect(this->expression_name(), this->_def_cur, this->get_num_iter()));
 
         // analyse defect
         Status status = this->_analyse_defect(this->_num_iter, this->_def_cur, this->_def_prev, true);
@@ -1064,7 +1064,7 @@ namespace FEAT
       {
         if(this->_precond)
         {
-          Statistics::add_solver_expression(std::make_shared<ExpressionCallPrecond>(this->name(), this->_precond->name()));
+          Statistics::add_solver_expression(ExpressionCallPrecond(this->expression_name(), this->_precond->expression_name()));
           return status_success(this->_precond->apply(vec_cor, vec_def));
         }
         else
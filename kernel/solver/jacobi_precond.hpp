@@ -9,11 +9,98 @@
 
 // includes, FEAT
 #include <kernel/solver/base.hpp>
+#include <kernel/global/vector.hpp>
+#include <kernel/lafem/dense_vector.hpp>
+#include <kernel/lafem/dense_vector_blocked.hpp>
+#include <kernel/lafem/power_vector.hpp>
+#include <kernel/lafem/tuple_vector.hpp>
+#include <kernel/lafem/arch/component_product.hpp>
 
 namespace FEAT
 {
   namespace Solver
   {
+    /// \cond internal
+    namespace Intern
+    {
+      /// helper class for the reduced-precision diagonal of the Jacobi preconditioner
+      template<typename Vector_, typename DTS_>
+      struct JacobiStorageHelper
+      {
+        /// the type of the vector storing the inverted diagonal
+        typedef typename Vector_::template ContainerTypeByMDI<typename Vector_::MemType, DTS_, typename Vector_::IndexType> Type;
+
+        static const Vector_& local(const Vector_& vector)
+        {
+          return vector;
+        }
+      };
+
+      template<typename LocalVector_, typename Mirror_, typename DTS_>
+      struct JacobiStorageHelper<Global::Vector<LocalVector_, Mirror_>, DTS_>
+      {
+        typedef typename JacobiStorageHelper<LocalVector_, DTS_>::Type Type;
+
+        static const LocalVector_& local(const Global::Vector<LocalVector_, Mirror_>& vector)
+        {
+          return vector.local();
+        }
+      };
+
+      template<typename DT_, typename DTS_, typename IT_>
+      void jacobi_apply_mixed(LAFEM::DenseVector<Mem::Main, DT_, IT_>& vec_cor,
+        const LAFEM::DenseVector<Mem::Main, DTS_, IT_>& inv_diag, const LAFEM::DenseVector<Mem::Main, DT_, IT_>& vec_def)
+      {
+        XASSERTM(vec_cor.size() == inv_diag.size(), "Vector size does not match!");
+        XASSERTM(vec_def.size() == inv_diag.size(), "Vector size does not match!");
+        LAFEM::Arch::ComponentProduct<Mem::Main>::value_mixed(vec_cor.elements(), inv_diag.elements(), vec_def.elements(), vec_cor.size());
+      }
+
+      template<typename DT_, typename DTS_, typename IT_, int block_size_>
+      void jacobi_apply_mixed(LAFEM::DenseVectorBlocked<Mem::Main, DT_, IT_, block_size_>& vec_cor,
+        const LAFEM::DenseVectorBlocked<Mem::Main, DTS_, IT_, block_size_>& inv_diag,
+        const LAFEM::DenseVectorBlocked<Mem::Main, DT_, IT_, block_size_>& vec_def)
+      {
+        XASSERTM(vec_cor.size() == inv_diag.size(), "Vector size does not match!");
+        XASSERTM(vec_def.size() == inv_diag.size(), "Vector size does not match!");
+        LAFEM::Arch::ComponentProduct<Mem::Main>::value_mixed(
+          vec_cor.template elements<LAFEM::Perspective::pod>(), inv_diag.template elements<LAFEM::Perspective::pod>(),
+          vec_def.template elements<LAFEM::Perspective::pod>(), vec_cor.template size<LAFEM::Perspective::pod>());
+      }
+
+      template<typename SubVector_, typename SubVectorS_, int count_>
+      void jacobi_apply_mixed(LAFEM::PowerVector<SubVector_, count_>& vec_cor,
+        const LAFEM::PowerVector<SubVectorS_, count_>& inv_diag, const LAFEM::PowerVector<SubVector_, count_>& vec_def)
+      {
+        for(int i(0); i < count_; ++i)
+          jacobi_apply_mixed(vec_cor.get(i), inv_diag.get(i), vec_def.get(i));
+      }
+
+      template<typename First_, typename FirstS_>
+      void jacobi_apply_mixed(LAFEM::TupleVector<First_>& vec_cor,
+        const LAFEM::TupleVector<FirstS_>& inv_diag, const LAFEM::TupleVector<First_>& vec_def)
+      {
+        jacobi_apply_mixed(vec_cor.first(), inv_diag.first(), vec_def.first());
+      }
+
+      template<typename First_, typename Second_, typename... Rest_, typename FirstS_, typename SecondS_, typename... RestS_>
+      void jacobi_apply_mixed(LAFEM::TupleVector<First_, Second_, Rest_...>& vec_cor,
+        const LAFEM::TupleVector<FirstS_, SecondS_, RestS_...>& inv_diag,
+        const LAFEM::TupleVector<First_, Second_, Rest_...>& vec_def)
+      {
+        jacobi_apply_mixed(vec_cor.first(), inv_diag.first(), vec_def.first());
+        jacobi_apply_mixed(vec_cor.rest(), inv_diag.rest(), vec_def.rest());
+      }
+
+      template<typename LocalVector_, typename Mirror_, typename LocalVectorS_>
+      void jacobi_apply_mixed(Global::Vector<LocalVector_, Mirror_>& vec_cor,
+        const LocalVectorS_& inv_diag, const Global::Vector<LocalVector_, Mirror_>& vec_def)
+      {
+        jacobi_apply_mixed(vec_cor.local(), inv_diag, vec_def.local());
+      }
+    } // namespace Intern
+    /// \endcond
+
     /**
      * \brief Jacobi preconditioner implementation
      *
@@ -30,9 +117,26 @@ namespace FEAT
      * Moreover, this implementation supports all Mem architectures, as well as all
      * data and index types.
      *
+     * For matrices in Mem::Main, the optional template parameter \p DTS_ specifies the data type
+     * which is used for the storage of the inverted diagonal. Choosing a lower precision here
+     * (e.g. float in a double solver) reduces the memory traffic of the apply; the diagonal is
+     * extracted and inverted in the data type of the matrix and rounded to \p DTS_ afterwards.
+     * The mixed apply is supported for DenseVector, DenseVectorBlocked and PowerVector, TupleVector
+     * and Global::Vector compositions thereof.
+     *
+     * \tparam Matrix_
+     * The type of the system matrix.
+     *
+     * \tparam Filter_
+     * The type of the system filter.
+     *
+     * \tparam DTS_
+     * The data type used for storing the inverted diagonal. Must coincide with the data type
+     * of \p Matrix_ for all matrices residing in Mem::CUDA.
+     *
      * \author Peter Zajac
      */
-    template<typename Matrix_, typename Filter_>
+    template<typename Matrix_, typename Filter_, typename DTS_ = typename Matrix_::DataType>
     class JacobiPrecond :
       public SolverBase<typename Matrix_::VectorTypeL>
     {
@@ -45,9 +149,16 @@ namespace FEAT
       typedef typename MatrixType::VectorTypeL VectorType;
       /// The floating point precision
       typedef typename MatrixType::DataType DataType;
+      /// The floating point precision of the stored diagonal
+      typedef DTS_ DataTypeStorage;
+      /// The vector type storing the diagonal in reduced precision
+      typedef typename Intern::JacobiStorageHelper<VectorType, DTS_>::Type StorageVectorType;
       /// Our base class
       typedef SolverBase<VectorType> BaseClass;
 
+      static_assert(std::is_same<DTS_, DataType>::value || std::is_same<typename VectorType::MemType, Mem::Main>::value,
+        "reduced precision storage is only supported in Mem::Main");
+
     protected:
       /// The system matrix
       const MatrixType& _matrix;
@@ -57,6 +168,8 @@ namespace FEAT
       DataType _omega;
       /// The component-wise inverted diagonal of _matrix
       VectorType _inv_diag;
+      /// The component-wise inverted diagonal of _matrix in reduced precision
+      StorageVectorType _inv_diag_s;
 
     public:
       /**
@@ -121,26 +234,33 @@ namespace FEAT
         return "Jacobi";
       }
 
+      /**
+       * \brief Returns the total number of bytes currently allocated in this object.
+       */
+      std::size_t bytes() const
+      {
+        return Intern::JacobiStorageHelper<VectorType, DTS_>::local(_inv_diag).bytes() + _inv_diag_s.bytes();
+      }
+
       /// \copydoc SolverBase::init_symbolic()
       virtual void init_symbolic() override
       {
-        _inv_diag = _matrix.create_vector_r();
+        // in reduced precision, the diagonal is only assembled temporarily in init_numeric()
+        if(std::is_same<DTS_, DataType>::value)
+          _inv_diag = _matrix.create_vector_r();
       }
 
       /// \copydoc SolverBase::done_symbolic()
       virtual void done_symbolic() override
       {
         _inv_diag.clear();
+        _inv_diag_s.clear();
       }
 
       /// \copydoc SolverBase::init_numeric()
       virtual void init_numeric() override
       {
-        // extract matrix diagonal
-        _matrix.extract_diag(_inv_diag);
-
-        // invert diagonal elements
-        _inv_diag.component_invert(_inv_diag, _omega);
+        this->_init_numeric(std::is_same<DTS_, DataType>());
       }
 
       /**
@@ -159,10 +279,41 @@ namespace FEAT
       /// \copydoc SolverBase::apply()
       virtual Status apply(VectorType& vec_cor, const VectorType& vec_def) override
       {
-        vec_cor.component_product(_inv_diag, vec_def);
+        this->_apply_diag(vec_cor, vec_def, std::is_same<DTS_, DataType>());
         this->_filter.filter_cor(vec_cor);
         return Status::success;
       }
+
+    protected:
+      void _init_numeric(std::true_type)
+      {
+        // extract matrix diagonal
+        _matrix.extract_diag(_inv_diag);
+
+        // invert diagonal elements
+        _inv_diag.component_invert(_inv_diag, _omega);
+      }
+
+      void _init_numeric(std::false_type)
+      {
+        // extract and invert the diagonal in the matrix data type
+        VectorType inv_diag = _matrix.create_vector_r();
+        _matrix.extract_diag(inv_diag);
+        inv_diag.component_invert(inv_diag, _omega);
+
+        // round the inverted diagonal to the storage data type
+        _inv_diag_s.convert(Intern::JacobiStorageHelper<VectorType, DTS_>::local(inv_diag));
+      }
+
+      void _apply_diag(VectorType& vec_cor, const VectorType& vec_def, std::true_type)
+      {
+        vec_cor.component_product(_inv_diag, vec_def);
+      }
+
+      void _apply_diag(VectorType& vec_cor, const VectorType& vec_def, std::false_type)
+      {
+        Intern::jacobi_apply_mixed(vec_cor, _inv_diag_s, vec_def);
+      }
     }; // class JacobiPrecond<...>
 
     /**
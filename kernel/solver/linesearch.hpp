@@ -550,7 +550,7 @@ namespace FEAT
           this->_def_cur = Math::abs(df);
 
           Statistics::add_solver_expression(
-            std::make_shared<ExpressionDefect>(this->name(), this->_def_cur, this->get_num_iter()));
+            ExpressionDefect(this->expression_name(), this->_def_cur, this->get_num_iter()));
 
           // plot?
           if(this->_plot_iter())
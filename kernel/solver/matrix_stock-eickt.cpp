@@ -25,5 +25,11 @@ namespace FEAT
       //Global::Matrix<LAFEM::SparseMatrixBCSR<Mem::Main, double, Index, 2, 2>, LAFEM::VectorMirror<Mem::Main, double, Index>, LAFEM::VectorMirror<Mem::Main, double, Index>>
       Global::Transfer<LAFEM::Transfer<LAFEM::SparseMatrixBCSR<Mem::Main, double, Index, 2, 2>>, LAFEM::VectorMirror<Mem::Main, double, Index>>
         >;
+
+    template class MatrixStock<
+      Global::Matrix<LAFEM::SparseMatrixDCSR<Mem::Main, double, Index>, LAFEM::VectorMirror<Mem::Main, double, Index>, LAFEM::VectorMirror<Mem::Main, double, Index>>,
+      Global::Filter<LAFEM::UnitFilter<Mem::Main, double, Index>, LAFEM::VectorMirror<Mem::Main, double, Index>>,
+      Global::Transfer<LAFEM::Transfer<LAFEM::SparseMatrixDCSR<Mem::Main, double, Index>>, LAFEM::VectorMirror<Mem::Main, double, Index>>
+        >;
   }
 }
@@ -0,0 +1,280 @@
+// FEAT3: Finite Element Analysis Toolbox, Version 3
+// Copyright (C) 2010 - 2020 by Stefan Turek & the FEAT group
+// FEAT3 is released under the GNU General Public License version 3,
+// see the file 'copyright.txt' in the top level directory for details.
+
+#include <kernel/base_header.hpp>
+#include <kernel/archs.hpp>
+#include <test_system/test_system.hpp>
+#include <kernel/lafem/pointstar_factory.hpp>
+#include <kernel/lafem/sparse_matrix_coo.hpp>
+#include <kernel/lafem/sparse_matrix_csr.hpp>
+#include <kernel/lafem/sparse_matrix_dcsr.hpp>
+#include <kernel/lafem/tuning.hpp>
+#include <kernel/lafem/unit_filter.hpp>
+#include <kernel/solver/matrix_stock.hpp>
+#include <kernel/solver/solver_factory.hpp>
+#include <kernel/util/property_map.hpp>
+
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+
+using namespace FEAT;
+using namespace FEAT::LAFEM;
+using namespace FEAT::Solver;
+using namespace FEAT::TestSystem;
+
+/**
+ * \brief Test class for the matrix stock
+ *
+ * \test Creates a 1D Poisson level hierarchy, hands it to a MatrixStock and solves the finest level
+ * system by a multigrid preconditioned CG solver created by the SolverFactory. The test is run with
+ * the CSR and the DCSR matrix format and checks that both formats need the same number of iterations.
+ * The global solver is run with plain CSR matrices and with a different CPU matrix format deployed
+ * on each level by the format tuner, whose decisions are taken from a prepared cache file.
+ */
+template<typename MemType_, typename DataType_, typename IndexType_>
+class MatrixStockTest :
+  public FullTaggedTest<MemType_, DataType_, IndexType_>
+{
+public:
+  typedef DataType_ DataType;
+  typedef IndexType_ IndexType;
+
+  typedef VectorMirror<MemType_, DataType, IndexType> MirrorType;
+  typedef DenseVector<MemType_, DataType, IndexType> LocalVectorType;
+  typedef UnitFilter<MemType_, DataType, IndexType> LocalFilterType;
+
+  typedef Global::Gate<LocalVectorType, MirrorType> GateType;
+  typedef Global::Muxer<LocalVectorType, MirrorType> MuxerType;
+  typedef Global::Filter<LocalFilterType, MirrorType> GlobalFilterType;
+  typedef Global::Vector<LocalVectorType, MirrorType> GlobalVectorType;
+
+  /// number of levels in the hierarchy
+  static constexpr Index num_levels = Index(4);
+
+  MatrixStockTest() :
+    FullTaggedTest<MemType_, DataType_, IndexType_>("MatrixStockTest")
+  {
+  }
+
+  virtual ~MatrixStockTest()
+  {
+  }
+
+  /// returns the number of inner nodes on a level; level 0 is the finest one
+  static Index num_nodes(Index level)
+  {
+    return (Index(8) << (num_levels - level - Index(1))) - Index(1);
+  }
+
+  /// assembles the linear interpolation from level+1 to level
+  static SparseMatrixCSR<Mem::Main, DataType, IndexType> assemble_prol(Index level)
+  {
+    const Index n_f = num_nodes(level);
+    const Index n_c = num_nodes(level + Index(1));
+    SparseMatrixCOO<Mem::Main, DataType, IndexType> coo(n_f, n_c);
+    for(Index i(0); i < n_c; ++i)
+    {
+      coo(2*i, i, DataType(0.5));
+      coo(2*i+1, i, DataType(1));
+      coo(2*i+2, i, DataType(0.5));
+    }
+    return SparseMatrixCSR<Mem::Main, DataType, IndexType>(coo);
+  }
+
+  /// assembles the Galerkin matrix of the 1D Laplace stencil on a level
+  static SparseMatrixCSR<Mem::Main, DataType, IndexType> assemble_matrix(Index level)
+  {
+    PointstarFactoryFD<DataType, IndexType> psf(num_nodes(level), Index(1));
+    SparseMatrixCSR<Mem::Main, DataType, IndexType> matrix(psf.matrix_csr());
+    matrix.scale(matrix, DataType(1) / DataType(Index(1) << level));
+    return matrix;
+  }
+
+  static LocalVectorType& local_of(LocalVectorType& vector)
+  {
+    return vector;
+  }
+
+  static LocalVectorType& local_of(GlobalVectorType& vector)
+  {
+    return vector.local();
+  }
+
+  /// the local systems do not have deployed formats
+  template<typename Systems_>
+  void check_formats(const Systems_&, const std::vector<String>&) const
+  {
+  }
+
+  /// checks the deployed format of each level of the global systems
+  template<typename LocalMatrix_>
+  void check_formats(const std::deque<Global::Matrix<LocalMatrix_, MirrorType, MirrorType>>& systems,
+    const std::vector<String>& formats) const
+  {
+    TEST_CHECK_EQUAL(systems.size(), formats.size());
+    for(std::size_t lvl(0); lvl < formats.size(); ++lvl)
+    {
+      auto apply_format = systems.at(lvl).get_apply_format();
+      if(formats.at(lvl) == "csr")
+        TEST_CHECK(apply_format == nullptr);
+      else
+      {
+        TEST_CHECK(apply_format != nullptr);
+        TEST_CHECK_EQUAL(apply_format->name(), formats.at(lvl));
+      }
+    }
+  }
+
+  /**
+   * \brief Solves the finest level system by a multigrid preconditioned CG solver
+   *
+   * \param[in] formats
+   * The CPU matrix formats to be deployed on the levels, e.g. "ell" or "bcsr3"; if empty,
+   * the format tuner is not used.
+   */
+  template<typename LocalMatrix_, typename SolverVectorType>
+  Index test_stock(const String& name, const std::vector<String>& formats, std::vector<DataType>& err) const
+  {
+    typedef Global::Matrix<LocalMatrix_, MirrorType, MirrorType> GlobalMatrixType;
+    typedef Global::Transfer<LAFEM::Transfer<LocalMatrix_>, MirrorType> GlobalTransferType;
+    typedef MatrixStock<GlobalMatrixType, GlobalFilterType, GlobalTransferType> MatrixStockType;
+    const bool is_global = std::is_same<SolverVectorType, GlobalVectorType>::value;
+
+    const Dist::Comm comm = Dist::Comm::self();
+
+    std::deque<GateType> gates;
+    std::deque<MuxerType> muxers;
+    for(Index lvl(0); lvl < num_levels; ++lvl)
+    {
+      gates.emplace_back(comm);
+      gates.back().compile(LocalVectorType(num_nodes(lvl)));
+      muxers.emplace_back();
+    }
+
+    MatrixStockType matrix_stock(num_levels);
+    for(Index lvl(0); lvl < num_levels; ++lvl)
+    {
+      GlobalMatrixType matrix(&gates.at(lvl), &gates.at(lvl));
+      matrix.local().convert(assemble_matrix(lvl));
+      matrix_stock.systems.push_back(std::move(matrix));
+      matrix_stock.gates_row.push_back(&gates.at(lvl));
+      matrix_stock.gates_col.push_back(&gates.at(lvl));
+      matrix_stock.filters.push_back(GlobalFilterType(num_nodes(lvl)));
+      matrix_stock.muxers.push_back(&muxers.at(lvl));
+
+      GlobalTransferType transfer(&muxers.at(lvl));
+      if(lvl + Index(1) < num_levels)
+      {
+        SparseMatrixCSR<Mem::Main, DataType, IndexType> prol(assemble_prol(lvl));
+        transfer.get_mat_prol().convert(prol);
+        transfer.get_mat_rest().convert(prol.transpose());
+      }
+      transfer.compile();
+      matrix_stock.transfers.push_back(std::move(transfer));
+    }
+
+    // write the decisions of the format tuner into its cache file
+    const String cache_file("matrix-stock-test.cache");
+    if(!formats.empty())
+    {
+      std::ofstream ofs(cache_file.c_str(), std::ios_base::out | std::ios_base::trunc);
+      for(Index lvl(0); lvl < num_levels; ++lvl)
+      {
+        const String& format = formats.at(lvl);
+        const std::size_t digit = format.find_first_of("0123456789");
+        ofs << Tuning::matrix_signature(assemble_matrix(lvl)) << " " << format.substr(0, digit) << " "
+          << (digit == String::npos ? String("1") : format.substr(digit)) << " 1e-3" << std::endl;
+      }
+      matrix_stock.tune_cpu_formats = true;
+      matrix_stock.tuning_cache_file = cache_file;
+    }
+
+    // the global smoothers and coarse grid solvers are local solvers wrapped by a schwarz preconditioner
+    std::stringstream config;
+    config << "[linsolver]\n" << "type = pcg\n" << "max_iter = 100\n" << "tol_rel = 1e-10\n" << "precon = mgv\n" << "plot = summary\n";
+    config << "[mgv]\n" << "type = mg\n" << "hierarchy = hier\n" << "lvl_min = -1\n" << "lvl_max = 0\n" << "cycle = v\n";
+    config << "[hier]\n" << "type = hierarchy\n" << "smoother = smoother\n" << "coarse = " << (is_global ? "coarse\n" : "ilu\n");
+    config << "[smoother]\n" << "type = richardson\n" << "min_iter = 2\n" << "max_iter = 2\n" << "precon = " << (is_global ? "schwarz\n" : "ssor\n");
+    config << "[schwarz]\n" << "type = schwarz\n" << "solver = ssor\n";
+    config << "[coarse]\n" << "type = schwarz\n" << "solver = ilu\n";
+    config << "[ssor]\n" << "type = ssor\n";
+    config << "[ilu]\n" << "type = ilu\n";
+    PropertyMap property_map;
+    property_map.read(config);
+
+    auto solver = SolverFactory::create_scalar_solver<MatrixStockType, SolverVectorType>(matrix_stock, &property_map, "linsolver");
+    auto iter_solver = std::dynamic_pointer_cast<IterativeSolver<SolverVectorType>>(solver);
+    TEST_CHECK(iter_solver != nullptr);
+    iter_solver->set_plot_name(name);
+
+    const auto& systems = matrix_stock.template get_systems<SolverVectorType>(nullptr, nullptr, nullptr, nullptr);
+    const auto& filters = matrix_stock.template get_filters<SolverVectorType>(nullptr, nullptr, nullptr, nullptr);
+    if(!formats.empty())
+    {
+      TEST_CHECK_EQUAL(matrix_stock.cpu_formats.size(), std::size_t(num_levels));
+      check_formats(systems, formats);
+      std::remove(cache_file.c_str());
+    }
+
+    PointstarFactoryFD<DataType, IndexType> psf(num_nodes(0), Index(1));
+    SolverVectorType vec_ref(systems.front().create_vector_r());
+    local_of(vec_ref).convert(psf.vector_q2_bubble());
+    SolverVectorType vec_rhs(vec_ref.clone(CloneMode::Layout));
+    SolverVectorType vec_sol(vec_ref.clone(CloneMode::Layout));
+    vec_sol.format();
+    systems.front().apply(vec_rhs, vec_ref);
+
+    matrix_stock.hierarchy_init();
+    solver->init();
+    Status status = Solver::solve(*solver, vec_sol, vec_rhs, systems.front(), filters.front());
+    solver->done();
+    matrix_stock.hierarchy_done();
+    TEST_CHECK_MSG(status_success(status), name + ": apply failed with status = " + stringify(status));
+
+    vec_sol.axpy(vec_ref, vec_sol, -DataType(1));
+    TEST_CHECK_MSG(vec_sol.norm2() <= DataType(1E-8) * vec_ref.norm2(), name + ": failed to reach tolerance");
+
+    const LocalVectorType& err_local = local_of(vec_sol);
+    err.resize(err_local.size());
+    for(Index i(0); i < err_local.size(); ++i)
+      err[i] = err_local(i);
+    return iter_solver->get_num_iter();
+  }
+
+  virtual void run() const override
+  {
+    typedef SparseMatrixCSR<MemType_, DataType, IndexType> CSRType;
+    typedef SparseMatrixDCSR<MemType_, DataType, IndexType> DCSRType;
+    const std::vector<String> no_formats;
+
+    std::vector<DataType> err_csr, err_dcsr;
+    const Index iter_csr = test_stock<CSRType, LocalVectorType>("MG-CSR", no_formats, err_csr);
+    const Index iter_dcsr = test_stock<DCSRType, LocalVectorType>("MG-DCSR", no_formats, err_dcsr);
+
+    // multigrid has to converge independently of the level size
+    TEST_CHECK_MSG(iter_csr <= Index(10), "MG-CSR: performed " + stringify(iter_csr) + " iterations");
+    TEST_CHECK_MSG(iter_dcsr == iter_csr, "MG-DCSR: performed " + stringify(iter_dcsr) + " iterations; expected " + stringify(iter_csr));
+    for(std::size_t i(0); i < err_csr.size(); ++i)
+      TEST_CHECK_EQUAL_WITHIN_EPS(err_dcsr[i], err_csr[i], DataType(1E-12));
+
+    // one format per level; the level sizes 63, 31, 15 and 7 admit only 3x3 blocks on the finest level
+    std::vector<String> formats;
+    formats.push_back("bcsr3");
+    formats.push_back("banded");
+    formats.push_back("ell");
+    formats.push_back("dcsr");
+
+    std::vector<DataType> err_global, err_tuned;
+    const Index iter_global = test_stock<CSRType, GlobalVectorType>("Global-MG-CSR", no_formats, err_global);
+    const Index iter_tuned = test_stock<CSRType, GlobalVectorType>("Global-MG-Tuned", formats, err_tuned);
+    TEST_CHECK_MSG(iter_global <= Index(10), "Global-MG-CSR: performed " + stringify(iter_global) + " iterations");
+    TEST_CHECK_MSG(iter_tuned == iter_global, "Global-MG-Tuned: performed " + stringify(iter_tuned) + " iterations; expected " + stringify(iter_global));
+    for(std::size_t i(0); i < err_global.size(); ++i)
+      TEST_CHECK_EQUAL_WITHIN_EPS(err_tuned[i], err_global[i], DataType(1E-12));
+  }
+};
+
+MatrixStockTest<Mem::Main, double, unsigned long> matrix_stock_test_main_double_ulong;
@@ -19,12 +19,81 @@
 #include <kernel/lafem/unit_filter_blocked.hpp>
 #include <kernel/lafem/sparse_matrix_csr.hpp>
 #include <kernel/lafem/sparse_matrix_bcsr.hpp>
+#include <kernel/lafem/sparse_matrix_dcsr.hpp>
 #include <kernel/lafem/transfer.hpp>
+#include <kernel/lafem/tuning.hpp>
 
 namespace FEAT
 {
   namespace Solver
   {
+    /// \cond internal
+    namespace Intern
+    {
+      /// functor for LAFEM::Tuning::convert_cpu_format, which deploys the converted matrix to a global matrix
+      template<typename GlobalMatrix_>
+      class ApplyFormatDeployer
+      {
+      protected:
+        GlobalMatrix_& _matrix;
+        const String _name;
+
+      public:
+        explicit ApplyFormatDeployer(GlobalMatrix_& matrix, const String& name) :
+          _matrix(matrix),
+          _name(name)
+        {
+        }
+
+        template<typename LocalMatrix_>
+        void operator()(LocalMatrix_&& local_matrix)
+        {
+          typedef typename std::decay<LocalMatrix_>::type LocalMatrixType;
+          typedef Global::ApplyFormat<LocalMatrixType, typename GlobalMatrix_::LocalVectorTypeL,
+            typename GlobalMatrix_::LocalVectorTypeR> ApplyFormatType;
+          _matrix.set_apply_format(std::make_shared<ApplyFormatType>(std::move(local_matrix), _name));
+        }
+      };
+
+      /// the format tuner only applies to scalar CSR matrices in main memory
+      template<typename Systems_>
+      void deploy_cpu_formats(Systems_&, const String&, std::deque<LAFEM::Tuning::FormatInfo>&)
+      {
+      }
+
+      /// tunes and deploys the CPU matrix format of each level
+      template<typename DT_, typename IT_, typename RowMirror_, typename ColMirror_>
+      void deploy_cpu_formats(std::deque<Global::Matrix<LAFEM::SparseMatrixCSR<Mem::Main, DT_, IT_>, RowMirror_, ColMirror_>>& systems,
+        const String& cache_file, std::deque<LAFEM::Tuning::FormatInfo>& formats)
+      {
+        typedef Global::Matrix<LAFEM::SparseMatrixCSR<Mem::Main, DT_, IT_>, RowMirror_, ColMirror_> GlobalMatrixType;
+
+        formats.clear();
+        for(auto& system : systems)
+        {
+          // all processes of a level have to choose the same format
+          const Dist::Comm* comm = system.get_comm();
+          if(comm != nullptr)
+            formats.push_back(LAFEM::Tuning::tune_cpu_format(system.local(), cache_file, *comm));
+          else
+            formats.push_back(LAFEM::Tuning::tune_cpu_format(system.local(), cache_file));
+
+          const LAFEM::Tuning::FormatInfo& info = formats.back();
+          if(info.format == "csr")
+          {
+            system.set_apply_format(nullptr);
+            continue;
+          }
+          String name(info.format);
+          if(info.block_size > 1)
+            name += stringify(info.block_size);
+          ApplyFormatDeployer<GlobalMatrixType> deployer(system, name);
+          LAFEM::Tuning::convert_cpu_format(info, system.local(), deployer);
+        }
+      }
+    } // namespace Intern
+    /// \endcond
+
     /// Stock of matrices, based on global inpupt contains
     template <typename MatrixType_, typename FilterType_, typename TransferType_>
     class MatrixStock
@@ -51,6 +120,21 @@ namespace FEAT
         std::deque<FilterType_> filters;
         std::deque<TransferType_> transfers;
 
+        /**
+         * \brief Specifies whether the CPU matrix format of each level is to be tuned
+         *
+         * If set to \c true before the systems are compiled, each level of the global main memory systems
+         * with scalar CSR matrices is tuned by LAFEM::Tuning::tune_cpu_format over the communicator of its
+         * row gate and its matrix-vector products are performed in the fastest format (CSR, DCSR, ELL,
+         * banded or BCSR), see Global::Matrix::set_apply_format. All other operations, e.g. the SSOR or ILU
+         * smoothers, and the local systems keep using the CSR matrices.
+         */
+        bool tune_cpu_formats;
+        /// the name of the cache file of the format tuner, may be empty
+        String tuning_cache_file;
+        /// the formats chosen for the levels of the most recently compiled main memory systems
+        std::deque<LAFEM::Tuning::FormatInfo> cpu_formats;
+
         using MT_main_float_ulong = typename MatrixType_::template ContainerTypeByMDI<Mem::Main, float, unsigned long>;
         using MT_main_double_ulong = typename MatrixType_::template ContainerTypeByMDI<Mem::Main, double, unsigned long>;
 #ifdef FEAT_HAVE_CUDA
@@ -294,7 +378,9 @@ namespace FEAT
 #endif
 
         explicit MatrixStock(std::size_t size_virt) :
-          size_virtual(size_virt)
+          size_virtual(size_virt),
+          tune_cpu_formats(false),
+          tuning_cache_file()
         {
         }
 
@@ -331,6 +417,9 @@ namespace FEAT
               systems_main_float_ulong.back().convert((*it_row).get(), (*it_col).get(), *system_it);
             }
 
+            if (tune_cpu_formats)
+              Intern::deploy_cpu_formats(systems_main_float_ulong, tuning_cache_file, cpu_formats);
+
             for (auto & filter : filters)
             {
               filters_main_float_ulong.emplace_back();
@@ -375,6 +464,9 @@ namespace FEAT
               systems_main_double_ulong.back().convert((*it_row).get(), (*it_col).get(), *system_it);
             }
 
+            if (tune_cpu_formats)
+              Intern::deploy_cpu_formats(systems_main_double_ulong, tuning_cache_file, cpu_formats);
+
             for (auto & filter : filters)
             {
               filters_main_double_ulong.emplace_back();
@@ -509,6 +601,9 @@ namespace FEAT
               systems_main_float_uint.back().convert((*it_row).get(), (*it_col).get(), *system_it);
             }
 
+            if (tune_cpu_formats)
+              Intern::deploy_cpu_formats(systems_main_float_uint, tuning_cache_file, cpu_formats);
+
             for (auto & filter : filters)
             {
               filters_main_float_uint.emplace_back();
@@ -553,6 +648,9 @@ namespace FEAT
               systems_main_double_uint.back().convert((*it_row).get(), (*it_col).get(), *system_it);
             }
 
+            if (tune_cpu_formats)
+              Intern::deploy_cpu_formats(systems_main_double_uint, tuning_cache_file, cpu_formats);
+
             for (auto & filter : filters)
             {
               filters_main_double_uint.emplace_back();
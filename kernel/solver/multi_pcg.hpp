@@ -0,0 +1,494 @@
+// FEAT3: Finite Element Analysis Toolbox, Version 3
+// Copyright (C) 2010 - 2020 by Stefan Turek & the FEAT group
+// FEAT3 is released under the GNU General Public License version 3,
+// see the file 'copyright.txt' in the top level directory for details.
+
+#pragma once
+#ifndef KERNEL_SOLVER_MULTI_PCG_HPP
+#define KERNEL_SOLVER_MULTI_PCG_HPP 1
+
+// includes, FEAT
+#include <kernel/solver/iterative.hpp>
+
+namespace FEAT
+{
+  namespace Solver
+  {
+    /**
+     * \brief Simultaneous (Preconditioned) Conjugate-Gradient solver for multiple right-hand sides
+     *
+     * This class implements k independent PCG iterations for the k columns of a multi-vector
+     * (see LAFEM::DenseMultiVector), which are advanced in lock-step: each iteration performs a single
+     * matrix-multi-vector product, so that the matrix is streamed only once for all k columns, and all
+     * column-wise dot-products of one reduction are computed in a single sweep and synchronised in a
+     * single message (see Global::Gate::dot_blocked).
+     *
+     * Each column uses its own step sizes alpha and beta, so the iterates are exactly those of k
+     * separate PCG solves.
+     *
+     * The convergence criterion of the IterativeSolver base class is applied to each column separately,
+     * i.e. the defect norm of each column is compared to the initial defect norm of that column, and
+     * the solver succeeds once all columns have converged. Converged columns are frozen by masking
+     * their step sizes to zero, so that the remaining iterations do not alter them anymore.
+     * The divergence, stagnation and iteration count checks as well as the plotted defects refer to the
+     * Frobenius norm of the defect multi-vector, i.e. the euclidean norm over all columns.
+     *
+     * \tparam Matrix_
+     * The matrix class to be used by the solver; must provide an apply overload for Vector_.
+     *
+     * \tparam Filter_
+     * The filter class to be used by the solver.
+     *
+     * \tparam Vector_
+     * The multi-vector class to be used by the solver, e.g. LAFEM::DenseMultiVector or a
+     * Global::Vector thereof.
+     */
+    template<typename Matrix_, typename Filter_, typename Vector_>
+    class MultiPCG :
+      public PreconditionedIterativeSolver<Vector_>
+    {
+    public:
+      /// The type of matrix this solver can be applied to
+      typedef Matrix_ MatrixType;
+      /// The filter for projecting solution, rhs, defect and correction vectors to subspaces
+      typedef Filter_ FilterType;
+      /// The multi-vector type this solver can be applied to
+      typedef Vector_ VectorType;
+      /// The floating point precision
+      typedef typename VectorType::DataType DataType;
+      /// The type of column-wise scalars
+      typedef decltype(std::declval<const VectorType&>().dot_blocked(std::declval<const VectorType&>())) ValueType;
+      /// Our base class
+      typedef PreconditionedIterativeSolver<VectorType> BaseClass;
+      /// The type of the preconditioner that can be used
+      typedef SolverBase<VectorType> PrecondType;
+
+    protected:
+      /// the matrix for the solver
+      const MatrixType& _system_matrix;
+      /// the filter for the solver
+      const FilterType& _system_filter;
+      /// The defect multi-vector
+      VectorType _vec_r;
+      /// The update (or search) directions
+      VectorType _vec_p;
+      /// Temporary multi-vector, used for e.g. the preconditioned defect
+      VectorType _vec_t;
+      /// specifies whether the temporary multi-vectors have been allocated
+      bool _have_vectors;
+      /// the initial defect norms of the columns
+      ValueType _col_def_init;
+      /// the current defect norms of the columns
+      ValueType _col_def_cur;
+      /// the column mask: 1 for active columns, 0 for converged columns
+      ValueType _col_mask;
+
+    public:
+      /**
+       * \brief Constructor
+       *
+       * \param[in] matrix
+       * A reference to the system matrix.
+       *
+       * \param[in] filter
+       * A reference to the system filter.
+       *
+       * \param[in] precond
+       * A pointer to the preconditioner. May be \c nullptr.
+       */
+      explicit MultiPCG(const MatrixType& matrix, const FilterType& filter,
+        std::shared_ptr<PrecondType> precond = nullptr) :
+        BaseClass("MultiPCG", precond),
+        _system_matrix(matrix),
+        _system_filter(filter),
+        _have_vectors(false)
+      {
+        // set communicator by system matrix
+        this->_set_comm_by_matrix(matrix);
+      }
+
+      /**
+       * \brief Constructor using a PropertyMap
+       *
+       * \param[in] section_name
+       * The name of the config section, which it does not know by itself
+       *
+       * \param[in] section
+       * A pointer to the PropertyMap section configuring this solver
+       *
+       * \param[in] matrix
+       * The system matrix.
+       *
+       * \param[in] filter
+       * The system filter.
+       *
+       * \param[in] precond
+       * The preconditioner. May be \c nullptr.
+       */
+      explicit MultiPCG(const String& section_name, PropertyMap* section,
+        const MatrixType& matrix, const FilterType& filter, std::shared_ptr<PrecondType> precond = nullptr) :
+        BaseClass("MultiPCG", section_name, section, precond),
+        _system_matrix(matrix),
+        _system_filter(filter),
+        _have_vectors(false)
+      {
+        // set communicator by system matrix
+        this->_set_comm_by_matrix(matrix);
+      }
+
+      /// \copydoc SolverBase::name()
+      virtual String name() const override
+      {
+        return "MultiPCG";
+      }
+
+      /// \copydoc SolverBase::done_symbolic()
+      virtual void done_symbolic() override
+      {
+        this->_vec_t.clear();
+        this->_vec_p.clear();
+        this->_vec_r.clear();
+        this->_have_vectors = false;
+        BaseClass::done_symbolic();
+      }
+
+      /// \copydoc SolverBase::apply()
+      virtual Status apply(VectorType& vec_cor, const VectorType& vec_def) override
+      {
+        // the number of columns is only known from the vectors, so allocate the temporaries here
+        this->_create_vectors(vec_def);
+
+        // save defect
+        this->_vec_r.copy(vec_def);
+
+        // clear solution vector
+        vec_cor.format();
+
+        // apply solver
+        this->_status = _apply_intern(vec_cor);
+
+        // plot summary
+        this->plot_summary();
+
+        // return status
+        return this->_status;
+      }
+
+      /// \copydoc IterativeSolver::correct()
+      virtual Status correct(VectorType& vec_sol, const VectorType& vec_rhs) override
+      {
+        this->_create_vectors(vec_rhs);
+
+        // compute defect
+        this->_system_matrix.apply(this->_vec_r, vec_sol, vec_rhs, -DataType(1));
+        this->_system_filter.filter_def(this->_vec_r);
+
+        // apply solver
+        this->_status = _apply_intern(vec_sol);
+
+        // plot summary
+        this->plot_summary();
+
+        // return status
+        return this->_status;
+      }
+
+    protected:
+      /// allocates the temporary multi-vectors with the layout of the given vector
+      void _create_vectors(const VectorType& vec)
+      {
+        if(this->_have_vectors)
+          return;
+        this->_vec_r.clone(vec, LAFEM::CloneMode::Layout);
+        this->_vec_p.clone(vec, LAFEM::CloneMode::Layout);
+        this->_vec_t.clone(vec, LAFEM::CloneMode::Layout);
+        this->_have_vectors = true;
+      }
+
+      /// computes the column-wise defect norms and returns their Frobenius norm
+      virtual DataType _calc_def_norm(const VectorType& vec_def, const VectorType& DOXY(vec_sol)) override
+      {
+        const ValueType def_sqr = vec_def.dot_blocked(vec_def);
+        DataType def_frob(0);
+        for(int j(0); j < ValueType::n; ++j)
+        {
+          this->_col_def_cur[j] = Math::sqrt(Math::abs(def_sqr[j]));
+          def_frob += Math::abs(def_sqr[j]);
+        }
+        return Math::sqrt(def_frob);
+      }
+
+      /// checks whether column j has converged
+      bool _is_col_converged(int j) const
+      {
+        const DataType def_cur = this->_col_def_cur[j];
+        return (def_cur <= this->_tol_abs) && ((def_cur <= (this->_tol_rel * this->_col_def_init[j])) ||
+          (def_cur <= this->_tol_abs_low) || (this->_col_def_init[j] <= Math::sqr(Math::eps<DataType>())));
+      }
+
+      /// masks out all converged columns and returns the number of active columns
+      int _update_col_mask()
+      {
+        int num_active(0);
+        for(int j(0); j < ValueType::n; ++j)
+        {
+          if(this->_is_col_converged(j))
+            this->_col_mask[j] = DataType(0);
+          else
+            ++num_active;
+        }
+        return num_active;
+      }
+
+      /// \copydoc IterativeSolver::_set_new_defect()
+      virtual Status _set_new_defect(const VectorType& vec_def, const VectorType& vec_sol) override
+      {
+        // the column-wise convergence control always needs the column defects
+        ++this->_num_iter;
+        this->_def_prev = this->_def_cur;
+        this->_def_cur = this->_calc_def_norm(vec_def, vec_sol);
+        Statistics::add_solver_expression(ExpressionDefect(this->expression_name(), this->_def_cur, this->get_num_iter()));
+
+        // analyse defect
+        Status status = this->_analyse_defect(this->_num_iter, this->_def_cur, this->_def_prev, true);
+
+        // plot defect?
+        if(this->_plot_iter(status))
+          this->_plot_iter_line(this->_num_iter, this->_def_cur, this->_def_prev);
+
+        return status;
+      }
+
+      /// \copydoc IterativeSolver::_analyse_defect()
+      virtual Status _analyse_defect(Index num_iter, DataType def_cur, DataType def_prev, bool check_stag) override
+      {
+        // freeze all columns which have converged
+        const int num_active = this->_update_col_mask();
+
+        // ensure that the defect is neither NaN nor infinity
+        if(!Math::isfinite(def_cur))
+          return Status::aborted;
+
+        // is diverged?
+        if(this->is_diverged(def_cur))
+          return Status::diverged;
+
+        // minimum number of iterations performed?
+        if(num_iter < this->_min_iter)
+          return Status::progress;
+
+        // have all columns converged?
+        if(num_active == 0)
+          return Status::success;
+
+        // maximum number of iterations performed?
+        if(num_iter >= this->_max_iter)
+          return Status::max_iter;
+
+        // check for stagnation?
+        if(check_stag && (this->_min_stag_iter > Index(0)))
+        {
+          // did this iteration stagnate?
+          if(def_cur >= this->_stag_rate * def_prev)
+          {
+            // increment stagnation count
+            if(++this->_num_stag_iter >= this->_min_stag_iter)
+              return Status::stagnated;
+          }
+          else
+          {
+            // this iteration did not stagnate
+            this->_num_stag_iter = Index(0);
+          }
+        }
+
+        // continue iterating
+        return Status::progress;
+      }
+
+      /// computes the column-wise quotients num/den, which are set to zero for vanishing columns
+      static ValueType _safe_div(const ValueType& num, const ValueType& den)
+      {
+        ValueType q(num);
+        for(int j(0); j < ValueType::n; ++j)
+        {
+          if((Math::abs(den[j]) > Math::tiny<DataType>()) && (num[j] != DataType(0)))
+            q[j] = num[j] / den[j];
+          else
+            q[j] = DataType(0);
+        }
+        return q;
+      }
+
+      /**
+       * \brief Internal function, applies the solver
+       *
+       * \param[in] vec_sol
+       * The current solution multi-vector, gets overwritten
+       *
+       * \returns A status code.
+       */
+      virtual Status _apply_intern(VectorType& vec_sol)
+      {
+        IterationStats pre_iter(*this);
+        Statistics::add_solver_expression(ExpressionStartSolve(this->expression_name()));
+
+        const MatrixType& matrix(this->_system_matrix);
+        const FilterType& filter(this->_system_filter);
+        VectorType& vec_r(this->_vec_r);
+        VectorType& vec_p(this->_vec_p);
+        // Note: q and z are temporary vectors whose usage does
+        // not overlap, so we use the same vector for them
+        VectorType& vec_q(this->_vec_t);
+        VectorType& vec_z(this->_vec_t);
+
+        // set initial defect:
+        // R[0] := B - A*X[0]
+        Status status = this->_set_initial_defect(vec_r, vec_sol);
+
+        // all columns are active initially, unless their initial defect vanishes
+        this->_col_def_init = this->_col_def_cur;
+        this->_col_mask = ValueType(DataType(1));
+        if((status == Status::progress) && (this->_update_col_mask() == 0))
+          status = Status::success;
+        if(status != Status::progress)
+        {
+          pre_iter.destroy();
+          Statistics::add_solver_expression(ExpressionEndSolve(this->expression_name(), status, this->get_num_iter()));
+          return status;
+        }
+
+        // apply preconditioner to defect multi-vector
+        // P[0] := M^{-1} * R[0]
+        if(!this->_apply_precond(vec_p, vec_r, filter))
+        {
+          pre_iter.destroy();
+          Statistics::add_solver_expression(ExpressionEndSolve(this->expression_name(), Status::aborted, this->get_num_iter()));
+          return Status::aborted;
+        }
+
+        // compute initial column-wise gamma:
+        // gamma_j[0] := < r_j[0], p_j[0] >
+        ValueType gamma = vec_r.dot_blocked(vec_p);
+
+        pre_iter.destroy();
+
+        // start iterating
+        while(status == Status::progress)
+        {
+          IterationStats stat(*this);
+
+          // Q[k] := A*P[k]
+          matrix.apply(vec_q, vec_p);
+          filter.filter_def(vec_q);
+
+          // compute column-wise alpha and mask out converged columns
+          // alpha_j[k] := gamma_j[k] / < q_j[k], p_j[k] >
+          ValueType alpha = _safe_div(gamma, vec_q.dot_blocked(vec_p));
+          for(int j(0); j < ValueType::n; ++j)
+            alpha[j] *= this->_col_mask[j];
+
+          // update solution multi-vector:
+          // x_j[k+1] := x_j[k] + alpha_j[k] * p_j[k]
+          vec_sol.axpy_blocked(vec_p, vec_sol, alpha);
+
+          // update defect multi-vector:
+          // r_j[k+1] := r_j[k] - alpha_j[k] * q_j[k]
+          vec_r.axpy_blocked(vec_q, vec_r, alpha * DataType(-1));
+
+          // compute defect norm
+          status = this->_set_new_defect(vec_r, vec_sol);
+          if(status != Status::progress)
+          {
+            stat.destroy();
+            Statistics::add_solver_expression(ExpressionEndSolve(this->expression_name(), status, this->get_num_iter()));
+            return status;
+          }
+
+          // apply preconditioner
+          // Z[k+1] := M^{-1} * R[k+1]
+          if(!this->_apply_precond(vec_z, vec_r, filter))
+          {
+            stat.destroy();
+            Statistics::add_solver_expression(ExpressionEndSolve(this->expression_name(), Status::aborted, this->get_num_iter()));
+            return Status::aborted;
+          }
+
+          // compute new column-wise gamma:
+          // gamma_j[k+1] := < r_j[k+1] , z_j[k+1] >
+          const ValueType gamma2 = gamma;
+          gamma = vec_r.dot_blocked(vec_z);
+
+          // compute column-wise beta and mask out converged columns:
+          // beta_j[k] := gamma_j[k+1] / gamma_j[k]
+          ValueType beta = _safe_div(gamma, gamma2);
+          for(int j(0); j < ValueType::n; ++j)
+            beta[j] *= this->_col_mask[j];
+
+          // update direction multi-vector:
+          // p_j[k+1] := z_j[k+1] + beta_j[k] * p_j[k]
+          vec_p.axpy_blocked(vec_p, vec_z, beta);
+        }
+
+        // we should never reach this point...
+        Statistics::add_solver_expression(ExpressionEndSolve(this->expression_name(), Status::undefined, this->get_num_iter()));
+        return Status::undefined;
+      }
+    }; // class MultiPCG<...>
+
+    /**
+     * \brief Creates a new MultiPCG solver object
+     *
+     * \param[in] matrix
+     * The system matrix.
+     *
+     * \param[in] filter
+     * The system filter.
+     *
+     * \param[in] precond
+     * The preconditioner. May be \c nullptr.
+     *
+     * \returns
+     * A shared pointer to a new MultiPCG object.
+     */
+    template<typename Vector_, typename Matrix_, typename Filter_>
+    inline std::shared_ptr<MultiPCG<Matrix_, Filter_, Vector_>> new_multi_pcg(
+      const Matrix_& matrix, const Filter_& filter,
+      std::shared_ptr<SolverBase<Vector_>> precond = nullptr)
+    {
+      return std::make_shared<MultiPCG<Matrix_, Filter_, Vector_>>(matrix, filter, precond);
+    }
+
+    /**
+     * \brief Creates a new MultiPCG solver object using a PropertyMap
+     *
+     * \param[in] section_name
+     * The name of the config section, which it does not know by itself
+     *
+     * \param[in] section
+     * A pointer to the PropertyMap section configuring this solver
+     *
+     * \param[in] matrix
+     * The system matrix.
+     *
+     * \param[in] filter
+     * The system filter.
+     *
+     * \param[in] precond
+     * The preconditioner. May be \c nullptr.
+     *
+     * \returns
+     * A shared pointer to a new MultiPCG object.
+     */
+    template<typename Vector_, typename Matrix_, typename Filter_>
+    inline std::shared_ptr<MultiPCG<Matrix_, Filter_, Vector_>> new_multi_pcg(
+      const String& section_name, PropertyMap* section,
+      const Matrix_& matrix, const Filter_& filter,
+      std::shared_ptr<SolverBase<Vector_>> precond = nullptr)
+    {
+      return std::make_shared<MultiPCG<Matrix_, Filter_, Vector_>>(section_name, section, matrix, filter, precond);
+    }
+  } // namespace Solver
+} // namespace FEAT
+
+#endif // KERNEL_SOLVER_MULTI_PCG_HPP
@@ -1100,6 +1100,8 @@ namespace FEAT
       void set_cycle(MultiGridCycle cycle)
       {
         _cycle = cycle;
+        // the name depends on the cycle
+        this->_expression_id = ExpressionName::no_id;
       }
 
       /**
@@ -1267,7 +1269,7 @@ namespace FEAT
        */
       virtual Status apply(VectorType& vec_cor, const VectorType& vec_def) override
       {
-        Statistics::add_solver_expression(std::make_shared<ExpressionStartSolve>(this->name()));
+        Statistics::add_solver_expression(ExpressionStartSolve(this->expression_name()));
 
         // reset statistics counters
         for(std::size_t i(0); i <  std::size_t(_hierarchy->size_virtual()); ++i)
@@ -1307,7 +1309,7 @@ namespace FEAT
 
         default:
           // whoops...
-          Statistics::add_solver_expression(std::make_shared<ExpressionEndSolve>(this->name(), Status::aborted, 1));
+          Statistics::add_solver_expression(ExpressionEndSolve(this->expression_name(), Status::aborted, 1));
           status = Status::aborted;
           break;
         }
@@ -1318,13 +1320,13 @@ namespace FEAT
         // propagate solver statistics
         for(std::size_t i(0); i <  std::size_t(_hierarchy->size_virtual()); ++i)
         {
-          Statistics::add_solver_expression(std::make_shared<ExpressionLevelTimings>(this->name(), Index(i),
+          Statistics::add_solver_expression(ExpressionLevelTimings(this->expression_name(), Index(i),
             _toes.at(i), _mpi_execs_reduction.at(i), _mpi_execs_blas2.at(i), _mpi_execs_blas3.at(i), _mpi_execs_collective.at(i), _mpi_waits_reduction.at(i), _mpi_waits_blas2.at(i),
             _mpi_waits_blas3.at(i), _mpi_waits_collective.at(i)));
         }
 
         // okay
-        Statistics::add_solver_expression(std::make_shared<ExpressionEndSolve>(this->name(), Status::success, 1));
+        Statistics::add_solver_expression(ExpressionEndSolve(this->expression_name(), Status::success, 1));
         return status;
       }
 
@@ -1551,7 +1553,7 @@ namespace FEAT
         TimeStamp stamp_coarse;
         if(coarse_solver)
         {
-          Statistics::add_solver_expression(std::make_shared<ExpressionCallCoarseSolver>(this->name(), coarse_solver->name()));
+          Statistics::add_solver_expression(ExpressionCallCoarseSolver(this->expression_name(), coarse_solver->expression_name()));
           if(!status_success(coarse_solver->apply(lvl_crs.vec_sol, lvl_crs.vec_rhs)))
             return Status::aborted;
         }
@@ -1597,7 +1599,7 @@ namespace FEAT
 
         // apply peak-smoother
         TimeStamp stamp_smooth;
-        Statistics::add_solver_expression(std::make_shared<ExpressionCallSmoother>(this->name(), smoother.name()));
+        Statistics::add_solver_expression(ExpressionCallSmoother(this->expression_name(), smoother.expression_name()));
         smoother.apply(lvl.vec_cor, lvl.vec_def);
         //if(!status_success(smoother.apply(lvl.vec_cor, lvl.vec_def)))
           //return false;
@@ -1747,7 +1749,7 @@ namespace FEAT
             {
               // apply pre-smoother
               TimeStamp stamp_smooth;
-              Statistics::add_solver_expression(std::make_shared<ExpressionCallSmoother>(this->name(), smoother->name()));
+              Statistics::add_solver_expression(ExpressionCallSmoother(this->expression_name(), smoother->expression_name()));
               smoother->apply(lvl_f.vec_sol, lvl_f.vec_rhs);
               //if(!status_success(smoother->apply(lvl_f.vec_sol, lvl_f.vec_rhs)))
                 //return Status::aborted;
@@ -1794,7 +1796,7 @@ namespace FEAT
             const FilterType& system_filter_c = lvl_c.level->get_system_filter();
 
             // restrict onto coarse level
-            //Statistics::add_solver_expression(std::make_shared<ExpressionRestriction>(this->name(), i));
+            //Statistics::add_solver_expression(ExpressionRestriction(this->expression_name(), i));
             TimeStamp stamp_rest;
             transfer_operator->rest(lvl_f.vec_def, lvl_c.vec_rhs);
             lvl_f.time_transfer += stamp_rest.elapsed_now();
@@ -1964,7 +1966,7 @@ namespace FEAT
             }
 
             // apply post-smoother
-            Statistics::add_solver_expression(std::make_shared<ExpressionCallSmoother>(this->name(), smoother->name()));
+            Statistics::add_solver_expression(ExpressionCallSmoother(this->expression_name(), smoother->expression_name()));
             TimeStamp stamp_smooth;
             smoother->apply(lvl_f.vec_cor, lvl_f.vec_def);
             //if(!status_success(smoother->apply(lvl_f.vec_cor, lvl_f.vec_def)))
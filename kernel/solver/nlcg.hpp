@@ -424,7 +424,7 @@ namespace FEAT
         virtual Status _apply_intern(VectorType& vec_sol)
         {
           IterationStats pre_iter(*this);
-          Statistics::add_solver_expression(std::make_shared<ExpressionStartSolve>(this->name()));
+          Statistics::add_solver_expression(ExpressionStartSolve(this->expression_name()));
 
           // p[k+1] <- r[k+1] + _beta * p[k+1]
           DataType beta;
@@ -442,14 +442,14 @@ namespace FEAT
           Status status = this->_set_initial_defect(this->_vec_r, vec_sol);
           if(status != Status::progress)
           {
-            Statistics::add_solver_expression(std::make_shared<ExpressionEndSolve>(this->name(), status, this->get_num_iter()));
+            Statistics::add_solver_expression(ExpressionEndSolve(this->expression_name(), status, this->get_num_iter()));
             return status;
           }
 
           // apply preconditioner to defect vector
           if(!this->_apply_precond(this->_vec_z, this->_vec_r, this->_filter))
           {
-            Statistics::add_solver_expression(std::make_shared<ExpressionEndSolve>(this->name(), Status::aborted, this->get_num_iter()));
+            Statistics::add_solver_expression(ExpressionEndSolve(this->expression_name(), Status::aborted, this->get_num_iter()));
             return Status::aborted;
           }
           //this->_vec_z.copy(this->_vec_r);
@@ -480,7 +480,7 @@ namespace FEAT
 
           if(this->_def_init <= this->_tol_rel)
           {
-            Statistics::add_solver_expression(std::make_shared<ExpressionEndSolve>(this->name(), Status::success, this->get_num_iter()));
+            Statistics::add_solver_expression(ExpressionEndSolve(this->expression_name(), Status::success, this->get_num_iter()));
             return Status::success;
           }
 
@@ -535,7 +535,7 @@ namespace FEAT
             if(status != Status::progress)
             {
               stat.destroy();
-              Statistics::add_solver_expression(std::make_shared<ExpressionEndSolve>(this->name(), status, this->get_num_iter()));
+              Statistics::add_solver_expression(ExpressionEndSolve(this->expression_name(), status, this->get_num_iter()));
               return status;
             }
 
@@ -549,7 +549,7 @@ namespace FEAT
             if(!this->_apply_precond(_vec_z, _vec_r, this->_filter))
             {
               stat.destroy();
-              Statistics::add_solver_expression(std::make_shared<ExpressionEndSolve>(this->name(), Status::aborted, this->get_num_iter()));
+              Statistics::add_solver_expression(ExpressionEndSolve(this->expression_name(), Status::aborted, this->get_num_iter()));
               return Status::aborted;
             }
 
@@ -617,7 +617,7 @@ namespace FEAT
           }
 
           // We should never come to this point
-          Statistics::add_solver_expression(std::make_shared<ExpressionEndSolve>(this->name(), Status::undefined, this->get_num_iter()));
+          Statistics::add_solver_expression(ExpressionEndSolve(this->expression_name(), Status::undefined, this->get_num_iter()));
           return Status::undefined;
         }
 
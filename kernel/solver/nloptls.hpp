@@ -279,7 +279,7 @@ namespace FEAT
           _ls_its = Index(0);
 
           Statistics::add_solver_expression(
-            std::make_shared<ExpressionDefect>(this->name(), this->_def_init, this->get_num_iter()));
+            ExpressionDefect(this->expression_name(), this->_def_init, this->get_num_iter()));
 
           if(this->_plot_iter())
           {
@@ -340,7 +340,7 @@ namespace FEAT
           {
             this->_def_cur = this->_calc_def_norm(vec_r, vec_sol);
             Statistics::add_solver_expression(
-              std::make_shared<ExpressionDefect>(this->name(), this->_def_cur, this->get_num_iter()));
+              ExpressionDefect(this->expression_name(), this->_def_cur, this->get_num_iter()));
           }
 
           // plot?
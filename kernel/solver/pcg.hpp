@@ -188,7 +188,7 @@ namespace FEAT
       virtual Status _apply_intern(VectorType& vec_sol)
       {
         IterationStats pre_iter(*this);
-        Statistics::add_solver_expression(std::make_shared<ExpressionStartSolve>(this->name()));
+        Statistics::add_solver_expression(ExpressionStartSolve(this->expression_name()));
 
         const MatrixType& matrix(this->_system_matrix);
         const FilterType& filter(this->_system_filter);
@@ -210,7 +210,7 @@ namespace FEAT
         if(status != Status::progress)
         {
           pre_iter.destroy();
-          Statistics::add_solver_expression(std::make_shared<ExpressionEndSolve>(this->name(), status, this->get_num_iter()));
+          Statistics::add_solver_expression(ExpressionEndSolve(this->expression_name(), status, this->get_num_iter()));
           return status;
         }
 
@@ -219,7 +219,7 @@ namespace FEAT
         if(!this->_apply_precond(vec_p, vec_r, filter))
         {
           pre_iter.destroy();
-          Statistics::add_solver_expression(std::make_shared<ExpressionEndSolve>(this->name(), Status::aborted, this->get_num_iter()));
+          Statistics::add_solver_expression(ExpressionEndSolve(this->expression_name(), Status::aborted, this->get_num_iter()));
           return Status::aborted;
         }
 
@@ -255,7 +255,7 @@ namespace FEAT
           if(status != Status::progress)
           {
             stat.destroy();
-            Statistics::add_solver_expression(std::make_shared<ExpressionEndSolve>(this->name(), status, this->get_num_iter()));
+            Statistics::add_solver_expression(ExpressionEndSolve(this->expression_name(), status, this->get_num_iter()));
             return status;
           }
 
@@ -264,7 +264,7 @@ namespace FEAT
           if(!this->_apply_precond(vec_z, vec_r, filter))
           {
             stat.destroy();
-            Statistics::add_solver_expression(std::make_shared<ExpressionEndSolve>(this->name(), Status::aborted, this->get_num_iter()));
+            Statistics::add_solver_expression(ExpressionEndSolve(this->expression_name(), Status::aborted, this->get_num_iter()));
             return Status::aborted;
           }
 
@@ -283,7 +283,7 @@ namespace FEAT
         }
 
         // we should never reach this point...
-        Statistics::add_solver_expression(std::make_shared<ExpressionEndSolve>(this->name(), Status::undefined, this->get_num_iter()));
+        Statistics::add_solver_expression(ExpressionEndSolve(this->expression_name(), Status::undefined, this->get_num_iter()));
         return Status::undefined;
       }
     }; // class PCG<...>
@@ -240,7 +240,7 @@ namespace FEAT
       {
         if(_precond_l)
         {
-          Statistics::add_solver_expression(std::make_shared<ExpressionCallPrecond>(this->name(), this->_precond_l->name()));
+          Statistics::add_solver_expression(ExpressionCallPrecond(this->expression_name(), this->_precond_l->expression_name()));
           return status_success(_precond_l->apply(vec_cor, vec_def));
         }
         vec_cor.copy(vec_def);
@@ -252,7 +252,7 @@ namespace FEAT
       {
         if(_precond_r)
         {
-          Statistics::add_solver_expression(std::make_shared<ExpressionCallPrecond>(this->name(), this->_precond_r->name()));
+          Statistics::add_solver_expression(ExpressionCallPrecond(this->expression_name(), this->_precond_r->expression_name()));
           return status_success(_precond_r->apply(vec_cor, vec_def));
         }
         vec_cor.copy(vec_def);
@@ -262,7 +262,7 @@ namespace FEAT
 
       virtual Status _apply_intern(VectorType& vec_sol)
       {
-        Statistics::add_solver_expression(std::make_shared<ExpressionStartSolve>(this->name()));
+        Statistics::add_solver_expression(ExpressionStartSolve(this->expression_name()));
 
         const MatrixType& matrix(this->_system_matrix);
         const MatrixType& transp(this->_transp_matrix);
@@ -281,7 +281,7 @@ namespace FEAT
         Status status = this->_set_initial_defect(vec_r, vec_sol);
         if(status != Status::progress)
         {
-          Statistics::add_solver_expression(std::make_shared<ExpressionEndSolve>(this->name(), status, this->get_num_iter()));
+          Statistics::add_solver_expression(ExpressionEndSolve(this->expression_name(), status, this->get_num_iter()));
           return status;
         }
 
@@ -289,7 +289,7 @@ namespace FEAT
         // p[0] := M_L^{-1} * r[0]
         if(!this->_apply_precond_l(vec_p, vec_r))
         {
-          Statistics::add_solver_expression(std::make_shared<ExpressionEndSolve>(this->name(), Status::aborted, this->get_num_iter()));
+          Statistics::add_solver_expression(ExpressionEndSolve(this->expression_name(), Status::aborted, this->get_num_iter()));
           return Status::aborted;
         }
 
@@ -301,7 +301,7 @@ namespace FEAT
         // q[0] := M_R^{-1} * s[0]
         if(!this->_apply_precond_r(vec_q, vec_s))
         {
-          Statistics::add_solver_expression(std::make_shared<ExpressionEndSolve>(this->name(), Status::aborted, this->get_num_iter()));
+          Statistics::add_solver_expression(ExpressionEndSolve(this->expression_name(), Status::aborted, this->get_num_iter()));
           return Status::aborted;
         }
 
@@ -321,7 +321,7 @@ namespace FEAT
           // z[k] := M_L^{-1} * y[k]
           if(!this->_apply_precond_l(vec_z, vec_y))
           {
-            Statistics::add_solver_expression(std::make_shared<ExpressionEndSolve>(this->name(), Status::aborted, this->get_num_iter()));
+            Statistics::add_solver_expression(ExpressionEndSolve(this->expression_name(), Status::aborted, this->get_num_iter()));
             return Status::aborted;
           }
 
@@ -341,7 +341,7 @@ namespace FEAT
           status = this->_set_new_defect(vec_r, vec_sol);
           if(status != Status::progress)
           {
-            Statistics::add_solver_expression(std::make_shared<ExpressionEndSolve>(this->name(), status, this->get_num_iter()));
+            Statistics::add_solver_expression(ExpressionEndSolve(this->expression_name(), status, this->get_num_iter()));
             return status;
           }
 
@@ -355,7 +355,7 @@ namespace FEAT
           // t[k+1] := M_R^{-1} * s[k+1]
           if(!this->_apply_precond_r(vec_t, vec_s))
           {
-            Statistics::add_solver_expression(std::make_shared<ExpressionEndSolve>(this->name(), Status::aborted, this->get_num_iter()));
+            Statistics::add_solver_expression(ExpressionEndSolve(this->expression_name(), Status::aborted, this->get_num_iter()));
             return Status::aborted;
           }
 
@@ -374,7 +374,7 @@ namespace FEAT
         }
 
         // we should never reach this point...
-        Statistics::add_solver_expression(std::make_shared<ExpressionEndSolve>(this->name(), Status::undefined, this->get_num_iter()));
+        Statistics::add_solver_expression(ExpressionEndSolve(this->expression_name(), Status::undefined, this->get_num_iter()));
         return Status::undefined;
       }
     }; // class PCGNR<...>
@@ -249,7 +249,7 @@ namespace FEAT
 
       virtual Status _apply_intern(VectorType& vec_x)
       {
-        Statistics::add_solver_expression(std::make_shared<ExpressionStartSolve>(this->name()));
+        Statistics::add_solver_expression(ExpressionStartSolve(this->expression_name()));
 
         const MatrixType& matrix(this->_system_matrix);
         const MatrixType& transp(this->_transp_matrix);
@@ -268,7 +268,7 @@ namespace FEAT
         Status status = this->_set_initial_defect(vec_r, vec_x);
         if(status != Status::progress)
         {
-          Statistics::add_solver_expression(std::make_shared<ExpressionEndSolve>(this->name(), status, this->get_num_iter()));
+          Statistics::add_solver_expression(ExpressionEndSolve(this->expression_name(), status, this->get_num_iter()));
           return status;
         }
 
@@ -320,7 +320,7 @@ namespace FEAT
           status = this->_set_new_defect(vec_r, vec_x);
           if(status != Status::progress)
           {
-            Statistics::add_solver_expression(std::make_shared<ExpressionEndSolve>(this->name(), status, this->get_num_iter()));
+            Statistics::add_solver_expression(ExpressionEndSolve(this->expression_name(), status, this->get_num_iter()));
             return status;
           }
 
@@ -350,7 +350,7 @@ namespace FEAT
         }
 
         // we should never reach this point...
-        Statistics::add_solver_expression(std::make_shared<ExpressionEndSolve>(this->name(), Status::undefined, this->get_num_iter()));
+        Statistics::add_solver_expression(ExpressionEndSolve(this->expression_name(), Status::undefined, this->get_num_iter()));
         return Status::undefined;
       }
     }; // class PCGNRILU<...>
@@ -168,7 +168,7 @@ namespace FEAT
     protected:
       virtual Status _apply_intern(VectorType& vec_sol)
       {
-        Statistics::add_solver_expression(std::make_shared<ExpressionStartSolve>(this->name()));
+        Statistics::add_solver_expression(ExpressionStartSolve(this->expression_name()));
         const MatrixType& matrix(this->_system_matrix);
         const FilterType& filter(this->_system_filter);
         VectorType& vec_p(this->_vec_p);
@@ -192,7 +192,7 @@ namespace FEAT
         Status status = this->_set_initial_defect(vec_r, vec_sol);
         if(status != Status::progress)
         {
-          Statistics::add_solver_expression(std::make_shared<ExpressionEndSolve>(this->name(), status, this->get_num_iter()));
+          Statistics::add_solver_expression(ExpressionEndSolve(this->expression_name(), status, this->get_num_iter()));
           return status;
         }
 
@@ -200,7 +200,7 @@ namespace FEAT
         // s[0] := M^{-1} * r[0]
         if(!this->_apply_precond(vec_s, vec_r, filter))
         {
-          Statistics::add_solver_expression(std::make_shared<ExpressionEndSolve>(this->name(), Status::aborted, this->get_num_iter()));
+          Statistics::add_solver_expression(ExpressionEndSolve(this->expression_name(), Status::aborted, this->get_num_iter()));
           return Status::aborted;
         }
 
@@ -224,7 +224,7 @@ namespace FEAT
           // z[k] := M^{-1} * q[k]
           if(!this->_apply_precond(vec_z, vec_q, filter))
           {
-            Statistics::add_solver_expression(std::make_shared<ExpressionEndSolve>(this->name(), Status::aborted, this->get_num_iter()));
+            Statistics::add_solver_expression(ExpressionEndSolve(this->expression_name(), Status::aborted, this->get_num_iter()));
             return Status::aborted;
           }
 
@@ -244,7 +244,7 @@ namespace FEAT
           status = this->_set_new_defect(vec_r, vec_sol);
           if(status != Status::progress)
           {
-            Statistics::add_solver_expression(std::make_shared<ExpressionEndSolve>(this->name(), status, this->get_num_iter()));
+            Statistics::add_solver_expression(ExpressionEndSolve(this->expression_name(), status, this->get_num_iter()));
             return status;
           }
 
@@ -275,7 +275,7 @@ namespace FEAT
 
         // we should never reach this point...
         {
-          Statistics::add_solver_expression(std::make_shared<ExpressionEndSolve>(this->name(), Status::undefined, this->get_num_iter()));
+          Statistics::add_solver_expression(ExpressionEndSolve(this->expression_name(), Status::undefined, this->get_num_iter()));
           return Status::undefined;
         }
       }
@@ -182,7 +182,7 @@ namespace FEAT
       virtual Status _apply_intern(VectorType& vec_sol)
       {
         IterationStats pre_iter(*this);
-        Statistics::add_solver_expression(std::make_shared<ExpressionStartSolve>(this->name()));
+        Statistics::add_solver_expression(ExpressionStartSolve(this->expression_name()));
 
         const MatrixType& matrix(this->_system_matrix);
         const FilterType& filter(this->_system_filter);
@@ -207,14 +207,14 @@ namespace FEAT
         if(status != Status::progress)
         {
           pre_iter.destroy();
-          Statistics::add_solver_expression(std::make_shared<ExpressionEndSolve>(this->name(), status, this->get_num_iter()));
+          Statistics::add_solver_expression(ExpressionEndSolve(this->expression_name(), status, this->get_num_iter()));
           return status;
         }
 
         if(!this->_apply_precond(vec_u, vec_r, filter))
         {
           pre_iter.destroy();
-          Statistics::add_solver_expression(std::make_shared<ExpressionEndSolve>(this->name(), Status::aborted, this->get_num_iter()));
+          Statistics::add_solver_expression(ExpressionEndSolve(this->expression_name(), Status::aborted, this->get_num_iter()));
           return Status::aborted;
         }
 
@@ -235,7 +235,7 @@ namespace FEAT
           if(!this->_apply_precond(vec_m, vec_w, filter))
           {
             stat.destroy();
-            Statistics::add_solver_expression(std::make_shared<ExpressionEndSolve>(this->name(), Status::aborted, this->get_num_iter()));
+            Statistics::add_solver_expression(ExpressionEndSolve(this->expression_name(), Status::aborted, this->get_num_iter()));
             return Status::aborted;
           }
 
@@ -249,7 +249,7 @@ namespace FEAT
           if(status != Status::progress)
           {
             stat.destroy();
-            Statistics::add_solver_expression(std::make_shared<ExpressionEndSolve>(this->name(), status, this->get_num_iter()));
+            Statistics::add_solver_expression(ExpressionEndSolve(this->expression_name(), status, this->get_num_iter()));
             return status;
           }
 
@@ -294,7 +294,7 @@ namespace FEAT
         }
 
         // we should never reach this point...
-        Statistics::add_solver_expression(std::make_shared<ExpressionEndSolve>(this->name(), Status::undefined, this->get_num_iter()));
+        Statistics::add_solver_expression(ExpressionEndSolve(this->expression_name(), Status::undefined, this->get_num_iter()));
         return Status::undefined;
       }
 
@@ -174,7 +174,7 @@ namespace FEAT
       virtual Status _apply_intern(VectorType& vec_sol)
       {
         IterationStats pre_iter(*this);
-        Statistics::add_solver_expression(std::make_shared<ExpressionStartSolve>(this->name()));
+        Statistics::add_solver_expression(ExpressionStartSolve(this->expression_name()));
 
         const MatrixType& matrix(this->_system_matrix);
         const FilterType& filter(this->_system_filter);
@@ -188,7 +188,7 @@ namespace FEAT
         Status status = this->_set_initial_defect(vec_r, vec_sol);
         if(status != Status::progress)
         {
-          Statistics::add_solver_expression(std::make_shared<ExpressionEndSolve>(this->name(), status, this->get_num_iter()));
+          Statistics::add_solver_expression(ExpressionEndSolve(this->expression_name(), status, this->get_num_iter()));
           return status;
         }
 
@@ -196,7 +196,7 @@ namespace FEAT
         // s[0] := M^{-1} * r[0]
         if(!this->_apply_precond(vec_s, vec_r, filter))
         {
-          Statistics::add_solver_expression(std::make_shared<ExpressionEndSolve>(this->name(), Status::aborted, this->get_num_iter()));
+          Statistics::add_solver_expression(ExpressionEndSolve(this->expression_name(), Status::aborted, this->get_num_iter()));
           return Status::aborted;
         }
         pre_iter.destroy();
@@ -215,7 +215,7 @@ namespace FEAT
           if(!this->_apply_precond(vec_z, vec_q, filter))
           {
             stat.destroy();
-            Statistics::add_solver_expression(std::make_shared<ExpressionEndSolve>(this->name(), Status::aborted, this->get_num_iter()));
+            Statistics::add_solver_expression(ExpressionEndSolve(this->expression_name(), Status::aborted, this->get_num_iter()));
             return Status::aborted;
           }
 
@@ -235,7 +235,7 @@ namespace FEAT
           if(status != Status::progress)
           {
             stat.destroy();
-            Statistics::add_solver_expression(std::make_shared<ExpressionEndSolve>(this->name(), status, this->get_num_iter()));
+            Statistics::add_solver_expression(ExpressionEndSolve(this->expression_name(), status, this->get_num_iter()));
             return status;
           }
 
@@ -245,7 +245,7 @@ namespace FEAT
         }
 
         // we should never reach this point...
-        Statistics::add_solver_expression(std::make_shared<ExpressionEndSolve>(this->name(), Status::undefined, this->get_num_iter()));
+        Statistics::add_solver_expression(ExpressionEndSolve(this->expression_name(), Status::undefined, this->get_num_iter()));
         return Status::undefined;
       }
     }; // class PMR<...>
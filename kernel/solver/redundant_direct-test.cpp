@@ -0,0 +1,212 @@
+// FEAT3: Finite Element Analysis Toolbox, Version 3
+// Copyright (C) 2010 - 2020 by Stefan Turek & the FEAT group
+// FEAT3 is released under the GNU General Public License version 3,
+// see the file 'copyright.txt' in the top level directory for details.
+
+#include <test_system/test_system.hpp>
+#include <kernel/lafem/pointstar_factory.hpp>
+#include <kernel/lafem/unit_filter.hpp>
+#include <kernel/global/gate.hpp>
+#include <kernel/global/filter.hpp>
+#include <kernel/global/matrix.hpp>
+#include <kernel/global/vector.hpp>
+#include <kernel/solver/redundant_direct.hpp>
+#include <kernel/util/random.hpp>
+
+using namespace FEAT;
+using namespace FEAT::LAFEM;
+using namespace FEAT::Solver;
+using namespace FEAT::TestSystem;
+
+/**
+ * \brief Test class for the redundant direct coarse-grid solver
+ *
+ * \test Tests the BandedLU factorisation for a non-symmetric matrix as well as the RedundantDirect
+ * solver for a global system on a square number of processes.
+ */
+template<typename Mem_, typename DT_, typename IT_>
+class RedundantDirectTest :
+  public FullTaggedTest<Mem_, DT_, IT_>
+{
+public:
+  typedef DT_ DataType;
+  typedef IT_ IndexType;
+
+  typedef VectorMirror<Mem_, DataType, IndexType> MirrorType;
+  typedef DenseVector<Mem_, DataType, IndexType> LocalVectorType;
+  typedef SparseMatrixCSR<Mem_, DataType, IndexType> LocalMatrixType;
+  typedef UnitFilter<Mem_, DataType, IndexType> LocalFilterType;
+
+  typedef Global::Gate<LocalVectorType, MirrorType> GateType;
+  typedef Global::Vector<LocalVectorType, MirrorType> GlobalVectorType;
+  typedef Global::Matrix<LocalMatrixType, MirrorType, MirrorType> GlobalMatrixType;
+  typedef Global::Filter<LocalFilterType, MirrorType> GlobalFilterType;
+
+  RedundantDirectTest() :
+    FullTaggedTest<Mem_, DT_, IT_>("RedundantDirectTest")
+  {
+  }
+
+  virtual ~RedundantDirectTest()
+  {
+  }
+
+  static MirrorType create_mirror(const int n, const int m, const int o, const int p)
+  {
+    MirrorType mirror((Index)n, (Index)m);
+    IndexType* idx = mirror.indices();
+    for(int i(0); i < m; ++i)
+      idx[Index(i)] = IndexType(o + i * p);
+    return mirror;
+  }
+
+  /// creates a gate for a square grid of m x m nodes per process on a square number of processes
+  static bool create_gate(GateType& gate, const int m)
+  {
+    const Dist::Comm& comm = *gate.get_comm();
+    const int np = int(Math::sqrt(double(comm.size())));
+    if(np*np != comm.size())
+      return false;
+
+    const int ii = comm.rank() / np;
+    const int jj = comm.rank() % np;
+
+    // vertex neighbours
+    if((ii > 0) && (jj > 0))
+      gate.push((ii-1)*np + (jj-1), create_mirror(m*m, 1, 0, 1));
+    if((ii > 0) && (jj+1 < np))
+      gate.push((ii-1)*np + (jj+1), create_mirror(m*m, 1, m-1, 1));
+    if((ii+1 < np) && (jj > 0))
+      gate.push((ii+1)*np + (jj-1), create_mirror(m*m, 1, m*(m-1), 1));
+    if((ii+1 < np) && (jj+1 < np))
+      gate.push((ii+1)*np + (jj+1), create_mirror(m*m, 1, m*m-1, 1));
+
+    // edge neighbours
+    if(ii > 0)
+      gate.push((ii-1)*np + jj, create_mirror(m*m, m, 0, 1));
+    if(ii+1 < np)
+      gate.push((ii+1)*np + jj, create_mirror(m*m, m, m*(m-1), 1));
+    if(jj > 0)
+      gate.push(ii*np + (jj-1), create_mirror(m*m, m, 0, m));
+    if(jj+1 < np)
+      gate.push(ii*np + (jj+1), create_mirror(m*m, m, m-1, m));
+
+    gate.compile(LocalVectorType(Index(m*m)));
+    return true;
+  }
+
+  void test_banded_lu() const
+  {
+    const DataType tol = Math::pow(Math::eps<DataType>(), DataType(0.7));
+    Random rng;
+
+    // create a non-symmetric diagonally dominant matrix
+    PointstarFactoryFD<DataType, IndexType> psf(Index(9), Index(2));
+    LocalMatrixType matrix(psf.matrix_csr());
+    const IndexType* row_ptr = matrix.row_ptr();
+    const IndexType* col_idx = matrix.col_ind();
+    DataType* val = matrix.val();
+    for(Index i(0); i < matrix.rows(); ++i)
+    {
+      for(IndexType k(row_ptr[i]); k < row_ptr[i+1]; ++k)
+      {
+        if(Index(col_idx[k]) != i)
+          val[k] += rng(-DataType(0.5), DataType(0.5));
+      }
+    }
+
+    LocalVectorType vec_ref(rng, matrix.rows(), -DataType(1), DataType(1));
+    LocalVectorType vec_rhs(matrix.create_vector_l());
+    LocalVectorType vec_sol(matrix.create_vector_r());
+    matrix.apply(vec_rhs, vec_ref);
+
+    BandedLU<DataType> lu;
+    lu.init_symbolic(matrix.rows(), row_ptr, col_idx);
+    TEST_CHECK(lu.bandwidth() < matrix.rows());
+    lu.init_numeric(row_ptr, col_idx, val);
+    lu.solve(vec_sol.elements(), vec_rhs.elements());
+
+    vec_sol.axpy(vec_ref, vec_sol, -DataType(1));
+    TEST_CHECK_MSG(vec_sol.norm2() <= tol * vec_ref.norm2(), "BandedLU: error = " + stringify_fp_sci(vec_sol.norm2()));
+  }
+
+  void test_redundant_direct(int node_size) const
+  {
+    const DataType tol = Math::pow(Math::eps<DataType>(), DataType(0.7));
+    const Dist::Comm comm = Dist::Comm::world();
+    const int m = 7;
+
+    GateType gate(comm);
+    if(!create_gate(gate, m))
+      return;
+
+    Random rng(389ull + 7ull * (unsigned long long)comm.rank());
+
+    // create a type-0 FE Laplace matrix plus identity
+    GlobalMatrixType matrix(&gate, &gate);
+    PointstarFactoryFE<DataType, IndexType> psf((Index)m);
+    matrix.local() = psf.matrix_csr();
+    {
+      LocalMatrixType& loc = matrix.local();
+      const IndexType* row_ptr = loc.row_ptr();
+      const IndexType* col_idx = loc.col_ind();
+      DataType* val = loc.val();
+      for(Index i(0); i < loc.rows(); ++i)
+      {
+        for(IndexType k(row_ptr[i]); k < row_ptr[i+1]; ++k)
+        {
+          if(Index(col_idx[k]) == i)
+            val[k] += gate._freqs(i);
+        }
+      }
+    }
+
+    // create an empty unit filter
+    GlobalFilterType filter(LocalFilterType((Index)(m*m)));
+
+    GlobalVectorType vec_ref = matrix.create_vector_r();
+    GlobalVectorType vec_rhs = matrix.create_vector_l();
+    GlobalVectorType vec_sol = matrix.create_vector_r();
+    vec_ref.local().format(rng, -DataType(1), DataType(1));
+    vec_ref.sync_1();
+    matrix.apply(vec_rhs, vec_ref);
+
+    auto solver = new_redundant_direct(matrix, filter);
+    solver->set_node_size(node_size);
+    solver->init();
+    if(node_size > 0)
+      TEST_CHECK(solver->get_node_comm_size() <= node_size);
+
+    Status status = solver->apply(vec_sol, vec_rhs);
+    TEST_CHECK(status_success(status));
+
+    vec_sol.axpy(vec_ref, vec_sol, -DataType(1));
+    const DataType err = vec_sol.norm2();
+    TEST_CHECK_MSG(err <= tol * vec_ref.norm2(), "RedundantDirect: error = " + stringify_fp_sci(err));
+
+    // modify matrix values and refactorise
+    matrix.local().scale(matrix.local(), DataType(2));
+    solver->done_numeric();
+    solver->init_numeric();
+    matrix.apply(vec_rhs, vec_ref);
+    status = solver->apply(vec_sol, vec_rhs);
+    TEST_CHECK(status_success(status));
+    vec_sol.axpy(vec_ref, vec_sol, -DataType(1));
+    TEST_CHECK(vec_sol.norm2() <= tol * vec_ref.norm2());
+
+    solver->done();
+  }
+
+  virtual void run() const override
+  {
+    test_banded_lu();
+    // shared-memory nodes
+    test_redundant_direct(0);
+    // one process per node
+    test_redundant_direct(1);
+    // two processes per node
+    test_redundant_direct(2);
+  }
+};
+
+RedundantDirectTest<Mem::Main, double, Index> redundant_direct_test_main_double_index;
@@ -0,0 +1,733 @@
+// FEAT3: Finite Element Analysis Toolbox, Version 3
+// Copyright (C) 2010 - 2020 by Stefan Turek & the FEAT group
+// FEAT3 is released under the GNU General Public License version 3,
+// see the file 'copyright.txt' in the top level directory for details.
+
+#pragma once
+#ifndef KERNEL_SOLVER_REDUNDANT_DIRECT_HPP
+#define KERNEL_SOLVER_REDUNDANT_DIRECT_HPP 1
+
+// includes, FEAT
+#include <kernel/base_header.hpp>
+#include <kernel/adjacency/cuthill_mckee.hpp>
+#include <kernel/adjacency/graph.hpp>
+#include <kernel/solver/adp_solver_base.hpp>
+#include <kernel/solver/umfpack.hpp>
+#include <kernel/util/statistics.hpp>
+#include <kernel/util/time_stamp.hpp>
+
+// includes, system
+#include <algorithm>
+#include <memory>
+#include <vector>
+
+namespace FEAT
+{
+  namespace Solver
+  {
+    /**
+     * \brief Banded LU factorisation of a sparse matrix
+     *
+     * This class implements a simple direct solver for small sparse matrices, which is used if the
+     * UMFPACK library is not available. The matrix is reordered by the reverse Cuthill-McKee algorithm
+     * to reduce its bandwidth and is then factorised by a banded LU factorisation without pivoting.
+     * Therefore, this solver is only suitable for matrices, which admit an LU factorisation without
+     * pivoting, e.g. for symmetric positive definite or diagonally dominant matrices, as they usually
+     * appear on the coarse level of a multigrid hierarchy.
+     *
+     * \tparam DT_
+     * The data type of the matrix.
+     */
+    template<typename DT_>
+    class BandedLU
+    {
+    protected:
+      /// the dimension of the matrix
+      Index _n;
+      /// the lower and upper bandwidth of the reordered matrix
+      Index _kl, _ku;
+      /// the permutation: new index -> old index
+      std::vector<Index> _perm;
+      /// the inverse permutation: old index -> new index
+      std::vector<Index> _iperm;
+      /// the band of the reordered matrix; row i stores the columns i-kl,...,i+ku
+      std::vector<DT_> _band;
+      /// auxiliary vector for the solution
+      mutable std::vector<DT_> _vec_tmp;
+
+    public:
+      BandedLU() :
+        _n(0), _kl(0), _ku(0)
+      {
+      }
+
+      /// \returns The dimension of the matrix.
+      Index size() const
+      {
+        return _n;
+      }
+
+      /// \returns The total bandwidth of the reordered matrix.
+      Index bandwidth() const
+      {
+        return _kl + _ku + Index(1);
+      }
+
+      /**
+       * \brief Performs the symbolic factorisation
+       *
+       * This function computes the reverse Cuthill-McKee ordering and the bandwidth of the matrix.
+       *
+       * \param[in] n
+       * The dimension of the matrix.
+       *
+       * \param[in] row_ptr, col_idx
+       * The CSR structure arrays of the matrix.
+       */
+      template<typename IT_>
+      void init_symbolic(Index n, const IT_* row_ptr, const IT_* col_idx)
+      {
+        _n = n;
+
+        // create graph of matrix structure
+        Adjacency::Graph graph(n, n, Index(row_ptr[n]));
+        Index* dom_ptr = graph.get_domain_ptr();
+        Index* img_idx = graph.get_image_idx();
+        for(Index i(0); i <= n; ++i)
+          dom_ptr[i] = Index(row_ptr[i]);
+        for(Index k(0); k < Index(row_ptr[n]); ++k)
+          img_idx[k] = Index(col_idx[k]);
+
+        // compute reverse Cuthill-McKee permutation
+        Adjacency::Permutation perm = Adjacency::CuthillMcKee::compute(graph, true,
+          Adjacency::CuthillMcKee::root_minimum_degree, Adjacency::CuthillMcKee::sort_asc);
+        const Index* perm_pos = perm.get_perm_pos();
+        _perm.resize(n);
+        _iperm.resize(n);
+        for(Index i(0); i < n; ++i)
+        {
+          _perm[i] = perm_pos[i];
+          _iperm[perm_pos[i]] = i;
+        }
+
+        // compute bandwidth of reordered matrix
+        _kl = _ku = Index(0);
+        for(Index i(0); i < n; ++i)
+        {
+          const Index pi = _iperm[i];
+          for(IT_ k(row_ptr[i]); k < row_ptr[i+1]; ++k)
+          {
+            const Index pj = _iperm[Index(col_idx[k])];
+            if(pj < pi)
+              _kl = Math::max(_kl, pi - pj);
+            else
+              _ku = Math::max(_ku, pj - pi);
+          }
+        }
+
+        _band.resize(n * bandwidth());
+        _vec_tmp.resize(n);
+      }
+
+      /**
+       * \brief Performs the numeric factorisation
+       *
+       * \param[in] row_ptr, col_idx, val
+       * The CSR arrays of the matrix; the structure must be the same as in init_symbolic().
+       *
+       * \throws SingularMatrixException if a zero pivot is encountered
+       */
+      template<typename IT_>
+      void init_numeric(const IT_* row_ptr, const IT_* col_idx, const DT_* val)
+      {
+        const Index n(_n), kl(_kl), ku(_ku), w(bandwidth());
+        std::fill(_band.begin(), _band.end(), DT_(0));
+
+        // scatter reordered matrix into band
+        for(Index i(0); i < n; ++i)
+        {
+          const Index pi = _iperm[i];
+          for(IT_ k(row_ptr[i]); k < row_ptr[i+1]; ++k)
+            _band[pi*w + _iperm[Index(col_idx[k])] + kl - pi] += val[k];
+        }
+
+        // compute LU factorisation without pivoting
+        for(Index k(0); k < n; ++k)
+        {
+          const DT_ piv = _band[k*w + kl];
+          if(!(Math::abs(piv) > DT_(0)))
+            throw SingularMatrixException("BandedLU: zero pivot in row " + stringify(k));
+
+          const Index imax = Math::min(n, k + kl + Index(1));
+          const Index jmax = Math::min(n, k + ku + Index(1));
+          for(Index i(k+1); i < imax; ++i)
+          {
+            DT_& lik = _band[i*w + k + kl - i];
+            if(lik == DT_(0))
+              continue;
+            lik /= piv;
+            for(Index j(k+1); j < jmax; ++j)
+              _band[i*w + j + kl - i] -= lik * _band[k*w + j + kl - k];
+          }
+        }
+      }
+
+      /**
+       * \brief Solves a linear system with the factorised matrix
+       *
+       * \param[out] x
+       * The solution array. May be the same as \p b.
+       *
+       * \param[in] b
+       * The right-hand-side array.
+       */
+      void solve(DT_* x, const DT_* b) const
+      {
+        const Index n(_n), kl(_kl), ku(_ku), w(bandwidth());
+        DT_* y = _vec_tmp.data();
+
+        // permute right-hand-side
+        for(Index i(0); i < n; ++i)
+          y[i] = b[_perm[i]];
+
+        // forward substitution: L*y = b
+        for(Index i(0); i < n; ++i)
+        {
+          DT_ r(y[i]);
+          for(Index j(i > kl ? i - kl : Index(0)); j < i; ++j)
+            r -= _band[i*w + j + kl - i] * y[j];
+          y[i] = r;
+        }
+
+        // backward substitution: U*x = y
+        for(Index i(n); i > Index(0); )
+        {
+          --i;
+          DT_ r(y[i]);
+          const Index jmax = Math::min(n, i + ku + Index(1));
+          for(Index j(i+1); j < jmax; ++j)
+            r -= _band[i*w + j + kl - i] * y[j];
+          y[i] = r / _band[i*w + kl];
+        }
+
+        // permute solution back
+        for(Index i(0); i < n; ++i)
+          x[_perm[i]] = y[i];
+      }
+    }; // class BandedLU<...>
+
+    /**
+     * \brief Redundant direct coarse-grid solver
+     *
+     * This class implements a direct solver for small global systems, which is intended to be used
+     * as a coarse-grid solver in a multigrid hierarchy. Instead of solving the coarse system by a
+     * Krylov solver, which requires several global reductions per iteration, or by a direct solver
+     * on a single process, each process gathers the whole coarse system and factorises it redundantly
+     * in init_numeric(). Each apply() call then only requires the gathering of the defect vector, which
+     * is performed in three stages by using node-level sub-communicators:
+     * -# each process sends its owned defect entries to the leader process of its node
+     * -# the node leaders exchange their node's defect entries by an \c allgatherv
+     * -# each leader broadcasts the full defect vector to the processes of its node
+     *
+     * so that only the node leaders participate in the inter-node communication. Afterwards, each
+     * process solves the coarse system locally, so the solution does not require any reductions.
+     *
+     * The node-level sub-communicators are created by Dist::Comm::comm_split_shared() by default,
+     * but one may also choose groups of consecutive ranks by calling set_node_size().
+     *
+     * The factorisation is computed by UMFPACK if available; otherwise, the built-in BandedLU
+     * factorisation is used, which requires that the coarse system admits an LU factorisation
+     * without pivoting.
+     *
+     * \note
+     * This solver is based on the algebraic DOF partitioning of the ADPSolverBase class, so the local
+     * matrix type must be a LAFEM::SparseMatrixCSR.
+     *
+     * \attention
+     * The coarse system must be regular, i.e. this solver cannot be used with a Global::MeanFilter.
+     *
+     * \tparam Matrix_
+     * The global system matrix type.
+     *
+     * \tparam Filter_
+     * The global system filter type.
+     */
+    template<typename Matrix_, typename Filter_>
+    class RedundantDirect :
+      public ADPSolverBase<Matrix_, Filter_>
+    {
+    public:
+      /// our base-class
+      typedef ADPSolverBase<Matrix_, Filter_> BaseClass;
+      /// the vector type
+      typedef typename BaseClass::VectorType VectorType;
+      /// the data type
+      typedef typename BaseClass::DataType DataType;
+      /// the index type
+      typedef typename BaseClass::IndexType IndexType;
+
+    protected:
+      /// the node size; 0 for shared-memory nodes
+      int _node_size;
+      /// use UMFPACK if available?
+      bool _want_umfpack;
+
+      /// the node-level communicator
+      std::unique_ptr<Dist::Comm> _comm_node;
+      /// the node-leader communicator; only allocated on node leaders
+      std::unique_ptr<Dist::Comm> _comm_lead;
+
+      /// the global DOF offsets and counts of all processes
+      std::vector<int> _all_offsets, _all_counts;
+      /// the matrix entry counts and displacements of all processes
+      std::vector<int> _nze_counts, _nze_displs;
+      /// the global ranks of our node members (only on leader)
+      std::vector<int> _node_ranks;
+      /// the offsets of our node members within the node buffer (only on leader)
+      std::vector<int> _node_displs;
+      /// the DOF counts and displacements of all node blocks (only on leader)
+      std::vector<int> _lead_counts, _lead_displs;
+      /// the global ranks of all processes in the packed order (only on leader)
+      std::vector<int> _packed_ranks;
+
+      /// the buffers for the packed node and global defect (only on leader)
+      std::vector<DataType> _node_buf, _packed_buf;
+      /// the full right-hand-side and solution vectors
+      std::vector<DataType> _vec_rhs, _vec_sol;
+
+      /// the full system matrix arrays
+      std::vector<IndexType> _row_ptr, _col_idx;
+      std::vector<DataType> _val;
+
+      /// the built-in factorisation
+      BandedLU<DataType> _banded_lu;
+
+#ifdef FEAT_HAVE_UMFPACK
+      /// the full system matrix for UMFPACK
+      typename Umfpack::MatrixType _umf_matrix;
+      /// the UMFPACK solver
+      std::shared_ptr<Umfpack> _umfpack;
+#endif // FEAT_HAVE_UMFPACK
+
+    public:
+      /**
+       * \brief Constructor
+       *
+       * \param[in] matrix
+       * The global system matrix.
+       *
+       * \param[in] filter
+       * The global system filter.
+       */
+      explicit RedundantDirect(const Matrix_& matrix, const Filter_& filter) :
+        BaseClass(matrix, filter),
+        _node_size(0),
+        _want_umfpack(true)
+      {
+      }
+
+      /**
+       * \brief Constructor using a PropertyMap
+       *
+       * \param[in] section_name
+       * The name of the config section, which it does not know by itself.
+       *
+       * \param[in] section
+       * A pointer to the PropertyMap section configuring this solver.
+       *
+       * \param[in] matrix
+       * The global system matrix.
+       *
+       * \param[in] filter
+       * The global system filter.
+       */
+      explicit RedundantDirect(const String& section_name, PropertyMap* section,
+        const Matrix_& matrix, const Filter_& filter) :
+        RedundantDirect(matrix, filter)
+      {
+        auto node_size_p = section->query("node_size");
+        if(node_size_p.second && (!node_size_p.first.parse(_node_size) || (_node_size < 0)))
+          throw ParseError(section_name + ".node_size", node_size_p.first, "a non-negative integer");
+
+        auto umfpack_p = section->query("umfpack");
+        if(umfpack_p.second && !umfpack_p.first.parse(_want_umfpack))
+          throw ParseError(section_name + ".umfpack", umfpack_p.first, "'true' or 'false'");
+      }
+
+      virtual String name() const override
+      {
+        return "RedundantDirect";
+      }
+
+      /**
+       * \brief Sets the node size
+       *
+       * \param[in] node_size
+       * The number of consecutive ranks, which form a node-level sub-communicator, or 0, if the
+       * sub-communicators are to be created by shared-memory nodes.
+       */
+      void set_node_size(int node_size)
+      {
+        XASSERTM(node_size >= 0, "invalid node size");
+        _node_size = node_size;
+      }
+
+      /**
+       * \brief Specifies whether UMFPACK is to be used
+       *
+       * \param[in] want_umfpack
+       * Specifies whether UMFPACK is to be used for the factorisation. This setting is ignored if
+       * FEAT was configured without UMFPACK support, in which case the built-in BandedLU is used.
+       */
+      void set_umfpack(bool want_umfpack)
+      {
+        _want_umfpack = want_umfpack;
+      }
+
+      /// \returns The number of processes in our node-level sub-communicator.
+      int get_node_comm_size() const
+      {
+        return _comm_node ? _comm_node->size() : 0;
+      }
+
+      virtual void init_symbolic() override
+      {
+        BaseClass::init_symbolic();
+
+        const Dist::Comm& comm = *this->_get_comm();
+        const int nranks = comm.size();
+        const int my_rank = comm.rank();
+
+        // create node-level communicator
+        if(_node_size > 0)
+          _comm_node.reset(new Dist::Comm(comm.comm_split(my_rank / _node_size, my_rank)));
+        else
+          _comm_node.reset(new Dist::Comm(comm.comm_split_shared(my_rank)));
+        const bool is_leader = (_comm_node->rank() == 0);
+
+        // create node-leader communicator; all other processes do not join any sub-communicator
+#ifdef FEAT_HAVE_MPI
+        Dist::Comm comm_lead = comm.comm_split(is_leader ? 0 : MPI_UNDEFINED, my_rank);
+#else
+        Dist::Comm comm_lead = comm.comm_split(0, my_rank);
+#endif // FEAT_HAVE_MPI
+        if(is_leader)
+          _comm_lead.reset(new Dist::Comm(std::move(comm_lead)));
+
+        // determine the global rank of our node leader
+        int leader = my_rank;
+        _comm_node->bcast(&leader, std::size_t(1), 0);
+
+        // gather partitioning info of all processes
+        int my_info[4] =
+        {
+          int(this->_get_global_dof_offset()),
+          int(this->_get_num_owned_dofs()),
+          int(this->_get_mat_num_nze()),
+          leader
+        };
+        std::vector<int> all_info(std::size_t(4*nranks));
+        comm.allgather(my_info, std::size_t(4), all_info.data(), std::size_t(4));
+
+        // the owned DOFs and the matrix rows are enumerated in rank order
+        const int num_glob = int(this->_get_num_global_dofs());
+        std::vector<int> nze_counts(std::size_t(nranks), 0), nze_displs(std::size_t(nranks), 0);
+        _all_offsets.resize(std::size_t(nranks));
+        _all_counts.resize(std::size_t(nranks));
+        for(int i(0), off(0), nze(0); i < nranks; ++i)
+        {
+          _all_offsets[std::size_t(i)] = all_info[std::size_t(4*i+0)];
+          _all_counts[std::size_t(i)] = all_info[std::size_t(4*i+1)];
+          nze_counts[std::size_t(i)] = all_info[std::size_t(4*i+2)];
+          nze_displs[std::size_t(i)] = nze;
+          XASSERTM(_all_offsets[std::size_t(i)] == off, "owned DOFs are not enumerated in rank order");
+          off += _all_counts[std::size_t(i)];
+          nze += nze_counts[std::size_t(i)];
+        }
+
+        // determine the packed order: sorted by leader rank first and by rank second
+        _packed_ranks.resize(std::size_t(nranks));
+        for(int i(0); i < nranks; ++i)
+          _packed_ranks[std::size_t(i)] = i;
+        std::stable_sort(_packed_ranks.begin(), _packed_ranks.end(), [&all_info](int a, int b)
+          {return all_info[std::size_t(4*a+3)] < all_info[std::size_t(4*b+3)];});
+
+        // compute the node block sizes in leader order
+        _lead_counts.clear();
+        _lead_displs.clear();
+        _node_ranks.clear();
+        _node_displs.clear();
+        for(std::size_t k(0), off(0); k < _packed_ranks.size(); ++k)
+        {
+          const int r = _packed_ranks[k];
+          const int l = all_info[std::size_t(4*r+3)];
+          if((k == std::size_t(0)) || (all_info[std::size_t(4*_packed_ranks[k-1]+3)] != l))
+          {
+            _lead_displs.push_back(int(off));
+            _lead_counts.push_back(0);
+          }
+          if(l == leader)
+          {
+            _node_ranks.push_back(r);
+            _node_displs.push_back(_lead_counts.back());
+          }
+          _lead_counts.back() += _all_counts[std::size_t(r)];
+          off += std::size_t(_all_counts[std::size_t(r)]);
+        }
+
+        if(is_leader)
+        {
+          XASSERT(int(_lead_counts.size()) == _comm_lead->size());
+          _node_buf.resize(std::size_t(num_glob));
+          _packed_buf.resize(std::size_t(num_glob));
+        }
+        _vec_rhs.resize(std::size_t(num_glob));
+        _vec_sol.resize(std::size_t(num_glob));
+
+        // gather the row lengths of the full matrix
+        const IndexType* my_row_ptr = this->_get_mat_row_ptr();
+        std::vector<IndexType> my_row_len(std::size_t(my_info[1]), IndexType(0));
+        for(std::size_t i(0); i < my_row_len.size(); ++i)
+          my_row_len[i] = my_row_ptr[i+1] - my_row_ptr[i];
+        std::vector<IndexType> row_len(std::size_t(num_glob), IndexType(0));
+        comm.allgatherv(my_row_len.data(), my_row_len.size(), row_len.data(), _all_counts.data(), _all_offsets.data());
+
+        _row_ptr.resize(std::size_t(num_glob + 1));
+        _row_ptr[0] = IndexType(0);
+        for(std::size_t i(0); i < row_len.size(); ++i)
+          _row_ptr[i+1] = _row_ptr[i] + row_len[i];
+
+        // gather the column indices of the full matrix
+        _col_idx.resize(std::size_t(_row_ptr.back()));
+        _val.resize(_col_idx.size());
+        comm.allgatherv(this->_get_mat_col_idx(), std::size_t(my_info[2]), _col_idx.data(), nze_counts.data(), nze_displs.data());
+
+        // save the counts for the numeric gather
+        _nze_counts = std::move(nze_counts);
+        _nze_displs = std::move(nze_displs);
+
+        // perform symbolic factorisation
+#ifdef FEAT_HAVE_UMFPACK
+        if(_want_umfpack)
+        {
+          _umf_matrix = typename Umfpack::MatrixType(Index(num_glob), Index(num_glob), Index(_col_idx.size()));
+          Index* umf_row_ptr = _umf_matrix.row_ptr();
+          Index* umf_col_idx = _umf_matrix.col_ind();
+          for(std::size_t i(0); i < _row_ptr.size(); ++i)
+            umf_row_ptr[i] = Index(_row_ptr[i]);
+          for(std::size_t k(0); k < _col_idx.size(); ++k)
+            umf_col_idx[k] = Index(_col_idx[k]);
+          _umfpack = std::make_shared<Umfpack>(_umf_matrix);
+          _umfpack->init_symbolic();
+          return;
+        }
+#endif // FEAT_HAVE_UMFPACK
+        _banded_lu.init_symbolic(Index(num_glob), _row_ptr.data(), _col_idx.data());
+      }
+
+      virtual void init_numeric() override
+      {
+        BaseClass::init_numeric();
+
+        // gather the values of the full matrix
+        const Dist::Comm& comm = *this->_get_comm();
+        comm.allgatherv(this->_get_mat_vals(), std::size_t(this->_get_mat_num_nze()), _val.data(),
+          _nze_counts.data(), _nze_displs.data());
+
+        // perform numeric factorisation
+#ifdef FEAT_HAVE_UMFPACK
+        if(_umfpack)
+        {
+          double* umf_val = _umf_matrix.val();
+          for(std::size_t k(0); k < _val.size(); ++k)
+            umf_val[k] = double(_val[k]);
+          _umfpack->init_numeric();
+          return;
+        }
+#endif // FEAT_HAVE_UMFPACK
+        _banded_lu.init_numeric(_row_ptr.data(), _col_idx.data(), _val.data());
+      }
+
+      virtual void done_numeric() override
+      {
+#ifdef FEAT_HAVE_UMFPACK
+        if(_umfpack)
+          _umfpack->done_numeric();
+#endif // FEAT_HAVE_UMFPACK
+        BaseClass::done_numeric();
+      }
+
+      virtual void done_symbolic() override
+      {
+#ifdef FEAT_HAVE_UMFPACK
+        if(_umfpack)
+        {
+          _umfpack->done_symbolic();
+          _umfpack.reset();
+          _umf_matrix.clear();
+        }
+#endif // FEAT_HAVE_UMFPACK
+        _banded_lu = BandedLU<DataType>();
+        _val.clear();
+        _col_idx.clear();
+        _row_ptr.clear();
+        _vec_sol.clear();
+        _vec_rhs.clear();
+        _packed_buf.clear();
+        _node_buf.clear();
+        _packed_ranks.clear();
+        _lead_displs.clear();
+        _lead_counts.clear();
+        _node_displs.clear();
+        _node_ranks.clear();
+        _nze_displs.clear();
+        _nze_counts.clear();
+        _all_counts.clear();
+        _all_offsets.clear();
+        _comm_lead.reset();
+        _comm_node.reset();
+        BaseClass::done_symbolic();
+      }
+
+      virtual Status apply(VectorType& vec_cor, const VectorType& vec_def) override
+      {
+        // upload defect to ADP vector
+        this->_upload_vec_def(vec_def);
+
+        // gather the full defect vector
+        TimeStamp ts_start;
+        this->_gather_defect(this->_get_vec_def_vals(vec_def));
+        Statistics::add_time_mpi_execute_collective(ts_start.elapsed_now());
+
+        // solve the full system locally
+#ifdef FEAT_HAVE_UMFPACK
+        if(_umfpack)
+        {
+          typename Umfpack::VectorType umf_rhs(Index(_vec_rhs.size())), umf_sol(Index(_vec_sol.size()));
+          for(std::size_t i(0); i < _vec_rhs.size(); ++i)
+            umf_rhs(Index(i), double(_vec_rhs[i]));
+          Status status = _umfpack->apply(umf_sol, umf_rhs);
+          if(status != Status::success)
+            return status;
+          for(std::size_t i(0); i < _vec_sol.size(); ++i)
+            _vec_sol[i] = DataType(umf_sol(Index(i)));
+        }
+        else
+#endif // FEAT_HAVE_UMFPACK
+        {
+          _banded_lu.solve(_vec_sol.data(), _vec_rhs.data());
+        }
+
+        // extract our owned correction entries and download them
+        const Dist::Comm& comm = *this->_get_comm();
+        const std::size_t off = std::size_t(_all_offsets[std::size_t(comm.rank())]);
+        DataType* cor = this->_get_vec_cor_vals(vec_cor);
+        for(std::size_t i(0); i < std::size_t(this->_get_num_owned_dofs()); ++i)
+          cor[i] = _vec_sol[off + i];
+        this->_download_vec_cor(vec_cor);
+
+        // apply correction filter
+        this->_system_filter.filter_cor(vec_cor);
+
+        return Status::success;
+      }
+
+    protected:
+      /**
+       * \brief Gathers the full defect vector on all processes
+       *
+       * \param[in] def
+       * The owned defect entries of this process.
+       */
+      void _gather_defect(const DataType* def)
+      {
+        const Dist::Comm& comm = *this->_get_comm();
+        const std::size_t num_owned = std::size_t(this->_get_num_owned_dofs());
+
+        // non-leaders send their owned entries to their node leader
+        if(!_comm_lead)
+        {
+          _comm_node->send(def, num_owned, 0);
+          _comm_node->bcast(_vec_rhs.data(), _vec_rhs.size(), 0);
+          return;
+        }
+
+        // stage 1: receive the owned entries of all node members
+        Dist::RequestVector reqs;
+        for(std::size_t i(0); i < _node_ranks.size(); ++i)
+        {
+          const int r = _node_ranks[i];
+          DataType* buf = &_node_buf[std::size_t(_node_displs[i])];
+          if(r == comm.rank())
+            std::copy(def, def + num_owned, buf);
+          else
+            reqs.push_back(_comm_node->irecv(buf, std::size_t(_all_counts[std::size_t(r)]), int(i)));
+        }
+        reqs.wait_all();
+
+        // stage 2: exchange the node blocks between all node leaders
+        const std::size_t node_count = std::size_t(_lead_counts.at(std::size_t(_comm_lead->rank())));
+        _comm_lead->allgatherv(_node_buf.data(), node_count, _packed_buf.data(), _lead_counts.data(), _lead_displs.data());
+
+        // unpack into the full defect vector
+        for(std::size_t k(0), off(0); k < _packed_ranks.size(); ++k)
+        {
+          const std::size_t r = std::size_t(_packed_ranks[k]);
+          const std::size_t n = std::size_t(_all_counts[r]);
+          std::copy(&_packed_buf[off], &_packed_buf[off] + n, &_vec_rhs[std::size_t(_all_offsets[r])]);
+          off += n;
+        }
+
+        // stage 3: broadcast the full defect vector to all node members
+        _comm_node->bcast(_vec_rhs.data(), _vec_rhs.size(), 0);
+      }
+    }; // class RedundantDirect<...>
+
+    /**
+     * \brief Creates a new RedundantDirect solver object
+     *
+     * \param[in] matrix
+     * The global system matrix.
+     *
+     * \param[in] filter
+     * The global system filter.
+     *
+     * \returns
+     * A shared pointer to a new RedundantDirect object.
+     */
+    template<typename Matrix_, typename Filter_>
+    inline std::shared_ptr<RedundantDirect<Matrix_, Filter_>> new_redundant_direct(
+      const Matrix_& matrix, const Filter_& filter)
+    {
+      return std::make_shared<RedundantDirect<Matrix_, Filter_>>(matrix, filter);
+    }
+
+    /**
+     * \brief Creates a new RedundantDirect solver object based on a PropertyMap
+     *
+     * \param[in] section_name
+     * The name of the config section, which it does not know by itself
+     *
+     * \param[in] section
+     * A pointer to the PropertyMap section configuring this solver
+     *
+     * \param[in] matrix
+     * The global system matrix.
+     *
+     * \param[in] filter
+     * The global system filter.
+     *
+     * \returns
+     * A shared pointer to a new RedundantDirect object.
+     */
+    template<typename Matrix_, typename Filter_>
+    inline std::shared_ptr<RedundantDirect<Matrix_, Filter_>> new_redundant_direct(
+      const String& section_name, PropertyMap* section,
+      const Matrix_& matrix, const Filter_& filter)
+    {
+      return std::make_shared<RedundantDirect<Matrix_, Filter_>>(section_name, section, matrix, filter);
+    }
+  } // namespace Solver
+} // namespace FEAT
+
+#endif // KERNEL_SOLVER_REDUNDANT_DIRECT_HPP
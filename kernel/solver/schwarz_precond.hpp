@@ -124,10 +124,10 @@ namespace FEAT
 
       virtual Status apply(GlobalVectorType& vec_cor, const GlobalVectorType& vec_def) override
       {
-        Statistics::add_solver_expression(std::make_shared<ExpressionStartSolve>(this->name()));
+        Statistics::add_solver_expression(ExpressionStartSolve(this->expression_name()));
 
         // apply local solver
-        Statistics::add_solver_expression(std::make_shared<ExpressionCallPrecond>(this->name(), this->_local_solver->name()));
+        Statistics::add_solver_expression(ExpressionCallPrecond(this->expression_name(), this->_local_solver->expression_name()));
         Status status = _local_solver->apply(vec_cor.local(), vec_def.local());
 
         // synchronise local status over communicator to obtain
@@ -160,7 +160,7 @@ namespace FEAT
         }
 
         // okay
-        Statistics::add_solver_expression(std::make_shared<ExpressionEndSolve>(this->name(), status, 0));
+        Statistics::add_solver_expression(ExpressionEndSolve(this->expression_name(), status, 0));
         return status;
       }
     }; // class SchwarzPrecond<...>
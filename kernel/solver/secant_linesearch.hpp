@@ -196,7 +196,7 @@ namespace FEAT
          */
         virtual Status _apply_intern(VectorType& vec_sol, const VectorType& vec_dir)
         {
-          Statistics::add_solver_expression(std::make_shared<ExpressionStartSolve>(this->name()));
+          Statistics::add_solver_expression(ExpressionStartSolve(this->expression_name()));
 
           // The step length wrt. to the NORMALISED search direction
           DataType alpha(0);
@@ -285,7 +285,7 @@ namespace FEAT
             //this->trim_func_grad(fval);
             this->_filter.filter_def(this->_vec_grad);
           }
-          Statistics::add_solver_expression(std::make_shared<ExpressionEndSolve>(this->name(), Status::undefined, this->get_num_iter()));
+          Statistics::add_solver_expression(ExpressionEndSolve(this->expression_name(), Status::undefined, this->get_num_iter()));
           return st;
         }
 
@@ -0,0 +1,460 @@
+// FEAT3: Finite Element Analysis Toolbox, Version 3
+// Copyright (C) 2010 - 2020 by Stefan Turek & the FEAT group
+// FEAT3 is released under the GNU General Public License version 3,
+// see the file 'copyright.txt' in the top level directory for details.
+
+#pragma once
+#ifndef KERNEL_SOLVER_SOLUTION_EXTRAPOLATOR_HPP
+#define KERNEL_SOLVER_SOLUTION_EXTRAPOLATOR_HPP 1
+
+// includes, FEAT
+#include <kernel/base_header.hpp>
+#include <kernel/lafem/base.hpp>
+#include <kernel/util/math.hpp>
+#include <kernel/util/string.hpp>
+
+// includes, system
+#include <deque>
+#include <iostream>
+#include <vector>
+
+namespace FEAT
+{
+  namespace Solver
+  {
+    /**
+     * \brief Solution extrapolation modes enumeration
+     */
+    enum class ExtrapolationMode
+    {
+      /// no extrapolation; the initial guess is left untouched
+      none = 0,
+      /// polynomial extrapolation of the solution history
+      polynomial,
+      /// Galerkin projection onto the POD modes of the solution history
+      pod
+    };
+
+    /// \cond internal
+    inline std::ostream& operator<<(std::ostream& os, ExtrapolationMode mode)
+    {
+      switch(mode)
+      {
+        case ExtrapolationMode::none:
+          return os << "none";
+        case ExtrapolationMode::polynomial:
+          return os << "polynomial";
+        case ExtrapolationMode::pod:
+          return os << "pod";
+        default:
+          return os << "-unknown-";
+      }
+    }
+
+    inline std::istream& operator>>(std::istream& is, ExtrapolationMode& mode)
+    {
+      String s;
+      if((is >> s).fail())
+        return is;
+
+      if(s.compare_no_case("none") == 0)
+        mode = ExtrapolationMode::none;
+      else if(s.compare_no_case("polynomial") == 0)
+        mode = ExtrapolationMode::polynomial;
+      else if(s.compare_no_case("pod") == 0)
+        mode = ExtrapolationMode::pod;
+      else
+        is.setstate(std::ios_base::failbit);
+
+      return is;
+    }
+    /// \endcond
+
+    /**
+     * \brief Solution history extrapolator for initial guesses
+     *
+     * This class stores the solutions of a sequence of linear systems, e.g. of consecutive time steps
+     * or Newton iterations, and computes an initial guess for the next system from this history.
+     * Two modes are supported:
+     * - ExtrapolationMode::polynomial: the history is extrapolated by the polynomial which interpolates
+     *   the last \e n solutions on equidistant points, i.e. \f$x = 2x_n - x_{n-1}\f$ for \e n = 2.
+     * - ExtrapolationMode::pod: the POD modes of the history are computed by the method of snapshots and
+     *   the initial guess is the Galerkin approximation of the next system in the span of these modes.
+     *
+     * The extrapolator does not depend on the solver, so it can be combined with any IterativeSolver:
+     * compute the initial guess by predict(), solve the system by calling the solver's correct()
+     * function and append the new solution to the history by push().
+     *
+     * \tparam Vector_
+     * The type of the solution vectors.
+     */
+    template<typename Vector_>
+    class SolutionExtrapolator
+    {
+    public:
+      /// the vector type
+      typedef Vector_ VectorType;
+      /// the data type
+      typedef typename VectorType::DataType DataType;
+
+    protected:
+      /// the extrapolation mode
+      ExtrapolationMode _mode;
+      /// the maximum length of the solution history
+      Index _max_history;
+      /// the relative eigenvalue threshold for the POD modes
+      DataType _pod_tol;
+      /// the solution history; the newest solution is stored at the back
+      std::deque<VectorType> _history;
+
+    public:
+      /**
+       * \brief Constructor
+       *
+       * \param[in] mode
+       * The extrapolation mode.
+       *
+       * \param[in] max_history
+       * The maximum number of stored solutions. Must be > 0.
+       */
+      explicit SolutionExtrapolator(ExtrapolationMode mode = ExtrapolationMode::polynomial, Index max_history = Index(3)) :
+        _mode(mode),
+        _max_history(max_history),
+        _pod_tol(Math::sqrt(Math::eps<DataType>())),
+        _history()
+      {
+        XASSERTM(max_history > Index(0), "history length must be positive");
+      }
+
+      /// \returns The extrapolation mode.
+      ExtrapolationMode get_mode() const
+      {
+        return _mode;
+      }
+
+      /// Sets the extrapolation mode.
+      void set_mode(ExtrapolationMode mode)
+      {
+        _mode = mode;
+      }
+
+      /// \returns The maximum length of the solution history.
+      Index get_max_history() const
+      {
+        return _max_history;
+      }
+
+      /**
+       * \brief Sets the maximum length of the solution history
+       *
+       * \param[in] max_history
+       * The maximum number of stored solutions. Must be > 0.
+       */
+      void set_max_history(Index max_history)
+      {
+        XASSERTM(max_history > Index(0), "history length must be positive");
+        _max_history = max_history;
+        while(Index(_history.size()) > _max_history)
+          _history.pop_front();
+      }
+
+      /**
+       * \brief Sets the POD tolerance
+       *
+       * \param[in] pod_tol
+       * The relative threshold for the eigenvalues of the snapshot correlation matrix;
+       * POD modes with smaller eigenvalues are discarded.
+       */
+      void set_pod_tol(DataType pod_tol)
+      {
+        XASSERT(pod_tol >= DataType(0));
+        _pod_tol = pod_tol;
+      }
+
+      /// \returns The number of stored solutions.
+      Index size() const
+      {
+        return Index(_history.size());
+      }
+
+      /// Discards the solution history.
+      void clear()
+      {
+        _history.clear();
+      }
+
+      /**
+       * \brief Appends a solution to the history
+       *
+       * If the history is full, the oldest solution is discarded and its storage is reused.
+       *
+       * \param[in] vec_sol
+       * The solution vector to be appended.
+       */
+      void push(const VectorType& vec_sol)
+      {
+        if(Index(_history.size()) >= _max_history)
+        {
+          VectorType vec(std::move(_history.front()));
+          _history.pop_front();
+          vec.copy(vec_sol);
+          _history.push_back(std::move(vec));
+        }
+        else
+          _history.push_back(vec_sol.clone(LAFEM::CloneMode::Deep));
+      }
+
+      /**
+       * \brief Computes the polynomial extrapolation of the solution history
+       *
+       * \param[out] vec_sol
+       * The vector that receives the extrapolated solution.
+       *
+       * \returns
+       * \c true, if the history was not empty, otherwise \c false.
+       */
+      bool extrapolate(VectorType& vec_sol) const
+      {
+        const std::size_t n(_history.size());
+        if(n == std::size_t(0))
+          return false;
+
+        // The polynomial interpolating x[n-1-i] at t = -i for i = 0,...,n-1 evaluates
+        // to sum_i (-1)^i * binomial(n, i+1) * x[n-1-i] at t = 1.
+        DataType coeff = DataType(n);
+        vec_sol.scale(_history.back(), coeff);
+        for(std::size_t i(1); i < n; ++i)
+        {
+          coeff *= -DataType(n - i) / DataType(i + 1);
+          vec_sol.axpy(_history.at(n - 1 - i), vec_sol, coeff);
+        }
+        return true;
+      }
+
+      /**
+       * \brief Computes the POD Galerkin approximation of a system in the span of the solution history
+       *
+       * \param[out] vec_sol
+       * The vector that receives the initial guess.
+       *
+       * \param[in] matrix
+       * The system matrix of the next system.
+       *
+       * \param[in] filter
+       * The system filter of the next system.
+       *
+       * \param[in] vec_rhs
+       * The right-hand-side vector of the next system.
+       *
+       * \returns
+       * \c true, if the initial guess was computed, or \c false, if the history was empty or the
+       * reduced system was singular.
+       */
+      template<typename Matrix_, typename Filter_>
+      bool project(VectorType& vec_sol, const Matrix_& matrix, const Filter_& filter, const VectorType& vec_rhs) const
+      {
+        const Index m(Index(_history.size()));
+        if(m == Index(0))
+          return false;
+
+        // compute snapshot correlation matrix G := S^T*S, the reduced matrix R := S^T*A*S
+        // and the reduced right-hand-side f := S^T*b
+        std::vector<DataType> gram(m*m), red(m*m), rhs(m);
+        VectorType vec_tmp(vec_rhs.clone(LAFEM::CloneMode::Layout));
+        for(Index j(0); j < m; ++j)
+        {
+          matrix.apply(vec_tmp, _history.at(j));
+          filter.filter_def(vec_tmp);
+          for(Index i(0); i < m; ++i)
+          {
+            red[i*m + j] = _history.at(i).dot(vec_tmp);
+            if(i <= j)
+              gram[i*m + j] = gram[j*m + i] = _history.at(i).dot(_history.at(j));
+          }
+          rhs[j] = _history.at(j).dot(vec_rhs);
+        }
+
+        // compute eigenpairs of G; the POD modes are given by S*v_k/sqrt(lambda_k)
+        std::vector<DataType> evec(m*m), eval(m);
+        _sym_eigen(m, gram, evec, eval);
+        DataType lambda_max(0);
+        for(Index k(0); k < m; ++k)
+          lambda_max = Math::max(lambda_max, eval[k]);
+        if(!(lambda_max > DataType(0)))
+          return false;
+
+        // assemble transformation T := [v_k/sqrt(lambda_k)] for all significant modes
+        std::vector<DataType> trafo;
+        Index r(0);
+        for(Index k(0); k < m; ++k)
+        {
+          if(!(eval[k] > _pod_tol * lambda_max))
+            continue;
+          const DataType s = DataType(1) / Math::sqrt(eval[k]);
+          for(Index i(0); i < m; ++i)
+            trafo.push_back(evec[i*m + k] * s);
+          ++r;
+        }
+
+        // compute reduced POD system: (T^T*R*T) * y = T^T*f
+        std::vector<DataType> pod_mat(r*r, DataType(0)), pod_rhs(r, DataType(0));
+        for(Index k(0); k < r; ++k)
+        {
+          for(Index i(0); i < m; ++i)
+            pod_rhs[k] += trafo[k*m + i] * rhs[i];
+          for(Index l(0); l < r; ++l)
+          {
+            DataType t(0);
+            for(Index i(0); i < m; ++i)
+              for(Index j(0); j < m; ++j)
+                t += trafo[k*m + i] * red[i*m + j] * trafo[l*m + j];
+            pod_mat[k*r + l] = t;
+          }
+        }
+
+        // invert reduced matrix
+        std::vector<Index> pivot(r);
+        const DataType det = Math::invert_matrix(r, r, pod_mat.data(), pivot.data());
+        if(!Math::isfinite(det) || (Math::abs(det) <= DataType(0)))
+          return false;
+
+        // compute coefficients c := T * R^{-1} * f w.r.t. the snapshots
+        std::vector<DataType> coeff(m, DataType(0));
+        for(Index k(0); k < r; ++k)
+        {
+          DataType y(0);
+          for(Index l(0); l < r; ++l)
+            y += pod_mat[k*r + l] * pod_rhs[l];
+          for(Index i(0); i < m; ++i)
+            coeff[i] += trafo[k*m + i] * y;
+        }
+
+        // x := S * c
+        vec_sol.scale(_history.at(0), coeff[0]);
+        for(Index i(1); i < m; ++i)
+          vec_sol.axpy(_history.at(i), vec_sol, coeff[i]);
+        filter.filter_sol(vec_sol);
+        return true;
+      }
+
+      /**
+       * \brief Computes an initial guess for the next system
+       *
+       * This function computes the initial guess according to the chosen extrapolation mode.
+       * If the history is empty or the mode is ExtrapolationMode::none, the vector is left unchanged.
+       *
+       * \param[inout] vec_sol
+       * The vector that receives the initial guess.
+       *
+       * \param[in] matrix
+       * The system matrix of the next system.
+       *
+       * \param[in] filter
+       * The system filter of the next system.
+       *
+       * \param[in] vec_rhs
+       * The right-hand-side vector of the next system.
+       *
+       * \returns
+       * \c true, if an initial guess was computed, otherwise \c false.
+       */
+      template<typename Matrix_, typename Filter_>
+      bool predict(VectorType& vec_sol, const Matrix_& matrix, const Filter_& filter, const VectorType& vec_rhs) const
+      {
+        switch(_mode)
+        {
+        case ExtrapolationMode::polynomial:
+          if(!extrapolate(vec_sol))
+            return false;
+          filter.filter_sol(vec_sol);
+          return true;
+
+        case ExtrapolationMode::pod:
+          return project(vec_sol, matrix, filter, vec_rhs);
+
+        default:
+          return false;
+        }
+      }
+
+    protected:
+      /**
+       * \brief Computes the eigenpairs of a small symmetric matrix by the cyclic Jacobi method
+       *
+       * \param[in] n
+       * The dimension of the matrix.
+       *
+       * \param[in] a
+       * The row-major symmetric matrix; is overwritten.
+       *
+       * \param[out] v
+       * The row-major matrix whose columns receive the eigenvectors.
+       *
+       * \param[out] lambda
+       * The vector that receives the eigenvalues.
+       */
+      static void _sym_eigen(const Index n, std::vector<DataType>& a, std::vector<DataType>& v, std::vector<DataType>& lambda)
+      {
+        for(Index i(0); i < n; ++i)
+          for(Index j(0); j < n; ++j)
+            v[i*n + j] = (i == j ? DataType(1) : DataType(0));
+
+        for(int sweep(0); sweep < 50; ++sweep)
+        {
+          // compute off-diagonal norm
+          DataType off(0), diag(0);
+          for(Index i(0); i < n; ++i)
+          {
+            diag += Math::sqr(a[i*n + i]);
+            for(Index j(i+1); j < n; ++j)
+              off += Math::sqr(a[i*n + j]);
+          }
+          if(off <= Math::sqr(Math::eps<DataType>()) * diag)
+            break;
+
+          for(Index p(0); p < n; ++p)
+          {
+            for(Index q(p+1); q < n; ++q)
+            {
+              const DataType apq = a[p*n + q];
+              if(apq == DataType(0))
+                continue;
+
+              // compute Jacobi rotation
+              const DataType theta = (a[q*n + q] - a[p*n + p]) / (DataType(2) * apq);
+              const DataType t = (theta >= DataType(0) ? DataType(1) : -DataType(1)) /
+                (Math::abs(theta) + Math::sqrt(theta*theta + DataType(1)));
+              const DataType c = DataType(1) / Math::sqrt(t*t + DataType(1));
+              const DataType s = t * c;
+
+              // apply rotation to A from both sides and accumulate V
+              for(Index k(0); k < n; ++k)
+              {
+                const DataType akp = a[k*n + p], akq = a[k*n + q];
+                a[k*n + p] = c*akp - s*akq;
+                a[k*n + q] = s*akp + c*akq;
+              }
+              for(Index k(0); k < n; ++k)
+              {
+                const DataType apk = a[p*n + k], aqk = a[q*n + k];
+                a[p*n + k] = c*apk - s*aqk;
+                a[q*n + k] = s*apk + c*aqk;
+              }
+              for(Index k(0); k < n; ++k)
+              {
+                const DataType vkp = v[k*n + p], vkq = v[k*n + q];
+                v[k*n + p] = c*vkp - s*vkq;
+                v[k*n + q] = s*vkp + c*vkq;
+              }
+            }
+          }
+        }
+
+        for(Index i(0); i < n; ++i)
+          lambda[i] = a[i*n + i];
+      }
+    }; // class SolutionExtrapolator<...>
+  } // namespace Solver
+} // namespace FEAT
+
+#endif // KERNEL_SOLVER_SOLUTION_EXTRAPOLATOR_HPP
@@ -19,6 +19,8 @@
 #include <kernel/solver/richardson.hpp>
 #include <kernel/solver/chebyshev.hpp>
 #include <kernel/solver/fgmres.hpp>
+#include <kernel/solver/dfgmres.hpp>
+#include <kernel/solver/dpcg.hpp>
 #include <kernel/solver/rgcr.hpp>
 #include <kernel/solver/pipepcg.hpp>
 #include <kernel/solver/gropppcg.hpp>
@@ -459,6 +461,18 @@ namespace FEAT
             auto& filters = matrix_stock.template get_filters<SolverVectorType_>(nullptr, nullptr, nullptr, nullptr);
             result = Solver::new_fgmres(section_name, section, systems.at(solver_level), filters.at(solver_level), precon);
           }
+          else if (solver_type == "dfgmres")
+          {
+            auto& systems = matrix_stock.template get_systems<SolverVectorType_>(nullptr, nullptr, nullptr, nullptr);
+            auto& filters = matrix_stock.template get_filters<SolverVectorType_>(nullptr, nullptr, nullptr, nullptr);
+            result = Solver::new_dfgmres(section_name, section, systems.at(solver_level), filters.at(solver_level), precon);
+          }
+          else if (solver_type == "dpcg")
+          {
+            auto& systems = matrix_stock.template get_systems<SolverVectorType_>(nullptr, nullptr, nullptr, nullptr);
+            auto& filters = matrix_stock.template get_filters<SolverVectorType_>(nullptr, nullptr, nullptr, nullptr);
+            result = Solver::new_dpcg(section_name, section, systems.at(solver_level), filters.at(solver_level), precon);
+          }
           else if (solver_type == "richardson")
           {
             auto& systems = matrix_stock.template get_systems<SolverVectorType_>(nullptr, nullptr, nullptr, nullptr);
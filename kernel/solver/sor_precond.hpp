@@ -213,6 +213,36 @@ namespace FEAT
           pout[i] = _omega * (pin[i] - d) / pval[col];
         }
       }
+
+      void _apply_intern(const LAFEM::SparseMatrixDCSR<Mem::Main, DataType, IndexType>& matrix, VectorType& vec_cor, const VectorType& vec_def)
+      {
+        // create pointers
+        DataType * pout(vec_cor.elements());
+        const DataType * pin(vec_def.elements());
+        const DataType * pval(matrix.val());
+        const IndexType * prow_ptr(matrix.row_ptr());
+        const IndexType n((IndexType(matrix.rows())));
+        std::vector<IndexType> col_ind;
+
+        // __forward-insertion__
+        // iteration over all rows
+        for (IndexType i(0); i < n; ++i)
+        {
+          // decode the column indices of this row
+          col_ind.resize(matrix.get_length_of_line(i));
+          matrix.decode_line(i, col_ind.data());
+          const DataType * prow_val(pval + prow_ptr[i]);
+
+          IndexType k;
+          DataType d(0);
+          // iteration over all elements on the left side of the main-diagonal
+          for (k = 0; col_ind[k] < i; ++k)
+          {
+            d += prow_val[k] * pout[col_ind[k]];
+          }
+          pout[i] = _omega * (pin[i] - d) / prow_val[k];
+        }
+      }
     }; // class SORPrecond<SparseMatrixCSR<Mem::Main>>
 
     template<typename Filter_, typename DT_, typename IT_, int BlockHeight_, int BlockWidth_>
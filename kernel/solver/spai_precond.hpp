@@ -222,44 +222,91 @@ nextj:
         };
 #endif
 
+
+      /// multiplies a vector with an approximate inverse stored in a (possibly) different data type
+      template<typename DT_, typename DTS_, typename IT_>
+      void spai_apply_mixed(LAFEM::DenseVector<Mem::Main, DT_, IT_>& vec_cor,
+        const LAFEM::SparseMatrixCSR<Mem::Main, DTS_, IT_>& matrix_m, const LAFEM::DenseVector<Mem::Main, DT_, IT_>& vec_def)
+      {
+        XASSERTM(vec_cor.size() == matrix_m.rows(), "Vector size does not match!");
+        XASSERTM(vec_def.size() == matrix_m.columns(), "Vector size does not match!");
+        XASSERTM(vec_cor.elements() != vec_def.elements(), "Input- and output-vectors must be different!");
+        LAFEM::Arch::Apply<Mem::Main>::csr_mixed(vec_cor.elements(), DT_(1), vec_def.elements(), DT_(0), vec_cor.elements(),
+          matrix_m.val(), matrix_m.col_ind(), matrix_m.row_ptr(), matrix_m.rows(), matrix_m.columns(), matrix_m.used_elements());
+      }
     } // namespace Intern
     /// \endcond
 
-
-    template<typename Matrix_, typename Filter_>
+    /**
+     * \brief SPAI preconditioner
+     *
+     * For matrices in Mem::Main, the optional template parameter \p DTS_ specifies the data type which
+     * is used for the storage of the approximate inverse M. Choosing a lower precision here (e.g. float
+     * in a double solver) reduces the memory traffic of the apply. The approximate inverse is always
+     * computed in the data type of the matrix and rounded to \p DTS_ afterwards. So far, reduced precision
+     * storage is only supported for LAFEM::SparseMatrixCSR.
+     *
+     * \tparam Matrix_
+     * The type of the system matrix.
+     *
+     * \tparam Filter_
+     * The type of the system filter.
+     *
+     * \tparam DTS_
+     * The data type used for storing the approximate inverse.
+     */
+    template<typename Matrix_, typename Filter_, typename DTS_ = typename Matrix_::DataType>
     class SPAIPrecond;
 
     /// general spai implementation without any optimisations
-    template<typename DT_, typename IT_, typename Filter_>
-      class SPAIPrecond<LAFEM::SparseMatrixCSR<Mem::Main, DT_, IT_>, Filter_> : public SolverBase<typename LAFEM::SparseMatrixCSR<Mem::Main, DT_, IT_>::VectorTypeL>
+    template<typename DT_, typename IT_, typename Filter_, typename DTS_>
+      class SPAIPrecond<LAFEM::SparseMatrixCSR<Mem::Main, DT_, IT_>, Filter_, DTS_> : public SolverBase<typename LAFEM::SparseMatrixCSR<Mem::Main, DT_, IT_>::VectorTypeL>
     {
       public:
         typedef LAFEM::SparseMatrixCSR<Mem::Main, DT_, IT_> MatrixType;
         typedef typename MatrixType::VectorTypeR VectorType;
+        typedef DTS_ DataTypeStorage;
 
         /// the filter object
         const Filter_& _filter;
-        /// the actual preconditioner object
-        SPAIPreconditioner<MatrixType, VectorType> _precond;
+        /// the actual preconditioner object; only kept if M is stored in the matrix data type
+        std::unique_ptr<SPAIPreconditioner<MatrixType, VectorType>> _precond;
+        /// the approximate inverse M stored in reduced precision
+        LAFEM::SparseMatrixCSR<Mem::Main, DTS_, IT_> _matrix_m;
 
         template<typename... Args_>
           explicit SPAIPrecond(const MatrixType& matrix, const Filter_& filter) :
             _filter(filter),
-            _precond(matrix)
+            _precond(new SPAIPreconditioner<MatrixType, VectorType>(matrix))
       {
+        if(!std::is_same<DTS_, DT_>::value)
+        {
+          // round M to the storage data type and drop the original one
+          _matrix_m.convert(_precond->get_M());
+          _precond.reset();
+        }
       }
 
         /// Returns the name of the solver.
         virtual String name() const override
         {
-          return _precond.name();
+          return "SPAI";
+        }
+
+        /// Returns the total number of bytes currently allocated in this object.
+        std::size_t bytes() const
+        {
+          return (_precond ? _precond->get_M().bytes() : std::size_t(0)) + _matrix_m.bytes();
         }
 
         /// Applies the preconditioner.
         virtual Status apply(VectorType& vec_cor, const VectorType& vec_def) override
         {
           TimeStamp ts_start;
-          _precond.apply(vec_cor, vec_def);
+          if(_precond)
+            _precond->apply(vec_cor, vec_def);
+          else
+            Intern::spai_apply_mixed(vec_cor, _matrix_m, vec_def);
           this->_filter.filter_cor(vec_cor);
           TimeStamp ts_stop;
           Statistics::add_time_precon(ts_stop.elapsed(ts_start));
@@ -268,13 +315,15 @@ nextj:
     };
 
     /// general spai implementation without any optimisations
-    template<typename DT_, typename IT_, typename Filter_>
-      class SPAIPrecond<LAFEM::SparseMatrixELL<Mem::Main, DT_, IT_>, Filter_> : public SolverBase<typename LAFEM::SparseMatrixELL<Mem::Main, DT_, IT_>::VectorTypeL>
+    template<typename DT_, typename IT_, typename Filter_, typename DTS_>
+      class SPAIPrecond<LAFEM::SparseMatrixELL<Mem::Main, DT_, IT_>, Filter_, DTS_> : public SolverBase<typename LAFEM::SparseMatrixELL<Mem::Main, DT_, IT_>::VectorTypeL>
     {
       public:
         typedef LAFEM::SparseMatrixELL<Mem::Main, DT_, IT_> MatrixType;
         typedef typename MatrixType::VectorTypeR VectorType;
 
+        static_assert(std::is_same<DTS_, DT_>::value, "reduced precision storage is not supported for SparseMatrixELL");
+
         /// the filter object
         const Filter_& _filter;
         /// the actual preconditioner object
@@ -321,8 +370,8 @@ nextj:
      *
      * \author David Schneider
      */
-    template<typename DT_,  typename Filter_>
-      class SPAIPrecond<LAFEM::SparseMatrixCSR<Mem::Main, DT_, unsigned long>, Filter_> :
+    template<typename DT_,  typename Filter_, typename DTS_>
+      class SPAIPrecond<LAFEM::SparseMatrixCSR<Mem::Main, DT_, unsigned long>, Filter_, DTS_> :
       public SolverBase<typename LAFEM::SparseMatrixCSR<Mem::Main, DT_, unsigned long>::VectorTypeL>
       {
         public:
@@ -332,12 +381,16 @@ nextj:
           typedef typename MatrixType::VectorTypeL VectorType;
           typedef typename MatrixType::DataType DataType;
           typedef typename MatrixType::IndexType IndexType;
+          typedef DTS_ DataTypeStorage;
 
         protected:
           const MatrixType& _matrix;
           const FilterType& _filter;
           Index _chunksize;
+          /// the approximate inverse; empty if it is stored in reduced precision
           MatrixType _M;
+          /// the approximate inverse in reduced precision
+          LAFEM::SparseMatrixCSR<Mem::Main, DTS_, unsigned long> _M_s;
 
         public:
           /**
@@ -381,23 +434,34 @@ nextj:
           virtual void done_symbolic() override
           {
             _M.clear();
+            _M_s.clear();
           }
 
           virtual void init_numeric() override
           {
             _M = Intern::SPAIFactory<MatrixType>::construct_M(_matrix, _chunksize);
+            if(!std::is_same<DTS_, DT_>::value)
+            {
+              // round M to the storage data type and drop the original one
+              _M_s.convert(_M);
+              _M.clear();
+            }
           }
 
           virtual Status apply(VectorType& vec_cor, const VectorType& vec_def) override
           {
             // multiply with the SPAI
-            _M.apply(vec_cor, vec_def);
+            if(std::is_same<DTS_, DT_>::value)
+              _M.apply(vec_cor, vec_def);
+            else
+              Intern::spai_apply_mixed(vec_cor, _M_s, vec_def);
             // apply filter
             this->_filter.filter_cor(vec_cor);
 
             return Status::success;
           }
 
+          /// Returns the approximate inverse; empty if it is stored in reduced precision.
           const MatrixType& get_spai() const
           {
             return _M;
@@ -407,8 +471,8 @@ nextj:
 #endif
 
 #ifdef FEAT_HAVE_CUDA
-    template<typename DT_, typename Filter_>
-      class SPAIPrecond<LAFEM::SparseMatrixCSR<Mem::CUDA, DT_, unsigned int>, Filter_> :
+    template<typename DT_, typename Filter_, typename DTS_>
+      class SPAIPrecond<LAFEM::SparseMatrixCSR<Mem::CUDA, DT_, unsigned int>, Filter_, DTS_> :
       public SolverBase<typename LAFEM::SparseMatrixCSR<Mem::CUDA, DT_, unsigned int>::VectorTypeL>
       {
         public:
@@ -419,6 +483,8 @@ nextj:
           typedef typename MatrixType::DataType DataType;
           typedef typename MatrixType::IndexType IndexType;
 
+          static_assert(std::is_same<DTS_, DT_>::value, "reduced precision storage is only supported in Mem::Main");
+
         protected:
           const MatrixType& _matrix;
           const FilterType& _filter;
@@ -493,8 +559,8 @@ nextj:
 #endif
 
     /// SPAIPrecond specialisation for saddle point matrices
-    template<typename MatrixA_, typename MatrixB_, typename MatrixD_, typename Filter_>
-    class SPAIPrecond<LAFEM::SaddlePointMatrix<MatrixA_, MatrixB_, MatrixD_>, Filter_> :
+    template<typename MatrixA_, typename MatrixB_, typename MatrixD_, typename Filter_, typename DTS_>
+    class SPAIPrecond<LAFEM::SaddlePointMatrix<MatrixA_, MatrixB_, MatrixD_>, Filter_, DTS_> :
       public SolverBase<LAFEM::TupleVector<typename MatrixB_::VectorTypeL, typename MatrixD_::VectorTypeL>>
       {
         public:
@@ -512,6 +578,8 @@ nextj:
         /// our index type
         typedef typename MatrixType::MemType MemType;
 
+        static_assert(std::is_same<DTS_, DataType>::value, "reduced precision storage is not supported for SaddlePointMatrix");
+
         protected:
         const MatrixType& _matrix;
         const FilterType& _filter;
@@ -568,7 +636,7 @@ nextj:
       }; // class SPAIPrecond<...>
 
     /// Dummy class for not implemented specialisations
-    template<typename Matrix_, typename Filter_>
+    template<typename Matrix_, typename Filter_, typename DTS_>
     class SPAIPrecond :
       public SolverBase<typename Matrix_::VectorTypeL>
     {
@@ -193,6 +193,55 @@ namespace FEAT
         }
       }
 
+      void _apply_intern(const LAFEM::SparseMatrixDCSR<Mem::Main, DataType, IndexType>& matrix, VectorType& vec_cor, const VectorType& vec_def)
+      {
+        // create pointers
+        DataType * pout(vec_cor.elements());
+        const DataType * pin(vec_def.elements());
+        const DataType * pval(matrix.val());
+        const IndexType * prow_ptr(matrix.row_ptr());
+        const IndexType n((IndexType(matrix.rows())));
+        std::vector<IndexType> col_ind;
+
+        // __forward-insertion__
+        // iteration over all rows
+        for (Index i(0); i < n; ++i)
+        {
+          // decode the column indices of this row
+          col_ind.resize(matrix.get_length_of_line(i));
+          matrix.decode_line(i, col_ind.data());
+          const DataType * prow_val(pval + prow_ptr[i]);
+
+          IndexType k;
+          DataType d(0);
+          // iteration over all elements on the left side of the main-diagonal
+          for (k = 0; col_ind[k] < i; ++k)
+          {
+            d += prow_val[k] * pout[col_ind[k]];
+          }
+          pout[i] = (pin[i] - _omega * d) / prow_val[k];
+        }
+
+        // __backward-insertion__
+        // iteration over all rows
+        for (Index i(n); i > 0;)
+        {
+          --i;
+          col_ind.resize(matrix.get_length_of_line(i));
+          matrix.decode_line(i, col_ind.data());
+          const DataType * prow_val(pval + prow_ptr[i]);
+
+          IndexType k;
+          DataType d(0);
+          // iteration over all elements on the right side of the main-diagonal
+          for (k = IndexType(col_ind.size()) - IndexType(1); col_ind[k] > i; --k)
+          {
+            d += prow_val[k] * pout[col_ind[k]];
+          }
+          pout[i] -= _omega * d / prow_val[k];
+        }
+      }
+
       void _apply_intern(const LAFEM::SparseMatrixELL<Mem::Main, DataType, IndexType>& matrix, VectorType& vec_cor, const VectorType& vec_def)
       {
         // create pointers
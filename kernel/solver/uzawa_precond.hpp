@@ -225,7 +225,7 @@ namespace FEAT
 
       virtual Status apply(VectorType& vec_cor, const VectorType& vec_def) override
       {
-        Statistics::add_solver_expression(std::make_shared<ExpressionStartSolve>(this->name()));
+        Statistics::add_solver_expression(ExpressionStartSolve(this->expression_name()));
         // fetch the references
         VectorTypeV& tmp_v = this->_vec_tmp_v;
         VectorTypeP& tmp_p = this->_vec_tmp_p;
@@ -239,31 +239,31 @@ namespace FEAT
         {
         case UzawaType::diagonal:
           // solve A*u_v = f_v
-          Statistics::add_solver_expression(std::make_shared<ExpressionCallUzawaA>(this->name(), this->_solver_a->name()));
+          Statistics::add_solver_expression(ExpressionCallUzawaA(this->expression_name(), this->_solver_a->expression_name()));
           if(!status_success(_solver_a->apply(sol_v, rhs_v)))
           {
-            Statistics::add_solver_expression(std::make_shared<ExpressionEndSolve>(this->name(), Status::aborted, 0));
+            Statistics::add_solver_expression(ExpressionEndSolve(this->expression_name(), Status::aborted, 0));
             return Status::aborted;
           }
 
           // solve S*u_p = f_p
-          Statistics::add_solver_expression(std::make_shared<ExpressionCallUzawaS>(this->name(), this->_solver_s->name()));
+          Statistics::add_solver_expression(ExpressionCallUzawaS(this->expression_name(), this->_solver_s->expression_name()));
           if(!status_success(_solver_s->apply(sol_p, rhs_p)))
           {
-            Statistics::add_solver_expression(std::make_shared<ExpressionEndSolve>(this->name(), Status::aborted, 0));
+            Statistics::add_solver_expression(ExpressionEndSolve(this->expression_name(), Status::aborted, 0));
             return Status::aborted;
           }
 
           // okay
-          Statistics::add_solver_expression(std::make_shared<ExpressionEndSolve>(this->name(), Status::success, 0));
+          Statistics::add_solver_expression(ExpressionEndSolve(this->expression_name(), Status::success, 0));
           return Status::success;
 
         case UzawaType::lower:
           // solve A*u_v = f_v
-          Statistics::add_solver_expression(std::make_shared<ExpressionCallUzawaA>(this->name(), this->_solver_a->name()));
+          Statistics::add_solver_expression(ExpressionCallUzawaA(this->expression_name(), this->_solver_a->expression_name()));
           if(!status_success(_solver_a->apply(sol_v, rhs_v)))
           {
-            Statistics::add_solver_expression(std::make_shared<ExpressionEndSolve>(this->name(), Status::aborted, 0));
+            Statistics::add_solver_expression(ExpressionEndSolve(this->expression_name(), Status::aborted, 0));
             return Status::aborted;
           }
 
@@ -274,23 +274,23 @@ namespace FEAT
           this->_filter_p.filter_def(tmp_p);
 
           // solve S*u_p = g_p
-          Statistics::add_solver_expression(std::make_shared<ExpressionCallUzawaS>(this->name(), this->_solver_s->name()));
+          Statistics::add_solver_expression(ExpressionCallUzawaS(this->expression_name(), this->_solver_s->expression_name()));
           if(!status_success(_solver_s->apply(sol_p, tmp_p)))
           {
-            Statistics::add_solver_expression(std::make_shared<ExpressionEndSolve>(this->name(), Status::aborted, 0));
+            Statistics::add_solver_expression(ExpressionEndSolve(this->expression_name(), Status::aborted, 0));
             return Status::aborted;
           }
 
           // okay
-          Statistics::add_solver_expression(std::make_shared<ExpressionEndSolve>(this->name(), Status::success, 0));
+          Statistics::add_solver_expression(ExpressionEndSolve(this->expression_name(), Status::success, 0));
           return Status::success;
 
         case UzawaType::upper:
           // solve S*u_p = f_p
-          Statistics::add_solver_expression(std::make_shared<ExpressionCallUzawaS>(this->name(), this->_solver_s->name()));
+          Statistics::add_solver_expression(ExpressionCallUzawaS(this->expression_name(), this->_solver_s->expression_name()));
           if(!status_success(_solver_s->apply(sol_p, rhs_p)))
           {
-            Statistics::add_solver_expression(std::make_shared<ExpressionEndSolve>(this->name(), Status::aborted, 0));
+            Statistics::add_solver_expression(ExpressionEndSolve(this->expression_name(), Status::aborted, 0));
             return Status::aborted;
           }
 
@@ -301,25 +301,25 @@ namespace FEAT
           this->_filter_v.filter_def(tmp_v);
 
           // solve A*u_v = g_v
-          Statistics::add_solver_expression(std::make_shared<ExpressionCallUzawaA>(this->name(), this->_solver_a->name()));
+          Statistics::add_solver_expression(ExpressionCallUzawaA(this->expression_name(), this->_solver_a->expression_name()));
           if(!status_success(_solver_a->apply(sol_v, tmp_v)))
           {
-            Statistics::add_solver_expression(std::make_shared<ExpressionEndSolve>(this->name(), Status::aborted, 0));
+            Statistics::add_solver_expression(ExpressionEndSolve(this->expression_name(), Status::aborted, 0));
             return Status::aborted;
           }
 
           // okay
-          Statistics::add_solver_expression(std::make_shared<ExpressionEndSolve>(this->name(), Status::success, 0));
+          Statistics::add_solver_expression(ExpressionEndSolve(this->expression_name(), Status::success, 0));
           return Status::success;
 
         case UzawaType::full:
           // Note: We will use the first component of the solution vector here.
           //       It will be overwritten by the third solution step below.
           // solve A*u_v = f_v
-          Statistics::add_solver_expression(std::make_shared<ExpressionCallUzawaA>(this->name(), this->_solver_a->name()));
+          Statistics::add_solver_expression(ExpressionCallUzawaA(this->expression_name(), this->_solver_a->expression_name()));
           if(!status_success(_solver_a->apply(sol_v, rhs_v)))
           {
-            Statistics::add_solver_expression(std::make_shared<ExpressionEndSolve>(this->name(), Status::aborted, 0));
+            Statistics::add_solver_expression(ExpressionEndSolve(this->expression_name(), Status::aborted, 0));
             return Status::aborted;
           }
 
@@ -330,10 +330,10 @@ namespace FEAT
           this->_filter_p.filter_def(tmp_p);
 
           // solve S*u_p = g_p
-          Statistics::add_solver_expression(std::make_shared<ExpressionCallUzawaS>(this->name(), this->_solver_s->name()));
+          Statistics::add_solver_expression(ExpressionCallUzawaS(this->expression_name(), this->_solver_s->expression_name()));
           if(!status_success(_solver_s->apply(sol_p, tmp_p)))
           {
-            Statistics::add_solver_expression(std::make_shared<ExpressionEndSolve>(this->name(), Status::aborted, 0));
+            Statistics::add_solver_expression(ExpressionEndSolve(this->expression_name(), Status::aborted, 0));
             return Status::aborted;
           }
 
@@ -344,20 +344,20 @@ namespace FEAT
           this->_filter_v.filter_def(tmp_v);
 
           // solve A*u_v = g_v
-          Statistics::add_solver_expression(std::make_shared<ExpressionCallUzawaA>(this->name(), this->_solver_a->name()));
+          Statistics::add_solver_expression(ExpressionCallUzawaA(this->expression_name(), this->_solver_a->expression_name()));
           if(!status_success(_solver_a->apply(sol_v, tmp_v)))
           {
-            Statistics::add_solver_expression(std::make_shared<ExpressionEndSolve>(this->name(), Status::aborted, 0));
+            Statistics::add_solver_expression(ExpressionEndSolve(this->expression_name(), Status::aborted, 0));
             return Status::aborted;
           }
 
           // okay
-          Statistics::add_solver_expression(std::make_shared<ExpressionEndSolve>(this->name(), Status::success, 0));
+          Statistics::add_solver_expression(ExpressionEndSolve(this->expression_name(), Status::success, 0));
           return Status::success;
         }
 
         // we should never come out here...
-        Statistics::add_solver_expression(std::make_shared<ExpressionEndSolve>(this->name(), Status::aborted, 0));
+        Statistics::add_solver_expression(ExpressionEndSolve(this->expression_name(), Status::aborted, 0));
         return Status::aborted;
       }
     }; // class UzawaPrecond<...>
@@ -527,7 +527,7 @@ namespace FEAT
 
       virtual Status apply(GlobalVectorType& vec_cor, const GlobalVectorType& vec_def) override
       {
-        Statistics::add_solver_expression(std::make_shared<ExpressionStartSolve>(this->name()));
+        Statistics::add_solver_expression(ExpressionStartSolve(this->expression_name()));
         // first of all, copy RHS
         _vec_rhs_v.local().copy(vec_def.local().template at<0>());
         _vec_rhs_p.local().copy(vec_def.local().template at<1>());
@@ -537,18 +537,18 @@ namespace FEAT
         {
         case UzawaType::diagonal:
           // solve A*u_v = f_v
-          Statistics::add_solver_expression(std::make_shared<ExpressionCallUzawaA>(this->name(), this->_solver_a->name()));
+          Statistics::add_solver_expression(ExpressionCallUzawaA(this->expression_name(), this->_solver_a->expression_name()));
           if(!status_success(_solver_a->apply(_vec_sol_v, _vec_rhs_v)))
           {
-            Statistics::add_solver_expression(std::make_shared<ExpressionEndSolve>(this->name(), Status::aborted, 0));
+            Statistics::add_solver_expression(ExpressionEndSolve(this->expression_name(), Status::aborted, 0));
             return Status::aborted;
           }
 
           // solve S*u_p = f_p
-          Statistics::add_solver_expression(std::make_shared<ExpressionCallUzawaS>(this->name(), this->_solver_s->name()));
+          Statistics::add_solver_expression(ExpressionCallUzawaS(this->expression_name(), this->_solver_s->expression_name()));
           if(!status_success(_solver_s->apply(_vec_sol_p, _vec_rhs_p)))
           {
-            Statistics::add_solver_expression(std::make_shared<ExpressionEndSolve>(this->name(), Status::aborted, 0));
+            Statistics::add_solver_expression(ExpressionEndSolve(this->expression_name(), Status::aborted, 0));
             return Status::aborted;
           }
 
@@ -557,10 +557,10 @@ namespace FEAT
 
         case UzawaType::lower:
           // solve A*u_v = f_v
-          Statistics::add_solver_expression(std::make_shared<ExpressionCallUzawaA>(this->name(), this->_solver_a->name()));
+          Statistics::add_solver_expression(ExpressionCallUzawaA(this->expression_name(), this->_solver_a->expression_name()));
           if(!status_success(_solver_a->apply(_vec_sol_v, _vec_rhs_v)))
           {
-            Statistics::add_solver_expression(std::make_shared<ExpressionEndSolve>(this->name(), Status::aborted, 0));
+            Statistics::add_solver_expression(ExpressionEndSolve(this->expression_name(), Status::aborted, 0));
             return Status::aborted;
           }
 
@@ -571,10 +571,10 @@ namespace FEAT
           _filter_p.filter_def(_vec_def_p);
 
           // solve S*u_p = g_p
-          Statistics::add_solver_expression(std::make_shared<ExpressionCallUzawaS>(this->name(), this->_solver_s->name()));
+          Statistics::add_solver_expression(ExpressionCallUzawaS(this->expression_name(), this->_solver_s->expression_name()));
           if(!status_success(_solver_s->apply(_vec_sol_p, _vec_def_p)))
           {
-            Statistics::add_solver_expression(std::make_shared<ExpressionEndSolve>(this->name(), Status::aborted, 0));
+            Statistics::add_solver_expression(ExpressionEndSolve(this->expression_name(), Status::aborted, 0));
             return Status::aborted;
           }
 
@@ -583,10 +583,10 @@ namespace FEAT
 
         case UzawaType::upper:
           // solve S*u_p = f_p
-          Statistics::add_solver_expression(std::make_shared<ExpressionCallUzawaS>(this->name(), this->_solver_s->name()));
+          Statistics::add_solver_expression(ExpressionCallUzawaS(this->expression_name(), this->_solver_s->expression_name()));
           if(!status_success(_solver_s->apply(_vec_sol_p, _vec_rhs_p)))
           {
-            Statistics::add_solver_expression(std::make_shared<ExpressionEndSolve>(this->name(), Status::aborted, 0));
+            Statistics::add_solver_expression(ExpressionEndSolve(this->expression_name(), Status::aborted, 0));
             return Status::aborted;
           }
 
@@ -597,10 +597,10 @@ namespace FEAT
           _filter_v.filter_def(_vec_def_v);
 
           // solve A*u_v = g_v
-          Statistics::add_solver_expression(std::make_shared<ExpressionCallUzawaA>(this->name(), this->_solver_a->name()));
+          Statistics::add_solver_expression(ExpressionCallUzawaA(this->expression_name(), this->_solver_a->expression_name()));
           if(!status_success(_solver_a->apply(_vec_sol_v, _vec_def_v)))
           {
-            Statistics::add_solver_expression(std::make_shared<ExpressionEndSolve>(this->name(), Status::aborted, 0));
+            Statistics::add_solver_expression(ExpressionEndSolve(this->expression_name(), Status::aborted, 0));
             return Status::aborted;
           }
 
@@ -611,10 +611,10 @@ namespace FEAT
           // Note: We will use the first component of the solution vector here.
           //       It will be overwritten by the third solution step below.
           // solve A*u_v = f_v
-          Statistics::add_solver_expression(std::make_shared<ExpressionCallUzawaA>(this->name(), this->_solver_a->name()));
+          Statistics::add_solver_expression(ExpressionCallUzawaA(this->expression_name(), this->_solver_a->expression_name()));
           if(!status_success(_solver_a->apply(_vec_sol_v, _vec_rhs_v)))
           {
-            Statistics::add_solver_expression(std::make_shared<ExpressionEndSolve>(this->name(), Status::aborted, 0));
+            Statistics::add_solver_expression(ExpressionEndSolve(this->expression_name(), Status::aborted, 0));
             return Status::aborted;
           }
 
@@ -625,10 +625,10 @@ namespace FEAT
           _filter_p.filter_def(_vec_def_p);
 
           // solve S*u_p = g_p
-          Statistics::add_solver_expression(std::make_shared<ExpressionCallUzawaS>(this->name(), this->_solver_s->name()));
+          Statistics::add_solver_expression(ExpressionCallUzawaS(this->expression_name(), this->_solver_s->expression_name()));
           if(!status_success(_solver_s->apply(_vec_sol_p, _vec_def_p)))
           {
-            Statistics::add_solver_expression(std::make_shared<ExpressionEndSolve>(this->name(), Status::aborted, 0));
+            Statistics::add_solver_expression(ExpressionEndSolve(this->expression_name(), Status::aborted, 0));
             return Status::aborted;
           }
 
@@ -639,10 +639,10 @@ namespace FEAT
           _filter_v.filter_def(_vec_def_v);
 
           // solve A*u_v = g_v
-          Statistics::add_solver_expression(std::make_shared<ExpressionCallUzawaA>(this->name(), this->_solver_a->name()));
+          Statistics::add_solver_expression(ExpressionCallUzawaA(this->expression_name(), this->_solver_a->expression_name()));
           if(!status_success(_solver_a->apply(_vec_sol_v, _vec_def_v)))
           {
-            Statistics::add_solver_expression(std::make_shared<ExpressionEndSolve>(this->name(), Status::aborted, 0));
+            Statistics::add_solver_expression(ExpressionEndSolve(this->expression_name(), Status::aborted, 0));
             return Status::aborted;
           }
 
@@ -655,7 +655,7 @@ namespace FEAT
         vec_cor.local().template at<1>().copy(_vec_sol_p.local());
 
         // okay
-        Statistics::add_solver_expression(std::make_shared<ExpressionEndSolve>(this->name(), Status::success, 0));
+        Statistics::add_solver_expression(ExpressionEndSolve(this->expression_name(), Status::success, 0));
         return Status::success;
       }
     }; // class UzawaPrecond<...>
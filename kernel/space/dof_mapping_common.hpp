@@ -9,6 +9,7 @@
 
 // includes, FEAT
 #include <kernel/space/dof_mapping_base.hpp>
+#include <kernel/space/dof_table.hpp>
 #include <kernel/util/assertion.hpp>
 
 namespace FEAT
@@ -67,6 +68,9 @@ namespace FEAT
      * This class implements the Dof-Mapping interface for a finite-element space which has dofs only
      * in one specific entity dimension.
      *
+     * If the DofTable of the space has been compiled and is still valid for the mesh of the space,
+     * the dof indices are read from the table instead of the index set of the mesh.
+     *
      * \tparam Space_
      * The finite-element space that this dof-mapping is used by.
      *
@@ -110,15 +114,34 @@ namespace FEAT
     protected:
       /// dofs-at-cell index set reference
       const IndexSetType& _index_set;
+      /// pointer to the row of the dof table of the space or nullptr
+      const Index* _table_idx;
 
     public:
       /** \copydoc DofMappingBase::DofMappingBase() */
       explicit DofMappingSingleEntity(const Space_& space) :
         DofMappingBase<Space_>(space),
-        _index_set(space.get_trafo().get_mesh().template get_index_set<shape_dim, dof_dim>())
+        _index_set(space.get_trafo().get_mesh().template get_index_set<shape_dim, dof_dim>()),
+        _table_idx(nullptr)
       {
       }
 
+      /** \copydoc DofMappingBase::prepare() */
+      void prepare(Index cell_index)
+      {
+        DofMappingBase<Space_>::prepare(cell_index);
+
+        // use the precomputed dof table of the space, if it is up to date
+        const DofTable& dof_table = this->_space.get_dof_table();
+        if(dof_table.is_valid(this->_space))
+        {
+          ASSERTM(dof_table.get_num_local_dofs() == get_num_local_dofs(), "dof table does not match dof mapping");
+          _table_idx = dof_table.get_cell_dofs(cell_index);
+        }
+        else
+          _table_idx = nullptr;
+      }
+
       /** \copydoc DofMappingBase::get_num_local_dofs() */
       int get_num_local_dofs() const
       {
@@ -134,6 +157,8 @@ namespace FEAT
       /** \copydoc DofMappingBase::get_index() */
       Index get_index(int local_dof_idx) const
       {
+        if(_table_idx != nullptr)
+          return _table_idx[local_dof_idx];
         int ldi_q = local_dof_idx / dofs_per_cell_;
         int ldi_r = local_dof_idx % dofs_per_cell_;
         return Index(dofs_per_cell_) * _index_set(this->_cell_index, ldi_q) + Index(ldi_r);
@@ -178,6 +203,10 @@ namespace FEAT
      * This class implements the Dof-Mapping interface for a uniform finite-element space, which has
      * a fixed number of dofs for each entity dimension.
      *
+     * If the DofTable of the space has been compiled and is still valid for the mesh of the space,
+     * the dof indices are read from the table instead of being recomputed from the index sets of
+     * the mesh in each call of #prepare().
+     *
      * \tparam Space_
      * The finite-element space that this dof-mapping is used by.
      *
@@ -207,10 +236,13 @@ namespace FEAT
     private:
       /// dof index vector
       Index dof_idx[dof_count];
+      /// pointer to the row of the dof table of the space or nullptr
+      const Index* table_idx;
 
     public:
       explicit DofMappingUniform(const SpaceType& space) :
-        BaseClass(space)
+        BaseClass(space),
+        table_idx(nullptr)
       {
       }
 
@@ -218,6 +250,17 @@ namespace FEAT
       void prepare(Index cell_index)
       {
         BaseClass::prepare(cell_index);
+
+        // use the precomputed dof table of the space, if it is up to date
+        const DofTable& dof_table = this->_space.get_dof_table();
+        if(dof_table.is_valid(this->_space))
+        {
+          ASSERTM(dof_table.get_num_local_dofs() == dof_count, "dof table does not match dof mapping");
+          table_idx = dof_table.get_cell_dofs(cell_index);
+          return;
+        }
+
+        table_idx = nullptr;
         Index count(0);
         Intern::UniformDofMappingHelper<ShapeType, DofTraits_, DofTag_>
           ::assemble(dof_idx, this->_space.get_mesh(), cell_index, count);
@@ -240,7 +283,7 @@ namespace FEAT
       Index get_index(int local_dof_idx) const
       {
         ASSERTM((local_dof_idx >= 0) && (local_dof_idx < dof_count), "local dof-index out-of-range");
-        return dof_idx[local_dof_idx];
+        return (table_idx != nullptr ? table_idx[local_dof_idx] : dof_idx[local_dof_idx]);
       }
     };
 
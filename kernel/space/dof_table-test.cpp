@@ -0,0 +1,135 @@
+// FEAT3: Finite Element Analysis Toolbox, Version 3
+// Copyright (C) 2010 - 2020 by Stefan Turek & the FEAT group
+// FEAT3 is released under the GNU General Public License version 3,
+// see the file 'copyright.txt' in the top level directory for details.
+
+#include <test_system/test_system.hpp>
+#include <kernel/geometry/common_factories.hpp>
+#include <kernel/trafo/standard/mapping.hpp>
+#include <kernel/space/lagrange1/element.hpp>
+#include <kernel/space/lagrange2/element.hpp>
+#include <kernel/space/discontinuous/element.hpp>
+#include <kernel/space/dof_table.hpp>
+
+#include <cstdint>
+#include <vector>
+
+using namespace FEAT;
+using namespace FEAT::TestSystem;
+
+/**
+ * \brief Dof table test
+ *
+ * \test Tests the Space::DofTable class by comparing the tabulated indices with the indices
+ * of the dof-mappings and by checking that the dof-mappings of spaces with a compiled table
+ * return the same indices as before, both for uniform and for single-entity dof-mappings.
+ */
+class DofTableTest
+  : public TestSystem::TaggedTest<Archs::None, Archs::None>
+{
+public:
+  DofTableTest() :
+    TestSystem::TaggedTest<Archs::None, Archs::None>("DofTableTest")
+  {
+  }
+
+  virtual ~DofTableTest()
+  {
+  }
+
+  template<typename Space_>
+  static std::vector<Index> tabulate(const Space_& space)
+  {
+    std::vector<Index> idx;
+    typename Space_::DofMappingType dof_mapping(space);
+    for(Index cell(0); cell < space.get_mesh().get_num_elements(); ++cell)
+    {
+      dof_mapping.prepare(cell);
+      for(int j(0); j < dof_mapping.get_num_local_dofs(); ++j)
+        idx.push_back(dof_mapping.get_index(j));
+      dof_mapping.finish();
+    }
+    return idx;
+  }
+
+  template<typename Space_>
+  void test_space(Space_& space) const
+  {
+    // tabulate the dof-mapping without a table
+    TEST_CHECK(space.get_dof_table().empty());
+    const std::vector<Index> ref = tabulate(space);
+
+    // compile the table of the space
+    Space::DofTable& dof_table = space.get_dof_table();
+    TEST_CHECK(!dof_table.is_valid(space));
+    TEST_CHECK(dof_table.update(space));
+    TEST_CHECK(!dof_table.update(space));
+    TEST_CHECK(dof_table.is_valid(space));
+    TEST_CHECK_EQUAL(dof_table.get_num_cells(), space.get_mesh().get_num_elements());
+    TEST_CHECK_EQUAL(dof_table.get_num_global_dofs(), space.get_num_dofs());
+    TEST_CHECK_EQUAL(std::size_t(dof_table.get_num_cells()) * std::size_t(dof_table.get_num_local_dofs()), ref.size());
+    TEST_CHECK_EQUAL(reinterpret_cast<std::uintptr_t>(dof_table.get_indices()) % Space::DofTable::alignment, std::uintptr_t(0));
+
+    // compare the table entries
+    const Index* idx = dof_table.get_indices();
+    for(std::size_t i(0); i < ref.size(); ++i)
+      TEST_CHECK_EQUAL(idx[i], ref[i]);
+
+    // the dof-mapping must now return the same indices from the table
+    const std::vector<Index> tab = tabulate(space);
+    TEST_CHECK_EQUAL(tab.size(), ref.size());
+    for(std::size_t i(0); i < ref.size(); ++i)
+      TEST_CHECK_EQUAL(tab[i], ref[i]);
+
+    // mere write access to the index sets of the mesh keeps the table valid
+    space.get_mesh().template get_index_set<Space_::shape_dim, 0>();
+    TEST_CHECK(dof_table.is_valid(space));
+
+    // a modified mesh topology invalidates the table, so the dof-mapping falls back to the mesh
+    space.get_mesh().mark_topology_modified();
+    TEST_CHECK(!dof_table.is_valid(space));
+    TEST_CHECK(tabulate(space) == ref);
+    TEST_CHECK(dof_table.update(space));
+    TEST_CHECK(dof_table.is_valid(space));
+
+    // recompiling the table of the space must yield the same table
+    dof_table.compile(space);
+    idx = dof_table.get_indices();
+    for(std::size_t i(0); i < ref.size(); ++i)
+      TEST_CHECK_EQUAL(idx[i], ref[i]);
+
+    dof_table.clear();
+    TEST_CHECK(dof_table.empty());
+    TEST_CHECK_EQUAL(dof_table.bytes(), std::size_t(0));
+  }
+
+  template<typename Shape_>
+  void test_shape(int level) const
+  {
+    typedef Geometry::ConformalMesh<Shape_> MeshType;
+    typedef Trafo::Standard::Mapping<MeshType> TrafoType;
+
+    Geometry::RefineFactory<MeshType, Geometry::UnitCubeFactory> mesh_factory(level);
+    MeshType mesh(mesh_factory);
+    TrafoType trafo(mesh);
+
+    // each mesh has its own topology version
+    MeshType mesh_copy(mesh);
+    TEST_CHECK(mesh_copy.get_topology_version() != mesh.get_topology_version());
+
+    Space::Lagrange1::Element<TrafoType> space_q1(trafo);
+    Space::Lagrange2::Element<TrafoType> space_q2(trafo);
+    Space::Discontinuous::Element<TrafoType, Space::Discontinuous::Variant::StdPolyP<1>> space_p1(trafo);
+
+    test_space(space_q1);
+    test_space(space_q2);
+    test_space(space_p1);
+  }
+
+  virtual void run() const override
+  {
+    test_shape<Shape::Quadrilateral>(2);
+    test_shape<Shape::Hexahedron>(1);
+    test_shape<Shape::Triangle>(2);
+  }
+} dof_table_test;
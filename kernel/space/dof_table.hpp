@@ -0,0 +1,264 @@
+// FEAT3: Finite Element Analysis Toolbox, Version 3
+// Copyright (C) 2010 - 2020 by Stefan Turek & the FEAT group
+// FEAT3 is released under the GNU General Public License version 3,
+// see the file 'copyright.txt' in the top level directory for details.
+
+#pragma once
+#ifndef KERNEL_SPACE_DOF_TABLE_HPP
+#define KERNEL_SPACE_DOF_TABLE_HPP 1
+
+// includes, FEAT
+#include <kernel/space/base.hpp>
+#include <kernel/util/assertion.hpp>
+
+// includes, system
+#include <cstdint>
+#include <type_traits>
+#include <vector>
+
+namespace FEAT
+{
+  namespace Space
+  {
+    /// \cond internal
+    namespace Intern
+    {
+      /// returns the topology version of meshes which provide one
+      template<typename Mesh_>
+      inline auto mesh_topology_version(const Mesh_& mesh, int) -> decltype(mesh.get_topology_version())
+      {
+        return mesh.get_topology_version();
+      }
+
+      /// fallback for meshes without a topology version, e.g. structured meshes with a fixed topology
+      template<typename Mesh_>
+      inline Index mesh_topology_version(const Mesh_&, long)
+      {
+        return Index(0);
+      }
+    } // namespace Intern
+    /// \endcond
+
+    /**
+     * \brief Precomputed cell-to-dof table
+     *
+     * This class stores the global dof indices of all cells of a finite element space in a single
+     * contiguous array of size <em>num_cells x num_local_dofs</em>, i.e. the global index of the
+     * j-th local dof of the i-th cell is stored at position <em>i*num_local_dofs + j</em>. The
+     * beginning of the array is aligned to a cache line, so that cell loops which traverse the
+     * table in the order of the cells read it in consecutive cache lines.
+     *
+     * Each finite element space derived from ElementBase owns an (initially empty) dof table,
+     * which is used by the dof-mapping of the space once it has been compiled by
+     * \code
+     * space.get_dof_table().compile(space);
+     * \endcode
+     * so that all consumers of the dof-mapping, like assemblers, interpolators or Vanka smoothers,
+     * share the precomputed indices. The table can also be used directly by algorithms which
+     * process several cells at once.
+     *
+     * The table stores the cell and dof counts as well as the topology version of the mesh (see
+     * Geometry::ConformalMesh::get_topology_version()) that it was compiled for. The dof-mapping only
+     * uses the table if these still coincide with the mesh, i.e. if the index sets of the mesh may
+     * have been modified after the compilation, the dof-mapping falls back to computing the indices
+     * from the mesh until the table is brought up to date by calling the #update() function.
+     *
+     * \note
+     * A dof table can only be compiled for spaces which have the same number of local dofs on
+     * each cell, which is the case for all spaces in FEAT.
+     */
+    class DofTable
+    {
+    public:
+      /// the alignment of the index array in bytes
+      static constexpr std::size_t alignment = 64u;
+
+    protected:
+      /// the number of cells
+      Index _num_cells;
+      /// the number of local dofs per cell
+      int _num_local_dofs;
+      /// the number of global dofs
+      Index _num_global_dofs;
+      /// the topology version of the mesh that the table was compiled for
+      Index _topology_version;
+      /// the (over-allocated) index storage
+      std::vector<Index> _storage;
+      /// the offset of the aligned index array within the storage
+      std::size_t _offset;
+
+    public:
+      /// default constructor
+      DofTable() :
+        _num_cells(0),
+        _num_local_dofs(0),
+        _num_global_dofs(0),
+        _topology_version(0),
+        _offset(0)
+      {
+      }
+
+      /// no copies, since this would break the alignment; spaces share their table by a shared_ptr
+      DofTable(const DofTable&) = delete;
+      /// no copies, since this would break the alignment; spaces share their table by a shared_ptr
+      DofTable& operator=(const DofTable&) = delete;
+      /// move constructor
+      DofTable(DofTable&&) = default;
+      /// move-assignment operator
+      DofTable& operator=(DofTable&&) = default;
+
+      /// virtual destructor
+      virtual ~DofTable()
+      {
+      }
+
+      /**
+       * \brief Compiles the table for a finite element space
+       *
+       * \param[in] space
+       * The finite element space whose dof-mapping is to be tabulated. The table may be the
+       * table owned by the space itself; in this case, the table is cleared first, so that
+       * the dof-mapping of the space computes the indices from the mesh.
+       */
+      template<typename Space_>
+      void compile(const Space_& space)
+      {
+        clear();
+
+        typename Space_::DofMappingType dof_mapping(space);
+
+        const Index num_cells = space.get_mesh().get_num_entities(Space_::shape_dim);
+        const Index num_global_dofs = dof_mapping.get_num_global_dofs();
+        if(num_cells <= Index(0))
+          return;
+
+        // determine the number of local dofs from the first cell
+        dof_mapping.prepare(Index(0));
+        const int num_local_dofs = dof_mapping.get_num_local_dofs();
+        dof_mapping.finish();
+
+        // allocate storage with enough padding to align the index array
+        const std::size_t pad = alignment / sizeof(Index);
+        std::vector<Index> storage(std::size_t(num_cells) * std::size_t(num_local_dofs) + pad);
+        const std::size_t mis = (reinterpret_cast<std::uintptr_t>(storage.data()) % alignment) / sizeof(Index);
+        const std::size_t offset = (mis > std::size_t(0) ? pad - mis : std::size_t(0));
+
+        Index* idx = &storage[offset];
+        for(Index cell(0); cell < num_cells; ++cell)
+        {
+          dof_mapping.prepare(cell);
+          XASSERTM(dof_mapping.get_num_local_dofs() == num_local_dofs, "non-uniform local dof count");
+          for(int j(0); j < num_local_dofs; ++j, ++idx)
+            *idx = dof_mapping.get_index(j);
+          dof_mapping.finish();
+        }
+
+        _storage = std::move(storage);
+        _offset = offset;
+        _num_cells = num_cells;
+        _num_local_dofs = num_local_dofs;
+        _num_global_dofs = num_global_dofs;
+        _topology_version = Intern::mesh_topology_version(space.get_mesh(), 0);
+      }
+
+      /**
+       * \brief Checks whether the table fits to a finite element space
+       *
+       * \param[in] space
+       * The finite element space to be checked against.
+       *
+       * \returns
+       * \c true, if the table is not empty and the cell and global dof counts as well as the
+       * topology version of the mesh of the space coincide with those of this table, otherwise
+       * \c false.
+       */
+      template<typename Space_>
+      bool is_valid(const Space_& space) const
+      {
+        return !empty() && (_num_cells == space.get_mesh().get_num_entities(Space_::shape_dim)) &&
+          (_topology_version == Intern::mesh_topology_version(space.get_mesh(), 0)) &&
+          (_num_global_dofs == space.get_num_dofs());
+      }
+
+      /**
+       * \brief Updates the table if necessary
+       *
+       * \param[in] space
+       * The finite element space that the table is to be compiled for.
+       *
+       * \returns
+       * \c true, if the table was recompiled, otherwise \c false.
+       */
+      template<typename Space_>
+      bool update(const Space_& space)
+      {
+        if(is_valid(space))
+          return false;
+        compile(space);
+        return true;
+      }
+
+      /// Releases all data of the table.
+      void clear()
+      {
+        _num_cells = _num_global_dofs = _topology_version = Index(0);
+        _num_local_dofs = 0;
+        _storage.clear();
+        _offset = std::size_t(0);
+      }
+
+      /// \returns \c true, if the table is empty, otherwise \c false.
+      bool empty() const
+      {
+        return _storage.empty();
+      }
+
+      /// \returns The number of cells in the table.
+      Index get_num_cells() const
+      {
+        return _num_cells;
+      }
+
+      /// \returns The number of local dofs per cell.
+      int get_num_local_dofs() const
+      {
+        return _num_local_dofs;
+      }
+
+      /// \returns The number of global dofs of the tabulated space.
+      Index get_num_global_dofs() const
+      {
+        return _num_global_dofs;
+      }
+
+      /// \returns The size of dynamically allocated memory in bytes.
+      std::size_t bytes() const
+      {
+        return _storage.size() * sizeof(Index);
+      }
+
+      /// \returns A pointer to the aligned index array.
+      const Index* get_indices() const
+      {
+        return _storage.empty() ? nullptr : &_storage[_offset];
+      }
+
+      /**
+       * \brief Returns the dof indices of a cell.
+       *
+       * \param[in] cell
+       * The index of the cell whose dofs are to be returned.
+       *
+       * \returns
+       * A pointer to the array of the global dof indices of the cell.
+       */
+      const Index* get_cell_dofs(Index cell) const
+      {
+        ASSERTM(cell < _num_cells, "invalid cell index");
+        return &_storage[_offset + std::size_t(cell) * std::size_t(_num_local_dofs)];
+      }
+    }; // class DofTable
+  } // namespace Space
+} // namespace FEAT
+
+#endif // KERNEL_SPACE_DOF_TABLE_HPP
@@ -9,8 +9,12 @@
 
 // includes, FEAT
 #include <kernel/space/dof_mapping_base.hpp>
+#include <kernel/space/dof_table.hpp>
 #include <kernel/space/evaluator_base.hpp>
 
+// includes, system
+#include <memory>
+
 namespace FEAT
 {
   namespace Space
@@ -151,6 +155,8 @@ namespace FEAT
     protected:
       /// transformation reference
       TrafoType& _trafo;
+      /// precomputed dof table; empty unless compiled
+      std::shared_ptr<DofTable> _dof_table;
 
       /**
        * \brief Constructor
@@ -161,7 +167,8 @@ namespace FEAT
        * \note This constructor is protected so that it can only be called from a derived class.
        */
       explicit ElementBase(TrafoType& trafo)
-        : _trafo(trafo)
+        : _trafo(trafo),
+        _dof_table(std::make_shared<DofTable>())
       {
       }
 
@@ -200,6 +207,26 @@ namespace FEAT
         return get_trafo().get_mesh();
       }
 
+      /**
+       * \brief Returns a reference to the dof table.
+       *
+       * If the dof table has been compiled and is still valid for the mesh, it is used by the
+       * dof-mapping of the space.
+       *
+       * \returns
+       * A (const) reference to the precomputed dof table of this space.
+       */
+      DofTable& get_dof_table()
+      {
+        return *_dof_table;
+      }
+
+      /** \copydoc get_dof_table() */
+      const DofTable& get_dof_table() const
+      {
+        return *_dof_table;
+      }
+
       /**
        * \brief Comparison operator
        *
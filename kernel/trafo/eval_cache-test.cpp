@@ -0,0 +1,184 @@
+// FEAT3: Finite Element Analysis Toolbox, Version 3
+// Copyright (C) 2010 - 2020 by Stefan Turek & the FEAT group
+// FEAT3 is released under the GNU General Public License version 3,
+// see the file 'copyright.txt' in the top level directory for details.
+
+#include <test_system/test_system.hpp>
+#include <kernel/geometry/common_factories.hpp>
+#include <kernel/trafo/standard/mapping.hpp>
+#include <kernel/trafo/eval_cache.hpp>
+#include <kernel/space/lagrange2/element.hpp>
+#include <kernel/assembly/symbolic_assembler.hpp>
+#include <kernel/assembly/burgers_assembler.hpp>
+#include <kernel/util/math.hpp>
+
+using namespace FEAT;
+using namespace FEAT::TestSystem;
+
+/**
+ * \brief Trafo evaluation cache test
+ *
+ * \test Tests the Trafo::EvalCache class template by comparing the cached data with the data of a
+ * trafo evaluator before and after modifying the mesh as well as by comparing the Burgers assembly
+ * with and without the cache.
+ *
+ * \tparam DataType_
+ * The data type for the test. Shall be either double or float.
+ */
+template<typename DataType_>
+class TrafoEvalCacheTest
+  : public TestSystem::TaggedTest<Archs::None, DataType_>
+{
+  typedef Geometry::ConformalMesh<Shape::Quadrilateral> MeshType;
+  typedef Trafo::Standard::Mapping<MeshType> TrafoType;
+
+  static constexpr TrafoTags cache_config = TrafoTags::img_point | TrafoTags::jac_inv | TrafoTags::jac_det;
+
+  typedef Trafo::EvalCache<TrafoType, DataType_, cache_config> CacheType;
+
+public:
+  TrafoEvalCacheTest() :
+    TestSystem::TaggedTest<Archs::None, DataType_>("TrafoEvalCacheTest")
+  {
+  }
+
+  virtual ~TrafoEvalCacheTest()
+  {
+  }
+
+  void check_cache(const CacheType& cache) const
+  {
+    const DataType_ eps = Math::pow(Math::eps<DataType_>(), DataType_(0.8));
+
+    typename CacheType::TrafoEvaluator trafo_eval(cache.get_trafo());
+    typename CacheType::EvalDataType data_eval, data_cache;
+
+    TEST_CHECK(cache.is_valid());
+    TEST_CHECK_EQUAL(cache.get_num_cells(), trafo_eval.get_num_cells());
+
+    for(Index cell(0); cell < trafo_eval.get_num_cells(); ++cell)
+    {
+      trafo_eval.prepare(cell);
+      for(int pt(0); pt < cache.get_num_points(); ++pt)
+      {
+        trafo_eval(data_eval, cache.get_cubature_rule().get_point(pt));
+        cache.load(data_cache, cell, pt);
+
+        TEST_CHECK_EQUAL_WITHIN_EPS(data_cache.jac_det, data_eval.jac_det, eps);
+        for(int i(0); i < 2; ++i)
+        {
+          TEST_CHECK_EQUAL_WITHIN_EPS(data_cache.dom_point[i], data_eval.dom_point[i], eps);
+          TEST_CHECK_EQUAL_WITHIN_EPS(data_cache.img_point[i], data_eval.img_point[i], eps);
+          for(int j(0); j < 2; ++j)
+          {
+            TEST_CHECK_EQUAL_WITHIN_EPS(data_cache.jac_mat[i][j], data_eval.jac_mat[i][j], eps);
+            TEST_CHECK_EQUAL_WITHIN_EPS(data_cache.jac_inv[i][j], data_eval.jac_inv[i][j], eps);
+          }
+        }
+      }
+      trafo_eval.finish();
+    }
+  }
+
+  void test_burgers(TrafoType& trafo) const
+  {
+    typedef Space::Lagrange2::Element<TrafoType> SpaceType;
+    typedef Assembly::BurgersAssembler<DataType_, Index, 2> BurgersType;
+    typedef LAFEM::SparseMatrixBCSR<Mem::Main, DataType_, Index, 2, 2> MatrixType;
+    typedef LAFEM::DenseVectorBlocked<Mem::Main, DataType_, Index, 2> VectorType;
+
+    const DataType_ eps = Math::pow(Math::eps<DataType_>(), DataType_(0.7));
+
+    SpaceType space(trafo);
+    Cubature::DynamicFactory cubature("auto-degree:5");
+
+    typename BurgersType::template TrafoEvalCache<SpaceType> cache(trafo, cubature);
+    cache.compile();
+
+    BurgersType burgers;
+    burgers.nu = DataType_(0.1);
+    burgers.beta = DataType_(1);
+    burgers.frechet_beta = DataType_(1);
+    burgers.theta = DataType_(0.5);
+
+    VectorType vec_conv(space.get_num_dofs());
+    for(Index i(0); i < vec_conv.size(); ++i)
+    {
+      Tiny::Vector<DataType_, 2> v;
+      v[0] = DataType_(1) + DataType_(i % 3);
+      v[1] = DataType_(0.5) - DataType_(i % 5);
+      vec_conv(i, v);
+    }
+
+    MatrixType matrix_1, matrix_2;
+    Assembly::SymbolicAssembler::assemble_matrix_std1(matrix_1, space);
+    matrix_2 = matrix_1.clone(LAFEM::CloneMode::Layout);
+    matrix_1.format();
+    matrix_2.format();
+    burgers.assemble_matrix(matrix_1, vec_conv, space, cubature);
+    burgers.assemble_matrix(matrix_2, vec_conv, space, cache);
+
+    VectorType vec_1(matrix_1.create_vector_l()), vec_2(matrix_1.create_vector_l());
+    vec_1.format();
+    vec_2.format();
+    burgers.assemble_vector(vec_1, vec_conv, vec_conv, space, cubature);
+    burgers.assemble_vector(vec_2, vec_conv, vec_conv, space, cache);
+
+    const auto* val_1 = matrix_1.template val<LAFEM::Perspective::pod>();
+    const auto* val_2 = matrix_2.template val<LAFEM::Perspective::pod>();
+    for(Index i(0); i < matrix_1.template used_elements<LAFEM::Perspective::pod>(); ++i)
+      TEST_CHECK_EQUAL_WITHIN_EPS(val_2[i], val_1[i], eps);
+
+    vec_2.axpy(vec_1, vec_2, -DataType_(1));
+    TEST_CHECK_EQUAL_WITHIN_EPS(vec_2.norm2(), DataType_(0), eps * vec_1.norm2());
+
+    // an assembly on a modified mesh must reject the out-of-date cache
+    auto& vtx = trafo.get_mesh().get_vertex_set();
+    vtx[0][1] += DataType_(0.001);
+    TEST_CHECK_THROWS(burgers.assemble_matrix(matrix_2, vec_conv, space, cache), InternalError);
+    TEST_CHECK(cache.update());
+    matrix_2.format();
+    burgers.assemble_matrix(matrix_2, vec_conv, space, cache);
+  }
+
+  virtual void run() const override
+  {
+    // create a distorted quad mesh
+    Geometry::RefineFactory<MeshType, Geometry::UnitCubeFactory> mesh_factory(3);
+    MeshType mesh(mesh_factory);
+    auto& vtx = mesh.get_vertex_set();
+    for(Index i(0); i < vtx.get_num_vertices(); ++i)
+    {
+      auto& v = vtx[i];
+      v[0] += DataType_(0.01) * Math::sin(DataType_(7) * DataType_(v[1]));
+      v[1] += DataType_(0.02) * Math::sin(DataType_(5) * DataType_(v[0]));
+    }
+
+    TrafoType trafo(mesh);
+
+    CacheType cache(trafo, Cubature::DynamicFactory("gauss-legendre:3"));
+    TEST_CHECK(!cache.is_compiled());
+    TEST_CHECK(!cache.is_valid());
+    TEST_CHECK(cache.update());
+    TEST_CHECK(!cache.update());
+    TEST_CHECK_EQUAL(cache.get_num_points(), 9);
+    check_cache(cache);
+
+    // move a vertex; the cache must be recompiled
+    vtx[vtx.get_num_vertices() / 2][0] += 0.001;
+    TEST_CHECK(!cache.is_valid());
+    TEST_CHECK(cache.update());
+    check_cache(cache);
+
+    // invalidate the cache
+    cache.invalidate();
+    TEST_CHECK(!cache.is_compiled());
+    TEST_CHECK_EQUAL(cache.bytes(), std::size_t(0));
+
+    // compare Burgers assembly with and without cache
+    test_burgers(trafo);
+  }
+};
+
+TrafoEvalCacheTest<double> trafo_eval_cache_test_double;
+TrafoEvalCacheTest<float> trafo_eval_cache_test_float;
@@ -0,0 +1,363 @@
+// FEAT3: Finite Element Analysis Toolbox, Version 3
+// Copyright (C) 2010 - 2020 by Stefan Turek & the FEAT group
+// FEAT3 is released under the GNU General Public License version 3,
+// see the file 'copyright.txt' in the top level directory for details.
+
+#pragma once
+#ifndef KERNEL_TRAFO_EVAL_CACHE_HPP
+#define KERNEL_TRAFO_EVAL_CACHE_HPP 1
+
+// includes, FEAT
+#include <kernel/trafo/eval_data.hpp>
+#include <kernel/cubature/dynamic_factory.hpp>
+
+// includes, system
+#include <vector>
+
+namespace FEAT
+{
+  namespace Trafo
+  {
+    /**
+     * \brief Trafo evaluation cache class template
+     *
+     * This class evaluates a transformation in all points of a cubature rule on all cells of the
+     * underlying mesh once and stores the resulting trafo data, so that repeated assemblies on an
+     * unchanged mesh (e.g. in time-stepping or Newton loops) do not need to re-evaluate the trafo.
+     *
+     * The data is stored in one array per quantity (image points, jacobian matrices, inverse
+     * jacobian matrices and jacobian determinants), where only the quantities requested by the
+     * trafo configuration are allocated. Each array is ordered by cell and cubature point, so that
+     * an assembly loop traverses each array contiguously.
+     *
+     * The cache keeps a copy of the mesh vertex coordinates that were used for its compilation;
+     * if the mesh is modified afterwards, e.g. by a mesh optimiser, the cache can be brought up to
+     * date by calling the #update() function, which recompiles the cache only if the vertex
+     * coordinates have changed. Assemblies using an out-of-date cache throw an InternalError,
+     * see #validate().
+     *
+     * \note
+     * This class does not support hessian tensors.
+     *
+     * \tparam Trafo_
+     * The transformation that is to be cached.
+     *
+     * \tparam DataType_
+     * The data type that is to be used for the evaluation.
+     *
+     * \tparam trafo_config_
+     * The trafo configuration tags that specify which data is to be cached.
+     */
+    template<typename Trafo_, typename DataType_, TrafoTags trafo_config_>
+    class EvalCache
+    {
+    public:
+      /// the trafo type
+      typedef Trafo_ TrafoType;
+      /// the data type
+      typedef DataType_ DataType;
+      /// the shape type
+      typedef typename TrafoType::ShapeType ShapeType;
+      /// the mesh type
+      typedef typename TrafoType::MeshType MeshType;
+      /// the vertex type of the mesh
+      typedef typename MeshType::VertexSetType::VertexType VertexType;
+      /// the trafo evaluator type
+      typedef typename TrafoType::template Evaluator<ShapeType, DataType>::Type TrafoEvaluator;
+      /// the trafo evaluation traits
+      typedef typename TrafoEvaluator::EvalTraits EvalTraits;
+      /// the trafo evaluation data type
+      typedef typename TrafoEvaluator::template ConfigTraits<trafo_config_>::EvalDataType EvalDataType;
+      /// the cubature rule type
+      typedef Cubature::Rule<ShapeType, DataType, DataType, typename EvalTraits::DomainPointType> CubatureRuleType;
+
+      /// the trafo configuration of the cached data
+      static constexpr TrafoTags config = EvalDataType::config;
+
+      static_assert(!*(config & TrafoTags::hess_ten), "trafo evaluation cache does not support hessians");
+
+      /// domain dimension
+      static constexpr int domain_dim = EvalTraits::domain_dim;
+      /// image dimension
+      static constexpr int image_dim = EvalTraits::image_dim;
+
+    protected:
+      /// the trafo
+      const TrafoType& _trafo;
+      /// the cubature rule
+      CubatureRuleType _cubature_rule;
+      /// the number of cells in the mesh
+      Index _num_cells;
+      /// the mesh vertices used for the last compilation
+      std::vector<VertexType> _vertices;
+      /// image points
+      std::vector<DataType> _img_point;
+      /// jacobian matrices
+      std::vector<DataType> _jac_mat;
+      /// inverse jacobian matrices
+      std::vector<DataType> _jac_inv;
+      /// jacobian determinants
+      std::vector<DataType> _jac_det;
+      /// specifies whether the cache has been compiled
+      bool _compiled;
+
+    public:
+      /**
+       * \brief Constructor
+       *
+       * \param[in] trafo
+       * The trafo that is to be cached.
+       *
+       * \param[in] cubature_factory
+       * The cubature factory for the points in which the trafo is to be evaluated.
+       *
+       * \note
+       * This constructor does not compile the cache; call #compile() or #update() for this.
+       */
+      explicit EvalCache(const TrafoType& trafo, const Cubature::DynamicFactory& cubature_factory) :
+        _trafo(trafo),
+        _cubature_rule(Cubature::ctor_factory, cubature_factory),
+        _num_cells(0),
+        _compiled(false)
+      {
+      }
+
+      /// no copies
+      EvalCache(const EvalCache&) = delete;
+      /// no copies
+      EvalCache& operator=(const EvalCache&) = delete;
+
+      /// virtual destructor
+      virtual ~EvalCache()
+      {
+      }
+
+      /// \returns A reference to the cached trafo.
+      const TrafoType& get_trafo() const
+      {
+        return _trafo;
+      }
+
+      /// \returns A reference to the cubature rule.
+      const CubatureRuleType& get_cubature_rule() const
+      {
+        return _cubature_rule;
+      }
+
+      /// \returns The number of cubature points per cell.
+      int get_num_points() const
+      {
+        return _cubature_rule.get_num_points();
+      }
+
+      /// \returns The number of cached cells.
+      Index get_num_cells() const
+      {
+        return _num_cells;
+      }
+
+      /// \returns \c true, if the cache has been compiled, otherwise \c false.
+      bool is_compiled() const
+      {
+        return _compiled;
+      }
+
+      /**
+       * \brief Checks whether the cached data is up to date.
+       *
+       * \returns
+       * \c true, if the cache is compiled and the mesh vertices have not changed since then,
+       * otherwise \c false.
+       */
+      bool is_valid() const
+      {
+        if(!_compiled)
+          return false;
+
+        const auto& vtx = _trafo.get_mesh().get_vertex_set();
+        if(vtx.get_num_vertices() != Index(_vertices.size()))
+          return false;
+        if(_num_cells != _trafo.get_mesh().get_num_entities(ShapeType::dimension))
+          return false;
+
+        for(Index i(0); i < vtx.get_num_vertices(); ++i)
+        {
+          for(int j(0); j < VertexType::n; ++j)
+          {
+            if(vtx[i][j] != _vertices[i][j])
+              return false;
+          }
+        }
+        return true;
+      }
+
+      /**
+       * \brief Ensures that the cached data is up to date.
+       *
+       * This function is called by all assemblies using this cache; its effort is linear in the
+       * number of mesh vertices and thus negligible compared to the assembly itself.
+       *
+       * \throws InternalError
+       * If the cache has not been compiled or if the mesh has changed since the last compilation;
+       * call #update() in this case.
+       */
+      void validate() const
+      {
+        if(!_compiled)
+          throw InternalError(__func__, __FILE__, __LINE__, "trafo evaluation cache has not been compiled");
+        if(!is_valid())
+          throw InternalError(__func__, __FILE__, __LINE__, "trafo evaluation cache is out of date; call update() after modifying the mesh");
+      }
+
+      /// \returns The size of dynamically allocated memory in bytes.
+      std::size_t bytes() const
+      {
+        return sizeof(VertexType) * _vertices.size() + sizeof(DataType) *
+          (_img_point.size() + _jac_mat.size() + _jac_inv.size() + _jac_det.size());
+      }
+
+      /**
+       * \brief Invalidates the cache and releases all cached data.
+       */
+      void invalidate()
+      {
+        _compiled = false;
+        _num_cells = Index(0);
+        _vertices.clear();
+        _img_point.clear();
+        _jac_mat.clear();
+        _jac_inv.clear();
+        _jac_det.clear();
+      }
+
+      /**
+       * \brief Compiles the cache, i.e. evaluates the trafo in all cubature points of all cells.
+       */
+      void compile()
+      {
+        invalidate();
+
+        const auto& vtx = _trafo.get_mesh().get_vertex_set();
+        _vertices.resize(std::size_t(vtx.get_num_vertices()));
+        for(Index i(0); i < vtx.get_num_vertices(); ++i)
+        {
+          for(int j(0); j < VertexType::n; ++j)
+            _vertices[i][j] = vtx[i][j];
+        }
+
+        TrafoEvaluator trafo_eval(_trafo);
+        EvalDataType trafo_data;
+
+        _num_cells = trafo_eval.get_num_cells();
+        const std::size_t num_points = std::size_t(_num_cells) * std::size_t(get_num_points());
+
+        if(*(config & TrafoTags::img_point))
+          _img_point.resize(num_points * std::size_t(image_dim));
+        if(*(config & TrafoTags::jac_mat))
+          _jac_mat.resize(num_points * std::size_t(image_dim * domain_dim));
+        if(*(config & TrafoTags::jac_inv))
+          _jac_inv.resize(num_points * std::size_t(domain_dim * image_dim));
+        if(*(config & TrafoTags::jac_det))
+          _jac_det.resize(num_points);
+
+        std::size_t k(0);
+        for(auto cell = trafo_eval.begin(); cell != trafo_eval.end(); ++cell)
+        {
+          trafo_eval.prepare(cell);
+          for(int pt(0); pt < get_num_points(); ++pt, ++k)
+          {
+            trafo_eval(trafo_data, _cubature_rule.get_point(pt));
+
+            if(*(config & TrafoTags::img_point))
+            {
+              for(int i(0); i < image_dim; ++i)
+                _img_point[k*std::size_t(image_dim) + std::size_t(i)] = trafo_data.img_point[i];
+            }
+            if(*(config & TrafoTags::jac_mat))
+            {
+              for(int i(0); i < image_dim; ++i)
+                for(int j(0); j < domain_dim; ++j)
+                  _jac_mat[k*std::size_t(image_dim*domain_dim) + std::size_t(i*domain_dim+j)] = trafo_data.jac_mat[i][j];
+            }
+            if(*(config & TrafoTags::jac_inv))
+            {
+              for(int i(0); i < domain_dim; ++i)
+                for(int j(0); j < image_dim; ++j)
+                  _jac_inv[k*std::size_t(domain_dim*image_dim) + std::size_t(i*image_dim+j)] = trafo_data.jac_inv[i][j];
+            }
+            if(*(config & TrafoTags::jac_det))
+              _jac_det[k] = trafo_data.jac_det;
+          }
+          trafo_eval.finish();
+        }
+
+        _compiled = true;
+      }
+
+      /**
+       * \brief Updates the cache if necessary.
+       *
+       * This function recompiles the cache if it has not been compiled yet or if the mesh
+       * vertices have been changed since the last compilation.
+       *
+       * \returns
+       * \c true, if the cache was recompiled, otherwise \c false.
+       */
+      bool update()
+      {
+        if(is_valid())
+          return false;
+        compile();
+        return true;
+      }
+
+      /**
+       * \brief Loads cached trafo data.
+       *
+       * \param[out] trafo_data
+       * The trafo data object that receives the cached data. Its trafo configuration must be a
+       * subset of the configuration of this cache.
+       *
+       * \param[in] cell
+       * The index of the cell.
+       *
+       * \param[in] point
+       * The index of the cubature point.
+       */
+      template<TrafoTags cfg_>
+      void load(Trafo::EvalData<EvalTraits, cfg_>& trafo_data, const Index cell, const int point) const
+      {
+        static_assert((cfg_ | config) == config, "trafo configuration is not a subset of the cache configuration");
+        ASSERTM(_compiled, "trafo evaluation cache has not been compiled");
+        ASSERTM(cell < _num_cells, "invalid cell index");
+        ASSERTM((point >= 0) && (point < get_num_points()), "invalid point index");
+
+        const std::size_t k = std::size_t(cell) * std::size_t(get_num_points()) + std::size_t(point);
+
+        if(*(cfg_ & TrafoTags::dom_point))
+          trafo_data.dom_point = _cubature_rule.get_point(point);
+        if(*(cfg_ & TrafoTags::img_point))
+        {
+          for(int i(0); i < image_dim; ++i)
+            trafo_data.img_point[i] = _img_point[k*std::size_t(image_dim) + std::size_t(i)];
+        }
+        if(*(cfg_ & TrafoTags::jac_mat))
+        {
+          for(int i(0); i < image_dim; ++i)
+            for(int j(0); j < domain_dim; ++j)
+              trafo_data.jac_mat[i][j] = _jac_mat[k*std::size_t(image_dim*domain_dim) + std::size_t(i*domain_dim+j)];
+        }
+        if(*(cfg_ & TrafoTags::jac_inv))
+        {
+          for(int i(0); i < domain_dim; ++i)
+            for(int j(0); j < image_dim; ++j)
+              trafo_data.jac_inv[i][j] = _jac_inv[k*std::size_t(domain_dim*image_dim) + std::size_t(i*image_dim+j)];
+        }
+        if(*(cfg_ & TrafoTags::jac_det))
+          trafo_data.jac_det = _jac_det[k];
+      }
+    }; // class EvalCache<...>
+  } // namespace Trafo
+} // namespace FEAT
+
+#endif // KERNEL_TRAFO_EVAL_CACHE_HPP
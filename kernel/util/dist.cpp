@@ -518,6 +518,21 @@ namespace FEAT
       return Comm(newcomm);
     }
 
+    Comm Comm::comm_split_shared(int key) const
+    {
+      MPI_Comm newcomm = MPI_COMM_NULL;
+      MPI_Comm_split_type(comm, MPI_COMM_TYPE_SHARED, key, MPI_INFO_NULL, &newcomm);
+      return Comm(newcomm);
+    }
+
+    Comm Comm::dist_graph_create_adjacent(int indegree, const int* sources, int outdegree, const int* destinations) const
+    {
+      MPI_Comm newcomm = MPI_COMM_NULL;
+      MPI_Dist_graph_create_adjacent(comm, indegree, sources, MPI_UNWEIGHTED, outdegree, destinations,
+        MPI_UNWEIGHTED, MPI_INFO_NULL, 0, &newcomm);
+      return Comm(newcomm);
+    }
+
     void Comm::barrier() const
     {
       MPI_Barrier(comm);
@@ -604,6 +619,22 @@ namespace FEAT
       MPI_Alltoallv(sendbuf, sendcounts, sdispls, sendtype.dt, recvbuf, recvcounts, rdispls, recvtype.dt, comm);
     }
 
+    void Comm::neighbor_alltoallv(const void* sendbuf, const int* sendcounts, const int* sdispls, const Datatype& sendtype, void* recvbuf, const int* recvcounts, const int* rdispls, const Datatype& recvtype) const
+    {
+      MPI_Neighbor_alltoallv(sendbuf, sendcounts, sdispls, sendtype.dt, recvbuf, recvcounts, rdispls, recvtype.dt, comm);
+    }
+
+    Request Comm::ineighbor_alltoallv(const void* sendbuf, const int* sendcounts, const int* sdispls, const Datatype& sendtype, void* recvbuf, const int* recvcounts, const int* rdispls, const Datatype& recvtype) const
+    {
+      MPI_Request req(MPI_REQUEST_NULL);
+#ifdef MSMPI_VER
+      MPI_Neighbor_alltoallv(sendbuf, sendcounts, sdispls, sendtype.dt, recvbuf, recvcounts, rdispls, recvtype.dt, comm);
+#else
+      MPI_Ineighbor_alltoallv(sendbuf, sendcounts, sdispls, sendtype.dt, recvbuf, recvcounts, rdispls, recvtype.dt, comm, &req);
+#endif
+      return Request(req);
+    }
+
     void Comm::reduce(const void* sendbuf, void* recvbuf, std::size_t count, const Datatype& datatype, const Operation& op, int root) const
     {
       // MPI_IN_PLACE is only allowed on root process
@@ -810,6 +841,84 @@ namespace FEAT
       }
     }
 
+    /* ***************************************************************************************** */
+    /* ***************************************************************************************** */
+    /* MPI SharedWindow wrapper implementation                                                   */
+    /* ***************************************************************************************** */
+    /* ***************************************************************************************** */
+
+    SharedWindow::SharedWindow() :
+      win(MPI_WIN_NULL),
+      _local(nullptr),
+      _bytes(0u)
+    {
+    }
+
+    SharedWindow::SharedWindow(const Comm& comm, std::size_t bytes) :
+      win(MPI_WIN_NULL),
+      _local(nullptr),
+      _bytes(bytes)
+    {
+      MPI_Win_allocate_shared(MPI_Aint(bytes), 1, MPI_INFO_NULL, comm.mpi_comm(), &_local, &win);
+
+      // open a passive target epoch for the whole lifetime of the window
+      MPI_Win_lock_all(MPI_MODE_NOCHECK, win);
+    }
+
+    SharedWindow::SharedWindow(SharedWindow&& other) :
+      win(other.win),
+      _local(other._local),
+      _bytes(other._bytes)
+    {
+      other.win = MPI_WIN_NULL;
+      other._local = nullptr;
+      other._bytes = 0u;
+    }
+
+    SharedWindow& SharedWindow::operator=(SharedWindow&& other)
+    {
+      if(this != &other)
+      {
+        XASSERT(win == MPI_WIN_NULL);
+        win = other.win;
+        _local = other._local;
+        _bytes = other._bytes;
+        other.win = MPI_WIN_NULL;
+        other._local = nullptr;
+        other._bytes = 0u;
+      }
+      return *this;
+    }
+
+    SharedWindow::~SharedWindow()
+    {
+      if(win != MPI_WIN_NULL)
+      {
+        MPI_Win_unlock_all(win);
+        MPI_Win_free(&win);
+      }
+    }
+
+    bool SharedWindow::is_null() const
+    {
+      return (win == MPI_WIN_NULL);
+    }
+
+    void* SharedWindow::query(int rank, std::size_t& bytes) const
+    {
+      MPI_Aint size(0);
+      int disp_unit(0);
+      void* ptr(nullptr);
+      MPI_Win_shared_query(win, rank, &size, &disp_unit, &ptr);
+      bytes = std::size_t(size);
+      return ptr;
+    }
+
+    void SharedWindow::sync() const
+    {
+      MPI_Win_sync(win);
+    }
+
     /* ######################################################################################### */
     /* ######################################################################################### */
     /* ######################################################################################### */
@@ -1072,6 +1181,19 @@ namespace FEAT
       return Comm(1);
     }
 
+    Comm Comm::comm_split_shared(int) const
+    {
+      return Comm(1);
+    }
+
+    Comm Comm::dist_graph_create_adjacent(int indegree, const int*, int outdegree, const int*) const
+    {
+      // a single process cannot have any neighbours
+      XASSERT(indegree == 0);
+      XASSERT(outdegree == 0);
+      return Comm(1);
+    }
+
     void Comm::barrier() const
     {
       // nothing to do
@@ -1158,6 +1280,16 @@ namespace FEAT
       alltoall(sendbuf, std::size_t(sendcounts[0]), sendtype, recvbuf, std::size_t(recvcounts[0]), recvtype);
     }
 
+    void Comm::neighbor_alltoallv(const void*, const int*, const int*, const Datatype&, void*, const int*, const int*, const Datatype&) const
+    {
+      // nothing to do here, since a single process has no neighbours
+    }
+
+    Request Comm::ineighbor_alltoallv(const void*, const int*, const int*, const Datatype&, void*, const int*, const int*, const Datatype&) const
+    {
+      return Request();
+    }
+
     void Comm::reduce(const void* sendbuf, void* recvbuf, std::size_t count, const Datatype& datatype, const Operation& op, int root) const
     {
       XASSERT(root == 0);
@@ -1246,6 +1378,68 @@ namespace FEAT
     {
       os << msg << std::endl;
     }
+    /* ***************************************************************************************** */
+    /* ***************************************************************************************** */
+    /* Dummy SharedWindow wrapper implementation                                                 */
+    /* ***************************************************************************************** */
+    /* ***************************************************************************************** */
+
+    SharedWindow::SharedWindow() :
+      _buffer(),
+      _local(nullptr),
+      _bytes(0u)
+    {
+    }
+
+    SharedWindow::SharedWindow(const Comm&, std::size_t bytes) :
+      _buffer(Math::max(bytes, std::size_t(1))),
+      _local(_buffer.data()),
+      _bytes(bytes)
+    {
+    }
+
+    SharedWindow::SharedWindow(SharedWindow&& other) :
+      _buffer(std::move(other._buffer)),
+      _local(other._local),
+      _bytes(other._bytes)
+    {
+      other._local = nullptr;
+      other._bytes = 0u;
+    }
+
+    SharedWindow& SharedWindow::operator=(SharedWindow&& other)
+    {
+      if(this != &other)
+      {
+        _buffer = std::move(other._buffer);
+        _local = other._local;
+        _bytes = other._bytes;
+        other._local = nullptr;
+        other._bytes = 0u;
+      }
+      return *this;
+    }
+
+    SharedWindow::~SharedWindow()
+    {
+    }
+
+    bool SharedWindow::is_null() const
+    {
+      return (_local == nullptr);
+    }
+
+    void* SharedWindow::query(int rank, std::size_t& bytes) const
+    {
+      XASSERT(rank == 0);
+      bytes = _bytes;
+      return _local;
+    }
+
+    void SharedWindow::sync() const
+    {
+      // nothing to do
+    }
 #endif // FEAT_HAVE_MPI
   } // namespace Dist
 } // namespace FEAT
@@ -1587,6 +1587,53 @@ namespace FEAT
        */
       Comm comm_split(int color, int key) const;
 
+      /**
+       * \brief Creates a new sub-communicator for all processes of a shared-memory node.
+       *
+       * This functions splits this communicator into disjoint sub-communicators, each of which
+       * contains all processes that can create shared memory windows, i.e. all processes that
+       * run on the same compute node.
+       *
+       * \param[in] key
+       * The key for the ranking of the process.
+       *
+       * \see \cite MPI31, Section 6.4.2, page 247
+       *
+       * \returns
+       * A new communicator for the set of processes on the same shared-memory node.
+       */
+      Comm comm_split_shared(int key = 0) const;
+
+      /**
+       * \brief Creates a new communicator with a distributed graph topology.
+       *
+       * This function creates a new communicator with the same processes as this communicator,
+       * which is equipped with a distributed graph topology, i.e. each process specifies the
+       * ranks of the processes that it receives messages from and sends messages to. This
+       * topology can then be used by the neighbourhood collectives, e.g. #ineighbor_alltoallv.
+       *
+       * \note
+       * The ranks are not reordered, i.e. each process has the same rank in the new communicator.
+       *
+       * \param[in] indegree
+       * The number of processes that this process receives messages from.
+       *
+       * \param[in] sources
+       * The ranks of the processes that this process receives messages from.
+       *
+       * \param[in] outdegree
+       * The number of processes that this process sends messages to.
+       *
+       * \param[in] destinations
+       * The ranks of the processes that this process sends messages to.
+       *
+       * \see \cite MPI31, Section 7.5.4, page 298
+       *
+       * \returns
+       * A new communicator with the distributed graph topology.
+       */
+      Comm dist_graph_create_adjacent(int indegree, const int* sources, int outdegree, const int* destinations) const;
+
       ///@}
 
       /**
@@ -2562,6 +2609,121 @@ namespace FEAT
       // end of gather/scatter group
       ///@}
 
+      /**
+       * \name Neighbourhood Collectives
+       */
+      ///@{
+
+      /**
+       * \brief Blocking Neighbourhood All-to-All Scatter/Gather
+       *
+       * This function can only be used with a communicator that has been created by
+       * #dist_graph_create_adjacent. The send and receive buffers are ordered by the
+       * destinations and sources, respectively, that were passed to the creation function.
+       *
+       * \attention
+       * In contrast to most other functions, this function uses \c int rather than <c>std::size_t</c>
+       * as the type for the send/receive counts and displacements for technical reasons!
+       *
+       * \param[in] sendbuf
+       * The send buffer for the operation.
+       *
+       * \param[in] sendcounts
+       * The number of datatype objects send to \e each destination.
+       *
+       * \param[in] sdispls
+       * The displacements of the send buffers in datatype objects.
+       *
+       * \param[in] sendtype
+       * A reference to the Datatype object representing the send buffer contents.
+       *
+       * \param[out] recvbuf
+       * The receive buffer for the operation.
+       *
+       * \param[in] recvcounts
+       * The number of datatype objects received from \e each source.
+       *
+       * \param[in] rdispls
+       * The displacements of the receive buffers in datatype objects.
+       *
+       * \param[in] recvtype
+       * A reference to the Datatype object representing the receive buffer contents.
+       *
+       * \see \cite MPI31 Section 7.6.1, page 317
+       */
+      void neighbor_alltoallv(const void* sendbuf, const int* sendcounts, const int* sdispls, const Datatype& sendtype, void* recvbuf, const int* recvcounts, const int* rdispls, const Datatype& recvtype) const;
+
+      /**
+       * \brief Blocking Neighbourhood All-to-All Scatter/Gather
+       *
+       * This function automatically deducts the datatype of the send/receive buffer(s) (if possible).
+       *
+       * \see #neighbor_alltoallv(const void*, const int*, const int*, const Datatype&, void*, const int*, const int*, const Datatype&) const
+       */
+      template<typename ST_, typename RT_>
+      void neighbor_alltoallv(const ST_* sendbuf, const int* sendcounts, const int* sdispls, RT_* recvbuf, const int* recvcounts, const int* rdispls) const
+      {
+        neighbor_alltoallv(sendbuf, sendcounts, sdispls, autotype<ST_>(), recvbuf, recvcounts, rdispls, autotype<RT_>());
+      }
+
+      /**
+       * \brief Nonblocking Neighbourhood All-to-All Scatter/Gather
+       *
+       * This function can only be used with a communicator that has been created by
+       * #dist_graph_create_adjacent. The send and receive buffers are ordered by the
+       * destinations and sources, respectively, that were passed to the creation function.
+       *
+       * \attention
+       * In contrast to most other functions, this function uses \c int rather than <c>std::size_t</c>
+       * as the type for the send/receive counts and displacements for technical reasons!
+       *
+       * \param[in] sendbuf
+       * The send buffer for the operation.
+       *
+       * \param[in] sendcounts
+       * The number of datatype objects send to \e each destination.
+       *
+       * \param[in] sdispls
+       * The displacements of the send buffers in datatype objects.
+       *
+       * \param[in] sendtype
+       * A reference to the Datatype object representing the send buffer contents.
+       *
+       * \param[out] recvbuf
+       * The receive buffer for the operation.
+       *
+       * \param[in] recvcounts
+       * The number of datatype objects received from \e each source.
+       *
+       * \param[in] rdispls
+       * The displacements of the receive buffers in datatype objects.
+       *
+       * \param[in] recvtype
+       * A reference to the Datatype object representing the receive buffer contents.
+       *
+       * \returns
+       * A Request object for the operation.
+       *
+       * \see \cite MPI31 Section 7.7.1, page 328
+       */
+      Request ineighbor_alltoallv(const void* sendbuf, const int* sendcounts, const int* sdispls, const Datatype& sendtype, void* recvbuf, const int* recvcounts, const int* rdispls, const Datatype& recvtype) const;
+
+      /**
+       * \brief Nonblocking Neighbourhood All-to-All Scatter/Gather
+       *
+       * This function automatically deducts the datatype of the send/receive buffer(s) (if possible).
+       *
+       * \see #ineighbor_alltoallv(const void*, const int*, const int*, const Datatype&, void*, const int*, const int*, const Datatype&) const
+       */
+      template<typename ST_, typename RT_>
+      Request ineighbor_alltoallv(const ST_* sendbuf, const int* sendcounts, const int* sdispls, RT_* recvbuf, const int* recvcounts, const int* rdispls) const
+      {
+        return ineighbor_alltoallv(sendbuf, sendcounts, sdispls, autotype<ST_>(), recvbuf, recvcounts, rdispls, autotype<RT_>());
+      }
+
+      // end of neighbourhood collectives group
+      ///@}
+
       /**
        * \name Reductions and Scans
        */
@@ -3031,6 +3193,108 @@ namespace FEAT
       // end of extended comm group
       ///@}
     }; // class Comm
+
+    /**
+     * \brief Shared memory window class
+     *
+     * This class effectively wraps around an \c MPI_Win handle, which was created by
+     * \c MPI_Win_allocate_shared on a shared-memory communicator, i.e. a communicator which
+     * was created by Comm::comm_split_shared(). Each process allocates its own segment of the
+     * window, which can be accessed directly by all other processes of the communicator via
+     * the pointer returned by the query() function.
+     *
+     * The window is opened in a passive target epoch for all processes upon creation and this
+     * epoch is closed upon destruction, so the only synchronisation offered by this class is
+     * the sync() function, which synchronises the private and the public copy of the window.
+     * The actual synchronisation of the processes accessing the window has to be performed
+     * by other means, e.g. by point-to-point messages:
+     * - the writing process writes into its segment, calls sync() and sends a message
+     * - the reading process receives the message, calls sync() and reads the segment
+     *
+     * For non-MPI builds, this class offers a serial implementation, which allocates the
+     * segment of the single process in main memory.
+     *
+     * This class is move-constructible and move-assigneable, but objects of this class are non-copyable.
+     *
+     * \see \cite MPI31, Section 11.2.3, page 407
+     */
+    class SharedWindow
+    {
+    protected:
+#if defined(FEAT_HAVE_MPI) || defined(DOXYGEN)
+      /// our internal MPI window handle
+      MPI_Win win;
+#else
+      /// the segment of our process
+      std::vector<char> _buffer;
+#endif // FEAT_HAVE_MPI
+      /// pointer to the segment of this process
+      void* _local;
+      /// the size of the segment of this process in bytes
+      std::size_t _bytes;
+
+    public:
+      /// Creates a null window
+      SharedWindow();
+
+      /**
+       * \brief Creates a shared memory window
+       *
+       * This function is a collective operation on the shared-memory communicator.
+       *
+       * \param[in] comm
+       * The shared-memory communicator on which the window is to be created.
+       *
+       * \param[in] bytes
+       * The size of the segment of this process in bytes. May be different for each process.
+       */
+      explicit SharedWindow(const Comm& comm, std::size_t bytes);
+
+      /// no copies
+      SharedWindow(const SharedWindow&) = delete;
+      /// no copies
+      SharedWindow& operator=(const SharedWindow&) = delete;
+
+      /// move constructor
+      SharedWindow(SharedWindow&& other);
+      /// move-assignment operator
+      SharedWindow& operator=(SharedWindow&& other);
+
+      /// destructor; frees the window
+      virtual ~SharedWindow();
+
+      /// \returns \c true, if this window is null, otherwise \c false.
+      bool is_null() const;
+
+      /// \returns A pointer to the segment of this process.
+      void* local() const
+      {
+        return _local;
+      }
+
+      /// \returns The size of the segment of this process in bytes.
+      std::size_t bytes() const
+      {
+        return _bytes;
+      }
+
+      /**
+       * \brief Returns a pointer to the segment of another process
+       *
+       * \param[in] rank
+       * The rank of the process within the shared-memory communicator.
+       *
+       * \param[out] bytes
+       * Receives the size of the segment of the process in bytes.
+       *
+       * \returns
+       * A pointer to the segment of the process in the address space of this process.
+       */
+      void* query(int rank, std::size_t& bytes) const;
+
+      /// Synchronises the private and public copy of the window.
+      void sync() const;
+    }; // class SharedWindow
   } // namespace Dist
 } // namespace FEAT
 
@@ -104,6 +104,21 @@ namespace FEAT
     ofs.close();
   }
 
+  bool DistFileIO::exists_sequence(const String& pattern, const Dist::Comm& comm)
+  {
+    // try to open the file of our rank
+    int have(0);
+    {
+      std::ifstream ifs(_rankname(pattern, comm.rank()), std::ios_base::in|std::ios_base::binary);
+      have = (ifs.is_open() && ifs.good() ? 1 : 0);
+    }
+
+    // all ranks must have their files
+    int have_all(0);
+    comm.allreduce(&have, &have_all, std::size_t(1), Dist::op_min);
+    return (have_all > 0);
+  }
+
 #ifdef FEAT_HAVE_MPI
 
   void DistFileIO::read_common(std::stringstream& stream, const String& filename, const Dist::Comm& comm)
@@ -266,6 +281,95 @@ namespace FEAT
     MPI_File_close(&file);
   }
 
+  DistFileIO::OrderedWriteRequest::OrderedWriteRequest() :
+    file(MPI_FILE_NULL),
+    request()
+  {
+  }
+
+  DistFileIO::OrderedWriteRequest::OrderedWriteRequest(OrderedWriteRequest&& other) :
+    file(other.file),
+    request(std::move(other.request))
+  {
+    other.file = MPI_FILE_NULL;
+  }
+
+  DistFileIO::OrderedWriteRequest& DistFileIO::OrderedWriteRequest::operator=(OrderedWriteRequest&& other)
+  {
+    if(this != &other)
+    {
+      XASSERT(is_null());
+      file = other.file;
+      request = std::move(other.request);
+      other.file = MPI_FILE_NULL;
+    }
+    return *this;
+  }
+
+  bool DistFileIO::OrderedWriteRequest::is_null() const
+  {
+    return file == MPI_FILE_NULL;
+  }
+
+  void DistFileIO::OrderedWriteRequest::wait()
+  {
+    if(file == MPI_FILE_NULL)
+      return;
+
+    // wait for the write and close the file
+    request.wait();
+    MPI_File_close(&file);
+  }
+
+  DistFileIO::OrderedWriteRequest DistFileIO::iwrite_ordered(const void* buffer, const std::size_t size, const String& filename, const Dist::Comm& comm, bool truncate)
+  {
+    XASSERT((buffer != nullptr) || (size == std::size_t(0)));
+
+    // select file access mode
+    int amode = MPI_MODE_WRONLY | MPI_MODE_CREATE;
+
+    // open file
+    OrderedWriteRequest req;
+    MPI_File_open(comm.mpi_comm(), filename.c_str(), amode, MPI_INFO_NULL, &req.file);
+    XASSERTM(req.file != MPI_FILE_NULL, "failed to open file via MPI_File_open");
+
+    // truncate file?
+    if(truncate)
+    {
+      MPI_File_set_size(req.file, MPI_Offset(0));
+    }
+
+    // compute our offset in rank order
+    unsigned long long my_size(size), offset(0ull);
+    comm.exscan(&my_size, &offset, std::size_t(1), Dist::op_sum);
+    if(comm.rank() == 0)
+      offset = 0ull;
+
+    // MPI counts are ints, so buffers of 2 GiB or more are described by a derived datatype
+    // consisting of blocks of 1 GiB followed by the remaining bytes
+    const std::size_t block_size = std::size_t(1) << 30;
+    if(size < 2u * block_size)
+    {
+      // start writing our buffer
+      MPI_File_iwrite_at(req.file, MPI_Offset(offset), buffer, int(size), MPI_BYTE, req.request.mpi_request());
+      return req;
+    }
+
+    MPI_Datatype block_type(MPI_DATATYPE_NULL), buffer_type(MPI_DATATYPE_NULL);
+    MPI_Type_contiguous(int(block_size), MPI_BYTE, &block_type);
+    int lengths[2] = {int(size / block_size), int(size % block_size)};
+    MPI_Aint displs[2] = {MPI_Aint(0), MPI_Aint(size - size % block_size)};
+    MPI_Datatype types[2] = {block_type, MPI_BYTE};
+    MPI_Type_create_struct(2, lengths, displs, types, &buffer_type);
+    MPI_Type_commit(&buffer_type);
+
+    // start writing our buffer; the types may be freed, as the pending write keeps its own reference
+    MPI_File_iwrite_at(req.file, MPI_Offset(offset), buffer, 1, buffer_type, req.request.mpi_request());
+    MPI_Type_free(&buffer_type);
+    MPI_Type_free(&block_type);
+    return req;
+  }
+
 #else // non-MPI implementation
 
   void DistFileIO::read_common(std::stringstream& stream, const String& filename, const Dist::Comm&)
@@ -344,6 +448,40 @@ namespace FEAT
     ofs.close();
   }
 
+  DistFileIO::OrderedWriteRequest::OrderedWriteRequest() :
+    request()
+  {
+  }
+
+  DistFileIO::OrderedWriteRequest::OrderedWriteRequest(OrderedWriteRequest&& other) :
+    request(std::move(other.request))
+  {
+  }
+
+  DistFileIO::OrderedWriteRequest& DistFileIO::OrderedWriteRequest::operator=(OrderedWriteRequest&& other)
+  {
+    if(this != &other)
+      request = std::move(other.request);
+    return *this;
+  }
+
+  bool DistFileIO::OrderedWriteRequest::is_null() const
+  {
+    return true;
+  }
+
+  void DistFileIO::OrderedWriteRequest::wait()
+  {
+    // nothing to do
+  }
+
+  DistFileIO::OrderedWriteRequest DistFileIO::iwrite_ordered(const void* buffer, const std::size_t size, const String& filename, const Dist::Comm& comm, bool truncate)
+  {
+    // write the file directly
+    write_ordered(buffer, size, filename, comm, truncate);
+    return OrderedWriteRequest();
+  }
+
 #endif // FEAT_HAVE_MPI
 
 } // namespace FEAT
@@ -37,6 +37,9 @@ namespace FEAT
    * - #write_ordered: all processes write into a single common binary file, ordered by ranks,
    *   and using the official MPI I/O routines
    *
+   * The #iwrite_ordered function is a non-blocking variant of #write_ordered, which returns an
+   * OrderedWriteRequest that has to be completed by calling its \c wait function.
+   *
    * Each function comes in two overloads: one for objects of type std::stringstream for text files
    * and another one for objects of type BinaryStream for binary files.
    *
@@ -57,6 +60,65 @@ namespace FEAT
   class DistFileIO
   {
   public:
+    /**
+     * \brief Request of a non-blocking ordered write
+     *
+     * An object of this class represents a common binary file, which is being written by
+     * DistFileIO::iwrite_ordered. The write is completed and the file is closed by #wait,
+     * which is a collective operation on the communicator the write has been started on.
+     *
+     * In non-MPI builds, the file is written directly by iwrite_ordered, so that the
+     * returned request is always null.
+     */
+    class OrderedWriteRequest
+    {
+    public:
+#if defined(FEAT_HAVE_MPI) || defined(DOXYGEN)
+      /// the MPI file handle
+      MPI_File file;
+#endif // FEAT_HAVE_MPI
+      /// the request of the non-blocking write
+      Dist::Request request;
+
+      /// creates a null request
+      OrderedWriteRequest();
+
+      /// OrderedWriteRequest objects are non-copyable
+      OrderedWriteRequest(const OrderedWriteRequest&) = delete;
+      /// OrderedWriteRequest objects are non-copyable
+      OrderedWriteRequest& operator=(const OrderedWriteRequest&) = delete;
+
+      /// move constructor
+      OrderedWriteRequest(OrderedWriteRequest&& other);
+
+      /**
+       * \brief Move-assignment operator
+       *
+       * \attention
+       * The destination request represented by \p this must be a null request,
+       * as this operator will fire an assertion failure otherwise!
+       */
+      OrderedWriteRequest& operator=(OrderedWriteRequest&& other);
+
+      /// destructor
+      ~OrderedWriteRequest()
+      {
+        XASSERTM(is_null(), "You are trying to destroy an active ordered write request!");
+      }
+
+      /// \returns \c true, if the file has been closed, otherwise \c false.
+      bool is_null() const;
+
+      /**
+       * \brief Completes the write and closes the file.
+       *
+       * \attention
+       * This function is a collective operation, i.e. it has to be called by all processes,
+       * which have started the write, even if the request is already completed locally.
+       */
+      void wait();
+    }; // class OrderedWriteRequest
+
     /**
      * \brief Reads a common text file for all ranks.
      *
@@ -206,6 +268,30 @@ namespace FEAT
       write_sequence(stream, pattern, comm, truncate);
     }
 
+    /**
+     * \brief Checks whether a rank-indexed file sequence exists.
+     *
+     * This function checks whether each rank can open its indexed file for reading and
+     * returns the same result on all processes, so that it can be used to decide whether
+     * a subsequent call of #read_sequence is safe.
+     *
+     * \param[in] pattern
+     * The pattern that is to be used for filename generation.
+     *
+     * \param[in] comm
+     * The communicator to be used for synchronisation.
+     *
+     * \returns
+     * \c true, if the files of all ranks exist, otherwise \c false.
+     */
+    static bool exists_sequence(const String& pattern, const Dist::Comm& comm);
+
+    static bool exists_sequence(const String& pattern)
+    {
+      Dist::Comm comm(Dist::Comm::world());
+      return exists_sequence(pattern, comm);
+    }
+
     /**
      * \brief Reads a buffer from a common binary file in rank order.
      *
@@ -293,6 +379,35 @@ namespace FEAT
       write_ordered(stream.data(), std::size_t(stream.size()), filename, comm, truncate);
     }
 
+    /**
+     * \brief Starts writing a buffer into a common binary file in rank order.
+     *
+     * This function opens the common output file, computes the offset of this process's
+     * buffer by an exclusive scan and starts a non-blocking write of the buffer. The
+     * buffer must not be modified or freed until the returned request has been completed.
+     *
+     * \note This function is effectively a wrapper around \b MPI_File_iwrite_at.
+     *
+     * \param[in] buffer
+     * A pointer to the binary buffer that is to be written. Must not be \c nullptr.
+     *
+     * \param[in] size
+     * The size of this process's buffer in bytes. May differ on each process.
+     *
+     * \param[in] filename
+     * The name of the common output file. Must be the same on all calling processes.
+     *
+     * \param[in] comm
+     * The communicator to be used for synchronisation. Ignored if compiled without MPI.
+     *
+     * \param[in] truncate
+     * Specifies whether the output file(s) are to be truncated to the output size.
+     *
+     * \returns
+     * The request of the write, which has to be completed by OrderedWriteRequest::wait().
+     */
+    static OrderedWriteRequest iwrite_ordered(const void* buffer, const std::size_t size, const String& filename, const Dist::Comm& comm, bool truncate = true);
+
   protected:
     /// auxiliary function: build a rank filename from a pattern
     static String _rankname(const String& pattern, int rank);
@@ -0,0 +1,49 @@
+// FEAT3: Finite Element Analysis Toolbox, Version 3
+// Copyright (C) 2010 - 2020 by Stefan Turek & the FEAT group
+// FEAT3 is released under the GNU General Public License version 3,
+// see the file 'copyright.txt' in the top level directory for details.
+
+#include <test_system/test_system.hpp>
+#include <kernel/util/hash.hpp>
+
+#include <cstring>
+
+using namespace FEAT;
+using namespace FEAT::TestSystem;
+
+/**
+ * \brief Test class for the HashFNV1a class.
+ *
+ * \test Tests the hash against the reference values of the FNV-1a specification.
+ */
+class HashTest
+  : public TaggedTest<Archs::None, Archs::None>
+{
+public:
+  HashTest() :
+    TaggedTest<Archs::None, Archs::None>("HashTest")
+  {
+  }
+
+  static std::uint64_t hash(const char* s)
+  {
+    HashFNV1a h;
+    h.feed(s, std::strlen(s));
+    return h.value();
+  }
+
+  virtual void run() const override
+  {
+    // reference values
+    TEST_CHECK_EQUAL(hash(""), std::uint64_t(0xcbf29ce484222325ull));
+    TEST_CHECK_EQUAL(hash("a"), std::uint64_t(0xaf63dc4c8601ec8cull));
+    TEST_CHECK_EQUAL(hash("foobar"), std::uint64_t(0x85944171f73967e8ull));
+
+    // feeding in several chunks gives the same hash
+    HashFNV1a h;
+    h.feed("foo", std::size_t(3));
+    h.feed(nullptr, std::size_t(0));
+    h.feed("bar", std::size_t(3));
+    TEST_CHECK_EQUAL(h.value(), hash("foobar"));
+  }
+} hash_test;
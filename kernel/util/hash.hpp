@@ -0,0 +1,70 @@
+// FEAT3: Finite Element Analysis Toolbox, Version 3
+// Copyright (C) 2010 - 2020 by Stefan Turek & the FEAT group
+// FEAT3 is released under the GNU General Public License version 3,
+// see the file 'copyright.txt' in the top level directory for details.
+
+#pragma once
+#ifndef KERNEL_UTIL_HASH_HPP
+#define KERNEL_UTIL_HASH_HPP 1
+
+#include <kernel/base_header.hpp>
+
+#include <cstddef>
+#include <cstdint>
+
+namespace FEAT
+{
+  /**
+   * \brief 64 bit FNV-1a hash
+   *
+   * This class computes the 64 bit Fowler-Noll-Vo hash (variant 1a) of a sequence of bytes, which
+   * may be fed in several chunks. The hash is not suitable for cryptographic purposes; it is used
+   * to identify matrix structures, mesh hierarchies and other data in cache files.
+   * See https://en.wikipedia.org/wiki/Fowler%E2%80%93Noll%E2%80%93Vo_hash_function for details.
+   */
+  class HashFNV1a
+  {
+  public:
+    /// the offset basis, i.e. the hash of an empty byte sequence
+    static constexpr std::uint64_t offset_basis = 14695981039346656037ull;
+    /// the FNV prime
+    static constexpr std::uint64_t prime = 1099511628211ull;
+
+  protected:
+    /// the current hash value
+    std::uint64_t _hash;
+
+  public:
+    HashFNV1a() :
+      _hash(offset_basis)
+    {
+    }
+
+    /**
+     * \brief Feeds a byte sequence into the hash
+     *
+     * \param[in] data
+     * A pointer to the bytes to be hashed. May be \c nullptr, if \p bytes is 0.
+     *
+     * \param[in] bytes
+     * The number of bytes to be hashed.
+     */
+    void feed(const void* data, std::size_t bytes)
+    {
+      const unsigned char* p = reinterpret_cast<const unsigned char*>(data);
+      for(std::size_t i(0); i < bytes; ++i)
+      {
+        _hash ^= std::uint64_t(p[i]);
+        _hash *= prime;
+      }
+    }
+
+    /// \returns The hash of all bytes fed so far.
+    std::uint64_t value() const
+    {
+      return _hash;
+    }
+  }; // class HashFNV1a
+} // namespace FEAT
+
+#endif // KERNEL_UTIL_HASH_HPP
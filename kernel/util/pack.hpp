@@ -253,6 +253,45 @@ namespace FEAT
       return std::size_t(1) << (((int)type & 0xF) - 1);
     }
 
+    /**
+     * \brief Deducts the raw pack type of a data type.
+     *
+     * \tparam T_
+     * The data type whose raw pack type is to be determined.
+     *
+     * \returns
+     * The raw (i.e. uncompressed) pack type matching \p T_ or Pack::Type::None,
+     * if \p T_ has no matching pack type.
+     */
+    template<typename T_>
+    inline Pack::Type deduct_type()
+    {
+      typedef typename FEAT::Type::Traits<T_> TypeTraits;
+      if(TypeTraits::is_float)
+      {
+        switch(sizeof(T_))
+        {
+        case 2u: return Pack::Type::F16;
+        case 4u: return Pack::Type::F32;
+        case 8u: return Pack::Type::F64;
+        case 16u: return Pack::Type::F128;
+        default: return Pack::Type::None;
+        }
+      }
+      if(TypeTraits::is_int)
+      {
+        switch(sizeof(T_))
+        {
+        case 1u: return TypeTraits::is_signed ? Pack::Type::I8  : Pack::Type::U8;
+        case 2u: return TypeTraits::is_signed ? Pack::Type::I16 : Pack::Type::U16;
+        case 4u: return TypeTraits::is_signed ? Pack::Type::I32 : Pack::Type::U32;
+        case 8u: return TypeTraits::is_signed ? Pack::Type::I64 : Pack::Type::U64;
+        default: return Pack::Type::None;
+        }
+      }
+      return Pack::Type::None;
+    }
+
     /// \cond internal
     namespace Intern
     {
@@ -606,8 +645,7 @@ namespace FEAT
      * An estimated (upper bound) array buffer size.
      *
      */
-
-    std::size_t lossy_estimate_size(const std::size_t count, const Pack::Type type, const double tolerance)
+    inline std::size_t lossy_estimate_size(const std::size_t count, const Pack::Type type, const double tolerance)
     {
       if(count <= std::size_t(0))
         return std::size_t(0);
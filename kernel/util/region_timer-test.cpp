@@ -0,0 +1,137 @@
+// FEAT3: Finite Element Analysis Toolbox, Version 3
+// Copyright (C) 2010 - 2020 by Stefan Turek & the FEAT group
+// FEAT3 is released under the GNU General Public License version 3,
+// see the file 'copyright.txt' in the top level directory for details.
+
+#include <test_system/test_system.hpp>
+#include <kernel/util/region_timer.hpp>
+#include <kernel/util/dist.hpp>
+
+using namespace FEAT;
+using namespace FEAT::TestSystem;
+
+/**
+ * \brief Test class for the RegionTimer class.
+ *
+ * \test Tests the region tree, the call counts and work estimates and the formatted summary.
+ */
+class RegionTimerTest
+  : public TaggedTest<Archs::None, Archs::None>
+{
+public:
+  RegionTimerTest() :
+    TaggedTest<Archs::None, Archs::None>("RegionTimerTest")
+  {
+  }
+
+  /// enters a kernel region and counts the evaluations of its work estimate
+  static void kernel(int& num_estimates)
+  {
+    RegionTimer::Scope region("kernel", [&]{ ++num_estimates; return RegionTimer::Work{800u, 100u}; });
+  }
+
+  void test_disabled() const
+  {
+    int num_estimates(0);
+    RegionTimer::reset();
+    {
+      RegionTimer::Scope region("outer");
+      kernel(num_estimates);
+    }
+    TEST_CHECK(RegionTimer::get_root().children.empty());
+    TEST_CHECK_EQUAL(num_estimates, 0);
+  }
+
+  void test_nested() const
+  {
+    int num_estimates(0);
+    RegionTimer::reset();
+    RegionTimer::enable();
+    for(int i(0); i < 3; ++i)
+    {
+      RegionTimer::Scope region("outer");
+      kernel(num_estimates);
+      kernel(num_estimates);
+      {
+        RegionTimer::Scope inner(String("solver"));
+        kernel(num_estimates);
+      }
+    }
+    kernel(num_estimates);
+    RegionTimer::enable(false);
+    TEST_CHECK_EQUAL(num_estimates, 10);
+
+    const RegionTimer::Region& root = RegionTimer::get_root();
+    TEST_CHECK_EQUAL(root.children.size(), std::size_t(2));
+
+    const RegionTimer::Region* outer = RegionTimer::find_region("outer");
+    TEST_CHECK(outer != nullptr);
+    TEST_CHECK_EQUAL(outer->calls, std::uint64_t(3));
+    TEST_CHECK_EQUAL(outer->children.size(), std::size_t(2));
+    TEST_CHECK(outer->min_micros <= outer->max_micros);
+
+    const RegionTimer::Region* kern = RegionTimer::find_region("outer/kernel");
+    TEST_CHECK(kern != nullptr);
+    TEST_CHECK_EQUAL(kern->calls, std::uint64_t(6));
+    TEST_CHECK_EQUAL(kern->bytes, std::uint64_t(4800));
+    TEST_CHECK_EQUAL(kern->flops, std::uint64_t(600));
+
+    const RegionTimer::Region* inner = RegionTimer::find_region("outer/solver/kernel");
+    TEST_CHECK(inner != nullptr);
+    TEST_CHECK_EQUAL(inner->calls, std::uint64_t(3));
+
+    TEST_CHECK_EQUAL(RegionTimer::find_region("kernel")->calls, std::uint64_t(1));
+    TEST_CHECK(RegionTimer::find_region("outer/missing") == nullptr);
+  }
+
+  void test_unbalanced() const
+  {
+    RegionTimer::reset();
+    RegionTimer::enable();
+    {
+      RegionTimer::Scope region("outer");
+      // a solver region, which is never closed explicitly
+      RegionTimer::begin(String("PCG"));
+      {
+        RegionTimer::Scope inner("inner");
+        // ending an inactive region does nothing
+        RegionTimer::end(String("GMRES"));
+      }
+      TEST_CHECK_EQUAL(RegionTimer::find_region("outer/PCG/inner")->calls, std::uint64_t(1));
+      TEST_CHECK_EQUAL(RegionTimer::find_region("outer/PCG")->calls, std::uint64_t(0));
+    }
+    // leaving the outer scope has closed the solver region as well
+    TEST_CHECK_EQUAL(RegionTimer::find_region("outer/PCG")->calls, std::uint64_t(1));
+    TEST_CHECK_EQUAL(RegionTimer::find_region("outer")->calls, std::uint64_t(1));
+    RegionTimer::enable(false);
+  }
+
+  void test_format() const
+  {
+    int num_estimates(0);
+    RegionTimer::reset();
+    RegionTimer::enable();
+    {
+      RegionTimer::Scope region("outer");
+      kernel(num_estimates);
+    }
+    RegionTimer::enable(false);
+
+    Dist::Comm comm(Dist::Comm::world());
+    String s = RegionTimer::get_formatted_regions(comm);
+    if(comm.rank() == 0)
+    {
+      TEST_CHECK(s.find("outer") != String::npos);
+      TEST_CHECK(s.find("  kernel") != String::npos);
+    }
+    RegionTimer::reset();
+  }
+
+  virtual void run() const override
+  {
+    test_disabled();
+    test_nested();
+    test_unbalanced();
+    test_format();
+  }
+} region_timer_test;
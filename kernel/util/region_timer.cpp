@@ -0,0 +1,337 @@
+// FEAT3: Finite Element Analysis Toolbox, Version 3
+// Copyright (C) 2010 - 2020 by Stefan Turek & the FEAT group
+// FEAT3 is released under the GNU General Public License version 3,
+// see the file 'copyright.txt' in the top level directory for details.
+
+#include <kernel/util/region_timer.hpp>
+#include <kernel/util/dist.hpp>
+
+#include <sstream>
+
+#if defined(__linux__)
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#include <cstring>
+#endif
+
+using namespace FEAT;
+
+// static member initialisation
+bool RegionTimer::_enabled = false;
+std::unique_ptr<RegionTimer::Region> RegionTimer::_root(new RegionTimer::Region("total", nullptr, nullptr));
+TimeStamp RegionTimer::_root_stamp;
+std::vector<RegionTimer::Frame> RegionTimer::_stack;
+double RegionTimer::_peak_bandwidth = 0.0;
+int RegionTimer::_hw_fd[RegionTimer::num_hw_counters] = {-1, -1, -1};
+
+/// \cond internal
+namespace
+{
+  // appends the paths of a region and all its descendants in pre-order
+  void collect_paths(const RegionTimer::Region& region, const String& prefix, std::vector<String>& paths)
+  {
+    for(const auto& c : region.children)
+    {
+      String path = prefix.empty() ? c->name : prefix + "\t" + c->name;
+      paths.push_back(path);
+      collect_paths(*c, path, paths);
+    }
+  }
+
+  // finds a region by its path components
+  const RegionTimer::Region* find_path(const RegionTimer::Region& root, const std::deque<String>& names)
+  {
+    const RegionTimer::Region* region = &root;
+    for(const auto& n : names)
+    {
+      region = region->find_child(n);
+      if(region == nullptr)
+        return nullptr;
+    }
+    return region;
+  }
+} // namespace
+/// \endcond
+
+void RegionTimer::_read_hw_counters(long long* values)
+{
+  for(int i(0); i < num_hw_counters; ++i)
+    values[i] = 0ll;
+#if defined(__linux__)
+  if(_hw_fd[0] < 0)
+    return;
+  for(int i(0); i < num_hw_counters; ++i)
+  {
+    long long v(0ll);
+    if((_hw_fd[i] >= 0) && (::read(_hw_fd[i], &v, sizeof(v)) == ssize_t(sizeof(v))))
+      values[i] = v;
+  }
+#endif
+}
+
+RegionTimer::Region* RegionTimer::_push(Region* region, std::uint64_t bytes, std::uint64_t flops)
+{
+  region->bytes += bytes;
+  region->flops += flops;
+  _stack.emplace_back();
+  Frame& frame = _stack.back();
+  frame.region = region;
+  _read_hw_counters(frame.hw);
+  frame.stamp.stamp();
+  return region;
+}
+
+void RegionTimer::_end(const Region* region)
+{
+  // check whether the region is active at all
+  std::size_t k(_stack.size());
+  while((k > 0u) && (_stack.at(k-1u).region != region))
+    --k;
+  if(k == 0u)
+    return;
+
+  // leave all regions up to and including the one found
+  while(_stack.size() >= k)
+    end();
+}
+
+void RegionTimer::enable(bool enabled)
+{
+  XASSERTM(_stack.empty(), "cannot enable/disable region timer while regions are active");
+  if(enabled && !_enabled)
+    _root_stamp.stamp();
+  _enabled = enabled;
+}
+
+bool RegionTimer::enable_hw_counters()
+{
+#if defined(__linux__)
+  if(_hw_fd[0] >= 0)
+    return true;
+
+  const std::uint64_t configs[num_hw_counters] =
+  {
+    PERF_COUNT_HW_CPU_CYCLES,
+    PERF_COUNT_HW_INSTRUCTIONS,
+    PERF_COUNT_HW_CACHE_MISSES
+  };
+
+  for(int i(0); i < num_hw_counters; ++i)
+  {
+    struct perf_event_attr attr;
+    std::memset(&attr, 0, sizeof(attr));
+    attr.type = PERF_TYPE_HARDWARE;
+    attr.size = sizeof(attr);
+    attr.config = configs[i];
+    attr.exclude_kernel = 1;
+    attr.exclude_hv = 1;
+    _hw_fd[i] = int(::syscall(__NR_perf_event_open, &attr, 0, -1, -1, 0));
+    if(_hw_fd[i] < 0)
+    {
+      disable_hw_counters();
+      return false;
+    }
+  }
+  return true;
+#else
+  return false;
+#endif
+}
+
+void RegionTimer::disable_hw_counters()
+{
+  XASSERTM(_stack.empty(), "cannot disable hardware counters while regions are active");
+#if defined(__linux__)
+  for(int i(0); i < num_hw_counters; ++i)
+  {
+    if(_hw_fd[i] >= 0)
+      ::close(_hw_fd[i]);
+    _hw_fd[i] = -1;
+  }
+#endif
+}
+
+void RegionTimer::reset()
+{
+  XASSERTM(_stack.empty(), "cannot reset region timer while regions are active");
+  _root.reset(new Region("total", nullptr, nullptr));
+  _root_stamp.stamp();
+}
+
+RegionTimer::Region* RegionTimer::begin(const char* name, std::uint64_t bytes, std::uint64_t flops)
+{
+  Region* parent = (_stack.empty() ? _root.get() : _stack.back().region);
+
+  // fast path: compare the literal pointers first
+  Region* region(nullptr);
+  for(const auto& c : parent->children)
+  {
+    if(c->key == name)
+    {
+      region = c.get();
+      break;
+    }
+  }
+  if(region == nullptr)
+  {
+    region = parent->find_child(name);
+    if(region == nullptr)
+    {
+      parent->children.emplace_back(new Region(name, name, parent));
+      region = parent->children.back().get();
+    }
+    else if(region->key == nullptr)
+      region->key = name;
+  }
+  return _push(region, bytes, flops);
+}
+
+RegionTimer::Region* RegionTimer::begin(const String& name, std::uint64_t bytes, std::uint64_t flops)
+{
+  Region* parent = (_stack.empty() ? _root.get() : _stack.back().region);
+  Region* region = parent->find_child(name);
+  if(region == nullptr)
+  {
+    parent->children.emplace_back(new Region(name, nullptr, parent));
+    region = parent->children.back().get();
+  }
+  return _push(region, bytes, flops);
+}
+
+void RegionTimer::end()
+{
+  if(_stack.empty())
+    return;
+
+  TimeStamp stamp;
+  Frame& frame = _stack.back();
+  Region& region = *frame.region;
+
+  long long hw[num_hw_counters];
+  _read_hw_counters(hw);
+  for(int i(0); i < num_hw_counters; ++i)
+    region.hw[i] += hw[i] - frame.hw[i];
+
+  const long long micros = stamp.elapsed_micros(frame.stamp);
+  region.micros += micros;
+  if((region.calls == 0u) || (micros < region.min_micros))
+    region.min_micros = micros;
+  if(micros > region.max_micros)
+    region.max_micros = micros;
+  ++region.calls;
+
+  _stack.pop_back();
+}
+
+void RegionTimer::end(const String& name)
+{
+  for(std::size_t k(_stack.size()); k > 0u; --k)
+  {
+    if(_stack.at(k-1u).region->name == name)
+    {
+      _end(_stack.at(k-1u).region);
+      return;
+    }
+  }
+}
+
+const RegionTimer::Region* RegionTimer::find_region(const String& path)
+{
+  std::deque<String> names = path.split_by_string("/");
+  return find_path(*_root, names);
+}
+
+String RegionTimer::get_formatted_regions(const Dist::Comm& comm)
+{
+  // broadcast the region paths of the root process
+  std::stringstream stream;
+  if(comm.rank() == 0)
+  {
+    std::vector<String> paths;
+    collect_paths(*_root, String(), paths);
+    for(const auto& p : paths)
+      stream << p << "\n";
+  }
+  comm.bcast_stringstream(stream, 0);
+
+  std::vector<String> paths;
+  for(String line; std::getline(stream, line); )
+  {
+    if(!line.empty())
+      paths.push_back(line);
+  }
+
+  // gather the local data of all regions: time, calls, bytes, flops, hw counters
+  const std::size_t n = paths.size();
+  const std::size_t m = std::size_t(4 + num_hw_counters);
+  std::vector<double> loc(n * m, 0.0), t_min(n, 0.0), t_max(n, 0.0), sum(n * m, 0.0), loc_t(n, 0.0);
+  for(std::size_t i(0); i < n; ++i)
+  {
+    const Region* r = find_path(*_root, paths.at(i).split_by_string("\t"));
+    if(r == nullptr)
+      continue;
+    loc[i*m + 0] = 1E-6 * double(r->micros);
+    loc[i*m + 1] = double(r->calls);
+    loc[i*m + 2] = double(r->bytes);
+    loc[i*m + 3] = double(r->flops);
+    for(int j(0); j < num_hw_counters; ++j)
+      loc[i*m + 4 + std::size_t(j)] = double(r->hw[j]);
+    loc_t[i] = loc[i*m];
+  }
+
+  const double total_loc = _root_stamp.elapsed_now();
+  double total_max(0.0);
+  comm.allreduce(&total_loc, &total_max, std::size_t(1), Dist::op_max);
+  if(n > 0u)
+  {
+    comm.allreduce(loc_t.data(), t_min.data(), n, Dist::op_min);
+    comm.allreduce(loc_t.data(), t_max.data(), n, Dist::op_max);
+    comm.allreduce(loc.data(), sum.data(), n * m, Dist::op_sum);
+  }
+
+  if(comm.rank() != 0)
+    return String();
+
+  const double nprocs = double(comm.size());
+  const bool hw = hw_counters_enabled();
+
+  String result = String("Region").pad_back(40) + String("Calls").pad_front(12) + String("Avg [s]").pad_front(12) +
+    String("Min [s]").pad_front(12) + String("Max [s]").pad_front(12) + String("Total %").pad_front(9) +
+    String("GB/s").pad_front(10) + String("GFlop/s").pad_front(10);
+  if(_peak_bandwidth > 0.0)
+    result += String("Peak %").pad_front(8);
+  if(hw)
+    result += String("IPC").pad_front(8) + String("LLC GB/s").pad_front(10);
+  result += "\n";
+
+  for(std::size_t i(0); i < n; ++i)
+  {
+    std::deque<String> names = paths.at(i).split_by_string("\t");
+    const double t_avg = sum[i*m + 0] / nprocs;
+    const double calls = sum[i*m + 1] / nprocs;
+    // the bandwidth and flop rates refer to a single process
+    const double bw = (t_avg > 0.0 ? sum[i*m + 2] / nprocs / t_avg : 0.0);
+    const double fl = (t_avg > 0.0 ? sum[i*m + 3] / nprocs / t_avg : 0.0);
+
+    result += (String(2u * (names.size() - 1u), ' ') + names.back()).pad_back(40).trunc_back(40);
+    result += stringify(std::uint64_t(calls)).pad_front(12);
+    result += stringify_fp_fix(t_avg, 6, 12);
+    result += stringify_fp_fix(t_min[i], 6, 12);
+    result += stringify_fp_fix(t_max[i], 6, 12);
+    result += stringify_fp_fix(total_max > 0.0 ? 100.0 * t_avg / total_max : 0.0, 2, 9);
+    result += stringify_fp_fix(1E-9 * bw, 3, 10);
+    result += stringify_fp_fix(1E-9 * fl, 3, 10);
+    if(_peak_bandwidth > 0.0)
+      result += stringify_fp_fix(100.0 * bw / _peak_bandwidth, 1, 8);
+    if(hw)
+    {
+      result += stringify_fp_fix(sum[i*m + 4] > 0.0 ? sum[i*m + 5] / sum[i*m + 4] : 0.0, 2, 8);
+      result += stringify_fp_fix(t_avg > 0.0 ? 1E-9 * 64.0 * sum[i*m + 6] / nprocs / t_avg : 0.0, 3, 10);
+    }
+    result += "\n";
+  }
+
+  return result;
+}
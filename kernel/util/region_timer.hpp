@@ -0,0 +1,340 @@
+// FEAT3: Finite Element Analysis Toolbox, Version 3
+// Copyright (C) 2010 - 2020 by Stefan Turek & the FEAT group
+// FEAT3 is released under the GNU General Public License version 3,
+// see the file 'copyright.txt' in the top level directory for details.
+
+#pragma once
+#ifndef KERNEL_UTIL_REGION_TIMER_HPP
+#define KERNEL_UTIL_REGION_TIMER_HPP 1
+
+// includes, FEAT
+#include <kernel/base_header.hpp>
+#include <kernel/util/string.hpp>
+#include <kernel/util/time_stamp.hpp>
+
+// includes, system
+#include <cstdint>
+#include <memory>
+#include <utility>
+#include <vector>
+
+namespace FEAT
+{
+  /// \cond internal
+  namespace Dist
+  {
+    class Comm;
+  }
+  /// \endcond
+
+  /**
+   * \brief Hierarchical region timer
+   *
+   * This class implements a tree of nested timing regions, which is used to instrument the
+   * kernel subsystems, i.e. the Arch kernels, the assemblers, the solvers as well as the
+   * Global::Gate and Global::Muxer classes. For each region, the number of calls, the total,
+   * minimum and maximum runtime per call as well as estimates of the transferred bytes and
+   * the performed floating point operations are recorded. A region is identified by its name
+   * and its parent region, i.e. the same region name appearing in two different contexts
+   * results in two distinct regions.
+   *
+   * Regions are usually entered and left by creating a RegionTimer::Scope object, which is
+   * given a callable that returns the work estimate of the call:
+   * \code{.cpp}
+   * {
+   *   RegionTimer::Scope scope("my-kernel", [&]{ return RegionTimer::Work{bytes, flops}; });
+   *   ...
+   * }
+   * \endcode
+   *
+   * The region timer is disabled by default. As the work estimate is only evaluated if the
+   * region timer is enabled, a scope then only costs a single branch. Once enabled by calling RegionTimer::enable(), the formatted summary of all regions,
+   * including the minimum, maximum and average runtimes across all processes as well as the
+   * achieved memory bandwidth, can be obtained by RegionTimer::get_formatted_regions().
+   *
+   * On Linux systems, the region timer can additionally read the CPU cycle, instruction and
+   * last-level cache miss counters via the perf_event interface, see enable_hw_counters().
+   *
+   * \note The region timer is not thread-safe, i.e. regions must only be entered by the
+   * master thread of each process.
+   */
+  class RegionTimer
+  {
+  public:
+    /// the number of hardware counters per region
+    static constexpr int num_hw_counters = 3;
+
+    /// work estimate of a single call of a region
+    struct Work
+    {
+      /// the estimated number of bytes transferred
+      std::uint64_t bytes;
+      /// the estimated number of floating point operations performed
+      std::uint64_t flops;
+    };
+
+    /**
+     * \brief Region node
+     *
+     * This structure stores the accumulated data of a single region.
+     */
+    struct Region
+    {
+      /// the name of the region
+      String name;
+      /// the name literal passed to the scope; used for fast look-up only
+      const char* key;
+      /// the parent region
+      Region* parent;
+      /// the child regions in order of their first appearance
+      std::vector<std::unique_ptr<Region>> children;
+      /// the number of calls
+      std::uint64_t calls;
+      /// the total, minimal and maximal runtime of a single call in micro-seconds
+      long long micros, min_micros, max_micros;
+      /// the estimated number of bytes and floating point operations
+      std::uint64_t bytes, flops;
+      /// the accumulated hardware counter values: cycles, instructions, last-level cache misses
+      long long hw[num_hw_counters];
+
+      explicit Region(const String& name_, const char* key_, Region* parent_) :
+        name(name_), key(key_), parent(parent_), calls(0u), micros(0ll), min_micros(0ll), max_micros(0ll),
+        bytes(0u), flops(0u)
+      {
+        for(int i(0); i < num_hw_counters; ++i)
+          hw[i] = 0ll;
+      }
+
+      /// \returns The child region of the given name or \c nullptr, if no such child exists.
+      Region* find_child(const String& child_name) const
+      {
+        for(const auto& c : children)
+        {
+          if(c->name == child_name)
+            return c.get();
+        }
+        return nullptr;
+      }
+    };
+
+    /**
+     * \brief Region scope guard
+     *
+     * This class enters a region upon construction and leaves it upon destruction.
+     * If the region timer is disabled upon construction, the scope does nothing at all.
+     */
+    class Scope
+    {
+    private:
+      Region* _region;
+
+    public:
+      /**
+       * \brief Enters a region
+       *
+       * \param[in] name
+       * The name of the region. Must be a string literal or another pointer which stays valid.
+       *
+       * \param[in] bytes, flops
+       * The estimated number of bytes transferred and floating point operations performed
+       * during this call of the region.
+       */
+      explicit Scope(const char* name, std::uint64_t bytes = 0u, std::uint64_t flops = 0u) :
+        _region(RegionTimer::_enabled ? RegionTimer::begin(name, bytes, flops) : nullptr)
+      {
+      }
+
+      /**
+       * \brief Enters a region with a lazily evaluated work estimate
+       *
+       * \param[in] name
+       * The name of the region. Must be a string literal or another pointer which stays valid.
+       *
+       * \param[in] work
+       * A callable returning the RegionTimer::Work estimate of this call of the region.
+       * It is only evaluated if the region timer is enabled.
+       */
+      template<typename Work_, typename = decltype(std::declval<const Work_&>()().flops)>
+      explicit Scope(const char* name, const Work_& work) :
+        _region(RegionTimer::_enabled ? RegionTimer::_begin(name, work()) : nullptr)
+      {
+      }
+
+      /**
+       * \brief Enters a region with a dynamic name, e.g. the name of a solver
+       */
+      explicit Scope(const String& name, std::uint64_t bytes = 0u, std::uint64_t flops = 0u) :
+        _region(RegionTimer::_enabled ? RegionTimer::begin(name, bytes, flops) : nullptr)
+      {
+      }
+
+      Scope(const Scope&) = delete;
+      Scope& operator=(const Scope&) = delete;
+
+      /// leaves the region
+      ~Scope()
+      {
+        if(_region != nullptr)
+          RegionTimer::_end(_region);
+      }
+    }; // class RegionTimer::Scope
+
+  private:
+    /// the stack frame of an active region
+    struct Frame
+    {
+      Region* region;
+      TimeStamp stamp;
+      long long hw[num_hw_counters];
+    };
+
+    /// specifies whether the region timer is enabled
+    static bool _enabled;
+    /// the root region
+    static std::unique_ptr<Region> _root;
+    /// the time stamp of the last reset
+    static TimeStamp _root_stamp;
+    /// the stack of active regions
+    static std::vector<Frame> _stack;
+    /// the peak memory bandwidth in bytes per second
+    static double _peak_bandwidth;
+    /// the perf_event file descriptors of the hardware counters
+    static int _hw_fd[num_hw_counters];
+
+    /// reads the current hardware counter values
+    static void _read_hw_counters(long long* values);
+
+    /// pushes a new frame for a region
+    static Region* _push(Region* region, std::uint64_t bytes, std::uint64_t flops);
+
+    /// enters a region with a work estimate
+    static Region* _begin(const char* name, const Work& work)
+    {
+      return begin(name, work.bytes, work.flops);
+    }
+
+    /// leaves all regions up to and including the given region, if it is active
+    static void _end(const Region* region);
+
+  public:
+    /**
+     * \brief Enables or disables the region timer
+     *
+     * \attention Must not be called while any region is active.
+     */
+    static void enable(bool enabled = true);
+
+    /// \returns \c true, if the region timer is enabled, otherwise \c false.
+    static bool enabled()
+    {
+      return _enabled;
+    }
+
+    /**
+     * \brief Enables the hardware counters
+     *
+     * This function tries to open the cycle, instruction and last-level cache miss counters
+     * of the calling thread via the Linux perf_event interface.
+     *
+     * \returns
+     * \c true, if the hardware counters are available, otherwise \c false.
+     */
+    static bool enable_hw_counters();
+
+    /// Disables the hardware counters
+    static void disable_hw_counters();
+
+    /// \returns \c true, if the hardware counters are enabled, otherwise \c false.
+    static bool hw_counters_enabled()
+    {
+      return _hw_fd[0] >= 0;
+    }
+
+    /**
+     * \brief Sets the peak memory bandwidth of a single process
+     *
+     * If set, the formatted summary contains the fraction of the peak bandwidth that each
+     * region has achieved, which indicates how close a bandwidth-bound kernel is to the
+     * hardware limit.
+     *
+     * \param[in] bytes_per_sec
+     * The peak memory bandwidth in bytes per second, e.g. the STREAM triad bandwidth
+     * of a node divided by the number of processes per node.
+     */
+    static void set_peak_bandwidth(double bytes_per_sec)
+    {
+      _peak_bandwidth = bytes_per_sec;
+    }
+
+    /// Discards all regions and restarts the root time stamp
+    static void reset();
+
+    /// Enters a region and returns it
+    static Region* begin(const char* name, std::uint64_t bytes = 0u, std::uint64_t flops = 0u);
+
+    /// Enters a region with a dynamic name and returns it
+    static Region* begin(const String& name, std::uint64_t bytes = 0u, std::uint64_t flops = 0u);
+
+    /// Leaves the current region
+    static void end();
+
+    /**
+     * \brief Leaves all regions up to and including the innermost active region of the given name
+     *
+     * This function is used for regions, which are not entered and left in a strictly
+     * nested manner, e.g. the solver regions opened by the solver expressions.
+     * If no active region of the given name exists, this function does nothing.
+     */
+    static void end(const String& name);
+
+    /**
+     * \brief Adds work estimates to the current region
+     *
+     * \param[in] bytes, flops
+     * The estimated number of bytes and floating point operations to be added.
+     */
+    static void add_work(std::uint64_t bytes, std::uint64_t flops)
+    {
+      if(_enabled && !_stack.empty())
+      {
+        _stack.back().region->bytes += bytes;
+        _stack.back().region->flops += flops;
+      }
+    }
+
+    /// \returns The root region, whose children are the outermost regions.
+    static const Region& get_root()
+    {
+      return *_root;
+    }
+
+    /**
+     * \brief Returns a region by its path
+     *
+     * \param[in] path
+     * The names of the region and all its ancestors, separated by <c>'/'</c>, e.g. <c>"solve/PCG"</c>.
+     *
+     * \returns
+     * A pointer to the region or \c nullptr, if no such region exists.
+     */
+    static const Region* find_region(const String& path);
+
+    /**
+     * \brief Returns a formatted summary of all regions
+     *
+     * The summary lists all regions of the root process in a tree and reduces the runtimes,
+     * call counts, bytes and flops of each region across all processes of the communicator.
+     *
+     * \note This function is a collective operation.
+     *
+     * \param[in] comm
+     * The communicator over which the region data is to be reduced.
+     *
+     * \returns
+     * The formatted summary on the root process and an empty string on all other processes.
+     */
+    static String get_formatted_regions(const Dist::Comm& comm);
+  }; // class RegionTimer
+} // namespace FEAT
+
+#endif // KERNEL_UTIL_REGION_TIMER_HPP
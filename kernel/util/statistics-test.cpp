@@ -0,0 +1,164 @@
+// FEAT3: Finite Element Analysis Toolbox, Version 3
+// Copyright (C) 2010 - 2020 by Stefan Turek & the FEAT group
+// FEAT3 is released under the GNU General Public License version 3,
+// see the file 'copyright.txt' in the top level directory for details.
+
+#include <test_system/test_system.hpp>
+#include <kernel/util/statistics.hpp>
+#include <kernel/solver/base.hpp>
+
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <vector>
+
+using namespace FEAT;
+using namespace FEAT::TestSystem;
+using namespace FEAT::Solver;
+
+/**
+ * \brief Test class for the solver expression recording of the Statistics class.
+ *
+ * \test Tests the condensed solver statistics, the solver tree, the event ring buffer
+ * and the binary trace export.
+ */
+class StatisticsTest
+  : public TaggedTest<Archs::None, Archs::None>
+{
+public:
+  StatisticsTest() :
+    TaggedTest<Archs::None, Archs::None>("StatisticsTest")
+  {
+  }
+
+  // emits the expressions of a PCG solve process preconditioned by Jacobi
+  static void pcg_solve(Index iters)
+  {
+    Statistics::add_solver_expression(ExpressionStartSolve("PCG"));
+    for(Index i(0); i < iters; ++i)
+    {
+      Statistics::add_solver_expression(ExpressionCallPrecond("PCG", "Jacobi"));
+      Statistics::add_solver_expression(ExpressionDefect("PCG", 1.0 / double(i+1), i+1));
+      Statistics::add_solver_expression(ExpressionTimings("PCG", 0.5, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0));
+    }
+    Statistics::add_solver_expression(ExpressionEndSolve("PCG", Status::success, iters));
+  }
+
+  void test_pcg() const
+  {
+    Statistics::expression_target = "stat_test_pcg";
+    pcg_solve(4);
+    pcg_solve(2);
+
+    TEST_CHECK_EQUAL(Statistics::get_formatted_solver_tree("stat_test_pcg"), String("PCG ( Jacobi )"));
+
+    Statistics::compress_solver_expressions();
+    TEST_CHECK_EQUAL(Statistics::get_iters("stat_test_pcg").size(), std::size_t(1));
+    TEST_CHECK_EQUAL(Statistics::get_iters("stat_test_pcg").back(), Index(6));
+    TEST_CHECK_EQUAL_WITHIN_EPS(Statistics::get_time_toe("stat_test_pcg").back(), 3.0, 1E-12);
+
+    // each compression commits one entry
+    pcg_solve(1);
+    Statistics::compress_solver_expressions();
+    TEST_CHECK_EQUAL(Statistics::get_iters("stat_test_pcg").size(), std::size_t(2));
+    TEST_CHECK_EQUAL(Statistics::get_iters("stat_test_pcg").back(), Index(1));
+  }
+
+  void test_multigrid() const
+  {
+    Statistics::expression_target = "stat_test_mg";
+    for(int k(0); k < 2; ++k)
+    {
+      Statistics::add_solver_expression(ExpressionStartSolve("MultiGrid-V"));
+      Statistics::add_solver_expression(ExpressionCallSmoother("MultiGrid-V", "Jacobi"));
+      Statistics::add_solver_expression(ExpressionCallCoarseSolver("MultiGrid-V", "PCG"));
+      pcg_solve(3);
+      Statistics::add_solver_expression(ExpressionLevelTimings("MultiGrid-V", 0, 0.25, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0));
+      Statistics::add_solver_expression(ExpressionLevelTimings("MultiGrid-V", 1, 0.5, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0));
+      Statistics::add_solver_expression(ExpressionEndSolve("MultiGrid-V", Status::success, 1));
+    }
+
+    TEST_CHECK_EQUAL(Statistics::get_formatted_solver_tree("stat_test_mg"), String("MultiGrid-V ( S: Jacobi / C: PCG ( Jacobi ) )"));
+
+    Statistics::compress_solver_expressions();
+    const auto& mg_toe = Statistics::get_time_mg("stat_test_mg").back();
+    TEST_CHECK_EQUAL(mg_toe.size(), std::size_t(2));
+    TEST_CHECK_EQUAL_WITHIN_EPS(mg_toe.at(0), 0.5, 1E-12);
+    TEST_CHECK_EQUAL_WITHIN_EPS(mg_toe.at(1), 1.0, 1E-12);
+    TEST_CHECK_EQUAL(Statistics::get_iters("stat_test_mg").back(), Index(2));
+  }
+
+  void test_ring_buffer() const
+  {
+    Statistics::set_expression_capacity(16u);
+    Statistics::expression_target = "stat_test_ring";
+
+    // 2 + 3*10 = 32 events, so only the last 16 remain in the ring buffer
+    pcg_solve(10);
+    std::vector<ExpressionEvent> events = Statistics::get_solver_expressions("stat_test_ring");
+    TEST_CHECK_EQUAL(events.size(), std::size_t(16));
+    TEST_CHECK_EQUAL(events.back().type, std::int32_t(ExpressionType::end_solve));
+    TEST_CHECK_EQUAL(events.back().index, std::uint32_t(10));
+    TEST_CHECK_EQUAL(Statistics::get_expression_name(events.back().solver), String("PCG"));
+    for(std::size_t i(1); i < events.size(); ++i)
+      TEST_CHECK(events[i-1].stamp <= events[i].stamp);
+
+    // the condensed statistics are not affected by the overwritten events
+    Statistics::compress_solver_expressions();
+    TEST_CHECK_EQUAL(Statistics::get_iters("stat_test_ring").back(), Index(10));
+
+    // write the trace file and check its header
+    const String filename("statistics-test.trace");
+    Statistics::write_expression_trace(filename);
+    {
+      std::ifstream file(filename.c_str(), std::ios_base::in | std::ios_base::binary);
+      TEST_CHECK(file.is_open());
+      char magic[8];
+      std::uint64_t header[3];
+      file.read(magic, 8);
+      file.read(reinterpret_cast<char*>(header), std::streamsize(sizeof(header)));
+      TEST_CHECK(std::memcmp(magic, "FEATTRC1", 8) == 0);
+      TEST_CHECK_EQUAL(header[1], std::uint64_t(16));
+      TEST_CHECK_EQUAL(header[2], std::uint64_t(16));
+    }
+    std::remove(filename.c_str());
+
+    // no events are recorded without trace verbosity
+    Statistics::set_expression_verbosity(Statistics::ExpressionVerbosity::summary);
+    pcg_solve(1);
+    TEST_CHECK_EQUAL(Statistics::get_solver_expressions("stat_test_ring").size(), std::size_t(16));
+    Statistics::set_expression_verbosity(Statistics::ExpressionVerbosity::none);
+    pcg_solve(1);
+    Statistics::compress_solver_expressions();
+    TEST_CHECK_EQUAL(Statistics::get_iters("stat_test_ring").back(), Index(1));
+
+    Statistics::set_expression_verbosity(Statistics::ExpressionVerbosity::trace);
+    Statistics::set_expression_capacity(16384u);
+  }
+
+  void test_tree_fallback() const
+  {
+    // no expressions recorded at all
+    TEST_CHECK_EQUAL(Statistics::get_formatted_solver_tree("stat_test_none"), String());
+
+    // the first solve process is still running; the names are passed as interned ids
+    Statistics::expression_target = "stat_test_partial";
+    const ExpressionName pcg(Statistics::intern_expression_name("PCG"));
+    const ExpressionName jacobi(Statistics::intern_expression_name("Jacobi"));
+    Statistics::add_solver_expression(ExpressionStartSolve(pcg));
+    Statistics::add_solver_expression(ExpressionCallPrecond(pcg, jacobi));
+    TEST_CHECK_EQUAL(Statistics::get_formatted_solver_tree("stat_test_partial"), String("PCG ( Jacobi )"));
+
+    Statistics::add_solver_expression(ExpressionEndSolve(pcg, Status::success, 1));
+    TEST_CHECK_EQUAL(Statistics::get_formatted_solver_tree("stat_test_partial"), String("PCG ( Jacobi )"));
+  }
+
+  virtual void run() const override
+  {
+    test_pcg();
+    test_tree_fallback();
+    test_multigrid();
+    test_ring_buffer();
+    Statistics::expression_target = "default";
+  }
+} statistics_test;
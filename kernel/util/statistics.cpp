@@ -5,6 +5,7 @@
 
 #include <kernel/util/statistics.hpp>
 #include <kernel/util/dist.hpp>
+#include <kernel/util/region_timer.hpp>
 #include <kernel/solver/base.hpp>
 
 #include <queue>
@@ -27,7 +28,17 @@ KahanAccumulation Statistics::_time_mpi_wait_reduction;
 KahanAccumulation Statistics::_time_mpi_wait_blas2;
 KahanAccumulation Statistics::_time_mpi_wait_blas3;
 KahanAccumulation Statistics::_time_mpi_wait_collective;
-std::map<String, std::list<std::shared_ptr<Solver::ExpressionBase>>> Statistics::_solver_expressions;
+Statistics::ExpressionVerbosity Statistics::_expression_verbosity = Statistics::ExpressionVerbosity::trace;
+TimeStamp Statistics::_expression_epoch;
+std::vector<String> Statistics::_expression_names;
+std::map<String, std::uint32_t> Statistics::_expression_name_ids;
+std::vector<Solver::ExpressionEvent> Statistics::_expression_events;
+std::size_t Statistics::_expression_capacity = std::size_t(16384);
+std::uint64_t Statistics::_expression_count = 0u;
+std::map<String, Statistics::ExpressionTargetState> Statistics::_expression_states;
+String Statistics::_expression_target_cached;
+std::uint32_t Statistics::_expression_target_id = 0u;
+Statistics::ExpressionTargetState* Statistics::_expression_target_state = nullptr;
 std::map<String, String> Statistics::_formatted_solver_trees;
 std::map<String, std::list<double>> Statistics::_overall_toe;
 std::map<String, std::list<Index>> Statistics::_overall_iters;
@@ -55,86 +66,401 @@ double Statistics::toe_partition;
 double Statistics::toe_assembly;
 double Statistics::toe_solve;
 
-String Statistics::_generate_formatted_solver_tree(String target)
+/// \cond internal
+namespace
 {
-  std::list<String> names;
-  std::list<int> found; //number of found preconds / smoothers / coarse solvers. 0 = nothing found, 1 = smoother / s found, 2 = coarse solver / a found, 3 = all found
+  // checks whether an expression type is a call of another solver
+  bool is_call_expression(std::int32_t type)
+  {
+    switch(Solver::ExpressionType(type))
+    {
+    case Solver::ExpressionType::call_precond:
+    case Solver::ExpressionType::call_precond_l:
+    case Solver::ExpressionType::call_precond_r:
+    case Solver::ExpressionType::call_smoother:
+    case Solver::ExpressionType::call_coarse_solver:
+    case Solver::ExpressionType::call_uzawa_s:
+    case Solver::ExpressionType::call_uzawa_a:
+      return true;
+    default:
+      return false;
+    }
+  }
+
+  // checks whether a solver name belongs to a multigrid solver
+  bool is_multigrid_name(const String& name)
+  {
+    return name.starts_with("MultiGrid") || name.starts_with("VCycle") || name.starts_with("ScaRCMultiGrid");
+  }
+} // namespace
+/// \endcond
+
+std::uint32_t Statistics::intern_expression_name(const String& name)
+{
+  auto it = _expression_name_ids.find(name);
+  if(it != _expression_name_ids.end())
+    return it->second;
+
+  const std::uint32_t id = std::uint32_t(_expression_names.size());
+  _expression_names.push_back(name);
+  _expression_name_ids.emplace(name, id);
+  return id;
+}
+
+void Statistics::add_solver_expression(const Solver::ExpressionBase& expression)
+{
+  // each solve process is a region of the region timer
+  if(RegionTimer::enabled())
+  {
+    if(expression.get_type() == Solver::ExpressionType::start_solve)
+      RegionTimer::begin(get_expression_name(_expression_name_id(expression.solver_name)));
+    else if(expression.get_type() == Solver::ExpressionType::end_solve)
+      RegionTimer::end(get_expression_name(_expression_name_id(expression.solver_name)));
+  }
+
+  if(_expression_verbosity == ExpressionVerbosity::none)
+    return;
+
+  // look up the target only if it has been changed since the last expression
+  if((_expression_target_state == nullptr) || (_expression_target_cached != expression_target))
+  {
+    _expression_target_cached = expression_target;
+    _expression_target_id = intern_expression_name(expression_target);
+    _expression_target_state = &_expression_states[expression_target];
+  }
+
+  // convert the expression into a compact event
+  Solver::ExpressionEvent event;
+  event.stamp = _expression_epoch.elapsed_now();
+  for(int i(0); i < 9; ++i)
+    event.values[i] = 0.0;
+  event.target = _expression_target_id;
+  event.solver = _expression_name_id(expression.solver_name);
+  event.other = event.index = 0u;
+  event.type = std::int32_t(expression.get_type());
+  event.pad = 0;
+
+  switch(expression.get_type())
+  {
+  case Solver::ExpressionType::end_solve:
+    {
+      const auto& t = static_cast<const Solver::ExpressionEndSolve&>(expression);
+      event.other = std::uint32_t(t.status);
+      event.index = std::uint32_t(t.iters);
+      break;
+    }
+  case Solver::ExpressionType::call_precond:
+    event.other = _expression_name_id(static_cast<const Solver::ExpressionCallPrecond&>(expression).precond_name);
+    break;
+  case Solver::ExpressionType::call_precond_l:
+    event.other = _expression_name_id(static_cast<const Solver::ExpressionCallPrecondL&>(expression).precond_name);
+    break;
+  case Solver::ExpressionType::call_precond_r:
+    event.other = _expression_name_id(static_cast<const Solver::ExpressionCallPrecondR&>(expression).precond_name);
+    break;
+  case Solver::ExpressionType::call_smoother:
+    event.other = _expression_name_id(static_cast<const Solver::ExpressionCallSmoother&>(expression).smoother_name);
+    break;
+  case Solver::ExpressionType::call_coarse_solver:
+    event.other = _expression_name_id(static_cast<const Solver::ExpressionCallCoarseSolver&>(expression).coarse_solver_name);
+    break;
+  case Solver::ExpressionType::call_uzawa_s:
+    event.other = _expression_name_id(static_cast<const Solver::ExpressionCallUzawaS&>(expression).solver_s_name);
+    break;
+  case Solver::ExpressionType::call_uzawa_a:
+    event.other = _expression_name_id(static_cast<const Solver::ExpressionCallUzawaA&>(expression).solver_a_name);
+    break;
+  case Solver::ExpressionType::defect:
+    {
+      const auto& t = static_cast<const Solver::ExpressionDefect&>(expression);
+      event.index = std::uint32_t(t.iter);
+      event.values[0] = t.def;
+      break;
+    }
+  case Solver::ExpressionType::timings:
+    {
+      const auto& t = static_cast<const Solver::ExpressionTimings&>(expression);
+      event.values[0] = t.solver_toe;
+      event.values[1] = t.mpi_execute_reduction;
+      event.values[2] = t.mpi_execute_blas2;
+      event.values[3] = t.mpi_execute_blas3;
+      event.values[4] = t.mpi_execute_collective;
+      event.values[5] = t.mpi_wait_reduction;
+      event.values[6] = t.mpi_wait_blas2;
+      event.values[7] = t.mpi_wait_blas3;
+      event.values[8] = t.mpi_wait_collective;
+      break;
+    }
+  case Solver::ExpressionType::level_timings:
+    {
+      const auto& t = static_cast<const Solver::ExpressionLevelTimings&>(expression);
+      event.index = std::uint32_t(t.level);
+      event.values[0] = t.level_toe;
+      event.values[1] = t.mpi_execute_reduction;
+      event.values[2] = t.mpi_execute_blas2;
+      event.values[3] = t.mpi_execute_blas3;
+      event.values[4] = t.mpi_execute_collective;
+      event.values[5] = t.mpi_wait_reduction;
+      event.values[6] = t.mpi_wait_blas2;
+      event.values[7] = t.mpi_wait_blas3;
+      event.values[8] = t.mpi_wait_collective;
+      break;
+    }
+  case Solver::ExpressionType::prol:
+    event.index = std::uint32_t(static_cast<const Solver::ExpressionProlongation&>(expression).level);
+    break;
+  case Solver::ExpressionType::rest:
+    event.index = std::uint32_t(static_cast<const Solver::ExpressionRestriction&>(expression).level);
+    break;
+  default:
+    break;
+  }
+
+  // store the event in the ring buffer; the buffer is allocated only once
+  if((_expression_verbosity == ExpressionVerbosity::trace) && (_expression_capacity > std::size_t(0)))
+  {
+    if(_expression_events.empty())
+      _expression_events.resize(_expression_capacity);
+    _expression_events[std::size_t(_expression_count % _expression_capacity)] = event;
+    ++_expression_count;
+  }
+
+  ExpressionTargetState& state = *_expression_target_state;
+  state.pending = true;
+
+  // store the events of the first outer solve process for the solver tree; all events which do not
+  // follow a solver call are irrelevant for the tree and therefore skipped to bound the memory usage
+  if(!state.tree_complete)
+  {
+    const bool structural = (event.type == std::int32_t(Solver::ExpressionType::start_solve)) ||
+      (event.type == std::int32_t(Solver::ExpressionType::end_solve)) || is_call_expression(event.type);
+    if(state.tree_events.empty() ? (event.type == std::int32_t(Solver::ExpressionType::start_solve)) :
+      (structural || is_call_expression(state.tree_events.back().type)))
+      state.tree_events.push_back(event);
+  }
+
+  _condense_expression(state, event);
+
+  // generate the solver tree once the first outer solve process is complete
+  if(!state.tree_complete && state.names.empty() && !state.tree_events.empty())
+  {
+    if(_formatted_solver_trees.count(expression_target) == 0)
+      _formatted_solver_trees[expression_target] = _generate_formatted_solver_tree(state.tree_events);
+    state.tree_complete = true;
+    std::vector<Solver::ExpressionEvent>().swap(state.tree_events);
+  }
+}
+
+String Statistics::get_formatted_solver_tree(String target)
+{
+  auto it = _formatted_solver_trees.find(target);
+  if (it != _formatted_solver_trees.end())
+    return it->second;
+
+  // the first solve process has not been completed yet: close all running solvers
+  auto is = _expression_states.find(target);
+  if ((is == _expression_states.end()) || is->second.tree_events.empty())
+    return String();
+  std::vector<Solver::ExpressionEvent> events(is->second.tree_events);
+  for (auto name = is->second.names.rbegin(); name != is->second.names.rend(); ++name)
+  {
+    Solver::ExpressionEvent event(events.back());
+    event.type = std::int32_t(Solver::ExpressionType::end_solve);
+    event.solver = *name;
+    events.push_back(event);
+  }
+  return _generate_formatted_solver_tree(events);
+}
+
+void Statistics::_condense_expression(ExpressionTargetState& state, const Solver::ExpressionEvent& event)
+{
+  auto& names = state.names;
+  const Solver::ExpressionType type = Solver::ExpressionType(event.type);
+
+  if (type == Solver::ExpressionType::start_solve)
+  {
+    names.push_back(event.solver);
+    const String& name = get_expression_name(event.solver);
+
+    // set outest mg depth to first mg found in solver tree while descending
+    if (is_multigrid_name(name) && state.outer_mg_depth == 0)
+      state.outer_mg_depth = Index(names.size());
+
+    // set depth of schwarz preconditioner in solver tree while descending
+    if (name.starts_with("Schwarz") && state.outer_schwarz_depth == 0)
+      state.outer_schwarz_depth = Index(names.size());
+  }
+
+  // checks whether the current solver lies directly inside the outer schwarz preconditioner
+  const bool in_schwarz = (names.size() > 1) && (Index(names.size()) == state.outer_schwarz_depth + 1) &&
+    (get_expression_name(names.at(names.size() - 2)) == "Schwarz");
+
+  //fetch iters from top-lvl (lying insided of schwarz or global)
+  if (type == Solver::ExpressionType::end_solve && !names.empty() && event.solver == names.back())
+  {
+    if (in_schwarz)
+      state.schwarz_iters += Index(event.index);
+    if (names.size() < 2)
+      state.iters += Index(event.index);
+
+    names.pop_back();
+    return;
+  }
 
-  if(_solver_expressions.count(target) == 0)
+  if ((names.size() < 2) && type == Solver::ExpressionType::timings)
   {
-    throw InternalError(__func__, __FILE__, __LINE__,
-    "target "+target+" not present in _solver_expressions");
+    state.toe += event.values[0];
+    for(int i(0); i < 8; ++i)
+      state.mpi_times[i] += event.values[i+1];
   }
 
-  if (_solver_expressions[target].front()->get_type() != Solver::ExpressionType::start_solve)
+  if (Index(names.size()) == state.outer_mg_depth && type == Solver::ExpressionType::level_timings)
   {
-    throw InternalError(__func__, __FILE__, __LINE__, "Should never happen - _solver_expressions list did not start with start solve expression!");
+    // add new vector entries for current level if vector does not already contain an entry for this level
+    const std::size_t level = std::size_t(event.index);
+    for(int i(0); i < 9; ++i)
+    {
+      if (state.mg_times[i].size() <= level)
+        state.mg_times[i].resize(level + 1u, 0.0);
+      state.mg_times[i].at(level) += event.values[i];
+    }
   }
 
+  //grep the solver which lies in the schwarz solver to get its toe
+  if (in_schwarz && type == Solver::ExpressionType::timings)
+    state.schwarz_toe += event.values[0];
+}
+
+std::vector<Solver::ExpressionEvent> Statistics::get_solver_expressions(String target)
+{
+  std::vector<Solver::ExpressionEvent> events;
+  if(_expression_name_ids.count(target) == 0)
+    return events;
+
+  const std::uint32_t id = _expression_name_ids.at(target);
+  const std::uint64_t cap = std::uint64_t(_expression_capacity);
+  const std::uint64_t first = (_expression_count > cap ? _expression_count - cap : std::uint64_t(0));
+  for(std::uint64_t k(first); k < _expression_count; ++k)
+  {
+    const Solver::ExpressionEvent& event = _expression_events[std::size_t(k % cap)];
+    if(event.target == id)
+      events.push_back(event);
+  }
+  return events;
+}
+
+void Statistics::write_expression_trace(const String& filename)
+{
+  std::ofstream file(filename.c_str(), std::ios_base::out | std::ios_base::binary);
+  if (! file.is_open())
+    throw InternalError(__func__, __FILE__, __LINE__, "Unable to open trace file " + filename);
+
+  const std::uint64_t cap = std::uint64_t(_expression_capacity);
+  const std::uint64_t first = (_expression_count > cap ? _expression_count - cap : std::uint64_t(0));
+
+  // write header
+  const std::uint64_t header[3] =
+  {
+    std::uint64_t(_expression_names.size()),
+    _expression_count - first,
+    first
+  };
+  file.write("FEATTRC1", 8);
+  file.write(reinterpret_cast<const char*>(header), std::streamsize(sizeof(header)));
+
+  // write names
+  for(const auto& name : _expression_names)
+  {
+    const std::uint32_t len = std::uint32_t(name.size());
+    file.write(reinterpret_cast<const char*>(&len), std::streamsize(sizeof(len)));
+    file.write(name.data(), std::streamsize(len));
+  }
+
+  // write events in chronological order
+  for(std::uint64_t k(first); k < _expression_count; ++k)
+  {
+    const Solver::ExpressionEvent& event = _expression_events[std::size_t(k % cap)];
+    file.write(reinterpret_cast<const char*>(&event), std::streamsize(sizeof(event)));
+  }
+
+  file.close();
+}
+
+String Statistics::_generate_formatted_solver_tree(const std::vector<Solver::ExpressionEvent>& events)
+{
+  std::list<String> names;
+  std::list<int> found; //number of found preconds / smoothers / coarse solvers. 0 = nothing found, 1 = smoother / s found, 2 = coarse solver / a found, 3 = all found
+
+  if (events.empty() || events.front().type != std::int32_t(Solver::ExpressionType::start_solve))
+  {
+    throw InternalError(__func__, __FILE__, __LINE__, "Should never happen - expression event list did not start with start solve expression!");
+  }
+
+  // returns the type of an event
+  auto type_of = [&](std::size_t k) { return Solver::ExpressionType(events.at(k).type); };
+  // returns the solver name of an event
+  auto solver_of = [&](std::size_t k) -> const String& { return get_expression_name(events.at(k).solver); };
+  // returns the name of the solver called by an event
+  auto other_of = [&](std::size_t k) -> const String& { return get_expression_name(events.at(k).other); };
+  // checks whether the event following a call is the start of the called solver
+  auto next_is_start = [&](std::size_t k) { return (k + 1 < events.size()) && (type_of(k + 1) == Solver::ExpressionType::start_solve); };
+
   // process the very first entry, e.g. the outer most solver
-  auto it = _solver_expressions[target].begin();
-  String tree((*it)->solver_name);
-  names.push_back((*it)->solver_name);
+  std::size_t it(0);
+  String tree(solver_of(it));
+  names.push_back(solver_of(it));
   found.push_back(0);
 
   // process current last element in the list, until no element needs to be processed
-  while (names.size() > 0 && it != _solver_expressions[target].end())
+  while (names.size() > 0 && it < events.size())
   {
     ++it;
 
     // the current solver is of multigrid type, search for smoother and coarse solver (smoother always comes first).
     // if smoother and coarse solver have been found, skip everything until solver end statement has been found
-    if (names.back().starts_with("MultiGrid") || names.back().starts_with("VCycle") || names.back().starts_with("ScaRCMultiGrid"))
+    if (is_multigrid_name(names.back()))
     {
-      while (it != _solver_expressions[target].end())
+      while (it < events.size())
       {
-        auto expression = *it;
-
-        if (expression->get_type() == Solver::ExpressionType::call_smoother && expression->solver_name == names.back() && (found.back() == 0 || found.back() == 2))
+        if (type_of(it) == Solver::ExpressionType::call_smoother && solver_of(it) == names.back() && (found.back() == 0 || found.back() == 2))
         {
           found.back() += 1;
-          auto j = it;
-          ++j;
           // smoother call found, that is a solver on its own. break processing of current solver and dive on step deeper into smoother solver processing
-          if ((*j)->get_type() == Solver::ExpressionType::start_solve)
+          if (next_is_start(it))
           {
             ++it; //shift over to solver start expression
-            tree += " ( S: " + (*it)->solver_name;
-            names.push_back((*it)->solver_name);
+            tree += " ( S: " + solver_of(it);
+            names.push_back(solver_of(it));
             found.push_back(0);
             break;
           }
           // smoother is no solver on its own, we can continue with the current solver's end statement search
           else
           {
-            auto t = dynamic_cast<Solver::ExpressionCallSmoother*>(expression.get());
-            tree += " ( S: " + t->smoother_name;
+            tree += " ( S: " + other_of(it);
           }
         }
 
-        if (expression->get_type() == Solver::ExpressionType::call_coarse_solver && expression->solver_name == names.back() && (found.back() == 0 || found.back() == 1))
+        if (type_of(it) == Solver::ExpressionType::call_coarse_solver && solver_of(it) == names.back() && (found.back() == 0 || found.back() == 1))
         {
           found.back() += 2;
-          auto j = it;
-          ++j;
           // coarse solver call found, that is a solver on its own. break processing of current solver and dive on step deeper into coarse solver processing
-          if ((*j)->get_type() == Solver::ExpressionType::start_solve)
+          if (next_is_start(it))
           {
             ++it; //shift over to solver start expression
-            tree += " / C: " + (*it)->solver_name;
-            names.push_back((*it)->solver_name);
+            tree += " / C: " + solver_of(it);
+            names.push_back(solver_of(it));
             found.push_back(0);
             break;
           }
           // coarse solver is no solver on its own, we can continue with the current solver's end statement search
           else
           {
-            auto t = dynamic_cast<Solver::ExpressionCallCoarseSolver*>(expression.get());
-            tree += " / C: " + t->coarse_solver_name;
+            tree += " / C: " + other_of(it);
           }
         }
 
-        if (expression->get_type() == Solver::ExpressionType::end_solve && expression->solver_name == names.back())
+        if (type_of(it) == Solver::ExpressionType::end_solve && solver_of(it) == names.back())
         {
           tree += " )";
           names.pop_back();
@@ -145,146 +471,59 @@ String Statistics::_generate_formatted_solver_tree(String target)
       }
     }
 
-    // the current solver is of uzawa complement type, search for a and s solver
+    // the current solver is of uzawa complement type or uses l and r preconditioners, search for both sub-solvers
     // if both have been found, skip everything until solver end statement has been found
-    else if (names.back().starts_with("Uzawa"))
+    else if (names.back().starts_with("Uzawa") || names.back().starts_with("PCGNR"))
     {
-      while (it != _solver_expressions[target].end())
-      {
-        auto expression = *it;
-
-        if (expression->get_type() == Solver::ExpressionType::call_uzawa_s && expression->solver_name == names.back() && (found.back() == 0 || found.back() == 2))
-        {
-          found.back() += 1;
-          auto j = it;
-          ++j;
-          // s solver call found, that is a solver on its own. break processing of current solver and dive on step deeper into s solver processing
-          if ((*j)->get_type() == Solver::ExpressionType::start_solve)
-          {
-            ++it; //shift over to solver start expression
-            if (found.back() == 1)
-              tree += " ( S: " + (*it)->solver_name;
-            else
-            tree += " / S: " + (*it)->solver_name;
-            names.push_back((*it)->solver_name);
-            found.push_back(0);
-            break;
-          }
-          // s solver is no solver on its own, we can continue with the current solver's end statement search
-          else
-          {
-            auto t = dynamic_cast<Solver::ExpressionCallUzawaS*>(expression.get());
-            if (found.back() == 1)
-              tree += " ( S: " + t->solver_s_name;
-            else
-              tree += " / S: " + t->solver_s_name;
-          }
-        }
+      const bool uzawa = names.back().starts_with("Uzawa");
+      const Solver::ExpressionType type_1 = (uzawa ? Solver::ExpressionType::call_uzawa_s : Solver::ExpressionType::call_precond_l);
+      const Solver::ExpressionType type_2 = (uzawa ? Solver::ExpressionType::call_uzawa_a : Solver::ExpressionType::call_precond_r);
+      const String label_1 = (uzawa ? "S: " : "L: ");
+      const String label_2 = (uzawa ? "A: " : "R: ");
 
-        if (expression->get_type() == Solver::ExpressionType::call_uzawa_a && expression->solver_name == names.back() && (found.back() == 0 || found.back() == 1))
-        {
-          found.back() += 2;
-          auto j = it;
-          ++j;
-          // a solver call found, that is a solver on its own. break processing of current solver and dive on step deeper into a solver processing
-          if ((*j)->get_type() == Solver::ExpressionType::start_solve)
-          {
-            ++it; //shift over to solver start expression
-            if (found.back() == 2)
-              tree += " ( A: " + (*it)->solver_name;
-            else
-              tree += " / A: " + (*it)->solver_name;
-            names.push_back((*it)->solver_name);
-            found.push_back(0);
-            break;
-          }
-          // a solver is no solver on its own, we can continue with the current solver's end statement search
-          else
-          {
-            auto t = dynamic_cast<Solver::ExpressionCallUzawaA*>(expression.get());
-            if (found.back() == 2)
-              tree += " ( A: " + t->solver_a_name;
-            else
-              tree += " / A: " + t->solver_a_name;
-          }
-        }
-
-        if (expression->get_type() == Solver::ExpressionType::end_solve && expression->solver_name == names.back())
-        {
-          tree += " )";
-          names.pop_back();
-          found.pop_back();
-          break;
-        }
-        ++it;
-      }
-    }
-
-    // the current solver uses l and r preconditioners, search for both of them
-    // if both have been found, skip everything until solver end statement has been found
-    else if (names.back().starts_with("PCGNR"))
-    {
-      while (it != _solver_expressions[target].end())
+      while (it < events.size())
       {
-        auto expression = *it;
-
-        if (expression->get_type() == Solver::ExpressionType::call_precond_l && expression->solver_name == names.back() && (found.back() == 0 || found.back() == 2))
+        if (type_of(it) == type_1 && solver_of(it) == names.back() && (found.back() == 0 || found.back() == 2))
         {
           found.back() += 1;
-          auto j = it;
-          ++j;
-          // l solver call found, that is a solver on its own. break processing of current solver and dive on step deeper into l solver processing
-          if ((*j)->get_type() == Solver::ExpressionType::start_solve)
+          const String sep = (found.back() == 1 ? " ( " : " / ");
+          // first solver call found, that is a solver on its own. break processing of current solver and dive on step deeper into its processing
+          if (next_is_start(it))
           {
             ++it; //shift over to solver start expression
-            if (found.back() == 1)
-              tree += " ( L: " + (*it)->solver_name;
-            else
-            tree += " / L: " + (*it)->solver_name;
-            names.push_back((*it)->solver_name);
+            tree += sep + label_1 + solver_of(it);
+            names.push_back(solver_of(it));
             found.push_back(0);
             break;
           }
-          // l solver is no solver on its own, we can continue with the current solver's end statement search
+          // first solver is no solver on its own, we can continue with the current solver's end statement search
           else
           {
-            auto t = dynamic_cast<Solver::ExpressionCallPrecondL*>(expression.get());
-            if (found.back() == 1)
-              tree += " ( L: " + t->precond_name;
-            else
-              tree += " / L: " + t->precond_name;
+            tree += sep + label_1 + other_of(it);
           }
         }
 
-        if (expression->get_type() == Solver::ExpressionType::call_precond_r && expression->solver_name == names.back() && (found.back() == 0 || found.back() == 1))
+        if (type_of(it) == type_2 && solver_of(it) == names.back() && (found.back() == 0 || found.back() == 1))
         {
           found.back() += 2;
-          auto j = it;
-          ++j;
-          // r solver call found, that is a solver on its own. break processing of current solver and dive on step deeper into r solver processing
-          if ((*j)->get_type() == Solver::ExpressionType::start_solve)
+          const String sep = (found.back() == 2 ? " ( " : " / ");
+          // second solver call found, that is a solver on its own. break processing of current solver and dive on step deeper into its processing
+          if (next_is_start(it))
           {
             ++it; //shift over to solver start expression
-            if (found.back() == 2)
-              tree += " ( R: " + (*it)->solver_name;
-            else
-              tree += " / R: " + (*it)->solver_name;
-            names.push_back((*it)->solver_name);
+            tree += sep + label_2 + solver_of(it);
+            names.push_back(solver_of(it));
             found.push_back(0);
             break;
           }
-          // r solver is no solver on its own, we can continue with the current solver's end statement search
+          // second solver is no solver on its own, we can continue with the current solver's end statement search
           else
           {
-            auto t = dynamic_cast<Solver::ExpressionCallPrecondR*>(expression.get());
-            if (found.back() == 2)
-              tree += " ( R: " + t->precond_name;
-            else
-              tree += " / R: " + t->precond_name;
+            tree += sep + label_2 + other_of(it);
           }
         }
 
-        if (expression->get_type() == Solver::ExpressionType::end_solve && expression->solver_name == names.back())
+        if (type_of(it) == Solver::ExpressionType::end_solve && solver_of(it) == names.back())
         {
           tree += " )";
           names.pop_back();
@@ -298,33 +537,28 @@ String Statistics::_generate_formatted_solver_tree(String target)
     else
     {
       // the current solver is not of multigrid or uzawa type, i.e. is uses at most one preconditioner, search for its call or the solvers end.
-      while (it != _solver_expressions[target].end())
+      while (it < events.size())
       {
-        auto expression = *it;
-
-        if (expression->get_type() == Solver::ExpressionType::call_precond && found.back() == 0)
+        if (type_of(it) == Solver::ExpressionType::call_precond && found.back() == 0)
         {
           found.back() += 1;
-          auto j = it;
-          ++j;
           // preconditioner call found, that is a solver on its own. break processing of current solver and dive on step deeper into preconditioner solver processing
-          if ((*j)->get_type() == Solver::ExpressionType::start_solve)
+          if (next_is_start(it))
           {
             ++it; //shift over to solver start expression
-            tree += " ( " + (*it)->solver_name;
-            names.push_back((*it)->solver_name);
+            tree += " ( " + solver_of(it);
+            names.push_back(solver_of(it));
             found.push_back(0);
             break;
           }
           // preconditioner is no solver on its own, we can continue with the current solver's end statement search
           else
           {
-            auto t = dynamic_cast<Solver::ExpressionCallPrecond*>(expression.get());
-            tree += " ( " + t->precond_name;
+            tree += " ( " + other_of(it);
           }
         }
 
-        if (expression->get_type() == Solver::ExpressionType::end_solve && expression->solver_name == names.back())
+        if (type_of(it) == Solver::ExpressionType::end_solve && solver_of(it) == names.back())
         {
           if (found.back() == 0)
             tree += " ( none";
@@ -350,116 +584,54 @@ void Statistics::print_solver_expressions()
 {
   size_t padding(0);
 
-  for (auto expression : _solver_expressions[expression_target])
+  for (const auto& event : get_solver_expressions(expression_target))
   {
-    switch (expression->get_type())
+    const Solver::ExpressionType type = Solver::ExpressionType(event.type);
+    String s = stringify(type) + "[" + get_expression_name(event.solver) + "]";
+    switch (type)
     {
       case Solver::ExpressionType::start_solve:
-        {
-          String s = stringify(expression->get_type()) + "[" + expression->solver_name + "]";
-          std::cout<<String(padding, ' ') << s << std::endl;
-          padding += 2;
-          break;
-        }
+        std::cout << String(padding, ' ') << s << std::endl;
+        padding += 2;
+        continue;
+
       case Solver::ExpressionType::end_solve:
-        {
-          auto t = dynamic_cast<Solver::ExpressionEndSolve*>(expression.get());
-          String s = stringify(t->get_type()) + "[" + t->solver_name + "] (" + stringify(t->status) + " / " + stringify(t->iters) + ")";
-          std::cout<<String(padding, ' ') << s << std::endl;
-          padding -= 2;
-          break;
-        }
+        s += " (" + stringify(Solver::Status(event.other)) + " / " + stringify(event.index) + ")";
+        std::cout << String(padding, ' ') << s << std::endl;
+        padding = (padding >= 2 ? padding - 2 : 0);
+        continue;
+
       case Solver::ExpressionType::defect:
-        {
-          auto t = dynamic_cast<Solver::ExpressionDefect*>(expression.get());
-          String s = stringify(t->get_type()) + "[" + stringify(t->solver_name) + "] (" + stringify(t->def) + " / " + stringify(t->iter) + ")";
-          std::cout<<String(padding, ' ') << s << std::endl;
-          break;
-        }
+        s += " (" + stringify(event.values[0]) + " / " + stringify(event.index) + ")";
+        break;
+
       case Solver::ExpressionType::call_precond:
-        {
-          auto t = dynamic_cast<Solver::ExpressionCallPrecond*>(expression.get());
-          String s = stringify(t->get_type()) + "[" + t->solver_name + "] (" + t->precond_name + ")";
-          std::cout<<String(padding, ' ') << s << std::endl;
-          break;
-        }
       case Solver::ExpressionType::call_precond_l:
-        {
-          auto t = dynamic_cast<Solver::ExpressionCallPrecondL*>(expression.get());
-          String s = stringify(t->get_type()) + "[" + t->solver_name + "] (" + t->precond_name + ")";
-          std::cout<<String(padding, ' ') << s << std::endl;
-          break;
-        }
       case Solver::ExpressionType::call_precond_r:
-        {
-          auto t = dynamic_cast<Solver::ExpressionCallPrecondR*>(expression.get());
-          String s = stringify(t->get_type()) + "[" + t->solver_name + "] (" + t->precond_name + ")";
-          std::cout<<String(padding, ' ') << s << std::endl;
-          break;
-        }
       case Solver::ExpressionType::call_smoother:
-        {
-          auto t = dynamic_cast<Solver::ExpressionCallSmoother*>(expression.get());
-          String s = stringify(t->get_type()) + "[" + stringify(t->solver_name) + "] (" + t->smoother_name + ")";
-          std::cout<<String(padding, ' ') << s << std::endl;
-          break;
-        }
       case Solver::ExpressionType::call_coarse_solver:
-        {
-          auto t = dynamic_cast<Solver::ExpressionCallCoarseSolver*>(expression.get());
-          String s = stringify(t->get_type()) + "[" + t->solver_name + "] (" + t->coarse_solver_name + ")";
-          std::cout<<String(padding, ' ') << s << std::endl;
-          break;
-        }
+      case Solver::ExpressionType::call_uzawa_s:
+      case Solver::ExpressionType::call_uzawa_a:
+        s += " (" + get_expression_name(event.other) + ")";
+        break;
+
       case Solver::ExpressionType::prol:
-        {
-          auto t = dynamic_cast<Solver::ExpressionProlongation*>(expression.get());
-          String s = stringify(t->get_type()) + "[" + t->solver_name + "] (" + stringify(t->level) + ")";
-          std::cout<<String(padding, ' ') << s << std::endl;
-          break;
-        }
       case Solver::ExpressionType::rest:
-        {
-          auto t = dynamic_cast<Solver::ExpressionRestriction*>(expression.get());
-          String s = stringify(t->get_type()) + "[" + t->solver_name + "] (" + stringify(t->level) + ")";
-          std::cout<<String(padding, ' ') << s << std::endl;
-          break;
-        }
+        s += " (" + stringify(event.index) + ")";
+        break;
+
       case Solver::ExpressionType::timings:
-        {
-          auto t = dynamic_cast<Solver::ExpressionTimings*>(expression.get());
-          String s = stringify(t->get_type()) + "[" + t->solver_name + "] (" + stringify(t->solver_toe) + ")";
-          std::cout<<String(padding, ' ') << s << std::endl;
-          break;
-        }
+        s += " (" + stringify(event.values[0]) + ")";
+        break;
+
       case Solver::ExpressionType::level_timings:
-        {
-          auto t = dynamic_cast<Solver::ExpressionLevelTimings*>(expression.get());
-          String s = stringify(t->get_type()) + "[" + t->solver_name + "] (" + stringify(t->level) + " / " + stringify(t->level_toe) + ")";
-          std::cout<<String(padding, ' ') << s << std::endl;
-          break;
-        }
-      case Solver::ExpressionType::call_uzawa_s:
-        {
-          auto t = dynamic_cast<Solver::ExpressionCallUzawaS*>(expression.get());
-          String s = stringify(t->get_type()) + "[" + stringify(t->solver_name) + "] (" + t->solver_s_name + ")";
-          std::cout<<String(padding, ' ') << s << std::endl;
-          break;
-        }
-      case Solver::ExpressionType::call_uzawa_a:
-        {
-          auto t = dynamic_cast<Solver::ExpressionCallUzawaA*>(expression.get());
-          String s = stringify(t->get_type()) + "[" + stringify(t->solver_name) + "] (" + t->solver_a_name + ")";
-          std::cout<<String(padding, ' ') << s << std::endl;
-          break;
-        }
+        s += " (" + stringify(event.index) + " / " + stringify(event.values[0]) + ")";
+        break;
+
       default:
-        {
-          String s = stringify(expression->get_type()) + "[" + expression->solver_name + "]";
-          std::cout<<String(padding, ' ') << s << std::endl;
-          break;
-        }
+        break;
     }
+    std::cout << String(padding, ' ') << s << std::endl;
   }
   std::cout<<std::endl;
 }
@@ -553,7 +725,8 @@ String Statistics::get_formatted_solver_internals(String target)
 {
   Dist::Comm comm(Dist::Comm::world());
 
-  if (_formatted_solver_trees.count(target) == 0)
+  // commit all pending expressions of the target
+  if ((_expression_states.count(target) > 0) && _expression_states.at(target).pending)
     compress_solver_expressions();
 
   auto solver_time_mg = FEAT::Statistics::get_time_mg(target);
@@ -857,143 +1030,47 @@ String Statistics::get_formatted_solver_internals(String target)
 
 void Statistics::compress_solver_expressions()
 {
-  for (auto itarget = _solver_expressions.begin() ; itarget != _solver_expressions.end() ; ++itarget)
+  for (auto itarget = _expression_states.begin() ; itarget != _expression_states.end() ; ++itarget)
   {
-    auto target = itarget->first;
-
-    // generate solver tree string for target, if it was not created earlier
-    if (_formatted_solver_trees.count(target) == 0)
-      _formatted_solver_trees[target] = _generate_formatted_solver_tree(target);
-
-    // explore solver tree, gather top level timings
-    std::vector<String> names;
-
-    if(_solver_expressions.count(target) == 0)
-    {
-      throw InternalError(__func__, __FILE__, __LINE__,
-          "target "+target+" not present in _solver_expressions");
-    }
-
-    if (_solver_expressions[target].front()->get_type() != Solver::ExpressionType::start_solve)
-    {
-      throw InternalError(__func__, __FILE__, __LINE__, "Should never happen - _solver_expressions list did not start with start solve expression!");
-    }
-
-    _overall_toe[target].push_back(0.);
-    _overall_iters[target].push_back(Index(0));
-    _overall_mpi_execute_reduction[target].push_back(0.);
-    _overall_mpi_execute_blas2[target].push_back(0.);
-    _overall_mpi_execute_blas3[target].push_back(0.);
-    _overall_mpi_execute_collective[target].push_back(0.);
-    _overall_mpi_wait_reduction[target].push_back(0.);
-    _overall_mpi_wait_blas2[target].push_back(0.);
-    _overall_mpi_wait_blas3[target].push_back(0.);
-    _overall_mpi_wait_collective[target].push_back(0.);
-    _outer_mg_toe[target].emplace_back();
-    _outer_mg_mpi_execute_reduction[target].emplace_back();
-    _outer_mg_mpi_execute_blas2[target].emplace_back();
-    _outer_mg_mpi_execute_blas3[target].emplace_back();
-    _outer_mg_mpi_execute_collective[target].emplace_back();
-    _outer_mg_mpi_wait_reduction[target].emplace_back();
-    _outer_mg_mpi_wait_blas2[target].emplace_back();
-    _outer_mg_mpi_wait_blas3[target].emplace_back();
-    _outer_mg_mpi_wait_collective[target].emplace_back();
-    _outer_schwarz_toe[target].push_back(0.);
-    _outer_schwarz_iters[target].push_back(Index(0));
-
-    Index outer_mg_depth(0);
-    Index outer_schwarz_depth(0);
-
-    for (auto it = _solver_expressions.at(target).begin() ; it != _solver_expressions.at(target).end() ; ++it)
-    {
-      auto expression = *it;
-
-      if (expression->get_type() == Solver::ExpressionType::start_solve)
-      {
-        names.push_back((*it)->solver_name);
-
-        // set outest mg depth to first mg found in solver tree while descending
-        if (names.size() > 0 && (names.back().starts_with("MultiGrid") || names.back().starts_with("VCycle") || names.back().starts_with("ScaRCMultiGrid")) && outer_mg_depth == 0)
-          outer_mg_depth = (Index)names.size();
-
-        // set depth of schwarz preconditioner in solver tree while descending
-        if (names.size() > 0 && names.back().starts_with("Schwarz") && outer_schwarz_depth == 0)
-          outer_schwarz_depth = (Index)names.size();
-      }
-
-      //fetch iters from top-lvl (lying insided of schwarz or global)
-      if (expression->get_type() == Solver::ExpressionType::end_solve && expression->solver_name == names.back())
-      {
-        if (names.size() > 1 && names.size() == outer_schwarz_depth + 1 && names.at(names.size() - 2) == "Schwarz")
-        {
-          auto t = dynamic_cast<Solver::ExpressionEndSolve*>(expression.get());
-          _outer_schwarz_iters[target].back() += t->iters;
-        }
-        if (names.size() < 2)
-        {
-          auto t = dynamic_cast<Solver::ExpressionEndSolve*>(expression.get());
-
-          _overall_iters[target].back() += t->iters;
-        }
-
-        names.pop_back();
-        continue;
-      }
-
-      if ((names.size() < 2) && expression->get_type() == FEAT::Solver::ExpressionType::timings)
-      {
-        auto t = dynamic_cast<Solver::ExpressionTimings*>(expression.get());
-
-        _overall_toe[target].back() += t->solver_toe;
-        _overall_mpi_execute_reduction[target].back() += t->mpi_execute_reduction;
-        _overall_mpi_execute_blas2[target].back() += t->mpi_execute_blas2;
-        _overall_mpi_execute_blas3[target].back() += t->mpi_execute_blas3;
-        _overall_mpi_execute_collective[target].back() += t->mpi_execute_collective;
-        _overall_mpi_wait_reduction[target].back() += t->mpi_wait_reduction;
-        _overall_mpi_wait_blas2[target].back() += t->mpi_wait_blas2;
-        _overall_mpi_wait_blas3[target].back() += t->mpi_wait_blas3;
-        _overall_mpi_wait_collective[target].back() += t->mpi_wait_collective;
-      }
-
-      if (names.size() == outer_mg_depth && expression->get_type() == FEAT::Solver::ExpressionType::level_timings)
-      {
-        auto t = dynamic_cast<Solver::ExpressionLevelTimings*>(expression.get());
-        // add new vector entry for current level if vector does not already contain an entry for this level
-        if (_outer_mg_toe[target].back().size() <= t->level)
-        {
-          _outer_mg_toe[target].back().push_back(t->level_toe);
-          _outer_mg_mpi_execute_reduction[target].back().push_back(t->mpi_execute_reduction);
-          _outer_mg_mpi_execute_blas2[target].back().push_back(t->mpi_execute_blas2);
-          _outer_mg_mpi_execute_blas3[target].back().push_back(t->mpi_execute_blas3);
-          _outer_mg_mpi_execute_collective[target].back().push_back(t->mpi_execute_collective);
-          _outer_mg_mpi_wait_reduction[target].back().push_back(t->mpi_wait_reduction);
-          _outer_mg_mpi_wait_blas2[target].back().push_back(t->mpi_wait_blas2);
-          _outer_mg_mpi_wait_blas3[target].back().push_back(t->mpi_wait_blas3);
-          _outer_mg_mpi_wait_collective[target].back().push_back(t->mpi_wait_collective);
-        }
-        else
-        {
-          _outer_mg_toe[target].back().at(t->level) += t->level_toe;
-          _outer_mg_mpi_execute_reduction[target].back().at(t->level) += t->mpi_execute_reduction;
-          _outer_mg_mpi_execute_blas2[target].back().at(t->level) += t->mpi_execute_blas2;
-          _outer_mg_mpi_execute_blas3[target].back().at(t->level) += t->mpi_execute_blas3;
-          _outer_mg_mpi_execute_collective[target].back().at(t->level) += t->mpi_execute_collective;
-          _outer_mg_mpi_wait_reduction[target].back().at(t->level) += t->mpi_wait_reduction;
-          _outer_mg_mpi_wait_blas2[target].back().at(t->level) += t->mpi_wait_blas2;
-          _outer_mg_mpi_wait_blas3[target].back().at(t->level) += t->mpi_wait_blas3;
-          _outer_mg_mpi_wait_collective[target].back().at(t->level) += t->mpi_wait_collective;
-        }
-      }
-
-      //grep the solver which lies in the schwarz solver to get its toe
-      if (names.size() > 1 && names.size() == outer_schwarz_depth + 1 && names.at(names.size() - 2) == "Schwarz" && expression->get_type() == FEAT::Solver::ExpressionType::timings)
-      {
-        auto t = dynamic_cast<Solver::ExpressionTimings*>(expression.get());
-        _outer_schwarz_toe[target].back() += t->solver_toe;
-      }
-    }
+    const String& target = itarget->first;
+    ExpressionTargetState& state = itarget->second;
+
+    // skip targets without any expressions since the last compression
+    if (!state.pending)
+      continue;
+
+    // commit the condensed statistics of this target
+    _overall_toe[target].push_back(state.toe);
+    _overall_iters[target].push_back(state.iters);
+    _overall_mpi_execute_reduction[target].push_back(state.mpi_times[0]);
+    _overall_mpi_execute_blas2[target].push_back(state.mpi_times[1]);
+    _overall_mpi_execute_blas3[target].push_back(state.mpi_times[2]);
+    _overall_mpi_execute_collective[target].push_back(state.mpi_times[3]);
+    _overall_mpi_wait_reduction[target].push_back(state.mpi_times[4]);
+    _overall_mpi_wait_blas2[target].push_back(state.mpi_times[5]);
+    _overall_mpi_wait_blas3[target].push_back(state.mpi_times[6]);
+    _overall_mpi_wait_collective[target].push_back(state.mpi_times[7]);
+    _outer_mg_toe[target].push_back(std::move(state.mg_times[0]));
+    _outer_mg_mpi_execute_reduction[target].push_back(std::move(state.mg_times[1]));
+    _outer_mg_mpi_execute_blas2[target].push_back(std::move(state.mg_times[2]));
+    _outer_mg_mpi_execute_blas3[target].push_back(std::move(state.mg_times[3]));
+    _outer_mg_mpi_execute_collective[target].push_back(std::move(state.mg_times[4]));
+    _outer_mg_mpi_wait_reduction[target].push_back(std::move(state.mg_times[5]));
+    _outer_mg_mpi_wait_blas2[target].push_back(std::move(state.mg_times[6]));
+    _outer_mg_mpi_wait_blas3[target].push_back(std::move(state.mg_times[7]));
+    _outer_mg_mpi_wait_collective[target].push_back(std::move(state.mg_times[8]));
+    _outer_schwarz_toe[target].push_back(state.schwarz_toe);
+    _outer_schwarz_iters[target].push_back(state.schwarz_iters);
+
+    // reset the accumulators for the next round
+    state.pending = false;
+    state.toe = state.schwarz_toe = 0.0;
+    state.iters = state.schwarz_iters = Index(0);
+    for (int i(0); i < 8; ++i)
+      state.mpi_times[i] = 0.0;
+    for (int i(0); i < 9; ++i)
+      state.mg_times[i].clear();
+    if (state.names.empty())
+      state.outer_mg_depth = state.outer_schwarz_depth = Index(0);
   }
-
-  // clear raw solver expressions
-  _solver_expressions.clear();
 }
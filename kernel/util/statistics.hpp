@@ -11,14 +11,17 @@
 #include <kernel/util/string.hpp>
 #include <kernel/util/exception.hpp>
 #include <kernel/util/kahan_summation.hpp>
+#include <kernel/util/time_stamp.hpp>
 #include <kernel/solver/expression.hpp>
 
+#include <cstdint>
 #include <list>
 #include <map>
 #include <time.h>
 #include <iostream>
 #include <fstream>
 #include <memory>
+#include <vector>
 
 namespace FEAT
 {
@@ -27,10 +30,63 @@ namespace FEAT
    *
    * The class Statistics encapsulates various hardware counters,
    * that collects e.g. the accumulated flop count of an linear solver.
+   *
+   * Furthermore, this class records the solver expressions, which are emitted by all solvers
+   * during their execution. The expressions are not stored as a whole; instead, each expression
+   * is immediately condensed into the per-target solver statistics, which are committed to the
+   * lists returned by e.g. get_time_toe() by compress_solver_expressions(). Depending on the
+   * expression verbosity, each expression is additionally stored as a compact POD event in a
+   * preallocated ring buffer, which can be printed by print_solver_expressions() or written to
+   * a binary trace file by write_expression_trace(). Once the ring buffer is full, the oldest
+   * events are overwritten, so that the memory consumption stays bounded in long runs.
    */
   class Statistics
   {
+    public:
+      /// verbosity levels of the solver expression recording
+      enum class ExpressionVerbosity
+      {
+        /// ignore all solver expressions
+        none = 0,
+        /// condense the solver expressions into the solver statistics only
+        summary,
+        /// additionally store all solver expressions in the event ring buffer
+        trace
+      };
+
     private:
+      /// recording state of a single expression target
+      struct ExpressionTargetState
+      {
+        /// stack of the ids of all currently active solvers
+        std::vector<std::uint32_t> names;
+        /// depth of the outer multigrid and the outer schwarz solver in the stack
+        Index outer_mg_depth, outer_schwarz_depth;
+        /// specifies whether any expression was recorded since the last compression
+        bool pending;
+        /// accumulated outer solver toe and iterations
+        double toe;
+        Index iters;
+        /// accumulated outer solver mpi timings
+        double mpi_times[8];
+        /// accumulated outer multigrid level timings
+        std::vector<double> mg_times[9];
+        /// accumulated schwarz solver toe and iterations
+        double schwarz_toe;
+        Index schwarz_iters;
+        /// the events of the first outer solve process, which are required for the solver tree
+        std::vector<Solver::ExpressionEvent> tree_events;
+        /// specifies whether the first outer solve process has been completed
+        bool tree_complete;
+
+        ExpressionTargetState() :
+          outer_mg_depth(0), outer_schwarz_depth(0), pending(false), toe(0.0), iters(0),
+          schwarz_toe(0.0), schwarz_iters(0), tree_complete(false)
+        {
+          for(int i(0); i < 8; ++i)
+            mpi_times[i] = 0.0;
+        }
+      };
 
       /// global flop counter
       static Index _flops;
@@ -74,8 +130,34 @@ namespace FEAT
       /// global time of wait execution for mpi related idle/wait tasks of collective operations (without scalar reduction)
       static KahanAccumulation _time_mpi_wait_collective;
 
-      /// a consecutive list of all solver actions
-      static std::map<String, std::list<std::shared_ptr<Solver::ExpressionBase>>> _solver_expressions;
+      /// the current expression verbosity
+      static ExpressionVerbosity _expression_verbosity;
+      /// time stamp of the initialisation of the statistics
+      static TimeStamp _expression_epoch;
+      /// all interned expression names
+      static std::vector<String> _expression_names;
+      /// mapping of interned expression names to their ids
+      static std::map<String, std::uint32_t> _expression_name_ids;
+      /// the expression event ring buffer
+      static std::vector<Solver::ExpressionEvent> _expression_events;
+      /// the capacity of the expression event ring buffer
+      static std::size_t _expression_capacity;
+      /// the total number of events written to the ring buffer
+      static std::uint64_t _expression_count;
+      /// returns the interned id of an expression name, which is interned first if necessary
+      static std::uint32_t _expression_name_id(const Solver::ExpressionName& name)
+      {
+        return (name.id != Solver::ExpressionName::no_id) ? name.id : intern_expression_name(name.name);
+      }
+
+      /// the recording states of all expression targets
+      static std::map<String, ExpressionTargetState> _expression_states;
+      /// the expression target that the cached target id and state belong to
+      static String _expression_target_cached;
+      /// the interned id of the cached expression target
+      static std::uint32_t _expression_target_id;
+      /// the recording state of the cached expression target
+      static ExpressionTargetState* _expression_target_state;
 
       /// mapping of solver target name to formatted solver tree string
       static std::map<String, String> _formatted_solver_trees;
@@ -159,7 +241,10 @@ namespace FEAT
         return result;
       }*/
 
-      static String _generate_formatted_solver_tree(String target);
+      static String _generate_formatted_solver_tree(const std::vector<Solver::ExpressionEvent>& events);
+
+      /// condenses a single expression event into the statistics of its target
+      static void _condense_expression(ExpressionTargetState& state, const Solver::ExpressionEvent& event);
 
     public:
 
@@ -178,7 +263,9 @@ namespace FEAT
       {
         reset_flops();
         reset_times();
-        _solver_expressions.clear();
+        _expression_states.clear();
+        _expression_target_state = nullptr;
+        _expression_count = 0u;
         _overall_toe.clear();
         _overall_iters.clear();
         _overall_mpi_execute_reduction.clear();
@@ -337,16 +424,99 @@ namespace FEAT
         return _time_mpi_wait_collective.sum;
       }
 
-      inline static void add_solver_expression(std::shared_ptr<Solver::ExpressionBase> expression)
+      /**
+       * \brief Records a solver expression for the current expression target.
+       *
+       * \param[in] expression
+       * The solver expression to be recorded.
+       */
+      static void add_solver_expression(const Solver::ExpressionBase& expression);
+
+      /**
+       * \brief Sets the verbosity of the solver expression recording.
+       *
+       * \param[in] verbosity
+       * The new expression verbosity. The default verbosity is ExpressionVerbosity::trace.
+       */
+      static void set_expression_verbosity(ExpressionVerbosity verbosity)
       {
-        _solver_expressions[expression_target].push_back(expression);
+        _expression_verbosity = verbosity;
       }
 
-      static const std::list<std::shared_ptr<Solver::ExpressionBase>> & get_solver_expressions()
+      /// \returns The current verbosity of the solver expression recording.
+      static ExpressionVerbosity get_expression_verbosity()
       {
-        return _solver_expressions.at(expression_target);
+        return _expression_verbosity;
       }
 
+      /**
+       * \brief Sets the capacity of the expression event ring buffer.
+       *
+       * \note This function discards all events, which are currently stored in the ring buffer.
+       *
+       * \param[in] capacity
+       * The maximum number of events to be stored in the ring buffer. The default capacity is 16384.
+       */
+      static void set_expression_capacity(std::size_t capacity)
+      {
+        _expression_events.clear();
+        _expression_events.shrink_to_fit();
+        _expression_capacity = capacity;
+        _expression_count = 0u;
+      }
+
+      /// \returns The capacity of the expression event ring buffer.
+      static std::size_t get_expression_capacity()
+      {
+        return _expression_capacity;
+      }
+
+      /**
+       * \brief Returns the interned id of an expression name.
+       *
+       * If the name has not been interned yet, a new id is assigned to it.
+       *
+       * \param[in] name
+       * The solver or expression target name whose id is to be returned.
+       */
+      static std::uint32_t intern_expression_name(const String& name);
+
+      /// \returns The expression name corresponding to an interned id.
+      static const String& get_expression_name(std::uint32_t id)
+      {
+        return _expression_names.at(std::size_t(id));
+      }
+
+      /**
+       * \brief Returns all events, which are currently stored in the ring buffer.
+       *
+       * \param[in] target
+       * The expression target whose events are to be returned.
+       *
+       * \returns
+       * A vector of all stored events of the target in chronological order.
+       */
+      static std::vector<Solver::ExpressionEvent> get_solver_expressions(String target = expression_target);
+
+      /**
+       * \brief Writes all events of the ring buffer into a binary trace file.
+       *
+       * The trace file consists of the following data, where all integers are stored in
+       * the native byte order:
+       * - the magic string "FEATTRC1"
+       * - the number of interned names, the number of stored events and the number of
+       *   overwritten events, each as 64-bit unsigned integer
+       * - for each name, its length as 32-bit unsigned integer followed by its characters
+       * - all stored events in chronological order as Solver::ExpressionEvent records
+       *
+       * These files can be converted to the Chrome trace format by the \c trace2json script
+       * in the \c tools/solver_statistics directory.
+       *
+       * \param[in] filename
+       * The name of the trace file, e.g. <c>"trace." + stringify(rank)</c>.
+       */
+      static void write_expression_trace(const String& filename);
+
       /**
        * \brief Returns a descriptive string of the complete solver tree.
        *
@@ -355,19 +525,16 @@ namespace FEAT
        * \note This method makes some simplifications, e.g. stating only one smoother
        * for the complete FEAT::Solver::BasicVCycle.
        *
-       * \note The solver must have been executed (successfully) at least one time, to make the solver tree available.
+       * \note The tree is generated once the first solve process of the target has been completed.
+       * If the first solve process is still running, the tree is generated from the expressions recorded
+       * so far, i.e. all solvers which are still running are closed; if no expression has been recorded for the target at all, an empty string is returned.
        */
-      static String get_formatted_solver_tree(String target = "default")
-      {
-        if (_formatted_solver_trees.count(target) == 0)
-          compress_solver_expressions();
-        return _formatted_solver_trees.at(target);
-      }
+      static String get_formatted_solver_tree(String target = "default");
 
-      /// print out the complete solver expression list
+      /// print out all solver expressions of the current target, which are stored in the event ring buffer
       static void print_solver_expressions();
 
-      ///compress solver statistics (toe / defect norm / mpi timings) from previous calls
+      ///commit the condensed solver statistics (toe / iterations / mpi timings) of all previous calls
       static void compress_solver_expressions();
 
       /// retrieve list of all overall solver toe entries